@@ -49,14 +49,31 @@
 
 /*1: use custom malloc/free, 0: use the built-in `lv_mem_alloc()` and `lv_mem_free()`*/
 #define LV_MEM_CUSTOM 0
+
+/*1: place the LVGL heap in PSRAM (env:esp32s3_psram). The pool is requested once
+ *in lv_init() through lvgl_mem_pool_alloc() (display_panel.cpp), which falls back
+ *to internal RAM if PSRAM is missing. 0: static pool in internal RAM.*/
+#ifndef UI_LVGL_MEM_PSRAM
+#define UI_LVGL_MEM_PSRAM 0
+#endif
+
 #if LV_MEM_CUSTOM == 0
     /*Size of the memory available for `lv_mem_alloc()` in bytes (>= 2kB)*/
+    #ifndef LV_MEM_SIZE
+    #if UI_LVGL_MEM_PSRAM
+    #define LV_MEM_SIZE (128U * 1024U)         /*[bytes]*/
+    #else
     #define LV_MEM_SIZE (48U * 1024U)          /*[bytes]*/
+    #endif
+    #endif
 
     /*Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too.*/
     #define LV_MEM_ADR 0     /*0: unused*/
     /*Instead of an address give a memory allocator that will be called to get a memory pool for LVGL. E.g. my_malloc*/
-    #if LV_MEM_ADR == 0
+    #if LV_MEM_ADR == 0 && UI_LVGL_MEM_PSRAM
+        #define LV_MEM_POOL_INCLUDE "lvgl_mem_pool.h"
+        #define LV_MEM_POOL_ALLOC   lvgl_mem_pool_alloc
+    #elif LV_MEM_ADR == 0
         #undef LV_MEM_POOL_INCLUDE
         #undef LV_MEM_POOL_ALLOC
     #endif
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stddef.h>
+
+// Pool provider for LV_MEM_POOL_ALLOC (lv_conf.h, UI_LVGL_MEM_PSRAM=1).
+// Called once from lv_init(); implemented in src/display_panel.cpp.
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void *lvgl_mem_pool_alloc(size_t size);
+
+#ifdef __cplusplus
+}
+#endif
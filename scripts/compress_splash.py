@@ -0,0 +1,172 @@
+"""Compress the raw RGB565 boot splash into the streaming format read by
+src/splash_codec.cpp.
+
+Runs as a PlatformIO pre-script (regenerates the compressed header when the
+raw header changed) or standalone:
+
+    python scripts/compress_splash.py [project_dir]
+"""
+
+import hashlib
+import re
+import sys
+from pathlib import Path
+
+RAW_HEADER = Path("src") / "splash_image_536x240_rgb565.h"
+OUT_HEADER = Path("src") / "splash_image_536x240_lz.h"
+WIDTH = 536
+HEIGHT = 240
+
+WINDOW_PX = 2048        # must match SPLASH_CODEC_WINDOW_PX
+MAX_LITERAL = 128
+MIN_MATCH = 2
+MAX_MATCH = 2 + 0x7F + 0xFFFF
+MAX_CHAIN = 128
+
+
+def read_raw_pixels(path: Path):
+    text = path.read_text(encoding="ascii")
+    body = text[text.index("{") + 1:text.rindex("}")]
+    pixels = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{1,4}", body)]
+    if len(pixels) != WIDTH * HEIGHT:
+        raise ValueError(f"{path}: expected {WIDTH * HEIGHT} pixels, found {len(pixels)}")
+    return pixels
+
+
+def encode(pixels):
+    out = bytearray()
+    literals = []
+    chains = {}
+    n = len(pixels)
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:MAX_LITERAL]
+            del literals[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            for px in chunk:
+                out.extend(px.to_bytes(2, "little"))
+
+    def remember(i):
+        if i + 1 < n:
+            chains.setdefault((pixels[i], pixels[i + 1]), []).append(i)
+
+    i = 0
+    while i < n:
+        best_len = 0
+        best_dist = 0
+        if i + 1 < n:
+            for cand in reversed(chains.get((pixels[i], pixels[i + 1]), [])[-MAX_CHAIN:]):
+                dist = i - cand
+                if dist > WINDOW_PX:
+                    break
+                length = 0
+                while i + length < n and length < MAX_MATCH and pixels[cand + length] == pixels[i + length]:
+                    length += 1
+                if length > best_len:
+                    best_len = length
+                    best_dist = dist
+
+        if best_len >= MIN_MATCH:
+            flush_literals()
+            extra = best_len - MIN_MATCH
+            if extra < 0x7F:
+                out.append(0x80 | extra)
+            else:
+                out.append(0xFF)
+                out.extend((extra - 0x7F).to_bytes(2, "little"))
+            if best_dist < 0x80:
+                out.append(best_dist)
+            else:
+                out.append(0x80 | (best_dist & 0x7F))
+                out.append(best_dist >> 7)
+            for k in range(i, i + best_len):
+                remember(k)
+            i += best_len
+        else:
+            literals.append(pixels[i])
+            remember(i)
+            i += 1
+
+    flush_literals()
+    return bytes(out)
+
+
+def decode(data: bytes, count: int):
+    """Reference decoder used to verify the encoder output before writing."""
+    out = []
+    pos = 0
+    while pos < len(data) and len(out) < count:
+        c = data[pos]
+        pos += 1
+        if c < 0x80:
+            for _ in range(c + 1):
+                out.append(data[pos] | (data[pos + 1] << 8))
+                pos += 2
+            continue
+        length = (c & 0x7F) + MIN_MATCH
+        if (c & 0x7F) == 0x7F:
+            length += data[pos] | (data[pos + 1] << 8)
+            pos += 2
+        dist = data[pos]
+        pos += 1
+        if dist & 0x80:
+            dist = (dist & 0x7F) | (data[pos] << 7)
+            pos += 1
+        for _ in range(length):
+            out.append(out[-dist])
+    return out
+
+
+def write_header(path: Path, data: bytes, source_hash: str):
+    lines = [
+        "#pragma once",
+        "",
+        "// Generated by scripts/compress_splash.py from splash_image_536x240_rgb565.h.",
+        "// Do not edit; regenerate by building or running the script.",
+        f"// source-sha256: {source_hash}",
+        "",
+        "#include <stdint.h>",
+        "",
+        f"#define SPLASH_IMAGE_LZ_WIDTH {WIDTH}",
+        f"#define SPLASH_IMAGE_LZ_HEIGHT {HEIGHT}",
+        "",
+        f"static const uint8_t SPLASH_IMAGE_536x240_LZ[{len(data)}] = {{",
+    ]
+    for start in range(0, len(data), 16):
+        chunk = data[start:start + 16]
+        lines.append("    " + " ".join(f"0x{b:02X}," for b in chunk))
+    lines.append("};")
+    path.write_text("\n".join(lines) + "\n", encoding="ascii", newline="\n")
+
+
+def header_hash(path: Path):
+    if not path.exists():
+        return None
+    match = re.search(r"source-sha256: ([0-9a-f]{64})", path.read_text(encoding="ascii"))
+    return match.group(1) if match else None
+
+
+def run(project_dir: Path):
+    raw_path = project_dir / RAW_HEADER
+    out_path = project_dir / OUT_HEADER
+    source_hash = hashlib.sha256(raw_path.read_bytes()).hexdigest()
+    if header_hash(out_path) == source_hash:
+        return
+
+    pixels = read_raw_pixels(raw_path)
+    data = encode(pixels)
+    if decode(data, len(pixels)) != pixels:
+        raise RuntimeError("splash encoder round-trip mismatch")
+    write_header(out_path, data, source_hash)
+    print(f"[splash] {RAW_HEADER} -> {OUT_HEADER}: {len(pixels) * 2} -> {len(data)} bytes")
+
+
+try:
+    Import("env")  # noqa: F821 (PlatformIO/SCons)
+except NameError:
+    if __name__ == "__main__":
+        run(Path(sys.argv[1]) if len(sys.argv) > 1 else Path(__file__).resolve().parent.parent)
+else:
+    if not env.IsIntegrationDump():  # noqa: F821
+        run(Path(env.subst("$PROJECT_DIR")))  # noqa: F821
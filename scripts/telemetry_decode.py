@@ -0,0 +1,167 @@
+"""Decode the binary serial telemetry stream (serial command `b`) to CSV.
+
+Frame format: see src/telemetry_frame.h. Each frame is 0x00, the COBS-encoded
+94-byte record, 0x00. Anything between delimiters that does not decode (log
+text, a cut-off or corrupted frame) is counted and skipped.
+
+From a capture file:
+
+    python scripts/telemetry_decode.py capture.bin -o sweep.csv
+
+Live from the device (needs pyserial; sends `b` to start and again to stop,
+so start with the stream off):
+
+    python scripts/telemetry_decode.py --port COM5 --seconds 60 -o sweep.csv --raw capture.bin
+"""
+
+import argparse
+import csv
+import struct
+import sys
+import time
+
+RECORD_SAMPLE = 0x01
+RECORD_VERSION = 1
+PAYLOAD_BYTES = 94
+MAX_FRAME_BYTES = 1 + PAYLOAD_BYTES + PAYLOAD_BYTES // 254
+
+# type, version, flags, reserved, seq, t_us, 20 floats, crc
+RECORD = struct.Struct("<BBBBII20fH")
+assert RECORD.size == PAYLOAD_BYTES
+
+FIELDS = [
+    "seq", "t_us", "flags",
+    "sens_ax", "sens_ay", "sens_az", "sens_gx", "sens_gy", "sens_gz",
+    "map_ax", "map_ay", "map_az", "map_gx", "map_gy",
+    "corr_ax", "corr_ay", "corr_az", "corr_gx", "corr_gy",
+    "roll_phys", "pitch_phys", "roll", "pitch",
+]
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, as telemetry_crc16()."""
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            return None
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def unpack(payload):
+    if payload is None or len(payload) != PAYLOAD_BYTES:
+        return None
+    fields = RECORD.unpack(payload)
+    if fields[0] != RECORD_SAMPLE or fields[1] != RECORD_VERSION:
+        return None
+    if fields[-1] != crc16(payload[:-2]):
+        return None
+    return [fields[4], fields[5], fields[2]] + list(fields[6:-1])
+
+
+class StreamDecoder:
+    """Byte-stream reader; resynchronises on every 0x00 like the firmware's."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.frames_ok = 0
+        self.frames_bad = 0
+        self.seq_gaps = 0
+        self.last_seq = None
+
+    def feed(self, data):
+        records = []
+        for b in data:
+            if b != 0:
+                self.buf.append(b)
+                continue
+            if not self.buf:
+                continue
+            chunk = bytes(self.buf)
+            self.buf.clear()
+            rec = unpack(cobs_decode(chunk)) if len(chunk) <= MAX_FRAME_BYTES else None
+            if rec is None:
+                self.frames_bad += 1
+                continue
+            self.frames_ok += 1
+            seq = rec[0]
+            if self.last_seq is not None and seq != (self.last_seq + 1) & 0xFFFFFFFF:
+                self.seq_gaps += 1
+            self.last_seq = seq
+            records.append(rec)
+        return records
+
+
+def format_row(rec):
+    return [rec[0], rec[1], rec[2]] + ["%.6g" % v for v in rec[3:]]
+
+
+def run(args):
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    writer = csv.writer(out)
+    writer.writerow(FIELDS)
+    dec = StreamDecoder()
+
+    if args.port:
+        import serial  # pyserial
+
+        raw = open(args.raw, "wb") if args.raw else None
+        with serial.Serial(args.port, args.baud, timeout=0.2) as port:
+            port.write(b"b")
+            deadline = time.monotonic() + args.seconds if args.seconds else None
+            try:
+                while deadline is None or time.monotonic() < deadline:
+                    data = port.read(4096)
+                    if raw:
+                        raw.write(data)
+                    for rec in dec.feed(data):
+                        writer.writerow(format_row(rec))
+            except KeyboardInterrupt:
+                pass
+            finally:
+                port.write(b"b")
+        if raw:
+            raw.close()
+    else:
+        with open(args.input, "rb") as f:
+            for rec in dec.feed(f.read()):
+                writer.writerow(format_row(rec))
+
+    if out is not sys.stdout:
+        out.close()
+    print("frames ok %d, bad %d, sequence gaps %d" % (dec.frames_ok, dec.frames_bad, dec.seq_gaps),
+          file=sys.stderr)
+    return 0 if dec.frames_ok else 1
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("input", nargs="?", help="recorded byte stream")
+    ap.add_argument("-o", "--output", help="CSV file (default stdout)")
+    ap.add_argument("--port", help="read live from this serial port instead")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--seconds", type=float, default=0, help="live capture length (0 = until Ctrl-C)")
+    ap.add_argument("--raw", help="also save the live byte stream here")
+    args = ap.parse_args()
+    if not args.port and not args.input:
+        ap.error("give a capture file or --port")
+    sys.exit(run(args))
+
+
+if __name__ == "__main__":
+    main()
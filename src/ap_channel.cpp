@@ -0,0 +1,72 @@
+#include "ap_channel.h"
+
+namespace {
+
+// Share of a network's weight seen on a channel 0..3 away.
+const float kOverlap[] = {1.0f, 0.7f, 0.4f, 0.15f};
+constexpr int kOverlapSpan = (int)(sizeof(kOverlap) / sizeof(kOverlap[0]));
+
+// Signal above the -100 dBm floor: a -40 dBm neighbour counts six times a
+// -90 dBm one.
+constexpr int kRssiFloorDbm = -100;
+constexpr int kRssiCeilDbm = -30;
+
+constexpr float kTieMargin = 1.0f;
+constexpr float kSwitchRatio = 0.75f;
+constexpr float kSwitchMinGain = 5.0f;
+
+float rssi_weight(int8_t rssi) {
+  int r = rssi;
+  if (r > kRssiCeilDbm) r = kRssiCeilDbm;
+  if (r < kRssiFloorDbm) r = kRssiFloorDbm;
+  return (float)(r - kRssiFloorDbm);
+}
+
+bool non_overlapping(uint8_t ch) {
+  return ch == 1 || ch == 6 || ch == 11;
+}
+
+}  // namespace
+
+void ap_channel_score(const ApChannelObservation *obs, size_t count, uint8_t max_channel, float *load) {
+  if (!load) return;
+  if (max_channel > AP_CHANNEL_MAX) max_channel = AP_CHANNEL_MAX;
+  for (uint8_t ch = 0; ch <= max_channel; ++ch) load[ch] = 0.0f;
+  if (!obs) return;
+
+  for (size_t i = 0; i < count; ++i) {
+    const int src = obs[i].channel;
+    if (src < 1 || src > AP_CHANNEL_MAX) continue;
+    const float w = rssi_weight(obs[i].rssi);
+    for (int d = -(kOverlapSpan - 1); d <= kOverlapSpan - 1; ++d) {
+      const int ch = src + d;
+      if (ch < 1 || ch > max_channel) continue;
+      load[ch] += w * kOverlap[d < 0 ? -d : d];
+    }
+  }
+}
+
+uint8_t ap_channel_pick(const float *load, uint8_t max_channel) {
+  if (!load) return 1;
+  if (max_channel > AP_CHANNEL_MAX) max_channel = AP_CHANNEL_MAX;
+  if (max_channel < 1) return 1;
+
+  uint8_t best = 1;
+  for (uint8_t ch = 2; ch <= max_channel; ++ch) {
+    const float diff = load[ch] - load[best];
+    if (diff < -kTieMargin) {
+      best = ch;
+    } else if (diff <= kTieMargin && non_overlapping(ch) && !non_overlapping(best)) {
+      best = ch;
+    }
+  }
+  return best;
+}
+
+bool ap_channel_should_switch(const float *load, uint8_t current, uint8_t candidate) {
+  if (!load || candidate < 1 || candidate > AP_CHANNEL_MAX) return false;
+  if (current < 1 || current > AP_CHANNEL_MAX) return true;
+  if (candidate == current) return false;
+  const float gain = load[current] - load[candidate];
+  return gain >= kSwitchMinGain && load[candidate] <= load[current] * kSwitchRatio;
+}
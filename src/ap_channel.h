@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Soft-AP channel choice from a site scan. Every network heard adds load to
+// its own channel and, scaled down, to the three on either side (20 MHz
+// channels 5 MHz apart overlap up to 4 apart); stronger signals weigh more.
+// No Arduino dependencies; the network manager runs the scan.
+
+constexpr uint8_t AP_CHANNEL_MAX = 13;
+constexpr uint8_t AP_CHANNEL_AUTO_MAX = 11;  // usable in every regulatory domain
+
+struct ApChannelObservation {
+  uint8_t channel;
+  int8_t rssi;  // dBm
+};
+
+// load[0] is unused; load[1..max_channel] receive the weighted occupancy.
+void ap_channel_score(const ApChannelObservation *obs, size_t count, uint8_t max_channel, float *load);
+
+// Least-loaded channel in 1..max_channel. Near-ties go to 1/6/11, which do
+// not overlap each other, then to the lower channel.
+uint8_t ap_channel_pick(const float *load, uint8_t max_channel);
+
+// Move from `current` to `candidate` only for a clear improvement, so two
+// scans that differ by one weak beacon do not bounce the AP.
+bool ap_channel_should_switch(const float *load, uint8_t current, uint8_t candidate);
@@ -0,0 +1,48 @@
+#include "battery_model.h"
+
+namespace {
+
+struct OcvPoint {
+  float v;
+  float soc;
+};
+
+constexpr OcvPoint kOcvCurve[] = {
+  {3.30f, 0.0f},
+  {3.40f, 3.0f},
+  {3.50f, 8.0f},
+  {3.60f, 15.0f},
+  {3.70f, 28.0f},
+  {3.80f, 45.0f},
+  {3.90f, 62.0f},
+  {4.00f, 78.0f},
+  {4.10f, 90.0f},
+  {4.20f, 100.0f}
+};
+constexpr int kOcvLast = (int)(sizeof(kOcvCurve) / sizeof(kOcvCurve[0])) - 1;
+
+}  // namespace
+
+float battery_model_ocv(float loaded_v, float load_ma) {
+  if (!(load_ma > 0.0f)) return loaded_v;
+  return loaded_v + (load_ma / 1000.0f) * BATTERY_MODEL_INTERNAL_OHM;
+}
+
+float battery_model_soc_from_ocv(float ocv_v) {
+  if (!(ocv_v > kOcvCurve[0].v)) return kOcvCurve[0].soc;
+  if (ocv_v >= kOcvCurve[kOcvLast].v) return kOcvCurve[kOcvLast].soc;
+
+  for (int i = 1; i <= kOcvLast; ++i) {
+    if (ocv_v <= kOcvCurve[i].v) {
+      const float t = (ocv_v - kOcvCurve[i - 1].v) / (kOcvCurve[i].v - kOcvCurve[i - 1].v);
+      return kOcvCurve[i - 1].soc + t * (kOcvCurve[i].soc - kOcvCurve[i - 1].soc);
+    }
+  }
+  return kOcvCurve[kOcvLast].soc;
+}
+
+float battery_model_time_to_empty_h(float soc_percent, float capacity_mah, float load_ma) {
+  if (!(load_ma > 0.0f) || !(soc_percent > 0.0f) || !(capacity_mah > 0.0f)) return 0.0f;
+  const float soc = (soc_percent > 100.0f) ? 100.0f : soc_percent;
+  return capacity_mah * (soc / 100.0f) / load_ma;
+}
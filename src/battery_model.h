@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+// Single-cell LiPo state of charge from a voltage read under load.
+//
+// The cell voltage sags by the load current times the pack's internal
+// resistance, so a brighter panel or a live Wi-Fi radio used to read as a
+// lower SOC. The load comes from the power model (see power_model.h); adding
+// I*R back gives an open-circuit estimate that the OCV table can use.
+
+// Effective series resistance: cell, protection FETs, connector and traces.
+constexpr float BATTERY_MODEL_INTERNAL_OHM = 0.20f;
+
+// Open-circuit voltage for a cell at `loaded_v` delivering `load_ma`.
+// Negative or unknown loads (charging) are not compensated.
+float battery_model_ocv(float loaded_v, float load_ma);
+
+// 0..100 from the resting voltage curve (3.30 V empty, 4.20 V full).
+float battery_model_soc_from_ocv(float ocv_v);
+
+// Hours until empty at `load_ma` with `soc_percent` of `capacity_mah` left
+// (0 if the load or the remaining charge is not positive).
+float battery_model_time_to_empty_h(float soc_percent, float capacity_mah, float load_ma);
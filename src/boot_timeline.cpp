@@ -0,0 +1,91 @@
+#include "boot_timeline.h"
+
+#include <stdio.h>
+
+namespace {
+
+uint16_t stage_bit(BootStage stage) {
+  return (uint16_t)(1U << stage);
+}
+
+}  // namespace
+
+void boot_timeline_reset(BootTimeline *tl) {
+  if (!tl) return;
+  for (uint8_t i = 0; i < BOOT_STAGE_COUNT; ++i) {
+    tl->begin_us[i] = 0;
+    tl->end_us[i] = 0;
+  }
+  tl->begun_mask = 0;
+  tl->ended_mask = 0;
+}
+
+void boot_timeline_begin(BootTimeline *tl, BootStage stage, uint32_t now_us) {
+  if (!tl || stage >= BOOT_STAGE_COUNT || (tl->begun_mask & stage_bit(stage))) return;
+  tl->begin_us[stage] = now_us;
+  tl->begun_mask |= stage_bit(stage);
+}
+
+void boot_timeline_end(BootTimeline *tl, BootStage stage, uint32_t now_us) {
+  if (!tl || stage >= BOOT_STAGE_COUNT || (tl->ended_mask & stage_bit(stage))) return;
+  if (!(tl->begun_mask & stage_bit(stage))) return;
+  tl->end_us[stage] = now_us;
+  tl->ended_mask |= stage_bit(stage);
+}
+
+bool boot_timeline_complete(const BootTimeline &tl, BootStage stage) {
+  return stage < BOOT_STAGE_COUNT && (tl.ended_mask & stage_bit(stage)) != 0;
+}
+
+uint32_t boot_timeline_duration_us(const BootTimeline &tl, BootStage stage) {
+  if (!boot_timeline_complete(tl, stage)) return 0;
+  return tl.end_us[stage] - tl.begin_us[stage];
+}
+
+const char *boot_stage_name(BootStage stage) {
+  switch (stage) {
+    case BOOT_STAGE_SETUP: return "setup";
+    case BOOT_STAGE_SETTINGS: return "settings";
+    case BOOT_STAGE_DISPLAY: return "display";
+    case BOOT_STAGE_NETWORK: return "network";
+    case BOOT_STAGE_IMU: return "imu";
+    case BOOT_STAGE_CALIBRATION: return "calibration";
+    case BOOT_STAGE_TOUCH: return "touch";
+    case BOOT_STAGE_FIRST_READING: return "first_reading";
+    default: return "?";
+  }
+}
+
+size_t boot_timeline_format_json(const BootTimeline &tl, char *out, size_t size) {
+  if (!out || size < 3) return 0;
+  size_t len = 0;
+  out[len++] = '[';
+  bool first = true;
+  for (uint8_t i = 0; i < BOOT_STAGE_COUNT; ++i) {
+    const BootStage stage = (BootStage)i;
+    if (!(tl.begun_mask & stage_bit(stage))) continue;
+    int n;
+    if (boot_timeline_complete(tl, stage)) {
+      n = snprintf(out + len, size - len, "%s{\"stage\":\"%s\",\"begin_us\":%lu,\"end_us\":%lu,\"us\":%lu}",
+                   first ? "" : ",", boot_stage_name(stage),
+                   (unsigned long)tl.begin_us[i], (unsigned long)tl.end_us[i],
+                   (unsigned long)boot_timeline_duration_us(tl, stage));
+    } else {
+      n = snprintf(out + len, size - len, "%s{\"stage\":\"%s\",\"begin_us\":%lu,\"end_us\":null,\"us\":null}",
+                   first ? "" : ",", boot_stage_name(stage), (unsigned long)tl.begin_us[i]);
+    }
+    if (n < 0 || (size_t)n >= size - len) {
+      out[0] = '\0';
+      return 0;
+    }
+    len += (size_t)n;
+    first = false;
+  }
+  if (len + 2 > size) {
+    out[0] = '\0';
+    return 0;
+  }
+  out[len++] = ']';
+  out[len] = '\0';
+  return len;
+}
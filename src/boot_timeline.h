@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Per-stage begin/end timestamps of one boot, in microseconds since the chip
+// started. Stages overlap: the network task and the IMU bring-up run while
+// the splash is on screen. The first begin and the first end of a stage win,
+// so a stage can be closed from whichever task gets there first.
+
+enum BootStage : uint8_t {
+  BOOT_STAGE_SETUP = 0,       // setup() as a whole
+  BOOT_STAGE_SETTINGS,        // serial, I2C, EEPROM / RTC settings, battery ADC
+  BOOT_STAGE_DISPLAY,         // panel init, splash draw, LVGL + UI build
+  BOOT_STAGE_NETWORK,         // config load, Wi-Fi / AP start, HTTP server (own task)
+  BOOT_STAGE_IMU,             // QMI8658 configuration
+  BOOT_STAGE_CALIBRATION,     // bias / zero load (or first-boot calibration), seed angles
+  BOOT_STAGE_TOUCH,           // touch controller init
+  BOOT_STAGE_FIRST_READING,   // until the first frame with a live reading is flushed
+  BOOT_STAGE_COUNT
+};
+
+struct BootTimeline {
+  uint32_t begin_us[BOOT_STAGE_COUNT];
+  uint32_t end_us[BOOT_STAGE_COUNT];
+  uint16_t begun_mask;
+  uint16_t ended_mask;
+};
+
+void boot_timeline_reset(BootTimeline *tl);
+void boot_timeline_begin(BootTimeline *tl, BootStage stage, uint32_t now_us);
+void boot_timeline_end(BootTimeline *tl, BootStage stage, uint32_t now_us);
+
+bool boot_timeline_complete(const BootTimeline &tl, BootStage stage);
+// end - begin, or 0 while the stage has not been closed.
+uint32_t boot_timeline_duration_us(const BootTimeline &tl, BootStage stage);
+
+const char *boot_stage_name(BootStage stage);
+
+// [{"stage":"setup","begin_us":12,"end_us":345,"us":333},...]; stages not
+// closed yet report "end_us":null,"us":null. Returns the length written,
+// or 0 if `size` is too small.
+size_t boot_timeline_format_json(const BootTimeline &tl, char *out, size_t size);
@@ -0,0 +1,899 @@
+// ============================================================
+// display_panel.cpp — RM67162 panel, LVGL display driver and
+// the LVGL task (render governor)
+// ============================================================
+//
+// Everything here is hardware-bound. The UI itself (widgets, state machine,
+// update_ui) lives in ui_lvgl.cpp and is driven through ui_build()/ui_refresh().
+
+#include "ui_lvgl.h"
+#include <Arduino_GFX_Library.h>
+#include "inclinometer_shared.h"
+#include "fw_version.h"
+#include "splash_codec.h"
+#include "splash_image_536x240_lz.h"
+#include <esp_sleep.h>
+#include <esp_system.h>
+#include <freertos/semphr.h>
+#include <string.h>
+#include "frame_diff.h"
+#include "display_power_policy.h"
+#include "power_manager.h"
+#include "perf_counters.h"
+#include "latency_trace.h"
+#include "serial_log.h"
+
+
+// ============================================================
+// DISPLAY CONFIG
+// ============================================================
+
+#define LCD_WIDTH   536
+#define LCD_HEIGHT  240
+
+// ============================================================
+// QSPI PINS
+// ============================================================
+
+#define LCD_CS   6
+#define LCD_RST  17
+#define LCD_CLK  47
+#define LCD_D0   18
+#define LCD_D1   7
+#define LCD_D2   48
+#define LCD_D3   5
+#define LCD_BASE_ROTATION 3
+
+// ============================================================
+// DISPLAY DRIVER
+// ============================================================
+
+Arduino_DataBus *bus = new Arduino_ESP32QSPI(
+  LCD_CS, LCD_CLK, LCD_D0, LCD_D1, LCD_D2, LCD_D3
+);
+
+Arduino_GFX *gfx = new Arduino_RM67162(
+  bus,
+  LCD_RST,
+  LCD_BASE_ROTATION,
+  false
+);
+
+// ============================================================
+// TOUCH SCREEN
+// ============================================================
+extern void touch_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data);
+
+// ============================================================
+// LVGL DRAW BUFFER
+// ============================================================
+
+static lv_disp_draw_buf_t draw_buf;
+static lv_color_t *buf1;
+static lv_color_t *buf2;
+static lv_disp_t *disp_handle = nullptr;
+
+// Optional LVGL direct mode (env:esp32s3_psram): one full frame in PSRAM plus
+// a shadow of what the panel currently shows. Each refresh is diffed against
+// the shadow and only the changed rectangles are pushed over QSPI. Falls back
+// to the partial internal buffers if the PSRAM allocation fails.
+#ifndef UI_PSRAM_DIRECT_MODE
+#define UI_PSRAM_DIRECT_MODE 0
+#endif
+
+static bool direct_mode_active = false;
+#if UI_PSRAM_DIRECT_MODE
+static const int directDiffRowGap = 4;
+static const size_t directDiffMaxRects = 8;
+static const int directPushScratchLines = 24;
+static uint16_t *direct_shadow = nullptr;
+static uint16_t *direct_push_scratch = nullptr;
+static bool direct_shadow_valid = false;
+#endif
+
+// Pixel accounting for the render stats (display task only).
+static uint32_t flush_px_invalidated = 0;
+static uint32_t flush_px_pushed = 0;
+
+// Direct mode cannot use LVGL's sw_rotate, so 180 degrees is done by the panel.
+static uint8_t panel_rotation()
+{
+  if (direct_mode_active && displayRotated) {
+    return (LCD_BASE_ROTATION + 2) % 4;
+  }
+  return LCD_BASE_ROTATION;
+}
+static bool splash_deferred_until_first_loop = false;
+static uint32_t splash_deferred_due_ms = 0;
+// The splash stays up at least this long and until the first live reading;
+// the LVGL task keeps rendering parked meanwhile instead of blocking setup.
+static const uint32_t splashMinShowMs = 700;
+static uint32_t splash_hold_until_ms = 0;
+// Without a first reading this long after sensor setup (IMU fault), the UI
+// starts anyway so touch and menus work, with an error banner on top.
+static const uint32_t splashImuTimeoutMs = 3000;
+static uint32_t splash_sensors_ready_ms = 0;
+static bool splash_imu_timed_out = false;
+static lv_obj_t *imu_error_banner = nullptr;
+static const int splashStripLines = 16;
+static const uint32_t splashDeferredDelayMs = 450;
+static const uint32_t panelDeepSleepResetLowMs = 35;
+static const uint32_t panelDeepSleepResetHighSettleMs = 220;
+static const uint32_t panelWakeSettleMs = 120;
+static const uint32_t panelColdSettleMs = 30;
+static const uint32_t panelWakeSplashPreDelayMs = 20;
+static const uint32_t panelDeepSleepBeginRetryDelayMs = 80;
+static const uint32_t panelDeepSleepBeginRetryCount = 5;
+static uint8_t last_applied_brightness_percent = 0xFF;
+
+// ============================================================
+// DISPLAY TASK / RENDER GOVERNOR
+// ============================================================
+//
+// LVGL is driven from its own task so rendering never waits behind the
+// sensor loop or the web server. Frame pacing is governed: while something
+// on screen changes (readouts, touch, animations) the task runs at the
+// configured target rate, otherwise it drops to displayIdleFps.
+
+static const uint8_t displayIdleFps = 10;
+static const uint32_t displayGovernorHoldMs = 600;
+static const uint32_t displayStatsWindowMs = 1000;
+static const uint32_t displayUiUpdatePeriodMs = 50;
+static const uint32_t displayTaskStackBytes = 8192;
+static const UBaseType_t displayTaskPriority = 1;
+static const BaseType_t displayTaskCore = 0;
+
+static SemaphoreHandle_t display_mutex = nullptr;
+static TaskHandle_t display_task_handle = nullptr;
+static void display_task(void *);
+
+static portMUX_TYPE render_stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static DisplayRenderStats render_stats = {};
+static bool render_frame_flushed = false;
+
+// ============================================================
+// LATENCY TRACE
+// ============================================================
+//
+// Each ui_refresh() reports which IMU sample it put into the widgets and the
+// next completed flush (my_disp_monitor) closes the trace; the results go to
+// the perf counters. The optional marker flips a corner square when the
+// latest sample's roll crosses 0 deg, so a photodiode on the glass can check
+// the figure against the jig from outside. It uses the unsmoothed angle: the
+// readout's EMA adds its own lag on top of the pipeline measured here.
+
+static const float latencyMarkerHysteresisDeg = 0.2f;
+static const lv_coord_t latencyMarkerSizePx = 48;
+
+static LatencyTrace ui_latency_trace = {};
+static LatencyTrace marker_latency_trace = {};
+static volatile bool latency_marker_wanted = false;
+static lv_obj_t *latency_marker = nullptr;
+static bool latency_marker_high = false;
+static uint32_t latency_marker_sample_us = 0;
+
+void displaySetLatencyMarker(bool enabled)
+{
+  latency_marker_wanted = enabled;
+  if (display_task_handle) xTaskNotifyGive(display_task_handle);
+}
+
+bool displayLatencyMarkerEnabled(void)
+{
+  return latency_marker_wanted;
+}
+
+static void set_latency_marker_level(bool high)
+{
+  latency_marker_high = high;
+  lv_obj_set_style_bg_color(latency_marker, high ? lv_color_white() : lv_color_black(), 0);
+}
+
+// LVGL task, display lock held.
+static void update_latency_marker(void)
+{
+  if (!latency_marker_wanted) {
+    if (latency_marker) {
+      lv_obj_del(latency_marker);
+      latency_marker = nullptr;
+    }
+    return;
+  }
+
+  float roll = 0.0f;
+  uint32_t sample_us = 0;
+  getUiAngles(&roll, nullptr, &sample_us);
+  if (!latency_marker) {
+    latency_marker = lv_obj_create(lv_layer_top());
+    lv_obj_remove_style_all(latency_marker);
+    lv_obj_clear_flag(latency_marker, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_size(latency_marker, latencyMarkerSizePx, latencyMarkerSizePx);
+    lv_obj_align(latency_marker, LV_ALIGN_TOP_LEFT, 0, 0);
+    lv_obj_set_style_bg_opa(latency_marker, LV_OPA_COVER, 0);
+    set_latency_marker_level(roll > 0.0f);
+    latency_trace_reset(&marker_latency_trace);
+    latency_marker_sample_us = sample_us;
+    return;
+  }
+
+  if (sample_us == 0 || sample_us == latency_marker_sample_us) return;
+  latency_marker_sample_us = sample_us;
+  const bool high = latency_marker_high ? (roll > -latencyMarkerHysteresisDeg)
+                                        : (roll > latencyMarkerHysteresisDeg);
+  if (high == latency_marker_high) return;
+  set_latency_marker_level(high);
+  latency_trace_ui(&marker_latency_trace, sample_us, micros());
+}
+
+// ============================================================
+// LVGL HEAP
+// ============================================================
+//
+// With UI_LVGL_MEM_PSRAM (lv_conf.h) the LVGL pool is requested from PSRAM in
+// lv_init(), leaving internal SRAM to Wi-Fi/lwIP and the DMA flush buffers.
+// Usage is sampled per stats window; a shrinking largest free block is the
+// early sign of a layout that fragments the heap.
+
+static const uint32_t lvMemLowLargestFreeBytes = 4096;
+static bool lv_mem_pool_in_psram = false;
+static uint32_t lv_mem_largest_free_min = UINT32_MAX;
+static bool lv_mem_low_reported = false;
+
+#if UI_LVGL_MEM_PSRAM
+extern "C" void *lvgl_mem_pool_alloc(size_t size)
+{
+  void *pool = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  lv_mem_pool_in_psram = (pool != nullptr);
+  if (!pool) {
+    SerialLog.println("LVGL heap: PSRAM pool unavailable, using internal RAM");
+    pool = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  return pool;
+}
+#endif
+
+// Caller holds the display lock.
+static void sample_lv_mem(DisplayRenderStats *s)
+{
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  if (mon.free_biggest_size < lv_mem_largest_free_min) {
+    lv_mem_largest_free_min = mon.free_biggest_size;
+  }
+  if (!lv_mem_low_reported && mon.free_biggest_size < lvMemLowLargestFreeBytes) {
+    lv_mem_low_reported = true;
+    SerialLog.printf("LVGL heap: largest free block %lu B (%u%% fragmented, %lu B free)\n",
+                  (unsigned long)mon.free_biggest_size, (unsigned)mon.frag_pct,
+                  (unsigned long)mon.free_size);
+  }
+  s->lv_mem_total = mon.total_size;
+  s->lv_mem_free = mon.free_size;
+  s->lv_mem_used = mon.total_size - mon.free_size;
+  s->lv_mem_largest_free = mon.free_biggest_size;
+  s->lv_mem_largest_free_min = lv_mem_largest_free_min;
+  s->lv_mem_max_used = mon.max_used;
+  s->lv_mem_frag_pct = mon.frag_pct;
+  s->lv_mem_psram = lv_mem_pool_in_psram;
+  ui_lazy_heap_stats(&s->ui_align_heap, &s->ui_trend_heap);
+  s->internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  s->internal_largest_free = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+}
+
+// ============================================================
+// IDLE POWER POLICY
+// ============================================================
+//
+// Activity arrives from any task through displayNoteActivity(). The display
+// task advances the policy once per pass and applies it: brightness through
+// apply_display_brightness(), a capped refresh rate while dimmed, and the
+// panel switched off while blank (UI updates stop, touch is still polled).
+
+static const uint8_t displayDimBrightnessPercent = 15;
+static const uint8_t displayDimFps = 10;
+static const uint8_t displayDimIdleFps = 5;
+static const uint8_t displayBlankPollFps = 4;
+
+static portMUX_TYPE power_mux = portMUX_INITIALIZER_UNLOCKED;
+static DisplayPowerPolicy power_policy = {};
+static DisplayPowerState power_state = DISPLAY_POWER_ACTIVE;  // display task copy
+static bool panel_blanked = false;
+
+static DisplayPowerConfig display_power_config()
+{
+  DisplayPowerConfig cfg;
+  cfg.dim_after_ms = (uint32_t)getDisplayDimTimeoutSec() * 1000U;
+  cfg.blank_after_ms = (uint32_t)getDisplayBlankTimeoutSec() * 1000U;
+  cfg.dim_brightness_percent = displayDimBrightnessPercent;
+  return cfg;
+}
+
+bool displayNoteActivity(void)
+{
+  portENTER_CRITICAL(&power_mux);
+  const uint32_t now = millis();
+  const bool was_blank = (power_policy.state == DISPLAY_POWER_BLANK);
+  const bool woke = display_power_note_activity(&power_policy, now);
+  portEXIT_CRITICAL(&power_mux);
+  if (woke && display_task_handle) {
+    // Cut the governor's sleep short so the panel comes back immediately.
+    xTaskNotifyGive(display_task_handle);
+  }
+  return was_blank;
+}
+
+uint32_t displayIdleMs(void)
+{
+  portENTER_CRITICAL(&power_mux);
+  const uint32_t now = millis();
+  const uint32_t last = power_policy.last_activity_ms;
+  portEXIT_CRITICAL(&power_mux);
+  return now - last;
+}
+
+bool display_lock(uint32_t timeout_ms)
+{
+  if (!display_mutex) return true;
+  const TickType_t ticks =
+    (timeout_ms == DISPLAY_LOCK_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+  return xSemaphoreTakeRecursive(display_mutex, ticks) == pdTRUE;
+}
+
+void display_unlock(void)
+{
+  if (!display_mutex) return;
+  xSemaphoreGiveRecursive(display_mutex);
+}
+
+void getDisplayRenderStats(DisplayRenderStats *out_stats)
+{
+  if (!out_stats) return;
+  portENTER_CRITICAL(&render_stats_mux);
+  *out_stats = render_stats;
+  portEXIT_CRITICAL(&render_stats_mux);
+}
+
+static void apply_display_brightness()
+{
+  const uint8_t percent = display_power_brightness(
+    power_state, display_power_config(), getDisplayBrightnessPercent());
+  if (percent == last_applied_brightness_percent) return;
+  if (percent == 0) {
+    gfx->displayOff();
+    panel_blanked = true;
+    last_applied_brightness_percent = percent;
+    return;
+  }
+  if (panel_blanked) {
+    gfx->displayOn();
+    panel_blanked = false;
+  }
+  const uint8_t panel_value = (uint8_t)((percent * 255U + 50U) / 100U);
+  bus->beginWrite();
+  bus->writeC8D8(0x51, panel_value);
+  bus->endWrite();
+  last_applied_brightness_percent = percent;
+}
+
+// Decode the compressed splash straight to the panel in strips; only one
+// strip and the decoder window are ever held in RAM.
+static void draw_splash_streamed()
+{
+  SplashDecoder *dec = (SplashDecoder *)heap_caps_malloc(
+    sizeof(SplashDecoder), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  uint16_t *strip = (uint16_t *)heap_caps_malloc(
+    LCD_WIDTH * splashStripLines * sizeof(uint16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+  if (!dec || !strip) {
+    heap_caps_free(dec);
+    heap_caps_free(strip);
+    gfx->fillScreen(0x0000);
+    return;
+  }
+
+  splash_decoder_init(dec, SPLASH_IMAGE_536x240_LZ, sizeof(SPLASH_IMAGE_536x240_LZ));
+  for (int y = 0; y < LCD_HEIGHT; y += splashStripLines) {
+    const int lines = (LCD_HEIGHT - y < splashStripLines) ? (LCD_HEIGHT - y) : splashStripLines;
+    const size_t want = (size_t)LCD_WIDTH * lines;
+    if (splash_decoder_read(dec, strip, want) != want) {
+      // Corrupt stream: leave the rest of the panel black.
+      gfx->fillRect(0, y, LCD_WIDTH, LCD_HEIGHT - y, 0x0000);
+      break;
+    }
+    gfx->draw16bitRGBBitmap(0, y, strip, LCD_WIDTH, lines);
+  }
+
+  heap_caps_free(dec);
+  heap_caps_free(strip);
+}
+
+static void show_startup_splash()
+{
+  const uint32_t start_ms = millis();
+  apply_display_brightness();
+  const uint8_t splash_rotation =
+    displayRotated ? ((LCD_BASE_ROTATION + 2) % 4) : LCD_BASE_ROTATION;
+  gfx->setRotation(splash_rotation);
+  draw_splash_streamed();
+
+  const int text_size = 2;
+  const int char_w = 6 * text_size;
+  const int char_h = 8 * text_size;
+  const int margin_r = 12;
+  const int margin_b = 10;
+  const int text_w = (int)strlen(FW_VERSION) * char_w;
+  const int text_h = char_h;
+  const int text_x = LCD_WIDTH - margin_r - text_w;
+  const int text_y = LCD_HEIGHT - margin_b - text_h;
+
+  gfx->fillRect(text_x - 6, text_y - 4, text_w + 12, text_h + 8, 0x0000);
+  gfx->setTextSize(text_size);
+  gfx->setTextColor(0xFFFF);
+  gfx->setCursor(text_x, text_y);
+  gfx->print(FW_VERSION);
+  gfx->setRotation(panel_rotation());
+
+  // Decode/draw time counts toward the visible splash duration.
+  splash_hold_until_ms = start_ms + splashMinShowMs;
+}
+
+// ============================================================
+// LVGL FLUSH CALLBACK
+// ============================================================
+
+void my_disp_flush(lv_disp_drv_t *disp_drv,
+                   const lv_area_t *area,
+                   lv_color_t *color_p)
+{
+  PERF_SCOPE(PERF_STAGE_FLUSH);
+  gfx->draw16bitRGBBitmap(
+    area->x1,
+    area->y1,
+    (uint16_t *)color_p,
+    area->x2 - area->x1 + 1,
+    area->y2 - area->y1 + 1
+  );
+  lv_disp_flush_ready(disp_drv);
+}
+
+#if UI_PSRAM_DIRECT_MODE
+static void push_rect_direct(const uint16_t *frame, const FrameRect &r)
+{
+  const int w = r.x2 - r.x1 + 1;
+  const int chunk_lines = (LCD_WIDTH * directPushScratchLines) / w;
+  for (int y = r.y1; y <= r.y2; y += chunk_lines) {
+    const int lines = (r.y2 - y + 1 < chunk_lines) ? (r.y2 - y + 1) : chunk_lines;
+    for (int i = 0; i < lines; i++) {
+      memcpy(direct_push_scratch + i * w,
+             frame + (y + i) * LCD_WIDTH + r.x1,
+             w * sizeof(uint16_t));
+    }
+    gfx->draw16bitRGBBitmap(r.x1, y, direct_push_scratch, w, lines);
+  }
+  frame_diff_commit(frame, direct_shadow, LCD_WIDTH, r);
+  flush_px_pushed += frame_rect_area(r);
+}
+
+void my_disp_flush_direct(lv_disp_drv_t *disp_drv,
+                          const lv_area_t *,
+                          lv_color_t *color_p)
+{
+  // Direct mode hands over the whole frame after every invalid area; push
+  // once LVGL has rendered the last one.
+  if (lv_disp_flush_is_last(disp_drv)) {
+    PERF_SCOPE(PERF_STAGE_FLUSH);
+    const uint16_t *frame = (const uint16_t *)color_p;
+    if (!direct_shadow_valid) {
+      // Panel content unknown (boot, splash, rotation): send everything.
+      const FrameRect full = {0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1};
+      push_rect_direct(frame, full);
+      direct_shadow_valid = true;
+    } else {
+      for (uint16_t i = 0; i < disp_handle->inv_p; i++) {
+        if (disp_handle->inv_area_joined[i]) continue;
+        const lv_area_t &a = disp_handle->inv_areas[i];
+        const FrameRect region = {a.x1, a.y1, a.x2, a.y2};
+        FrameRect rects[directDiffMaxRects];
+        const size_t n = frame_diff_rects(
+          frame, direct_shadow, LCD_WIDTH, LCD_HEIGHT,
+          region, directDiffRowGap, rects, directDiffMaxRects);
+        for (size_t k = 0; k < n; k++) {
+          push_rect_direct(frame, rects[k]);
+        }
+      }
+    }
+  }
+  lv_disp_flush_ready(disp_drv);
+}
+
+static bool setup_direct_mode_buffers()
+{
+  const size_t frame_bytes = LCD_WIDTH * LCD_HEIGHT * sizeof(lv_color_t);
+  buf1 = (lv_color_t *)heap_caps_malloc(frame_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  direct_shadow = (uint16_t *)heap_caps_malloc(frame_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  direct_push_scratch = (uint16_t *)heap_caps_malloc(
+    LCD_WIDTH * directPushScratchLines * sizeof(uint16_t),
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+  if (buf1 && direct_shadow && direct_push_scratch) {
+    memset(buf1, 0, frame_bytes);
+    direct_shadow_valid = false;
+    return true;
+  }
+  heap_caps_free(buf1);
+  heap_caps_free(direct_shadow);
+  heap_caps_free(direct_push_scratch);
+  buf1 = nullptr;
+  direct_shadow = nullptr;
+  direct_push_scratch = nullptr;
+  return false;
+}
+#endif
+
+// Called by LVGL once per completed refresh; the task times the whole
+// lv_timer_handler() pass that contained it.
+static void my_disp_monitor(lv_disp_drv_t *, uint32_t, uint32_t px)
+{
+  render_frame_flushed = true;
+  flush_px_invalidated += px;
+  const uint32_t done_us = micros();
+  uint32_t to_ui_us = 0;
+  uint32_t to_px_us = 0;
+  if (latency_trace_flush(&ui_latency_trace, done_us, &to_ui_us, &to_px_us)) {
+    PERF_RECORD(PERF_STAGE_SAMPLE_TO_UI, to_ui_us);
+    PERF_RECORD(PERF_STAGE_SAMPLE_TO_PIXEL, to_px_us);
+  }
+  if (latency_trace_flush(&marker_latency_trace, done_us, nullptr, &to_px_us)) {
+    PERF_RECORD(PERF_STAGE_MARKER_TO_PIXEL, to_px_us);
+  }
+  if (!direct_mode_active) {
+    flush_px_pushed += px;
+  }
+}
+
+// ============================================================
+// DISPLAY SETUP / LOOP
+// ============================================================
+
+void setup_display()
+{
+  bootStageBegin(BOOT_STAGE_DISPLAY);
+  display_mutex = xSemaphoreCreateRecursiveMutex();
+  display_power_init(&power_policy, millis());
+
+  const esp_reset_reason_t reset_reason = esp_reset_reason();
+  const bool woke_from_deep_sleep = (reset_reason == ESP_RST_DEEPSLEEP);
+  if (woke_from_deep_sleep) {
+    // Deep-sleep wake can leave panel rails/logic in a slow-recovering state.
+    // Hard-reset the panel before begin() to make splash rendering deterministic.
+    pinMode(LCD_RST, OUTPUT);
+    digitalWrite(LCD_RST, LOW);
+    delay(panelDeepSleepResetLowMs);
+    digitalWrite(LCD_RST, HIGH);
+    delay(panelDeepSleepResetHighSettleMs);
+  }
+
+  bool ok = false;
+  for (uint32_t i = 0; i < panelDeepSleepBeginRetryCount && !ok; i++) {
+    ok = gfx->begin();
+    if (!ok) {
+      delay(panelDeepSleepBeginRetryDelayMs);
+    }
+  }
+  if (ok) {
+    gfx->displayOn();
+    last_applied_brightness_percent = 0xFF;
+    apply_display_brightness();
+    delay(woke_from_deep_sleep ? panelWakeSettleMs : panelColdSettleMs);
+    // Clear once so first splash frame is not dropped on sleepy panel state.
+    gfx->fillScreen(0x0000);
+    delay(10);
+    if (woke_from_deep_sleep && fastResumeActive()) {
+      // State came back from RTC memory: go straight to the live reading.
+    } else if (woke_from_deep_sleep) {
+      // Defer wake splash until loop phase, after panel and LVGL are fully settled.
+      splash_deferred_until_first_loop = true;
+      splash_deferred_due_ms = millis() + splashDeferredDelayMs;
+    } else {
+      show_startup_splash();
+    }
+  }
+  lv_init();
+
+#if UI_PSRAM_DIRECT_MODE
+  direct_mode_active = setup_direct_mode_buffers();
+#endif
+
+  static lv_disp_drv_t disp_drv;
+  lv_disp_drv_init(&disp_drv);
+  disp_drv.hor_res = LCD_WIDTH;
+  disp_drv.ver_res = LCD_HEIGHT;
+  disp_drv.monitor_cb = my_disp_monitor;
+  disp_drv.draw_buf = &draw_buf;
+
+  if (direct_mode_active) {
+#if UI_PSRAM_DIRECT_MODE
+    lv_disp_draw_buf_init(&draw_buf, buf1, nullptr, LCD_WIDTH * LCD_HEIGHT);
+    disp_drv.flush_cb = my_disp_flush_direct;
+    disp_drv.direct_mode = 1;
+    disp_handle = lv_disp_drv_register(&disp_drv);
+    gfx->setRotation(panel_rotation());
+#endif
+  } else {
+    buf1 = (lv_color_t *)heap_caps_malloc(
+      LCD_WIDTH * 60 * sizeof(lv_color_t),
+      MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+
+    buf2 = (lv_color_t *)heap_caps_malloc(
+      LCD_WIDTH * 60 * sizeof(lv_color_t),
+      MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+
+    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, LCD_WIDTH * 60);
+    disp_drv.flush_cb = my_disp_flush;
+    disp_drv.sw_rotate = 1;
+    disp_handle = lv_disp_drv_register(&disp_drv);
+    lv_disp_set_rotation(
+      disp_handle,
+      displayRotated ? LV_DISP_ROT_180 : LV_DISP_ROT_NONE
+    );
+  }
+
+  // ==========================================================
+  // TOUCH INPUT DEVICE (LVGL)
+  // ==========================================================
+  static lv_indev_drv_t indev_drv;
+  lv_indev_drv_init(&indev_drv);
+  indev_drv.type = LV_INDEV_TYPE_POINTER;
+  indev_drv.read_cb = touch_read_cb;
+  lv_indev_drv_register(&indev_drv);
+
+  ui_build();
+
+  xTaskCreatePinnedToCore(
+    display_task,
+    "lvgl",
+    displayTaskStackBytes,
+    nullptr,
+    displayTaskPriority,
+    &display_task_handle,
+    displayTaskCore
+  );
+  bootStageEnd(BOOT_STAGE_DISPLAY);
+}
+
+void displayPrepareForDeepSleep(void)
+{
+  if (!gfx) return;
+  // Keep the lock: the LVGL task stays parked until the chip sleeps.
+  display_lock(DISPLAY_LOCK_WAIT_FOREVER);
+  // Push black once before panel sleep for a clean visual transition.
+  gfx->fillScreen(0x0000);
+  delay(20);
+  gfx->displayOff();
+}
+
+static bool splash_release_due(uint32_t now)
+{
+  if (splash_deferred_until_first_loop || (int32_t)(now - splash_hold_until_ms) < 0) return false;
+  if (uiAnglesLive()) return true;
+  if (!uiSensorsReady()) return false;
+  if (splash_imu_timed_out) return true;
+  if (splash_sensors_ready_ms == 0) splash_sensors_ready_ms = now ? now : 1;
+  if ((now - splash_sensors_ready_ms) < splashImuTimeoutMs) return false;
+  splash_imu_timed_out = true;
+  SerialLogError.println("Display: no IMU reading, starting the UI without live angles");
+  return true;
+}
+
+// LVGL task, display lock held. Shown while the UI runs without a reading.
+static void update_imu_error_banner(void)
+{
+  if (uiAnglesLive()) {
+    if (imu_error_banner) {
+      lv_obj_del(imu_error_banner);
+      imu_error_banner = nullptr;
+    }
+    return;
+  }
+  if (imu_error_banner) return;
+  imu_error_banner = lv_label_create(lv_layer_top());
+  lv_label_set_text(imu_error_banner, "IMU ERROR - no reading");
+  lv_obj_set_style_bg_color(imu_error_banner, lv_palette_main(LV_PALETTE_RED), 0);
+  lv_obj_set_style_bg_opa(imu_error_banner, LV_OPA_COVER, 0);
+  lv_obj_set_style_text_color(imu_error_banner, lv_color_white(), 0);
+  lv_obj_set_style_pad_all(imu_error_banner, 6, 0);
+  lv_obj_clear_flag(imu_error_banner, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_align(imu_error_banner, LV_ALIGN_TOP_MID, 0, 8);
+}
+
+// One governor pass: panel housekeeping, UI inputs, LVGL timers.
+// Returns true when this pass produced (or still has pending) screen changes.
+static bool display_service(uint32_t *out_render_us, bool *out_rendered)
+{
+  static uint32_t last_tick = 0;
+  static uint32_t last_ui   = 0;
+  static int last_rotation = -1;
+  static bool panel_wake_ensured = false;
+  static bool first_frame_logged = false;
+
+  uint32_t now = millis();
+  int desired_rotation = displayRotated ? 1 : 0;
+  apply_display_brightness();
+
+  if (!panel_wake_ensured && gfx) {
+    gfx->displayOn();
+    panel_wake_ensured = true;
+  }
+
+  bool changed = false;
+  if (splash_deferred_until_first_loop && gfx && (int32_t)(now - splash_deferred_due_ms) >= 0) {
+    gfx->displayOn();
+    delay(panelWakeSplashPreDelayMs);
+    show_startup_splash();
+    splash_deferred_until_first_loop = false;
+    const uint32_t t = millis();
+    last_tick = t;
+    last_ui = t;
+#if UI_PSRAM_DIRECT_MODE
+    direct_shadow_valid = false;
+#endif
+    lv_obj_invalidate(lv_scr_act());
+    changed = true;
+  }
+
+  if (last_rotation != desired_rotation) {
+    if (direct_mode_active) {
+#if UI_PSRAM_DIRECT_MODE
+      gfx->setRotation(panel_rotation());
+      direct_shadow_valid = false;
+      lv_obj_invalidate(lv_scr_act());
+#endif
+    } else if (disp_handle) {
+      lv_disp_set_rotation(
+        disp_handle,
+        displayRotated ? LV_DISP_ROT_180 : LV_DISP_ROT_NONE
+      );
+    }
+    last_rotation = desired_rotation;
+    changed = true;
+  }
+
+  if (last_tick == 0) {
+    last_tick = now;
+  }
+  uint32_t tick_elapsed = now - last_tick;
+  if (tick_elapsed > 0) {
+    lv_tick_inc(tick_elapsed);
+    last_tick = now;
+  }
+
+  // Boot: keep the splash (or the black panel after a fast resume) until
+  // the sensor loop has a reading, or until splashImuTimeoutMs after sensor
+  // setup if it never gets one; touch reads stay off the bus until the
+  // controller is initialised.
+  if (!splash_release_due(now)) {
+    *out_render_us = 0;
+    *out_rendered = false;
+    return true;
+  }
+
+  update_imu_error_banner();
+  update_latency_marker();
+  if (now - last_ui >= displayUiUpdatePeriodMs && power_state != DISPLAY_POWER_BLANK) {
+    ui_refresh();
+    latency_trace_ui(&ui_latency_trace, ui_displayed_sample_us(), micros());
+    last_ui = now;
+  }
+
+  if (disp_handle && disp_handle->inv_p > 0) changed = true;
+  if (lv_anim_count_running() > 0) changed = true;
+  if (disp_handle && lv_disp_get_inactive_time(disp_handle) < displayGovernorHoldMs) changed = true;
+
+  render_frame_flushed = false;
+  const uint32_t t0 = micros();
+  lv_timer_handler();
+  *out_render_us = micros() - t0;
+  *out_rendered = render_frame_flushed;
+  PERF_RECORD(PERF_STAGE_LVGL, *out_render_us);
+  if (render_frame_flushed) PERF_COUNT(PERF_EVENT_FRAME_RENDERED);
+  if (render_frame_flushed && !first_frame_logged && uiAnglesLive()) {
+    first_frame_logged = true;
+    bootStageEnd(BOOT_STAGE_FIRST_READING);
+    SerialLog.print("Boot: first reading on screen ");
+    SerialLog.print((unsigned long)now);
+    SerialLog.println(" ms after reset");
+  }
+  return changed;
+}
+
+static void display_task(void *)
+{
+  PERF_REGISTER_TASK("lvgl");
+  uint8_t applied_target_fps = 0;
+  uint32_t last_change_ms = millis();
+  uint32_t window_start_ms = millis();
+  uint32_t window_frames = 0;
+  uint64_t window_render_us = 0;
+  uint32_t window_max_us = 0;
+  uint32_t frames_total = 0;
+
+  for (;;) {
+    const uint32_t pass_start_ms = millis();
+    const DisplayPowerConfig power_cfg = display_power_config();
+    uint32_t power_state_s[DISPLAY_POWER_STATE_COUNT];
+    portENTER_CRITICAL(&power_mux);
+    const bool power_changed = display_power_update(&power_policy, power_cfg, millis());
+    power_state = power_policy.state;
+    for (int i = 0; i < DISPLAY_POWER_STATE_COUNT; i++) {
+      power_state_s[i] = (uint32_t)(power_policy.time_in_state_ms[i] / 1000U);
+    }
+    portEXIT_CRITICAL(&power_mux);
+
+    uint8_t target_fps = getDisplayTargetFps();
+    uint8_t idle_fps = displayIdleFps;
+    if (power_state == DISPLAY_POWER_DIM) {
+      if (target_fps > displayDimFps) target_fps = displayDimFps;
+      idle_fps = displayDimIdleFps;
+    } else if (power_state == DISPLAY_POWER_BLANK) {
+      target_fps = displayBlankPollFps;
+      idle_fps = displayBlankPollFps;
+    }
+
+    uint32_t render_us = 0;
+    bool rendered = false;
+    power_lock_acquire(POWER_LOCK_UI);
+    display_lock(DISPLAY_LOCK_WAIT_FOREVER);
+    if (target_fps != applied_target_fps && disp_handle) {
+      // Let the refresh timer keep up with the active rate.
+      lv_timer_set_period(_lv_disp_get_refr_timer(disp_handle), 1000U / target_fps);
+      applied_target_fps = target_fps;
+    }
+    const bool changed = display_service(&render_us, &rendered);
+    display_unlock();
+    power_lock_release(POWER_LOCK_UI);
+
+    const uint32_t now = millis();
+    if (changed || power_changed) last_change_ms = now;
+    const bool active = (now - last_change_ms) < displayGovernorHoldMs;
+
+    if (rendered) {
+      window_frames++;
+      frames_total++;
+      window_render_us += render_us;
+      if (render_us > window_max_us) window_max_us = render_us;
+    }
+
+    const uint32_t window_ms = now - window_start_ms;
+    if (window_ms >= displayStatsWindowMs) {
+      DisplayRenderStats s = {};
+      s.fps = (float)window_frames * 1000.0f / (float)window_ms;
+      s.frame_ms_avg = window_frames ? (float)window_render_us / (float)window_frames / 1000.0f : 0.0f;
+      s.frame_ms_max = (float)window_max_us / 1000.0f;
+      s.frames_total = frames_total;
+      s.target_fps = target_fps;
+      s.idle_fps = idle_fps;
+      s.active = active;
+      s.direct_mode = direct_mode_active;
+      s.px_invalidated = flush_px_invalidated;
+      s.px_pushed = flush_px_pushed;
+      s.power_state = power_state;
+      memcpy(s.power_state_s, power_state_s, sizeof(s.power_state_s));
+      s.brightness_percent = (last_applied_brightness_percent == 0xFF) ? 0 : last_applied_brightness_percent;
+      display_lock(DISPLAY_LOCK_WAIT_FOREVER);
+      sample_lv_mem(&s);
+      display_unlock();
+      portENTER_CRITICAL(&render_stats_mux);
+      render_stats = s;
+      portEXIT_CRITICAL(&render_stats_mux);
+      window_start_ms = now;
+      window_frames = 0;
+      window_render_us = 0;
+      window_max_us = 0;
+      flush_px_invalidated = 0;
+      flush_px_pushed = 0;
+    }
+
+    const uint32_t period_ms = 1000U / (active ? target_fps : idle_fps);
+    const uint32_t spent_ms = now - pass_start_ms;
+    const uint32_t sleep_ms = (spent_ms < period_ms) ? (period_ms - spent_ms) : 1;
+    // displayNoteActivity() notifies the task to wake a dimmed/blank panel early.
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleep_ms) > 0 ? pdMS_TO_TICKS(sleep_ms) : 1);
+  }
+}
@@ -0,0 +1,77 @@
+#include "display_power_policy.h"
+
+#include <string.h>
+
+namespace {
+
+// now - since, or 0 when `now` is behind `since` (wrap-safe).
+uint32_t elapsed_ms(uint32_t now_ms, uint32_t since_ms) {
+  const int32_t d = (int32_t)(now_ms - since_ms);
+  return d > 0 ? (uint32_t)d : 0;
+}
+
+void account_time(DisplayPowerPolicy *policy, uint32_t now_ms) {
+  const uint32_t d = elapsed_ms(now_ms, policy->last_update_ms);
+  policy->time_in_state_ms[policy->state] += d;
+  policy->last_update_ms += d;
+}
+
+void enter_state(DisplayPowerPolicy *policy, DisplayPowerState state) {
+  if (policy->state == state) return;
+  policy->state = state;
+  policy->transitions++;
+}
+
+DisplayPowerState target_state(const DisplayPowerConfig &config, uint32_t idle_ms) {
+  if (config.blank_after_ms > 0 && idle_ms >= config.blank_after_ms) return DISPLAY_POWER_BLANK;
+  if (config.dim_after_ms > 0 && idle_ms >= config.dim_after_ms) return DISPLAY_POWER_DIM;
+  return DISPLAY_POWER_ACTIVE;
+}
+
+}  // namespace
+
+void display_power_init(DisplayPowerPolicy *policy, uint32_t now_ms) {
+  if (!policy) return;
+  memset(policy, 0, sizeof(*policy));
+  policy->state = DISPLAY_POWER_ACTIVE;
+  policy->last_activity_ms = now_ms;
+  policy->last_update_ms = now_ms;
+}
+
+bool display_power_note_activity(DisplayPowerPolicy *policy, uint32_t now_ms) {
+  if (!policy) return false;
+  account_time(policy, now_ms);
+  if (elapsed_ms(now_ms, policy->last_activity_ms) > 0) policy->last_activity_ms = now_ms;
+  const bool woke = policy->state != DISPLAY_POWER_ACTIVE;
+  enter_state(policy, DISPLAY_POWER_ACTIVE);
+  return woke;
+}
+
+bool display_power_update(DisplayPowerPolicy *policy, const DisplayPowerConfig &config, uint32_t now_ms) {
+  if (!policy) return false;
+  account_time(policy, now_ms);
+  const DisplayPowerState prev = policy->state;
+  enter_state(policy, target_state(config, elapsed_ms(now_ms, policy->last_activity_ms)));
+  return policy->state != prev;
+}
+
+uint8_t display_power_brightness(DisplayPowerState state,
+                                 const DisplayPowerConfig &config,
+                                 uint8_t user_percent) {
+  switch (state) {
+    case DISPLAY_POWER_BLANK:
+      return 0;
+    case DISPLAY_POWER_DIM:
+      return (user_percent < config.dim_brightness_percent) ? user_percent : config.dim_brightness_percent;
+    default:
+      return user_percent;
+  }
+}
+
+const char *display_power_state_name(DisplayPowerState state) {
+  switch (state) {
+    case DISPLAY_POWER_DIM: return "DIM";
+    case DISPLAY_POWER_BLANK: return "BLANK";
+    default: return "ACTIVE";
+  }
+}
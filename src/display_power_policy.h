@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+
+// Idle power policy for the AMOLED panel.
+//
+// Any user-facing activity (motion, touch, button, web action) resets the
+// idle timer. After `dim_after_ms` without activity the panel is dimmed and
+// the refresh rate capped; after `blank_after_ms` it is switched off. The
+// next activity returns straight to ACTIVE. A timeout of 0 disables that step.
+// A `now_ms` that is slightly older than the last recorded time (read before
+// another task updated the policy) counts as zero elapsed.
+
+enum DisplayPowerState : uint8_t {
+  DISPLAY_POWER_ACTIVE = 0,
+  DISPLAY_POWER_DIM = 1,
+  DISPLAY_POWER_BLANK = 2,
+  DISPLAY_POWER_STATE_COUNT = 3
+};
+
+struct DisplayPowerConfig {
+  uint32_t dim_after_ms;
+  uint32_t blank_after_ms;
+  uint8_t dim_brightness_percent;  // ceiling while dimmed
+};
+
+struct DisplayPowerPolicy {
+  DisplayPowerState state;
+  uint32_t last_activity_ms;
+  uint32_t last_update_ms;
+  uint64_t time_in_state_ms[DISPLAY_POWER_STATE_COUNT];
+  uint32_t transitions;
+};
+
+void display_power_init(DisplayPowerPolicy *policy, uint32_t now_ms);
+
+// Record activity at `now_ms`. Returns true if this woke the panel
+// (state left DIM/BLANK).
+bool display_power_note_activity(DisplayPowerPolicy *policy, uint32_t now_ms);
+
+// Advance the state machine and the per-state time counters.
+// Returns true if the state changed.
+bool display_power_update(DisplayPowerPolicy *policy, const DisplayPowerConfig &config, uint32_t now_ms);
+
+// Brightness to drive for `user_percent` in `state` (0 = panel off).
+uint8_t display_power_brightness(DisplayPowerState state,
+                                 const DisplayPowerConfig &config,
+                                 uint8_t user_percent);
+
+const char *display_power_state_name(DisplayPowerState state);
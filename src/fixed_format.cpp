@@ -0,0 +1,159 @@
+#include "fixed_format.h"
+
+#include <string.h>
+
+namespace {
+
+const uint32_t kPow10[FIXED_FORMAT_MAX_DECIMALS + 1] = {
+  1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+// Digits of v, most significant first, into out (no NUL). Returns the count.
+size_t u64_digits(char *out, uint64_t v) {
+  char tmp[20];
+  size_t n = 0;
+  if (v <= 0xFFFFFFFFULL) {
+    uint32_t w = (uint32_t)v;
+    do {
+      tmp[n++] = (char)('0' + w % 10U);
+      w /= 10U;
+    } while (w);
+  } else {
+    do {
+      tmp[n++] = (char)('0' + (unsigned)(v % 10U));
+      v /= 10U;
+    } while (v);
+  }
+  for (size_t i = 0; i < n; ++i) out[i] = tmp[n - 1 - i];
+  return n;
+}
+
+// Exact digits of m * 2^e for large exponents (value >= 2^64), via base-1e9
+// limbs. Only reached for |value| >= 1.8e19.
+size_t big_digits(char *out, uint32_t m, int e) {
+  uint32_t limbs[5] = {m % 1000000000U, m / 1000000000U, 0, 0, 0};
+  size_t count = 2;
+  for (int i = 0; i < e; ++i) {
+    uint32_t carry = 0;
+    for (size_t j = 0; j < count; ++j) {
+      const uint32_t x = limbs[j] * 2U + carry;
+      carry = (x >= 1000000000UL) ? 1U : 0U;
+      limbs[j] = carry ? x - 1000000000UL : x;
+    }
+    if (carry) limbs[count++] = carry;
+  }
+  while (count > 1 && limbs[count - 1] == 0) --count;
+
+  size_t n = u64_digits(out, limbs[count - 1]);
+  for (size_t j = count - 1; j-- > 0;) {
+    uint32_t w = limbs[j];
+    for (int k = 8; k >= 0; --k) {
+      out[n + (size_t)k] = (char)('0' + w % 10U);
+      w /= 10U;
+    }
+    n += 9;
+  }
+  return n;
+}
+
+}  // namespace
+
+size_t fixed_format(char *out, size_t out_size, float value, uint8_t decimals, uint8_t flags) {
+  if (!out || out_size == 0) return 0;
+  if (decimals > FIXED_FORMAT_MAX_DECIMALS) decimals = FIXED_FORMAT_MAX_DECIMALS;
+
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const bool negative = (bits >> 31) != 0;
+  const uint32_t exp_bits = (bits >> 23) & 0xFFU;
+  const uint32_t frac_bits = bits & 0x7FFFFFU;
+
+  char text[FIXED_FORMAT_MAX_LEN];
+  size_t n = 0;
+  if (negative) {
+    text[n++] = '-';
+  } else if (flags & FIXED_FORMAT_SPACE_SIGN) {
+    text[n++] = ' ';
+  }
+
+  if (exp_bits == 0xFFU) {
+    if (frac_bits) {
+      n = 0;  // printf's sign handling for NaN is libc-specific; keep it plain
+      if (flags & FIXED_FORMAT_SPACE_SIGN) text[n++] = ' ';
+      memcpy(text + n, "nan", 3);
+    } else {
+      memcpy(text + n, "inf", 3);
+    }
+    n += 3;
+  } else {
+    // value = m * 2^e exactly.
+    const uint32_t m = exp_bits ? (frac_bits | 0x800000U) : frac_bits;
+    const int e = exp_bits ? (int)exp_bits - 150 : -149;
+
+    uint64_t int_part = 0;
+    uint32_t frac_part = 0;
+    bool big = false;
+    if (e >= 0) {
+      // Integer: no fractional digits to round.
+      if (e <= 40) {
+        int_part = (uint64_t)m << e;
+      } else {
+        big = true;
+      }
+    } else {
+      // Scale by 10^decimals (< 2^54) and round half-even on the exact
+      // binary remainder, as printf does.
+      const uint64_t scaled = (uint64_t)m * kPow10[decimals];
+      const int k = -e;
+      uint64_t q = 0;
+      if (k <= 54) {
+        q = scaled >> k;
+        const uint64_t rem = scaled & ((1ULL << k) - 1ULL);
+        const uint64_t half = 1ULL << (k - 1);
+        if (rem > half || (rem == half && (q & 1ULL))) ++q;
+      }
+      if (q <= 0xFFFFFFFFULL) {
+        const uint32_t q32 = (uint32_t)q;
+        int_part = q32 / kPow10[decimals];
+        frac_part = q32 % kPow10[decimals];
+      } else {
+        int_part = q / kPow10[decimals];
+        frac_part = (uint32_t)(q % kPow10[decimals]);
+      }
+    }
+
+    n += big ? big_digits(text + n, m, e) : u64_digits(text + n, int_part);
+    if (decimals) {
+      text[n++] = '.';
+      for (int i = (int)decimals - 1; i >= 0; --i) {
+        text[n + (size_t)i] = (char)('0' + frac_part % 10U);
+        frac_part /= 10U;
+      }
+      n += decimals;
+    }
+  }
+
+  if (n + 1 > out_size) {
+    out[0] = '\0';
+    return 0;
+  }
+  memcpy(out, text, n);
+  out[n] = '\0';
+  return n;
+}
+
+void fixed_format_scratch_init(FixedFormatScratch *scratch, char *buf, size_t size) {
+  if (!scratch) return;
+  scratch->buf = buf;
+  scratch->size = buf ? size : 0;
+  scratch->used = 0;
+}
+
+const char *fixed_format_next(FixedFormatScratch *scratch, float value, uint8_t decimals) {
+  if (!scratch || scratch->used >= scratch->size) return "0";
+  char *dst = scratch->buf + scratch->used;
+  const size_t len = fixed_format(dst, scratch->size - scratch->used, value, decimals);
+  if (len == 0) return "0";
+  scratch->used += len + 1;
+  return dst;
+}
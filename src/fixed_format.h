@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-decimals float-to-ASCII for telemetry paths (UI readouts, JSON,
+// serial). Output matches printf("%.*f") for every float, including
+// round-half-even on exact ties and "-0.00" for small negatives, but uses
+// only integer arithmetic: no double, no locale, no heap.
+
+constexpr uint8_t FIXED_FORMAT_MAX_DECIMALS = 9;
+// Sign + 39 integer digits (FLT_MAX) + '.' + decimals + NUL.
+constexpr size_t FIXED_FORMAT_MAX_LEN = 1 + 39 + 1 + FIXED_FORMAT_MAX_DECIMALS + 1;
+
+enum : uint8_t {
+  FIXED_FORMAT_SPACE_SIGN = 0x01,  // like "% f": ' ' in front of non-negative values
+};
+
+// Writes `value` with `decimals` (clamped to FIXED_FORMAT_MAX_DECIMALS)
+// fractional digits. Returns the length written, or 0 (with out[0] = '\0'
+// when out_size > 0) if the text does not fit. NaN/inf print as "nan"/"inf".
+size_t fixed_format(char *out, size_t out_size, float value, uint8_t decimals, uint8_t flags = 0);
+
+// Several formatted values sharing one caller-owned buffer, for feeding a
+// single snprintf() through "%s" instead of "%.*f".
+struct FixedFormatScratch {
+  char *buf;
+  size_t size;
+  size_t used;
+};
+
+void fixed_format_scratch_init(FixedFormatScratch *scratch, char *buf, size_t size);
+
+// Returns the formatted text, or "0" if the scratch buffer is full.
+const char *fixed_format_next(FixedFormatScratch *scratch, float value, uint8_t decimals);
@@ -0,0 +1,220 @@
+#include "flight_log.h"
+#include "i2c_bus.h"
+#include "serial_log.h"
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+#include <esp_system.h>
+#include <stdio.h>
+#include <string.h>
+
+// ============================================================
+// CONFIG
+// ============================================================
+
+static const uint32_t flightLoopOverrunUs = 100000;
+static const uint32_t flightI2cEventIntervalMs = 1000;
+static const uint32_t flightHeapPollMs = 1000;
+static const uint32_t flightHeapLowBytes = 16 * 1024;
+static const uint32_t flightHeapRearmBytes = 24 * 1024;
+
+// ============================================================
+// STATE
+// ============================================================
+
+// Not touched by the startup code, so it keeps its content over every reset
+// but a power-on.
+RTC_NOINIT_ATTR static FlightRecorder flight_rtc;
+
+static FlightEvent flight_previous[FLIGHT_RECORDER_EVENTS];
+static uint8_t flight_previous_count = 0;
+static bool flight_previous_valid = false;
+static uint32_t flight_previous_reason = 0;   // what started the previous boot
+static uint32_t flight_reset_reason = 0;      // what ended it
+static uint32_t flight_seq = 0;
+static bool flight_started = false;
+
+static uint32_t flight_i2c_last_ms[I2C_DEV_COUNT] = {};
+static bool flight_i2c_logged[I2C_DEV_COUNT] = {};
+static uint32_t flight_i2c_pending[I2C_DEV_COUNT] = {};
+static uint32_t flight_heap_last_poll_ms = 0;
+static bool flight_heap_low = false;
+
+// Scratch for the reports (loop task only).
+static FlightEvent flight_current[FLIGHT_RECORDER_EVENTS];
+
+static const char *reset_reason_name(uint32_t reason)
+{
+  switch ((esp_reset_reason_t)reason) {
+    case ESP_RST_POWERON: return "poweron";
+    case ESP_RST_EXT: return "external";
+    case ESP_RST_SW: return "software";
+    case ESP_RST_PANIC: return "panic";
+    case ESP_RST_INT_WDT: return "int_wdt";
+    case ESP_RST_TASK_WDT: return "task_wdt";
+    case ESP_RST_WDT: return "wdt";
+    case ESP_RST_DEEPSLEEP: return "deepsleep";
+    case ESP_RST_BROWNOUT: return "brownout";
+    case ESP_RST_SDIO: return "sdio";
+    default: return "unknown";
+  }
+}
+
+// A reset that nobody asked for: the previous run's tail is worth a look.
+static bool reset_was_unexpected(uint32_t reason)
+{
+  switch ((esp_reset_reason_t)reason) {
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+    case ESP_RST_BROWNOUT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// ============================================================
+// RECORDING
+// ============================================================
+
+void flight_log_begin(void)
+{
+  flight_reset_reason = (uint32_t)esp_reset_reason();
+  uint32_t boot_count = 1;
+  flight_previous_valid = flight_recorder_valid(flight_rtc);
+  if (flight_previous_valid) {
+    flight_previous_count = flight_recorder_collect(flight_rtc, flight_previous, FLIGHT_RECORDER_EVENTS);
+    flight_previous_reason = flight_rtc.reset_reason;
+    boot_count = flight_rtc.boot_count + 1;
+  }
+  flight_recorder_start(&flight_rtc, boot_count, flight_reset_reason);
+  flight_started = true;
+  flight_log(FLIGHT_EVENT_BOOT, (uint8_t)flight_reset_reason, boot_count);
+
+  // Kept by the serial log until its drain task runs.
+  if (flight_previous_valid && reset_was_unexpected(flight_reset_reason)) {
+    SerialLogWarn.printf("Flight recorder: last reset was %s, %u events recovered ('F' to show)\n",
+                         reset_reason_name(flight_reset_reason), (unsigned)flight_previous_count);
+  }
+}
+
+void flight_log(FlightEventType type, uint8_t arg, uint32_t value)
+{
+  if (!flight_started) return;
+  const uint32_t seq = __atomic_add_fetch(&flight_seq, 1, __ATOMIC_RELAXED);
+  flight_recorder_write(&flight_rtc, seq, type, arg, value, millis());
+}
+
+void flight_log_loop_pass(FlightLoop loop, uint32_t us)
+{
+  if (us >= flightLoopOverrunUs) flight_log(FLIGHT_EVENT_LOOP_OVERRUN, loop, us);
+}
+
+void flight_log_i2c_error(uint8_t device)
+{
+  if (device >= I2C_DEV_COUNT) return;
+  flight_i2c_pending[device]++;
+  const uint32_t now = millis();
+  if (flight_i2c_logged[device] && (now - flight_i2c_last_ms[device]) < flightI2cEventIntervalMs) return;
+  flight_i2c_logged[device] = true;
+  flight_i2c_last_ms[device] = now;
+  flight_log(FLIGHT_EVENT_I2C_ERROR, device, flight_i2c_pending[device]);
+  flight_i2c_pending[device] = 0;
+}
+
+void flight_log_poll(uint32_t now_ms)
+{
+  if ((now_ms - flight_heap_last_poll_ms) < flightHeapPollMs) return;
+  flight_heap_last_poll_ms = now_ms;
+  const uint32_t free_bytes = (uint32_t)heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  if (!flight_heap_low && free_bytes < flightHeapLowBytes) {
+    flight_heap_low = true;
+    flight_log(FLIGHT_EVENT_HEAP_LOW, 0, free_bytes);
+  } else if (flight_heap_low && free_bytes > flightHeapRearmBytes) {
+    flight_heap_low = false;
+  }
+}
+
+// ============================================================
+// REPORTS
+// ============================================================
+
+static void print_events(const FlightEvent *events, uint8_t count)
+{
+  if (count == 0) {
+    SerialLog.println("  (none)");
+    return;
+  }
+  for (uint8_t i = 0; i < count; i++) {
+    SerialLog.printf("  %9lu ms  %-12s arg %3u  value %lu\n",
+                     (unsigned long)events[i].t_ms, flight_event_name(events[i].type),
+                     (unsigned)events[i].arg, (unsigned long)events[i].value);
+  }
+}
+
+void flight_log_print(void)
+{
+  SerialLog.println();
+  SerialLog.printf("===== FLIGHT RECORDER (boot #%lu) =====\n", (unsigned long)flight_rtc.boot_count);
+  SerialLog.printf("Last reset: %s\n", reset_reason_name(flight_reset_reason));
+  if (flight_previous_valid) {
+    SerialLog.printf("Previous run (started by %s), oldest first:\n", reset_reason_name(flight_previous_reason));
+    print_events(flight_previous, flight_previous_count);
+  } else {
+    SerialLog.println("Previous run: nothing recovered (power-on)");
+  }
+  SerialLog.println("This run:");
+  print_events(flight_current, flight_recorder_collect(flight_rtc, flight_current, FLIGHT_RECORDER_EVENTS));
+  SerialLog.println("==========================================");
+}
+
+// Appends to out[*len]; false (and nothing usable in `out`) when full.
+static bool flight_json_append_events(const FlightEvent *events, uint8_t count, char *out, size_t size,
+                                      size_t *len)
+{
+  const size_t n = flight_events_format_json(events, count, out + *len, size - *len);
+  *len += n;
+  return n != 0;
+}
+
+static bool flight_json_append_text(const char *text, char *out, size_t size, size_t *len)
+{
+  const size_t n = strlen(text);
+  if (*len + n + 1 > size) return false;
+  memcpy(out + *len, text, n + 1);
+  *len += n;
+  return true;
+}
+
+size_t flight_log_format_json(char *out, size_t size)
+{
+  if (!out || size == 0) return 0;
+  const int head = snprintf(out, size,
+                            "{\"reset_reason\":\"%s\",\"reset_code\":%lu,\"boot_count\":%lu,"
+                            "\"previous_started_by\":\"%s\",\"fields\":[\"t_ms\",\"type\",\"arg\",\"value\"],"
+                            "\"previous\":",
+                            reset_reason_name(flight_reset_reason), (unsigned long)flight_reset_reason,
+                            (unsigned long)flight_rtc.boot_count,
+                            flight_previous_valid ? reset_reason_name(flight_previous_reason) : "");
+  if (head < 0 || (size_t)head >= size) {
+    out[0] = '\0';
+    return 0;
+  }
+
+  // Both arrays are formatted straight into `out`; no second copy in RAM.
+  size_t len = (size_t)head;
+  const uint8_t count = flight_recorder_collect(flight_rtc, flight_current, FLIGHT_RECORDER_EVENTS);
+  const bool ok = (flight_previous_valid
+                     ? flight_json_append_events(flight_previous, flight_previous_count, out, size, &len)
+                     : flight_json_append_text("null", out, size, &len)) &&
+                  flight_json_append_text(",\"current\":", out, size, &len) &&
+                  flight_json_append_events(flight_current, count, out, size, &len) &&
+                  flight_json_append_text("}", out, size, &len);
+  if (!ok) {
+    out[0] = '\0';
+    return 0;
+  }
+  return len;
+}
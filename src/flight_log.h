@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "flight_recorder.h"
+
+// Flight recorder (src/flight_recorder.h) kept in RTC memory across resets.
+// On boot the ring of the previous run is copied aside together with
+// esp_reset_reason(); serial `F` and GET /api/flight show both.
+
+// First thing in setup(): recover the previous ring, start a new one.
+void flight_log_begin(void);
+
+// Any task (not from an ISR).
+void flight_log(FlightEventType type, uint8_t arg, uint32_t value);
+
+// Duration of one pass of a loop; anything over 100 ms is recorded.
+void flight_log_loop_pass(FlightLoop loop, uint32_t us);
+
+// Failed I2C transaction; at most one event per device and second, carrying
+// the number of failures since the previous one.
+void flight_log_i2c_error(uint8_t device);
+
+// Called from the main loop; samples the heap once per second.
+void flight_log_poll(uint32_t now_ms);
+
+void flight_log_print(void);
+// Returns the length written, or 0 if `size` is too small.
+size_t flight_log_format_json(char *out, size_t size);
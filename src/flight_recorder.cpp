@@ -0,0 +1,87 @@
+#include "flight_recorder.h"
+
+#include <stdio.h>
+#include <string.h>
+
+bool flight_recorder_valid(const FlightRecorder &fr) {
+  return fr.magic == FLIGHT_RECORDER_MAGIC && fr.version == FLIGHT_RECORDER_VERSION &&
+         fr.size == sizeof(FlightRecorder);
+}
+
+void flight_recorder_start(FlightRecorder *fr, uint32_t boot_count, uint32_t reset_reason) {
+  if (!fr) return;
+  memset(fr, 0, sizeof(*fr));
+  fr->magic = FLIGHT_RECORDER_MAGIC;
+  fr->version = FLIGHT_RECORDER_VERSION;
+  fr->size = (uint16_t)sizeof(FlightRecorder);
+  fr->boot_count = boot_count;
+  fr->reset_reason = reset_reason;
+}
+
+void flight_recorder_write(FlightRecorder *fr, uint32_t seq, FlightEventType type, uint8_t arg,
+                           uint32_t value, uint32_t now_ms) {
+  if (!fr || seq == 0) return;
+  volatile FlightEvent &e = fr->events[(seq - 1) % FLIGHT_RECORDER_EVENTS];
+  e.seq = 0;
+  e.t_ms = now_ms;
+  e.value = value;
+  e.type = type;
+  e.arg = arg;
+  e.seq = seq;
+}
+
+uint8_t flight_recorder_collect(const FlightRecorder &fr, FlightEvent *out, uint8_t max) {
+  if (!out || max == 0) return 0;
+  uint32_t newest = 0;
+  for (uint8_t i = 0; i < FLIGHT_RECORDER_EVENTS; ++i) {
+    if (fr.events[i].seq > newest) newest = fr.events[i].seq;
+  }
+  if (newest == 0) return 0;
+
+  // Walk the last lap in write order; a slot holding anything but the
+  // expected seq is empty, torn or stale and is skipped.
+  const uint32_t first = (newest > FLIGHT_RECORDER_EVENTS) ? newest - FLIGHT_RECORDER_EVENTS + 1 : 1;
+  uint8_t n = 0;
+  for (uint32_t seq = first; seq <= newest && n < max; ++seq) {
+    const FlightEvent &e = fr.events[(seq - 1) % FLIGHT_RECORDER_EVENTS];
+    if (e.seq != seq || e.type >= FLIGHT_EVENT_COUNT) continue;
+    out[n++] = e;
+  }
+  return n;
+}
+
+const char *flight_event_name(uint8_t type) {
+  switch (type) {
+    case FLIGHT_EVENT_BOOT: return "boot";
+    case FLIGHT_EVENT_LOOP_OVERRUN: return "loop_overrun";
+    case FLIGHT_EVENT_I2C_ERROR: return "i2c_error";
+    case FLIGHT_EVENT_HEAP_LOW: return "heap_low";
+    case FLIGHT_EVENT_WIFI: return "wifi";
+    case FLIGHT_EVENT_OTA: return "ota";
+    default: return "?";
+  }
+}
+
+size_t flight_events_format_json(const FlightEvent *events, uint8_t count, char *out, size_t size) {
+  if (!out || size < 3 || (!events && count)) return 0;
+  size_t len = 0;
+  out[len++] = '[';
+  for (uint8_t i = 0; i < count; ++i) {
+    const FlightEvent &e = events[i];
+    const int n = snprintf(out + len, size - len, "%s[%lu,\"%s\",%u,%lu]",
+                           i ? "," : "", (unsigned long)e.t_ms, flight_event_name(e.type),
+                           (unsigned)e.arg, (unsigned long)e.value);
+    if (n < 0 || (size_t)n >= size - len) {
+      out[0] = '\0';
+      return 0;
+    }
+    len += (size_t)n;
+  }
+  if (len + 2 > size) {
+    out[0] = '\0';
+    return 0;
+  }
+  out[len++] = ']';
+  out[len] = '\0';
+  return len;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Event ring that survives watchdog / panic / brownout resets. The firmware
+// keeps one FlightRecorder in RTC memory that is not reinitialised on reset
+// (RTC_NOINIT_ATTR); after a power-on its content is garbage, which the
+// magic/version/size check rejects. Writing an event is a handful of stores:
+// the caller hands in a sequence number (an atomic counter in normal RAM)
+// and the event lands in slot (seq - 1) % FLIGHT_RECORDER_EVENTS. The seq
+// is cleared first and stored last, so a reset in the middle of a write
+// leaves a slot that collect() skips.
+
+constexpr uint32_t FLIGHT_RECORDER_MAGIC = 0x464C5231UL;  // "FLR1"
+constexpr uint16_t FLIGHT_RECORDER_VERSION = 1;           // bump on layout change
+constexpr uint8_t FLIGHT_RECORDER_EVENTS = 64;
+
+enum FlightEventType : uint8_t {
+  FLIGHT_EVENT_BOOT = 0,       // arg: esp_reset_reason_t, value: boot count
+  FLIGHT_EVENT_LOOP_OVERRUN,   // arg: FlightLoop, value: pass time in us
+  FLIGHT_EVENT_I2C_ERROR,      // arg: I2cDevice, value: failed transactions since the last event
+  FLIGHT_EVENT_HEAP_LOW,       // value: free internal heap in bytes
+  FLIGHT_EVENT_WIFI,           // arg: FlightWifi, value: detail (see FlightWifi)
+  FLIGHT_EVENT_OTA,            // arg: FlightOta, value: bytes written
+  FLIGHT_EVENT_COUNT
+};
+
+enum FlightLoop : uint8_t {
+  FLIGHT_LOOP_SENSOR = 0,      // one sensor loop pass
+  FLIGHT_LOOP_HTTP,            // one server.handleClient() call
+};
+
+enum FlightWifi : uint8_t {
+  FLIGHT_WIFI_RADIO_OFF = 0,
+  FLIGHT_WIFI_RADIO_ON,
+  FLIGHT_WIFI_STA_CONNECTED,   // value: connect time in ms
+  FLIGHT_WIFI_STA_FAILED,      // value: consecutive failures
+  FLIGHT_WIFI_STA_DROPPED,
+  FLIGHT_WIFI_AP_STARTED,      // value: channel
+  FLIGHT_WIFI_AP_FAILED,
+  FLIGHT_WIFI_AP_CHANNEL,      // value: new channel
+};
+
+enum FlightOta : uint8_t {
+  FLIGHT_OTA_START = 0,
+  FLIGHT_OTA_DONE,             // image verified, reboot follows
+  FLIGHT_OTA_FAILED,
+  FLIGHT_OTA_ABORTED,
+};
+
+struct FlightEvent {
+  uint32_t seq;    // 1-based write order; 0 = empty or torn slot
+  uint32_t t_ms;   // millis() of that boot
+  uint32_t value;
+  uint8_t type;
+  uint8_t arg;
+  uint16_t reserved;
+};
+
+struct FlightRecorder {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;
+  uint32_t boot_count;    // boots since the last power-on
+  uint32_t reset_reason;  // why this boot happened (esp_reset_reason_t)
+  FlightEvent events[FLIGHT_RECORDER_EVENTS];
+};
+
+bool flight_recorder_valid(const FlightRecorder &fr);
+
+// Empty ring for a new boot.
+void flight_recorder_start(FlightRecorder *fr, uint32_t boot_count, uint32_t reset_reason);
+
+void flight_recorder_write(FlightRecorder *fr, uint32_t seq, FlightEventType type, uint8_t arg,
+                           uint32_t value, uint32_t now_ms);
+
+// Copy the events oldest first; returns how many were copied.
+uint8_t flight_recorder_collect(const FlightRecorder &fr, FlightEvent *out, uint8_t max);
+
+const char *flight_event_name(uint8_t type);
+
+// [[t_ms,"type",arg,value],...]. Returns the length written, or 0 if `size`
+// is too small.
+size_t flight_events_format_json(const FlightEvent *events, uint8_t count, char *out, size_t size);
@@ -0,0 +1,97 @@
+#include "frame_diff.h"
+
+#include <string.h>
+
+namespace {
+
+bool clip_region(const FrameRect &in, int width, int height, FrameRect *out) {
+  FrameRect r = in;
+  if (r.x1 < 0) r.x1 = 0;
+  if (r.y1 < 0) r.y1 = 0;
+  if (r.x2 > width - 1) r.x2 = (int16_t)(width - 1);
+  if (r.y2 > height - 1) r.y2 = (int16_t)(height - 1);
+  if (r.x1 > r.x2 || r.y1 > r.y2) return false;
+  *out = r;
+  return true;
+}
+
+// First/last differing column of one row segment; false if identical.
+bool row_span(const uint16_t *cur, const uint16_t *prev, int x1, int x2, int *first, int *last) {
+  const size_t n = (size_t)(x2 - x1 + 1);
+  if (memcmp(cur + x1, prev + x1, n * sizeof(uint16_t)) == 0) return false;
+
+  int lo = x1;
+  while (cur[lo] == prev[lo]) ++lo;
+  int hi = x2;
+  while (cur[hi] == prev[hi]) --hi;
+  *first = lo;
+  *last = hi;
+  return true;
+}
+
+void join_rect(FrameRect *dst, const FrameRect &src) {
+  if (src.x1 < dst->x1) dst->x1 = src.x1;
+  if (src.y1 < dst->y1) dst->y1 = src.y1;
+  if (src.x2 > dst->x2) dst->x2 = src.x2;
+  if (src.y2 > dst->y2) dst->y2 = src.y2;
+}
+
+}  // namespace
+
+uint32_t frame_rect_area(const FrameRect &r) {
+  if (r.x2 < r.x1 || r.y2 < r.y1) return 0;
+  return (uint32_t)(r.x2 - r.x1 + 1) * (uint32_t)(r.y2 - r.y1 + 1);
+}
+
+size_t frame_diff_rects(const uint16_t *cur,
+                        const uint16_t *prev,
+                        int width,
+                        int height,
+                        const FrameRect &region,
+                        int row_gap,
+                        FrameRect *out,
+                        size_t max_rects) {
+  if (!cur || !prev || !out || max_rects == 0 || width <= 0 || height <= 0) return 0;
+  FrameRect area;
+  if (!clip_region(region, width, height, &area)) return 0;
+  if (row_gap < 1) row_gap = 1;
+
+  size_t count = 0;
+  bool band_open = false;
+  int clean_rows = 0;
+
+  for (int y = area.y1; y <= area.y2; ++y) {
+    const size_t row = (size_t)y * (size_t)width;
+    int first = 0;
+    int last = 0;
+    if (!row_span(cur + row, prev + row, area.x1, area.x2, &first, &last)) {
+      if (band_open && ++clean_rows >= row_gap) {
+        band_open = false;
+      }
+      continue;
+    }
+
+    const FrameRect line = {(int16_t)first, (int16_t)y, (int16_t)last, (int16_t)y};
+    clean_rows = 0;
+    if (band_open) {
+      join_rect(&out[count - 1], line);
+      continue;
+    }
+    if (count < max_rects) {
+      out[count++] = line;
+    } else {
+      join_rect(&out[count - 1], line);
+    }
+    band_open = true;
+  }
+  return count;
+}
+
+void frame_diff_commit(const uint16_t *cur, uint16_t *prev, int width, const FrameRect &rect) {
+  if (!cur || !prev || width <= 0 || rect.x2 < rect.x1 || rect.y2 < rect.y1) return;
+  const size_t n = (size_t)(rect.x2 - rect.x1 + 1) * sizeof(uint16_t);
+  for (int y = rect.y1; y <= rect.y2; ++y) {
+    const size_t offset = (size_t)y * (size_t)width + (size_t)rect.x1;
+    memcpy(prev + offset, cur + offset, n);
+  }
+}
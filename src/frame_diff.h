@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Inclusive pixel rectangle (same convention as lv_area_t).
+struct FrameRect {
+  int16_t x1;
+  int16_t y1;
+  int16_t x2;
+  int16_t y2;
+};
+
+uint32_t frame_rect_area(const FrameRect &r);
+
+// Compare `cur` against `prev` (RGB565 frames, `width` pixels per row) inside
+// `region` and write the bounding rectangles of what actually changed to `out`.
+// Changed rows are grouped into bands; a band is closed once `row_gap`
+// consecutive rows are identical. When more than `max_rects` bands are found
+// the remainder is merged into the last slot. Returns the number of rects.
+size_t frame_diff_rects(const uint16_t *cur,
+                        const uint16_t *prev,
+                        int width,
+                        int height,
+                        const FrameRect &region,
+                        int row_gap,
+                        FrameRect *out,
+                        size_t max_rects);
+
+// Copy `rect` from `cur` into `prev` once it has been sent to the panel.
+void frame_diff_commit(const uint16_t *cur, uint16_t *prev, int width, const FrameRect &rect);
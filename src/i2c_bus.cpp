@@ -0,0 +1,189 @@
+#include "i2c_bus.h"
+#include "flight_log.h"
+#include <Wire.h>
+
+// ============================================================
+// BUS CONFIG
+// ============================================================
+
+#define I2C_BUS_SDA_PIN 40
+#define I2C_BUS_SCL_PIN 39
+
+const uint16_t I2C_BUS_LATENCY_EDGES_US[I2C_BUS_LATENCY_BUCKETS - 1] = {
+  100, 200, 400, 800, 1600, 3200, 6400
+};
+
+static SemaphoreHandle_t bus_mutex = nullptr;
+static uint32_t bus_clock = 0;
+
+// Owner bookkeeping, valid between acquire and release.
+static uint32_t owner_request_us = 0;
+static uint32_t owner_wait_us = 0;
+
+static portMUX_TYPE bus_stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static I2cDeviceStats bus_stats[I2C_DEV_COUNT] = {};
+static uint8_t bus_waiting[I2C_DEV_COUNT] = {};
+
+// ============================================================
+// STATS
+// ============================================================
+
+static uint8_t latency_bucket(uint32_t us)
+{
+  for (uint8_t i = 0; i < I2C_BUS_LATENCY_BUCKETS - 1; i++) {
+    if (us < I2C_BUS_LATENCY_EDGES_US[i]) return i;
+  }
+  return I2C_BUS_LATENCY_BUCKETS - 1;
+}
+
+static void record(I2cDevice dev, I2cBusResult result, uint32_t latency_us, uint32_t wait_us)
+{
+  if (dev >= I2C_DEV_COUNT || result >= I2C_BUS_RESULT_COUNT) return;
+  portENTER_CRITICAL(&bus_stats_mux);
+  I2cDeviceStats &s = bus_stats[dev];
+  s.transactions++;
+  s.results[result]++;
+  s.latency_hist[latency_bucket(latency_us)]++;
+  if (latency_us > s.latency_max_us) s.latency_max_us = latency_us;
+  if (wait_us > s.wait_max_us) s.wait_max_us = wait_us;
+  portEXIT_CRITICAL(&bus_stats_mux);
+  if (result != I2C_BUS_OK) flight_log_i2c_error(dev);
+}
+
+static bool higher_priority_waiting(I2cDevice dev)
+{
+  bool waiting = false;
+  portENTER_CRITICAL(&bus_stats_mux);
+  for (uint8_t i = 0; i < (uint8_t)dev; i++) {
+    if (bus_waiting[i]) waiting = true;
+  }
+  portEXIT_CRITICAL(&bus_stats_mux);
+  return waiting;
+}
+
+static void set_waiting(I2cDevice dev, bool waiting)
+{
+  portENTER_CRITICAL(&bus_stats_mux);
+  if (waiting) {
+    bus_waiting[dev]++;
+  } else if (bus_waiting[dev]) {
+    bus_waiting[dev]--;
+  }
+  portEXIT_CRITICAL(&bus_stats_mux);
+}
+
+// ============================================================
+// PUBLIC API
+// ============================================================
+
+bool i2c_bus_begin(void)
+{
+  if (!bus_mutex) {
+    bus_mutex = xSemaphoreCreateMutex();
+  }
+  const bool ok = Wire.begin(I2C_BUS_SDA_PIN, I2C_BUS_SCL_PIN, I2C_BUS_CLOCK_HZ);
+  bus_clock = Wire.getClock();
+  return ok;
+}
+
+void i2c_bus_end(void)
+{
+  const bool held = bus_mutex && xSemaphoreTake(bus_mutex, pdMS_TO_TICKS(100)) == pdTRUE;
+  Wire.end();
+  bus_clock = 0;
+  if (held) xSemaphoreGive(bus_mutex);
+}
+
+bool i2c_bus_reset(I2cDevice dev)
+{
+  if (!i2c_bus_acquire(dev)) return false;
+  Wire.end();
+  delay(2);
+  const bool ok = Wire.begin(I2C_BUS_SDA_PIN, I2C_BUS_SCL_PIN, I2C_BUS_CLOCK_HZ);
+  bus_clock = Wire.getClock();
+  delay(3);
+  i2c_bus_release(dev, ok ? I2C_BUS_OK : I2C_BUS_ERR_OTHER);
+  return ok;
+}
+
+bool i2c_bus_acquire(I2cDevice dev, uint32_t timeout_ms)
+{
+  const uint32_t t0 = micros();
+  if (!bus_mutex || dev >= I2C_DEV_COUNT) {
+    owner_request_us = t0;
+    owner_wait_us = 0;
+    return true;
+  }
+
+  // Back off while a higher-priority device is queued; FreeRTOS would
+  // otherwise hand the mutex over in arrival order.
+  const TickType_t start = xTaskGetTickCount();
+  const TickType_t limit = pdMS_TO_TICKS(timeout_ms);
+  bool got = false;
+  set_waiting(dev, true);
+  for (;;) {
+    const TickType_t elapsed = xTaskGetTickCount() - start;
+    if (!higher_priority_waiting(dev)) {
+      const TickType_t remaining = (elapsed < limit) ? (limit - elapsed) : 0;
+      if (xSemaphoreTake(bus_mutex, remaining) == pdTRUE) {
+        if (!higher_priority_waiting(dev)) {
+          got = true;
+          break;
+        }
+        xSemaphoreGive(bus_mutex);
+      }
+    }
+    if ((xTaskGetTickCount() - start) >= limit) break;
+    vTaskDelay(1);
+  }
+  set_waiting(dev, false);
+
+  const uint32_t waited = micros() - t0;
+  if (!got) {
+    record(dev, I2C_BUS_ERR_LOCK, waited, waited);
+    return false;
+  }
+  owner_request_us = t0;
+  owner_wait_us = waited;
+  return true;
+}
+
+void i2c_bus_release(I2cDevice dev, I2cBusResult result)
+{
+  const uint32_t latency = micros() - owner_request_us;
+  record(dev, result, latency, owner_wait_us);
+  if (bus_mutex) xSemaphoreGive(bus_mutex);
+}
+
+I2cBusResult i2c_bus_result_from_wire(uint8_t wire_err)
+{
+  switch (wire_err) {
+    case 0: return I2C_BUS_OK;
+    case 2: return I2C_BUS_ERR_NACK_ADDR;
+    case 3: return I2C_BUS_ERR_NACK_DATA;
+    case 5: return I2C_BUS_ERR_TIMEOUT;
+    default: return I2C_BUS_ERR_OTHER;
+  }
+}
+
+uint32_t i2c_bus_clock_hz(void)
+{
+  return bus_clock;
+}
+
+void i2c_bus_get_stats(I2cDevice dev, I2cDeviceStats *out)
+{
+  if (!out || dev >= I2C_DEV_COUNT) return;
+  portENTER_CRITICAL(&bus_stats_mux);
+  *out = bus_stats[dev];
+  portEXIT_CRITICAL(&bus_stats_mux);
+}
+
+const char *i2c_bus_device_name(I2cDevice dev)
+{
+  switch (dev) {
+    case I2C_DEV_IMU: return "imu";
+    case I2C_DEV_TOUCH: return "touch";
+    default: return "?";
+  }
+}
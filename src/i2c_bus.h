@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Shared I2C bus (GPIO 40/39) for the IMU and the touch controller.
+//
+// The bus manager owns Wire: it starts it at I2C_BUS_CLOCK_HZ and serializes
+// access from the sensor loop and the LVGL task. Every device transaction (or
+// short sequence, e.g. one QMI8658 sample read) is bracketed by
+// i2c_bus_acquire()/i2c_bus_release(). A lower-priority device backs off while
+// a higher-priority one is waiting, so an IMU sample never queues behind more
+// than the touch transaction already on the wire.
+
+// QMI8658 and FT3168 are both fast-mode (400 kHz) parts.
+#ifndef I2C_BUS_CLOCK_HZ
+#define I2C_BUS_CLOCK_HZ 400000UL
+#endif
+
+// In priority order: lower value wins.
+enum I2cDevice : uint8_t {
+  I2C_DEV_IMU = 0,
+  I2C_DEV_TOUCH,
+  I2C_DEV_COUNT
+};
+
+enum I2cBusResult : uint8_t {
+  I2C_BUS_OK = 0,
+  I2C_BUS_ERR_NACK_ADDR,
+  I2C_BUS_ERR_NACK_DATA,
+  I2C_BUS_ERR_TIMEOUT,
+  I2C_BUS_ERR_SHORT_READ,
+  I2C_BUS_ERR_LOCK,        // bus not obtained within the wait limit
+  I2C_BUS_ERR_OTHER,
+  I2C_BUS_RESULT_COUNT
+};
+
+// Latency (request to release, includes waiting for the bus) histogram:
+// bucket i counts transactions below I2C_BUS_LATENCY_EDGES_US[i], the last
+// bucket everything slower.
+constexpr uint8_t I2C_BUS_LATENCY_BUCKETS = 8;
+extern const uint16_t I2C_BUS_LATENCY_EDGES_US[I2C_BUS_LATENCY_BUCKETS - 1];
+
+struct I2cDeviceStats {
+  uint32_t transactions;
+  uint32_t results[I2C_BUS_RESULT_COUNT];  // [I2C_BUS_OK] = successes
+  uint32_t latency_hist[I2C_BUS_LATENCY_BUCKETS];
+  uint32_t latency_max_us;
+  uint32_t wait_max_us;                    // longest wait for the bus
+};
+
+static const uint32_t I2C_BUS_WAIT_MS = 20;
+
+bool i2c_bus_begin(void);
+void i2c_bus_end(void);
+// Tear the bus down and start it again (touch recovery). Takes the bus.
+bool i2c_bus_reset(I2cDevice dev);
+
+bool i2c_bus_acquire(I2cDevice dev, uint32_t timeout_ms = I2C_BUS_WAIT_MS);
+void i2c_bus_release(I2cDevice dev, I2cBusResult result);
+
+// Wire.endTransmission() code to a result class.
+I2cBusResult i2c_bus_result_from_wire(uint8_t wire_err);
+
+uint32_t i2c_bus_clock_hz(void);
+void i2c_bus_get_stats(I2cDevice dev, I2cDeviceStats *out);
+const char *i2c_bus_device_name(I2cDevice dev);
@@ -38,19 +38,39 @@
 #include <esp_sleep.h>
 #include <driver/rtc_io.h>
 #include "inclinometer_shared.h"
+#include "ui_lvgl.h"
 #include "touch_bsp.h"
 #include "remote_control.h"
 #include "fw_version.h"
+#include "fixed_format.h"
+#include "i2c_bus.h"
+#include "power_manager.h"
+#include "resume_state.h"
+#include "battery_model.h"
+#include "telemetry_frame.h"
+#include "serial_log.h"
+#include "perf_counters.h"
+#include "flight_log.h"
+#include <esp_attr.h>
+#include <esp_system.h>
 
 // ============================================================
 // CONFIGURATION
 // ============================================================
 
-#define SDA_PIN 40
-#define SCL_PIN 39
 #define BOOT_BUTTON_PIN 0
 #define BATTERY_ADC_PIN 1
 
+// QMI8658 interrupt line used as a deep-sleep wake source (wake-on-motion).
+// Must be an RTC-capable GPIO (0-21). Leave at -1 to wake on ACTION only.
+#ifndef IMU_WAKE_INT_PIN
+#define IMU_WAKE_INT_PIN -1
+#endif
+// Which QMI8658 output (INT1 or INT2) is wired to IMU_WAKE_INT_PIN.
+#ifndef IMU_WAKE_INT_LINE
+#define IMU_WAKE_INT_LINE 1
+#endif
+
 #define EEPROM_SIZE 128
 #define EEPROM_ADDR_MODE       0
 #define EEPROM_ADDR_ROTATION   2
@@ -70,6 +90,10 @@
 #define EEPROM_ADDR_DISPLAY_BRIGHTNESS 108
 #define EEPROM_ADDR_TOUCH_ENABLED    109
 #define EEPROM_ADDR_TOUCH_PERSIST    110
+#define EEPROM_ADDR_DISPLAY_TARGET_FPS 111
+#define EEPROM_ADDR_DISPLAY_DIM_TIMEOUT 112   // 10 s units, 0 = never
+#define EEPROM_ADDR_DISPLAY_BLANK_TIMEOUT 113 // 10 s units, 0 = never
+#define EEPROM_ADDR_AUTO_SLEEP_TIMEOUT 114    // minutes, 0 = never
 static const uint32_t EEPROM_BIAS_MAGIC = 0x42534131UL; // "BSA1"
 static const uint32_t EEPROM_ZERO_MAGIC = 0x5A455231UL; // "ZER1"
 
@@ -80,9 +104,17 @@ const float alpha = 0.90;
 // Reference gravity magnitude (used only for accel Z offset)
 const float g_ref = 9.81;
 
-// Shared variable with UI
-volatile float ui_roll = 0.0f;
-volatile float ui_pitch = 0.0f;
+// Shared variable with UI (LVGL runs in its own task; see display_panel.cpp)
+static float ui_roll = 0.0f;
+static float ui_pitch = 0.0f;
+static uint32_t ui_sample_us = 0;
+static portMUX_TYPE uiAngleMux = portMUX_INITIALIZER_UNLOCKED;
+// Set by the first fused sample after setup; the display holds its first
+// frame (and the splash) until then.
+static volatile bool uiAnglesLiveFlag = false;
+static volatile bool uiSensorsReadyFlag = false;
+// Bit per UiCommand, set by postUiCommand() on the LVGL task.
+static uint32_t uiCommandsPending = 0;
 
 // ============================================================
 // GLOBAL STATE
@@ -96,6 +128,10 @@ volatile TouchUiLayoutMode touchUiLayoutMode = TOUCH_UI_ADVANCED;
 static bool autoZeroOnBootEnabled = true;
 static DisplayPrecisionMode displayPrecisionMode = DISPLAY_PRECISION_2DP;
 static uint8_t displayBrightnessPercent = 100;
+static uint8_t displayTargetFps = 30;
+static uint16_t displayDimTimeoutSec = 60;
+static uint16_t displayBlankTimeoutSec = 0;   // off unless chosen: a unit read on a jig sits still
+static uint16_t autoSleepTimeoutMin = 0;
 static bool touchInputEnabled = true;
 static bool touchLockPersistent = false;
 static bool freezeActive = false;
@@ -133,6 +169,10 @@ static const unsigned long bootBtnVeryLongPressMs = 2200;
 static const unsigned long bootBtnUltraLongPressMs = 3200;
 static const unsigned long bootBtnSleepPressMs = 5000;
 static const unsigned long bootBtnSleepReleaseGuardMs = 250;
+// Two short presses within this window: Wi-Fi on (the freeze toggled by the
+// first press is undone).
+static const unsigned long bootBtnDoublePressMs = 400;
+static unsigned long bootBtnLastShortReleaseMs = 0;
 static const unsigned long modeStillMs = 1500;
 static const float modeMotionThreshDeg = 0.8f;
 static bool offsetCalPending = false;
@@ -160,6 +200,13 @@ static float zeroSumRoll = 0.0f;
 static float zeroSumPitch = 0.0f;
 static const unsigned long zeroStillMs = 1000;
 static const float zeroMotionThreshDeg = 0.4f;
+// Display idle policy: motion beyond these limits counts as user activity.
+static const float idleMotionThreshDeg = 1.0f;
+static const float idleMotionGyroDps = 20.0f;
+static bool idleRefValid = false;
+static float idleRefRoll = 0.0f;
+static float idleRefPitch = 0.0f;
+static bool bootBtnWokeDisplay = false;
 static float lastRawAx = 0.0f;
 static float lastRawAy = 0.0f;
 static float lastRawAz = 0.0f;
@@ -173,12 +220,19 @@ static float lastCorrGy = 0.0f;
 static QMI8658_Data lastSensorData = {};
 static bool lastSensorDataValid = false;
 static bool rawStreamEnabled = false;
+// Binary telemetry ('b'): one COBS frame per fused sample, replaces the text
+// streams while on. Frames that do not fit the serial log ring are dropped,
+// never waited for; the host sees the gap in seq.
+static bool binaryStreamEnabled = false;
+static uint32_t binaryStreamSeq = 0;
+static uint32_t binaryStreamFrames = 0;
+static uint32_t binaryStreamDropped = 0;
 static unsigned long rawStreamLastMs = 0;
 static unsigned long liveStreamLastMs = 0;
 static float rollConditionPct = 100.0f;
 static bool rollConditionLowFlag = false;
 static bool serialOutputPaused = false;
-static BatteryTelemetry batteryTelemetry = {false, 0.0f, 0.0f, false, false, true, false};
+static BatteryTelemetry batteryTelemetry = {false, 0.0f, 0.0f, false, false, true, false, 0.0f, 0.0f, 0.0f};
 static bool batteryTelemetryInitialized = false;
 static float batteryFilteredVoltage = 0.0f;
 static float batteryTrendAnchorVoltage = 0.0f;
@@ -206,11 +260,22 @@ static const float batteryNoBatteryMinVoltageV = 4.14f;
 static const float batteryNoBatteryPlateauDeltaV = 0.0035f;
 static const float batteryPresenceRecoverDeltaV = 0.010f;
 static BatteryPresenceMode batteryPresenceMode = BATTERY_PRESENCE_AUTO;
-// Calibrated against DMM at full charge so UI reads 4.2 V at top-of-charge.
+// Raw 12-bit counts scaled by 3.3 V full range and the 1:2 divider.
+// Calibrated against DMM at full charge so UI reads 4.2 V at top-of-charge;
+// the presence/plateau thresholds above are tuned on this conversion.
+static const float batteryDividerRatio = 2.0f;
 static const float batteryVoltageScaleCal = 1.0550f;
+// Conversions averaged per 250 ms sample (a few tens of microseconds each).
+static const uint8_t batteryAdcOversample = 16;
 static const unsigned long deepSleepPreEntryDelayMs = 20;
 static const unsigned long deepSleepSerialFlushDelayMs = 60;
+static const uint32_t deepSleepLogFlushTimeoutMs = 250;  // drain the serial log ring
 static const unsigned long touchWakeInitDelayMs = 160;
+// Wake-on-motion: accel-only low-power mode, any axis change above the
+// threshold toggles the INT line. Picking the unit up is well above 100 mg.
+static const uint8_t imuWakeThresholdMg = 100;
+static const uint8_t imuWakeBlankingSamples = 4;  // ignore the first samples after arming
+static const unsigned long imuWakeCmdTimeoutMs = 20;
 
 static DisplayPrecisionMode sanitize_display_precision(uint8_t raw) {
   switch (raw) {
@@ -226,6 +291,32 @@ static uint8_t sanitize_display_brightness(uint8_t raw) {
   return raw;
 }
 
+static uint8_t sanitize_display_target_fps(uint8_t raw) {
+  if (raw == 0xFF || raw == 0) return 30;
+  if (raw > 60) return 60;
+  if (raw < 10) return 10;
+  return raw;
+}
+
+// Idle timeouts are stored in 10 s units; 0 disables the step, 0xFF is unset.
+static uint16_t decode_display_idle_timeout(uint8_t raw, uint16_t fallback_sec) {
+  if (raw == 0xFF) return fallback_sec;
+  return (uint16_t)raw * 10U;
+}
+
+static uint8_t encode_display_idle_timeout(uint16_t sec) {
+  const uint16_t units = (uint16_t)((sec + 5U) / 10U);
+  return (uint8_t)((units > 254U) ? 254U : units);
+}
+
+// Auto-sleep is stored in minutes; anything below a minute rounds up to one.
+static uint8_t encode_auto_sleep_timeout(uint16_t sec) {
+  if (sec == 0) return 0;
+  const uint16_t minutes = (uint16_t)((sec + 30U) / 60U);
+  if (minutes == 0) return 1;
+  return (uint8_t)((minutes > 254U) ? 254U : minutes);
+}
+
 enum AlignmentStep {
   ALIGN_SCREEN_UP = 0,
   ALIGN_SCREEN_DOWN,
@@ -284,12 +375,17 @@ void saveBiasOffsetsToEeprom(OrientationMode mode);
 bool loadZeroReferenceFromEeprom(OrientationMode mode);
 void saveZeroReferenceToEeprom(OrientationMode mode);
 void printMode();
-void printRawImuSample(const QMI8658_Data &d, float ax, float ay, float az, float gx, float gy);
+bool readImuSample(QMI8658_Data &d);
+void printRawImuSample(const QMI8658_Data &d, float ax, float ay, float az, float gx, float gy,
+                       Print &out = SerialLog);
+void serialPrintFixed(float value, uint8_t decimals, Print &out = SerialLog);
+void serialPrintlnFixed(float value, uint8_t decimals);
 void printSerialHelp();
 void printRuntimeStatus();
 void serialContextAction();
 void pauseSerialOutputUntilResume();
 void resumeSerialOutput();
+void processUiCommands();
 void handleSerial();
 const char *alignmentStepText(AlignmentStep step);
 const char *alignmentStepHintText(AlignmentStep step);
@@ -302,12 +398,12 @@ void processZeroWorkflow();
 void beginZeroWorkflow(bool auto_confirm, const char *context);
 const char *sleepWakeCauseText(esp_sleep_wakeup_cause_t cause);
 void enterDeepSleep();
+static void captureResumeState();
 void offsetCalibrationWorkflowStart();
 void offsetCalibrationWorkflowConfirm();
 void offsetCalibrationWorkflowCancel();
 void initBatteryTelemetry();
 void updateBatteryTelemetry(unsigned long now_ms);
-float batterySocFromVoltage(float voltage_v);
 
 // ============================================================
 // AXIS REMAPPING  (FROZEN v4.0 BEHAVIOR)
@@ -343,39 +439,6 @@ void remapGyro(const QMI8658_Data& d, float& gx, float& gy) {
   }
 }
 
-float batterySocFromVoltage(float voltage_v) {
-  struct Point {
-    float v;
-    float soc;
-  };
-  static const Point curve[] = {
-    {3.30f, 0.0f},
-    {3.40f, 3.0f},
-    {3.50f, 8.0f},
-    {3.60f, 15.0f},
-    {3.70f, 28.0f},
-    {3.80f, 45.0f},
-    {3.90f, 62.0f},
-    {4.00f, 78.0f},
-    {4.10f, 90.0f},
-    {4.20f, 100.0f}
-  };
-
-  if (voltage_v <= curve[0].v) return curve[0].soc;
-  const int last = (int)(sizeof(curve) / sizeof(curve[0])) - 1;
-  if (voltage_v >= curve[last].v) return curve[last].soc;
-
-  for (int i = 1; i <= last; ++i) {
-    if (voltage_v <= curve[i].v) {
-      const float dv = curve[i].v - curve[i - 1].v;
-      if (dv <= 0.0f) return curve[i].soc;
-      const float t = (voltage_v - curve[i - 1].v) / dv;
-      return curve[i - 1].soc + t * (curve[i].soc - curve[i - 1].soc);
-    }
-  }
-  return 0.0f;
-}
-
 void initBatteryTelemetry() {
   pinMode(BATTERY_ADC_PIN, INPUT);
   analogReadResolution(12);
@@ -384,7 +447,7 @@ void initBatteryTelemetry() {
 #elif defined(ADC_ATTEN_DB_12)
   analogSetPinAttenuation(BATTERY_ADC_PIN, ADC_ATTEN_DB_12);
 #endif
-  batteryTelemetry = {false, 0.0f, 0.0f, false, false, true, false};
+  batteryTelemetry = {false, 0.0f, 0.0f, false, false, true, false, 0.0f, 0.0f, 0.0f};
   batteryTelemetryInitialized = false;
   batteryFilteredVoltage = 0.0f;
   batteryTrendAnchorVoltage = 0.0f;
@@ -403,13 +466,16 @@ void updateBatteryTelemetry(unsigned long now_ms) {
   if ((now_ms - batteryLastSampleMs) < batterySampleIntervalMs) return;
   batteryLastSampleMs = now_ms;
 
-  const int raw = analogRead(BATTERY_ADC_PIN);
-  if (raw < 8 || raw > 4095) {
+  uint32_t raw_sum = 0;
+  for (uint8_t i = 0; i < batteryAdcOversample; ++i) {
+    raw_sum += (uint32_t)analogRead(BATTERY_ADC_PIN);
+  }
+  const float raw = (float)raw_sum / (float)batteryAdcOversample;
+  if (raw < 8.0f || raw > 4095.0f) {
     return;
   }
 
-  // ADC+divider estimate is calibrated against DMM reference.
-  const float raw_voltage = ((float)raw * 3.3f / 4095.0f) * 2.0f * batteryVoltageScaleCal;
+  const float raw_voltage = (raw * 3.3f / 4095.0f) * batteryDividerRatio * batteryVoltageScaleCal;
   if (!batteryTelemetryInitialized) {
     batteryTelemetryInitialized = true;
     batteryFilteredVoltage = raw_voltage;
@@ -422,7 +488,6 @@ void updateBatteryTelemetry(unsigned long now_ms) {
 
   batteryTelemetry.valid = true;
   batteryTelemetry.voltage_v = batteryFilteredVoltage;
-  batteryTelemetry.soc_percent = batterySocFromVoltage(batteryFilteredVoltage);
 
   if ((now_ms - batteryTrendAnchorMs) >= batteryTrendWindowMs) {
     const float delta_v = batteryFilteredVoltage - batteryTrendAnchorVoltage;
@@ -494,6 +559,107 @@ void updateBatteryTelemetry(unsigned long now_ms) {
   if (!batteryTelemetry.present) {
     batteryTelemetry.charging = false;
   }
+
+  // Load-compensated SOC: the power model knows what the panel, radio and
+  // CPU draw right now, which is what the cell voltage is sagging under.
+  PowerStats pm = {};
+  power_manager_get_stats(&pm);
+  const float load_ma = (batteryTelemetry.present && !batteryTelemetry.charging) ? pm.est_ma : 0.0f;
+  batteryTelemetry.load_ma = load_ma;
+  batteryTelemetry.ocv_v = battery_model_ocv(batteryFilteredVoltage, load_ma);
+  batteryTelemetry.soc_percent = battery_model_soc_from_ocv(batteryTelemetry.ocv_v);
+  batteryTelemetry.tte_h =
+    battery_model_time_to_empty_h(batteryTelemetry.soc_percent, BATTERY_CAPACITY_MAH, load_ma);
+}
+
+// ============================================================
+// IMU WAKE-ON-MOTION
+// ============================================================
+//
+// Raw QMI8658 register access (the driver library has no WoM support). The
+// caller holds the I2C bus for the IMU. Sequence per datasheet: sensors off,
+// accel in low-power ODR, threshold + INT select into CAL1, CTRL9 "write WoM
+// setting" command, INT enable, accel on. A threshold of 0 disables WoM.
+
+static const uint8_t QMI_REG_CTRL1 = 0x02;
+static const uint8_t QMI_REG_CTRL2 = 0x03;
+static const uint8_t QMI_REG_CTRL7 = 0x08;
+static const uint8_t QMI_REG_CTRL9 = 0x0A;
+static const uint8_t QMI_REG_CAL1_L = 0x0B;
+static const uint8_t QMI_REG_CAL1_H = 0x0C;
+static const uint8_t QMI_REG_STATUSINT = 0x2D;
+static const uint8_t QMI_CTRL9_CMD_ACK = 0x00;
+static const uint8_t QMI_CTRL9_CMD_WRITE_WOM = 0x08;
+static const uint8_t QMI_STATUSINT_CMD_DONE = 0x80;
+static const uint8_t QMI_CTRL2_ACC_2G_LP_21HZ = 0x0D;
+static const uint8_t QMI_CTRL7_ACC_EN = 0x01;
+// CAL1_H[7:6]: INT line and its level before the first event. Start high so
+// motion pulls the line low, the same level the ACTION button wakes on.
+static const uint8_t QMI_CAL1H_INT_HIGH = (IMU_WAKE_INT_LINE == 2) ? 0xC0 : 0x40;
+static const uint8_t QMI_CTRL1_INT_EN = (IMU_WAKE_INT_LINE == 2) ? 0x10 : 0x08;
+
+static bool imuWriteReg(uint8_t reg, uint8_t value) {
+  Wire.beginTransmission(QMI8658_ADDRESS_HIGH);
+  Wire.write(reg);
+  Wire.write(value);
+  return Wire.endTransmission() == 0;
+}
+
+static bool imuReadReg(uint8_t reg, uint8_t *value) {
+  Wire.beginTransmission(QMI8658_ADDRESS_HIGH);
+  Wire.write(reg);
+  if (Wire.endTransmission(false) != 0) return false;
+  if (Wire.requestFrom((uint8_t)QMI8658_ADDRESS_HIGH, (uint8_t)1) != 1) return false;
+  *value = (uint8_t)Wire.read();
+  return true;
+}
+
+static bool imuWriteWomSetting(uint8_t thresholdMg, uint8_t cal1High) {
+  if (!imuWriteReg(QMI_REG_CAL1_L, thresholdMg) ||
+      !imuWriteReg(QMI_REG_CAL1_H, cal1High) ||
+      !imuWriteReg(QMI_REG_CTRL9, QMI_CTRL9_CMD_WRITE_WOM)) {
+    return false;
+  }
+  const unsigned long start = millis();
+  uint8_t status = 0;
+  while (!(imuReadReg(QMI_REG_STATUSINT, &status) && (status & QMI_STATUSINT_CMD_DONE))) {
+    if (millis() - start >= imuWakeCmdTimeoutMs) return false;
+    delay(1);
+  }
+  return imuWriteReg(QMI_REG_CTRL9, QMI_CTRL9_CMD_ACK);
+}
+
+#if IMU_WAKE_INT_PIN >= 0
+static const uint64_t imuWakePinMask = 1ULL << IMU_WAKE_INT_PIN;
+#else
+static const uint64_t imuWakePinMask = 0;
+#endif
+
+static bool imuWakeOnMotionAvailable() {
+#if IMU_WAKE_INT_PIN >= 0
+  return rtc_gpio_is_valid_gpio((gpio_num_t)IMU_WAKE_INT_PIN);
+#else
+  return false;
+#endif
+}
+
+static bool imuArmWakeOnMotion() {
+  uint8_t ctrl1 = 0;
+  return imuWriteReg(QMI_REG_CTRL7, 0x00) &&
+         imuWriteReg(QMI_REG_CTRL2, QMI_CTRL2_ACC_2G_LP_21HZ) &&
+         imuWriteWomSetting(imuWakeThresholdMg, QMI_CAL1H_INT_HIGH | imuWakeBlankingSamples) &&
+         imuReadReg(QMI_REG_CTRL1, &ctrl1) &&
+         imuWriteReg(QMI_REG_CTRL1, ctrl1 | QMI_CTRL1_INT_EN) &&
+         imuWriteReg(QMI_REG_CTRL7, QMI_CTRL7_ACC_EN);
+}
+
+// WoM survives the ESP32 reset; clear it before the normal IMU setup.
+static bool imuDisarmWakeOnMotion() {
+  uint8_t ctrl1 = 0;
+  return imuWriteReg(QMI_REG_CTRL7, 0x00) &&
+         imuWriteWomSetting(0, 0) &&
+         imuReadReg(QMI_REG_CTRL1, &ctrl1) &&
+         imuWriteReg(QMI_REG_CTRL1, ctrl1 & (uint8_t)~QMI_CTRL1_INT_EN);
 }
 
 static void waitForActionReleaseStable(void) {
@@ -515,35 +681,55 @@ void enterDeepSleep() {
 
   // Graceful subsystem shutdown before entering deep sleep.
   prepare_remote_for_deep_sleep();
-  if (!imu.enableSensors(QMI8658_DISABLE_ALL)) {
-    Serial.println("IMU shutdown warning: failed to disable sensors");
+  // Park the LVGL task first: it polls touch over the shared I2C bus.
+  displayPrepareForDeepSleep();
+  const bool bus_held = i2c_bus_acquire(I2C_DEV_IMU, I2C_BUS_WAIT_MS);
+  // Wake-on-motion keeps only the accelerometer running in low-power mode.
+  bool wom_armed = imuWakeOnMotionAvailable() && imuArmWakeOnMotion();
+  const bool imu_off = wom_armed || imu.enableSensors(QMI8658_DISABLE_ALL);
+  if (bus_held) i2c_bus_release(I2C_DEV_IMU, imu_off ? I2C_BUS_OK : I2C_BUS_ERR_OTHER);
+  if (imuWakeOnMotionAvailable() && !wom_armed) {
+    SerialLogWarn.println("IMU wake-on-motion setup failed, ACTION wake only");
+  }
+  if (!imu_off) {
+    SerialLogWarn.println("IMU shutdown warning: failed to disable sensors");
   }
   if (!Touch_Sleep()) {
-    Serial.println("Touch shutdown warning: sleep command failed");
+    SerialLogWarn.println("Touch shutdown warning: sleep command failed");
   }
-  Wire.end();
-  displayPrepareForDeepSleep();
+  i2c_bus_end();
   delay(deepSleepPreEntryDelayMs);
 
   esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
   esp_err_t wakeErr = ESP_OK;
+  // The IMU line idles high and drops on motion, so it shares EXT1 ANY_LOW
+  // with the button (EXT1 mode) or sits next to the EXT0 button wake.
+  const uint64_t imuWakeMask = wom_armed ? imuWakePinMask : 0;
+  if (wom_armed) {
+    rtc_gpio_init((gpio_num_t)IMU_WAKE_INT_PIN);
+    rtc_gpio_set_direction((gpio_num_t)IMU_WAKE_INT_PIN, RTC_GPIO_MODE_INPUT_ONLY);
+    rtc_gpio_pullup_en((gpio_num_t)IMU_WAKE_INT_PIN);
+    rtc_gpio_pulldown_dis((gpio_num_t)IMU_WAKE_INT_PIN);
+  }
   if (deepSleepUseExt1Wake) {
     pinMode(BOOT_BUTTON_PIN, INPUT_PULLUP);
-    const uint64_t wakeMask = (1ULL << BOOT_BUTTON_PIN);
+    const uint64_t wakeMask = (1ULL << BOOT_BUTTON_PIN) | imuWakeMask;
     wakeErr = esp_sleep_enable_ext1_wakeup(wakeMask, ESP_EXT1_WAKEUP_ANY_LOW);
     if (wakeErr == ESP_OK) {
       const esp_err_t pdErr = esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_PERIPH, ESP_PD_OPTION_OFF);
       if (pdErr == ESP_OK) {
-        Serial.println("Deep sleep wake: EXT1 ANY_LOW on GPIO0, RTC_PERIPH=OFF");
+        SerialLog.println(wom_armed
+          ? "Deep sleep wake: EXT1 ANY_LOW on GPIO0 + IMU INT, RTC_PERIPH=OFF"
+          : "Deep sleep wake: EXT1 ANY_LOW on GPIO0, RTC_PERIPH=OFF");
       } else {
-        Serial.print("RTC_PERIPH OFF request failed (");
-        Serial.print((int)pdErr);
-        Serial.println("), using default power domain policy");
+        SerialLog.print("RTC_PERIPH OFF request failed (");
+        SerialLog.print((int)pdErr);
+        SerialLog.println("), using default power domain policy");
       }
     } else {
-      Serial.print("ext1 wake setup failed (");
-      Serial.print((int)wakeErr);
-      Serial.println("), falling back to ext0 wake");
+      SerialLog.print("ext1 wake setup failed (");
+      SerialLog.print((int)wakeErr);
+      SerialLog.println("), falling back to ext0 wake");
     }
   }
 
@@ -554,49 +740,152 @@ void enterDeepSleep() {
     rtc_gpio_pulldown_dis((gpio_num_t)BOOT_BUTTON_PIN);
     wakeErr = esp_sleep_enable_ext0_wakeup((gpio_num_t)BOOT_BUTTON_PIN, 0);
     if (wakeErr == ESP_OK) {
-      Serial.println("Deep sleep wake: EXT0 LOW on GPIO0");
+      SerialLog.println("Deep sleep wake: EXT0 LOW on GPIO0");
     } else {
-      Serial.print("ext0 wake setup failed (");
-      Serial.print((int)wakeErr);
-      Serial.println("), enabling 30 s timer fallback");
+      SerialLog.print("ext0 wake setup failed (");
+      SerialLog.print((int)wakeErr);
+      SerialLog.println("), enabling 30 s timer fallback");
       esp_sleep_enable_timer_wakeup(30ULL * 1000000ULL);
     }
+    if (wom_armed) {
+      const esp_err_t imuErr = esp_sleep_enable_ext1_wakeup(imuWakeMask, ESP_EXT1_WAKEUP_ANY_LOW);
+      if (imuErr == ESP_OK) {
+        SerialLog.print("Deep sleep wake: EXT1 LOW on GPIO");
+        SerialLog.print(IMU_WAKE_INT_PIN);
+        SerialLog.println(" (IMU motion)");
+      } else {
+        SerialLog.print("IMU wake setup failed (");
+        SerialLog.print((int)imuErr);
+        SerialLog.println("), ACTION wake only");
+        wom_armed = false;
+      }
+    }
   }
 
+  captureResumeState();
   waitForActionReleaseStable();
-  Serial.println("Entering deep sleep. Press ACTION (GPIO0) to wake.");
-  Serial.flush();
+  SerialLog.println(wom_armed
+    ? "Entering deep sleep. Press ACTION (GPIO0) or move the unit to wake."
+    : "Entering deep sleep. Press ACTION (GPIO0) to wake.");
+  serial_log_flush(deepSleepLogFlushTimeoutMs);
   delay(deepSleepSerialFlushDelayMs);
   esp_deep_sleep_start();
 }
 
 // ============================================================
-// SETUP
+// FAST RESUME (RTC slow memory)
 // ============================================================
+//
+// Sealed right before our own deep sleep; survives the sleep but not a power
+// cycle. Any other reset (panic, watchdog, OTA) invalidates it so a crash
+// never resumes from state it may have corrupted.
+
+RTC_DATA_ATTR static ResumeState rtcResume;
+static bool fastResume = false;
+static bool resumeFirstSamplePending = false;
+// A restored angle this far from the first accelerometer reading means the
+// unit was moved while asleep; start again from the accelerometer.
+static const float resumeReseedThreshDeg = 3.0f;
+
+static void captureResumeState() {
+  const uint32_t fwHash = resume_state_fw_hash(FW_VERSION);
+  const uint32_t sleeps = resume_state_valid(rtcResume, fwHash) ? rtcResume.sleep_count : 0;
+  ResumeState st;
+  memset(&st, 0, sizeof(st));
+  st.sleep_count = sleeps + 1;
+  st.roll_phys = roll_phys;
+  st.pitch_phys = pitch_phys;
+  st.ax_off = ax_off;
+  st.ay_off = ay_off;
+  st.az_off = az_off;
+  st.gx_off = gx_off;
+  st.gy_off = gy_off;
+  st.roll_zero = roll_zero;
+  st.pitch_zero = pitch_zero;
+  st.align_roll = align_roll;
+  st.align_pitch = align_pitch;
+  st.orientation_mode = (uint8_t)orientationMode;
+  st.display_rotated = displayRotated ? 1 : 0;
+  st.axis_mode = (uint8_t)ui_axis_mode;
+  st.touch_ui_layout = (uint8_t)touchUiLayoutMode;
+  st.auto_zero_on_boot = autoZeroOnBootEnabled ? 1 : 0;
+  st.display_precision = (uint8_t)displayPrecisionMode;
+  st.display_brightness_percent = displayBrightnessPercent;
+  st.display_target_fps = displayTargetFps;
+  st.touch_enabled = touchInputEnabled ? 1 : 0;
+  st.touch_persist = touchLockPersistent ? 1 : 0;
+  st.auto_sleep_min = (uint8_t)autoSleepTimeoutMin;
+  st.display_dim_s = displayDimTimeoutSec;
+  st.display_blank_s = displayBlankTimeoutSec;
+  resume_state_seal(&st, fwHash);
+  rtcResume = st;
+}
+
+static void applyResumeState() {
+  const ResumeState &st = rtcResume;
+  orientationMode = (st.orientation_mode == (uint8_t)MODE_SCREEN_VERTICAL) ? MODE_SCREEN_VERTICAL : MODE_SCREEN_UP;
+  displayRotated = st.display_rotated != 0;
+  ui_axis_mode = (st.axis_mode <= (uint8_t)AXIS_PITCH) ? (AxisDisplayMode)st.axis_mode : AXIS_BOTH;
+  touchUiLayoutMode = (st.touch_ui_layout == (uint8_t)TOUCH_UI_SIMPLE) ? TOUCH_UI_SIMPLE : TOUCH_UI_ADVANCED;
+  autoZeroOnBootEnabled = st.auto_zero_on_boot != 0;
+  displayPrecisionMode = sanitize_display_precision(st.display_precision);
+  displayBrightnessPercent = sanitize_display_brightness(st.display_brightness_percent);
+  displayTargetFps = sanitize_display_target_fps(st.display_target_fps);
+  displayDimTimeoutSec = st.display_dim_s;
+  displayBlankTimeoutSec = st.display_blank_s;
+  autoSleepTimeoutMin = st.auto_sleep_min;
+  touchInputEnabled = st.touch_enabled != 0;
+  touchLockPersistent = st.touch_persist != 0;
+  ax_off = st.ax_off;
+  ay_off = st.ay_off;
+  az_off = st.az_off;
+  gx_off = st.gx_off;
+  gy_off = st.gy_off;
+  roll_zero = st.roll_zero;
+  pitch_zero = st.pitch_zero;
+  align_roll = st.align_roll;
+  align_pitch = st.align_pitch;
+  roll_phys = st.roll_phys;
+  pitch_phys = st.pitch_phys;
+}
+
+// Apply mechanical alignment and user zero reference, then the DISPLAY-ONLY
+// semantic roll correction (kept separate from alignment and physics).
+static void physicsToDisplayAngles(float rollPhys, float pitchPhys, float *r, float *p) {
+  *r = rollPhys  + align_roll  - roll_zero;
+  *p = pitchPhys + align_pitch - pitch_zero;
+  if (orientationMode == MODE_SCREEN_UP)
+    *r = -*r;
+}
 
-void setup_inclinometer() {
-  Serial.begin(115200);
-  const esp_sleep_wakeup_cause_t wakeCause = esp_sleep_get_wakeup_cause();
-
-  unsigned long t0 = millis();
-  while (!Serial && millis() - t0 < 200) {
-    delay(5);
+// Keep the restored fusion state unless the first accelerometer reading
+// says the unit moved while asleep.
+static void reconcileResumedAngles() {
+  QMI8658_Data d;
+  if (!readImuSample(d)) return;
+  float ax, ay, az;
+  remapAccel(d, ax, ay, az);
+  ax -= ax_off; ay -= ay_off; az -= az_off;
+  const float roll_acc = atan2(ay, az) * RAD_TO_DEG;
+  const float pitch_acc = atan2(-ax, sqrt(ay * ay + az * az)) * RAD_TO_DEG;
+  if (fabsf(roll_acc - roll_phys) > resumeReseedThreshDeg ||
+      fabsf(pitch_acc - pitch_phys) > resumeReseedThreshDeg) {
+    roll_phys = roll_acc;
+    pitch_phys = pitch_acc;
+    SerialLog.println("Resume: moved while asleep, angles re-seeded from accelerometer");
   }
+}
 
-  Wire.begin(SDA_PIN, SCL_PIN);
-  if (wakeCause == ESP_SLEEP_WAKEUP_EXT0 ||
-      wakeCause == ESP_SLEEP_WAKEUP_EXT1 ||
-      wakeCause == ESP_SLEEP_WAKEUP_GPIO) {
-    // Give touch controller time to exit deep-sleep power state before init.
-    delay(touchWakeInitDelayMs);
-  }
-  // Re-init touch after shared I2C bus setup to ensure touch recovers post-wake.
-  Touch_Init();
-  pinMode(BOOT_BUTTON_PIN, INPUT_PULLUP);
-  EEPROM.begin(EEPROM_SIZE);
-  initBatteryTelemetry();
+bool fastResumeActive(void) {
+  return fastResume;
+}
 
-  // Restore persisted state
+// ============================================================
+// SETUP
+// ============================================================
+
+// Persisted settings (cold boot; a fast resume takes them from RTC memory).
+static void loadSettingsFromEeprom() {
   orientationMode = (OrientationMode)EEPROM.read(EEPROM_ADDR_MODE);
   if (orientationMode > MODE_SCREEN_VERTICAL)
     orientationMode = MODE_SCREEN_UP;
@@ -610,24 +899,71 @@ void setup_inclinometer() {
   const uint8_t brightness_raw = EEPROM.read(EEPROM_ADDR_DISPLAY_BRIGHTNESS);
   const uint8_t touch_enabled_raw = EEPROM.read(EEPROM_ADDR_TOUCH_ENABLED);
   const uint8_t touch_persist_raw = EEPROM.read(EEPROM_ADDR_TOUCH_PERSIST);
+  const uint8_t target_fps_raw = EEPROM.read(EEPROM_ADDR_DISPLAY_TARGET_FPS);
+  const uint8_t dim_timeout_raw = EEPROM.read(EEPROM_ADDR_DISPLAY_DIM_TIMEOUT);
+  const uint8_t blank_timeout_raw = EEPROM.read(EEPROM_ADDR_DISPLAY_BLANK_TIMEOUT);
+  const uint8_t auto_sleep_raw = EEPROM.read(EEPROM_ADDR_AUTO_SLEEP_TIMEOUT);
   autoZeroOnBootEnabled = (auto_zero_raw != 0);
   displayPrecisionMode = sanitize_display_precision(precision_raw);
   displayBrightnessPercent = sanitize_display_brightness((brightness_raw == 0xFF || brightness_raw == 0) ? 100 : brightness_raw);
+  displayTargetFps = sanitize_display_target_fps(target_fps_raw);
+  displayDimTimeoutSec = decode_display_idle_timeout(dim_timeout_raw, 60);
+  displayBlankTimeoutSec = decode_display_idle_timeout(blank_timeout_raw, 0);
+  // Unset: auto-sleep only when motion can wake the unit again; otherwise a
+  // static measurement on battery would end in a sleep only ACTION wakes.
+  autoSleepTimeoutMin = (auto_sleep_raw == 0xFF) ? (imuWakeOnMotionAvailable() ? 10 : 0) : auto_sleep_raw;
   touchLockPersistent = (touch_persist_raw != 0 && touch_persist_raw != 0xFF);
   touchInputEnabled = touchLockPersistent ? (touch_enabled_raw != 0) : true;
   EEPROM.get(EEPROM_ADDR_ALIGN,     align_roll);
   EEPROM.get(EEPROM_ADDR_ALIGN + 4, align_pitch);
+}
+
+// Boot phase 1: everything the splash and the network task need (settings,
+// rotation, brightness). No wait for a USB-CDC host; `s` prints the boot
+// timeline later.
+void setup_inclinometer() {
+  bootStageBegin(BOOT_STAGE_SETTINGS);
+  Serial.begin(115200);
+  serial_log_begin();
+  PERF_REGISTER_TASK("loopTask");
+  fastResume = (esp_reset_reason() == ESP_RST_DEEPSLEEP) &&
+               resume_state_valid(rtcResume, resume_state_fw_hash(FW_VERSION));
+  if (!fastResume) resume_state_invalidate(&rtcResume);
+
+  i2c_bus_begin();
+  pinMode(BOOT_BUTTON_PIN, INPUT_PULLUP);
+  EEPROM.begin(EEPROM_SIZE);
+  initBatteryTelemetry();
 
-  Serial.print("\nQMI8658 Inclinometer FW ");
-  Serial.println(FW_VERSION);
-  Serial.println("ACTION button mapped to GPIO0 (BOOT, active-low)");
+  if (fastResume) {
+    applyResumeState();
+  } else {
+    loadSettingsFromEeprom();
+  }
+  bootStageEnd(BOOT_STAGE_SETTINGS);
+}
+
+// Boot phase 2: IMU bring-up, calibration and touch, while the splash is up
+// and the network task starts Wi-Fi.
+void setup_inclinometer_sensors() {
+  const esp_sleep_wakeup_cause_t wakeCause = esp_sleep_get_wakeup_cause();
+
+  SerialLog.print("\nQMI8658 Inclinometer FW ");
+  SerialLog.println(FW_VERSION);
+  SerialLog.println("ACTION button mapped to GPIO0 (BOOT, active-low)");
   if (wakeCause != ESP_SLEEP_WAKEUP_UNDEFINED) {
-    Serial.print("Wake cause: ");
-    Serial.println(sleepWakeCauseText(wakeCause));
+    SerialLog.print("Wake cause: ");
+    SerialLog.println(sleepWakeCauseText(wakeCause));
   }
 
   // IMU configuration (kept intentionally conservative)
+  bootStageBegin(BOOT_STAGE_IMU);
+  const bool bus_held = i2c_bus_acquire(I2C_DEV_IMU, I2C_BUS_WAIT_MS);
   imu.begin(Wire, QMI8658_ADDRESS_HIGH);
+  if (wakeCause != ESP_SLEEP_WAKEUP_UNDEFINED && imuWakeOnMotionAvailable() &&
+      !imuDisarmWakeOnMotion()) {
+    SerialLogWarn.println("IMU wake-on-motion disarm failed");
+  }
   imu.setAccelRange(QMI8658_ACCEL_RANGE_2G);
   imu.setAccelODR(QMI8658_ACCEL_ODR_125HZ);
   imu.setAccelUnit_mps2(true);
@@ -638,21 +974,53 @@ void setup_inclinometer() {
 
   imu.enableAccel();
   imu.enableGyro();
-
-  // Initial calibration and zeroing
-  if (!loadBiasOffsetsFromEeprom(orientationMode)) {
-    calibrateOffsets();
-    saveBiasOffsetsToEeprom(orientationMode);
+  if (bus_held) i2c_bus_release(I2C_DEV_IMU, I2C_BUS_OK);
+  bootStageEnd(BOOT_STAGE_IMU);
+
+  bootStageBegin(BOOT_STAGE_CALIBRATION);
+  if (fastResume) {
+    // Calibration and fusion state came from RTC memory.
+    reconcileResumedAngles();
+    float r, p;
+    physicsToDisplayAngles(roll_phys, pitch_phys, &r, &p);
+    setUiAngles(r, p, 0);
+    resumeFirstSamplePending = true;
+    SerialLog.print("Resume: state restored from RTC memory (sleep #");
+    SerialLog.print((unsigned long)rtcResume.sleep_count);
+    SerialLog.print("), setup ");
+    SerialLog.print((unsigned long)millis());
+    SerialLog.println(" ms after wake");
   } else {
-    Serial.println("Loaded bias offsets from EEPROM");
+    // Initial calibration and zeroing
+    if (!loadBiasOffsetsFromEeprom(orientationMode)) {
+      calibrateOffsets();
+      saveBiasOffsetsToEeprom(orientationMode);
+    } else {
+      SerialLog.println("Loaded bias offsets from EEPROM");
+    }
+    if (!loadZeroReferenceFromEeprom(orientationMode)) {
+      roll_zero = 0.0f;
+      pitch_zero = 0.0f;
+    } else {
+      SerialLog.println("Loaded zero reference from EEPROM");
+    }
+    initializeAngles();
   }
-  if (!loadZeroReferenceFromEeprom(orientationMode)) {
-    roll_zero = 0.0f;
-    pitch_zero = 0.0f;
-  } else {
-    Serial.println("Loaded zero reference from EEPROM");
+  bootStageEnd(BOOT_STAGE_CALIBRATION);
+
+  bootStageBegin(BOOT_STAGE_TOUCH);
+  if (wakeCause == ESP_SLEEP_WAKEUP_EXT0 ||
+      wakeCause == ESP_SLEEP_WAKEUP_EXT1 ||
+      wakeCause == ESP_SLEEP_WAKEUP_GPIO) {
+    // Give touch controller time to exit deep-sleep power state before init;
+    // the IMU bring-up above already used part of it.
+    while (millis() < touchWakeInitDelayMs) {
+      delay(1);
+    }
   }
-  initializeAngles();
+  // Re-init touch after shared I2C bus setup to ensure touch recovers post-wake.
+  Touch_Init();
+  bootStageEnd(BOOT_STAGE_TOUCH);
 
   if (autoZeroOnBootEnabled &&
       wakeCause == ESP_SLEEP_WAKEUP_UNDEFINED &&
@@ -664,12 +1032,18 @@ void setup_inclinometer() {
   serialWasAttached = (bool)Serial;
 
   lastTime = millis();
+  uiSensorsReadyFlag = true;
 }
 
 const char *sleepWakeCauseText(esp_sleep_wakeup_cause_t cause) {
   switch (cause) {
     case ESP_SLEEP_WAKEUP_EXT0: return "EXT0 (ACTION button)";
-    case ESP_SLEEP_WAKEUP_EXT1: return "EXT1";
+    case ESP_SLEEP_WAKEUP_EXT1: {
+      const uint64_t pins = esp_sleep_get_ext1_wakeup_status();
+      if (pins & imuWakePinMask) return "EXT1 (IMU motion)";
+      if (pins & (1ULL << BOOT_BUTTON_PIN)) return "EXT1 (ACTION button)";
+      return "EXT1";
+    }
     case ESP_SLEEP_WAKEUP_TIMER: return "TIMER";
     case ESP_SLEEP_WAKEUP_TOUCHPAD: return "TOUCHPAD";
     case ESP_SLEEP_WAKEUP_ULP: return "ULP";
@@ -683,7 +1057,57 @@ const char *sleepWakeCauseText(esp_sleep_wakeup_cause_t cause) {
 // MAIN LOOP
 // ============================================================
 
-void loop_inclinometer() {
+// Auto-sleep: deep sleep once nobody has touched, moved or polled the unit for
+// the configured time. Runs through the same release guard as a long ACTION
+// press. Only on battery power as reported by valid battery telemetry; skipped
+// while a workflow or OTA upload is running.
+static void updateAutoSleep(unsigned long now) {
+  if (autoSleepTimeoutMin == 0 || deepSleepPending) return;
+  const uint32_t timeoutMs = (uint32_t)autoSleepTimeoutMin * 60000UL;
+  if (displayIdleMs() < timeoutMs || remote_control_idle_ms() < timeoutMs) return;
+  if (alignmentIsActive() || modeWorkflowIsActive() || zeroPending || offsetCalPending) return;
+  if (!batteryTelemetry.valid || !batteryTelemetry.present || batteryTelemetry.charging) return;
+
+  SerialLog.print("Auto-sleep after ");
+  SerialLog.print((int)autoSleepTimeoutMin);
+  SerialLog.println(" min idle");
+  deepSleepPending = true;
+  deepSleepPendingSinceMs = now;
+}
+
+static void streamTelemetryFrame(const QMI8658_Data &d, uint32_t sampleUs, float roll, float pitch) {
+  if (!Serial) return;
+  TelemetrySample t = {};
+  t.seq = binaryStreamSeq++;
+  t.t_us = sampleUs;
+  if (freezeActive) t.flags |= TELEMETRY_FLAG_FROZEN;
+  if (orientationMode == MODE_SCREEN_VERTICAL) t.flags |= TELEMETRY_FLAG_VERTICAL;
+  if (alignmentIsActive() || modeWorkflowIsActive() || zeroPending || offsetCalPending) {
+    t.flags |= TELEMETRY_FLAG_WORKFLOW;
+  }
+  t.sens_accel[0] = d.accelX; t.sens_accel[1] = d.accelY; t.sens_accel[2] = d.accelZ;
+  t.sens_gyro[0] = d.gyroX; t.sens_gyro[1] = d.gyroY; t.sens_gyro[2] = d.gyroZ;
+  t.map_accel[0] = lastRawAx; t.map_accel[1] = lastRawAy; t.map_accel[2] = lastRawAz;
+  t.map_gyro[0] = lastRawGx; t.map_gyro[1] = lastRawGy;
+  t.corr_accel[0] = lastCorrAx; t.corr_accel[1] = lastCorrAy; t.corr_accel[2] = lastCorrAz;
+  t.corr_gyro[0] = lastCorrGx; t.corr_gyro[1] = lastCorrGy;
+  t.roll_phys = roll_phys;
+  t.pitch_phys = pitch_phys;
+  t.roll = roll;
+  t.pitch = pitch;
+
+  uint8_t frame[TELEMETRY_FRAME_MAX_BYTES];
+  const size_t n = telemetry_frame_encode(t, frame, sizeof(frame));
+  if (n == 0 || !serial_log_write_raw(frame, n)) {
+    binaryStreamDropped++;
+    return;
+  }
+  binaryStreamFrames++;
+}
+
+// One fusion pass; false when it bailed out early (no sample) and the caller
+// should poll again without pacing.
+static bool updateInclinometer() {
   // Print mode once whenever USB serial transitions from detached to attached.
   bool serialNow = (bool)Serial;
   if (serialNow && !serialWasAttached) {
@@ -692,14 +1116,24 @@ void loop_inclinometer() {
   serialWasAttached = serialNow;
 
   QMI8658_Data d;
-  if (!imu.readSensorData(d)) return;
+  bool sampled;
+  {
+    PERF_SCOPE(PERF_STAGE_IMU_READ);
+    sampled = readImuSample(d);
+  }
+  if (!sampled) {
+    PERF_COUNT(PERF_EVENT_IMU_NO_SAMPLE);
+    return false;
+  }
+  const uint32_t sampleUs = micros();
+  PERF_MARK(fusionStartUs);
   lastSensorData = d;
   lastSensorDataValid = true;
 
   // Time delta for gyro integration
   unsigned long now = millis();
   float dt = (now - lastTime) / 1000.0f;
-  if (dt <= 0) return;
+  if (dt <= 0) return false;
   lastTime = now;
 
   // Remap raw sensor data into tool frame
@@ -729,14 +1163,25 @@ void loop_inclinometer() {
   roll_phys  = alpha * (roll_phys  + gx * dt) + (1 - alpha) * roll_acc;
   pitch_phys = alpha * (pitch_phys + gy * dt) + (1 - alpha) * pitch_acc;
 
+  // Handling the unit keeps the display awake; the reference only moves on
+  // activity so a slow drift still has to exceed the threshold once.
+  if (!idleRefValid ||
+      fabsf(roll_phys - idleRefRoll) > idleMotionThreshDeg ||
+      fabsf(pitch_phys - idleRefPitch) > idleMotionThreshDeg ||
+      fabsf(gx) > idleMotionGyroDps || fabsf(gy) > idleMotionGyroDps) {
+    idleRefRoll = roll_phys;
+    idleRefPitch = pitch_phys;
+    idleRefValid = true;
+    displayNoteActivity();
+  }
+
   // Roll becomes undefined near ±90° pitch (gimbal geometry)
   // Gradually attenuate roll contribution instead of hard-clamping
   if (fabs(pitch_phys) > 80.0)
     roll_phys *= cos(fabs(pitch_phys) * DEG_TO_RAD);
 
-  // Apply mechanical alignment and user zero reference
-  float r = roll_phys  + align_roll  - roll_zero;
-  float p = pitch_phys + align_pitch - pitch_zero;
+  float r, p;
+  physicsToDisplayAngles(roll_phys, pitch_phys, &r, &p);
 
   // Roll reliability degrades near +/-90 degree pitch.
   // Expose a simple conditioning metric to remote diagnostics.
@@ -750,25 +1195,31 @@ void loop_inclinometer() {
   }
   rollConditionLowFlag = (absPitch >= 80.0f);
 
-  // DISPLAY-ONLY semantic roll correction
-  // (kept separate from alignment and physics)
-  if (orientationMode == MODE_SCREEN_UP)
-    r = -r;
-
   if (freezeActive) {
     r = freeze_roll;
     p = freeze_pitch;
   }
 
-  processZeroWorkflow();
-  processOffsetCalibrationWorkflow();
-  processAlignmentCapture();
-  updateBatteryTelemetry(now);
+  PERF_RECORD_SINCE(PERF_STAGE_FUSION, fusionStartUs);
+
+  {
+    PERF_SCOPE(PERF_STAGE_WORKFLOWS);
+    processZeroWorkflow();
+    processOffsetCalibrationWorkflow();
+    processAlignmentCapture();
+  }
+  {
+    PERF_SCOPE(PERF_STAGE_BATTERY);
+    updateBatteryTelemetry(now);
+  }
+  updateAutoSleep(now);
 
   // Output
-  if (!serialOutputPaused && rawStreamEnabled) {
+  if (binaryStreamEnabled) {
+    streamTelemetryFrame(d, sampleUs, r, p);
+  } else if (!serialOutputPaused && rawStreamEnabled) {
     if ((now - rawStreamLastMs) >= 200) { // 5 Hz debug stream
-      printRawImuSample(d, ax, ay, az, gx, gy);
+      printRawImuSample(d, ax, ay, az, gx, gy, SerialLogDebug);
       rawStreamLastMs = now;
     }
   } else if (!serialOutputPaused &&
@@ -779,30 +1230,141 @@ void loop_inclinometer() {
     if ((now - liveStreamLastMs) >= 250) { // keep the default stream readable without starving the loop
       switch (ui_axis_mode) {
         case AXIS_ROLL:
-          Serial.print("Roll: ");
-          Serial.println(r, 2);
+          SerialLog.print("Roll: ");
+          serialPrintlnFixed(r, 2);
           break;
         case AXIS_PITCH:
-          Serial.print("Pitch: ");
-          Serial.println(p, 2);
+          SerialLog.print("Pitch: ");
+          serialPrintlnFixed(p, 2);
           break;
         default:
-          Serial.print("Roll: ");
-          Serial.print(r, 2);
-          Serial.print("  Pitch: ");
-          Serial.println(p, 2);
+          SerialLog.print("Roll: ");
+          serialPrintFixed(r, 2);
+          SerialLog.print("  Pitch: ");
+          serialPrintlnFixed(p, 2);
           break;
       }
       liveStreamLastMs = now;
     }
   }
 
-  ui_roll  = r;
-  ui_pitch = p;
+  setUiAngles(r, p, freezeActive ? 0 : sampleUs);
+  uiAnglesLiveFlag = true;
+  if (resumeFirstSamplePending) {
+    resumeFirstSamplePending = false;
+    SerialLogDebug.print("Resume: first live sample ");
+    SerialLogDebug.print((unsigned long)now);
+    SerialLogDebug.println(" ms after wake");
+  }
 
-  handleSerial();
+  processUiCommands();
+  {
+    PERF_SCOPE(PERF_STAGE_SERIAL);
+    handleSerial();
+  }
   handleBootButton();
-  delay(20); // ~50 Hz output rate
+  return true;
+}
+
+void loop_inclinometer() {
+  bool paced;
+  {
+    // Full clock while fusing; released before the pacing delay so DFS /
+    // light sleep can take over between samples.
+    PowerLockScope fusionLock(POWER_LOCK_FUSION);
+    const uint32_t passStartUs = micros();
+    paced = updateInclinometer();
+    flight_log_loop_pass(FLIGHT_LOOP_SENSOR, micros() - passStartUs);
+  }
+  power_manager_update(millis());
+  if (paced) delay(20); // ~50 Hz output rate
+}
+
+// ============================================================
+// TOUCH COMMAND HANDLING
+// ============================================================
+
+void postUiCommand(UiCommand cmd) {
+  if (cmd >= UI_CMD_COUNT) return;
+  __atomic_fetch_or(&uiCommandsPending, 1UL << cmd, __ATOMIC_RELEASE);
+}
+
+static void cancelPendingWorkflows() {
+  modeWorkflowCancel();
+  zeroWorkflowCancel();
+  offsetCalibrationWorkflowCancel();
+}
+
+static void runUiCommand(UiCommand cmd) {
+  switch (cmd) {
+    case UI_CMD_ZERO_START:
+      zeroWorkflowStart();
+      break;
+    case UI_CMD_ZERO_CONFIRM:
+      if (zeroWorkflowIsActive() && !zeroWorkflowIsConfirmed()) zeroWorkflowConfirm();
+      break;
+    case UI_CMD_ZERO_CANCEL:
+      zeroWorkflowCancel();
+      break;
+    case UI_CMD_OFFSET_CAL_START:
+      modeWorkflowCancel();
+      offsetCalibrationWorkflowStart();
+      break;
+    case UI_CMD_OFFSET_CAL_CONFIRM:
+      if (offsetCalibrationWorkflowIsActive() && !offsetCalibrationWorkflowIsConfirmed()) {
+        offsetCalibrationWorkflowConfirm();
+      }
+      break;
+    case UI_CMD_OFFSET_CAL_CANCEL:
+      offsetCalibrationWorkflowCancel();
+      break;
+    case UI_CMD_MODE_TOGGLE:
+      modeWorkflowStartToggle();
+      break;
+    case UI_CMD_ORIENTATION_CYCLE:
+      cycleMode();
+      break;
+    case UI_CMD_AXIS_CYCLE:
+      cancelPendingWorkflows();
+      cycleAxisMode();
+      break;
+    case UI_CMD_ROTATE:
+      cancelPendingWorkflows();
+      toggleRotation();
+      break;
+    case UI_CMD_FREEZE_TOGGLE:
+      cancelPendingWorkflows();
+      toggleMeasurementFreeze();
+      break;
+    case UI_CMD_ALIGN_START:
+      alignmentStart();
+      break;
+    case UI_CMD_ALIGN_CAPTURE:
+      if (alignmentIsActive()) alignmentCapture();
+      break;
+    case UI_CMD_ALIGN_CANCEL:
+      alignmentCancel();
+      break;
+    case UI_CMD_LAYOUT_SIMPLE:
+      setTouchUiLayoutMode(TOUCH_UI_SIMPLE);
+      break;
+    case UI_CMD_LAYOUT_ADVANCED:
+      setTouchUiLayoutMode(TOUCH_UI_ADVANCED);
+      break;
+    default:
+      break;
+  }
+}
+
+// A tap is far slower than one loop pass, so at most one command is
+// normally pending; several are run in enum order.
+void processUiCommands() {
+  uint32_t pending = __atomic_exchange_n(&uiCommandsPending, 0, __ATOMIC_ACQUIRE);
+  for (uint8_t cmd = 0; pending != 0 && cmd < UI_CMD_COUNT; cmd++) {
+    if (!(pending & (1UL << cmd))) continue;
+    pending &= ~(1UL << cmd);
+    runUiCommand((UiCommand)cmd);
+  }
 }
 
 // ============================================================
@@ -813,6 +1375,7 @@ void handleSerial() {
   if (!Serial.available()) return;
   char c = Serial.read();
   bool shouldPause = true;
+  PERF_COUNT(PERF_EVENT_SERIAL_COMMAND);
 
   if (serialOutputPaused &&
       (c == '\r' || c == '\n' || c == ' ' || c == 'g' || c == 'G')) {
@@ -834,8 +1397,22 @@ void handleSerial() {
     case 's':
       printRuntimeStatus();
       break;
+    case 'P':
+      perf_print_report();
+      perf_reset();
+      break;
+    case 'F':
+      flight_log_print();
+      break;
+    case 'L':
+      displaySetLatencyMarker(!displayLatencyMarkerEnabled());
+      SerialLog.print("Latency marker: ");
+      SerialLog.println(displayLatencyMarkerEnabled()
+        ? "ON (top-left square flips when roll crosses 0 deg)"
+        : "OFF");
+      break;
     case 'z':
-      Serial.println("Serial 'z': start guided zero");
+      SerialLog.println("Serial 'z': start guided zero");
       zeroWorkflowStart();
       break;
     case 'c':
@@ -843,21 +1420,21 @@ void handleSerial() {
       break;
     case 'y':
       if (zeroPending && !zeroConfirmed) {
-        Serial.println("Serial 'y': CONFIRM zero workflow");
+        SerialLog.println("Serial 'y': CONFIRM zero workflow");
         zeroWorkflowConfirm();
       } else if (offsetCalPending && !offsetCalConfirmed) {
-        Serial.println("Serial 'y': CONFIRM offset calibration workflow");
+        SerialLog.println("Serial 'y': CONFIRM offset calibration workflow");
         offsetCalibrationWorkflowConfirm();
       } else {
-        Serial.println("Serial 'y': no confirmable workflow active");
+        SerialLog.println("Serial 'y': no confirmable workflow active");
       }
       break;
     case 'p':
       if (alignmentIsActive()) {
-        Serial.println("Serial 'p': CAPTURE");
+        SerialLog.println("Serial 'p': CAPTURE");
         alignmentCapture();
       } else {
-        Serial.println("Serial 'p': CAPTURE requires ALIGN");
+        SerialLog.println("Serial 'p': CAPTURE requires ALIGN");
       }
       break;
     case 'n':
@@ -879,24 +1456,50 @@ void handleSerial() {
     case 'o': offsetCalibrationWorkflowStart(); break;
     case 'a': cycleAxisMode(); break;
     case 'r': toggleRotation(); break;
+    case 'w':
+      SerialLog.println(wifiRadioIsOn() ? "Serial 'w': Wi-Fi idle timer restarted" : "Serial 'w': Wi-Fi radio on");
+      wifiRadioRequest();
+      break;
+    case 'b':
+      binaryStreamEnabled = !binaryStreamEnabled;
+      SerialLog.print("Binary telemetry: ");
+      SerialLog.println(binaryStreamEnabled ? "ON (COBS frames, every fused sample)" : "OFF");
+      if (binaryStreamEnabled) {
+        binaryStreamFrames = 0;
+        binaryStreamDropped = 0;
+      } else if (serialOutputPaused) {
+        resumeSerialOutput();
+      }
+      shouldPause = false;
+      break;
+    case 'l': {
+      const SerialLogLevel next = (SerialLogLevel)((serial_log_get_level() + 1) % SERIAL_LOG_LEVEL_COUNT);
+      serial_log_set_level(next);
+      // Printed as an error so the change is visible at every level.
+      SerialLogError.print("Log level: ");
+      SerialLogError.println(serial_log_level_name(next));
+      break;
+    }
     case 'd':
       rawStreamEnabled = !rawStreamEnabled;
       rawStreamLastMs = 0;
-      Serial.print("Raw IMU stream: ");
-      Serial.println(rawStreamEnabled ? "ON (5 Hz)" : "OFF");
+      // The stream is written at DEBUG; asking for it selects that level.
+      if (rawStreamEnabled && serial_log_get_level() < SERIAL_LOG_DEBUG) serial_log_set_level(SERIAL_LOG_DEBUG);
+      SerialLog.print("Raw IMU stream: ");
+      SerialLog.println(rawStreamEnabled ? "ON (5 Hz, log level DEBUG)" : "OFF");
       break;
     case 'D':
       if (!lastSensorDataValid) {
-        Serial.println("No IMU sample available yet");
+        SerialLog.println("No IMU sample available yet");
         break;
       } else {
         printRawImuSample(lastSensorData, lastCorrAx, lastCorrAy, lastCorrAz, lastCorrGx, lastCorrGy);
       }
       break;
     default:
-      Serial.print("Unknown command: '");
-      Serial.print(c);
-      Serial.println("' (send 'h' for help)");
+      SerialLog.print("Unknown command: '");
+      SerialLog.print(c);
+      SerialLog.println("' (send 'h' for help)");
       break;
   }
 
@@ -909,134 +1512,359 @@ void handleSerial() {
 // SERIAL HELPERS
 // ============================================================
 
+// Float fields on the serial console go through fixed_format() instead of
+// Print::print(double, digits): integer-only and printf-exact rounding.
+void serialPrintFixed(float value, uint8_t decimals, Print &out) {
+  char buf[FIXED_FORMAT_MAX_LEN];
+  fixed_format(buf, sizeof(buf), value, decimals);
+  out.print(buf);
+}
+
+void serialPrintlnFixed(float value, uint8_t decimals) {
+  serialPrintFixed(value, decimals);
+  SerialLog.println();
+}
+
 void serialContextAction() {
   if (alignmentIsActive()) {
-    Serial.println("Serial 'c': CAPTURE");
+    SerialLog.println("Serial 'c': CAPTURE");
     alignmentCapture();
   } else if (zeroPending && !zeroConfirmed) {
-    Serial.println("Serial 'c': CONFIRM zero workflow");
+    SerialLog.println("Serial 'c': CONFIRM zero workflow");
     zeroWorkflowConfirm();
   } else if (offsetCalPending && !offsetCalConfirmed) {
-    Serial.println("Serial 'c': CONFIRM offset calibration workflow");
+    SerialLog.println("Serial 'c': CONFIRM offset calibration workflow");
     offsetCalibrationWorkflowConfirm();
   } else {
-    Serial.println("Serial 'c': guided offset calibration start+confirm");
+    SerialLog.println("Serial 'c': guided offset calibration start+confirm");
     offsetCalibrationWorkflowStart();
     offsetCalibrationWorkflowConfirm();
   }
 }
 
 void printRuntimeStatus() {
-  Serial.println();
-  Serial.println("=== STATUS ===");
-  Serial.print("FW: ");
-  Serial.println(FW_VERSION);
-  Serial.print("Orientation: ");
-  Serial.println(orientationMode == MODE_SCREEN_VERTICAL ? "SCREEN VERTICAL" : "SCREEN UP");
-  Serial.print("Axis: ");
+  SerialLog.println();
+  SerialLog.println("=== STATUS ===");
+  SerialLog.print("FW: ");
+  SerialLog.println(FW_VERSION);
+  SerialLog.print("Orientation: ");
+  SerialLog.println(orientationMode == MODE_SCREEN_VERTICAL ? "SCREEN VERTICAL" : "SCREEN UP");
+  SerialLog.print("Axis: ");
   switch (getAxisMode()) {
-    case AXIS_ROLL: Serial.println("ROLL"); break;
-    case AXIS_PITCH: Serial.println("PITCH"); break;
-    default: Serial.println("BOTH"); break;
-  }
-  Serial.print("Rotation: ");
-  Serial.println(displayRotated ? "180" : "0");
-  Serial.print("Freeze: ");
-  Serial.println(measurementIsFrozen() ? "FROZEN" : "LIVE");
-  Serial.print("Serial stream: ");
-  Serial.println(serialOutputPaused ? "PAUSED" : "LIVE");
-  Serial.print("Roll conditioning: ");
-  Serial.print(rollConditionPct, 0);
-  Serial.print("%");
+    case AXIS_ROLL: SerialLog.println("ROLL"); break;
+    case AXIS_PITCH: SerialLog.println("PITCH"); break;
+    default: SerialLog.println("BOTH"); break;
+  }
+  SerialLog.print("Rotation: ");
+  SerialLog.println(displayRotated ? "180" : "0");
+  SerialLog.print("Freeze: ");
+  SerialLog.println(measurementIsFrozen() ? "FROZEN" : "LIVE");
+  SerialLog.print("Serial stream: ");
+  SerialLog.println(serialOutputPaused ? "PAUSED" : "LIVE");
+  SerialLog.print("Roll conditioning: ");
+  serialPrintFixed(rollConditionPct, 0);
+  SerialLog.print("%");
   if (rollConditionLowFlag) {
-    Serial.print(" (LOW near +/-90 pitch)");
+    SerialLog.print(" (LOW near +/-90 pitch)");
   }
-  Serial.println();
+  SerialLog.println();
   if (batteryTelemetry.valid) {
-    Serial.print("Battery: ");
-    Serial.print(batteryTelemetry.soc_percent, 0);
-    Serial.print("% @ ");
-    Serial.print(batteryTelemetry.voltage_v, 1);
-    Serial.print(" V");
+    SerialLog.print("Battery: ");
+    serialPrintFixed(batteryTelemetry.soc_percent, 0);
+    SerialLog.print("% @ ");
+    serialPrintFixed(batteryTelemetry.voltage_v, 1);
+    SerialLog.print(" V");
     if (batteryTelemetry.present_inferred && !batteryTelemetry.present) {
-      Serial.print(" (likely no battery connected; inferred)");
-      Serial.println();
+      SerialLog.print(" (likely no battery connected; inferred)");
+      SerialLog.println();
     } else {
       if (batteryTelemetry.charging) {
-        Serial.print(" (charging");
+        SerialLog.print(" (charging");
         if (batteryTelemetry.charging_inferred) {
-          Serial.print(", inferred");
+          SerialLog.print(", inferred");
         }
-        Serial.print(")");
+        SerialLog.print(")");
       } else {
-        Serial.print(" (not charging");
+        SerialLog.print(" (not charging");
         if (batteryTelemetry.charging_inferred) {
-          Serial.print(", inferred");
+          SerialLog.print(", inferred");
+        }
+        SerialLog.print(")");
+        if (batteryTelemetry.tte_h > 0.0f) {
+          SerialLog.print(", OCV ");
+          serialPrintFixed(batteryTelemetry.ocv_v, 2);
+          SerialLog.print(" V at ~");
+          serialPrintFixed(batteryTelemetry.load_ma, 0);
+          SerialLog.print(" mA, ");
+          serialPrintFixed(batteryTelemetry.tte_h, 1);
+          SerialLog.print(" h to empty");
         }
-        Serial.print(")");
       }
-      Serial.println();
+      SerialLog.println();
     }
   } else {
-    Serial.println("Battery: unavailable");
-  }
-  Serial.print("Workflows active: ");
-  Serial.print("ZERO=");
-  Serial.print(zeroPending ? "Y" : "N");
-  Serial.print(" ");
-  Serial.print("OFFSET_CAL=");
-  Serial.print(offsetCalPending ? "Y" : "N");
-  Serial.print(" MODE=");
-  Serial.print(modeWorkflowIsActive() ? "Y" : "N");
-  Serial.print(" ALIGN=");
-  Serial.println(alignState.active ? "Y" : "N");
-  Serial.print("Bias offsets (ax,ay,az,gx,gy): ");
-  Serial.print(ax_off, 4); Serial.print(", ");
-  Serial.print(ay_off, 4); Serial.print(", ");
-  Serial.print(az_off, 4); Serial.print(", ");
-  Serial.print(gx_off, 4); Serial.print(", ");
-  Serial.println(gy_off, 4);
-  Serial.print("Zero refs (roll,pitch): ");
-  Serial.print(roll_zero, 3); Serial.print(", ");
-  Serial.println(pitch_zero, 3);
-  Serial.print("Align refs (roll,pitch): ");
-  Serial.print(align_roll, 3); Serial.print(", ");
-  Serial.println(align_pitch, 3);
-  Serial.println("==============");
+    SerialLog.println("Battery: unavailable");
+  }
+  DisplayRenderStats render = {};
+  getDisplayRenderStats(&render);
+  SerialLog.print("Display: ");
+  serialPrintFixed(render.fps, 1);
+  SerialLog.print(" fps, frame avg ");
+  serialPrintFixed(render.frame_ms_avg, 2);
+  SerialLog.print(" ms, max ");
+  serialPrintFixed(render.frame_ms_max, 2);
+  SerialLog.print(" ms (target ");
+  SerialLog.print((int)getDisplayTargetFps());
+  SerialLog.print(" / idle ");
+  SerialLog.print((int)render.idle_fps);
+  SerialLog.print(" fps, ");
+  SerialLog.print(render.active ? "ACTIVE" : "IDLE");
+  SerialLog.println(")");
+  SerialLog.print("Display bus: ");
+  SerialLog.print((unsigned long)render.px_pushed);
+  SerialLog.print(" of ");
+  SerialLog.print((unsigned long)render.px_invalidated);
+  SerialLog.print(" redrawn px/s pushed (");
+  SerialLog.print(render.direct_mode ? "PSRAM direct mode" : "partial buffers");
+  SerialLog.println(")");
+  TouchBusStats touch = {};
+  Touch_GetBusStats(&touch);
+  SerialLog.print("Touch bus: ");
+  SerialLog.print((unsigned long)touch.reads);
+  SerialLog.print(" reads for ");
+  SerialLog.print((unsigned long)touch.polls);
+  SerialLog.print(" polls (");
+  SerialLog.print((unsigned long)touch.reads_skipped);
+  SerialLog.print(" skipped via INT), ");
+  SerialLog.print((unsigned long)(touch.bus_us / 1000ULL));
+  SerialLog.print(" ms on bus, ~");
+  SerialLog.print((unsigned long)(touch.saved_us / 1000ULL));
+  SerialLog.print(" ms saved @ ");
+  SerialLog.print((unsigned long)(touch.bus_clock_hz / 1000UL));
+  SerialLog.println(touch.irq_enabled ? " kHz (INT)" : " kHz (polling)");
+  for (uint8_t dev = 0; dev < I2C_DEV_COUNT; dev++) {
+    I2cDeviceStats bus = {};
+    i2c_bus_get_stats((I2cDevice)dev, &bus);
+    SerialLog.print("I2C ");
+    SerialLog.print(i2c_bus_device_name((I2cDevice)dev));
+    SerialLog.print(" @ ");
+    SerialLog.print((unsigned long)(i2c_bus_clock_hz() / 1000UL));
+    SerialLog.print(" kHz: ");
+    SerialLog.print((unsigned long)bus.transactions);
+    SerialLog.print(" xfers, latency max ");
+    SerialLog.print((unsigned long)bus.latency_max_us);
+    SerialLog.print(" us (wait max ");
+    SerialLog.print((unsigned long)bus.wait_max_us);
+    SerialLog.print(" us), hist");
+    for (uint8_t i = 0; i < I2C_BUS_LATENCY_BUCKETS; i++) {
+      const bool last = (i == I2C_BUS_LATENCY_BUCKETS - 1);
+      SerialLog.print(last ? " >=" : " <");
+      SerialLog.print((unsigned)I2C_BUS_LATENCY_EDGES_US[last ? i - 1 : i]);
+      SerialLog.print(":");
+      SerialLog.print((unsigned long)bus.latency_hist[i]);
+    }
+    SerialLog.print(", errors nack_addr/nack_data/timeout/short/lock/other ");
+    for (uint8_t r = I2C_BUS_ERR_NACK_ADDR; r < I2C_BUS_RESULT_COUNT; r++) {
+      if (r != I2C_BUS_ERR_NACK_ADDR) SerialLog.print("/");
+      SerialLog.print((unsigned long)bus.results[r]);
+    }
+    SerialLog.println();
+  }
+  SerialLog.print("Binary telemetry: ");
+  SerialLog.print(binaryStreamEnabled ? "ON, " : "OFF, ");
+  SerialLog.print((unsigned long)binaryStreamFrames);
+  SerialLog.print(" frames sent, ");
+  SerialLog.print((unsigned long)binaryStreamDropped);
+  SerialLog.println(" dropped (log ring full)");
+  SerialLogStats logStats = {};
+  serial_log_get_stats(&logStats);
+  SerialLog.print("Log: ");
+  SerialLog.print(serial_log_level_name(serial_log_get_level()));
+  SerialLog.print(", ring ");
+  SerialLog.print((unsigned long)logStats.used_bytes);
+  SerialLog.print("/");
+  SerialLog.print((unsigned long)logStats.ring_bytes);
+  SerialLog.print(" B (peak ");
+  SerialLog.print((unsigned long)logStats.high_water_bytes);
+  SerialLog.print("), dropped ");
+  SerialLog.print((unsigned long)logStats.dropped_bytes);
+  SerialLog.print(" B in ");
+  SerialLog.print((unsigned long)logStats.dropped_writes);
+  SerialLog.print(" writes, ");
+  SerialLog.print((unsigned long)logStats.offline_bytes);
+  SerialLog.println(" B with no host");
+  PowerStats pm = {};
+  power_manager_get_stats(&pm);
+  SerialLog.print("Power: ");
+  SerialLog.print(power_cpu_mode_name(pm.cpu_mode));
+  SerialLog.print(" ");
+  SerialLog.print((unsigned)pm.cpu_min_mhz);
+  SerialLog.print("-");
+  SerialLog.print((unsigned)pm.cpu_max_mhz);
+  SerialLog.print(" MHz, busy ");
+  serialPrintFixed(pm.busy_any_pct, 1);
+  SerialLog.print("% (fusion ");
+  serialPrintFixed(pm.busy_pct[POWER_LOCK_FUSION], 1);
+  SerialLog.print(" / ui ");
+  serialPrintFixed(pm.busy_pct[POWER_LOCK_UI], 1);
+  SerialLog.print(" / http ");
+  serialPrintFixed(pm.busy_pct[POWER_LOCK_HTTP], 1);
+  SerialLog.print("), wifi ");
+  SerialLog.print(power_wifi_mode_name(pm.wifi_mode));
+  if (wifiRadioOnDemand()) SerialLog.print(wifiRadioIsOn() ? " (on demand, up)" : " (on demand, idle)");
+  SerialLog.print(", ~");
+  serialPrintFixed(pm.est_ma, 0);
+  SerialLog.print(" mA, ");
+  serialPrintFixed(pm.remaining_h, 1);
+  SerialLog.print(" h left (full charge: fixed ");
+  serialPrintFixed(pm.life_h[POWER_CPU_FIXED], 1);
+  SerialLog.print(" / dfs ");
+  serialPrintFixed(pm.life_h[POWER_CPU_DFS], 1);
+  SerialLog.print(" / light sleep ");
+  serialPrintFixed(pm.life_h[POWER_CPU_LIGHT_SLEEP], 1);
+  SerialLog.println(" h)");
+  SerialLog.print("Display power: ");
+  SerialLog.print(display_power_state_name(render.power_state));
+  SerialLog.print(" (dim after ");
+  SerialLog.print((int)getDisplayDimTimeoutSec());
+  SerialLog.print(" s, blank after ");
+  SerialLog.print((int)getDisplayBlankTimeoutSec());
+  SerialLog.print(" s; 0 = never), time active/dim/blank ");
+  SerialLog.print((unsigned long)render.power_state_s[DISPLAY_POWER_ACTIVE]);
+  SerialLog.print(" / ");
+  SerialLog.print((unsigned long)render.power_state_s[DISPLAY_POWER_DIM]);
+  SerialLog.print(" / ");
+  SerialLog.print((unsigned long)render.power_state_s[DISPLAY_POWER_BLANK]);
+  SerialLog.println(" s");
+  SerialLog.print("Auto-sleep: ");
+  if (autoSleepTimeoutMin) {
+    SerialLog.print((int)autoSleepTimeoutMin);
+    SerialLog.print(" min idle on battery (idle ");
+    SerialLog.print((unsigned long)(displayIdleMs() / 1000UL));
+    SerialLog.print(" s)");
+  } else {
+    SerialLog.print("off");
+  }
+  if (imuWakeOnMotionAvailable()) {
+    SerialLog.print(", wake: ACTION + IMU motion on GPIO");
+    SerialLog.println(IMU_WAKE_INT_PIN);
+  } else {
+    SerialLog.println(", wake: ACTION only");
+  }
+  BootTimeline boot = {};
+  getBootTimeline(&boot);
+  SerialLog.print("Boot (ms):");
+  for (uint8_t i = 0; i < BOOT_STAGE_COUNT; i++) {
+    const BootStage stage = (BootStage)i;
+    SerialLog.print(i ? ", " : " ");
+    SerialLog.print(boot_stage_name(stage));
+    SerialLog.print(" ");
+    if (boot_timeline_complete(boot, stage)) {
+      serialPrintFixed((float)boot_timeline_duration_us(boot, stage) / 1000.0f, 1);
+      SerialLog.print(" @");
+      serialPrintFixed((float)boot.end_us[i] / 1000.0f, 1);
+    } else {
+      SerialLog.print("--");
+    }
+  }
+  SerialLog.println();
+  SerialLog.print("LVGL heap: ");
+  SerialLog.print((unsigned long)render.lv_mem_used);
+  SerialLog.print(" / ");
+  SerialLog.print((unsigned long)render.lv_mem_total);
+  SerialLog.print(" B used (peak ");
+  SerialLog.print((unsigned long)render.lv_mem_max_used);
+  SerialLog.print("), free ");
+  SerialLog.print((unsigned long)render.lv_mem_free);
+  SerialLog.print(" B, largest block ");
+  SerialLog.print((unsigned long)render.lv_mem_largest_free);
+  SerialLog.print(" B (min ");
+  SerialLog.print((unsigned long)render.lv_mem_largest_free_min);
+  SerialLog.print("), frag ");
+  SerialLog.print((int)render.lv_mem_frag_pct);
+  SerialLog.print("%, ");
+  SerialLog.println(render.lv_mem_psram ? "PSRAM" : "internal RAM");
+  SerialLog.print("LVGL heap left per on-demand cycle: ALIGN panel ");
+  SerialLog.print((long)render.ui_align_heap.last_delta);
+  SerialLog.print(" B (max ");
+  SerialLog.print((long)render.ui_align_heap.max_delta);
+  SerialLog.print(", ");
+  SerialLog.print((unsigned long)render.ui_align_heap.round_trips);
+  SerialLog.print(" cycles), trend view ");
+  SerialLog.print((long)render.ui_trend_heap.last_delta);
+  SerialLog.print(" B (max ");
+  SerialLog.print((long)render.ui_trend_heap.max_delta);
+  SerialLog.print(", ");
+  SerialLog.print((unsigned long)render.ui_trend_heap.round_trips);
+  SerialLog.println(" cycles)");
+  SerialLog.print("Internal RAM: ");
+  SerialLog.print((unsigned long)render.internal_free);
+  SerialLog.print(" B free, largest block ");
+  SerialLog.print((unsigned long)render.internal_largest_free);
+  SerialLog.println(" B");
+  SerialLog.print("Workflows active: ");
+  SerialLog.print("ZERO=");
+  SerialLog.print(zeroPending ? "Y" : "N");
+  SerialLog.print(" ");
+  SerialLog.print("OFFSET_CAL=");
+  SerialLog.print(offsetCalPending ? "Y" : "N");
+  SerialLog.print(" MODE=");
+  SerialLog.print(modeWorkflowIsActive() ? "Y" : "N");
+  SerialLog.print(" ALIGN=");
+  SerialLog.println(alignState.active ? "Y" : "N");
+  SerialLog.print("Bias offsets (ax,ay,az,gx,gy): ");
+  serialPrintFixed(ax_off, 4); SerialLog.print(", ");
+  serialPrintFixed(ay_off, 4); SerialLog.print(", ");
+  serialPrintFixed(az_off, 4); SerialLog.print(", ");
+  serialPrintFixed(gx_off, 4); SerialLog.print(", ");
+  serialPrintlnFixed(gy_off, 4);
+  SerialLog.print("Zero refs (roll,pitch): ");
+  serialPrintFixed(roll_zero, 3); SerialLog.print(", ");
+  serialPrintlnFixed(pitch_zero, 3);
+  SerialLog.print("Align refs (roll,pitch): ");
+  serialPrintFixed(align_roll, 3); SerialLog.print(", ");
+  serialPrintlnFixed(align_pitch, 3);
+  SerialLog.println("==============");
 }
 
 void printSerialHelp() {
-  Serial.println();
-  Serial.println("Serial command help");
-  Serial.println("  z   : start guided ZERO");
-  Serial.println("  c   : context action (capture/confirm/offset cal start+confirm)");
-  Serial.println("  y   : explicit CONFIRM (ZERO/OFFSET CAL only)");
-  Serial.println("  p   : explicit CAPTURE (ALIGN only)");
-  Serial.println("  x/n : cancel active workflow(s)");
-  Serial.println("  o   : start guided OFFSET CAL");
-  Serial.println("  C   : start ALIGN (6-step)");
-  Serial.println("  u/v/m : set/toggle orientation mode");
-  Serial.println("  a   : cycle AXIS (BOTH -> ROLL -> PITCH)");
-  Serial.println("  r   : toggle 180-degree display rotation");
-  Serial.println("  d   : toggle RAW stream (5 Hz)");
-  Serial.println("  D   : print one RAW sample now");
-  Serial.println("  s   : print runtime status");
-  Serial.println("  h/? : this help");
-  Serial.println("  ENTER/SPACE/g : resume live stream after pause");
+  SerialLog.println();
+  SerialLog.println("Serial command help");
+  SerialLog.println("  z   : start guided ZERO");
+  SerialLog.println("  c   : context action (capture/confirm/offset cal start+confirm)");
+  SerialLog.println("  y   : explicit CONFIRM (ZERO/OFFSET CAL only)");
+  SerialLog.println("  p   : explicit CAPTURE (ALIGN only)");
+  SerialLog.println("  x/n : cancel active workflow(s)");
+  SerialLog.println("  o   : start guided OFFSET CAL");
+  SerialLog.println("  C   : start ALIGN (6-step)");
+  SerialLog.println("  u/v/m : set/toggle orientation mode");
+  SerialLog.println("  a   : cycle AXIS (BOTH -> ROLL -> PITCH)");
+  SerialLog.println("  r   : toggle 180-degree display rotation");
+  SerialLog.println("  w   : Wi-Fi radio on (on-demand mode) / restart its idle timer");
+  SerialLog.println("  b   : toggle binary telemetry (every fused sample; scripts/telemetry_decode.py)");
+  SerialLog.println("  l   : cycle log level (ERROR -> WARN -> INFO -> DEBUG)");
+  SerialLog.println("  d   : toggle RAW stream (5 Hz)");
+  SerialLog.println("  D   : print one RAW sample now");
+  SerialLog.println("  s   : print runtime status");
+  SerialLog.println("  P   : print stage timings, heap and stack use, then start a new window");
+  SerialLog.println("  L   : toggle latency marker (photodiode square, flips at roll 0 deg)");
+  SerialLog.println("  F   : print flight recorder (events before the last reset, and this run)");
+  SerialLog.println("  h/? : this help");
+  SerialLog.println("  ENTER/SPACE/g : resume live stream after pause");
 }
 
 void pauseSerialOutputUntilResume() {
   if (!serialOutputPaused) {
     serialOutputPaused = true;
-    Serial.println();
-    Serial.println("[SERIAL PAUSED] Press ENTER (or SPACE/'g') to resume live stream");
+    SerialLog.println();
+    SerialLog.println("[SERIAL PAUSED] Press ENTER (or SPACE/'g') to resume live stream");
   }
 }
 
 void resumeSerialOutput() {
   if (serialOutputPaused) {
     serialOutputPaused = false;
-    Serial.println("[SERIAL RESUMED] live stream active");
+    SerialLog.println("[SERIAL RESUMED] live stream active");
   }
 }
 
@@ -1055,7 +1883,7 @@ void alignmentCapture(void)
   alignCaptureState.sampleCount = 0;
   alignCaptureState.sumRoll = 0.0f;
   alignCaptureState.sumPitch = 0.0f;
-  Serial.println("Capturing...");
+  SerialLog.println("Capturing...");
 }
 
 void processAlignmentCapture() {
@@ -1102,12 +1930,12 @@ void processAlignmentCapture() {
       break;
   }
 
-  Serial.print("Captured: ");
-  Serial.println(alignmentStepText(step));
-  Serial.print("  roll_phys=");
-  Serial.print(r, 2);
-  Serial.print("  pitch_phys=");
-  Serial.println(p, 2);
+  SerialLog.print("Captured: ");
+  SerialLog.println(alignmentStepText(step));
+  SerialLog.print("  roll_phys=");
+  serialPrintFixed(r, 2);
+  SerialLog.print("  pitch_phys=");
+  serialPrintlnFixed(p, 2);
 
   if (step == ALIGN_TOP_EDGE_DOWN) {
     finalizeAlignment();
@@ -1122,13 +1950,29 @@ void processAlignmentCapture() {
 // SUPPORT FUNCTIONS
 // ============================================================
 
+// One QMI8658 sample read as a single IMU transaction on the shared bus.
+// readSensorData() also returns false when no new sample is ready, which is
+// a normal poll; an address probe tells that apart from a bus failure so
+// the error classes only count real bus errors.
+bool readImuSample(QMI8658_Data &d) {
+  if (!i2c_bus_acquire(I2C_DEV_IMU, I2C_BUS_WAIT_MS)) return false;
+  const bool ok = imu.readSensorData(d);
+  I2cBusResult result = I2C_BUS_OK;
+  if (!ok) {
+    Wire.beginTransmission(QMI8658_ADDRESS_HIGH);
+    result = i2c_bus_result_from_wire(Wire.endTransmission());
+  }
+  i2c_bus_release(I2C_DEV_IMU, result);
+  return ok;
+}
+
 void calibrateOffsets() {
   float sax=0,say=0,saz=0,sgx=0,sgy=0;
   int n=0;
 
   for(int i=0;i<500;i++){
     QMI8658_Data d;
-    if(!imu.readSensorData(d))continue;
+    if(!readImuSample(d))continue;
     float ax,ay,az,gx,gy;
     remapAccel(d,ax,ay,az);
     remapGyro(d,gx,gy);
@@ -1215,7 +2059,7 @@ void saveZeroReferenceToEeprom(OrientationMode mode) {
 
 void initializeAngles() {
   QMI8658_Data d;
-  imu.readSensorData(d);
+  readImuSample(d);
   float ax,ay,az;
   remapAccel(d,ax,ay,az);
   ax-=ax_off; ay-=ay_off; az-=az_off;
@@ -1231,7 +2075,7 @@ void setZeroReference() {
 
 void beginZeroWorkflow(bool auto_confirm, const char *context) {
   if (alignmentIsActive()) {
-    Serial.println("Zero blocked: ALIGN active");
+    SerialLog.println("Zero blocked: ALIGN active");
     return;
   }
   modeWorkflowCancel();
@@ -1247,22 +2091,22 @@ void beginZeroWorkflow(bool auto_confirm, const char *context) {
     zeroStartMs = millis();
     zeroRefRoll = roll_phys + align_roll;
     zeroRefPitch = pitch_phys + align_pitch;
-    Serial.println();
-    Serial.print("Zero workflow auto-started");
+    SerialLog.println();
+    SerialLog.print("Zero workflow auto-started");
     if (context && context[0] != '\0') {
-      Serial.print(" (");
-      Serial.print(context);
-      Serial.print(")");
+      SerialLog.print(" (");
+      SerialLog.print(context);
+      SerialLog.print(")");
     }
-    Serial.println(". Hold still...");
+    SerialLog.println(". Hold still...");
     return;
   }
 
-  Serial.println();
-  Serial.println("Zero workflow");
-  Serial.println("Press CONFIRM and hold still");
-  Serial.println("Send 'c' to CONFIRM, 'x' to cancel");
-  Serial.println("Tip: ACTION short=CONFIRM, long=CANCEL");
+  SerialLog.println();
+  SerialLog.println("Zero workflow");
+  SerialLog.println("Press CONFIRM and hold still");
+  SerialLog.println("Send 'c' to CONFIRM, 'x' to cancel");
+  SerialLog.println("Tip: ACTION short=CONFIRM, long=CANCEL");
 }
 
 void zeroWorkflowStart(void) {
@@ -1277,7 +2121,7 @@ void zeroWorkflowConfirm(void) {
   zeroStartMs = millis();
   zeroRefRoll = roll_phys + align_roll;
   zeroRefPitch = pitch_phys + align_pitch;
-  Serial.println("Zero confirmed. Hold still...");
+  SerialLog.println("Zero confirmed. Hold still...");
 }
 
 void zeroWorkflowCancel(void) {
@@ -1286,7 +2130,7 @@ void zeroWorkflowCancel(void) {
   zeroConfirmed = false;
   zeroSampling = false;
   zeroSampleCount = 0;
-  Serial.println("Zero canceled");
+  SerialLog.println("Zero canceled");
 }
 
 void processZeroWorkflow() {
@@ -1310,7 +2154,7 @@ void processZeroWorkflow() {
       zeroSampleCount = 0;
       zeroSumRoll = 0.0f;
       zeroSumPitch = 0.0f;
-      Serial.println("Zero sampling...");
+      SerialLog.println("Zero sampling...");
     }
     return;
   }
@@ -1329,7 +2173,7 @@ void processZeroWorkflow() {
   zeroConfirmed = false;
   zeroSampling = false;
   zeroSampleCount = 0;
-  Serial.println("Zero complete");
+  SerialLog.println("Zero complete");
 }
 
 bool zeroWorkflowIsActive(void) {
@@ -1404,7 +2248,7 @@ void runQuickOffsetCalibration(void) {
   calibrateOffsets();
   saveBiasOffsetsToEeprom(orientationMode);
   initializeAngles();
-  Serial.println("Quick offset calibration complete");
+  SerialLog.println("Quick offset calibration complete");
 }
 
 bool alignmentIsActive(void) {
@@ -1447,19 +2291,19 @@ const char *alignmentStepHintText(AlignmentStep step) {
 
 void printAlignmentInstruction() {
   if (!alignState.active) return;
-  Serial.println();
-  Serial.print("ALIGN ");
-  Serial.print((int)alignState.step + 1);
-  Serial.print("/");
-  Serial.println((int)ALIGN_STEP_COUNT);
-  Serial.print("Place tool: ");
-  Serial.println(alignmentStepText(alignState.step));
+  SerialLog.println();
+  SerialLog.print("ALIGN ");
+  SerialLog.print((int)alignState.step + 1);
+  SerialLog.print("/");
+  SerialLog.println((int)ALIGN_STEP_COUNT);
+  SerialLog.print("Place tool: ");
+  SerialLog.println(alignmentStepText(alignState.step));
   const char *hint = alignmentStepHintText(alignState.step);
   if (hint[0] != '\0') {
-    Serial.println(hint);
+    SerialLog.println(hint);
   }
-  Serial.println("Press CAPTURE (touch) or send 'c' (serial)");
-  Serial.println("Tip: ACTION button = CAPTURE");
+  SerialLog.println("Press CAPTURE (touch) or send 'c' (serial)");
+  SerialLog.println("Tip: ACTION button = CAPTURE");
 }
 
 void alignmentGetInstruction(char *buf, unsigned int buf_size) {
@@ -1520,9 +2364,9 @@ void alignmentStart(void) {
   alignState.p_td = 0.0f;
   alignCaptureState.active = false;
 
-  Serial.print("\nAlignment FW ");
-  Serial.print(FW_VERSION);
-  Serial.println(" (6 orientations)");
+  SerialLog.print("\nAlignment FW ");
+  SerialLog.print(FW_VERSION);
+  SerialLog.println(" (6 orientations)");
   printAlignmentInstruction();
 }
 
@@ -1530,14 +2374,14 @@ void alignmentCancel(void) {
   if (!alignState.active) return;
   alignCaptureState.active = false;
   alignState.active = false;
-  Serial.println("Alignment canceled");
+  SerialLog.println("Alignment canceled");
 }
 
 void modeWorkflowStart(OrientationMode target) {
   zeroWorkflowCancel();
   offsetCalibrationWorkflowCancel();
   setOrientation(target);
-  Serial.println("Mode change complete");
+  SerialLog.println("Mode change complete");
 }
 
 void modeWorkflowStartToggle(void) {
@@ -1584,12 +2428,12 @@ void offsetCalibrationWorkflowStart(void) {
   offsetCalSumAx = offsetCalSumAy = offsetCalSumAz = 0.0f;
   offsetCalSumGx = offsetCalSumGy = 0.0f;
 
-  Serial.println();
-  Serial.println("Offset calibration workflow");
-  Serial.print("Reposition with ");
-  Serial.println(orientationMode == MODE_SCREEN_VERTICAL ? "SCREEN VERTICAL" : "SCREEN UP");
-  Serial.println("Send 'c' to CONFIRM and hold still");
-  Serial.println("Send 'x' to cancel");
+  SerialLog.println();
+  SerialLog.println("Offset calibration workflow");
+  SerialLog.print("Reposition with ");
+  SerialLog.println(orientationMode == MODE_SCREEN_VERTICAL ? "SCREEN VERTICAL" : "SCREEN UP");
+  SerialLog.println("Send 'c' to CONFIRM and hold still");
+  SerialLog.println("Send 'x' to cancel");
 }
 
 void offsetCalibrationWorkflowConfirm(void) {
@@ -1600,7 +2444,7 @@ void offsetCalibrationWorkflowConfirm(void) {
   offsetCalStartMs = millis();
   offsetCalRefRoll = roll_phys;
   offsetCalRefPitch = pitch_phys;
-  Serial.println("Offset calibration confirmed. Hold still...");
+  SerialLog.println("Offset calibration confirmed. Hold still...");
 }
 
 void offsetCalibrationWorkflowCancel(void) {
@@ -1609,7 +2453,7 @@ void offsetCalibrationWorkflowCancel(void) {
   offsetCalConfirmed = false;
   offsetCalSampling = false;
   offsetCalSampleCount = 0;
-  Serial.println("Offset calibration canceled");
+  SerialLog.println("Offset calibration canceled");
 }
 
 void processOffsetCalibrationWorkflow() {
@@ -1630,7 +2474,7 @@ void processOffsetCalibrationWorkflow() {
       offsetCalSampleCount = 0;
       offsetCalSumAx = offsetCalSumAy = offsetCalSumAz = 0.0f;
       offsetCalSumGx = offsetCalSumGy = 0.0f;
-      Serial.println("Offset calibration sampling...");
+      SerialLog.println("Offset calibration sampling...");
     }
     return;
   }
@@ -1656,7 +2500,7 @@ void processOffsetCalibrationWorkflow() {
   offsetCalConfirmed = false;
   offsetCalSampling = false;
   offsetCalSampleCount = 0;
-  Serial.println("Offset calibration complete");
+  SerialLog.println("Offset calibration complete");
 }
 
 bool offsetCalibrationWorkflowIsActive(void) {
@@ -1716,19 +2560,19 @@ void finalizeAlignment() {
   EEPROM.commit();
 
   alignState.active = false;
-  Serial.println("Alignment complete (offsets saved)");
-  Serial.print("  align_roll=");
-  Serial.print(align_roll, 3);
-  Serial.print("  align_pitch=");
-  Serial.println(align_pitch, 3);
+  SerialLog.println("Alignment complete (offsets saved)");
+  SerialLog.print("  align_roll=");
+  serialPrintFixed(align_roll, 3);
+  SerialLog.print("  align_pitch=");
+  serialPrintlnFixed(align_pitch, 3);
 }
 
 void toggleRotation() {
   displayRotated = !displayRotated;
   EEPROM.write(EEPROM_ADDR_ROTATION, displayRotated ? 1 : 0);
   EEPROM.commit();
-  Serial.print("Display rotation: ");
-  Serial.println(displayRotated ? "180" : "0");
+  SerialLog.print("Display rotation: ");
+  SerialLog.println(displayRotated ? "180" : "0");
 }
 
 void toggleMeasurementFreeze() {
@@ -1782,8 +2626,8 @@ void setAutoZeroOnBootEnabled(bool enabled) {
   autoZeroOnBootEnabled = enabled;
   EEPROM.write(EEPROM_ADDR_AUTO_ZERO_BOOT, enabled ? 1 : 0);
   EEPROM.commit();
-  Serial.print("Startup ZERO: ");
-  Serial.println(enabled ? "ON" : "OFF");
+  SerialLog.print("Startup ZERO: ");
+  SerialLog.println(enabled ? "ON" : "OFF");
 }
 
 DisplayPrecisionMode getDisplayPrecisionMode(void) {
@@ -1794,8 +2638,8 @@ void setDisplayPrecisionMode(DisplayPrecisionMode mode) {
   displayPrecisionMode = sanitize_display_precision((uint8_t)mode);
   EEPROM.write(EEPROM_ADDR_DISPLAY_PRECISION, (uint8_t)displayPrecisionMode);
   EEPROM.commit();
-  Serial.print("Display precision: ");
-  Serial.println((int)displayPrecisionMode);
+  SerialLog.print("Display precision: ");
+  SerialLog.println((int)displayPrecisionMode);
 }
 
 uint8_t getDisplayBrightnessPercent(void) {
@@ -1806,9 +2650,94 @@ void setDisplayBrightnessPercent(uint8_t percent) {
   displayBrightnessPercent = sanitize_display_brightness(percent);
   EEPROM.write(EEPROM_ADDR_DISPLAY_BRIGHTNESS, displayBrightnessPercent);
   EEPROM.commit();
-  Serial.print("Display brightness: ");
-  Serial.print((int)displayBrightnessPercent);
-  Serial.println("%");
+  SerialLog.print("Display brightness: ");
+  SerialLog.print((int)displayBrightnessPercent);
+  SerialLog.println("%");
+}
+
+uint8_t getDisplayTargetFps(void) {
+  return displayTargetFps;
+}
+
+void setDisplayTargetFps(uint8_t fps) {
+  displayTargetFps = sanitize_display_target_fps(fps);
+  EEPROM.write(EEPROM_ADDR_DISPLAY_TARGET_FPS, displayTargetFps);
+  EEPROM.commit();
+  SerialLog.print("Display target rate: ");
+  SerialLog.print((int)displayTargetFps);
+  SerialLog.println(" fps");
+}
+
+uint16_t getDisplayDimTimeoutSec(void) {
+  return displayDimTimeoutSec;
+}
+
+void setDisplayDimTimeoutSec(uint16_t sec) {
+  const uint8_t raw = encode_display_idle_timeout(sec);
+  displayDimTimeoutSec = (uint16_t)raw * 10U;
+  EEPROM.write(EEPROM_ADDR_DISPLAY_DIM_TIMEOUT, raw);
+  EEPROM.commit();
+  SerialLog.print("Display dim after: ");
+  SerialLog.print((int)displayDimTimeoutSec);
+  SerialLog.println(displayDimTimeoutSec ? " s" : " (never)");
+}
+
+uint16_t getDisplayBlankTimeoutSec(void) {
+  return displayBlankTimeoutSec;
+}
+
+void setDisplayBlankTimeoutSec(uint16_t sec) {
+  const uint8_t raw = encode_display_idle_timeout(sec);
+  displayBlankTimeoutSec = (uint16_t)raw * 10U;
+  EEPROM.write(EEPROM_ADDR_DISPLAY_BLANK_TIMEOUT, raw);
+  EEPROM.commit();
+  SerialLog.print("Display blank after: ");
+  SerialLog.print((int)displayBlankTimeoutSec);
+  SerialLog.println(displayBlankTimeoutSec ? " s" : " (never)");
+}
+
+uint16_t getAutoSleepTimeoutSec(void) {
+  return (uint16_t)autoSleepTimeoutMin * 60U;
+}
+
+void setAutoSleepTimeoutSec(uint16_t sec) {
+  autoSleepTimeoutMin = encode_auto_sleep_timeout(sec);
+  EEPROM.write(EEPROM_ADDR_AUTO_SLEEP_TIMEOUT, autoSleepTimeoutMin);
+  EEPROM.commit();
+  SerialLog.print("Auto-sleep after: ");
+  if (autoSleepTimeoutMin) {
+    SerialLog.print((int)autoSleepTimeoutMin);
+    SerialLog.println(" min");
+  } else {
+    SerialLog.println("never");
+  }
+}
+
+void setUiAngles(float roll, float pitch, uint32_t sample_us) {
+  portENTER_CRITICAL(&uiAngleMux);
+  ui_roll = roll;
+  ui_pitch = pitch;
+  ui_sample_us = sample_us;
+  portEXIT_CRITICAL(&uiAngleMux);
+}
+
+bool uiAnglesLive(void) {
+  return uiAnglesLiveFlag;
+}
+
+bool uiSensorsReady(void) {
+  return uiSensorsReadyFlag;
+}
+
+void getUiAngles(float *roll, float *pitch, uint32_t *sample_us) {
+  portENTER_CRITICAL(&uiAngleMux);
+  const float r = ui_roll;
+  const float p = ui_pitch;
+  const uint32_t t = ui_sample_us;
+  portEXIT_CRITICAL(&uiAngleMux);
+  if (roll) *roll = r;
+  if (pitch) *pitch = p;
+  if (sample_us) *sample_us = t;
 }
 
 bool getTouchInputEnabled(void) {
@@ -1821,8 +2750,8 @@ void setTouchInputEnabled(bool enabled) {
     EEPROM.write(EEPROM_ADDR_TOUCH_ENABLED, enabled ? 1 : 0);
     EEPROM.commit();
   }
-  Serial.print("Touch input: ");
-  Serial.println(enabled ? "ON" : "OFF");
+  SerialLog.print("Touch input: ");
+  SerialLog.println(enabled ? "ON" : "OFF");
 }
 
 bool getTouchLockPersistent(void) {
@@ -1838,14 +2767,14 @@ void setTouchLockPersistent(bool enabled) {
     EEPROM.write(EEPROM_ADDR_TOUCH_ENABLED, 1);
   }
   EEPROM.commit();
-  Serial.print("Touch lock persistence: ");
-  Serial.println(enabled ? "ON" : "OFF");
+  SerialLog.print("Touch lock persistence: ");
+  SerialLog.println(enabled ? "ON" : "OFF");
 }
 
 void requestDeepSleep(void) {
   deepSleepPending = true;
   deepSleepPendingSinceMs = millis();
-  Serial.println("Deep sleep requested (remote/API)");
+  SerialLog.println("Deep sleep requested (remote/API)");
 }
 
 void getImuDiagnosticsSample(ImuDiagnosticsSample *out_sample) {
@@ -1893,45 +2822,45 @@ unsigned long bootHoldDurationMs(void) {
 }
 
 void printMode() {
-  Serial.println("\n=== MODE ===");
-  Serial.print("Orientation: ");
-  Serial.println(orientationMode == MODE_SCREEN_VERTICAL ? "SCREEN VERTICAL" : "SCREEN UP");
-  Serial.println("Roll:  + = right edge down");
-  Serial.println("Pitch: + = screen tilts toward you");
-  Serial.println("===================");
+  SerialLog.println("\n=== MODE ===");
+  SerialLog.print("Orientation: ");
+  SerialLog.println(orientationMode == MODE_SCREEN_VERTICAL ? "SCREEN VERTICAL" : "SCREEN UP");
+  SerialLog.println("Roll:  + = right edge down");
+  SerialLog.println("Pitch: + = screen tilts toward you");
+  SerialLog.println("===================");
 }
 
-void printRawImuSample(const QMI8658_Data &d, float ax, float ay, float az, float gx, float gy) {
+void printRawImuSample(const QMI8658_Data &d, float ax, float ay, float az, float gx, float gy, Print &out) {
   // d.* are sensor values after library scaling, before project remap/offset removal.
   // ax..gy args here are remapped + offset-corrected values used by the filter.
   float rax, ray, raz, rgx, rgy;
   remapAccel(d, rax, ray, raz);
   remapGyro(d, rgx, rgy);
 
-  Serial.print("RAW ");
-  Serial.print(orientationMode == MODE_SCREEN_VERTICAL ? "VERT" : "UP");
-  Serial.print(" | sens a=(");
-  Serial.print(d.accelX, 3); Serial.print(",");
-  Serial.print(d.accelY, 3); Serial.print(",");
-  Serial.print(d.accelZ, 3); Serial.print(") g=(");
-  Serial.print(d.gyroX, 3); Serial.print(",");
-  Serial.print(d.gyroY, 3); Serial.print(",");
-  Serial.print(d.gyroZ, 3); Serial.print(")");
-  Serial.print(" | map a=(");
-  Serial.print(rax, 3); Serial.print(",");
-  Serial.print(ray, 3); Serial.print(",");
-  Serial.print(raz, 3); Serial.print(") g=(");
-  Serial.print(rgx, 3); Serial.print(",");
-  Serial.print(rgy, 3); Serial.print(")");
-  Serial.print(" | corr a=(");
-  Serial.print(ax, 3); Serial.print(",");
-  Serial.print(ay, 3); Serial.print(",");
-  Serial.print(az, 3); Serial.print(") g=(");
-  Serial.print(gx, 3); Serial.print(",");
-  Serial.print(gy, 3); Serial.print(")");
-  Serial.print(" | angle=(");
-  Serial.print(roll_phys, 2); Serial.print(",");
-  Serial.print(pitch_phys, 2); Serial.println(")");
+  out.print("RAW ");
+  out.print(orientationMode == MODE_SCREEN_VERTICAL ? "VERT" : "UP");
+  out.print(" | sens a=(");
+  serialPrintFixed(d.accelX, 3, out); out.print(",");
+  serialPrintFixed(d.accelY, 3, out); out.print(",");
+  serialPrintFixed(d.accelZ, 3, out); out.print(") g=(");
+  serialPrintFixed(d.gyroX, 3, out); out.print(",");
+  serialPrintFixed(d.gyroY, 3, out); out.print(",");
+  serialPrintFixed(d.gyroZ, 3, out); out.print(")");
+  out.print(" | map a=(");
+  serialPrintFixed(rax, 3, out); out.print(",");
+  serialPrintFixed(ray, 3, out); out.print(",");
+  serialPrintFixed(raz, 3, out); out.print(") g=(");
+  serialPrintFixed(rgx, 3, out); out.print(",");
+  serialPrintFixed(rgy, 3, out); out.print(")");
+  out.print(" | corr a=(");
+  serialPrintFixed(ax, 3, out); out.print(",");
+  serialPrintFixed(ay, 3, out); out.print(",");
+  serialPrintFixed(az, 3, out); out.print(") g=(");
+  serialPrintFixed(gx, 3, out); out.print(",");
+  serialPrintFixed(gy, 3, out); out.print(")");
+  out.print(" | angle=(");
+  serialPrintFixed(roll_phys, 2, out); out.print(",");
+  serialPrintFixed(pitch_phys, 2, out); out.println(")");
 }
 
 void handleBootButton() {
@@ -1954,12 +2883,15 @@ void handleBootButton() {
       bootBtnPressStartMs = now;
       bootHoldActive = true;
       bootHoldMs = 0;
+      bootBtnWokeDisplay = displayNoteActivity();
     } else {
       // Trigger on release to avoid repeat while held.
       unsigned long pressMs = now - bootBtnPressStartMs;
       bootHoldActive = false;
       bootHoldMs = 0;
-      if (alignmentIsActive()) {
+      if (bootBtnWokeDisplay && pressMs < bootBtnLongPressMs) {
+        // A short press on a blanked panel only wakes it.
+      } else if (alignmentIsActive()) {
         alignmentCapture();
       } else if (modeWorkflowIsActive()) {
         if (pressMs >= bootBtnLongPressMs) {
@@ -1983,14 +2915,21 @@ void handleBootButton() {
         if (pressMs >= bootBtnSleepPressMs) {
           deepSleepPending = true;
           deepSleepPendingSinceMs = now;
-          Serial.println("Deep sleep armed: release guard active");
+          SerialLog.println("Deep sleep armed: release guard active");
         } else if (pressMs >= bootBtnUltraLongPressMs) {
           offsetCalibrationWorkflowStart();
         } else if (pressMs >= bootBtnVeryLongPressMs) {
           modeWorkflowStartToggle();
         } else if (pressMs >= bootBtnLongPressMs) {
           cycleAxisMode();
+        } else if (bootBtnLastShortReleaseMs != 0 &&
+                   (now - bootBtnLastShortReleaseMs) < bootBtnDoublePressMs) {
+          bootBtnLastShortReleaseMs = 0;
+          toggleMeasurementFreeze();
+          SerialLog.println("ACTION double press: Wi-Fi radio on");
+          wifiRadioRequest();
         } else {
+          bootBtnLastShortReleaseMs = now;
           toggleMeasurementFreeze();
         }
       }
@@ -1,10 +1,19 @@
 #pragma once
 
-#include <QMI8658.h>
+#include <stdint.h>
 
-// Shared UI values
-extern volatile float ui_roll;
-extern volatile float ui_pitch;
+#include "boot_timeline.h"
+
+// Shared UI values (written by the sensor loop, read by the LVGL task).
+// Both angles are published/read as one pair under a short critical section,
+// together with the micros() time of the IMU read they came from (0 when they
+// do not come from a fresh sample: boot seed, frozen reading).
+void setUiAngles(float roll, float pitch, uint32_t sample_us);
+void getUiAngles(float *roll, float *pitch, uint32_t *sample_us);
+// True once the main loop has published its first fused sample.
+bool uiAnglesLive(void);
+// True once IMU, calibration and touch setup are done (touch may be read).
+bool uiSensorsReady(void);
 
 // Orientation enum shared across files
 enum OrientationMode {
@@ -80,6 +89,9 @@ struct BatteryTelemetry {
   bool charging_inferred;
   bool present;
   bool present_inferred;
+  float ocv_v;     // voltage_v plus the modelled load sag, feeds soc_percent
+  float load_ma;   // modelled discharge current (0 while charging/absent)
+  float tte_h;     // time to empty at load_ma (0 = unknown/not discharging)
 };
 
 enum BatteryPresenceMode {
@@ -115,6 +127,14 @@ DisplayPrecisionMode getDisplayPrecisionMode(void);
 void setDisplayPrecisionMode(DisplayPrecisionMode mode);
 uint8_t getDisplayBrightnessPercent(void);
 void setDisplayBrightnessPercent(uint8_t percent);
+uint8_t getDisplayTargetFps(void);
+void setDisplayTargetFps(uint8_t fps);
+uint16_t getDisplayDimTimeoutSec(void);     // 0 = never
+void setDisplayDimTimeoutSec(uint16_t sec);
+uint16_t getDisplayBlankTimeoutSec(void);   // 0 = never
+void setDisplayBlankTimeoutSec(uint16_t sec);
+uint16_t getAutoSleepTimeoutSec(void);      // 0 = never; stored in whole minutes
+void setAutoSleepTimeoutSec(uint16_t sec);
 bool getTouchInputEnabled(void);
 void setTouchInputEnabled(bool enabled);
 bool getTouchLockPersistent(void);
@@ -151,5 +171,58 @@ float offsetCalibrationWorkflowProgressPercent(void);
 void getImuDiagnosticsSample(ImuDiagnosticsSample *out_sample);
 void getCalibrationStateSnapshot(CalibrationStateSnapshot *out_snapshot);
 
-// Display power management hooks (implemented in ui_lvgl.cpp)
+// Touch actions. The LVGL task only posts them; the sensor loop runs them
+// between samples, so workflows, calibration and EEPROM are only changed
+// from that loop. Safe from any task; the UI follows the resulting state.
+enum UiCommand : uint8_t {
+  UI_CMD_ZERO_START = 0,
+  UI_CMD_ZERO_CONFIRM,
+  UI_CMD_ZERO_CANCEL,
+  UI_CMD_OFFSET_CAL_START,
+  UI_CMD_OFFSET_CAL_CONFIRM,
+  UI_CMD_OFFSET_CAL_CANCEL,
+  UI_CMD_MODE_TOGGLE,         // MODE workflow to the other orientation
+  UI_CMD_ORIENTATION_CYCLE,   // SIMPLE layout medium hold
+  UI_CMD_AXIS_CYCLE,
+  UI_CMD_ROTATE,
+  UI_CMD_FREEZE_TOGGLE,
+  UI_CMD_ALIGN_START,
+  UI_CMD_ALIGN_CAPTURE,
+  UI_CMD_ALIGN_CANCEL,
+  UI_CMD_LAYOUT_SIMPLE,
+  UI_CMD_LAYOUT_ADVANCED,
+  UI_CMD_COUNT
+};
+void postUiCommand(UiCommand cmd);
+
+// Display power management hooks (implemented in display_panel.cpp)
+// Parks the LVGL task (keeps the display lock) and blanks the panel.
 void displayPrepareForDeepSleep(void);
+// Idle power policy: report user activity (motion, touch, button, web).
+// Safe from any task. Returns true if the panel was blank, i.e. this
+// activity only woke it.
+bool displayNoteActivity(void);
+// Milliseconds since the last reported activity.
+uint32_t displayIdleMs(void);
+// Latency test marker: a square in the top-left corner that flips between
+// black and white when the latest fused sample's roll (setUiAngles, before
+// the readout's smoothing) crosses 0 deg, for a photodiode. It measures the
+// sample-to-pixel pipeline, not the lag of the smoothed number on screen.
+// Safe from any task; the LVGL task applies it.
+void displaySetLatencyMarker(bool enabled);
+bool displayLatencyMarkerEnabled(void);
+
+// True when this boot restored its state from RTC memory after our own deep
+// sleep (see setup_inclinometer); the display skips the wake splash.
+bool fastResumeActive(void);
+
+// Wi-Fi radio on demand (implemented in remote_control.cpp). The request is
+// safe from any task; the main loop starts the radio.
+void wifiRadioRequest(void);
+bool wifiRadioIsOn(void);
+bool wifiRadioOnDemand(void);
+
+// Boot timeline (implemented in main.cpp); safe from any task.
+void bootStageBegin(BootStage stage);
+void bootStageEnd(BootStage stage);
+void getBootTimeline(BootTimeline *out);
@@ -0,0 +1,30 @@
+#include "latency_trace.h"
+
+void latency_trace_reset(LatencyTrace *tr) {
+  if (!tr) return;
+  tr->sample_us = 0;
+  tr->ui_us = 0;
+  tr->last_sample_us = 0;
+  tr->superseded = 0;
+  tr->pending = false;
+}
+
+bool latency_trace_ui(LatencyTrace *tr, uint32_t sample_us, uint32_t now_us) {
+  if (!tr || sample_us == 0 || sample_us == tr->last_sample_us) return false;
+  if (tr->pending) tr->superseded++;
+  tr->last_sample_us = sample_us;
+  tr->sample_us = sample_us;
+  tr->ui_us = now_us;
+  tr->pending = true;
+  return true;
+}
+
+bool latency_trace_flush(LatencyTrace *tr, uint32_t now_us,
+                         uint32_t *sample_to_ui_us, uint32_t *sample_to_pixel_us) {
+  if (!tr || !tr->pending) return false;
+  tr->pending = false;
+  // Unsigned differences stay correct across the micros() wrap.
+  if (sample_to_ui_us) *sample_to_ui_us = tr->ui_us - tr->sample_us;
+  if (sample_to_pixel_us) *sample_to_pixel_us = now_us - tr->sample_us;
+  return true;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+// Sample-to-pixel tracer. The UI reports which IMU sample (by its micros()
+// timestamp) it just put into the widgets; the next completed panel flush
+// closes the trace. If the UI moves on to a newer sample before any frame is
+// flushed, the older one is superseded and never reported.
+
+struct LatencyTrace {
+  uint32_t sample_us;       // IMU read time of the pending sample
+  uint32_t ui_us;           // when the UI consumed it
+  uint32_t last_sample_us;  // last sample seen by latency_trace_ui()
+  uint32_t superseded;
+  bool pending;
+};
+
+void latency_trace_reset(LatencyTrace *tr);
+
+// The UI consumed the sample taken at sample_us; 0 means "no IMU sample"
+// (boot seed, frozen readout). Returns true when the sample is new.
+bool latency_trace_ui(LatencyTrace *tr, uint32_t sample_us, uint32_t now_us);
+
+// A frame finished flushing at now_us. Returns true, with both latencies,
+// when it carried a pending sample.
+bool latency_trace_flush(LatencyTrace *tr, uint32_t now_us,
+                         uint32_t *sample_to_ui_us, uint32_t *sample_to_pixel_us);
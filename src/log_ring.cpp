@@ -0,0 +1,53 @@
+#include "log_ring.h"
+
+#include <string.h>
+
+void log_ring_init(LogRing *ring, uint8_t *storage, size_t cap) {
+  if (!ring) return;
+  memset(ring, 0, sizeof(*ring));
+  ring->buf = storage;
+  ring->cap = storage ? cap : 0;
+}
+
+bool log_ring_write(LogRing *ring, const uint8_t *data, size_t len) {
+  if (!ring) return false;
+  if (len == 0) return true;
+  if (!data || len > ring->cap - ring->used) {
+    ring->dropped_bytes += (uint32_t)len;
+    ring->dropped_writes++;
+    return false;
+  }
+
+  size_t tail = ring->head + ring->used;
+  if (tail >= ring->cap) tail -= ring->cap;
+  const size_t first = (len < ring->cap - tail) ? len : ring->cap - tail;
+  memcpy(ring->buf + tail, data, first);
+  memcpy(ring->buf, data + first, len - first);
+
+  ring->used += len;
+  ring->written_bytes += (uint32_t)len;
+  if (ring->used > ring->high_water) ring->high_water = ring->used;
+  return true;
+}
+
+size_t log_ring_peek(const LogRing &ring, uint8_t *out, size_t max) {
+  if (!out) return 0;
+  const size_t n = (max < ring.used) ? max : ring.used;
+  const size_t first = (n < ring.cap - ring.head) ? n : ring.cap - ring.head;
+  memcpy(out, ring.buf + ring.head, first);
+  memcpy(out + first, ring.buf, n - first);
+  return n;
+}
+
+void log_ring_consume(LogRing *ring, size_t len) {
+  if (!ring) return;
+  if (len > ring->used) len = ring->used;
+  ring->head += len;
+  if (ring->head >= ring->cap) ring->head -= ring->cap;
+  ring->used -= len;
+  if (ring->used == 0) ring->head = 0;
+}
+
+size_t log_ring_free(const LogRing &ring) {
+  return ring.cap - ring.used;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Byte FIFO behind the serial logger. A write is stored whole or not at all
+// (a half-written line or telemetry frame is worse than a missing one), and
+// every refusal is counted. Not thread-safe by itself: the firmware wraps
+// each call in a short critical section (src/serial_log.cpp).
+
+struct LogRing {
+  uint8_t *buf;
+  size_t cap;
+  size_t head;  // next byte to read
+  size_t used;
+  size_t high_water;
+  uint32_t written_bytes;
+  uint32_t dropped_bytes;
+  uint32_t dropped_writes;
+};
+
+void log_ring_init(LogRing *ring, uint8_t *storage, size_t cap);
+
+// False (and counted as dropped) when `len` bytes do not fit.
+bool log_ring_write(LogRing *ring, const uint8_t *data, size_t len);
+
+// Copy up to `max` of the oldest bytes without consuming them.
+size_t log_ring_peek(const LogRing &ring, uint8_t *out, size_t max);
+void log_ring_consume(LogRing *ring, size_t len);
+
+size_t log_ring_free(const LogRing &ring);
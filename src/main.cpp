@@ -1,20 +1,57 @@
 #include "ui_lvgl.h"
 #include "inclinometer_shared.h"
 #include "remote_control.h"
+#include "power_manager.h"
+#include "flight_log.h"
 
 void setup_inclinometer();
+void setup_inclinometer_sensors();
 void loop_inclinometer();
 
+static BootTimeline boot_timeline;
+static portMUX_TYPE boot_timeline_mux = portMUX_INITIALIZER_UNLOCKED;
+
+void bootStageBegin(BootStage stage)
+{
+  const uint32_t now = micros();
+  portENTER_CRITICAL(&boot_timeline_mux);
+  boot_timeline_begin(&boot_timeline, stage, now);
+  portEXIT_CRITICAL(&boot_timeline_mux);
+}
+
+void bootStageEnd(BootStage stage)
+{
+  const uint32_t now = micros();
+  portENTER_CRITICAL(&boot_timeline_mux);
+  boot_timeline_end(&boot_timeline, stage, now);
+  portEXIT_CRITICAL(&boot_timeline_mux);
+}
+
+void getBootTimeline(BootTimeline *out)
+{
+  if (!out) return;
+  portENTER_CRITICAL(&boot_timeline_mux);
+  *out = boot_timeline;
+  portEXIT_CRITICAL(&boot_timeline_mux);
+}
+
 void setup()
 {
-  setup_inclinometer();
-  setup_display();
-  setup_remote_control();
+  flight_log_begin();            // recover the previous run's events before anything logs
+  bootStageBegin(BOOT_STAGE_SETUP);
+  bootStageBegin(BOOT_STAGE_FIRST_READING);
+  setup_inclinometer();         // settings (EEPROM or RTC snapshot)
+  power_manager_begin();        // DFS / light sleep; loops hold PM locks while busy
+  setup_display();              // splash + LVGL task, which holds until the first reading
+  setup_remote_control();       // config load + Wi-Fi/AP in a one-shot task
+  setup_inclinometer_sensors(); // IMU, calibration, touch while both of the above run
+  bootStageEnd(BOOT_STAGE_SETUP);
 }
 
 void loop()
 {
   loop_inclinometer();   // updates roll & pitch
   loop_remote_control(); // handles phone web UI + API
-  loop_display();        // updates LVGL
+  flight_log_poll(millis());
+  // LVGL runs in its own task (see setup_display)
 }
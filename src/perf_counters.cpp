@@ -0,0 +1,218 @@
+#include "perf_counters.h"
+#include "perf_stats.h"
+#include "serial_log.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#if PERF_COUNTERS_ENABLED
+
+#include <esp_heap_caps.h>
+
+// ============================================================
+// STATE
+// ============================================================
+
+static const uint8_t perfMaxTasks = 6;
+
+static const char *const perfStageNames[PERF_STAGE_COUNT] = {
+  "imu_read", "fusion", "workflows", "battery", "serial", "http", "lvgl", "flush",
+  "sample_to_ui", "sample_to_pixel", "marker_to_pixel", "state_json"
+};
+static const char *const perfEventNames[PERF_EVENT_COUNT] = {
+  "imu_no_sample", "http_request", "frame_rendered", "serial_command"
+};
+
+struct PerfTask {
+  const char *name;
+  TaskHandle_t handle;
+};
+
+// Stages are recorded from the sensor loop (core 1) and the LVGL task
+// (core 0); one short critical section per record.
+static PerfHistogram perf_hist[PERF_STAGE_COUNT];
+static uint32_t perf_events[PERF_EVENT_COUNT];
+static uint32_t perf_window_start_ms = 0;
+static PerfTask perf_tasks[perfMaxTasks];
+static uint8_t perf_task_count = 0;
+static portMUX_TYPE perf_mux = portMUX_INITIALIZER_UNLOCKED;
+
+struct PerfSnapshot {
+  PerfHistogram hist[PERF_STAGE_COUNT];
+  uint32_t events[PERF_EVENT_COUNT];
+  uint32_t window_ms;
+};
+
+// Large for a stack: both report paths run in the loop task.
+static PerfSnapshot perf_snapshot;
+
+void perf_record_us(PerfStage stage, uint32_t us)
+{
+  if (stage >= PERF_STAGE_COUNT) return;
+  portENTER_CRITICAL(&perf_mux);
+  perf_hist_record(&perf_hist[stage], us);
+  portEXIT_CRITICAL(&perf_mux);
+}
+
+void perf_count(PerfEvent event)
+{
+  if (event >= PERF_EVENT_COUNT) return;
+  portENTER_CRITICAL(&perf_mux);
+  perf_events[event]++;
+  portEXIT_CRITICAL(&perf_mux);
+}
+
+void perf_register_task(const char *name)
+{
+  const TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  portENTER_CRITICAL(&perf_mux);
+  bool known = false;
+  for (uint8_t i = 0; i < perf_task_count; i++) {
+    if (perf_tasks[i].handle == self) known = true;
+  }
+  if (!known && perf_task_count < perfMaxTasks) {
+    perf_tasks[perf_task_count].name = name;
+    perf_tasks[perf_task_count].handle = self;
+    perf_task_count++;
+  }
+  portEXIT_CRITICAL(&perf_mux);
+}
+
+void perf_reset(void)
+{
+  portENTER_CRITICAL(&perf_mux);
+  for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++) perf_hist_reset(&perf_hist[i]);
+  for (uint8_t i = 0; i < PERF_EVENT_COUNT; i++) perf_events[i] = 0;
+  perf_window_start_ms = millis();
+  portEXIT_CRITICAL(&perf_mux);
+}
+
+static void perf_take_snapshot(void)
+{
+  const uint32_t now = millis();
+  portENTER_CRITICAL(&perf_mux);
+  memcpy(perf_snapshot.hist, perf_hist, sizeof(perf_hist));
+  memcpy(perf_snapshot.events, perf_events, sizeof(perf_events));
+  perf_snapshot.window_ms = now - perf_window_start_ms;
+  portEXIT_CRITICAL(&perf_mux);
+}
+
+// Registered tasks only live as long as the firmware (none of them exits),
+// so the handles stay valid.
+static uint32_t perf_task_stack_free_bytes(uint8_t i)
+{
+  // ESP-IDF reports the high-water mark in bytes.
+  return (uint32_t)uxTaskGetStackHighWaterMark(perf_tasks[i].handle);
+}
+
+// ============================================================
+// REPORTS
+// ============================================================
+
+void perf_print_report(void)
+{
+  perf_take_snapshot();
+  SerialLog.println();
+  SerialLog.printf("===== PERF (%lu ms window) =====\n", (unsigned long)perf_snapshot.window_ms);
+  SerialLog.printf("%-15s %7s %7s %7s %7s %7s %7s  (us)\n", "stage", "n", "min", "avg", "p50", "p99", "max");
+  for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++) {
+    const PerfHistogram &h = perf_snapshot.hist[i];
+    SerialLog.printf("%-15s %7lu %7lu %7lu %7lu %7lu %7lu\n",
+                     perfStageNames[i], (unsigned long)h.count, (unsigned long)h.min_us,
+                     (unsigned long)perf_hist_mean_us(h),
+                     (unsigned long)perf_hist_percentile_us(h, 50),
+                     (unsigned long)perf_hist_percentile_us(h, 99),
+                     (unsigned long)h.max_us);
+  }
+  SerialLog.print("Events:");
+  for (uint8_t i = 0; i < PERF_EVENT_COUNT; i++) {
+    SerialLog.printf(" %s=%lu", perfEventNames[i], (unsigned long)perf_snapshot.events[i]);
+  }
+  SerialLog.println();
+  SerialLog.printf("Heap internal: free %lu B, min free %lu B, largest block %lu B; PSRAM free %lu B\n",
+                   (unsigned long)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+                   (unsigned long)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+                   (unsigned long)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL),
+                   (unsigned long)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+  SerialLog.print("Stack free (min):");
+  for (uint8_t i = 0; i < perf_task_count; i++) {
+    SerialLog.printf(" %s %lu B", perf_tasks[i].name, (unsigned long)perf_task_stack_free_bytes(i));
+  }
+  SerialLog.println();
+  SerialLog.println("================================");
+}
+
+// Append at out + *len; clears *ok (and stops appending) once it does not fit.
+static void perf_appendf(char *out, size_t size, size_t *len, bool *ok, const char *fmt, ...)
+  __attribute__((format(printf, 5, 6)));
+
+static void perf_appendf(char *out, size_t size, size_t *len, bool *ok, const char *fmt, ...)
+{
+  if (!*ok) return;
+  va_list args;
+  va_start(args, fmt);
+  const int n = vsnprintf(out + *len, size - *len, fmt, args);
+  va_end(args);
+  if (n < 0 || (size_t)n >= size - *len) {
+    *ok = false;
+    return;
+  }
+  *len += (size_t)n;
+}
+
+size_t perf_format_json(char *out, size_t size)
+{
+  if (!out || size == 0) return 0;
+  perf_take_snapshot();
+  size_t len = 0;
+  bool ok = true;
+
+  perf_appendf(out, size, &len, &ok, "{\"enabled\":true,\"window_ms\":%lu,\"stages\":{", (unsigned long)perf_snapshot.window_ms);
+  for (uint8_t i = 0; i < PERF_STAGE_COUNT && ok; i++) {
+    perf_appendf(out, size, &len, &ok, "%s\"%s\":", i ? "," : "", perfStageNames[i]);
+    if (!ok) break;
+    const size_t n = perf_hist_format_json(perf_snapshot.hist[i], out + len, size - len);
+    ok = (n != 0);
+    len += n;
+  }
+  perf_appendf(out, size, &len, &ok, "},\"events\":{");
+  for (uint8_t i = 0; i < PERF_EVENT_COUNT; i++) {
+    perf_appendf(out, size, &len, &ok, "%s\"%s\":%lu", i ? "," : "", perfEventNames[i], (unsigned long)perf_snapshot.events[i]);
+  }
+  perf_appendf(out, size, &len, &ok, "},\"heap\":{\"internal_free\":%lu,\"internal_min_free\":%lu,\"internal_largest\":%lu,\"psram_free\":%lu}",
+               (unsigned long)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+               (unsigned long)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+               (unsigned long)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL),
+               (unsigned long)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+  perf_appendf(out, size, &len, &ok, ",\"tasks\":[");
+  for (uint8_t i = 0; i < perf_task_count; i++) {
+    perf_appendf(out, size, &len, &ok, "%s{\"name\":\"%s\",\"stack_free_min\":%lu}", i ? "," : "", perf_tasks[i].name,
+                 (unsigned long)perf_task_stack_free_bytes(i));
+  }
+  perf_appendf(out, size, &len, &ok, "]}");
+
+  if (!ok) {
+    out[0] = '\0';
+    return 0;
+  }
+  return len;
+}
+
+#else
+
+void perf_print_report(void)
+{
+  SerialLog.println("Perf counters are disabled in this build (PERF_COUNTERS_ENABLED=0)");
+}
+
+size_t perf_format_json(char *out, size_t size)
+{
+  const int n = snprintf(out, size, "{\"enabled\":false}");
+  return (n < 0 || (size_t)n >= size) ? 0 : (size_t)n;
+}
+
+void perf_reset(void)
+{
+}
+
+#endif
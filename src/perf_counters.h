@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Stage timings and event counters for the firmware loops, dumped with the
+// serial `P` command and GET /api/perf. Build with -D PERF_COUNTERS_ENABLED=0
+// and every PERF_* macro below expands to nothing.
+
+#ifndef PERF_COUNTERS_ENABLED
+#define PERF_COUNTERS_ENABLED 1
+#endif
+
+enum PerfStage : uint8_t {
+  PERF_STAGE_IMU_READ = 0,    // one QMI8658 sample over I2C
+  PERF_STAGE_FUSION,          // remap, bias, complementary filter, display angles
+  PERF_STAGE_WORKFLOWS,       // zero / offset cal / alignment capture
+  PERF_STAGE_BATTERY,         // updateBatteryTelemetry()
+  PERF_STAGE_SERIAL,          // handleSerial()
+  PERF_STAGE_HTTP,            // server.handleClient()
+  PERF_STAGE_LVGL,            // lv_timer_handler(), flush included
+  PERF_STAGE_FLUSH,           // display flush callback
+  PERF_STAGE_SAMPLE_TO_UI,    // IMU read -> ui_refresh() picked the angles up
+  PERF_STAGE_SAMPLE_TO_PIXEL, // IMU read -> first frame with them flushed
+  PERF_STAGE_MARKER_TO_PIXEL, // latency marker: crossing sample -> flushed
+  PERF_STAGE_STATE_JSON,      // /api/state body: float formatting + snprintf
+  PERF_STAGE_COUNT
+};
+
+enum PerfEvent : uint8_t {
+  PERF_EVENT_IMU_NO_SAMPLE = 0,
+  PERF_EVENT_HTTP_REQUEST,
+  PERF_EVENT_FRAME_RENDERED,
+  PERF_EVENT_SERIAL_COMMAND,
+  PERF_EVENT_COUNT
+};
+
+#if PERF_COUNTERS_ENABLED
+
+#include <Arduino.h>
+
+void perf_record_us(PerfStage stage, uint32_t us);
+void perf_count(PerfEvent event);
+// Track the calling task's stack high-water mark in the report.
+void perf_register_task(const char *name);
+
+class PerfScopeTimer {
+ public:
+  explicit PerfScopeTimer(PerfStage stage) : stage_(stage), start_us_(micros()) {}
+  ~PerfScopeTimer() { perf_record_us(stage_, micros() - start_us_); }
+  PerfScopeTimer(const PerfScopeTimer &) = delete;
+  PerfScopeTimer &operator=(const PerfScopeTimer &) = delete;
+
+ private:
+  PerfStage stage_;
+  uint32_t start_us_;
+};
+
+#define PERF_CONCAT_INNER(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_INNER(a, b)
+// Times the rest of the enclosing block.
+#define PERF_SCOPE(stage) PerfScopeTimer PERF_CONCAT(perf_scope_, __LINE__)(stage)
+// For a stage that is not a block of its own: mark, then record later.
+#define PERF_MARK(name) const uint32_t name = micros()
+#define PERF_RECORD_SINCE(stage, name) perf_record_us((stage), micros() - (name))
+#define PERF_RECORD(stage, us) perf_record_us((stage), (us))
+#define PERF_COUNT(event) perf_count(event)
+#define PERF_REGISTER_TASK(name) perf_register_task(name)
+
+#else
+
+#define PERF_SCOPE(stage) ((void)0)
+#define PERF_MARK(name) ((void)0)
+#define PERF_RECORD_SINCE(stage, name) ((void)0)
+#define PERF_RECORD(stage, us) ((void)0)
+#define PERF_COUNT(event) ((void)0)
+#define PERF_REGISTER_TASK(name) ((void)0)
+
+#endif
+
+// Report since the last reset: serial table, or a JSON object
+// ({"enabled":false} when compiled out). perf_format_json returns the length
+// written, or 0 if `size` is too small.
+void perf_print_report(void);
+size_t perf_format_json(char *out, size_t size);
+void perf_reset(void);
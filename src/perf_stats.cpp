@@ -0,0 +1,83 @@
+#include "perf_stats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+
+uint8_t msb_index(uint32_t v) {
+  uint8_t i = 0;
+  while (v >>= 1) ++i;
+  return i;
+}
+
+}  // namespace
+
+void perf_hist_reset(PerfHistogram *h) {
+  if (!h) return;
+  memset(h, 0, sizeof(*h));
+}
+
+uint8_t perf_hist_bucket(uint32_t us) {
+  if (us < PERF_HIST_SUB_BUCKETS) return (uint8_t)us;
+  const uint8_t octave = msb_index(us) - 1;  // 1 for 4..7 us
+  if (octave >= PERF_HIST_MAX_OCTAVE) return PERF_HIST_BUCKETS - 1;
+  const uint8_t sub = (uint8_t)((us >> (octave - 1)) & (PERF_HIST_SUB_BUCKETS - 1));
+  return (uint8_t)(PERF_HIST_SUB_BUCKETS * octave + sub);
+}
+
+uint32_t perf_hist_bucket_upper_us(uint8_t bucket) {
+  if (bucket < PERF_HIST_SUB_BUCKETS) return bucket;
+  if (bucket >= PERF_HIST_BUCKETS - 1) return UINT32_MAX;
+  const uint8_t octave = bucket / PERF_HIST_SUB_BUCKETS;
+  const uint8_t sub = bucket % PERF_HIST_SUB_BUCKETS;
+  const uint32_t step = 1UL << (octave - 1);
+  return (PERF_HIST_SUB_BUCKETS + sub) * step + step - 1;
+}
+
+void perf_hist_record(PerfHistogram *h, uint32_t us) {
+  if (!h) return;
+  if (h->count == 0 || us < h->min_us) h->min_us = us;
+  if (us > h->max_us) h->max_us = us;
+  h->count++;
+  h->sum_us += us;
+  h->buckets[perf_hist_bucket(us)]++;
+}
+
+uint32_t perf_hist_mean_us(const PerfHistogram &h) {
+  return h.count ? (uint32_t)(h.sum_us / h.count) : 0;
+}
+
+uint32_t perf_hist_percentile_us(const PerfHistogram &h, uint8_t pct) {
+  if (h.count == 0) return 0;
+  if (pct > 100) pct = 100;
+  // Rank of the sample at pct, 1-based, rounded up.
+  uint64_t rank = ((uint64_t)h.count * pct + 99) / 100;
+  if (rank == 0) rank = 1;
+  uint64_t seen = 0;
+  for (uint8_t b = 0; b < PERF_HIST_BUCKETS; ++b) {
+    seen += h.buckets[b];
+    if (seen >= rank) {
+      const uint32_t upper = perf_hist_bucket_upper_us(b);
+      if (upper > h.max_us) return h.max_us;
+      return (upper < h.min_us) ? h.min_us : upper;
+    }
+  }
+  return h.max_us;
+}
+
+size_t perf_hist_format_json(const PerfHistogram &h, char *out, size_t size) {
+  if (!out || size == 0) return 0;
+  const int n = snprintf(out, size,
+                         "{\"n\":%lu,\"min_us\":%lu,\"avg_us\":%lu,\"p50_us\":%lu,\"p99_us\":%lu,\"max_us\":%lu}",
+                         (unsigned long)h.count, (unsigned long)h.min_us,
+                         (unsigned long)perf_hist_mean_us(h),
+                         (unsigned long)perf_hist_percentile_us(h, 50),
+                         (unsigned long)perf_hist_percentile_us(h, 99),
+                         (unsigned long)h.max_us);
+  if (n < 0 || (size_t)n >= size) {
+    out[0] = '\0';
+    return 0;
+  }
+  return (size_t)n;
+}
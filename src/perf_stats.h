@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Duration histogram behind the performance counters (src/perf_counters.h).
+// Exact count/min/max/sum plus log-linear buckets: four per power of two,
+// so a percentile read back from the buckets is within 25 % of the true
+// value. Durations of 2^18 us (262 ms) and above share the last bucket.
+
+constexpr uint8_t PERF_HIST_SUB_BUCKETS = 4;
+constexpr uint8_t PERF_HIST_MAX_OCTAVE = 17;
+// 0..3 us, then octaves 1..16 (4..262143 us), then the overflow bucket.
+constexpr uint8_t PERF_HIST_BUCKETS = PERF_HIST_SUB_BUCKETS * PERF_HIST_MAX_OCTAVE + 1;
+
+struct PerfHistogram {
+  uint32_t count;
+  uint32_t min_us;
+  uint32_t max_us;
+  uint64_t sum_us;
+  uint32_t buckets[PERF_HIST_BUCKETS];
+};
+
+void perf_hist_reset(PerfHistogram *h);
+void perf_hist_record(PerfHistogram *h, uint32_t us);
+
+uint8_t perf_hist_bucket(uint32_t us);
+// Largest duration that still lands in `bucket`.
+uint32_t perf_hist_bucket_upper_us(uint8_t bucket);
+
+// 0 while the histogram is empty.
+uint32_t perf_hist_mean_us(const PerfHistogram &h);
+// Upper edge of the bucket holding the pct-th percentile, never above max.
+uint32_t perf_hist_percentile_us(const PerfHistogram &h, uint8_t pct);
+
+// {"n":615,"min_us":412,"avg_us":455,"p50_us":447,"p99_us":639,"max_us":1210}
+// Returns the length written, or 0 if `size` is too small.
+size_t perf_hist_format_json(const PerfHistogram &h, char *out, size_t size);
@@ -0,0 +1,195 @@
+#include "power_manager.h"
+#include "battery_model.h"
+#include <esp_idf_version.h>
+#include <esp_pm.h>
+#include "inclinometer_shared.h"
+#include "ui_lvgl.h"
+#include "serial_log.h"
+
+// ============================================================
+// PM CONFIG
+// ============================================================
+
+static const uint16_t powerCpuMaxMhz = 240;
+static const uint16_t powerCpuMinMhz = 80;
+static const uint32_t powerStatsWindowMs = 2000;
+
+static const char *const powerLockNames[POWER_LOCK_COUNT] = {"fusion", "ui", "http"};
+
+static PowerCpuMode pm_mode = POWER_CPU_FIXED;
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t pm_locks[POWER_LOCK_COUNT] = {};
+#endif
+
+// Busy-time bookkeeping (micros), guarded by power_mux.
+static portMUX_TYPE power_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t lock_depth[POWER_LOCK_COUNT] = {};
+static uint32_t lock_since_us[POWER_LOCK_COUNT] = {};
+static uint64_t lock_busy_us[POWER_LOCK_COUNT] = {};
+static uint8_t locks_held = 0;
+static uint32_t any_since_us = 0;
+static uint64_t any_busy_us = 0;
+
+static PowerWifiMode wifi_mode = POWER_WIFI_OFF;
+static uint32_t window_start_ms = 0;
+static uint64_t window_lock_us[POWER_LOCK_COUNT] = {};
+static uint64_t window_any_us = 0;
+static PowerStats power_stats = {};
+
+// ============================================================
+// SETUP
+// ============================================================
+
+#if CONFIG_PM_ENABLE
+static esp_err_t configure_pm(bool light_sleep)
+{
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_pm_config_t cfg = {};
+#else
+  esp_pm_config_esp32s3_t cfg = {};
+#endif
+  cfg.max_freq_mhz = powerCpuMaxMhz;
+  cfg.min_freq_mhz = powerCpuMinMhz;
+  cfg.light_sleep_enable = light_sleep;
+  return esp_pm_configure(&cfg);
+}
+#endif
+
+void power_manager_begin(void)
+{
+  window_start_ms = millis();
+#if CONFIG_PM_ENABLE
+  for (uint8_t i = 0; i < POWER_LOCK_COUNT; i++) {
+    if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, powerLockNames[i], &pm_locks[i]) != ESP_OK) {
+      pm_locks[i] = nullptr;
+    }
+  }
+  // Auto light sleep needs a framework built with tickless idle; stock
+  // Arduino-ESP32 rejects it, so fall back to frequency scaling alone.
+  esp_err_t err = configure_pm(true);
+  if (err == ESP_OK) {
+    pm_mode = POWER_CPU_LIGHT_SLEEP;
+  } else {
+    err = configure_pm(false);
+    pm_mode = (err == ESP_OK) ? POWER_CPU_DFS : POWER_CPU_FIXED;
+  }
+  SerialLog.print("Power: ");
+  SerialLog.print(power_cpu_mode_name(pm_mode));
+  if (err != ESP_OK) {
+    SerialLog.print(" (esp_pm_configure failed: ");
+    SerialLog.print((int)err);
+    SerialLog.print(")");
+  }
+  SerialLog.println();
+#else
+  SerialLog.println("Power: FIXED (framework built without CONFIG_PM_ENABLE)");
+#endif
+}
+
+// ============================================================
+// LOCKS
+// ============================================================
+
+void power_lock_acquire(PowerLockId id)
+{
+  if (id >= POWER_LOCK_COUNT) return;
+#if CONFIG_PM_ENABLE
+  if (pm_locks[id]) esp_pm_lock_acquire(pm_locks[id]);
+#endif
+  const uint32_t now = micros();
+  portENTER_CRITICAL(&power_mux);
+  if (lock_depth[id]++ == 0) {
+    lock_since_us[id] = now;
+    if (locks_held++ == 0) any_since_us = now;
+  }
+  portEXIT_CRITICAL(&power_mux);
+}
+
+void power_lock_release(PowerLockId id)
+{
+  if (id >= POWER_LOCK_COUNT) return;
+  const uint32_t now = micros();
+  portENTER_CRITICAL(&power_mux);
+  if (lock_depth[id] > 0 && --lock_depth[id] == 0) {
+    lock_busy_us[id] += now - lock_since_us[id];
+    if (locks_held > 0 && --locks_held == 0) any_busy_us += now - any_since_us;
+  }
+  portEXIT_CRITICAL(&power_mux);
+#if CONFIG_PM_ENABLE
+  if (pm_locks[id]) esp_pm_lock_release(pm_locks[id]);
+#endif
+}
+
+// ============================================================
+// STATS / BATTERY ESTIMATE
+// ============================================================
+
+void power_manager_set_wifi_mode(PowerWifiMode mode)
+{
+  portENTER_CRITICAL(&power_mux);
+  wifi_mode = mode;
+  portEXIT_CRITICAL(&power_mux);
+}
+
+void power_manager_update(uint32_t now_ms)
+{
+  const uint32_t window_ms = now_ms - window_start_ms;
+  if (window_ms < powerStatsWindowMs) return;
+
+  // Busy totals including locks still held right now.
+  const uint32_t now_us = micros();
+  uint64_t lock_us[POWER_LOCK_COUNT];
+  portENTER_CRITICAL(&power_mux);
+  for (uint8_t i = 0; i < POWER_LOCK_COUNT; i++) {
+    lock_us[i] = lock_busy_us[i] + (lock_depth[i] ? (uint64_t)(now_us - lock_since_us[i]) : 0);
+  }
+  const uint64_t any_us = any_busy_us + (locks_held ? (uint64_t)(now_us - any_since_us) : 0);
+  const PowerWifiMode wifi = wifi_mode;
+  portEXIT_CRITICAL(&power_mux);
+
+  const float window_us = (float)window_ms * 1000.0f;
+  PowerStats s = {};
+  s.cpu_mode = pm_mode;
+  s.cpu_max_mhz = powerCpuMaxMhz;
+  s.cpu_min_mhz = (pm_mode == POWER_CPU_FIXED) ? powerCpuMaxMhz : powerCpuMinMhz;
+  s.wifi_mode = wifi;
+  for (uint8_t i = 0; i < POWER_LOCK_COUNT; i++) {
+    s.busy_pct[i] = 100.0f * (float)(lock_us[i] - window_lock_us[i]) / window_us;
+    window_lock_us[i] = lock_us[i];
+  }
+  s.busy_any_pct = 100.0f * (float)(any_us - window_any_us) / window_us;
+  window_any_us = any_us;
+  window_start_ms = now_ms;
+
+  DisplayRenderStats render = {};
+  getDisplayRenderStats(&render);
+  PowerModelInput in = {};
+  in.cpu_busy_frac = s.busy_any_pct / 100.0f;
+  in.display = render.power_state;
+  in.brightness_percent = render.brightness_percent;
+  in.wifi = wifi;
+  for (uint8_t m = 0; m < POWER_CPU_MODE_COUNT; m++) {
+    in.cpu = (PowerCpuMode)m;
+    s.life_h[m] = power_model_runtime_h(BATTERY_CAPACITY_MAH, power_model_current_ma(in));
+  }
+  in.cpu = pm_mode;
+  s.est_ma = power_model_current_ma(in);
+
+  BatteryTelemetry battery = {};
+  getBatteryTelemetry(&battery);
+  if (battery.valid && battery.present) {
+    s.remaining_h = battery_model_time_to_empty_h(battery.soc_percent, BATTERY_CAPACITY_MAH, s.est_ma);
+  }
+
+  portENTER_CRITICAL(&power_mux);
+  power_stats = s;
+  portEXIT_CRITICAL(&power_mux);
+}
+
+void power_manager_get_stats(PowerStats *out)
+{
+  if (!out) return;
+  portENTER_CRITICAL(&power_mux);
+  *out = power_stats;
+  portEXIT_CRITICAL(&power_mux);
+}
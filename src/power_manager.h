@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+#include "power_model.h"
+
+// ESP-IDF power management: dynamic frequency scaling (240 <-> 80 MHz) and,
+// where the framework is built with tickless idle, automatic light sleep
+// between IMU samples. Work that must run at full clock holds a PM lock for
+// its duration; with no lock held the chip drops to 80 MHz / light sleep.
+
+// Rated capacity of the attached cell, for the runtime estimate.
+#ifndef BATTERY_CAPACITY_MAH
+#define BATTERY_CAPACITY_MAH 1000
+#endif
+
+enum PowerLockId : uint8_t {
+  POWER_LOCK_FUSION = 0,  // IMU read + fusion + serial/button handling
+  POWER_LOCK_UI,          // LVGL service pass (render + flush)
+  POWER_LOCK_HTTP,        // one web request handler
+  POWER_LOCK_COUNT
+};
+
+void power_manager_begin(void);
+
+// Nestable per id; safe from any task.
+void power_lock_acquire(PowerLockId id);
+void power_lock_release(PowerLockId id);
+
+class PowerLockScope {
+ public:
+  explicit PowerLockScope(PowerLockId id) : id_(id) { power_lock_acquire(id_); }
+  ~PowerLockScope() { power_lock_release(id_); }
+  PowerLockScope(const PowerLockScope &) = delete;
+  PowerLockScope &operator=(const PowerLockScope &) = delete;
+
+ private:
+  PowerLockId id_;
+};
+
+// Reported by the network layer whenever the radio configuration changes.
+void power_manager_set_wifi_mode(PowerWifiMode mode);
+
+// Advance the busy-time window (call from the main loop).
+void power_manager_update(uint32_t now_ms);
+
+struct PowerStats {
+  PowerCpuMode cpu_mode;             // what esp_pm_configure() accepted
+  uint16_t cpu_max_mhz;
+  uint16_t cpu_min_mhz;
+  PowerWifiMode wifi_mode;
+  float busy_pct[POWER_LOCK_COUNT];  // share of the last window each lock was held
+  float busy_any_pct;                // share with any lock held (CPU at full clock)
+  float est_ma;                      // model current in the present state
+  float life_h[POWER_CPU_MODE_COUNT];// full-charge runtime per CPU mode, present state otherwise
+  float remaining_h;                 // at the current SOC, present mode
+};
+void power_manager_get_stats(PowerStats *out);
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "display_power_policy.h"
+
+// Battery-current model for comparing power-management modes.
+//
+// The estimate adds up typical supply currents per block (ESP32-S3 and
+// radio from the datasheet, AMOLED panel as a function of brightness) and
+// weights the CPU by the measured fraction of time work was pending. It is a
+// relative yardstick (fixed clock vs DFS vs auto light sleep, Wi-Fi on/off),
+// not a fuel gauge.
+
+enum PowerCpuMode : uint8_t {
+  POWER_CPU_FIXED = 0,        // full clock, idle task spins in WAITI at 240 MHz
+  POWER_CPU_DFS = 1,          // 80 MHz whenever no PM lock is held
+  POWER_CPU_LIGHT_SLEEP = 2,  // DFS plus automatic light sleep when idle
+  POWER_CPU_MODE_COUNT = 3
+};
+
+enum PowerWifiMode : uint8_t {
+  POWER_WIFI_OFF = 0,
+  POWER_WIFI_AP = 1,              // soft-AP (or AP+STA): radio always listening
+  POWER_WIFI_STA_ACTIVE = 2,      // station, power save off
+  POWER_WIFI_STA_MODEM_SLEEP = 3, // station, modem sleep between DTIM beacons
+  POWER_WIFI_MODE_COUNT = 4
+};
+
+struct PowerModelInput {
+  PowerCpuMode cpu;
+  float cpu_busy_frac;           // 0..1, time with a PM lock held
+  DisplayPowerState display;
+  uint8_t brightness_percent;    // brightness actually driven in `display`
+  PowerWifiMode wifi;
+};
+
+// Average battery current in mA.
+float power_model_current_ma(const PowerModelInput &in);
+
+// Hours to drain `capacity_mah` at `current_ma` (0 if current is not positive).
+float power_model_runtime_h(float capacity_mah, float current_ma);
+
+const char *power_cpu_mode_name(PowerCpuMode mode);
+const char *power_wifi_mode_name(PowerWifiMode mode);
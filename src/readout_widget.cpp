@@ -0,0 +1,307 @@
+// ============================================================
+// readout_widget.cpp — fixed-cell digit renderer for the
+// roll/pitch readouts (LVGL v8.x.y)
+// ============================================================
+
+#include "readout_widget.h"
+#include <string.h>
+
+// ============================================================
+// GLYPH ATLAS
+// ============================================================
+//
+// The readout font is generated uncompressed (4 bpp, no prefilter), so the
+// glyph bitmaps can be read directly from flash. The atlas only caches the
+// descriptor + bitmap pointer per code point to skip the cmap search on
+// every frame.
+
+struct ReadoutGlyph {
+  uint32_t letter;
+  const uint8_t *bitmap;
+  lv_font_glyph_dsc_t dsc;
+};
+
+static const uint32_t kReadoutCharset[] = {
+  ' ', '-', '.', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x00B0
+};
+constexpr int READOUT_ATLAS_SLOTS = 20;
+
+static const lv_font_t *atlas_font = nullptr;
+static ReadoutGlyph atlas[READOUT_ATLAS_SLOTS];
+static int atlas_count = 0;
+static lv_coord_t atlas_digit_cell_w = 0;
+
+static const ReadoutGlyph *atlas_load(uint32_t letter)
+{
+  if (atlas_count >= READOUT_ATLAS_SLOTS) return nullptr;
+  ReadoutGlyph &g = atlas[atlas_count];
+  if (!lv_font_get_glyph_dsc(atlas_font, &g.dsc, letter, 0)) return nullptr;
+  if (g.dsc.bpp != 4) return nullptr;
+  g.letter = letter;
+  g.bitmap = (g.dsc.box_w > 0 && g.dsc.box_h > 0)
+    ? lv_font_get_glyph_bitmap(atlas_font, letter)
+    : nullptr;
+  atlas_count++;
+  return &g;
+}
+
+static void atlas_init(const lv_font_t *font)
+{
+  if (atlas_font == font) return;
+  atlas_font = font;
+  atlas_count = 0;
+  atlas_digit_cell_w = 0;
+
+  for (size_t i = 0; i < sizeof(kReadoutCharset) / sizeof(kReadoutCharset[0]); i++) {
+    const ReadoutGlyph *g = atlas_load(kReadoutCharset[i]);
+    if (g && g->letter >= '0' && g->letter <= '9' && g->dsc.adv_w > atlas_digit_cell_w) {
+      atlas_digit_cell_w = g->dsc.adv_w;
+    }
+  }
+}
+
+static const ReadoutGlyph *atlas_find(uint32_t letter)
+{
+  for (int i = 0; i < atlas_count; i++) {
+    if (atlas[i].letter == letter) return &atlas[i];
+  }
+  return atlas_load(letter);
+}
+
+// ============================================================
+// WIDGET STATE
+// ============================================================
+
+struct ReadoutCell {
+  uint32_t letter;
+  lv_color_t color;
+  lv_coord_t x;   // offset from the layout origin
+  lv_coord_t w;   // cell advance (tabular for digits)
+  lv_color_t lut[16];
+};
+
+struct ReadoutWidgetState {
+  const lv_font_t *font;
+  lv_color_t bg;
+  uint8_t cell_count;
+  lv_coord_t total_w;
+  ReadoutCell cells[READOUT_WIDGET_MAX_CELLS];
+};
+
+static ReadoutWidgetState *state_of(lv_obj_t *obj)
+{
+  return obj ? (ReadoutWidgetState *)lv_obj_get_user_data(obj) : nullptr;
+}
+
+static bool is_digit_letter(uint32_t letter)
+{
+  return letter >= '0' && letter <= '9';
+}
+
+static lv_coord_t cell_width_for(uint32_t letter)
+{
+  if (is_digit_letter(letter)) return atlas_digit_cell_w;
+  const ReadoutGlyph *g = atlas_find(letter);
+  return g ? (lv_coord_t)g->dsc.adv_w : 0;
+}
+
+// Pre-blend the 16 alpha levels of the 4 bpp atlas against the background so
+// the blit is a table lookup per pixel.
+static void build_cell_lut(ReadoutCell &cell, lv_color_t bg)
+{
+  for (int a = 0; a < 16; a++) {
+    cell.lut[a] = lv_color_mix(cell.color, bg, (lv_opa_t)(a * 17));
+  }
+}
+
+static lv_coord_t layout_origin_x(const ReadoutWidgetState *st, const lv_area_t *coords)
+{
+  return coords->x1 + (lv_area_get_width(coords) - st->total_w) / 2;
+}
+
+static bool glyph_area(const ReadoutWidgetState *st,
+                       const lv_area_t *coords,
+                       const ReadoutCell &cell,
+                       lv_area_t *out,
+                       const ReadoutGlyph **out_glyph)
+{
+  const ReadoutGlyph *g = atlas_find(cell.letter);
+  if (out_glyph) *out_glyph = g;
+  if (!g || !g->bitmap) return false;
+
+  const lv_coord_t cell_x = layout_origin_x(st, coords) + cell.x;
+  const lv_coord_t pad_x = (cell.w - (lv_coord_t)g->dsc.adv_w) / 2;
+  out->x1 = cell_x + pad_x + g->dsc.ofs_x;
+  out->y1 = coords->y1 + (st->font->line_height - st->font->base_line) - g->dsc.box_h - g->dsc.ofs_y;
+  out->x2 = out->x1 + g->dsc.box_w - 1;
+  out->y2 = out->y1 + g->dsc.box_h - 1;
+  return true;
+}
+
+static void invalidate_cell(lv_obj_t *obj, const ReadoutWidgetState *st, const ReadoutCell &cell)
+{
+  lv_area_t coords;
+  lv_obj_get_coords(obj, &coords);
+
+  lv_area_t area;
+  area.x1 = layout_origin_x(st, &coords) + cell.x;
+  area.x2 = area.x1 + cell.w - 1;
+  area.y1 = coords.y1;
+  area.y2 = coords.y2;
+
+  lv_area_t glyph;
+  if (glyph_area(st, &coords, cell, &glyph, nullptr)) {
+    _lv_area_join(&area, &area, &glyph);
+  }
+  lv_obj_invalidate_area(obj, &area);
+}
+
+// ============================================================
+// DRAW (direct blit into the LVGL draw buffer)
+// ============================================================
+
+static void blit_cell(lv_draw_ctx_t *draw_ctx,
+                      const ReadoutWidgetState *st,
+                      const lv_area_t *coords,
+                      const ReadoutCell &cell)
+{
+  const ReadoutGlyph *g = nullptr;
+  lv_area_t garea;
+  if (!glyph_area(st, coords, cell, &garea, &g)) return;
+
+  lv_area_t clip;
+  if (!_lv_area_intersect(&clip, &garea, draw_ctx->clip_area)) return;
+
+  lv_color_t *buf = (lv_color_t *)draw_ctx->buf;
+  const lv_area_t *buf_area = draw_ctx->buf_area;
+  const lv_coord_t buf_w = lv_area_get_width(buf_area);
+  const uint32_t box_w = g->dsc.box_w;
+
+  for (lv_coord_t y = clip.y1; y <= clip.y2; y++) {
+    lv_color_t *dst = buf + (int32_t)(y - buf_area->y1) * buf_w + (clip.x1 - buf_area->x1);
+    uint32_t bit = ((uint32_t)(y - garea.y1) * box_w + (uint32_t)(clip.x1 - garea.x1)) * 4U;
+    for (lv_coord_t x = clip.x1; x <= clip.x2; x++, dst++, bit += 4U) {
+      const uint8_t byte = g->bitmap[bit >> 3];
+      const uint8_t alpha = (bit & 4U) ? (byte & 0x0F) : (byte >> 4);
+      if (alpha) *dst = cell.lut[alpha];
+    }
+  }
+}
+
+static void readout_event_cb(lv_event_t *e)
+{
+  const lv_event_code_t code = lv_event_get_code(e);
+  lv_obj_t *obj = lv_event_get_target(e);
+  ReadoutWidgetState *st = state_of(obj);
+  if (!st) return;
+
+  if (code == LV_EVENT_DRAW_MAIN) {
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    if (!draw_ctx || !draw_ctx->buf) return;
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    for (uint8_t i = 0; i < st->cell_count; i++) {
+      blit_cell(draw_ctx, st, &coords, st->cells[i]);
+    }
+  } else if (code == LV_EVENT_DELETE) {
+    lv_obj_set_user_data(obj, nullptr);
+    lv_mem_free(st);
+  }
+}
+
+// ============================================================
+// PUBLIC API
+// ============================================================
+
+lv_obj_t *readout_widget_create(lv_obj_t *parent, const lv_font_t *font)
+{
+  atlas_init(font);
+
+  ReadoutWidgetState *st = (ReadoutWidgetState *)lv_mem_alloc(sizeof(ReadoutWidgetState));
+  if (!st) return nullptr;
+  memset(st, 0, sizeof(*st));
+  st->font = font;
+  st->bg = lv_color_black();
+
+  lv_obj_t *obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(obj);
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_size(obj, lv_pct(100), font->line_height);
+  lv_obj_set_user_data(obj, st);
+  lv_obj_add_event_cb(obj, readout_event_cb, LV_EVENT_ALL, nullptr);
+  return obj;
+}
+
+void readout_widget_set_bg_color(lv_obj_t *obj, lv_color_t bg)
+{
+  ReadoutWidgetState *st = state_of(obj);
+  if (!st || st->bg.full == bg.full) return;
+  st->bg = bg;
+  for (uint8_t i = 0; i < st->cell_count; i++) {
+    build_cell_lut(st->cells[i], bg);
+  }
+  lv_obj_invalidate(obj);
+}
+
+bool readout_widget_set_text(lv_obj_t *obj, const char *text, lv_color_t color)
+{
+  ReadoutWidgetState *st = state_of(obj);
+  if (!st) return false;
+  if (!text) text = "";
+
+  uint32_t letters[READOUT_WIDGET_MAX_CELLS];
+  lv_coord_t widths[READOUT_WIDGET_MAX_CELLS];
+  uint8_t count = 0;
+  lv_coord_t total_w = 0;
+  uint32_t i = 0;
+  while (text[i] != '\0' && count < READOUT_WIDGET_MAX_CELLS) {
+    const uint32_t letter = _lv_txt_encoded_next(text, &i);
+    letters[count] = letter;
+    widths[count] = cell_width_for(letter);
+    total_w += widths[count];
+    count++;
+  }
+
+  bool layout_changed = (count != st->cell_count) || (total_w != st->total_w);
+  for (uint8_t c = 0; c < count && !layout_changed; c++) {
+    if (widths[c] != st->cells[c].w) layout_changed = true;
+  }
+
+  if (layout_changed) {
+    // Different cell structure (sign/integer digits changed): repaint once.
+    st->cell_count = count;
+    st->total_w = total_w;
+    lv_coord_t x = 0;
+    for (uint8_t c = 0; c < count; c++) {
+      ReadoutCell &cell = st->cells[c];
+      cell.letter = letters[c];
+      cell.w = widths[c];
+      cell.x = x;
+      x += widths[c];
+      cell.color = color;
+      build_cell_lut(cell, st->bg);
+    }
+    lv_obj_invalidate(obj);
+    return true;
+  }
+
+  bool changed = false;
+  for (uint8_t c = 0; c < count; c++) {
+    ReadoutCell &cell = st->cells[c];
+    const bool letter_changed = (cell.letter != letters[c]);
+    const bool color_changed = (cell.color.full != color.full);
+    if (!letter_changed && !color_changed) continue;
+
+    // Invalidate the old glyph footprint, then the new one.
+    invalidate_cell(obj, st, cell);
+    cell.letter = letters[c];
+    if (color_changed) {
+      cell.color = color;
+      build_cell_lut(cell, st->bg);
+    }
+    invalidate_cell(obj, st, cell);
+    changed = true;
+  }
+  return changed;
+}
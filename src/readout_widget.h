@@ -0,0 +1,20 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Fixed-cell numeric readout for the roll/pitch values.
+//
+// Glyphs come straight from the font's flash bitmaps (the 4 bpp atlas in
+// lv_font_montserrat_56_num) and are blitted into the LVGL draw buffer through
+// a per-cell color LUT. Digits share one tabular cell width, so a value change
+// only invalidates the cells whose character or color actually changed.
+lv_obj_t *readout_widget_create(lv_obj_t *parent, const lv_font_t *font);
+
+// Set the readout text (UTF-8, up to READOUT_WIDGET_MAX_CELLS glyphs) and the
+// color used for every cell. Returns true if anything was invalidated.
+bool readout_widget_set_text(lv_obj_t *obj, const char *text, lv_color_t color);
+
+// Background the glyph edges are pre-blended against (default: black).
+void readout_widget_set_bg_color(lv_obj_t *obj, lv_color_t bg);
+
+#define READOUT_WIDGET_MAX_CELLS 12
@@ -10,13 +10,25 @@
 #include "remote_control_network.h"
 #include "remote_control_ota.h"
 #include "inclinometer_shared.h"
+#include "power_manager.h"
+#include "perf_counters.h"
+#include "flight_log.h"
+#include "serial_log.h"
 #include "remote_protocol_utils.h"
 #include "ui_lvgl.h"
 
 namespace {
 
 WebServer server(80);
-bool remote_ready = false;
+// Set by the boot task once routes are registered.
+volatile bool remote_ready = false;
+// Touch UI, ACTION and serial ask from their own tasks; the main loop acts.
+volatile bool radio_request_pending = false;
+bool server_started = false;
+
+const uint32_t remoteSetupTaskStackBytes = 6144;
+const UBaseType_t remoteSetupTaskPriority = 1;
+const BaseType_t remoteSetupTaskCore = 0;
 
 uint16_t board_suffix_from_mac() {
   uint8_t mac[6] = {0};
@@ -36,43 +48,104 @@ void log_board_identity() {
   uint8_t mac[6] = {0};
   esp_read_mac(mac, ESP_MAC_WIFI_STA);
   const uint16_t suffix = board_suffix_from_mac();
-  Serial.print("[remote] STA MAC: ");
-  Serial.printf("%02X:%02X:%02X:%02X:%02X:%02X\n",
+  SerialLog.print("[remote] STA MAC: ");
+  SerialLog.printf("%02X:%02X:%02X:%02X:%02X:%02X\n",
     mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
-  Serial.print("[remote] Board suffix: ");
-  Serial.printf("%04X\n", suffix);
+  SerialLog.print("[remote] Board suffix: ");
+  SerialLog.printf("%04X\n", suffix);
 }
 
 void build_default_ap_ssid() {
   const uint16_t suffix = board_suffix_from_mac();
   snprintf(ap_ssid, sizeof(ap_ssid), "IncidencePerfectNG-%04X", suffix);
 }
-}  // namespace
 
-void setup_remote_control(void) {
+void remote_control_bring_up() {
+  bootStageBegin(BOOT_STAGE_NETWORK);
   build_default_ap_ssid();
   log_board_identity();
   load_network_config();
 
   if (action_button_network_recovery_requested()) {
-    Serial.println("[remote] ACTION held at boot -> forcing AP recovery defaults");
+    SerialLog.println("[remote] ACTION held at boot -> forcing AP recovery defaults");
     apply_network_recovery_defaults(true);
     if (!save_network_config()) {
-      Serial.println("[remote] failed to persist AP recovery defaults");
+      SerialLogError.println("[remote] failed to persist AP recovery defaults");
     }
   }
 
-  apply_network_config();
-
   register_remote_control_routes(server);
-  server.begin();
+  if (net_cfg.radio_on_demand) {
+    // The listening socket needs the network stack, which the first
+    // radio start brings up; see loop_remote_control().
+    SerialLog.println("[remote] Wi-Fi on demand: radio off until requested");
+  } else {
+    network_radio_on();
+    server.begin();
+    server_started = true;
+  }
   remote_ready = true;
+  bootStageEnd(BOOT_STAGE_NETWORK);
+}
+
+void remote_setup_task(void *) {
+  remote_control_bring_up();
+  vTaskDelete(nullptr);
+}
+}  // namespace
+
+// Config load and Wi-Fi/AP start take a few hundred ms; run them next to the
+// IMU bring-up and the splash instead of after them.
+void setup_remote_control(void) {
+  if (xTaskCreatePinnedToCore(remote_setup_task, "net_boot", remoteSetupTaskStackBytes, nullptr,
+                              remoteSetupTaskPriority, nullptr, remoteSetupTaskCore) != pdPASS) {
+    remote_control_bring_up();
+  }
 }
 
 void loop_remote_control(void) {
   if (!remote_ready) return;
+  if (radio_request_pending) {
+    radio_request_pending = false;
+    network_radio_on();
+    if (!server_started) {
+      server.begin();
+      server_started = true;
+    }
+  }
+  if (!radio_on) return;
+
   loop_network_manager();
-  server.handleClient();
+  if (!ota_is_upload_in_progress()) update_ap_channel();
+  {
+    PERF_SCOPE(PERF_STAGE_HTTP);
+    const uint32_t start_us = micros();
+    server.handleClient();
+    flight_log_loop_pass(FLIGHT_LOOP_HTTP, micros() - start_us);
+  }
+  update_wifi_power_save();
+
+  if (net_cfg.radio_on_demand && !ota_is_upload_in_progress() &&
+      network_radio_idle_ms() >= (unsigned long)net_cfg.radio_idle_off_s * 1000UL) {
+    network_radio_off("no web requests");
+  }
+}
+
+void wifiRadioRequest(void) {
+  radio_request_pending = true;
+}
+
+bool wifiRadioIsOn(void) {
+  return radio_on;
+}
+
+bool wifiRadioOnDemand(void) {
+  return net_cfg.radio_on_demand;
+}
+
+unsigned long remote_control_idle_ms(void) {
+  if (ota_is_upload_in_progress()) return 0;
+  return network_http_idle_ms();
 }
 
 void prepare_remote_for_deep_sleep(void) {
@@ -84,9 +157,6 @@ void prepare_remote_for_deep_sleep(void) {
   if (ap_active) {
     stop_access_point(false);
   }
-  WiFi.disconnect(false, false);
-  WiFi.mode(WIFI_OFF);
-  sta_attempt_active = false;
-  sta_connected = false;
+  network_radio_off("deep sleep");
 }
 
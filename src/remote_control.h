@@ -3,3 +3,5 @@
 void setup_remote_control(void);
 void loop_remote_control(void);
 void prepare_remote_for_deep_sleep(void);
+// Time since the last web request (0 while an OTA upload is running).
+unsigned long remote_control_idle_ms(void);
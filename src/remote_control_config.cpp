@@ -14,6 +14,18 @@ constexpr const char *kPrefsSsid = "sta_ssid";
 constexpr const char *kPrefsPass = "sta_pass";
 constexpr const char *kPrefsHost = "host";
 constexpr const char *kPrefsBatteryMode = "battery_mode";
+constexpr const char *kPrefsRadioOnDemand = "radio_od";
+constexpr const char *kPrefsRadioIdleOff = "radio_idle_s";
+constexpr const char *kPrefsStaticIp = "sta_ip";
+constexpr const char *kPrefsStaticGateway = "sta_gw";
+constexpr const char *kPrefsStaticSubnet = "sta_mask";
+constexpr const char *kPrefsStaticDns = "sta_dns";
+constexpr const char *kPrefsStaLink = "sta_link";
+constexpr const char *kPrefsApChannel = "ap_chan";
+constexpr const char *kPrefsApChannelPick = "ap_pick";
+constexpr uint16_t kRadioIdleOffDefaultSec = 300;
+constexpr uint16_t kRadioIdleOffMinSec = 60;
+constexpr uint16_t kRadioIdleOffMaxSec = 3600;
 constexpr int kActionButtonPin = 0;
 constexpr unsigned long kNetworkRecoveryHoldMs = 1800UL;
 constexpr unsigned long kNetworkRecoveryEntryGuardMs = 250UL;
@@ -96,6 +108,66 @@ uint8_t parse_display_brightness_percent(const String &raw) {
   return (uint8_t)rounded;
 }
 
+uint8_t parse_display_target_fps(const String &raw) {
+  String s = raw;
+  s.trim();
+  const int value = s.toInt();
+  if (value < 10) return 10;
+  if (value > 60) return 60;
+  return (uint8_t)value;
+}
+
+uint16_t parse_display_idle_timeout_sec(const String &raw) {
+  String s = raw;
+  s.trim();
+  const long value = s.toInt();
+  if (value <= 0) return 0;
+  if (value > 2540) return 2540;
+  return (uint16_t)value;
+}
+
+uint16_t parse_auto_sleep_timeout_sec(const String &raw) {
+  String s = raw;
+  s.trim();
+  const long value = s.toInt();
+  if (value <= 0) return 0;
+  if (value > 254L * 60L) return 254U * 60U;
+  return (uint16_t)value;
+}
+
+uint16_t parse_radio_idle_off_sec(const String &raw) {
+  String s = raw;
+  s.trim();
+  const long value = s.toInt();
+  if (value <= 0) return kRadioIdleOffDefaultSec;
+  if (value < kRadioIdleOffMinSec) return kRadioIdleOffMinSec;
+  if (value > kRadioIdleOffMaxSec) return kRadioIdleOffMaxSec;
+  return (uint16_t)value;
+}
+
+uint8_t parse_ap_channel(const String &raw) {
+  String s = raw;
+  s.trim();
+  s.toLowerCase();
+  if (s.length() == 0 || s == "auto") return 0;
+  const long value = s.toInt();
+  if (value < 1 || value > AP_CHANNEL_MAX) return 0;
+  return (uint8_t)value;
+}
+
+bool parse_ipv4_text(const String &raw, uint32_t *out) {
+  String s = raw;
+  s.trim();
+  if (s.length() == 0) {
+    if (out) *out = 0;
+    return true;
+  }
+  IPAddress ip;
+  if (!ip.fromString(s)) return false;
+  if (out) *out = (uint32_t)ip;
+  return true;
+}
+
 void sanitize_hostname(const String &raw, char *dst, size_t dst_size) {
   char fallback[33];
   build_default_hostname(fallback, sizeof(fallback));
@@ -139,6 +211,7 @@ bool parse_bool_flag(const String &raw) {
 bool load_network_config() {
   memset(&net_cfg, 0, sizeof(net_cfg));
   net_cfg.prefer_sta = false;
+  net_cfg.radio_idle_off_s = kRadioIdleOffDefaultSec;
   build_default_hostname(net_cfg.hostname, sizeof(net_cfg.hostname));
 
   Preferences init_prefs;
@@ -156,6 +229,14 @@ bool load_network_config() {
   const String pass = prefs.isKey(kPrefsPass) ? prefs.getString(kPrefsPass) : String("");
   const String host = prefs.isKey(kPrefsHost) ? prefs.getString(kPrefsHost) : String(net_cfg.hostname);
   const String battery_mode = prefs.isKey(kPrefsBatteryMode) ? prefs.getString(kPrefsBatteryMode) : String("auto");
+  net_cfg.radio_on_demand = prefs.getBool(kPrefsRadioOnDemand, false);
+  net_cfg.radio_idle_off_s =
+    parse_radio_idle_off_sec(String((unsigned)prefs.getUShort(kPrefsRadioIdleOff, kRadioIdleOffDefaultSec)));
+  net_cfg.static_ip = prefs.getUInt(kPrefsStaticIp, 0);
+  net_cfg.static_gateway = prefs.getUInt(kPrefsStaticGateway, 0);
+  net_cfg.static_subnet = prefs.getUInt(kPrefsStaticSubnet, 0);
+  net_cfg.static_dns = prefs.getUInt(kPrefsStaticDns, 0);
+  net_cfg.ap_channel = parse_ap_channel(String((unsigned)prefs.getUChar(kPrefsApChannel, 0)));
   prefs.end();
 
   String mode_norm = mode;
@@ -181,15 +262,64 @@ bool save_network_config() {
   prefs.putString(kPrefsPass, net_cfg.sta_password);
   prefs.putString(kPrefsHost, net_cfg.hostname);
   prefs.putString(kPrefsBatteryMode, battery_presence_mode_to_pref(getBatteryPresenceMode()));
+  prefs.putBool(kPrefsRadioOnDemand, net_cfg.radio_on_demand);
+  prefs.putUShort(kPrefsRadioIdleOff, net_cfg.radio_idle_off_s);
+  prefs.putUInt(kPrefsStaticIp, net_cfg.static_ip);
+  prefs.putUInt(kPrefsStaticGateway, net_cfg.static_gateway);
+  prefs.putUInt(kPrefsStaticSubnet, net_cfg.static_subnet);
+  prefs.putUInt(kPrefsStaticDns, net_cfg.static_dns);
+  prefs.putUChar(kPrefsApChannel, net_cfg.ap_channel);
   prefs.end();
   return true;
 }
 
+bool load_sta_link_cache(StaLinkCache *out) {
+  if (!out) return false;
+  sta_link_cache_clear(out);
+  Preferences prefs;
+  if (!prefs.begin(kPrefsNs, true)) return false;
+  const bool ok = prefs.getBytesLength(kPrefsStaLink) == sizeof(StaLinkCache) &&
+                  prefs.getBytes(kPrefsStaLink, out, sizeof(StaLinkCache)) == sizeof(StaLinkCache);
+  prefs.end();
+  if (!ok) sta_link_cache_clear(out);
+  return ok;
+}
+
+bool save_sta_link_cache(const StaLinkCache &cache) {
+  Preferences prefs;
+  if (!prefs.begin(kPrefsNs, false)) return false;
+  const bool ok = prefs.putBytes(kPrefsStaLink, &cache, sizeof(cache)) == sizeof(cache);
+  prefs.end();
+  return ok;
+}
+
+uint8_t load_ap_channel_pick() {
+  Preferences prefs;
+  if (!prefs.begin(kPrefsNs, true)) return 0;
+  const uint8_t channel = prefs.getUChar(kPrefsApChannelPick, 0);
+  prefs.end();
+  return (channel >= 1 && channel <= AP_CHANNEL_AUTO_MAX) ? channel : 0;
+}
+
+bool save_ap_channel_pick(uint8_t channel) {
+  Preferences prefs;
+  if (!prefs.begin(kPrefsNs, false)) return false;
+  const bool ok = prefs.putUChar(kPrefsApChannelPick, channel) == sizeof(channel);
+  prefs.end();
+  return ok;
+}
+
 void apply_network_recovery_defaults(bool clear_sta_credentials) {
   net_cfg.prefer_sta = false;
+  net_cfg.radio_on_demand = false;
+  net_cfg.ap_channel = 0;
   if (clear_sta_credentials) {
     net_cfg.sta_ssid[0] = '\0';
     net_cfg.sta_password[0] = '\0';
+    net_cfg.static_ip = 0;
+    net_cfg.static_gateway = 0;
+    net_cfg.static_subnet = 0;
+    net_cfg.static_dns = 0;
   }
 }
 
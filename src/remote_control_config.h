@@ -3,16 +3,31 @@
 #include <Arduino.h>
 
 #include "inclinometer_shared.h"
+#include "sta_reconnect.h"
 
 const char *battery_presence_mode_to_pref(BatteryPresenceMode mode);
 BatteryPresenceMode parse_battery_presence_mode(const String &raw);
 DisplayPrecisionMode parse_display_precision_mode(const String &raw);
 uint8_t parse_display_brightness_percent(const String &raw);
+uint8_t parse_display_target_fps(const String &raw);
+uint16_t parse_display_idle_timeout_sec(const String &raw);  // 0 = never
+uint16_t parse_auto_sleep_timeout_sec(const String &raw);    // 0 = never
+uint16_t parse_radio_idle_off_sec(const String &raw);        // 60..3600, default 300
+uint8_t parse_ap_channel(const String &raw);                 // "auto"/0 -> 0, else 1..13
+// Dotted quad to IPAddress raw value; empty -> 0 (DHCP). False if malformed.
+bool parse_ipv4_text(const String &raw, uint32_t *out);
 void sanitize_hostname(const String &raw, char *dst, size_t dst_size);
 bool parse_bool_flag(const String &raw);
 
 bool load_network_config();
 bool save_network_config();
+// Last good BSSID/channel; written only when it changes.
+bool load_sta_link_cache(StaLinkCache *out);
+bool save_sta_link_cache(const StaLinkCache &cache);
+// Last auto AP channel pick, so the AP comes up there on the next boot
+// instead of channel 1. 0 = none stored.
+uint8_t load_ap_channel_pick();
+bool save_ap_channel_pick(uint8_t channel);
 
 void apply_network_recovery_defaults(bool clear_sta_credentials);
 bool action_button_network_recovery_requested();
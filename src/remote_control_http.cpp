@@ -1,12 +1,18 @@
 #include "remote_control_http.h"
 
+#include "fixed_format.h"
+#include "flight_log.h"
 #include "fw_version.h"
+#include "i2c_bus.h"
 #include "inclinometer_shared.h"
+#include "perf_counters.h"
+#include "power_manager.h"
 #include "remote_control_config.h"
 #include "remote_control_network.h"
 #include "remote_control_ota.h"
 #include "remote_control_page.h"
 #include "remote_protocol_utils.h"
+#include "touch_bsp.h"
 #include "ui_lvgl.h"
 
 namespace {
@@ -14,6 +20,8 @@ namespace {
 WebServer *g_server = nullptr;
 
 char state_json_buf[4608];
+// Pre-formatted float fields of one /api/state response (fixed_format).
+char state_num_buf[768];
 char state_align_instruction_buf[192];
 char state_fw_esc[32];
 char state_orient_esc[24];
@@ -22,6 +30,9 @@ char state_live_esc[12];
 char state_align_esc[320];
 char state_mode_target_esc[24];
 char state_offset_cal_target_esc[24];
+// One "[n,n,...]" list per I2C device and stat (latency histogram, results).
+char state_i2c_lists[I2C_DEV_COUNT][2][96];
+char state_i2c_edges[64];
 
 WebServer &server_ref() {
   return *g_server;
@@ -43,6 +54,20 @@ const char *axis_text() {
   }
 }
 
+void format_u32_list(char *dst, size_t dst_size, const uint32_t *values, size_t count) {
+  if (!dst || dst_size == 0) return;
+  size_t n = 0;
+  dst[n++] = '[';
+  for (size_t i = 0; i < count && n < dst_size; ++i) {
+    const int w = snprintf(dst + n, dst_size - n, (i == 0) ? "%lu" : ",%lu", (unsigned long)values[i]);
+    if (w < 0) break;
+    n += (size_t)w;
+  }
+  if (n + 2 > dst_size) n = dst_size - 2;
+  dst[n++] = ']';
+  dst[n] = '\0';
+}
+
 void copy_cstr(char *dst, size_t dst_size, const char *src) {
   if (!dst || dst_size == 0) return;
   if (!src) {
@@ -84,7 +109,7 @@ void json_escape_copy(char *dst, size_t dst_size, const char *src) {
 }
 
 void send_network_state_json(bool ok = true, const char *error = nullptr, int code = 200) {
-  char json[768];
+  char json[1536];
   char mode_esc[32];
   char pref_esc[8];
   char host_esc[40];
@@ -102,6 +127,18 @@ void send_network_state_json(bool ok = true, const char *error = nullptr, int co
   char sta_ip[24];
   ip_to_str(WiFi.softAPIP(), ap_ip, sizeof(ap_ip));
   ip_to_str(WiFi.localIP(), sta_ip, sizeof(sta_ip));
+  char static_ip[24];
+  char static_gw[24];
+  char static_mask[24];
+  char static_dns[24];
+  ip_to_str(IPAddress(net_cfg.static_ip), static_ip, sizeof(static_ip));
+  ip_to_str(IPAddress(net_cfg.static_gateway), static_gw, sizeof(static_gw));
+  ip_to_str(IPAddress(net_cfg.static_subnet), static_mask, sizeof(static_mask));
+  ip_to_str(IPAddress(net_cfg.static_dns), static_dns, sizeof(static_dns));
+  StaConnectStats sta_stats = {};
+  network_get_sta_stats(&sta_stats);
+  ApChannelStats ap_chan = {};
+  network_get_ap_channel_stats(&ap_chan);
 
   json_escape_copy(mode_esc, sizeof(mode_esc), network_run_mode_text());
   json_escape_copy(pref_esc, sizeof(pref_esc), net_cfg.prefer_sta ? "sta" : "ap");
@@ -124,9 +161,16 @@ void send_network_state_json(bool ok = true, const char *error = nullptr, int co
     "\"touch_enabled\":%s,"
     "\"touch_persist\":%s,"
     "\"display_brightness_pct\":%d,"
+    "\"display_fps\":%d,"
+    "\"display_dim_s\":%d,\"display_blank_s\":%d,\"auto_sleep_s\":%d,"
     "\"hostname\":\"%s\",\"hostname_local\":\"%s\","
     "\"sta_ssid\":\"%s\",\"sta_connected\":%s,\"sta_ip\":\"%s\","
+    "\"static_ip\":\"%s\",\"static_gateway\":\"%s\",\"static_subnet\":\"%s\",\"static_dns\":\"%s\","
+    "\"sta_connects\":%lu,\"sta_fast_connects\":%lu,\"sta_connect_last_ms\":%lu,\"sta_connect_mean_ms\":%lu,"
     "\"ap_active\":%s,\"ap_ssid\":\"%s\",\"ap_ip\":\"%s\","
+    "\"ap_channel_cfg\":%d,\"ap_channel\":%d,\"ap_channel_auto\":%d,\"ap_scan_networks\":%d,"
+    "\"ap_scans\":%lu,\"ap_scan_failures\":%lu,\"ap_channel_switches\":%lu,\"ap_start_failures\":%lu,"
+    "\"radio_on_demand\":%s,\"radio_idle_s\":%d,\"radio_on\":%s,"
     "\"ota_uploading\":%s,"
     "\"error\":\"%s\"}",
     ok ? "true" : "false",
@@ -137,9 +181,19 @@ void send_network_state_json(bool ok = true, const char *error = nullptr, int co
     getTouchInputEnabled() ? "true" : "false",
     getTouchLockPersistent() ? "true" : "false",
     (int)getDisplayBrightnessPercent(),
+    (int)getDisplayTargetFps(),
+    (int)getDisplayDimTimeoutSec(), (int)getDisplayBlankTimeoutSec(),
+    (int)getAutoSleepTimeoutSec(),
     host_esc, host_local_esc,
     ssid_esc, sta_connected ? "true" : "false", sta_ip_esc,
+    static_ip, static_gw, static_mask, static_dns,
+    (unsigned long)sta_stats.connects, (unsigned long)sta_stats.fast_connects,
+    (unsigned long)sta_stats.last_ms, (unsigned long)sta_connect_stats_mean_ms(sta_stats),
     ap_active ? "true" : "false", ap_ssid_esc, ap_ip_esc,
+    (int)net_cfg.ap_channel, (int)ap_chan.channel, (int)ap_chan.auto_pick, (int)ap_chan.networks_seen,
+    (unsigned long)ap_chan.scans, (unsigned long)ap_chan.scan_failures,
+    (unsigned long)ap_chan.switches, (unsigned long)ap_chan.start_failures,
+    net_cfg.radio_on_demand ? "true" : "false", (int)net_cfg.radio_idle_off_s, radio_on ? "true" : "false",
     ota_is_upload_in_progress() ? "true" : "false",
     err_esc
   );
@@ -161,39 +215,48 @@ void handle_live() {
   const float roll = get_display_roll();
   const float pitch = get_display_pitch();
   const int display_precision = (int)getDisplayPrecisionMode();
+  const uint8_t angle_decimals = (uint8_t)display_precision;
   const float roll_cond_pct = rollConditionPercent();
   const bool roll_cond_low = rollConditionIsLow();
   BatteryTelemetry battery = {};
   getBatteryTelemetry(&battery);
 
+  char nums[128];
+  FixedFormatScratch num;
+  fixed_format_scratch_init(&num, nums, sizeof(nums));
+
   snprintf(
     json,
     sizeof(json),
-    "{\"fw\":\"%s\",\"roll\":%.*f,\"pitch\":%.*f,"
+    "{\"fw\":\"%s\",\"roll\":%s,\"pitch\":%s,"
     "\"orientation\":\"%s\",\"axis\":\"%s\",\"axis_id\":%d,\"rotation\":%d,\"live\":\"%s\","
     "\"display_precision\":%d,"
-    "\"roll_cond_pct\":%.1f,\"roll_cond_low\":%s,"
-    "\"battery_valid\":%s,\"battery_voltage_v\":%.2f,\"battery_soc_pct\":%.1f,"
+    "\"roll_cond_pct\":%s,\"roll_cond_low\":%s,"
+    "\"battery_valid\":%s,\"battery_voltage_v\":%s,\"battery_soc_pct\":%s,"
     "\"battery_charging\":%s,\"battery_charging_inferred\":%s,"
-    "\"battery_present\":%s,\"battery_present_inferred\":%s}",
+    "\"battery_present\":%s,\"battery_present_inferred\":%s,"
+    "\"battery_ocv_v\":%s,\"battery_load_ma\":%s,\"battery_tte_h\":%s}",
     fw_esc,
-    display_precision, roll,
-    display_precision, pitch,
+    fixed_format_next(&num, roll, angle_decimals),
+    fixed_format_next(&num, pitch, angle_decimals),
     orient_esc,
     axis_esc,
     (int)getAxisMode(),
     displayRotated ? 180 : 0,
     live_esc,
     display_precision,
-    roll_cond_pct,
+    fixed_format_next(&num, roll_cond_pct, 1),
     roll_cond_low ? "true" : "false",
     battery.valid ? "true" : "false",
-    battery.voltage_v,
-    battery.soc_percent,
+    fixed_format_next(&num, battery.voltage_v, 2),
+    fixed_format_next(&num, battery.soc_percent, 1),
     battery.charging ? "true" : "false",
     battery.charging_inferred ? "true" : "false",
     battery.present ? "true" : "false",
-    battery.present_inferred ? "true" : "false"
+    battery.present_inferred ? "true" : "false",
+    fixed_format_next(&num, battery.ocv_v, 2),
+    fixed_format_next(&num, battery.load_ma, 0),
+    fixed_format_next(&num, battery.tte_h, 1)
   );
   send_json(json);
 }
@@ -229,8 +292,28 @@ void handle_state() {
   const float roll = get_display_roll();
   const float pitch = get_display_pitch();
   const int display_precision = (int)getDisplayPrecisionMode();
+  const uint8_t angle_decimals = (uint8_t)display_precision;
   BatteryTelemetry battery = {};
   getBatteryTelemetry(&battery);
+  DisplayRenderStats render = {};
+  getDisplayRenderStats(&render);
+  TouchBusStats touch = {};
+  Touch_GetBusStats(&touch);
+  uint32_t i2c_edges[I2C_BUS_LATENCY_BUCKETS - 1];
+  for (uint8_t i = 0; i < I2C_BUS_LATENCY_BUCKETS - 1; ++i) i2c_edges[i] = I2C_BUS_LATENCY_EDGES_US[i];
+  format_u32_list(state_i2c_edges, sizeof(state_i2c_edges), i2c_edges, I2C_BUS_LATENCY_BUCKETS - 1);
+  I2cDeviceStats i2c[I2C_DEV_COUNT] = {};
+  for (uint8_t dev = 0; dev < I2C_DEV_COUNT; ++dev) {
+    i2c_bus_get_stats((I2cDevice)dev, &i2c[dev]);
+    format_u32_list(state_i2c_lists[dev][0], sizeof(state_i2c_lists[dev][0]),
+                    i2c[dev].latency_hist, I2C_BUS_LATENCY_BUCKETS);
+    format_u32_list(state_i2c_lists[dev][1], sizeof(state_i2c_lists[dev][1]),
+                    i2c[dev].results, I2C_BUS_RESULT_COUNT);
+  }
+  PowerStats pm = {};
+  BootTimeline boot = {};
+  getBootTimeline(&boot);
+  power_manager_get_stats(&pm);
 
   json_escape_copy(state_fw_esc, sizeof(state_fw_esc), FW_VERSION);
   json_escape_copy(state_orient_esc, sizeof(state_orient_esc), orientation_text());
@@ -240,32 +323,57 @@ void handle_state() {
   json_escape_copy(state_mode_target_esc, sizeof(state_mode_target_esc), mode_target);
   json_escape_copy(state_offset_cal_target_esc, sizeof(state_offset_cal_target_esc), offset_cal_target);
 
+  // Float formatting plus the body snprintf, timed as the state_json stage.
+  PERF_MARK(state_json_start_us);
+  FixedFormatScratch num;
+  fixed_format_scratch_init(&num, state_num_buf, sizeof(state_num_buf));
+  const char *roll_text = fixed_format_next(&num, roll, angle_decimals);
+  const char *pitch_text = fixed_format_next(&num, pitch, angle_decimals);
+
   int written = snprintf(
     state_json_buf,
     sizeof(state_json_buf),
-    "{\"fw\":\"%s\",\"roll\":%.*f,\"pitch\":%.*f,"
+    "{\"fw\":\"%s\",\"roll\":%s,\"pitch\":%s,"
     "\"orientation\":\"%s\",\"axis\":\"%s\",\"axis_id\":%d,\"rotation\":%d,\"live\":\"%s\","
     "\"display_precision\":%d,"
     "\"align_active\":%s,\"align_instruction\":\"%s\","
-    "\"align_capture_active\":%s,\"align_capture_pct\":%.1f,"
-    "\"roll_cond_pct\":%.1f,\"roll_cond_low\":%s,"
-    "\"battery_valid\":%s,\"battery_voltage_v\":%.2f,\"battery_soc_pct\":%.1f,"
+    "\"align_capture_active\":%s,\"align_capture_pct\":%s,"
+    "\"roll_cond_pct\":%s,\"roll_cond_low\":%s,"
+    "\"battery_valid\":%s,\"battery_voltage_v\":%s,\"battery_soc_pct\":%s,"
     "\"battery_charging\":%s,\"battery_charging_inferred\":%s,"
     "\"battery_present\":%s,\"battery_present_inferred\":%s,"
-    "\"mode_active\":%s,\"mode_confirmed\":%s,\"mode_target\":\"%s\",\"mode_rem_s\":%.2f,\"mode_progress_pct\":%.1f,"
-    "\"zero_active\":%s,\"zero_confirmed\":%s,\"zero_rem_s\":%.2f,\"zero_progress_pct\":%.1f,"
-    "\"offset_cal_active\":%s,\"offset_cal_confirmed\":%s,\"offset_cal_target\":\"%s\",\"offset_cal_rem_s\":%.2f,\"offset_cal_progress_pct\":%.1f,"
+    "\"battery_ocv_v\":%s,\"battery_load_ma\":%s,\"battery_tte_h\":%s,"
+    "\"mode_active\":%s,\"mode_confirmed\":%s,\"mode_target\":\"%s\",\"mode_rem_s\":%s,\"mode_progress_pct\":%s,"
+    "\"zero_active\":%s,\"zero_confirmed\":%s,\"zero_rem_s\":%s,\"zero_progress_pct\":%s,"
+    "\"offset_cal_active\":%s,\"offset_cal_confirmed\":%s,\"offset_cal_target\":\"%s\",\"offset_cal_rem_s\":%s,\"offset_cal_progress_pct\":%s,"
     "\"diag_valid\":%s,"
-    "\"sens_ax\":%.3f,\"sens_ay\":%.3f,\"sens_az\":%.3f,\"sens_gx\":%.3f,\"sens_gy\":%.3f,\"sens_gz\":%.3f,"
-    "\"map_ax\":%.3f,\"map_ay\":%.3f,\"map_az\":%.3f,\"map_gx\":%.3f,\"map_gy\":%.3f,"
-    "\"corr_ax\":%.3f,\"corr_ay\":%.3f,\"corr_az\":%.3f,\"corr_gx\":%.3f,\"corr_gy\":%.3f,"
-    "\"phys_roll\":%.2f,\"phys_pitch\":%.2f,"
-    "\"bias_ax\":%.4f,\"bias_ay\":%.4f,\"bias_az\":%.4f,\"bias_gx\":%.4f,\"bias_gy\":%.4f,"
-    "\"zero_roll\":%.3f,\"zero_pitch\":%.3f,"
-    "\"align_roll\":%.3f,\"align_pitch\":%.3f}",
+    "\"sens_ax\":%s,\"sens_ay\":%s,\"sens_az\":%s,\"sens_gx\":%s,\"sens_gy\":%s,\"sens_gz\":%s,"
+    "\"map_ax\":%s,\"map_ay\":%s,\"map_az\":%s,\"map_gx\":%s,\"map_gy\":%s,"
+    "\"corr_ax\":%s,\"corr_ay\":%s,\"corr_az\":%s,\"corr_gx\":%s,\"corr_gy\":%s,"
+    "\"phys_roll\":%s,\"phys_pitch\":%s,"
+    "\"bias_ax\":%s,\"bias_ay\":%s,\"bias_az\":%s,\"bias_gx\":%s,\"bias_gy\":%s,"
+    "\"zero_roll\":%s,\"zero_pitch\":%s,"
+    "\"align_roll\":%s,\"align_pitch\":%s,"
+    "\"ui_fps\":%s,\"ui_frame_ms\":%s,\"ui_frame_max_ms\":%s,"
+    "\"ui_target_fps\":%d,\"ui_idle_fps\":%d,\"ui_render_active\":%s,"
+    "\"ui_direct_mode\":%s,\"ui_px_invalidated\":%lu,\"ui_px_pushed\":%lu,"
+    "\"ui_power_state\":\"%s\",\"ui_power_active_s\":%lu,\"ui_power_dim_s\":%lu,\"ui_power_blank_s\":%lu,"
+    "\"lv_mem_total\":%lu,\"lv_mem_used\":%lu,\"lv_mem_free\":%lu,\"lv_mem_max_used\":%lu,"
+    "\"lv_mem_largest_free\":%lu,\"lv_mem_largest_free_min\":%lu,\"lv_mem_frag_pct\":%d,\"lv_mem_psram\":%s,"
+    "\"internal_free\":%lu,\"internal_largest_free\":%lu,"
+    "\"touch_irq\":%s,\"touch_polls\":%lu,\"touch_reads\":%lu,\"touch_reads_skipped\":%lu,"
+    "\"touch_bus_ms\":%lu,\"touch_bus_saved_ms\":%lu,\"touch_bus_khz\":%lu,"
+    "\"i2c_khz\":%lu,\"i2c_lat_edges_us\":%s,"
+    "\"i2c_imu_n\":%lu,\"i2c_imu_lat_hist\":%s,\"i2c_imu_results\":%s,\"i2c_imu_lat_max_us\":%lu,\"i2c_imu_wait_max_us\":%lu,"
+    "\"i2c_touch_n\":%lu,\"i2c_touch_lat_hist\":%s,\"i2c_touch_results\":%s,\"i2c_touch_lat_max_us\":%lu,\"i2c_touch_wait_max_us\":%lu,"
+    "\"pm_cpu\":\"%s\",\"pm_cpu_max_mhz\":%u,\"pm_cpu_min_mhz\":%u,\"pm_wifi\":\"%s\","
+    "\"pm_busy_fusion_pct\":%s,\"pm_busy_ui_pct\":%s,\"pm_busy_http_pct\":%s,\"pm_busy_pct\":%s,"
+    "\"pm_est_ma\":%s,\"pm_life_fixed_h\":%s,\"pm_life_dfs_h\":%s,\"pm_life_light_sleep_h\":%s,"
+    "\"pm_remaining_h\":%s,"
+    "\"boot_setup_ms\":%s,\"boot_first_reading_ms\":%s}",
     state_fw_esc,
-    display_precision, roll,
-    display_precision, pitch,
+    roll_text,
+    pitch_text,
     state_orient_esc,
     state_axis_esc,
     (int)getAxisMode(),
@@ -275,44 +383,124 @@ void handle_state() {
     alignmentIsActive() ? "true" : "false",
     state_align_esc,
     align_capture_active ? "true" : "false",
-    align_capture_pct,
-    roll_cond_pct,
+    fixed_format_next(&num, align_capture_pct, 1),
+    fixed_format_next(&num, roll_cond_pct, 1),
     roll_cond_low ? "true" : "false",
     battery.valid ? "true" : "false",
-    battery.voltage_v,
-    battery.soc_percent,
+    fixed_format_next(&num, battery.voltage_v, 2),
+    fixed_format_next(&num, battery.soc_percent, 1),
     battery.charging ? "true" : "false",
     battery.charging_inferred ? "true" : "false",
     battery.present ? "true" : "false",
     battery.present_inferred ? "true" : "false",
+    fixed_format_next(&num, battery.ocv_v, 2),
+    fixed_format_next(&num, battery.load_ma, 0),
+    fixed_format_next(&num, battery.tte_h, 1),
     mode_active ? "true" : "false",
     mode_confirmed ? "true" : "false",
     state_mode_target_esc,
-    mode_rem_s,
-    mode_progress_pct,
+    fixed_format_next(&num, mode_rem_s, 2),
+    fixed_format_next(&num, mode_progress_pct, 1),
     zero_active ? "true" : "false",
     zero_confirmed ? "true" : "false",
-    zero_rem_s,
-    zero_progress_pct,
+    fixed_format_next(&num, zero_rem_s, 2),
+    fixed_format_next(&num, zero_progress_pct, 1),
     offset_cal_active ? "true" : "false",
     offset_cal_confirmed ? "true" : "false",
     state_offset_cal_target_esc,
-    offset_cal_rem_s,
-    offset_cal_progress_pct,
+    fixed_format_next(&num, offset_cal_rem_s, 2),
+    fixed_format_next(&num, offset_cal_progress_pct, 1),
     diag.valid ? "true" : "false",
-    diag.sens_ax, diag.sens_ay, diag.sens_az, diag.sens_gx, diag.sens_gy, diag.sens_gz,
-    diag.map_ax, diag.map_ay, diag.map_az, diag.map_gx, diag.map_gy,
-    diag.corr_ax, diag.corr_ay, diag.corr_az, diag.corr_gx, diag.corr_gy,
-    diag.angle_roll, diag.angle_pitch,
-    cal.bias_ax, cal.bias_ay, cal.bias_az, cal.bias_gx, cal.bias_gy,
-    cal.zero_roll, cal.zero_pitch,
-    cal.align_roll, cal.align_pitch
+    fixed_format_next(&num, diag.sens_ax, 3),
+    fixed_format_next(&num, diag.sens_ay, 3),
+    fixed_format_next(&num, diag.sens_az, 3),
+    fixed_format_next(&num, diag.sens_gx, 3),
+    fixed_format_next(&num, diag.sens_gy, 3),
+    fixed_format_next(&num, diag.sens_gz, 3),
+    fixed_format_next(&num, diag.map_ax, 3),
+    fixed_format_next(&num, diag.map_ay, 3),
+    fixed_format_next(&num, diag.map_az, 3),
+    fixed_format_next(&num, diag.map_gx, 3),
+    fixed_format_next(&num, diag.map_gy, 3),
+    fixed_format_next(&num, diag.corr_ax, 3),
+    fixed_format_next(&num, diag.corr_ay, 3),
+    fixed_format_next(&num, diag.corr_az, 3),
+    fixed_format_next(&num, diag.corr_gx, 3),
+    fixed_format_next(&num, diag.corr_gy, 3),
+    fixed_format_next(&num, diag.angle_roll, 2),
+    fixed_format_next(&num, diag.angle_pitch, 2),
+    fixed_format_next(&num, cal.bias_ax, 4),
+    fixed_format_next(&num, cal.bias_ay, 4),
+    fixed_format_next(&num, cal.bias_az, 4),
+    fixed_format_next(&num, cal.bias_gx, 4),
+    fixed_format_next(&num, cal.bias_gy, 4),
+    fixed_format_next(&num, cal.zero_roll, 3),
+    fixed_format_next(&num, cal.zero_pitch, 3),
+    fixed_format_next(&num, cal.align_roll, 3),
+    fixed_format_next(&num, cal.align_pitch, 3),
+    fixed_format_next(&num, render.fps, 1),
+    fixed_format_next(&num, render.frame_ms_avg, 2),
+    fixed_format_next(&num, render.frame_ms_max, 2),
+    (int)getDisplayTargetFps(), (int)render.idle_fps,
+    render.active ? "true" : "false",
+    render.direct_mode ? "true" : "false",
+    (unsigned long)render.px_invalidated,
+    (unsigned long)render.px_pushed,
+    display_power_state_name(render.power_state),
+    (unsigned long)render.power_state_s[DISPLAY_POWER_ACTIVE],
+    (unsigned long)render.power_state_s[DISPLAY_POWER_DIM],
+    (unsigned long)render.power_state_s[DISPLAY_POWER_BLANK],
+    (unsigned long)render.lv_mem_total,
+    (unsigned long)render.lv_mem_used,
+    (unsigned long)render.lv_mem_free,
+    (unsigned long)render.lv_mem_max_used,
+    (unsigned long)render.lv_mem_largest_free,
+    (unsigned long)render.lv_mem_largest_free_min,
+    (int)render.lv_mem_frag_pct,
+    render.lv_mem_psram ? "true" : "false",
+    (unsigned long)render.internal_free,
+    (unsigned long)render.internal_largest_free,
+    touch.irq_enabled ? "true" : "false",
+    (unsigned long)touch.polls,
+    (unsigned long)touch.reads,
+    (unsigned long)touch.reads_skipped,
+    (unsigned long)(touch.bus_us / 1000ULL),
+    (unsigned long)(touch.saved_us / 1000ULL),
+    (unsigned long)(touch.bus_clock_hz / 1000UL),
+    (unsigned long)(i2c_bus_clock_hz() / 1000UL),
+    state_i2c_edges,
+    (unsigned long)i2c[I2C_DEV_IMU].transactions,
+    state_i2c_lists[I2C_DEV_IMU][0],
+    state_i2c_lists[I2C_DEV_IMU][1],
+    (unsigned long)i2c[I2C_DEV_IMU].latency_max_us,
+    (unsigned long)i2c[I2C_DEV_IMU].wait_max_us,
+    (unsigned long)i2c[I2C_DEV_TOUCH].transactions,
+    state_i2c_lists[I2C_DEV_TOUCH][0],
+    state_i2c_lists[I2C_DEV_TOUCH][1],
+    (unsigned long)i2c[I2C_DEV_TOUCH].latency_max_us,
+    (unsigned long)i2c[I2C_DEV_TOUCH].wait_max_us,
+    power_cpu_mode_name(pm.cpu_mode),
+    (unsigned)pm.cpu_max_mhz,
+    (unsigned)pm.cpu_min_mhz,
+    power_wifi_mode_name(pm.wifi_mode),
+    fixed_format_next(&num, pm.busy_pct[POWER_LOCK_FUSION], 1),
+    fixed_format_next(&num, pm.busy_pct[POWER_LOCK_UI], 1),
+    fixed_format_next(&num, pm.busy_pct[POWER_LOCK_HTTP], 1),
+    fixed_format_next(&num, pm.busy_any_pct, 1),
+    fixed_format_next(&num, pm.est_ma, 1),
+    fixed_format_next(&num, pm.life_h[POWER_CPU_FIXED], 1),
+    fixed_format_next(&num, pm.life_h[POWER_CPU_DFS], 1),
+    fixed_format_next(&num, pm.life_h[POWER_CPU_LIGHT_SLEEP], 1),
+    fixed_format_next(&num, pm.remaining_h, 1),
+    fixed_format_next(&num, (float)boot_timeline_duration_us(boot, BOOT_STAGE_SETUP) / 1000.0f, 1),
+    fixed_format_next(&num, (float)boot_timeline_duration_us(boot, BOOT_STAGE_FIRST_READING) / 1000.0f, 1)
   );
+  PERF_RECORD_SINCE(PERF_STAGE_STATE_JSON, state_json_start_us);
   if (written < 0 || written >= (int)sizeof(state_json_buf)) {
     snprintf(
       state_json_buf,
       sizeof(state_json_buf),
-      "{\"fw\":\"%s\",\"roll\":%.*f,\"pitch\":%.*f,"
+      "{\"fw\":\"%s\",\"roll\":%s,\"pitch\":%s,"
       "\"orientation\":\"%s\",\"axis\":\"%s\",\"axis_id\":%d,"
       "\"rotation\":%d,\"live\":\"%s\",\"display_precision\":%d,\"align_active\":%s,"
       "\"align_instruction\":\"\",\"align_capture_active\":false,\"align_capture_pct\":0.0,"
@@ -320,6 +508,7 @@ void handle_state() {
       "\"battery_valid\":false,\"battery_voltage_v\":0.0,\"battery_soc_pct\":0.0,"
       "\"battery_charging\":false,\"battery_charging_inferred\":false,"
       "\"battery_present\":true,\"battery_present_inferred\":false,"
+      "\"battery_ocv_v\":0.0,\"battery_load_ma\":0,\"battery_tte_h\":0.0,"
       "\"mode_active\":%s,\"mode_confirmed\":false,\"mode_target\":\"%s\",\"mode_rem_s\":0.0,\"mode_progress_pct\":0.0,"
       "\"zero_active\":%s,\"zero_confirmed\":false,\"zero_rem_s\":0.0,\"zero_progress_pct\":0.0,"
       "\"offset_cal_active\":%s,\"offset_cal_confirmed\":false,\"offset_cal_target\":\"%s\",\"offset_cal_rem_s\":0.0,\"offset_cal_progress_pct\":0.0,"
@@ -332,8 +521,8 @@ void handle_state() {
       "\"zero_roll\":0.0,\"zero_pitch\":0.0,"
       "\"align_roll\":0.0,\"align_pitch\":0.0}",
       state_fw_esc,
-      display_precision, roll,
-      display_precision, pitch,
+      roll_text,
+      pitch_text,
       state_orient_esc,
       state_axis_esc,
       (int)getAxisMode(),
@@ -368,6 +557,7 @@ String read_cmd_from_request() {
 }
 
 void handle_cmd() {
+  displayNoteActivity();
   const String cmd = read_cmd_from_request();
   if (cmd == "zero") {
     zeroWorkflowStart();
@@ -444,6 +634,7 @@ void handle_network_get() {
 }
 
 void handle_network_post() {
+  displayNoteActivity();
   WebServer &server = server_ref();
   const String mode_in = get_request_value("mode");
   const String battery_mode_in = get_request_value("battery_mode");
@@ -452,9 +643,20 @@ void handle_network_post() {
   const String touch_enabled_in = get_request_value("touch_enabled");
   const String touch_persist_in = get_request_value("touch_persist");
   const String display_brightness_in = get_request_value("display_brightness");
+  const String display_fps_in = get_request_value("display_fps");
+  const String display_dim_in = get_request_value("display_dim_s");
+  const String display_blank_in = get_request_value("display_blank_s");
+  const String auto_sleep_in = get_request_value("auto_sleep_s");
+  const String radio_on_demand_in = get_request_value("radio_on_demand");
+  const String radio_idle_in = get_request_value("radio_idle_s");
   const String ssid_in = get_request_value("ssid");
   const String pass_in = get_request_value("password");
   const String host_in = get_request_value("hostname");
+  const String static_ip_in = get_request_value("static_ip");
+  const String static_gw_in = get_request_value("static_gateway");
+  const String static_mask_in = get_request_value("static_subnet");
+  const String static_dns_in = get_request_value("static_dns");
+  const String ap_channel_in = get_request_value("ap_channel");
 
   const bool update_mode = mode_in.length() > 0;
   const bool update_battery_mode = battery_mode_in.length() > 0 || server.hasArg("battery_mode");
@@ -463,9 +665,17 @@ void handle_network_post() {
   const bool update_touch_enabled = touch_enabled_in.length() > 0 || server.hasArg("touch_enabled");
   const bool update_touch_persist = touch_persist_in.length() > 0 || server.hasArg("touch_persist");
   const bool update_display_brightness = display_brightness_in.length() > 0 || server.hasArg("display_brightness");
+  const bool update_display_fps = display_fps_in.length() > 0 || server.hasArg("display_fps");
+  const bool update_display_dim = display_dim_in.length() > 0 || server.hasArg("display_dim_s");
+  const bool update_display_blank = display_blank_in.length() > 0 || server.hasArg("display_blank_s");
+  const bool update_auto_sleep = auto_sleep_in.length() > 0 || server.hasArg("auto_sleep_s");
+  const bool update_radio_on_demand = radio_on_demand_in.length() > 0 || server.hasArg("radio_on_demand");
+  const bool update_radio_idle = radio_idle_in.length() > 0 || server.hasArg("radio_idle_s");
   const bool update_ssid = ssid_in.length() > 0 || server.hasArg("ssid");
   const bool update_pass = pass_in.length() > 0 || server.hasArg("password");
   const bool update_host = host_in.length() > 0 || server.hasArg("hostname");
+  const bool update_static_ip = static_ip_in.length() > 0 || server.hasArg("static_ip");
+  const bool update_ap_channel = ap_channel_in.length() > 0 || server.hasArg("ap_channel");
 
   if (update_mode) {
     String mode = mode_in;
@@ -477,15 +687,51 @@ void handle_network_post() {
       return;
     }
   }
+  NetworkConfig static_cfg = net_cfg;
+  if (update_static_ip) {
+    // The four fields travel together; blank static_ip returns to DHCP.
+    if (!parse_ipv4_text(static_ip_in, &static_cfg.static_ip) ||
+        !parse_ipv4_text(static_gw_in, &static_cfg.static_gateway) ||
+        !parse_ipv4_text(static_mask_in, &static_cfg.static_subnet) ||
+        !parse_ipv4_text(static_dns_in, &static_cfg.static_dns)) {
+      send_network_state_json(false, "static address fields must be dotted IPv4", 400);
+      return;
+    }
+    if (static_cfg.static_ip == 0) {
+      static_cfg.static_gateway = 0;
+      static_cfg.static_subnet = 0;
+      static_cfg.static_dns = 0;
+    } else {
+      if (static_cfg.static_gateway == 0) {
+        send_network_state_json(false, "static_ip requires static_gateway", 400);
+        return;
+      }
+      if (static_cfg.static_subnet == 0) static_cfg.static_subnet = (uint32_t)IPAddress(255, 255, 255, 0);
+      if (static_cfg.static_dns == 0) static_cfg.static_dns = static_cfg.static_gateway;
+    }
+  }
   if (update_battery_mode) setBatteryPresenceMode(parse_battery_presence_mode(battery_mode_in));
   if (update_zero_on_boot) setAutoZeroOnBootEnabled(parse_bool_flag(zero_on_boot_in));
   if (update_display_precision) setDisplayPrecisionMode(parse_display_precision_mode(display_precision_in));
   if (update_touch_persist) setTouchLockPersistent(parse_bool_flag(touch_persist_in));
   if (update_touch_enabled) setTouchInputEnabled(parse_bool_flag(touch_enabled_in));
   if (update_display_brightness) setDisplayBrightnessPercent(parse_display_brightness_percent(display_brightness_in));
+  if (update_display_fps) setDisplayTargetFps(parse_display_target_fps(display_fps_in));
+  if (update_display_dim) setDisplayDimTimeoutSec(parse_display_idle_timeout_sec(display_dim_in));
+  if (update_display_blank) setDisplayBlankTimeoutSec(parse_display_idle_timeout_sec(display_blank_in));
+  if (update_auto_sleep) setAutoSleepTimeoutSec(parse_auto_sleep_timeout_sec(auto_sleep_in));
+  if (update_radio_on_demand) net_cfg.radio_on_demand = parse_bool_flag(radio_on_demand_in);
+  if (update_radio_idle) net_cfg.radio_idle_off_s = parse_radio_idle_off_sec(radio_idle_in);
   if (update_ssid) copy_cstr(net_cfg.sta_ssid, sizeof(net_cfg.sta_ssid), ssid_in.c_str());
   if (update_pass) copy_cstr(net_cfg.sta_password, sizeof(net_cfg.sta_password), pass_in.c_str());
   if (update_host) sanitize_hostname(host_in, net_cfg.hostname, sizeof(net_cfg.hostname));
+  if (update_ap_channel) net_cfg.ap_channel = parse_ap_channel(ap_channel_in);
+  if (update_static_ip) {
+    net_cfg.static_ip = static_cfg.static_ip;
+    net_cfg.static_gateway = static_cfg.static_gateway;
+    net_cfg.static_subnet = static_cfg.static_subnet;
+    net_cfg.static_dns = static_cfg.static_dns;
+  }
 
   if (net_cfg.prefer_sta && net_cfg.sta_ssid[0] == '\0') {
     send_network_state_json(false, "STA mode requires ssid", 400);
@@ -545,6 +791,7 @@ void handle_options() {
 }
 
 void handle_root() {
+  displayNoteActivity();
   WebServer &server = server_ref();
   server.sendHeader("Cache-Control", "no-store, no-cache, must-revalidate, max-age=0");
   server.sendHeader("Pragma", "no-cache");
@@ -556,24 +803,75 @@ void handle_health() {
   send_json("{\"ok\":true}");
 }
 
+void handle_boot() {
+  BootTimeline boot = {};
+  getBootTimeline(&boot);
+  static char stages[BOOT_STAGE_COUNT * 96];
+  if (!boot_timeline_format_json(boot, stages, sizeof(stages))) {
+    strcpy(stages, "[]");
+  }
+  char fw_esc[32];
+  json_escape_copy(fw_esc, sizeof(fw_esc), FW_VERSION);
+  static char json[sizeof(stages) + 80];
+  snprintf(json, sizeof(json), "{\"fw\":\"%s\",\"stages\":%s}", fw_esc, stages);
+  send_json(json);
+}
+
+// GET /api/perf: stage timings since the last reset; ?reset=1 starts a new
+// window after this report.
+void handle_perf() {
+  static char json[2560];
+  if (!perf_format_json(json, sizeof(json))) {
+    strcpy(json, "{}");
+  }
+  send_json(json);
+  if (get_request_value("reset") == "1") perf_reset();
+}
+
+// GET /api/flight: flight recorder, the run before the last reset and this one.
+void handle_flight() {
+  // Header plus two full rings at up to ~45 bytes per event.
+  static char json[256 + 2 * FLIGHT_RECORDER_EVENTS * 46];
+  if (!flight_log_format_json(json, sizeof(json))) {
+    strcpy(json, "{}");
+  }
+  send_json(json);
+}
+
+// Every route runs at full clock and keeps the radio out of modem sleep for
+// a while after the request (see update_wifi_power_save()).
+template <void (*Handler)()>
+void with_power_lock() {
+  PowerLockScope lock(POWER_LOCK_HTTP);
+  network_note_http_request();
+  PERF_COUNT(PERF_EVENT_HTTP_REQUEST);
+  Handler();
+}
+
 }  // namespace
 
 void register_remote_control_routes(WebServer &server) {
   g_server = &server;
 
-  server.on("/", HTTP_GET, handle_root);
-  server.on("/health", HTTP_GET, handle_health);
-  server.on("/api/live", HTTP_GET, handle_live);
-  server.on("/api/state", HTTP_GET, handle_state);
-  server.on("/api/network", HTTP_OPTIONS, handle_options);
-  server.on("/api/network", HTTP_GET, handle_network_get);
-  server.on("/api/network", HTTP_POST, handle_network_post);
-  server.on("/api/network/recover", HTTP_OPTIONS, handle_options);
-  server.on("/api/network/recover", HTTP_POST, handle_network_recover_post);
-  server.on("/api/cmd", HTTP_OPTIONS, handle_options);
-  server.on("/api/cmd", HTTP_POST, handle_cmd);
-  server.on("/api/cmd", HTTP_GET, handle_cmd);
-  server.on("/api/ota/upload", HTTP_OPTIONS, handle_options);
-  server.on("/api/ota/upload", HTTP_POST, handle_ota_upload_done, []() { handle_ota_upload_data(server_ref(), FW_VERSION); });
+  server.on("/", HTTP_GET, with_power_lock<handle_root>);
+  server.on("/health", HTTP_GET, with_power_lock<handle_health>);
+  server.on("/api/live", HTTP_GET, with_power_lock<handle_live>);
+  server.on("/api/state", HTTP_GET, with_power_lock<handle_state>);
+  server.on("/api/boot", HTTP_GET, with_power_lock<handle_boot>);
+  server.on("/api/perf", HTTP_GET, with_power_lock<handle_perf>);
+  server.on("/api/flight", HTTP_GET, with_power_lock<handle_flight>);
+  server.on("/api/network", HTTP_OPTIONS, with_power_lock<handle_options>);
+  server.on("/api/network", HTTP_GET, with_power_lock<handle_network_get>);
+  server.on("/api/network", HTTP_POST, with_power_lock<handle_network_post>);
+  server.on("/api/network/recover", HTTP_OPTIONS, with_power_lock<handle_options>);
+  server.on("/api/network/recover", HTTP_POST, with_power_lock<handle_network_recover_post>);
+  server.on("/api/cmd", HTTP_OPTIONS, with_power_lock<handle_options>);
+  server.on("/api/cmd", HTTP_POST, with_power_lock<handle_cmd>);
+  server.on("/api/cmd", HTTP_GET, with_power_lock<handle_cmd>);
+  server.on("/api/ota/upload", HTTP_OPTIONS, with_power_lock<handle_options>);
+  server.on("/api/ota/upload", HTTP_POST, with_power_lock<handle_ota_upload_done>, []() {
+    PowerLockScope lock(POWER_LOCK_HTTP);
+    handle_ota_upload_data(server_ref(), FW_VERSION);
+  });
   server.onNotFound([]() { server_ref().send(404, "text/plain", "Not Found"); });
 }
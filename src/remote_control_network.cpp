@@ -1,6 +1,12 @@
 #include "remote_control_network.h"
 
 #include <ESPmDNS.h>
+#include <string.h>
+
+#include "flight_log.h"
+#include "power_manager.h"
+#include "serial_log.h"
+#include "remote_control_config.h"
 
 char ap_ssid[32] = {0};
 const char *ap_password = "incidence-ng";
@@ -10,33 +16,90 @@ bool ap_active = false;
 bool sta_connected = false;
 bool sta_attempt_active = false;
 bool mdns_active = false;
+bool radio_on = false;
 unsigned long sta_attempt_started_ms = 0;
 unsigned long next_sta_retry_ms = 0;
 
 namespace {
 
 constexpr unsigned long kStaConnectTimeoutMs = 12000UL;
-constexpr unsigned long kStaRetryIntervalMs = 30000UL;
+// A directed connect to a cached BSSID/channel either associates within a
+// couple of seconds or the AP moved; give up early and scan.
+constexpr unsigned long kStaFastConnectTimeoutMs = 4000UL;
+// Keep the radio awake this long after a web request so a polling page stays
+// responsive; modem sleep otherwise adds up to a DTIM interval per request.
+constexpr unsigned long kModemSleepAfterHttpMs = 10000UL;
+// Active scan dwell per channel; 13 channels take about 1.2 s, run async.
+constexpr uint32_t kApScanMsPerChannel = 90;
+constexpr uint8_t kApScanMaxRetries = 3;
+constexpr unsigned long kApScanRetryMs = 5000UL;
+constexpr size_t kApScanMaxNetworks = 48;
+
+bool modem_sleep_applied = false;
+bool http_seen = false;
+unsigned long last_http_ms = 0;
+unsigned long radio_on_since_ms = 0;
+
+StaLinkCache sta_link = {};
+bool sta_link_loaded = false;
+bool sta_fast_blocked = false;  // last directed attempt missed; scan next
+bool sta_attempt_fast = false;
+uint8_t sta_failures = 0;
+StaConnectStats sta_stats = {};
+
+uint8_t ap_channel_active = 0;
+bool ap_scan_pending = true;
+bool ap_scan_running = false;
+bool ap_scan_enabled_sta = false;  // scan needed the STA interface in AP-only mode
+uint8_t ap_scan_retries = 0;
+unsigned long ap_scan_next_ms = 0;
+ApChannelStats ap_stats = {};
+uint8_t ap_channel_saved = 0;  // pick persisted by an earlier boot
+bool ap_channel_saved_loaded = false;
+
+void load_ap_channel_saved() {
+  if (ap_channel_saved_loaded) return;
+  ap_channel_saved = load_ap_channel_pick();
+  ap_channel_saved_loaded = true;
+}
+
+uint8_t ap_channel_wanted() {
+  if (net_cfg.ap_channel >= 1 && net_cfg.ap_channel <= AP_CHANNEL_MAX) return net_cfg.ap_channel;
+  if (ap_stats.auto_pick) return ap_stats.auto_pick;
+  load_ap_channel_saved();
+  return ap_channel_saved ? ap_channel_saved : 1;
+}
 
 bool start_access_point(bool keep_sta, bool verbose) {
   WiFi.setSleep(false);
+  modem_sleep_applied = false;
   WiFi.mode(keep_sta ? WIFI_AP_STA : WIFI_AP);
-  const bool ok = WiFi.softAP(ap_ssid, ap_password);
+  const uint8_t channel = ap_channel_wanted();
+  const bool ok = WiFi.softAP(ap_ssid, ap_password, channel);
   ap_active = ok;
+  ap_channel_active = ok ? channel : 0;
+  if (!ok) ap_stats.start_failures++;
+  flight_log(FLIGHT_EVENT_WIFI, ok ? FLIGHT_WIFI_AP_STARTED : FLIGHT_WIFI_AP_FAILED, channel);
 
   if (verbose) {
     char ip[24];
     ip_to_str(WiFi.softAPIP(), ip, sizeof(ip));
-    Serial.println();
-    Serial.println("[remote] Wi-Fi AP mode");
-    Serial.print("[remote] SSID: ");
-    Serial.println(ap_ssid);
-    Serial.print("[remote] PASS: ");
-    Serial.println(ap_password);
-    Serial.print("[remote] URL:  http://");
-    Serial.println(ip[0] ? ip : "0.0.0.0");
+    SerialLog.println();
+    SerialLog.println("[remote] Wi-Fi AP mode");
+    SerialLog.print("[remote] SSID: ");
+    SerialLog.println(ap_ssid);
+    SerialLog.print("[remote] PASS: ");
+    SerialLog.println(ap_password);
+    SerialLog.print("[remote] URL:  http://");
+    SerialLog.println(ip[0] ? ip : "0.0.0.0");
+    SerialLog.print("[remote] Channel: ");
+    SerialLog.print((int)channel);
+    SerialLog.println(net_cfg.ap_channel ? " (fixed)"
+                      : ap_stats.auto_pick ? " (auto)"
+                      : ap_channel_saved   ? " (auto, last pick, scan pending)"
+                                           : " (auto, scan pending)");
     if (!ok) {
-      Serial.println("[remote] AP start failed");
+      SerialLogError.println("[remote] AP start failed");
     }
   }
   return ok;
@@ -46,8 +109,9 @@ void stop_access_point_internal(bool verbose) {
   if (!ap_active) return;
   WiFi.softAPdisconnect(true);
   ap_active = false;
+  ap_channel_active = 0;
   if (verbose) {
-    Serial.println("[remote] AP disabled after STA link established");
+    SerialLog.println("[remote] AP disabled after STA link established");
   }
 }
 
@@ -56,11 +120,11 @@ void start_mdns_if_possible() {
   if (!sta_connected) return;
   if (MDNS.begin(net_cfg.hostname)) {
     mdns_active = true;
-    Serial.print("[remote] mDNS: http://");
-    Serial.print(net_cfg.hostname);
-    Serial.println(".local");
+    SerialLog.print("[remote] mDNS: http://");
+    SerialLog.print(net_cfg.hostname);
+    SerialLog.println(".local");
   } else {
-    Serial.println("[remote] mDNS start failed");
+    SerialLogWarn.println("[remote] mDNS start failed");
   }
 }
 
@@ -74,24 +138,92 @@ void begin_sta_attempt(bool keep_ap) {
     WiFi.mode(WIFI_STA);
   }
   WiFi.setSleep(false);
+  modem_sleep_applied = false;
   WiFi.setHostname(net_cfg.hostname);
-  WiFi.begin(net_cfg.sta_ssid, net_cfg.sta_password);
+
+  if (!sta_link_loaded) {
+    load_sta_link_cache(&sta_link);
+    sta_link_loaded = true;
+  }
+  const bool fast = !sta_fast_blocked && sta_link_cache_matches(sta_link, net_cfg.sta_ssid);
+
+  // Static address if configured, else DHCP, also on a directed attempt.
+  if (net_cfg.static_ip != 0) {
+    WiFi.config(IPAddress(net_cfg.static_ip), IPAddress(net_cfg.static_gateway),
+                IPAddress(net_cfg.static_subnet), IPAddress(net_cfg.static_dns));
+  } else {
+    WiFi.config(IPAddress(), IPAddress(), IPAddress());
+  }
+
+  if (fast) {
+    WiFi.begin(net_cfg.sta_ssid, net_cfg.sta_password, sta_link.channel, sta_link.bssid);
+  } else {
+    WiFi.begin(net_cfg.sta_ssid, net_cfg.sta_password);
+  }
+  sta_attempt_fast = fast;
   sta_attempt_active = true;
   sta_attempt_started_ms = millis();
+  sta_connect_stats_attempt(&sta_stats);
+
+  SerialLogDebug.print("[remote] STA connect attempt: ");
+  SerialLogDebug.print(net_cfg.sta_ssid);
+  if (fast) {
+    SerialLogDebug.print(" (cached BSSID, channel ");
+    SerialLogDebug.print((int)sta_link.channel);
+    SerialLogDebug.print(")");
+  }
+  SerialLogDebug.println();
+}
 
-  Serial.print("[remote] STA connect attempt: ");
-  Serial.println(net_cfg.sta_ssid);
+void remember_sta_link() {
+  StaLinkCache link = {};
+  link.ssid_hash = sta_ssid_hash(net_cfg.sta_ssid);
+  const uint8_t *bssid = WiFi.BSSID();
+  if (bssid) memcpy(link.bssid, bssid, sizeof(link.bssid));
+  link.channel = (uint8_t)WiFi.channel();
+  // Flash is only written when the AP or channel actually changed.
+  if (memcmp(&link, &sta_link, sizeof(link)) != 0) {
+    sta_link = link;
+    save_sta_link_cache(sta_link);
+  }
 }
 
 void on_sta_connected() {
+  const uint32_t connect_ms = (uint32_t)(millis() - sta_attempt_started_ms);
+  const bool was_attempt = sta_attempt_active;
   sta_attempt_active = false;
   sta_connected = true;
   net_run_mode = RUN_STA_ONLY;
+  sta_failures = 0;
+  sta_fast_blocked = false;
+  if (was_attempt) sta_connect_stats_success(&sta_stats, sta_attempt_fast, connect_ms);
+  remember_sta_link();
+  flight_log(FLIGHT_EVENT_WIFI, FLIGHT_WIFI_STA_CONNECTED, was_attempt ? connect_ms : 0);
 
   char ip[24];
   ip_to_str(WiFi.localIP(), ip, sizeof(ip));
-  Serial.print("[remote] STA connected, IP: ");
-  Serial.println(ip[0] ? ip : "0.0.0.0");
+  SerialLog.print("[remote] STA connected, IP: ");
+  SerialLog.print(ip[0] ? ip : "0.0.0.0");
+  if (was_attempt) {
+    SerialLog.print(" in ");
+    SerialLog.print((unsigned long)connect_ms);
+    SerialLog.print(sta_attempt_fast ? " ms (fast)" : " ms (scan)");
+    SerialLogDebug.print("; connects ");
+    SerialLogDebug.print((unsigned long)sta_stats.connects);
+    SerialLogDebug.print("/");
+    SerialLogDebug.print((unsigned long)sta_stats.attempts);
+    SerialLogDebug.print(" (fast ");
+    SerialLogDebug.print((unsigned long)sta_stats.fast_connects);
+    SerialLogDebug.print(", fast misses ");
+    SerialLogDebug.print((unsigned long)sta_stats.fast_misses);
+    SerialLogDebug.print("), ms min/mean/max ");
+    SerialLogDebug.print((unsigned long)sta_stats.min_ms);
+    SerialLogDebug.print("/");
+    SerialLogDebug.print((unsigned long)sta_connect_stats_mean_ms(sta_stats));
+    SerialLogDebug.print("/");
+    SerialLogDebug.print((unsigned long)sta_stats.max_ms);
+  }
+  SerialLog.println();
 
   start_mdns_if_possible();
 
@@ -102,6 +234,8 @@ void on_sta_connected() {
 }
 
 void on_sta_connect_failed(const char *reason) {
+  const bool link_dropped = sta_connected;
+  const bool fast_miss = sta_attempt_active && sta_attempt_fast;
   sta_attempt_active = false;
   sta_connected = false;
   stop_mdns_if_active();
@@ -112,13 +246,109 @@ void on_sta_connect_failed(const char *reason) {
     start_access_point(false, true);
     net_run_mode = RUN_AP_ONLY;
   }
-  next_sta_retry_ms = millis() + kStaRetryIntervalMs;
+  // A dropped link retries at once (directed, the AP is most likely still
+  // there); a missed directed attempt falls straight back to a scan; real
+  // failures back off exponentially.
+  uint32_t retry_ms = 0;
+  if (fast_miss) {
+    sta_fast_blocked = true;
+    sta_connect_stats_fast_miss(&sta_stats);
+  } else if (!link_dropped) {
+    if (sta_failures < 255) sta_failures++;
+    retry_ms = sta_backoff_delay_ms(sta_failures);
+  }
+  next_sta_retry_ms = millis() + retry_ms;
+  flight_log(FLIGHT_EVENT_WIFI, link_dropped ? FLIGHT_WIFI_STA_DROPPED : FLIGHT_WIFI_STA_FAILED, sta_failures);
+
+  SerialLog.print("[remote] STA connect failed: ");
+  SerialLog.print(reason ? reason : "unknown");
+  if (fast_miss) SerialLog.print(" (cached BSSID)");
+  SerialLog.println();
+  SerialLogDebug.print("[remote] Fallback AP remains active. Retry in ");
+  SerialLogDebug.print((unsigned long)retry_ms);
+  SerialLogDebug.println(" ms");
+}
 
-  Serial.print("[remote] STA connect failed: ");
-  Serial.println(reason ? reason : "unknown");
-  Serial.print("[remote] Fallback AP remains active. Retry in ");
-  Serial.print(kStaRetryIntervalMs / 1000UL);
-  Serial.println(" s");
+void ap_scan_finish() {
+  WiFi.scanDelete();
+  if (ap_scan_enabled_sta) {
+    ap_scan_enabled_sta = false;
+    if (net_run_mode == RUN_AP_ONLY && ap_active) WiFi.mode(WIFI_AP);
+  }
+}
+
+void ap_scan_failed(const char *what) {
+  ap_stats.scan_failures++;
+  if (ap_scan_retries < kApScanMaxRetries) {
+    ap_scan_retries++;
+    ap_scan_pending = true;
+    ap_scan_next_ms = millis() + kApScanRetryMs * ap_scan_retries;
+  }
+  SerialLogDebug.print("[remote] AP channel scan failed (");
+  SerialLogDebug.print(what);
+  SerialLogDebug.print("), ");
+  if (ap_scan_pending) {
+    SerialLogDebug.print("retry ");
+    SerialLogDebug.print((int)ap_scan_retries);
+    SerialLogDebug.print("/");
+    SerialLogDebug.println((int)kApScanMaxRetries);
+  } else {
+    SerialLogDebug.println("keeping current channel");
+  }
+}
+
+void ap_scan_evaluate(int16_t found) {
+  ApChannelObservation obs[kApScanMaxNetworks];
+  size_t count = 0;
+  for (int16_t i = 0; i < found && count < kApScanMaxNetworks; ++i) {
+    const int32_t ch = WiFi.channel(i);
+    if (ch < 1 || ch > AP_CHANNEL_MAX) continue;
+    obs[count].channel = (uint8_t)ch;
+    obs[count].rssi = (int8_t)WiFi.RSSI(i);
+    count++;
+  }
+  ap_scan_finish();
+
+  float load[AP_CHANNEL_MAX + 1];
+  ap_channel_score(obs, count, AP_CHANNEL_AUTO_MAX, load);
+  const uint8_t pick = ap_channel_pick(load, AP_CHANNEL_AUTO_MAX);
+  ap_stats.auto_pick = pick;
+  ap_stats.networks_seen = (uint16_t)count;
+  ap_scan_retries = 0;
+  // Flash is only written when the pick actually changed.
+  load_ap_channel_saved();
+  if (pick != ap_channel_saved && save_ap_channel_pick(pick)) ap_channel_saved = pick;
+
+  SerialLogDebug.print("[remote] AP channel scan: ");
+  SerialLogDebug.print((unsigned)count);
+  SerialLogDebug.print(" networks, least congested ");
+  SerialLogDebug.print((int)pick);
+  SerialLogDebug.print(" (load ");
+  SerialLogDebug.print((int)load[pick]);
+  if (ap_channel_active >= 1 && ap_channel_active <= AP_CHANNEL_AUTO_MAX) {
+    SerialLogDebug.print(", current ");
+    SerialLogDebug.print((int)ap_channel_active);
+    SerialLogDebug.print(" load ");
+    SerialLogDebug.print((int)load[ap_channel_active]);
+  }
+  SerialLogDebug.println(")");
+
+  // Moving the AP drops its clients; only do it while nobody is attached.
+  if (!ap_active || net_cfg.ap_channel != 0 || ap_channel_active > AP_CHANNEL_AUTO_MAX) return;
+  if (!ap_channel_should_switch(load, ap_channel_active, pick)) return;
+  if (WiFi.softAPgetStationNum() > 0) {
+    SerialLogDebug.println("[remote] AP channel kept: client attached (applies on next AP start)");
+    return;
+  }
+  if (WiFi.softAP(ap_ssid, ap_password, pick)) {
+    ap_channel_active = pick;
+    ap_stats.switches++;
+    flight_log(FLIGHT_EVENT_WIFI, FLIGHT_WIFI_AP_CHANNEL, pick);
+    SerialLog.print("[remote] AP moved to channel ");
+    SerialLog.println((int)pick);
+  } else {
+    ap_stats.start_failures++;
+  }
 }
 
 }  // namespace
@@ -158,12 +388,17 @@ void switch_to_ap_only_mode() {
   stop_mdns_if_active();
   WiFi.disconnect(false, false);
   if (!start_access_point(false, true)) {
-    Serial.println("[remote] AP-only recovery failed to start AP");
+    SerialLogError.println("[remote] AP-only recovery failed to start AP");
   }
   net_run_mode = RUN_AP_ONLY;
 }
 
 void apply_network_config() {
+  // Re-survey on every (re)configuration; the scan itself runs later, async.
+  ap_scan_pending = true;
+  ap_scan_retries = 0;
+  ap_scan_next_ms = millis();
+
   if (!net_cfg.prefer_sta || net_cfg.sta_ssid[0] == '\0') {
     switch_to_ap_only_mode();
     return;
@@ -171,16 +406,128 @@ void apply_network_config() {
 
   net_run_mode = RUN_AP_FALLBACK;
   if (!start_access_point(true, true)) {
-    Serial.println("[remote] AP fallback failed to start; forcing AP-only recovery");
+    SerialLogWarn.println("[remote] AP fallback failed to start; forcing AP-only recovery");
     switch_to_ap_only_mode();
     return;
   }
   next_sta_retry_ms = millis();
   sta_attempt_active = false;
   sta_connected = false;
+  sta_failures = 0;
+  sta_fast_blocked = false;
   stop_mdns_if_active();
 }
 
+
+void network_note_http_request() {
+  last_http_ms = millis();
+  http_seen = true;
+}
+
+unsigned long network_http_idle_ms() {
+  const unsigned long now = millis();
+  return http_seen ? (now - last_http_ms) : now;
+}
+
+void update_wifi_power_save() {
+  // Power save only applies to a station; a soft-AP has to listen for its
+  // clients continuously. Sleep once the link is up and no client has asked
+  // for anything lately, wake immediately on the next request.
+  const bool http_recent = http_seen && (millis() - last_http_ms) < kModemSleepAfterHttpMs;
+  const bool want_sleep = sta_connected && !ap_active && !http_recent;
+  if (want_sleep != modem_sleep_applied) {
+    WiFi.setSleep(want_sleep);
+    modem_sleep_applied = want_sleep;
+  }
+
+  PowerWifiMode mode = POWER_WIFI_OFF;
+  if (ap_active) {
+    mode = POWER_WIFI_AP;
+  } else if (sta_connected || sta_attempt_active) {
+    mode = modem_sleep_applied ? POWER_WIFI_STA_MODEM_SLEEP : POWER_WIFI_STA_ACTIVE;
+  }
+  power_manager_set_wifi_mode(mode);
+}
+
+void update_ap_channel() {
+  if (ap_scan_running) {
+    const int16_t found = WiFi.scanComplete();
+    if (found == WIFI_SCAN_RUNNING) return;
+    ap_scan_running = false;
+    if (found < 0) {
+      ap_scan_finish();
+      ap_scan_failed("no result");
+      return;
+    }
+    ap_scan_evaluate(found);
+    return;
+  }
+
+  if (!ap_scan_pending || !ap_active || net_cfg.ap_channel != 0) return;
+  // A scan in the middle of a station attempt breaks the attempt.
+  if (sta_attempt_active || sta_connected) return;
+  if ((long)(millis() - ap_scan_next_ms) < 0) return;
+
+  ap_scan_pending = false;
+  ap_scan_enabled_sta = (WiFi.getMode() == WIFI_AP);
+  ap_stats.scans++;
+  const int16_t started = WiFi.scanNetworks(true, true, false, kApScanMsPerChannel);
+  if (started == WIFI_SCAN_FAILED) {
+    ap_scan_finish();
+    ap_scan_failed("start");
+    return;
+  }
+  ap_scan_running = true;
+}
+
+void network_get_ap_channel_stats(ApChannelStats *out) {
+  if (!out) return;
+  *out = ap_stats;
+  out->channel = ap_channel_active;
+}
+
+void network_get_sta_stats(StaConnectStats *out) {
+  if (out) *out = sta_stats;
+}
+
+void network_radio_on() {
+  radio_on_since_ms = millis();
+  if (radio_on) return;
+  radio_on = true;
+  flight_log(FLIGHT_EVENT_WIFI, FLIGHT_WIFI_RADIO_ON, 0);
+  SerialLog.println("[remote] Wi-Fi radio on");
+  apply_network_config();
+}
+
+void network_radio_off(const char *reason) {
+  if (!radio_on) return;
+  if (ap_scan_running) {
+    ap_scan_running = false;
+    ap_scan_finish();
+  }
+  stop_mdns_if_active();
+  stop_access_point_internal(false);
+  WiFi.disconnect(false, false);
+  WiFi.mode(WIFI_OFF);
+  sta_attempt_active = false;
+  sta_connected = false;
+  modem_sleep_applied = false;
+  radio_on = false;
+  power_manager_set_wifi_mode(POWER_WIFI_OFF);
+  flight_log(FLIGHT_EVENT_WIFI, FLIGHT_WIFI_RADIO_OFF, 0);
+  SerialLog.print("[remote] Wi-Fi radio off (");
+  SerialLog.print(reason ? reason : "request");
+  SerialLog.println(")");
+}
+
+unsigned long network_radio_idle_ms() {
+  const unsigned long now = millis();
+  const unsigned long since_on = now - radio_on_since_ms;
+  if (!http_seen) return since_on;
+  const unsigned long since_http = now - last_http_ms;
+  return (since_http < since_on) ? since_http : since_on;
+}
+
 void loop_network_manager() {
   if (!net_cfg.prefer_sta || net_cfg.sta_ssid[0] == '\0') {
     return;
@@ -210,13 +557,13 @@ void loop_network_manager() {
 
   if (sta_attempt_active) {
     const unsigned long elapsed = millis() - sta_attempt_started_ms;
-    if (elapsed >= kStaConnectTimeoutMs) {
+    if (elapsed >= (sta_attempt_fast ? kStaFastConnectTimeoutMs : kStaConnectTimeoutMs)) {
       on_sta_connect_failed("timeout");
     }
     return;
   }
 
-  if ((long)(millis() - next_sta_retry_ms) >= 0) {
+  if ((long)(millis() - next_sta_retry_ms) >= 0 && !ap_scan_running) {
     begin_sta_attempt(true);
   }
 }
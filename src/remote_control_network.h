@@ -2,6 +2,9 @@
 
 #include <WiFi.h>
 
+#include "ap_channel.h"
+#include "sta_reconnect.h"
+
 enum NetworkRunMode {
   RUN_AP_ONLY = 0,
   RUN_STA_ONLY = 1,
@@ -13,6 +16,24 @@ struct NetworkConfig {
   char sta_ssid[33];
   char sta_password[65];
   char hostname[33];
+  bool radio_on_demand;      // Wi-Fi off until requested, off again when idle
+  uint16_t radio_idle_off_s; // idle period for radio_on_demand
+  // Optional static STA address (IPAddress raw values); static_ip 0 = DHCP.
+  uint32_t static_ip;
+  uint32_t static_gateway;
+  uint32_t static_subnet;
+  uint32_t static_dns;
+  uint8_t ap_channel;         // soft-AP channel 1..13; 0 = least congested (scan)
+};
+
+struct ApChannelStats {
+  uint8_t channel;         // the AP is on this channel now (0 = AP down)
+  uint8_t auto_pick;       // last scan result, 0 = none yet
+  uint16_t networks_seen;  // in that scan
+  uint32_t scans;
+  uint32_t scan_failures;
+  uint32_t switches;       // AP moved after a scan
+  uint32_t start_failures; // softAP() refused
 };
 
 extern char ap_ssid[32];
@@ -23,6 +44,7 @@ extern bool ap_active;
 extern bool sta_connected;
 extern bool sta_attempt_active;
 extern bool mdns_active;
+extern bool radio_on;
 extern unsigned long sta_attempt_started_ms;
 extern unsigned long next_sta_retry_ms;
 
@@ -33,3 +55,20 @@ void stop_access_point(bool verbose);
 void switch_to_ap_only_mode();
 void apply_network_config();
 void loop_network_manager();
+// Web handlers report activity; the manager drops the station into modem
+// sleep while nobody is polling.
+void network_note_http_request();
+unsigned long network_http_idle_ms();
+void update_wifi_power_save();
+// Runs the AP channel scan (async) and moves the AP when it finds a clearly
+// quieter channel and no client is attached. Call from the remote loop.
+void update_ap_channel();
+void network_get_ap_channel_stats(ApChannelStats *out);
+// Station connect-time statistics since boot.
+void network_get_sta_stats(StaConnectStats *out);
+// Radio on demand. network_radio_on() starts (or keeps) the configured AP/STA
+// and restarts the idle period; network_radio_off() takes Wi-Fi down fully.
+void network_radio_on();
+void network_radio_off(const char *reason);
+// Time since the radio came on or the last web request, whichever is later.
+unsigned long network_radio_idle_ms();
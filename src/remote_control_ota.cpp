@@ -4,6 +4,7 @@
 #include <mbedtls/sha256.h>
 #include <string.h>
 
+#include "flight_log.h"
 #include "remote_protocol_utils.h"
 
 namespace {
@@ -142,6 +143,8 @@ void handle_ota_upload_data(WebServer &server, const char *current_version) {
 
       if (!Update.begin(UPDATE_SIZE_UNKNOWN, U_FLASH)) {
         snprintf(ota_error, sizeof(ota_error), "Update.begin failed");
+      } else {
+        flight_log(FLIGHT_EVENT_OTA, FLIGHT_OTA_START, 0);
       }
       break;
     }
@@ -193,6 +196,7 @@ void handle_ota_upload_data(WebServer &server, const char *current_version) {
           Update.abort();
         }
       }
+      flight_log(FLIGHT_EVENT_OTA, ota_upload_ok ? FLIGHT_OTA_DONE : FLIGHT_OTA_FAILED, (uint32_t)ota_written_bytes);
       ota_upload_in_progress = false;
       break;
     }
@@ -205,6 +209,7 @@ void handle_ota_upload_data(WebServer &server, const char *current_version) {
         ota_sha_ctx_active = false;
       }
       snprintf(ota_error, sizeof(ota_error), "Upload aborted");
+      flight_log(FLIGHT_EVENT_OTA, FLIGHT_OTA_ABORTED, (uint32_t)ota_written_bytes);
       ota_upload_in_progress = false;
       ota_upload_ok = false;
       break;
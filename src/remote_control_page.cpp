@@ -363,6 +363,57 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
           <option value="off">Disabled</option>
         </select>
       </label>
+      <label style="min-width:170px;">
+        <div class="muted" style="margin:0 0 4px 0;">Display frame rate</div>
+        <select id="deviceDisplayFps">
+          <option value="10">10 fps</option>
+          <option value="15">15 fps</option>
+          <option value="20">20 fps</option>
+          <option value="30">30 fps</option>
+          <option value="45">45 fps</option>
+          <option value="60">60 fps</option>
+        </select>
+      </label>
+      <label style="min-width:170px;">
+        <div class="muted" style="margin:0 0 4px 0;">Dim screen when idle</div>
+        <select id="deviceDisplayDim">
+          <option value="0">Never</option>
+          <option value="30">After 30 s</option>
+          <option value="60">After 1 min</option>
+          <option value="120">After 2 min</option>
+          <option value="300">After 5 min</option>
+        </select>
+      </label>
+      <label style="min-width:170px;">
+        <div class="muted" style="margin:0 0 4px 0;">Turn screen off when idle</div>
+        <select id="deviceDisplayBlank">
+          <option value="0">Never</option>
+          <option value="120">After 2 min</option>
+          <option value="300">After 5 min</option>
+          <option value="600">After 10 min</option>
+          <option value="1800">After 30 min</option>
+        </select>
+      </label>
+      <label style="min-width:170px;">
+        <div class="muted" style="margin:0 0 4px 0;">Sleep on battery when idle</div>
+        <select id="deviceAutoSleep">
+          <option value="0">Never</option>
+          <option value="300">After 5 min</option>
+          <option value="600">After 10 min</option>
+          <option value="1800">After 30 min</option>
+          <option value="3600">After 60 min</option>
+        </select>
+      </label>
+      <label style="min-width:170px;">
+        <div class="muted" style="margin:0 0 4px 0;">Wi-Fi radio</div>
+        <select id="deviceRadioIdle">
+          <option value="0">Always on</option>
+          <option value="60">On demand, off after 1 min idle</option>
+          <option value="300">On demand, off after 5 min idle</option>
+          <option value="600">On demand, off after 10 min idle</option>
+          <option value="1800">On demand, off after 30 min idle</option>
+        </select>
+      </label>
       <label class="slider-control">
         <div class="muted" style="margin:0 0 4px 0;">Brightness</div>
         <div class="row">
@@ -397,6 +448,25 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
         <div class="muted" style="margin:0 0 4px 0;">Hostname</div>
         <input id="netHostname" type="text" placeholder="incidence-perfect-ng" maxlength="32">
       </label>
+      <label style="min-width:120px;">
+        <div class="muted" style="margin:0 0 4px 0;">AP channel</div>
+        <select id="netApChannel">
+          <option value="auto">Auto (least congested)</option>
+          <option value="1">1</option>
+          <option value="2">2</option>
+          <option value="3">3</option>
+          <option value="4">4</option>
+          <option value="5">5</option>
+          <option value="6">6</option>
+          <option value="7">7</option>
+          <option value="8">8</option>
+          <option value="9">9</option>
+          <option value="10">10</option>
+          <option value="11">11</option>
+          <option value="12">12</option>
+          <option value="13">13</option>
+        </select>
+      </label>
     </div>
     <div class="row" style="margin-top:8px;">
       <label style="flex:1; min-width:180px;">
@@ -408,6 +478,24 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
         <input id="netPassword" type="password" placeholder="Leave blank to keep existing" maxlength="64">
       </label>
     </div>
+    <div class="row" style="margin-top:8px;">
+      <label style="flex:1; min-width:140px;">
+        <div class="muted" style="margin:0 0 4px 0;">STA static IP</div>
+        <input id="netStaticIp" type="text" placeholder="Blank = DHCP" maxlength="15">
+      </label>
+      <label style="flex:1; min-width:140px;">
+        <div class="muted" style="margin:0 0 4px 0;">Gateway</div>
+        <input id="netStaticGateway" type="text" placeholder="192.168.1.1" maxlength="15">
+      </label>
+      <label style="flex:1; min-width:140px;">
+        <div class="muted" style="margin:0 0 4px 0;">Subnet mask</div>
+        <input id="netStaticSubnet" type="text" placeholder="255.255.255.0" maxlength="15">
+      </label>
+      <label style="flex:1; min-width:140px;">
+        <div class="muted" style="margin:0 0 4px 0;">DNS</div>
+        <input id="netStaticDns" type="text" placeholder="Gateway" maxlength="15">
+      </label>
+    </div>
     <div class="row" style="margin-top:10px;">
       <button id="netSaveBtn" onclick="saveNetwork()">Save</button>
       <button id="netRecoverBtn" onclick="recoverNetwork()">Recover AP Mode</button>
@@ -484,6 +572,21 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
           <div class="diag-row"><span>Physics</span><code id="diagPhys">--</code></div>
           <div class="diag-row"><span>Conditioning</span><code id="diagCond">--</code></div>
         </div>
+        <div class="diag-block">
+          <h3>Display</h3>
+          <div class="diag-row"><span>Rate</span><code id="diagRenderRate">--</code></div>
+          <div class="diag-row"><span>Frame</span><code id="diagRenderFrame">--</code></div>
+          <div class="diag-row"><span>Bus</span><code id="diagRenderBus">--</code></div>
+          <div class="diag-row"><span>Power</span><code id="diagRenderPower">--</code></div>
+          <div class="diag-row"><span>LVGL heap</span><code id="diagLvMem">--</code></div>
+          <div class="diag-row"><span>Internal RAM</span><code id="diagInternalRam">--</code></div>
+          <div class="diag-row"><span>Touch bus</span><code id="diagTouchBus">--</code></div>
+          <div class="diag-row"><span>I2C IMU</span><code id="diagI2cImu">--</code></div>
+          <div class="diag-row"><span>I2C touch</span><code id="diagI2cTouch">--</code></div>
+          <div class="diag-row"><span>CPU power</span><code id="diagPmCpu">--</code></div>
+          <div class="diag-row"><span>Battery life</span><code id="diagPmLife">--</code></div>
+          <div class="diag-row"><span>Boot</span><code id="diagBoot">--</code></div>
+        </div>
         <div class="diag-block">
           <h3>Calibration Refs</h3>
           <div class="diag-row"><span>Bias A</span><code id="diagBiasA">--</code></div>
@@ -560,6 +663,11 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
     const deviceTouchEnabledEl = document.getElementById('deviceTouchEnabled');
     const deviceTouchPersistEl = document.getElementById('deviceTouchPersist');
     const deviceDisplayBrightnessEl = document.getElementById('deviceDisplayBrightness');
+    const deviceDisplayFpsEl = document.getElementById('deviceDisplayFps');
+    const deviceDisplayDimEl = document.getElementById('deviceDisplayDim');
+    const deviceDisplayBlankEl = document.getElementById('deviceDisplayBlank');
+    const deviceAutoSleepEl = document.getElementById('deviceAutoSleep');
+    const deviceRadioIdleEl = document.getElementById('deviceRadioIdle');
     const deviceBrightnessValueEl = document.getElementById('deviceBrightnessValue');
     const deviceSaveBtn = document.getElementById('deviceSaveBtn');
     const deviceMsgEl = document.getElementById('deviceMsg');
@@ -567,8 +675,13 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
     const netAddrEl = document.getElementById('netAddr');
     const netModeEl = document.getElementById('netMode');
     const netHostnameEl = document.getElementById('netHostname');
+    const netApChannelEl = document.getElementById('netApChannel');
     const netSsidEl = document.getElementById('netSsid');
     const netPasswordEl = document.getElementById('netPassword');
+    const netStaticIpEl = document.getElementById('netStaticIp');
+    const netStaticGatewayEl = document.getElementById('netStaticGateway');
+    const netStaticSubnetEl = document.getElementById('netStaticSubnet');
+    const netStaticDnsEl = document.getElementById('netStaticDns');
     const netSaveBtn = document.getElementById('netSaveBtn');
     const netRecoverBtn = document.getElementById('netRecoverBtn');
     const netMsgEl = document.getElementById('netMsg');
@@ -590,6 +703,18 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
     const diagCorrGEl = document.getElementById('diagCorrG');
     const diagPhysEl = document.getElementById('diagPhys');
     const diagCondEl = document.getElementById('diagCond');
+    const diagRenderRateEl = document.getElementById('diagRenderRate');
+    const diagRenderFrameEl = document.getElementById('diagRenderFrame');
+    const diagRenderBusEl = document.getElementById('diagRenderBus');
+    const diagRenderPowerEl = document.getElementById('diagRenderPower');
+    const diagLvMemEl = document.getElementById('diagLvMem');
+    const diagInternalRamEl = document.getElementById('diagInternalRam');
+    const diagTouchBusEl = document.getElementById('diagTouchBus');
+    const diagI2cImuEl = document.getElementById('diagI2cImu');
+    const diagI2cTouchEl = document.getElementById('diagI2cTouch');
+    const diagPmCpuEl = document.getElementById('diagPmCpu');
+    const diagPmLifeEl = document.getElementById('diagPmLife');
+    const diagBootEl = document.getElementById('diagBoot');
     const diagBiasAEl = document.getElementById('diagBiasA');
     const diagBiasGEl = document.getElementById('diagBiasG');
     const diagZeroEl = document.getElementById('diagZero');
@@ -639,10 +764,10 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
     let networkFailureCount = 0;
     let lastDisplacementRenderMs = 0;
 
-    [deviceBatteryModeEl, deviceZeroOnBootEl, deviceDisplayPrecisionEl, deviceTouchEnabledEl, deviceTouchPersistEl, deviceDisplayBrightnessEl].forEach((el) => {
+    [deviceBatteryModeEl, deviceZeroOnBootEl, deviceDisplayPrecisionEl, deviceTouchEnabledEl, deviceTouchPersistEl, deviceDisplayBrightnessEl, deviceDisplayFpsEl, deviceDisplayDimEl, deviceDisplayBlankEl, deviceAutoSleepEl, deviceRadioIdleEl].forEach((el) => {
       el.addEventListener('input', () => { deviceFormDirty = true; syncBrightnessLabel(); });
     });
-    [netModeEl, netHostnameEl, netSsidEl, netPasswordEl].forEach((el) => {
+    [netModeEl, netHostnameEl, netApChannelEl, netSsidEl, netPasswordEl, netStaticIpEl, netStaticGatewayEl, netStaticSubnetEl, netStaticDnsEl].forEach((el) => {
       el.addEventListener('input', () => { networkFormDirty = true; });
     });
     otaFileEl.addEventListener('change', onOtaFileSelected);
@@ -817,6 +942,24 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
       return Number.isFinite(n) ? n.toFixed(d) : '--';
     }
 
+    function i2cText(s, dev) {
+      const hist = s[`i2c_${dev}_lat_hist`];
+      const results = s[`i2c_${dev}_results`];
+      const edges = s.i2c_lat_edges_us;
+      if (!Array.isArray(hist) || !Array.isArray(results) || !Array.isArray(edges)) return '--';
+      const total = hist.reduce((a, b) => a + b, 0);
+      let p95 = '--';
+      for (let i = 0, seen = 0; i < hist.length && total > 0; i++) {
+        seen += hist[i];
+        if (seen >= total * 0.95) {
+          p95 = i < edges.length ? `<${edges[i]}` : `>=${edges[edges.length - 1]}`;
+          break;
+        }
+      }
+      const errors = results.slice(1).reduce((a, b) => a + b, 0);
+      return `${f(s[`i2c_${dev}_n`], 0)} xfers  p95 ${p95} us  max ${f(s[`i2c_${dev}_lat_max_us`], 0)} us  err ${errors} @ ${f(s.i2c_khz, 0)} kHz`;
+    }
+
     function sanitizeUnitText(raw) {
       const cleaned = String(raw || '').trim();
       return cleaned ? cleaned : 'mm';
@@ -840,6 +983,44 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
       return Math.max(10, Math.min(100, rounded));
     }
 
+    function sanitizeDisplayFps(raw) {
+      const value = Number(raw);
+      if (!Number.isFinite(value)) return 30;
+      return Math.max(10, Math.min(60, Math.round(value)));
+    }
+
+    function sanitizeIdleTimeout(raw) {
+      const value = Number(raw);
+      if (!Number.isFinite(value) || value <= 0) return 0;
+      return Math.min(2540, Math.round(value));
+    }
+
+    function sanitizeAutoSleep(raw) {
+      const value = Number(raw);
+      if (!Number.isFinite(value) || value <= 0) return 0;
+      return Math.min(254, Math.max(1, Math.round(value / 60))) * 60;
+    }
+
+    // 0 = radio always on; otherwise on demand with this idle period.
+    function sanitizeRadioIdle(raw) {
+      const value = Number(raw);
+      if (!Number.isFinite(value) || value <= 0) return 0;
+      return Math.max(60, Math.min(3600, Math.round(value)));
+    }
+
+    function formatIdleTimeout(sec) {
+      if (sec <= 0) return 'never';
+      return (sec % 60 === 0) ? `${sec / 60} min` : `${sec} s`;
+    }
+
+    function setIdleTimeoutSelect(el, raw, sanitize = sanitizeIdleTimeout) {
+      const value = String(sanitize(raw));
+      if (!Array.from(el.options).some((o) => o.value === value)) {
+        el.add(new Option(`After ${formatIdleTimeout(Number(value))}`, value));
+      }
+      el.value = value;
+    }
+
     function syncBrightnessLabel() {
       deviceBrightnessValueEl.textContent = `${sanitizeDisplayBrightness(deviceDisplayBrightnessEl.value)}%`;
     }
@@ -1707,6 +1888,18 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
       diagCorrGEl.textContent = vec2(s.corr_gx, s.corr_gy, 3);
       diagPhysEl.textContent = `r=${f(s.phys_roll, 2)}\u00B0  p=${f(s.phys_pitch, 2)}\u00B0`;
       diagCondEl.textContent = `${f(s.roll_cond_pct, 0)}%${s.roll_cond_low ? ' (low)' : ''}`;
+      diagRenderRateEl.textContent = `${f(s.ui_fps, 1)} fps (${s.ui_render_active ? 'active' : 'idle'}, target ${f(s.ui_target_fps, 0)} / idle ${f(s.ui_idle_fps, 0)})`;
+      diagRenderFrameEl.textContent = `avg ${f(s.ui_frame_ms, 2)} ms  max ${f(s.ui_frame_max_ms, 2)} ms`;
+      diagRenderBusEl.textContent = `${f(s.ui_px_pushed, 0)} / ${f(s.ui_px_invalidated, 0)} px/s${s.ui_direct_mode ? ' (direct)' : ''}`;
+      diagRenderPowerEl.textContent = `${s.ui_power_state || '--'}  active ${f(s.ui_power_active_s, 0)} s  dim ${f(s.ui_power_dim_s, 0)} s  off ${f(s.ui_power_blank_s, 0)} s`;
+      diagLvMemEl.textContent = `${f(s.lv_mem_used / 1024, 1)} / ${f(s.lv_mem_total / 1024, 0)} KB  largest ${f(s.lv_mem_largest_free / 1024, 1)} KB (min ${f(s.lv_mem_largest_free_min / 1024, 1)})  frag ${f(s.lv_mem_frag_pct, 0)}%${s.lv_mem_psram ? ' (PSRAM)' : ''}`;
+      diagInternalRamEl.textContent = `${f(s.internal_free / 1024, 1)} KB free  largest ${f(s.internal_largest_free / 1024, 1)} KB`;
+      diagTouchBusEl.textContent = `${f(s.touch_reads, 0)} reads / ${f(s.touch_polls, 0)} polls  bus ${f(s.touch_bus_ms, 0)} ms  saved ~${f(s.touch_bus_saved_ms, 0)} ms${s.touch_irq ? ' (INT)' : ' (polling)'}`;
+      diagI2cImuEl.textContent = i2cText(s, 'imu');
+      diagI2cTouchEl.textContent = i2cText(s, 'touch');
+      diagPmCpuEl.textContent = `${s.pm_cpu || '--'} ${f(s.pm_cpu_min_mhz, 0)}-${f(s.pm_cpu_max_mhz, 0)} MHz  busy ${f(s.pm_busy_pct, 1)}% (fusion ${f(s.pm_busy_fusion_pct, 1)} / ui ${f(s.pm_busy_ui_pct, 1)} / http ${f(s.pm_busy_http_pct, 1)})  wifi ${s.pm_wifi || '--'}`;
+      diagPmLifeEl.textContent = `~${f(s.pm_est_ma, 0)} mA  ${f(s.pm_remaining_h, 1)} h left  full: fixed ${f(s.pm_life_fixed_h, 1)} / dfs ${f(s.pm_life_dfs_h, 1)} / sleep ${f(s.pm_life_light_sleep_h, 1)} h`;
+      diagBootEl.textContent = `setup ${f(s.boot_setup_ms, 1)} ms  first reading ${f(s.boot_first_reading_ms, 1)} ms  (/api/boot)`;
       diagBiasAEl.textContent = vec3(s.bias_ax, s.bias_ay, s.bias_az, 4);
       diagBiasGEl.textContent = vec2(s.bias_gx, s.bias_gy, 4);
       diagZeroEl.textContent = vec2(s.zero_roll, s.zero_pitch, 3);
@@ -1726,6 +1919,18 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
       diagCorrGEl.textContent = '--';
       diagPhysEl.textContent = '--';
       diagCondEl.textContent = '--';
+      diagRenderRateEl.textContent = '--';
+      diagRenderFrameEl.textContent = '--';
+      diagRenderBusEl.textContent = '--';
+      diagRenderPowerEl.textContent = '--';
+      diagLvMemEl.textContent = '--';
+      diagInternalRamEl.textContent = '--';
+      diagTouchBusEl.textContent = '--';
+      diagI2cImuEl.textContent = '--';
+      diagI2cTouchEl.textContent = '--';
+      diagPmCpuEl.textContent = '--';
+      diagPmLifeEl.textContent = '--';
+      diagBootEl.textContent = '--';
       diagBiasAEl.textContent = '--';
       diagBiasGEl.textContent = '--';
       diagZeroEl.textContent = '--';
@@ -1742,6 +1947,11 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
       const deviceBits = [`Battery ${batteryModeText}`, `Startup ZERO ${zeroOnBoot ? 'ON' : 'OFF'}`];
       deviceBits.push(`Readout ${currentDisplayDecimals}dp`);
       deviceBits.push(`Brightness ${brightnessPct}%`);
+      deviceBits.push(`Display ${sanitizeDisplayFps(s.display_fps)} fps`);
+      deviceBits.push(`Dim ${formatIdleTimeout(sanitizeIdleTimeout(s.display_dim_s))} / off ${formatIdleTimeout(sanitizeIdleTimeout(s.display_blank_s))}`);
+      deviceBits.push(`Sleep ${formatIdleTimeout(sanitizeAutoSleep(s.auto_sleep_s))}`);
+      const radioIdle = s.radio_on_demand ? sanitizeRadioIdle(s.radio_idle_s) : 0;
+      deviceBits.push(radioIdle ? `Wi-Fi on demand (off after ${formatIdleTimeout(radioIdle)})` : 'Wi-Fi always on');
       deviceBits.push(`Touch ${touchEnabled ? 'ON' : 'OFF'}${touchPersist ? ' (persist)' : ''}`);
       deviceStatusEl.textContent = deviceBits.join(' | ');
 
@@ -1749,7 +1959,16 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
       const pref = String(s.net_pref || 'ap').toUpperCase();
       const statusBits = [`Mode ${mode}`, `Preference ${pref}`];
       if (s.sta_connected) statusBits.push('STA connected');
-      if (s.ap_active) statusBits.push('AP active');
+      if (s.sta_connects > 0) {
+        statusBits.push(`Connect ${s.sta_connect_last_ms} ms (mean ${s.sta_connect_mean_ms} ms, ${s.sta_fast_connects}/${s.sta_connects} fast)`);
+      }
+      if (s.ap_active) {
+        const chanMode = (s.ap_channel_cfg > 0) ? 'fixed' : `auto, ${s.ap_scan_networks} networks seen`;
+        statusBits.push(`AP active, channel ${s.ap_channel} (${chanMode})`);
+      }
+      if (s.ap_scan_failures > 0 || s.ap_start_failures > 0) {
+        statusBits.push(`AP scans ${s.ap_scans} (${s.ap_scan_failures} failed), moves ${s.ap_channel_switches}, start failures ${s.ap_start_failures}`);
+      }
       netStatusEl.textContent = statusBits.join(' | ');
 
       const addrBits = [];
@@ -1766,13 +1985,27 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
         deviceTouchEnabledEl.value = touchEnabled ? 'on' : 'off';
         deviceTouchPersistEl.checked = touchPersist;
         deviceDisplayBrightnessEl.value = String(brightnessPct);
+        deviceDisplayFpsEl.value = String(sanitizeDisplayFps(s.display_fps));
+        setIdleTimeoutSelect(deviceDisplayDimEl, s.display_dim_s);
+        setIdleTimeoutSelect(deviceDisplayBlankEl, s.display_blank_s);
+        setIdleTimeoutSelect(deviceAutoSleepEl, s.auto_sleep_s, sanitizeAutoSleep);
+        const radioIdleValue = String(radioIdle);
+        if (!Array.from(deviceRadioIdleEl.options).some((o) => o.value === radioIdleValue)) {
+          deviceRadioIdleEl.add(new Option(`On demand, off after ${formatIdleTimeout(radioIdle)} idle`, radioIdleValue));
+        }
+        deviceRadioIdleEl.value = radioIdleValue;
         syncBrightnessLabel();
       }
 
       if (!networkFormDirty) {
         netModeEl.value = (String(s.net_pref || 'ap').toLowerCase() === 'sta') ? 'sta' : 'ap';
         netHostnameEl.value = s.hostname || '';
+        netApChannelEl.value = (s.ap_channel_cfg >= 1 && s.ap_channel_cfg <= 13) ? String(s.ap_channel_cfg) : 'auto';
         netSsidEl.value = s.sta_ssid || '';
+        netStaticIpEl.value = s.static_ip || '';
+        netStaticGatewayEl.value = s.static_gateway || '';
+        netStaticSubnetEl.value = s.static_subnet || '';
+        netStaticDnsEl.value = s.static_dns || '';
       }
     }
 
@@ -1817,9 +2050,11 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
         } else if (!batteryPresent && batteryPresentInferred) {
           batEl.textContent = `Battery likely not connected (inferred; rail ${batteryVolts} V)`;
         } else {
+          const tteH = Number(s.battery_tte_h || 0);
+          const tteText = tteH > 0 ? `, ~${tteH.toFixed(1)} h left at ${Number(s.battery_load_ma || 0).toFixed(0)} mA` : '';
           batEl.textContent = s.battery_charging
             ? `Battery charging (${batteryVolts} V, ${batteryPct}%)`
-            : `Battery not charging (${batteryVolts} V, ${batteryPct}%)`;
+            : `Battery not charging (${batteryVolts} V, ${batteryPct}%${tteText})`;
         }
       } else {
         batEl.textContent = 'Battery telemetry unavailable';
@@ -1945,7 +2180,12 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
         body.set('mode', mode);
         body.set('ssid', ssid);
         body.set('hostname', hostname);
+        body.set('ap_channel', netApChannelEl.value);
         if (password.length > 0) body.set('password', password);
+        body.set('static_ip', netStaticIpEl.value.trim());
+        body.set('static_gateway', netStaticGatewayEl.value.trim());
+        body.set('static_subnet', netStaticSubnetEl.value.trim());
+        body.set('static_dns', netStaticDnsEl.value.trim());
 
         const r = await fetch('/api/network', {
           method: 'POST',
@@ -1979,6 +2219,11 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
       const touchEnabled = deviceTouchEnabledEl.value === 'off' ? 'off' : 'on';
       const touchPersist = deviceTouchPersistEl.checked ? 'on' : 'off';
       const displayBrightness = String(sanitizeDisplayBrightness(deviceDisplayBrightnessEl.value));
+      const displayFps = String(sanitizeDisplayFps(deviceDisplayFpsEl.value));
+      const displayDim = String(sanitizeIdleTimeout(deviceDisplayDimEl.value));
+      const displayBlank = String(sanitizeIdleTimeout(deviceDisplayBlankEl.value));
+      const autoSleep = String(sanitizeAutoSleep(deviceAutoSleepEl.value));
+      const radioIdle = sanitizeRadioIdle(deviceRadioIdleEl.value);
 
       deviceSaveBtn.disabled = true;
       deviceMsgEl.textContent = 'Saving device settings...';
@@ -1990,6 +2235,12 @@ const char PAGE_HTML[] PROGMEM = R"HTML(
         body.set('touch_enabled', touchEnabled);
         body.set('touch_persist', touchPersist);
         body.set('display_brightness', displayBrightness);
+        body.set('display_fps', displayFps);
+        body.set('display_dim_s', displayDim);
+        body.set('display_blank_s', displayBlank);
+        body.set('auto_sleep_s', autoSleep);
+        body.set('radio_on_demand', radioIdle ? 'on' : 'off');
+        if (radioIdle) body.set('radio_idle_s', String(radioIdle));
 
         const r = await fetch('/api/network', {
           method: 'POST',
@@ -0,0 +1,55 @@
+#include "resume_state.h"
+
+#include <stddef.h>
+
+namespace {
+
+uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+  crc = ~crc;
+  for (size_t i = 0; i < len; ++i) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0U - (crc & 1U)));
+    }
+  }
+  return ~crc;
+}
+
+}  // namespace
+
+uint32_t resume_state_fw_hash(const char *fw_version) {
+  uint32_t hash = 2166136261u;
+  for (const char *p = fw_version; p && *p; ++p) {
+    hash ^= (uint8_t)*p;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+uint32_t resume_state_crc(const ResumeState &state) {
+  return crc32_update(0, reinterpret_cast<const uint8_t *>(&state), offsetof(ResumeState, crc));
+}
+
+void resume_state_seal(ResumeState *state, uint32_t fw_hash) {
+  if (!state) return;
+  state->magic = RESUME_STATE_MAGIC;
+  state->version = RESUME_STATE_VERSION;
+  state->size = (uint16_t)sizeof(ResumeState);
+  state->fw_hash = fw_hash;
+  state->reserved = 0;
+  state->crc = resume_state_crc(*state);
+}
+
+bool resume_state_valid(const ResumeState &state, uint32_t fw_hash) {
+  return state.magic == RESUME_STATE_MAGIC &&
+         state.version == RESUME_STATE_VERSION &&
+         state.size == sizeof(ResumeState) &&
+         state.fw_hash == fw_hash &&
+         state.crc == resume_state_crc(state);
+}
+
+void resume_state_invalidate(ResumeState *state) {
+  if (!state) return;
+  state->magic = 0;
+  state->crc = 0;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+
+// Snapshot of everything setup would otherwise rebuild after a deep-sleep
+// wake: fusion state, loaded calibration and the EEPROM-backed settings.
+// The firmware keeps one copy in RTC slow memory, seals it right before
+// esp_deep_sleep_start() and trusts it on the next boot only if the magic,
+// layout version, firmware hash and CRC all match.
+
+constexpr uint32_t RESUME_STATE_MAGIC = 0x52534D31UL;  // "RSM1"
+constexpr uint16_t RESUME_STATE_VERSION = 1;           // bump on layout change
+
+struct ResumeState {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;
+  uint32_t fw_hash;
+  uint32_t sleep_count;  // own sleeps since the last cold boot
+
+  // Fusion (physical frame, before alignment/zero)
+  float roll_phys;
+  float pitch_phys;
+
+  // Calibration as loaded for orientation_mode
+  float ax_off, ay_off, az_off;
+  float gx_off, gy_off;
+  float roll_zero, pitch_zero;
+  float align_roll, align_pitch;
+
+  // Settings
+  uint8_t orientation_mode;
+  uint8_t display_rotated;
+  uint8_t axis_mode;
+  uint8_t touch_ui_layout;
+  uint8_t auto_zero_on_boot;
+  uint8_t display_precision;
+  uint8_t display_brightness_percent;
+  uint8_t display_target_fps;
+  uint8_t touch_enabled;
+  uint8_t touch_persist;
+  uint8_t auto_sleep_min;
+  uint8_t reserved;
+  uint16_t display_dim_s;
+  uint16_t display_blank_s;
+
+  uint32_t crc;  // CRC-32 over all bytes before this field
+};
+
+// FNV-1a of the firmware version string; a new build never resumes a
+// snapshot written by another one.
+uint32_t resume_state_fw_hash(const char *fw_version);
+
+uint32_t resume_state_crc(const ResumeState &state);
+
+// Fill magic/version/size/fw_hash and the CRC. Payload fields must be set.
+void resume_state_seal(ResumeState *state, uint32_t fw_hash);
+
+bool resume_state_valid(const ResumeState &state, uint32_t fw_hash);
+
+void resume_state_invalidate(ResumeState *state);
@@ -0,0 +1,161 @@
+#include "serial_log.h"
+#include "log_ring.h"
+#include "perf_counters.h"
+
+// ============================================================
+// CONFIG
+// ============================================================
+
+static const size_t serialLogRingBytes = 8192;
+static const size_t serialLogChunkBytes = 256;
+static const uint32_t serialLogTaskStackBytes = 3072;
+static const UBaseType_t serialLogTaskPriority = 1;  // below the LVGL task
+static const BaseType_t serialLogTaskCore = 0;       // away from the sensor loop
+static const uint32_t serialLogRetryMs = 2;          // CDC buffer full
+
+static const char *const serialLogLevelNames[SERIAL_LOG_LEVEL_COUNT] = {"ERROR", "WARN", "INFO", "DEBUG"};
+
+SerialLogStream SerialLog(SERIAL_LOG_INFO);
+SerialLogStream SerialLogWarn(SERIAL_LOG_WARN);
+SerialLogStream SerialLogError(SERIAL_LOG_ERROR);
+SerialLogStream SerialLogDebug(SERIAL_LOG_DEBUG);
+
+// The ring is shared by every task that logs, on both cores; the critical
+// section only covers the memcpy in/out, never the USB write.
+static uint8_t log_storage[serialLogRingBytes];
+static LogRing log_ring = {log_storage, serialLogRingBytes, 0, 0, 0, 0, 0, 0};
+static portMUX_TYPE log_mux = portMUX_INITIALIZER_UNLOCKED;
+static volatile SerialLogLevel log_level = SERIAL_LOG_INFO;
+static TaskHandle_t log_task = nullptr;
+static uint32_t log_offline_bytes = 0;
+
+// ============================================================
+// WRITE
+// ============================================================
+
+static bool log_ring_append(const uint8_t *data, size_t len)
+{
+  portENTER_CRITICAL(&log_mux);
+  const bool ok = log_ring_write(&log_ring, data, len);
+  portEXIT_CRITICAL(&log_mux);
+  if (ok && log_task) xTaskNotifyGive(log_task);
+  return ok;
+}
+
+size_t SerialLogStream::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t SerialLogStream::write(const uint8_t *buffer, size_t size)
+{
+  if (level_ > log_level) return size;
+  log_ring_append(buffer, size);
+  // Report success either way: Print stops a multi-part print at the first
+  // short write, and a drop is already counted.
+  return size;
+}
+
+bool serial_log_write_raw(const uint8_t *data, size_t len)
+{
+  return log_ring_append(data, len);
+}
+
+void serial_log_set_level(SerialLogLevel level)
+{
+  if (level < SERIAL_LOG_LEVEL_COUNT) log_level = level;
+}
+
+SerialLogLevel serial_log_get_level(void)
+{
+  return log_level;
+}
+
+const char *serial_log_level_name(SerialLogLevel level)
+{
+  return (level < SERIAL_LOG_LEVEL_COUNT) ? serialLogLevelNames[level] : "?";
+}
+
+// ============================================================
+// DRAIN
+// ============================================================
+
+// Move one chunk to Serial; false when the ring is empty.
+static bool log_drain_once(void)
+{
+  uint8_t chunk[serialLogChunkBytes];
+  portENTER_CRITICAL(&log_mux);
+  size_t n = log_ring_peek(log_ring, chunk, sizeof(chunk));
+  portEXIT_CRITICAL(&log_mux);
+  if (n == 0) return false;
+
+  if (!Serial) {
+    // No host: discard, as Serial itself would.
+    portENTER_CRITICAL(&log_mux);
+    log_ring_consume(&log_ring, n);
+    log_offline_bytes += (uint32_t)n;
+    portEXIT_CRITICAL(&log_mux);
+    return true;
+  }
+
+  const int room = Serial.availableForWrite();
+  if (room <= 0) {
+    vTaskDelay(pdMS_TO_TICKS(serialLogRetryMs));
+    return true;
+  }
+  if (n > (size_t)room) n = (size_t)room;
+  n = Serial.write(chunk, n);
+
+  portENTER_CRITICAL(&log_mux);
+  log_ring_consume(&log_ring, n);
+  portEXIT_CRITICAL(&log_mux);
+  if (n == 0) vTaskDelay(pdMS_TO_TICKS(serialLogRetryMs));
+  return true;
+}
+
+static void serial_log_task(void *)
+{
+  PERF_REGISTER_TASK("serial_log");
+  for (;;) {
+    if (!log_drain_once()) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+  }
+}
+
+void serial_log_begin(void)
+{
+  if (log_task) return;
+  xTaskCreatePinnedToCore(serial_log_task, "serial_log", serialLogTaskStackBytes, nullptr,
+                          serialLogTaskPriority, &log_task, serialLogTaskCore);
+  if (log_task) xTaskNotifyGive(log_task);
+}
+
+void serial_log_flush(uint32_t timeout_ms)
+{
+  const uint32_t start = millis();
+  for (;;) {
+    portENTER_CRITICAL(&log_mux);
+    const size_t used = log_ring.used;
+    portEXIT_CRITICAL(&log_mux);
+    if (used == 0 || (millis() - start) >= timeout_ms) break;
+    // Without the task (very early boot) drain from the caller.
+    if (!log_task) log_drain_once();
+    else delay(1);
+  }
+  Serial.flush();
+}
+
+void serial_log_get_stats(SerialLogStats *out)
+{
+  if (!out) return;
+  portENTER_CRITICAL(&log_mux);
+  out->ring_bytes = (uint32_t)log_ring.cap;
+  out->used_bytes = (uint32_t)log_ring.used;
+  out->high_water_bytes = (uint32_t)log_ring.high_water;
+  out->written_bytes = log_ring.written_bytes;
+  out->dropped_bytes = log_ring.dropped_bytes;
+  out->dropped_writes = log_ring.dropped_writes;
+  out->offline_bytes = log_offline_bytes;
+  portEXIT_CRITICAL(&log_mux);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+
+// All serial output goes through a RAM ring drained by a low-priority task,
+// so a slow or stalled USB CDC host never blocks the sensor loop, the LVGL
+// task or a web handler. When the ring is full the write is dropped whole
+// and counted. Input (Serial.available/read) stays on Serial.
+
+enum SerialLogLevel : uint8_t {
+  SERIAL_LOG_ERROR = 0,
+  SERIAL_LOG_WARN,
+  SERIAL_LOG_INFO,
+  SERIAL_LOG_DEBUG,
+  SERIAL_LOG_LEVEL_COUNT
+};
+
+// Print-compatible writer for one level; output above the active level is
+// discarded before it reaches the ring.
+class SerialLogStream : public Print {
+ public:
+  explicit SerialLogStream(SerialLogLevel level) : level_(level) {}
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+
+ private:
+  SerialLogLevel level_;
+};
+
+extern SerialLogStream SerialLog;       // INFO: regular status/console output
+extern SerialLogStream SerialLogWarn;
+extern SerialLogStream SerialLogError;
+extern SerialLogStream SerialLogDebug;
+
+// Start the drain task (after Serial.begin). Output written earlier is kept.
+void serial_log_begin(void);
+
+void serial_log_set_level(SerialLogLevel level);
+SerialLogLevel serial_log_get_level(void);
+const char *serial_log_level_name(SerialLogLevel level);
+
+// Binary data, level-independent, stored whole or not at all.
+bool serial_log_write_raw(const uint8_t *data, size_t len);
+
+// Wait (up to timeout_ms) until the ring is empty and the CDC buffer flushed;
+// before deep sleep or restart.
+void serial_log_flush(uint32_t timeout_ms);
+
+struct SerialLogStats {
+  uint32_t ring_bytes;
+  uint32_t used_bytes;
+  uint32_t high_water_bytes;
+  uint32_t written_bytes;
+  uint32_t dropped_bytes;    // ring full
+  uint32_t dropped_writes;
+  uint32_t offline_bytes;    // drained with no USB host attached
+};
+void serial_log_get_stats(SerialLogStats *out);
@@ -0,0 +1,103 @@
+#include "splash_codec.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr uint32_t kWindowMask = SPLASH_CODEC_WINDOW_PX - 1;
+constexpr uint8_t kMatchFlag = 0x80;
+constexpr uint8_t kMatchLenExt = 0x7F;
+
+bool read_byte(SplashDecoder *dec, uint8_t *out) {
+  if (dec->pos >= dec->src_len) return false;
+  *out = dec->src[dec->pos++];
+  return true;
+}
+
+// Parse the next control byte (and its operands). Returns false at a clean
+// end of stream; sets `failed` on a truncated or inconsistent op.
+bool next_op(SplashDecoder *dec) {
+  uint8_t c = 0;
+  if (!read_byte(dec, &c)) return false;
+
+  if (c < kMatchFlag) {
+    dec->literal_left = (uint32_t)c + 1;
+    return true;
+  }
+
+  uint32_t len = (uint32_t)(c & kMatchLenExt) + 2;
+  if ((c & kMatchLenExt) == kMatchLenExt) {
+    uint8_t lo = 0;
+    uint8_t hi = 0;
+    if (!read_byte(dec, &lo) || !read_byte(dec, &hi)) {
+      dec->failed = true;
+      return false;
+    }
+    len += (uint32_t)lo | ((uint32_t)hi << 8);
+  }
+
+  uint8_t b0 = 0;
+  if (!read_byte(dec, &b0)) {
+    dec->failed = true;
+    return false;
+  }
+  uint32_t dist = b0;
+  if (b0 & 0x80) {
+    uint8_t b1 = 0;
+    if (!read_byte(dec, &b1)) {
+      dec->failed = true;
+      return false;
+    }
+    dist = (uint32_t)(b0 & 0x7F) | ((uint32_t)b1 << 7);
+  }
+  if (dist == 0 || dist > SPLASH_CODEC_WINDOW_PX || dist > dec->out_total) {
+    dec->failed = true;
+    return false;
+  }
+
+  dec->match_left = len;
+  dec->match_dist = dist;
+  return true;
+}
+
+}  // namespace
+
+void splash_decoder_init(SplashDecoder *dec, const uint8_t *src, size_t src_len) {
+  if (!dec) return;
+  memset(dec, 0, sizeof(*dec));
+  dec->src = src;
+  dec->src_len = src ? src_len : 0;
+}
+
+size_t splash_decoder_read(SplashDecoder *dec, uint16_t *dst, size_t max_px) {
+  if (!dec || !dst || dec->failed) return 0;
+
+  size_t n = 0;
+  while (n < max_px) {
+    uint16_t px = 0;
+    if (dec->literal_left > 0) {
+      uint8_t lo = 0;
+      uint8_t hi = 0;
+      if (!read_byte(dec, &lo) || !read_byte(dec, &hi)) {
+        dec->failed = true;
+        break;
+      }
+      px = (uint16_t)(lo | (hi << 8));
+      dec->literal_left--;
+    } else if (dec->match_left > 0) {
+      px = dec->history[(dec->out_total - dec->match_dist) & kWindowMask];
+      dec->match_left--;
+    } else {
+      if (!next_op(dec)) break;
+      continue;
+    }
+    dec->history[dec->out_total & kWindowMask] = px;
+    dec->out_total++;
+    dst[n++] = px;
+  }
+  return n;
+}
+
+bool splash_decoder_failed(const SplashDecoder *dec) {
+  return !dec || dec->failed;
+}
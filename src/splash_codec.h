@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Streaming decoder for the compressed boot splash
+// (generated by scripts/compress_splash.py).
+//
+// Stream format: a sequence of ops, each starting with a control byte c.
+//   c < 0x80  literal: (c + 1) RGB565 pixels follow, 2 bytes each, little-endian.
+//   c >= 0x80 match: copy `len` pixels starting `dist` pixels back.
+//             len = (c & 0x7F) + 2; if (c & 0x7F) == 0x7F, a 16-bit LE
+//             extension follows and is added to len.
+//             dist follows as 1 byte (< 0x80) or 2 bytes:
+//             (b0 & 0x7F) | (b1 << 7), 1 <= dist <= SPLASH_CODEC_WINDOW_PX.
+// Runs of one color are matches with dist == 1.
+
+constexpr size_t SPLASH_CODEC_WINDOW_PX = 2048;  // power of two
+
+struct SplashDecoder {
+  const uint8_t *src;
+  size_t src_len;
+  size_t pos;
+  uint32_t literal_left;
+  uint32_t match_left;
+  uint32_t match_dist;
+  uint32_t out_total;
+  bool failed;
+  uint16_t history[SPLASH_CODEC_WINDOW_PX];
+};
+
+void splash_decoder_init(SplashDecoder *dec, const uint8_t *src, size_t src_len);
+
+// Decode up to `max_px` pixels into `dst`. Returns the number written; fewer
+// than requested means end of stream (or a corrupt stream, see failed()).
+size_t splash_decoder_read(SplashDecoder *dec, uint16_t *dst, size_t max_px);
+
+bool splash_decoder_failed(const SplashDecoder *dec);
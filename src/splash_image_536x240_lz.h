@@ -0,0 +1,4928 @@
+#pragma once
+
+// Generated by scripts/compress_splash.py from splash_image_536x240_rgb565.h.
+// Do not edit; regenerate by building or running the script.
+// source-sha256: b1ae8d0024293f144c8e54ec2b8729a3c22c78e2f0bd6216452d184f6694e6f8
+
+#include <stdint.h>
+
+#define SPLASH_IMAGE_LZ_WIDTH 536
+#define SPLASH_IMAGE_LZ_HEIGHT 240
+
+static const uint8_t SPLASH_IMAGE_536x240_LZ[78628] = {
+    0x00, 0x00, 0x00, 0xFF, 0x53, 0x00, 0x01, 0x00, 0x21, 0x00, 0x93, 0x15, 0x00, 0x01, 0x00, 0xEC,
+    0x85, 0x01, 0xFF, 0x27, 0x01, 0x01, 0xFF, 0x96, 0x01, 0x97, 0x04, 0xFF, 0x8A, 0x01, 0x01, 0x93,
+    0xCF, 0x0C, 0x91, 0x01, 0x00, 0x01, 0x00, 0xA6, 0x29, 0xFF, 0x6F, 0x01, 0x01, 0xA8, 0x98, 0x04,
+    0xFF, 0x07, 0x01, 0x8D, 0x0D, 0xFC, 0x88, 0x03, 0x8F, 0x7E, 0x00, 0x01, 0x00, 0xFF, 0x07, 0x01,
+    0x98, 0x04, 0xF5, 0x01, 0x85, 0xFF, 0x03, 0xC4, 0x86, 0x04, 0xB2, 0x46, 0xB6, 0x7A, 0xFF, 0x1A,
+    0x00, 0x92, 0x0E, 0xFF, 0x62, 0x00, 0xAD, 0x0F, 0x84, 0xB7, 0x08, 0x91, 0xBC, 0x03, 0x00, 0x21,
+    0x00, 0x97, 0xD0, 0x03, 0x93, 0x19, 0xFF, 0x62, 0x00, 0xAB, 0x02, 0xFF, 0x4A, 0x00, 0x01, 0x8E,
+    0xC3, 0x03, 0x8D, 0x10, 0x81, 0x0F, 0x95, 0xFE, 0x03, 0xCD, 0xE5, 0x0C, 0xFF, 0xBC, 0x00, 0xB6,
+    0x04, 0x8F, 0xF2, 0x0F, 0xA3, 0xB2, 0x07, 0xB9, 0xC2, 0x03, 0x00, 0x01, 0x00, 0x81, 0x94, 0x08,
+    0x8F, 0x75, 0xBF, 0x01, 0xEA, 0xEC, 0x0C, 0xFE, 0x01, 0xC0, 0xB8, 0x01, 0x8F, 0x42, 0x88, 0x11,
+    0x82, 0x0A, 0x83, 0x04, 0x8E, 0xD6, 0x06, 0xA3, 0xE6, 0x06, 0x94, 0xD9, 0x03, 0x86, 0x54, 0x9A,
+    0x14, 0x81, 0x95, 0x04, 0xA2, 0x61, 0x88, 0x3E, 0xA1, 0xC4, 0x04, 0x87, 0x22, 0xBE, 0xB2, 0x02,
+    0x00, 0x20, 0x00, 0xBD, 0x40, 0xFF, 0x38, 0x00, 0x01, 0x88, 0xC0, 0x0F, 0x82, 0xEF, 0x02, 0x00,
+    0x22, 0x00, 0xA4, 0xF7, 0x02, 0x89, 0x01, 0x8A, 0x3F, 0x8B, 0xEE, 0x03, 0x82, 0x47, 0x87, 0x04,
+    0x8A, 0x18, 0x86, 0x06, 0x83, 0x0A, 0x87, 0x09, 0x98, 0x5C, 0x83, 0x22, 0x88, 0x30, 0x82, 0x01,
+    0x86, 0x46, 0x84, 0x22, 0x99, 0xD9, 0x04, 0xAA, 0xCC, 0x01, 0xFF, 0x37, 0x00, 0xAD, 0x08, 0xA7,
+    0x01, 0x82, 0xE1, 0x01, 0x8F, 0xE4, 0x07, 0x98, 0xF6, 0x01, 0x86, 0xFE, 0x02, 0x90, 0x22, 0x9B,
+    0xAA, 0x02, 0x83, 0xFD, 0x0B, 0x85, 0x98, 0x03, 0x8F, 0x2E, 0x83, 0xBD, 0x03, 0x86, 0xCF, 0x03,
+    0x8A, 0xC8, 0x03, 0x86, 0xD8, 0x03, 0x84, 0x18, 0x83, 0x19, 0x84, 0x26, 0x8E, 0xC0, 0x04, 0x87,
+    0xE8, 0x04, 0x85, 0x2E, 0x85, 0x0A, 0x84, 0x36, 0x86, 0x55, 0x87, 0x0E, 0x88, 0xC3, 0x04, 0x8D,
+    0x8A, 0x01, 0xB6, 0xED, 0x03, 0xA3, 0xA4, 0x0A, 0xFF, 0x5C, 0x00, 0x01, 0x88, 0xC1, 0x07, 0x87,
+    0xD7, 0x02, 0x86, 0xE6, 0x06, 0x9D, 0xD5, 0x02, 0x84, 0x95, 0x03, 0x93, 0x2A, 0x87, 0xB8, 0x03,
+    0x85, 0x91, 0x08, 0x88, 0xE5, 0x03, 0x87, 0xCF, 0x03, 0x89, 0x1E, 0x87, 0x7F, 0x91, 0x71, 0x82,
+    0x15, 0x8A, 0x86, 0x04, 0x8C, 0x01, 0x8D, 0x1B, 0x8B, 0xC7, 0x01, 0x8F, 0x49, 0xFF, 0x87, 0x00,
+    0x01, 0x8B, 0x8A, 0x02, 0x8A, 0x8E, 0x07, 0xAD, 0xD0, 0x06, 0x87, 0x8F, 0x07, 0x8A, 0x13, 0x00,
+    0x01, 0x00, 0x80, 0xD2, 0x06, 0x87, 0xEE, 0x03, 0x80, 0x01, 0x82, 0x8E, 0x0D, 0x8A, 0xF3, 0x07,
+    0x90, 0xC1, 0x03, 0x87, 0x13, 0x80, 0x2B, 0x86, 0xEB, 0x03, 0x85, 0xD6, 0x03, 0x84, 0x0E, 0x86,
+    0x6A, 0x8D, 0x66, 0x84, 0xB9, 0x01, 0x83, 0x36, 0x87, 0x3F, 0x98, 0x01, 0x84, 0xD7, 0x08, 0x94,
+    0xDA, 0x01, 0xBA, 0x82, 0x08, 0xFF, 0x4D, 0x00, 0xD4, 0x04, 0x82, 0x82, 0x03, 0x93, 0x01, 0xAA,
+    0xE7, 0x01, 0x8D, 0xDE, 0x0B, 0x85, 0x15, 0x88, 0x89, 0x03, 0x80, 0x65, 0x82, 0xF1, 0x02, 0x85,
+    0x94, 0x03, 0x86, 0xB1, 0x0C, 0x88, 0xB2, 0x0C, 0x86, 0x96, 0x04, 0x88, 0x34, 0x82, 0xC3, 0x04,
+    0x88, 0xD0, 0x0C, 0x84, 0x13, 0x85, 0xED, 0x03, 0x8B, 0x82, 0x05, 0x88, 0x27, 0x8A, 0x71, 0x8F,
+    0x9D, 0x04, 0x81, 0x80, 0x01, 0x87, 0x3E, 0x8B, 0xF1, 0x01, 0x9A, 0x88, 0x04, 0xFF, 0x4C, 0x00,
+    0xDE, 0x0C, 0x9F, 0xD6, 0x0B, 0x8C, 0x08, 0x99, 0x32, 0x87, 0xBD, 0x03, 0x97, 0x62, 0x9C, 0x6C,
+    0x86, 0xEB, 0x03, 0x82, 0x0B, 0x82, 0x95, 0x03, 0x8E, 0x31, 0x85, 0xF2, 0x03, 0x89, 0xBF, 0x04,
+    0x84, 0x74, 0x8A, 0xB6, 0x08, 0x81, 0x9F, 0x04, 0x8E, 0xF6, 0x03, 0x8C, 0x5B, 0x88, 0x40, 0x85,
+    0xCF, 0x08, 0x8C, 0x8C, 0x04, 0x8C, 0xB8, 0x08, 0x84, 0x1D, 0x82, 0x55, 0x9B, 0xB8, 0x01, 0x9B,
+    0x1E, 0xFF, 0x3F, 0x00, 0x01, 0x87, 0xB9, 0x02, 0x97, 0x1A, 0x89, 0x12, 0x90, 0x2B, 0x91, 0x24,
+    0x89, 0x26, 0x85, 0x04, 0x92, 0xE9, 0x0F, 0x90, 0x5E, 0x87, 0x76, 0x88, 0xBE, 0x03, 0x86, 0x0C,
+    0x82, 0xAD, 0x09, 0x89, 0xB5, 0x03, 0x84, 0x67, 0x87, 0xA0, 0x08, 0x8A, 0xF2, 0x07, 0x85, 0x5C,
+    0x88, 0xFC, 0x03, 0x84, 0xB6, 0x08, 0x89, 0xEF, 0x03, 0x88, 0x9D, 0x04, 0x89, 0x99, 0x04, 0x86,
+    0x89, 0x04, 0x8D, 0x01, 0x85, 0xFC, 0x04, 0x8B, 0xC2, 0x01, 0x8B, 0xB1, 0x02, 0x96, 0xC6, 0x01,
+    0xB0, 0x01, 0xFF, 0x0F, 0x00, 0xE6, 0x04, 0x89, 0xC5, 0x02, 0x84, 0x04, 0x83, 0x15, 0x87, 0x05,
+    0x88, 0x14, 0x99, 0x89, 0x02, 0x8C, 0x15, 0x90, 0x31, 0x91, 0x85, 0x04, 0x84, 0xB0, 0x03, 0x84,
+    0x89, 0x03, 0x8E, 0x4C, 0x83, 0xC2, 0x0B, 0x85, 0x97, 0x03, 0x88, 0xD1, 0x03, 0x87, 0xA5, 0x04,
+    0x86, 0xFE, 0x03, 0x86, 0xBC, 0x01, 0x85, 0x44, 0x85, 0x04, 0x81, 0x03, 0x90, 0xE0, 0x03, 0x88,
+    0x8D, 0x04, 0x88, 0x01, 0x88, 0x25, 0x82, 0x0A, 0x82, 0xB3, 0x08, 0x8A, 0x9E, 0x04, 0x88, 0xD6,
+    0x08, 0x84, 0x6A, 0x8B, 0xB8, 0x01, 0x89, 0xBC, 0x02, 0x96, 0x93, 0x02, 0xFF, 0x45, 0x00, 0x01,
+    0x86, 0xC2, 0x03, 0x89, 0xA5, 0x03, 0x86, 0x97, 0x02, 0xA7, 0xC8, 0x0C, 0x88, 0x21, 0x86, 0xC8,
+    0x02, 0x87, 0xE0, 0x0C, 0x87, 0xFD, 0x06, 0x8C, 0x86, 0x04, 0x82, 0x92, 0x03, 0x89, 0xF9, 0x0F,
+    0x85, 0x37, 0x89, 0xC0, 0x03, 0x8C, 0xC9, 0x03, 0x88, 0xE5, 0x07, 0x85, 0x3E, 0x89, 0xDE, 0x03,
+    0x83, 0x0F, 0x84, 0x05, 0x98, 0x8F, 0x04, 0x90, 0x1B, 0x87, 0x87, 0x04, 0x8A, 0xCB, 0x0C, 0x86,
+    0x98, 0x04, 0x83, 0xFB, 0x09, 0x82, 0xA3, 0x01, 0x8D, 0xE7, 0x01, 0x93, 0xBE, 0x02, 0xFF, 0x4B,
+    0x00, 0x9C, 0x04, 0x8A, 0xF3, 0x03, 0x8D, 0xB1, 0x03, 0x81, 0x04, 0x00, 0x21, 0x00, 0x82, 0x08,
+    0x82, 0xBA, 0x07, 0x86, 0x21, 0x97, 0x47, 0x8E, 0x1A, 0x87, 0xE3, 0x03, 0x83, 0xD6, 0x02, 0x86,
+    0x93, 0x03, 0x89, 0x95, 0x04, 0x83, 0x08, 0x88, 0x87, 0x04, 0x85, 0x8C, 0x01, 0x85, 0x20, 0x88,
+    0x2D, 0x92, 0xDD, 0x03, 0x84, 0x9C, 0x01, 0x82, 0x32, 0x8B, 0x95, 0x08, 0x8A, 0xDF, 0x07, 0x84,
+    0x4A, 0x91, 0x98, 0x04, 0x84, 0xEB, 0x03, 0x8E, 0x97, 0x04, 0x84, 0x92, 0x04, 0x92, 0xE3, 0x08,
+    0x86, 0x14, 0x95, 0xE7, 0x01, 0x87, 0xC5, 0x02, 0x84, 0x57, 0x8E, 0xD4, 0x02, 0xFF, 0x31, 0x00,
+    0x01, 0x83, 0xA0, 0x02, 0x87, 0x0B, 0x88, 0x9A, 0x08, 0x87, 0xDE, 0x01, 0x86, 0x21, 0x87, 0xED,
+    0x02, 0x8C, 0x82, 0x08, 0x8A, 0x4A, 0x86, 0xB9, 0x02, 0x8B, 0xD1, 0x0A, 0x88, 0x11, 0x85, 0xB2,
+    0x03, 0x88, 0xE8, 0x02, 0x89, 0x36, 0x89, 0xE8, 0x03, 0x89, 0x68, 0x88, 0x36, 0x84, 0xB4, 0x03,
+    0x81, 0x35, 0x8C, 0xB4, 0x03, 0x87, 0x42, 0x86, 0xF9, 0x0B, 0x88, 0x30, 0x8C, 0x58, 0x91, 0x01,
+    0x8F, 0x98, 0x04, 0x8D, 0xBE, 0x0C, 0x8D, 0x9E, 0x04, 0x85, 0xBC, 0x01, 0x86, 0xDB, 0x01, 0x8A,
+    0xFE, 0x01, 0x8B, 0x8A, 0x02, 0x82, 0xC4, 0x06, 0x87, 0x0C, 0x07, 0x83, 0x10, 0xE5, 0x18, 0x06,
+    0x19, 0x05, 0x19, 0xC4, 0x10, 0x83, 0x10, 0x63, 0x08, 0x42, 0x08, 0x80, 0x52, 0x9F, 0x89, 0x03,
+    0xFF, 0x09, 0x00, 0x01, 0x8D, 0x96, 0x0C, 0x83, 0xE7, 0x02, 0x87, 0xEB, 0x02, 0x8B, 0xA0, 0x06,
+    0x84, 0xAF, 0x03, 0x88, 0x13, 0x86, 0xEB, 0x0C, 0x86, 0x44, 0x8F, 0xA3, 0x04, 0x85, 0xDB, 0x04,
+    0x85, 0x1C, 0x95, 0xE3, 0x0F, 0x93, 0xAD, 0x03, 0x89, 0xBB, 0x04, 0x83, 0x0C, 0x86, 0xA7, 0x03,
+    0x82, 0x93, 0x04, 0x85, 0xCF, 0x07, 0x87, 0xBA, 0x03, 0x84, 0x2A, 0x8D, 0x91, 0x04, 0x8A, 0xCE,
+    0x08, 0xA1, 0x01, 0x88, 0x3E, 0x81, 0x96, 0x04, 0x83, 0xF9, 0x04, 0x85, 0x08, 0x89, 0x1B, 0x89,
+    0xF9, 0x01, 0x8A, 0xF3, 0x05, 0x88, 0xC3, 0x0D, 0x95, 0xE1, 0x02, 0x05, 0x42, 0x08, 0x47, 0x21,
+    0x88, 0x29, 0x68, 0x21, 0x27, 0x21, 0x06, 0x19, 0x80, 0x01, 0x01, 0x26, 0x21, 0x26, 0x19, 0x80,
+    0x04, 0x07, 0xE5, 0x18, 0xC5, 0x10, 0xC4, 0x10, 0xA4, 0x10, 0x83, 0x10, 0x62, 0x08, 0x42, 0x08,
+    0x41, 0x00, 0xFF, 0x1C, 0x00, 0xA1, 0x04, 0x88, 0xA4, 0x08, 0x85, 0x10, 0x85, 0xFC, 0x0A, 0x89,
+    0x8D, 0x03, 0x89, 0x9D, 0x03, 0x87, 0x13, 0x8A, 0x01, 0x86, 0xFA, 0x03, 0x84, 0xAA, 0x02, 0x82,
+    0x45, 0x04, 0xE3, 0x18, 0x49, 0x4A, 0x08, 0x42, 0x28, 0x42, 0x29, 0x42, 0x80, 0x01, 0x03, 0x49,
+    0x4A, 0x49, 0x4A, 0x69, 0x4A, 0x04, 0x21, 0x83, 0x53, 0x8C, 0xFC, 0x02, 0x9B, 0xA6, 0x03, 0x8D,
+    0x85, 0x08, 0x8D, 0x08, 0x88, 0x27, 0x83, 0xB3, 0x03, 0x87, 0xA6, 0x03, 0x8F, 0x93, 0x01, 0x84,
+    0x8A, 0x01, 0x88, 0x0F, 0x95, 0x64, 0x89, 0x6E, 0x8D, 0x23, 0x85, 0x61, 0x89, 0x65, 0x87, 0x31,
+    0x86, 0xAB, 0x02, 0x81, 0x8D, 0x0E, 0x88, 0xC6, 0x02, 0x85, 0xBC, 0x02, 0x95, 0x01, 0x04, 0x21,
+    0x00, 0x26, 0x19, 0x27, 0x21, 0xA4, 0x10, 0x63, 0x08, 0x80, 0x01, 0x07, 0x83, 0x08, 0x83, 0x08,
+    0x84, 0x08, 0x84, 0x08, 0xA4, 0x10, 0xA4, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0x81, 0xA1, 0x04, 0x00,
+    0x26, 0x19, 0x81, 0xA1, 0x04, 0x02, 0x05, 0x19, 0x05, 0x19, 0xE5, 0x18, 0x80, 0xA2, 0x04, 0x02,
+    0xA3, 0x10, 0x82, 0x08, 0x41, 0x08, 0xF6, 0xA1, 0x04, 0x95, 0x78, 0x8E, 0xE8, 0x0B, 0x89, 0xCE,
+    0x02, 0x82, 0x08, 0x8C, 0xCE, 0x02, 0x87, 0x27, 0x8D, 0xB1, 0x03, 0x88, 0xDF, 0x0B, 0x89, 0xE1,
+    0x04, 0x04, 0x10, 0x84, 0xFF, 0xFF, 0x9E, 0xEF, 0x9E, 0xEF, 0x7E, 0xEF, 0x81, 0x01, 0x02, 0x9E,
+    0xEF, 0xFF, 0xFF, 0xCB, 0x5A, 0x87, 0x81, 0x09, 0x8D, 0x2E, 0x93, 0x01, 0x86, 0x83, 0x08, 0x8C,
+    0x16, 0x8B, 0x88, 0x01, 0x86, 0x6C, 0x85, 0xBC, 0x03, 0x8E, 0x3B, 0x95, 0x01, 0x8E, 0xF5, 0x03,
+    0x96, 0x6B, 0x8B, 0x25, 0x96, 0x1C, 0x87, 0xC0, 0x02, 0x8D, 0xD2, 0x06, 0x99, 0x98, 0x04, 0x02,
+    0xE5, 0x18, 0x26, 0x19, 0xA4, 0x10, 0x80, 0x94, 0x04, 0x82, 0x01, 0x81, 0x9D, 0x04, 0x83, 0x01,
+    0x81, 0xA2, 0x04, 0x80, 0xA0, 0x04, 0x02, 0xE5, 0x10, 0xE5, 0x18, 0xE6, 0x18, 0x80, 0xA0, 0x04,
+    0x01, 0x27, 0x21, 0x47, 0x21, 0x80, 0x01, 0x07, 0x46, 0x21, 0x26, 0x21, 0x05, 0x19, 0xE4, 0x18,
+    0xC4, 0x10, 0xA3, 0x10, 0x62, 0x08, 0x62, 0x08, 0xFF, 0x10, 0x00, 0xC2, 0x08, 0x84, 0x89, 0x04,
+    0x8B, 0x8F, 0x04, 0x82, 0x07, 0x89, 0xCF, 0x02, 0x83, 0x16, 0x8B, 0xC6, 0x08, 0x8C, 0xF5, 0x02,
+    0x84, 0x43, 0x85, 0x01, 0x05, 0x55, 0xAD, 0x7E, 0xEF, 0xDC, 0xD6, 0xFC, 0xDE, 0xFC, 0xD6, 0xDC,
+    0xD6, 0x80, 0x02, 0x02, 0xDC, 0xD6, 0x7E, 0xEF, 0xC7, 0x39, 0x85, 0xFA, 0x04, 0xA4, 0x01, 0x97,
+    0x8B, 0x03, 0xA1, 0x3A, 0x8D, 0xC4, 0x0C, 0x94, 0x74, 0x87, 0x16, 0x98, 0xF6, 0x03, 0x91, 0x22,
+    0x88, 0x0A, 0x86, 0x97, 0x0E, 0x98, 0xB8, 0x0E, 0x93, 0x01, 0x02, 0xE5, 0x18, 0x47, 0x21, 0xA4,
+    0x08, 0x84, 0x97, 0x04, 0x87, 0x01, 0x88, 0xA0, 0x04, 0x81, 0x04, 0x03, 0x84, 0x08, 0xA4, 0x08,
+    0xC5, 0x10, 0xE5, 0x18, 0x81, 0xC2, 0x08, 0x81, 0xA2, 0x04, 0x01, 0x27, 0x21, 0x26, 0x21, 0x80,
+    0xC5, 0x08, 0x00, 0xC4, 0x18, 0x80, 0xE5, 0x0C, 0x01, 0x82, 0x08, 0x62, 0x08, 0xF7, 0xC4, 0x08,
+    0x83, 0x01, 0x8A, 0xD5, 0x01, 0x8D, 0xCB, 0x02, 0x82, 0x11, 0x93, 0xD2, 0x02, 0x94, 0x01, 0x85,
+    0xCC, 0x04, 0x84, 0xDB, 0x0A, 0x03, 0x21, 0x08, 0x39, 0xC6, 0x3D, 0xE7, 0xFC, 0xDE, 0x83, 0x01,
+    0x02, 0x1C, 0xDF, 0xFC, 0xDE, 0xE3, 0x18, 0x8E, 0x58, 0xAB, 0x01, 0x85, 0x3A, 0x82, 0x98, 0x03,
+    0x80, 0x0B, 0x91, 0xC9, 0x03, 0x8A, 0x5A, 0x81, 0xF8, 0x0B, 0x82, 0x05, 0xC5, 0x01, 0x8B, 0xA7,
+    0x0D, 0x89, 0xC4, 0x04, 0x83, 0xAF, 0x03, 0x84, 0x7A, 0x95, 0xD2, 0x02, 0x91, 0x18, 0x02, 0xC4,
+    0x10, 0xA9, 0x29, 0xC5, 0x10, 0x86, 0x8E, 0x04, 0x82, 0x05, 0x82, 0xCE, 0x0C, 0x85, 0x0F, 0x04,
+    0x62, 0x08, 0x42, 0x00, 0x42, 0x00, 0x42, 0x08, 0x42, 0x08, 0x80, 0x04, 0x02, 0x42, 0x00, 0x43,
+    0x08, 0x43, 0x08, 0x81, 0x03, 0x00, 0x43, 0x08, 0x81, 0xA2, 0x04, 0x02, 0xA5, 0x10, 0xA5, 0x10,
+    0xE5, 0x10, 0x80, 0xC4, 0x08, 0x00, 0x26, 0x21, 0x80, 0xA1, 0x04, 0x03, 0x26, 0x21, 0x26, 0x21,
+    0x46, 0x21, 0x83, 0x10, 0xC9, 0xE9, 0x03, 0x89, 0x01, 0x97, 0xF1, 0x04, 0x96, 0xD2, 0x01, 0x82,
+    0x8B, 0x04, 0x89, 0xF5, 0x06, 0x83, 0x13, 0x8B, 0x85, 0x03, 0x89, 0x10, 0x94, 0x80, 0x03, 0x81,
+    0x40, 0x82, 0xC2, 0x03, 0x02, 0x00, 0x00, 0xE4, 0x20, 0x1C, 0xDF, 0x80, 0x98, 0x04, 0x00, 0x1C,
+    0xDF, 0x82, 0x01, 0x02, 0x7E, 0xEF, 0x38, 0xC6, 0x20, 0x00, 0x89, 0x8F, 0x0D, 0x9F, 0xC0, 0x0C,
+    0x99, 0x01, 0x89, 0x9A, 0x03, 0x8A, 0x07, 0x93, 0x53, 0xB1, 0x9D, 0x04, 0x91, 0x33, 0x82, 0xE6,
+    0x04, 0x90, 0x17, 0x85, 0xD6, 0x02, 0x87, 0x7D, 0x86, 0x0E, 0x82, 0x06, 0x89, 0xCC, 0x02, 0x8A,
+    0xD8, 0x02, 0x05, 0x00, 0x00, 0x63, 0x08, 0xA8, 0x29, 0x06, 0x19, 0xA4, 0x10, 0xA4, 0x10, 0x80,
+    0x8A, 0x04, 0x83, 0xB3, 0x08, 0x00, 0xA4, 0x08, 0x84, 0xB9, 0x08, 0x00, 0xA4, 0x08, 0x81, 0x99,
+    0x04, 0x80, 0xC9, 0x0C, 0x81, 0x15, 0x83, 0x54, 0x02, 0x21, 0x00, 0x22, 0x00, 0x22, 0x00, 0x81,
+    0x9C, 0x04, 0x81, 0x01, 0x00, 0x43, 0x00, 0x81, 0xC2, 0x08, 0x82, 0x04, 0x80, 0xB8, 0x04, 0x80,
+    0x03, 0x02, 0x67, 0x21, 0x09, 0x3A, 0xC4, 0x18, 0xAF, 0xF4, 0x03, 0xA2, 0x01, 0x98, 0xFE, 0x03,
+    0x92, 0x0C, 0x83, 0x0F, 0x91, 0xA4, 0x0C, 0xA7, 0x01, 0x8A, 0xF3, 0x0C, 0x05, 0xE7, 0x39, 0x9E,
+    0xF7, 0x3D, 0xE7, 0x3D, 0xE7, 0x1D, 0xDF, 0x1D, 0xDF, 0x81, 0x98, 0x04, 0x01, 0xBF, 0xF7, 0xF4,
+    0x9C, 0x8A, 0x51, 0x86, 0xBB, 0x08, 0x93, 0xB8, 0x03, 0x83, 0x15, 0x95, 0xD2, 0x03, 0x82, 0x97,
+    0x01, 0x88, 0xBD, 0x07, 0x90, 0x3B, 0x9F, 0x89, 0x04, 0x8B, 0x21, 0xA8, 0xB7, 0x04, 0x83, 0x59,
+    0x8F, 0xB5, 0x08, 0x86, 0xBC, 0x02, 0x87, 0x98, 0x04, 0x85, 0xB7, 0x02, 0x84, 0xAC, 0x0A, 0x90,
+    0xFC, 0x02, 0x03, 0x21, 0x00, 0x47, 0x21, 0x26, 0x19, 0xA4, 0x10, 0x82, 0x88, 0x04, 0x84, 0x91,
+    0x04, 0x84, 0x07, 0x80, 0xF9, 0x03, 0x01, 0xA4, 0x08, 0x84, 0x10, 0x83, 0x09, 0x8C, 0x55, 0x81,
+    0xA3, 0x09, 0x81, 0xA2, 0x04, 0x80, 0xB8, 0x08, 0x01, 0x63, 0x08, 0x22, 0x00, 0x80, 0x12, 0x00,
+    0x22, 0x00, 0x80, 0xB5, 0x08, 0x00, 0x42, 0x08, 0xB5, 0xFB, 0x03, 0xBE, 0x01, 0x85, 0x91, 0x01,
+    0x89, 0x9C, 0x08, 0x82, 0x08, 0xAF, 0x9C, 0x04, 0x8E, 0xE9, 0x02, 0x03, 0x00, 0x00, 0xEC, 0x5A,
+    0xFF, 0xFF, 0x1D, 0xDF, 0x80, 0x99, 0x04, 0x01, 0x3D, 0xE7, 0x3D, 0xDF, 0x80, 0x03, 0x01, 0xDF,
+    0xF7, 0x8E, 0x73, 0xA3, 0x4D, 0x8A, 0xA8, 0x0B, 0xA9, 0x78, 0x89, 0xC9, 0x01, 0x8B, 0xC5, 0x08,
+    0x92, 0x9F, 0x01, 0x91, 0xCE, 0x04, 0x92, 0x07, 0x87, 0x0D, 0x85, 0x03, 0x86, 0x9B, 0x0D, 0x84,
+    0x05, 0x84, 0xFA, 0x03, 0x85, 0xC4, 0x03, 0x89, 0xC5, 0x02, 0x89, 0xC9, 0x02, 0x8D, 0x1D, 0x82,
+    0x01, 0x02, 0x26, 0x21, 0x27, 0x21, 0xA4, 0x10, 0x85, 0x95, 0x04, 0x81, 0xC3, 0x0C, 0x82, 0x02,
+    0x86, 0x9B, 0x04, 0x88, 0x98, 0x04, 0x07, 0x83, 0x08, 0x88, 0x29, 0x47, 0x21, 0xE5, 0x18, 0xC4,
+    0x10, 0xA4, 0x10, 0x83, 0x10, 0x42, 0x08, 0x89, 0xDB, 0x04, 0x80, 0x0B, 0x00, 0x42, 0x00, 0x80,
+    0xB5, 0x08, 0xC8, 0xEB, 0x03, 0xAC, 0x01, 0x83, 0x8E, 0x0E, 0x82, 0xD3, 0x01, 0x86, 0xD6, 0x01,
+    0x94, 0x80, 0x03, 0x85, 0xCE, 0x0E, 0x86, 0xB6, 0x02, 0x9E, 0xBC, 0x03, 0x02, 0x00, 0x00, 0x51,
+    0x8C, 0xFF, 0xFF, 0x81, 0x97, 0x04, 0x82, 0x01, 0x01, 0xBF, 0xF7, 0x29, 0x42, 0x88, 0x53, 0x99,
+    0x36, 0x00, 0x22, 0x00, 0x95, 0x98, 0x04, 0x87, 0xA7, 0x01, 0x86, 0xFC, 0x02, 0x8B, 0x26, 0x80,
+    0xBB, 0x02, 0x04, 0x31, 0x84, 0x14, 0xA5, 0xD3, 0x9C, 0xD3, 0x9C, 0x92, 0x94, 0x80, 0x01, 0x01,
+    0x72, 0x8C, 0xAF, 0x73, 0x80, 0x10, 0x8E, 0x5E, 0x8D, 0x10, 0x80, 0x87, 0x07, 0x9F, 0x85, 0x01,
+    0x8E, 0x1D, 0x91, 0xCF, 0x04, 0x8C, 0xBB, 0x02, 0x83, 0x01, 0x81, 0xD8, 0x0C, 0x94, 0x99, 0x0B,
+    0x87, 0x17, 0x01, 0x05, 0x19, 0x67, 0x29, 0x87, 0x97, 0x04, 0x81, 0x99, 0x04, 0x82, 0x01, 0x86,
+    0x98, 0x04, 0x82, 0x99, 0x04, 0x82, 0x64, 0x80, 0x44, 0x0B, 0xA4, 0x10, 0x68, 0x21, 0x67, 0x21,
+    0x27, 0x21, 0x26, 0x19, 0x26, 0x19, 0x26, 0x21, 0x26, 0x21, 0x26, 0x19, 0x06, 0x19, 0x06, 0x19,
+    0xE5, 0x18, 0x80, 0x2E, 0x00, 0x62, 0x08, 0x84, 0xAD, 0x0D, 0x81, 0x97, 0x02, 0xC1, 0xE3, 0x03,
+    0xB5, 0x01, 0x85, 0x82, 0x06, 0x8C, 0xA1, 0x02, 0x86, 0x0F, 0x83, 0x1C, 0x09, 0x21, 0x00, 0x42,
+    0x08, 0x83, 0x08, 0xA4, 0x10, 0xE5, 0x18, 0x26, 0x21, 0x47, 0x21, 0x26, 0x21, 0xC4, 0x18, 0x63,
+    0x08, 0x87, 0xB9, 0x04, 0x84, 0xAE, 0x02, 0x96, 0xA0, 0x04, 0x80, 0x26, 0x03, 0xB6, 0xB5, 0xDF,
+    0xF7, 0x3D, 0xE7, 0x5D, 0xE7, 0x80, 0x01, 0x80, 0x97, 0x04, 0x02, 0x7E, 0xE7, 0x3C, 0xE7, 0xE4,
+    0x18, 0x81, 0xF8, 0x05, 0x91, 0x81, 0x03, 0x86, 0x3B, 0x8A, 0x43, 0x8C, 0x4F, 0x81, 0x0D, 0x04,
+    0x00, 0x00, 0x41, 0x08, 0x62, 0x10, 0x62, 0x10, 0x82, 0x10, 0x82, 0x01, 0x01, 0x62, 0x10, 0x41,
+    0x08, 0x87, 0x93, 0x05, 0x85, 0x08, 0x80, 0xB2, 0x02, 0x82, 0x20, 0x02, 0xE3, 0x18, 0xBF, 0xF7,
+    0xFF, 0xFF, 0x81, 0x01, 0x00, 0xDF, 0xF7, 0x80, 0x03, 0x00, 0x38, 0xC6, 0x83, 0xB1, 0x08, 0x93,
+    0x56, 0xA1, 0x01, 0xA3, 0x2F, 0x82, 0x24, 0x8B, 0xB8, 0x02, 0x86, 0x8E, 0x01, 0x80, 0x0B, 0x81,
+    0xD8, 0x03, 0x8C, 0xD3, 0x02, 0x84, 0xC4, 0x06, 0x85, 0xDE, 0x02, 0x04, 0xE5, 0x18, 0xA9, 0x31,
+    0xC5, 0x10, 0x83, 0x08, 0x83, 0x10, 0x88, 0x99, 0x04, 0x84, 0x91, 0x04, 0x81, 0x92, 0x04, 0x84,
+    0xD9, 0x0C, 0x80, 0xD4, 0x02, 0x82, 0xB7, 0x01, 0x02, 0x00, 0x00, 0xC4, 0x10, 0x26, 0x21, 0x80,
+    0x0F, 0x80, 0xE2, 0x0C, 0x01, 0xA4, 0x08, 0xA4, 0x10, 0x80, 0x01, 0x0D, 0xC5, 0x10, 0xE5, 0x18,
+    0x26, 0x19, 0x27, 0x21, 0x26, 0x21, 0x06, 0x19, 0x05, 0x19, 0x06, 0x19, 0x26, 0x21, 0x05, 0x19,
+    0xC4, 0x18, 0x83, 0x10, 0x62, 0x08, 0x41, 0x00, 0x95, 0xF3, 0x04, 0xD6, 0x01, 0x8C, 0xE3, 0x01,
+    0x88, 0xA9, 0x08, 0x84, 0xBB, 0x08, 0x86, 0x1D, 0x81, 0x92, 0x04, 0x03, 0x83, 0x10, 0xC4, 0x10,
+    0xE5, 0x18, 0x06, 0x21, 0x80, 0xE7, 0x0D, 0x81, 0x01, 0x08, 0x67, 0x21, 0x68, 0x29, 0xA9, 0x29,
+    0xC9, 0x31, 0xEA, 0x31, 0xC9, 0x31, 0x67, 0x29, 0xE5, 0x18, 0x62, 0x08, 0x86, 0x2C, 0x86, 0xE1,
+    0x0A, 0x91, 0x01, 0x80, 0xD0, 0x03, 0x01, 0x9A, 0xD6, 0xBF, 0xF7, 0x81, 0x97, 0x04, 0x81, 0x01,
+    0x01, 0xBF, 0xF7, 0x39, 0xC6, 0x80, 0xF3, 0x01, 0x95, 0xDB, 0x0B, 0x84, 0xC5, 0x03, 0x85, 0x93,
+    0x03, 0x83, 0xEF, 0x07, 0x8B, 0xCD, 0x0F, 0x83, 0xF1, 0x02, 0x05, 0x55, 0xAD, 0x1C, 0xE7, 0xDB,
+    0xDE, 0xDB, 0xDE, 0xBB, 0xD6, 0xBA, 0xD6, 0x80, 0x04, 0x01, 0x1C, 0xE7, 0x2D, 0x63, 0x8D, 0xAB,
+    0x09, 0x81, 0x3D, 0x82, 0x98, 0x04, 0x01, 0x08, 0x42, 0xDF, 0xF7, 0x83, 0x66, 0x80, 0xAE, 0x0D,
+    0x00, 0xB3, 0x94, 0x82, 0x20, 0xA8, 0x8E, 0x04, 0x8C, 0x81, 0x05, 0x87, 0xCF, 0x04, 0x84, 0x76,
+    0x84, 0x05, 0x86, 0x92, 0x02, 0x87, 0x11, 0x83, 0x08, 0x85, 0xAD, 0x02, 0x83, 0x06, 0x85, 0x47,
+    0x8B, 0xCE, 0x02, 0x86, 0x91, 0x0F, 0x88, 0x0C, 0x03, 0x00, 0x00, 0xA3, 0x10, 0xC9, 0x31, 0xE5,
+    0x18, 0x80, 0xD7, 0x06, 0x86, 0xC5, 0x0C, 0x81, 0x91, 0x04, 0x01, 0xA4, 0x10, 0x84, 0x10, 0x82,
+    0x97, 0x04, 0x84, 0xC4, 0x0C, 0x81, 0x01, 0x00, 0x62, 0x08, 0x81, 0xE6, 0x02, 0x81, 0x98, 0x04,
+    0x01, 0x05, 0x19, 0x26, 0x19, 0x80, 0x1C, 0x01, 0xA4, 0x08, 0xA3, 0x08, 0x83, 0x24, 0x80, 0x01,
+    0x09, 0xA4, 0x10, 0xC4, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0xE5, 0x10, 0x05, 0x19, 0x27, 0x21, 0x67,
+    0x29, 0x47, 0x21, 0x46, 0x21, 0x80, 0xA1, 0x04, 0x00, 0xC4, 0x18, 0x82, 0xF1, 0x02, 0xC7, 0x01,
+    0x9A, 0x80, 0x09, 0x94, 0xCA, 0x01, 0x86, 0xA3, 0x08, 0x85, 0x16, 0x81, 0xA4, 0x08, 0x80, 0x92,
+    0x04, 0x80, 0xA4, 0x08, 0x80, 0x8E, 0x04, 0x01, 0x88, 0x29, 0x68, 0x21, 0x80, 0xE2, 0x09, 0x83,
+    0x99, 0x04, 0x83, 0x9B, 0x04, 0x06, 0xEA, 0x39, 0x2B, 0x3A, 0x0A, 0x3A, 0xE9, 0x39, 0x67, 0x29,
+    0xC4, 0x18, 0x42, 0x08, 0x84, 0x95, 0x02, 0x8D, 0xD1, 0x02, 0x84, 0xF1, 0x02, 0x81, 0x13, 0x80,
+    0x7D, 0x04, 0x04, 0x21, 0x5D, 0xEF, 0x9E, 0xEF, 0x7E, 0xEF, 0x5D, 0xEF, 0x82, 0xB2, 0x03, 0x01,
+    0xFF, 0xFF, 0x14, 0xA5, 0x81, 0xCD, 0x06, 0x89, 0xD3, 0x03, 0x8B, 0xEF, 0x0B, 0x84, 0x98, 0x04,
+    0x83, 0x17, 0x8D, 0xB3, 0x0B, 0x84, 0xF4, 0x04, 0x06, 0x00, 0x00, 0xC3, 0x18, 0x7D, 0xEF, 0xFF,
+    0xFF, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0x80, 0x01, 0x02, 0x9E, 0xEF, 0xFF, 0xFF, 0xCB, 0x52,
+    0x87, 0x9F, 0x07, 0x8B, 0xC3, 0x03, 0x05, 0x2D, 0x63, 0xFF, 0xFF, 0x5D, 0xE7, 0x7E, 0xEF, 0x5E,
+    0xEF, 0x7E, 0xEF, 0x81, 0x67, 0x00, 0xCF, 0x73, 0x95, 0x81, 0x0E, 0x9B, 0x01, 0x86, 0xDD, 0x08,
+    0x93, 0x1D, 0x83, 0x9B, 0x02, 0x8D, 0x2E, 0x00, 0x22, 0x00, 0x80, 0x8C, 0x0D, 0x89, 0xB5, 0x06,
+    0x92, 0xB0, 0x03, 0x85, 0x80, 0x0C, 0x85, 0xBB, 0x04, 0x82, 0x07, 0x02, 0x62, 0x08, 0xC9, 0x31,
+    0x26, 0x19, 0x80, 0xEB, 0x03, 0x00, 0x83, 0x10, 0x81, 0x88, 0x08, 0x02, 0x83, 0x10, 0x84, 0x08,
+    0x84, 0x10, 0x82, 0xF3, 0x03, 0x83, 0x98, 0x04, 0x82, 0xB4, 0x08, 0x85, 0x98, 0x04, 0x00, 0x42,
+    0x08, 0x84, 0x98, 0x04, 0x01, 0x46, 0x21, 0x26, 0x19, 0x81, 0x23, 0x80, 0xB1, 0x08, 0x82, 0x01,
+    0x82, 0xDC, 0x08, 0x80, 0x0C, 0x83, 0x05, 0x81, 0xA1, 0x04, 0x01, 0xE5, 0x18, 0xE5, 0x18, 0x80,
+    0x22, 0xC8, 0x01, 0x9D, 0x98, 0x0D, 0x89, 0x9B, 0x04, 0x88, 0x98, 0x04, 0x85, 0x1B, 0x80, 0x92,
+    0x04, 0x00, 0x63, 0x08, 0x80, 0xB6, 0x0C, 0x00, 0x05, 0x19, 0x80, 0x93, 0x04, 0x80, 0x87, 0x04,
+    0x80, 0x01, 0x00, 0x68, 0x29, 0x80, 0x02, 0x82, 0x01, 0x00, 0x67, 0x29, 0x80, 0x08, 0x00, 0x67,
+    0x29, 0x80, 0x01, 0x81, 0x04, 0x80, 0xA6, 0x04, 0x09, 0x88, 0x29, 0xA9, 0x29, 0xEA, 0x31, 0x2B,
+    0x42, 0x6C, 0x42, 0x4B, 0x42, 0x0A, 0x3A, 0x47, 0x29, 0xA4, 0x10, 0x22, 0x00, 0x82, 0x2B, 0x86,
+    0x01, 0x84, 0xB9, 0x02, 0x87, 0x01, 0x80, 0xC8, 0x07, 0x02, 0xDF, 0xFF, 0x7E, 0xEF, 0x7D, 0xEF,
+    0x80, 0xAF, 0x03, 0x00, 0x5D, 0xEF, 0x80, 0x01, 0x01, 0xFF, 0xFF, 0xCF, 0x7B, 0x81, 0x98, 0x04,
+    0x8D, 0x8B, 0x08, 0x80, 0x83, 0x0C, 0x94, 0xA0, 0x03, 0x8F, 0xC6, 0x07, 0x01, 0x00, 0x00, 0xC7,
+    0x39, 0x80, 0x97, 0x04, 0x00, 0x7D, 0xEF, 0x80, 0x48, 0x81, 0x4B, 0x01, 0x9E, 0xEF, 0x66, 0x29,
+    0x83, 0xDF, 0x04, 0x8E, 0x87, 0x05, 0x02, 0x00, 0x00, 0x31, 0x84, 0xFF, 0xFF, 0x81, 0x1F, 0x81,
+    0x01, 0x01, 0xFF, 0xFF, 0xAA, 0x52, 0x94, 0x96, 0x09, 0x92, 0x01, 0x8E, 0x45, 0x90, 0x39, 0x84,
+    0x8F, 0x04, 0x84, 0x9C, 0x02, 0x82, 0x08, 0x87, 0x22, 0x81, 0x93, 0x01, 0x84, 0x19, 0x87, 0xBE,
+    0x02, 0x87, 0xD1, 0x02, 0x83, 0x10, 0x81, 0x1F, 0x8E, 0xE2, 0x02, 0x00, 0x21, 0x00, 0x80, 0xF5,
+    0x07, 0x8D, 0xC3, 0x0C, 0x82, 0xAC, 0x0C, 0x89, 0xB1, 0x08, 0x80, 0xC8, 0x02, 0x83, 0x92, 0x01,
+    0x03, 0x47, 0x21, 0x05, 0x19, 0xC4, 0x10, 0xC4, 0x10, 0x81, 0x19, 0x81, 0x1A, 0x82, 0x8F, 0x04,
+    0x81, 0x28, 0x83, 0x06, 0x83, 0xBC, 0x08, 0x00, 0x83, 0x08, 0xB2, 0x81, 0x04, 0xB9, 0x01, 0x86,
+    0xFB, 0x01, 0x88, 0x10, 0x81, 0xA5, 0x08, 0x81, 0xDF, 0x0D, 0x02, 0x06, 0x19, 0x26, 0x19, 0x26,
+    0x21, 0x82, 0x01, 0x82, 0xA2, 0x08, 0x80, 0x8C, 0x04, 0x80, 0x95, 0x04, 0x80, 0x8B, 0x04, 0x00,
+    0x88, 0x29, 0x80, 0x05, 0x80, 0xA3, 0x04, 0x81, 0x99, 0x04, 0x00, 0x67, 0x29, 0x81, 0x0B, 0x80,
+    0x01, 0x0A, 0xA8, 0x29, 0xA8, 0x29, 0xC9, 0x31, 0x0A, 0x3A, 0x4C, 0x42, 0x8D, 0x4A, 0x8C, 0x4A,
+    0x4B, 0x42, 0xA8, 0x31, 0xE5, 0x18, 0x42, 0x00, 0x81, 0xF7, 0x01, 0x81, 0xE8, 0x0F, 0x85, 0x9A,
+    0x04, 0x88, 0x97, 0x04, 0x80, 0x9F, 0x02, 0x00, 0x4D, 0x63, 0x80, 0xB0, 0x03, 0x01, 0x7D, 0xEF,
+    0x5D, 0xEF, 0x82, 0xB3, 0x03, 0x82, 0xB1, 0x03, 0x83, 0x23, 0x88, 0xF7, 0x0C, 0x85, 0xBE, 0x0C,
+    0x8C, 0x87, 0x0D, 0x86, 0xB0, 0x08, 0x8B, 0xA5, 0x03, 0x02, 0x00, 0x00, 0xEB, 0x5A, 0xFF, 0xFF,
+    0x80, 0xF7, 0x08, 0x82, 0x46, 0x01, 0xBF, 0xF7, 0xDB, 0xD6, 0x80, 0xEE, 0x0A, 0x92, 0xA5, 0x0C,
+    0x02, 0x00, 0x00, 0x75, 0xAD, 0xFF, 0xFF, 0x83, 0x97, 0x04, 0x02, 0x9E, 0xEF, 0xBF, 0xF7, 0x86,
+    0x29, 0xB2, 0xB0, 0x08, 0x91, 0x51, 0x8A, 0xA3, 0x08, 0x82, 0x9D, 0x02, 0x8B, 0xD1, 0x0C, 0x84,
+    0x21, 0x84, 0xB5, 0x02, 0x86, 0x0C, 0x84, 0x27, 0x85, 0xBB, 0x04, 0x91, 0x8E, 0x07, 0x01, 0x26,
+    0x21, 0x68, 0x29, 0x80, 0xDF, 0x03, 0x85, 0xC6, 0x0C, 0x83, 0xE6, 0x03, 0x82, 0xF0, 0x03, 0x80,
+    0xB1, 0x08, 0x81, 0x04, 0x81, 0x9E, 0x08, 0x83, 0x9B, 0x04, 0x81, 0xE8, 0x0E, 0x81, 0xB1, 0x02,
+    0x02, 0x21, 0x08, 0x67, 0x29, 0xE5, 0x10, 0x82, 0x96, 0x04, 0x80, 0x9B, 0x04, 0x00, 0xA4, 0x08,
+    0x81, 0x01, 0x82, 0x0A, 0x82, 0xB6, 0x08, 0x80, 0xE0, 0x08, 0x82, 0xBB, 0x08, 0x01, 0xC5, 0x18,
+    0xC4, 0x10, 0xD8, 0x83, 0x04, 0x8F, 0x01, 0x8A, 0xE6, 0x01, 0x82, 0x0F, 0x80, 0x9B, 0x01, 0x01,
+    0x42, 0x08, 0x62, 0x08, 0x81, 0x9B, 0x05, 0x80, 0xB5, 0x09, 0x81, 0x01, 0x01, 0x05, 0x19, 0x06,
+    0x19, 0x80, 0x01, 0x81, 0x9B, 0x04, 0x83, 0xBA, 0x0C, 0x81, 0xC8, 0x0C, 0x82, 0x01, 0x80, 0xCB,
+    0x0C, 0x82, 0xAD, 0x08, 0x80, 0x98, 0x04, 0x83, 0xA6, 0x04, 0x80, 0xB3, 0x08, 0x09, 0xA9, 0x29,
+    0xA9, 0x31, 0xA9, 0x31, 0xCA, 0x31, 0x2B, 0x3A, 0x8D, 0x4A, 0xCD, 0x4A, 0xAD, 0x4A, 0xE9, 0x39,
+    0xA3, 0x10, 0x80, 0x3A, 0x80, 0xDC, 0x0A, 0x00, 0x42, 0x00, 0x80, 0xF9, 0x03, 0x86, 0x9E, 0x04,
+    0x84, 0x01, 0x80, 0xB0, 0x04, 0x00, 0xD3, 0x9C, 0x81, 0xB0, 0x03, 0x00, 0x5D, 0xEF, 0x82, 0xB1,
+    0x03, 0x00, 0x9E, 0xF7, 0x80, 0xE9, 0x07, 0x80, 0x21, 0x83, 0x97, 0x04, 0x86, 0xF0, 0x07, 0x87,
+    0x9D, 0x04, 0x8F, 0xE8, 0x03, 0x8C, 0xAF, 0x08, 0x82, 0x9F, 0x01, 0x00, 0xF0, 0x7B, 0x81, 0x98,
+    0x04, 0x81, 0x01, 0x80, 0xCE, 0x0C, 0x00, 0x18, 0xBE, 0x83, 0xA3, 0x01, 0x88, 0x26, 0x84, 0x0B,
+    0x80, 0xD2, 0x02, 0x01, 0x7A, 0xCE, 0xDF, 0xF7, 0x83, 0x98, 0x04, 0x02, 0xDF, 0xF7, 0x1C, 0xE7,
+    0x82, 0x10, 0xA5, 0xB0, 0x08, 0x98, 0x26, 0xA8, 0xBC, 0x02, 0x82, 0x96, 0x08, 0x87, 0x32, 0x81,
+    0xD4, 0x03, 0x82, 0x9C, 0x04, 0x85, 0xAA, 0x04, 0x8F, 0x01, 0x01, 0xC4, 0x18, 0x88, 0x29, 0x85,
+    0x95, 0x04, 0x82, 0xE2, 0x03, 0x82, 0x98, 0x04, 0x00, 0x83, 0x10, 0x81, 0x95, 0x04, 0x80, 0x03,
+    0x00, 0x84, 0x10, 0x82, 0xF3, 0x03, 0x82, 0x13, 0x01, 0xA3, 0x10, 0x83, 0x08, 0x82, 0x96, 0x02,
+    0x80, 0x44, 0x02, 0x42, 0x08, 0x67, 0x29, 0xC5, 0x10, 0x82, 0x8E, 0x04, 0x83, 0x9B, 0x04, 0x88,
+    0x06, 0x83, 0xD0, 0x0C, 0x80, 0xC8, 0x08, 0xA9, 0x9C, 0x01, 0xBE, 0x01, 0x85, 0xE7, 0x05, 0x82,
+    0x09, 0x81, 0xC8, 0x03, 0x00, 0x62, 0x08, 0x80, 0x94, 0x04, 0x81, 0xA3, 0x01, 0x82, 0x8F, 0x01,
+    0x80, 0x01, 0x00, 0xE5, 0x10, 0x84, 0x99, 0x04, 0x00, 0x06, 0x19, 0x84, 0x99, 0x04, 0x80, 0x9A,
+    0x04, 0x82, 0xC7, 0x0C, 0x00, 0x67, 0x21, 0x83, 0x0B, 0x81, 0x0D, 0x80, 0x9A, 0x04, 0x80, 0xAD,
+    0x08, 0x80, 0xC8, 0x0C, 0x0C, 0x8C, 0x4A, 0xEE, 0x5A, 0x70, 0x6B, 0xD1, 0x73, 0xF1, 0x73, 0xD1,
+    0x73, 0xD1, 0x73, 0xB1, 0x73, 0xB1, 0x6B, 0xF2, 0x73, 0xF2, 0x73, 0xCC, 0x52, 0xA4, 0x10, 0x81,
+    0xB1, 0x03, 0x80, 0xFA, 0x03, 0x84, 0x9C, 0x04, 0x81, 0x81, 0x04, 0x82, 0x84, 0x04, 0x80, 0x04,
+    0x01, 0x00, 0x00, 0xF8, 0xBD, 0x81, 0x98, 0x04, 0x83, 0xE9, 0x07, 0x04, 0xDB, 0xDE, 0x83, 0x10,
+    0x01, 0x00, 0x42, 0x00, 0x42, 0x00, 0x86, 0xCE, 0x08, 0x87, 0x05, 0x94, 0xA0, 0x03, 0x8F, 0x14,
+    0x83, 0xDF, 0x04, 0x83, 0x98, 0x04, 0x00, 0x14, 0xA5, 0x82, 0x97, 0x04, 0x80, 0xDD, 0x0F, 0x8E,
+    0x20, 0x02, 0xE4, 0x18, 0x5D, 0xEF, 0xBE, 0xF7, 0x80, 0xFB, 0x04, 0x82, 0x96, 0x09, 0x80, 0xB8,
+    0x04, 0xA3, 0x96, 0x04, 0x97, 0x8B, 0x04, 0x82, 0x97, 0x06, 0x01, 0x83, 0x10, 0xC4, 0x18, 0x80,
+    0xF9, 0x01, 0x09, 0x25, 0x21, 0x46, 0x21, 0x67, 0x29, 0x87, 0x29, 0xA8, 0x31, 0xC8, 0x31, 0xE9,
+    0x39, 0x09, 0x3A, 0x09, 0x42, 0x2A, 0x42, 0x80, 0x01, 0x12, 0x4A, 0x42, 0x4A, 0x4A, 0x4A, 0x4A,
+    0x4A, 0x42, 0x4A, 0x42, 0x2A, 0x42, 0x09, 0x3A, 0xE9, 0x39, 0xC8, 0x39, 0xA7, 0x31, 0x87, 0x29,
+    0x66, 0x29, 0x46, 0x29, 0x25, 0x21, 0x04, 0x19, 0xC3, 0x18, 0x83, 0x10, 0x62, 0x08, 0x21, 0x08,
+    0x8A, 0xC1, 0x02, 0x8D, 0x0C, 0x83, 0xAB, 0x04, 0x8F, 0x9F, 0x04, 0x02, 0x83, 0x10, 0xA8, 0x31,
+    0xC5, 0x10, 0x86, 0xAA, 0x08, 0x82, 0x86, 0x04, 0x00, 0x83, 0x10, 0x80, 0x97, 0x04, 0x83, 0xCC,
+    0x0C, 0x80, 0xB6, 0x08, 0x87, 0xC1, 0x08, 0x00, 0x63, 0x08, 0x84, 0x98, 0x04, 0x00, 0x83, 0x08,
+    0x80, 0x98, 0x04, 0x81, 0xFC, 0x02, 0x85, 0x9B, 0x04, 0x87, 0x01, 0x80, 0xBE, 0x04, 0x81, 0x98,
+    0x04, 0x80, 0xC2, 0x0B, 0x91, 0x87, 0x09, 0xDB, 0x01, 0x82, 0x92, 0x01, 0x00, 0x41, 0x00, 0x80,
+    0x91, 0x02, 0x83, 0x01, 0x82, 0xA4, 0x01, 0x00, 0xA3, 0x08, 0x83, 0x99, 0x04, 0x82, 0xB5, 0x08,
+    0x81, 0x9A, 0x04, 0x80, 0xB2, 0x08, 0x00, 0x27, 0x21, 0x85, 0x8E, 0x04, 0x80, 0x01, 0x01, 0x27,
+    0x21, 0x27, 0x21, 0x81, 0xA5, 0x04, 0x00, 0x88, 0x29, 0x80, 0xBF, 0x0C, 0x04, 0x4B, 0x42, 0x8C,
+    0x4A, 0x0E, 0x5B, 0x4F, 0x63, 0x90, 0x6B, 0x80, 0x91, 0x04, 0x0D, 0xB0, 0x73, 0xAF, 0x73, 0xAF,
+    0x73, 0x8F, 0x6B, 0xB0, 0x73, 0x32, 0x84, 0xF5, 0x9C, 0xB8, 0xB5, 0xF9, 0xBD, 0xB8, 0xAD, 0x36,
+    0x9D, 0x36, 0x9D, 0xD5, 0x94, 0x6B, 0x4A, 0x81, 0xB7, 0x07, 0x81, 0x9A, 0x04, 0x80, 0xFD, 0x03,
+    0x00, 0x42, 0x08, 0x80, 0x81, 0x04, 0x85, 0x01, 0x03, 0x21, 0x00, 0xC3, 0x10, 0x1C, 0xE7, 0xBF,
+    0xF7, 0x82, 0xAD, 0x08, 0x81, 0xB1, 0x03, 0x00, 0xF8, 0xBD, 0x80, 0xD0, 0x08, 0x80, 0xB3, 0x04,
+    0x8C, 0xCE, 0x08, 0x84, 0xC4, 0x0C, 0x8B, 0x91, 0x04, 0x95, 0xC6, 0x07, 0x02, 0x00, 0x00, 0x59,
+    0xCE, 0xFF, 0xFF, 0x85, 0x01, 0x00, 0x10, 0x84, 0x82, 0xC0, 0x05, 0x80, 0x58, 0x85, 0xBD, 0x04,
+    0x86, 0x2F, 0x04, 0x00, 0x00, 0xE8, 0x39, 0xDF, 0xFF, 0x9E, 0xF7, 0x9E, 0xEF, 0x80, 0x01, 0x00,
+    0x9E, 0xF7, 0x80, 0x67, 0x00, 0xF3, 0x9C, 0xA6, 0x98, 0x04, 0x81, 0x3B, 0x88, 0xFE, 0x01, 0x82,
+    0x8C, 0x04, 0x07, 0x05, 0x21, 0x46, 0x29, 0xA7, 0x31, 0xE9, 0x39, 0x4A, 0x42, 0x8B, 0x4A, 0xCC,
+    0x52, 0xED, 0x5A, 0x80, 0xD9, 0x01, 0x05, 0x4F, 0x63, 0x6F, 0x63, 0x4F, 0x63, 0x2E, 0x5B, 0x2E,
+    0x5B, 0x0E, 0x5B, 0x80, 0x03, 0x80, 0x01, 0x80, 0x0A, 0x00, 0x90, 0x6B, 0x81, 0x01, 0x01, 0xB1,
+    0x6B, 0xF1, 0x73, 0x80, 0xF7, 0x05, 0x02, 0x33, 0x7C, 0x53, 0x84, 0x74, 0x84, 0x80, 0x01, 0x12,
+    0x94, 0x84, 0x94, 0x8C, 0xB4, 0x8C, 0xB4, 0x8C, 0x94, 0x8C, 0x74, 0x84, 0x53, 0x84, 0x32, 0x7C,
+    0x32, 0x7C, 0xF1, 0x73, 0xB0, 0x73, 0x6F, 0x6B, 0x2E, 0x63, 0xCC, 0x52, 0x4A, 0x4A, 0xE8, 0x39,
+    0x66, 0x29, 0x05, 0x19, 0xA3, 0x10, 0x88, 0xAA, 0x03, 0x85, 0x4F, 0x81, 0xDB, 0x03, 0x81, 0x5D,
+    0x84, 0xEF, 0x06, 0x85, 0x8C, 0x0D, 0x81, 0x16, 0x02, 0x42, 0x00, 0x67, 0x29, 0x05, 0x19, 0x86,
+    0xAA, 0x08, 0x83, 0x06, 0x00, 0x83, 0x10, 0x80, 0x01, 0x88, 0xD3, 0x0C, 0x85, 0x98, 0x04, 0x83,
+    0x89, 0x0A, 0x02, 0x00, 0x00, 0xA3, 0x10, 0x47, 0x21, 0x8E, 0x94, 0x04, 0x83, 0xA5, 0x04, 0x81,
+    0xF1, 0x0C, 0x80, 0x98, 0x04, 0x00, 0xE5, 0x10, 0x80, 0xC5, 0x0E, 0xC4, 0x01, 0x00, 0x20, 0x00,
+    0xA0, 0x92, 0x04, 0x83, 0xBB, 0x07, 0x81, 0x96, 0x04, 0x81, 0x01, 0x80, 0xC8, 0x03, 0x83, 0x9B,
+    0x04, 0x00, 0x63, 0x08, 0x85, 0xB3, 0x08, 0x81, 0x9B, 0x04, 0x00, 0xE5, 0x10, 0x81, 0xB4, 0x08,
+    0x82, 0xB1, 0x08, 0x84, 0x01, 0x82, 0xA6, 0x08, 0x0E, 0xC9, 0x31, 0xEA, 0x39, 0x2B, 0x3A, 0x8C,
+    0x4A, 0xEE, 0x52, 0x6F, 0x63, 0xB1, 0x6B, 0xB1, 0x73, 0xB0, 0x6B, 0x4E, 0x63, 0xCC, 0x52, 0x09,
+    0x3A, 0x66, 0x29, 0xC3, 0x18, 0x41, 0x08, 0x83, 0x44, 0x09, 0xA3, 0x10, 0x2A, 0x42, 0xB0, 0x73,
+    0xF5, 0x9C, 0xF9, 0xBD, 0x19, 0xBE, 0xB8, 0xB5, 0xD9, 0xB5, 0x73, 0x84, 0x26, 0x21, 0x82, 0xCD,
+    0x0C, 0x81, 0xAE, 0x08, 0x80, 0x82, 0x04, 0x85, 0x01, 0x02, 0x01, 0x00, 0xA7, 0x31, 0xBF, 0xF7,
+    0x80, 0xB0, 0x03, 0x00, 0x9E, 0xF7, 0x81, 0xB3, 0x03, 0x80, 0xB1, 0x03, 0x00, 0xF4, 0x9C, 0x80,
+    0x9C, 0x02, 0x81, 0x98, 0x04, 0x84, 0xC6, 0x08, 0x83, 0x01, 0x82, 0xD4, 0x08, 0x83, 0xD9, 0x0C,
+    0x89, 0x9D, 0x04, 0x91, 0x98, 0x04, 0x83, 0x22, 0x02, 0x01, 0x00, 0xEC, 0x5A, 0xCF, 0x7B, 0x80,
+    0x01, 0x00, 0xF0, 0x7B, 0x80, 0x01, 0x02, 0x10, 0x7C, 0x10, 0x84, 0x65, 0x29, 0x82, 0xEB, 0x02,
+    0x83, 0x35, 0x82, 0x9D, 0x04, 0x82, 0xDA, 0x04, 0x82, 0xBD, 0x08, 0x02, 0x00, 0x00, 0xEC, 0x5A,
+    0xFF, 0xFF, 0x80, 0x66, 0x82, 0x01, 0x01, 0xFF, 0xFF, 0x8E, 0x73, 0xA3, 0x98, 0x04, 0x82, 0xF8,
+    0x01, 0x81, 0x3E, 0x00, 0x42, 0x08, 0x80, 0xEB, 0x02, 0x01, 0xE5, 0x18, 0x26, 0x21, 0x81, 0x98,
+    0x08, 0x02, 0xA8, 0x31, 0xC9, 0x31, 0xE9, 0x39, 0x80, 0x01, 0x02, 0xC9, 0x31, 0xC9, 0x31, 0xC8,
+    0x31, 0x80, 0x09, 0x06, 0x67, 0x29, 0x46, 0x21, 0x26, 0x21, 0x25, 0x21, 0x05, 0x19, 0xE4, 0x18,
+    0xC4, 0x10, 0x80, 0xD5, 0x0B, 0x82, 0x89, 0x02, 0x00, 0x42, 0x08, 0x80, 0x01, 0x83, 0xAA, 0x06,
+    0x04, 0x83, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0xC3, 0x10, 0xE4, 0x18, 0x81, 0xC1, 0x08, 0x00, 0xA8,
+    0x31, 0x80, 0xB8, 0x04, 0x01, 0xAC, 0x4A, 0xED, 0x5A, 0x80, 0x8F, 0x06, 0x06, 0xF2, 0x73, 0x53,
+    0x7C, 0x94, 0x84, 0xF5, 0x94, 0x16, 0x95, 0x16, 0x95, 0x37, 0x9D, 0x80, 0x8A, 0x06, 0x09, 0x36,
+    0x9D, 0x16, 0x9D, 0xF5, 0x94, 0xB4, 0x94, 0x53, 0x84, 0xD0, 0x73, 0x2D, 0x5B, 0x6A, 0x4A, 0x87,
+    0x31, 0xE4, 0x18, 0x86, 0xB0, 0x03, 0x85, 0x59, 0x83, 0xA3, 0x01, 0x85, 0x0B, 0x84, 0xBE, 0x08,
+    0x80, 0xBD, 0x02, 0x85, 0xE5, 0x03, 0x81, 0xA9, 0x08, 0x83, 0x93, 0x04, 0x8E, 0x98, 0x04, 0x80,
+    0xF5, 0x02, 0x00, 0x42, 0x08, 0x83, 0x9E, 0x07, 0x02, 0x00, 0x00, 0xA4, 0x10, 0x26, 0x19, 0x82,
+    0xB4, 0x0C, 0x81, 0x01, 0x01, 0xA3, 0x08, 0xA4, 0x08, 0x81, 0x92, 0x04, 0x89, 0xBA, 0x08, 0x81,
+    0xDA, 0x08, 0x80, 0xF3, 0x08, 0xC5, 0x98, 0x04, 0x81, 0x01, 0x82, 0x83, 0x03, 0x93, 0x91, 0x04,
+    0x84, 0x8C, 0x04, 0x81, 0x06, 0x86, 0x99, 0x04, 0x00, 0x41, 0x08, 0x80, 0x99, 0x04, 0x85, 0x89,
+    0x02, 0x82, 0xB2, 0x08, 0x81, 0x9A, 0x04, 0x84, 0xCC, 0x0C, 0x84, 0x9A, 0x04, 0x80, 0xA5, 0x08,
+    0x80, 0xB8, 0x0C, 0x0A, 0x0A, 0x3A, 0x2B, 0x42, 0x6C, 0x4A, 0xCD, 0x52, 0x0E, 0x5B, 0x2F, 0x5B,
+    0x2F, 0x5B, 0xED, 0x5A, 0xAC, 0x52, 0x2A, 0x42, 0x87, 0x31, 0x85, 0x92, 0x04, 0x80, 0x5E, 0x80,
+    0xCF, 0x0F, 0x83, 0x9A, 0x04, 0x07, 0xA9, 0x31, 0x0E, 0x5B, 0x94, 0x8C, 0xD8, 0xB5, 0x39, 0xC6,
+    0x3A, 0xC6, 0x97, 0xAD, 0x2A, 0x42, 0x81, 0x99, 0x04, 0x82, 0xEF, 0x03, 0x85, 0x01, 0x02, 0x42,
+    0x00, 0x00, 0x00, 0xCC, 0x5A, 0x82, 0xB0, 0x03, 0x81, 0x9A, 0x04, 0x80, 0xB1, 0x03, 0x00, 0x8E,
+    0x6B, 0x81, 0x98, 0x04, 0x85, 0x01, 0x85, 0xB8, 0x04, 0x82, 0xDB, 0x08, 0x83, 0xB5, 0x08, 0x84,
+    0xBE, 0x07, 0x87, 0xC7, 0x07, 0x8E, 0x98, 0x04, 0x82, 0x05, 0x8A, 0xC9, 0x05, 0x89, 0xB0, 0x04,
+    0x83, 0x8D, 0x0D, 0x82, 0x1F, 0x00, 0x10, 0x84, 0x80, 0x68, 0x00, 0xBE, 0xF7, 0x81, 0x66, 0x02,
+    0xBE, 0xF7, 0xFF, 0xFF, 0x29, 0x42, 0x8D, 0x98, 0x04, 0x93, 0xA7, 0x0D, 0x80, 0x9B, 0x0A, 0x80,
+    0x98, 0x03, 0x80, 0x8D, 0x0A, 0x01, 0x05, 0x21, 0x46, 0x21, 0x80, 0x85, 0x04, 0x01, 0x26, 0x21,
+    0x05, 0x21, 0x80, 0x86, 0x04, 0x81, 0x85, 0x04, 0x81, 0xE4, 0x04, 0xA8, 0xD1, 0x02, 0x03, 0x42,
+    0x08, 0x83, 0x10, 0xE5, 0x18, 0x66, 0x29, 0x80, 0xA2, 0x04, 0x11, 0x0D, 0x5B, 0x8F, 0x6B, 0x12,
+    0x7C, 0x94, 0x8C, 0xF5, 0x94, 0x37, 0x9D, 0x77, 0xA5, 0x98, 0xA5, 0x98, 0xA5, 0x97, 0xA5, 0x77,
+    0xA5, 0x57, 0xA5, 0x16, 0x9D, 0xB4, 0x8C, 0x32, 0x7C, 0x4E, 0x63, 0x4A, 0x4A, 0x46, 0x29, 0x83,
+    0x8B, 0x02, 0x87, 0xB2, 0x01, 0x84, 0x92, 0x04, 0x82, 0x06, 0x81, 0x16, 0x01, 0xC5, 0x18, 0x27,
+    0x21, 0x87, 0xDF, 0x03, 0x00, 0xA3, 0x10, 0x81, 0xE6, 0x04, 0x81, 0xC5, 0x0C, 0x89, 0xB1, 0x08,
+    0x81, 0x88, 0x07, 0x00, 0x63, 0x08, 0x81, 0x04, 0x80, 0x98, 0x04, 0x83, 0xAB, 0x03, 0x00, 0xE5,
+    0x10, 0x81, 0xD9, 0x08, 0x81, 0xFF, 0x02, 0x00, 0xA3, 0x08, 0x82, 0xB5, 0x0B, 0x02, 0xA4, 0x08,
+    0x83, 0x08, 0xA4, 0x08, 0x80, 0x01, 0x84, 0x37, 0x80, 0x08, 0x00, 0x84, 0x08, 0x80, 0x99, 0x04,
+    0x00, 0xC5, 0x10, 0x80, 0xAC, 0x0F, 0xC9, 0x01, 0x81, 0xB3, 0x0E, 0x00, 0x42, 0x08, 0x8D, 0x9C,
+    0x04, 0x00, 0x21, 0x00, 0x80, 0xFB, 0x03, 0x81, 0x98, 0x01, 0x00, 0x82, 0x08, 0x81, 0x92, 0x06,
+    0x82, 0x9A, 0x04, 0x87, 0xB1, 0x08, 0x81, 0xA1, 0x06, 0x83, 0x99, 0x04, 0x82, 0x9A, 0x01, 0x84,
+    0x98, 0x04, 0x80, 0x01, 0x00, 0xC5, 0x10, 0x80, 0x95, 0x04, 0x00, 0x67, 0x21, 0x81, 0x93, 0x04,
+    0x80, 0xBA, 0x0C, 0x08, 0x6C, 0x42, 0x6C, 0x4A, 0x8C, 0x4A, 0x6C, 0x4A, 0x4A, 0x42, 0xE9, 0x39,
+    0x87, 0x31, 0x04, 0x21, 0x82, 0x10, 0x85, 0x85, 0x09, 0x07, 0xA3, 0x10, 0x46, 0x29, 0xE9, 0x39,
+    0x6C, 0x4A, 0x0E, 0x5B, 0xED, 0x5A, 0x09, 0x3A, 0xEC, 0x5A, 0x84, 0x9A, 0x04, 0x07, 0xA4, 0x10,
+    0x88, 0x29, 0xEE, 0x52, 0x94, 0x8C, 0xF8, 0xB5, 0x5A, 0xC6, 0x19, 0xBE, 0x0D, 0x5B, 0x80, 0x89,
+    0x02, 0x83, 0x91, 0x04, 0x82, 0x9B, 0x08, 0x82, 0x98, 0x04, 0x00, 0x31, 0x84, 0x85, 0xC8, 0x07,
+    0x80, 0x98, 0x04, 0x01, 0x4A, 0x42, 0x01, 0x00, 0x83, 0x8B, 0x04, 0x84, 0xD0, 0x08, 0x82, 0x1C,
+    0x80, 0x08, 0x84, 0x8C, 0x03, 0x83, 0xB1, 0x09, 0x87, 0xC3, 0x03, 0x89, 0xA1, 0x03, 0x83, 0x12,
+    0x96, 0xDA, 0x0C, 0x82, 0xF4, 0x07, 0x87, 0x27, 0x80, 0xDD, 0x01, 0x02, 0x55, 0xAD, 0xFF, 0xFF,
+    0xBE, 0xF7, 0x82, 0x01, 0x02, 0xDF, 0xFF, 0x7E, 0xEF, 0x04, 0x21, 0x89, 0x98, 0x04, 0x89, 0x4A,
+    0x86, 0xA0, 0x04, 0x81, 0x8C, 0x02, 0x00, 0x63, 0x08, 0x80, 0xDA, 0x01, 0x80, 0x85, 0x07, 0x80,
+    0x8C, 0x04, 0x00, 0x63, 0x08, 0x80, 0x94, 0x02, 0x88, 0x21, 0x83, 0xC0, 0x09, 0x82, 0xAC, 0x05,
+    0x82, 0x82, 0x02, 0x81, 0x01, 0x86, 0x1B, 0x81, 0x96, 0x09, 0x82, 0x01, 0x85, 0xA4, 0x02, 0x8E,
+    0xD9, 0x02, 0x08, 0x82, 0x08, 0xE5, 0x18, 0xA8, 0x31, 0x6B, 0x4A, 0x4F, 0x63, 0x32, 0x7C, 0xD5,
+    0x94, 0x36, 0x9D, 0x77, 0xA5, 0x81, 0x9E, 0x04, 0x07, 0x98, 0xA5, 0x98, 0xAD, 0x77, 0xA5, 0x15,
+    0x9D, 0x32, 0x84, 0x0D, 0x5B, 0xC8, 0x31, 0xA3, 0x10, 0x88, 0xB2, 0x08, 0x88, 0xD8, 0x05, 0x01,
+    0x00, 0x00, 0x83, 0x10, 0x80, 0xAE, 0x08, 0x80, 0xF0, 0x02, 0x80, 0x8F, 0x04, 0x81, 0x91, 0x04,
+    0x86, 0xB6, 0x08, 0x80, 0xB7, 0x08, 0x84, 0x01, 0x80, 0xE7, 0x02, 0x85, 0x9C, 0x04, 0x80, 0x99,
+    0x04, 0x80, 0x5F, 0x83, 0x64, 0x80, 0xBA, 0x0F, 0x80, 0x14, 0x81, 0x95, 0x04, 0x8A, 0x01, 0x00,
+    0x84, 0x10, 0x80, 0x03, 0x80, 0xC7, 0x0C, 0x80, 0x96, 0x04, 0x80, 0x02, 0x80, 0x8D, 0x03, 0xA8,
+    0xBF, 0x05, 0x8E, 0x01, 0x81, 0x8A, 0x01, 0x90, 0xBE, 0x0C, 0x81, 0xC1, 0x0E, 0x80, 0x84, 0x04,
+    0x83, 0xD8, 0x01, 0x81, 0xAE, 0x02, 0x00, 0x41, 0x08, 0x80, 0x0B, 0x80, 0xE9, 0x01, 0x00, 0x42,
+    0x00, 0x81, 0x9E, 0x0A, 0x00, 0x83, 0x10, 0x81, 0x15, 0x86, 0xF4, 0x01, 0x82, 0x98, 0x04, 0x80,
+    0x0D, 0x86, 0xBA, 0x0A, 0x83, 0x9A, 0x04, 0x80, 0xB6, 0x01, 0x01, 0xE5, 0x18, 0x26, 0x19, 0x80,
+    0xA7, 0x08, 0x0B, 0xC9, 0x31, 0xEA, 0x31, 0x0A, 0x3A, 0x2A, 0x3A, 0x2B, 0x3A, 0x2A, 0x3A, 0x2A,
+    0x42, 0xE9, 0x39, 0xA8, 0x31, 0x66, 0x29, 0xE4, 0x18, 0x82, 0x10, 0x85, 0xA5, 0x08, 0x0E, 0x00,
+    0x00, 0x41, 0x00, 0xA2, 0x08, 0x23, 0x11, 0xC5, 0x19, 0x88, 0x2A, 0xEB, 0x3A, 0x0E, 0x53, 0x33,
+    0x7C, 0x54, 0x84, 0x74, 0x84, 0xD5, 0x94, 0x4E, 0x63, 0x09, 0x3A, 0x11, 0x7C, 0x85, 0x16, 0x06,
+    0x83, 0x10, 0x89, 0x29, 0x0F, 0x53, 0xD5, 0x94, 0x3A, 0xC6, 0x19, 0xBE, 0x0E, 0x5B, 0x80, 0xEF,
+    0x03, 0x00, 0x42, 0x08, 0x88, 0xB0, 0x08, 0x01, 0x01, 0x00, 0x96, 0xB5, 0x82, 0xB0, 0x03, 0x81,
+    0x97, 0x04, 0x80, 0xB1, 0x03, 0x00, 0x26, 0x21, 0x81, 0x98, 0x04, 0x87, 0xD6, 0x01, 0x81, 0x1C,
+    0x80, 0x05, 0x06, 0x42, 0x08, 0x25, 0x21, 0xE8, 0x39, 0x6A, 0x4A, 0x49, 0x4A, 0xC7, 0x39, 0xC4,
+    0x18, 0x83, 0x96, 0x03, 0x86, 0xDD, 0x07, 0x81, 0x1C, 0x05, 0xA3, 0x10, 0x65, 0x29, 0x28, 0x42,
+    0x8A, 0x52, 0xAA, 0x52, 0x8A, 0x52, 0x80, 0x19, 0x00, 0x04, 0x21, 0x81, 0x58, 0x86, 0x97, 0x04,
+    0x8A, 0xDF, 0x01, 0x86, 0x11, 0x07, 0x41, 0x08, 0x24, 0x21, 0xE8, 0x39, 0x8A, 0x52, 0xCB, 0x52,
+    0x6A, 0x4A, 0xE7, 0x39, 0x25, 0x21, 0x81, 0xD7, 0x01, 0x02, 0x02, 0x00, 0x21, 0x00, 0x9A, 0xD6,
+    0x80, 0x68, 0x00, 0xBF, 0xF7, 0x80, 0x01, 0x80, 0xAF, 0x08, 0x01, 0xBA, 0xD6, 0x21, 0x08, 0x89,
+    0x94, 0x04, 0x08, 0x82, 0x10, 0x25, 0x29, 0xC7, 0x39, 0x08, 0x42, 0x29, 0x42, 0x28, 0x42, 0xC7,
+    0x39, 0x45, 0x29, 0xA3, 0x10, 0x82, 0x38, 0x85, 0xBD, 0x0D, 0x89, 0xCF, 0x04, 0x82, 0x0B, 0x02,
+    0xE4, 0x18, 0xC7, 0x39, 0x49, 0x4A, 0x80, 0x6B, 0x00, 0x86, 0x31, 0x81, 0x87, 0x0C, 0x85, 0xDD,
+    0x0D, 0x82, 0x8B, 0x01, 0x81, 0x17, 0x02, 0x62, 0x08, 0x45, 0x29, 0x08, 0x42, 0x80, 0x18, 0x01,
+    0x6A, 0x52, 0x29, 0x42, 0x80, 0x3B, 0x82, 0xF5, 0x05, 0x84, 0xAF, 0x04, 0x83, 0xE1, 0x0E, 0x00,
+    0x62, 0x08, 0x81, 0x6D, 0x02, 0x41, 0x08, 0xE4, 0x18, 0x86, 0x31, 0x80, 0x1D, 0x04, 0x49, 0x4A,
+    0x08, 0x42, 0xA6, 0x31, 0x24, 0x21, 0x61, 0x08, 0x84, 0x48, 0x10, 0xA3, 0x10, 0x46, 0x21, 0x2A,
+    0x42, 0x2E, 0x63, 0x53, 0x84, 0x16, 0x9D, 0x77, 0xA5, 0xB8, 0xAD, 0x98, 0xAD, 0xB8, 0xAD, 0xF9,
+    0xB5, 0xF9, 0xB5, 0xD8, 0xB5, 0x56, 0xA5, 0x73, 0x84, 0x0D, 0x5B, 0x87, 0x31, 0x80, 0xF9, 0x07,
+    0x83, 0xB6, 0x0A, 0x88, 0x98, 0x04, 0x02, 0x63, 0x08, 0x26, 0x21, 0xC4, 0x10, 0x80, 0x97, 0x04,
+    0x82, 0xA2, 0x08, 0x81, 0xF3, 0x02, 0x80, 0x07, 0x82, 0xC9, 0x0C, 0x80, 0x05, 0x84, 0xA9, 0x0F,
+    0x83, 0x03, 0x81, 0xB3, 0x0C, 0x82, 0x9E, 0x04, 0x83, 0x98, 0x04, 0x80, 0x7D, 0x01, 0xE5, 0x18,
+    0xE5, 0x10, 0x83, 0xC7, 0x0C, 0x80, 0xAB, 0x08, 0x80, 0xB4, 0x04, 0x82, 0x84, 0x03, 0x8B, 0xEC,
+    0x0C, 0x01, 0x84, 0x08, 0xC5, 0x10, 0x93, 0xFB, 0x0B, 0xA5, 0x01, 0x93, 0xDC, 0x05, 0x81, 0xA3,
+    0x08, 0x80, 0x8E, 0x01, 0x01, 0x62, 0x08, 0x41, 0x00, 0x81, 0x08, 0x81, 0x96, 0x08, 0x82, 0x0B,
+    0x80, 0xA7, 0x04, 0x00, 0x41, 0x00, 0x81, 0xFE, 0x03, 0x82, 0xA3, 0x04, 0x88, 0xAF, 0x08, 0x83,
+    0xAF, 0x06, 0x81, 0xAC, 0x04, 0x80, 0xB5, 0x04, 0x01, 0x62, 0x08, 0xA3, 0x10, 0x81, 0xF9, 0x0E,
+    0x80, 0xD0, 0x0E, 0x09, 0x2A, 0x3A, 0x4B, 0x42, 0x4B, 0x42, 0x2A, 0x3A, 0xE9, 0x31, 0xC8, 0x31,
+    0x87, 0x29, 0x46, 0x21, 0xE4, 0x18, 0x83, 0x10, 0x86, 0x93, 0x04, 0x13, 0x20, 0x00, 0xA1, 0x00,
+    0x63, 0x19, 0x46, 0x2A, 0x08, 0x33, 0x8A, 0x43, 0x0C, 0x4C, 0x8E, 0x4C, 0xF0, 0x54, 0x51, 0x55,
+    0x52, 0x4D, 0xCD, 0x33, 0xCC, 0x52, 0x16, 0xA5, 0x36, 0xA5, 0x57, 0xA5, 0x98, 0xB5, 0xA7, 0x31,
+    0xCC, 0x52, 0x6A, 0x42, 0x86, 0x63, 0x05, 0xA3, 0x10, 0x88, 0x29, 0x70, 0x63, 0xB8, 0xAD, 0xD9,
+    0xB5, 0x4B, 0x42, 0x83, 0xB1, 0x08, 0x83, 0xB4, 0x08, 0x80, 0x93, 0x08, 0x01, 0x83, 0x08, 0xBB,
+    0xD6, 0x81, 0xB0, 0x03, 0x82, 0xC9, 0x07, 0x0E, 0xFF, 0xFF, 0xBB, 0xD6, 0x63, 0x00, 0x22, 0x00,
+    0x43, 0x00, 0x01, 0x00, 0x29, 0x42, 0x35, 0xA5, 0x35, 0xA5, 0x55, 0xAD, 0x75, 0xAD, 0x76, 0xAD,
+    0x75, 0xAD, 0x55, 0xAD, 0x4E, 0x6B, 0x81, 0xFC, 0x02, 0x02, 0xA7, 0x31, 0x92, 0x94, 0x9A, 0xD6,
+    0x80, 0xC5, 0x08, 0x80, 0x01, 0x02, 0xDF, 0xFF, 0x5D, 0xEF, 0x96, 0xB5, 0x80, 0xFB, 0x0B, 0x84,
+    0xB2, 0x08, 0x82, 0x92, 0x03, 0x03, 0x08, 0x42, 0x51, 0x8C, 0x18, 0xC6, 0x3C, 0xE7, 0x80, 0x2D,
+    0x83, 0x01, 0x03, 0x7E, 0xF7, 0x9A, 0xD6, 0x14, 0xA5, 0xCB, 0x5A, 0x80, 0xB1, 0x03, 0x84, 0xE5,
+    0x03, 0x02, 0xE8, 0x41, 0x14, 0xA5, 0x34, 0xA5, 0x80, 0x01, 0x80, 0x04, 0x02, 0x55, 0xAD, 0x96,
+    0xB5, 0xAA, 0x52, 0x84, 0xFC, 0x07, 0x04, 0x00, 0x00, 0x61, 0x08, 0xCB, 0x5A, 0x34, 0xA5, 0xBA,
+    0xD6, 0x82, 0x3F, 0x80, 0x01, 0x06, 0x9E, 0xF7, 0x7A, 0xD6, 0x51, 0x8C, 0x45, 0x29, 0x00, 0x00,
+    0xC4, 0x18, 0x7D, 0xEF, 0x81, 0x80, 0x05, 0x81, 0x99, 0x04, 0x01, 0xFF, 0xFF, 0x96, 0xB5, 0x85,
+    0xC9, 0x0B, 0x80, 0xBE, 0x03, 0x03, 0x49, 0x4A, 0xB2, 0x94, 0x39, 0xCE, 0x1C, 0xE7, 0x80, 0x8F,
+    0x05, 0x82, 0x22, 0x04, 0xBF, 0xF7, 0x1C, 0xE7, 0x38, 0xC6, 0x92, 0x94, 0x28, 0x42, 0x83, 0x97,
+    0x02, 0x81, 0x4A, 0x02, 0x0C, 0x63, 0x96, 0xB5, 0x55, 0xAD, 0x82, 0x01, 0x01, 0x75, 0xAD, 0x92,
+    0x94, 0x81, 0x8C, 0x04, 0x03, 0x45, 0x29, 0xCF, 0x7B, 0xF8, 0xBD, 0x3C, 0xE7, 0x82, 0x22, 0x02,
+    0xDF, 0xFF, 0xBA, 0xD6, 0x51, 0x8C, 0x88, 0xE7, 0x08, 0x81, 0x17, 0x02, 0xAE, 0x73, 0x75, 0xAD,
+    0xDB, 0xDE, 0x84, 0x5C, 0x05, 0xDF, 0xFF, 0x9E, 0xF7, 0xDB, 0xDE, 0x96, 0xB5, 0x6E, 0x73, 0xE4,
+    0x20, 0x87, 0x8D, 0x05, 0x81, 0xD5, 0x02, 0x04, 0x25, 0x21, 0x8E, 0x73, 0x75, 0xAD, 0xBA, 0xD6,
+    0x7D, 0xEF, 0x83, 0x56, 0x80, 0x1C, 0x03, 0xFB, 0xDE, 0xD7, 0xBD, 0xEF, 0x7B, 0x65, 0x29, 0x81,
+    0x1C, 0x83, 0x9D, 0x04, 0x10, 0xC4, 0x18, 0xA8, 0x31, 0xED, 0x52, 0x32, 0x7C, 0x36, 0x9D, 0xD9,
+    0xB5, 0xD9, 0xB5, 0xB8, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0xB8, 0xAD, 0x77, 0xA5, 0xB4, 0x94, 0x6F,
+    0x6B, 0xC8, 0x31, 0x83, 0x08, 0x02, 0x00, 0x80, 0x01, 0x82, 0x9A, 0x0A, 0x81, 0x34, 0x80, 0x8A,
+    0x05, 0x02, 0x42, 0x00, 0x26, 0x19, 0xE5, 0x18, 0x85, 0xA6, 0x08, 0x80, 0x97, 0x04, 0x86, 0xBE,
+    0x0C, 0x82, 0xA4, 0x04, 0x82, 0xF7, 0x03, 0x84, 0xC2, 0x08, 0x80, 0x96, 0x0B, 0x80, 0x03, 0x00,
+    0xA3, 0x10, 0x82, 0x93, 0x0E, 0x81, 0x31, 0x80, 0x98, 0x04, 0x81, 0x15, 0x81, 0x1C, 0x80, 0xB7,
+    0x0C, 0x80, 0xA0, 0x08, 0x80, 0xAA, 0x08, 0x80, 0x01, 0x83, 0x2F, 0x84, 0x9F, 0x04, 0x80, 0x98,
+    0x05, 0x00, 0xC4, 0x10, 0x81, 0xB6, 0x01, 0xB5, 0x01, 0x85, 0x99, 0x06, 0x92, 0x9C, 0x04, 0x00,
+    0x21, 0x00, 0x80, 0x60, 0x80, 0xB9, 0x05, 0x81, 0x88, 0x04, 0x81, 0xFB, 0x03, 0x81, 0x93, 0x04,
+    0x80, 0xA2, 0x01, 0x81, 0xDE, 0x0C, 0x81, 0x82, 0x04, 0x80, 0xDD, 0x0E, 0x82, 0xCC, 0x0C, 0x82,
+    0x98, 0x04, 0x81, 0xB1, 0x0A, 0x81, 0x9D, 0x04, 0x80, 0x1B, 0x80, 0xFB, 0x0E, 0x04, 0x05, 0x19,
+    0x46, 0x21, 0x88, 0x29, 0xA8, 0x31, 0xE9, 0x31, 0x80, 0x01, 0x06, 0xC9, 0x31, 0xA8, 0x31, 0x67,
+    0x29, 0x25, 0x21, 0xC4, 0x18, 0x62, 0x08, 0x21, 0x08, 0x85, 0x59, 0x18, 0x41, 0x00, 0xC1, 0x00,
+    0x82, 0x11, 0x43, 0x22, 0x23, 0x3B, 0xC5, 0x43, 0x47, 0x54, 0xCD, 0x44, 0x70, 0x55, 0x91, 0x65,
+    0x91, 0x65, 0x92, 0x55, 0x71, 0x4D, 0x31, 0x45, 0xF0, 0x34, 0x8E, 0x2C, 0x2D, 0x1C, 0xC6, 0x11,
+    0x4F, 0x6B, 0x12, 0x7C, 0x4F, 0x63, 0x2F, 0x63, 0x4A, 0x42, 0x83, 0x10, 0x2A, 0x3A, 0x80, 0xA0,
+    0x09, 0x86, 0x6C, 0x04, 0x83, 0x08, 0xE9, 0x39, 0x77, 0xAD, 0x16, 0x9D, 0xE5, 0x10, 0x81, 0x99,
+    0x04, 0x82, 0xB2, 0x0C, 0x81, 0x98, 0x04, 0x01, 0x01, 0x00, 0x46, 0x21, 0x80, 0x9A, 0x03, 0x82,
+    0xC7, 0x07, 0x81, 0xC9, 0x07, 0x05, 0xB7, 0xB5, 0x01, 0x00, 0x43, 0x00, 0x63, 0x00, 0x00, 0x00,
+    0x92, 0x8C, 0x84, 0xF2, 0x03, 0x04, 0xFF, 0xFF, 0x72, 0x8C, 0x00, 0x00, 0x87, 0x29, 0x75, 0xAD,
+    0x81, 0xDD, 0x02, 0x82, 0x1C, 0x00, 0xBF, 0xF7, 0x81, 0x08, 0x00, 0xEF, 0x7B, 0x81, 0x40, 0x83,
+    0xF6, 0x02, 0x01, 0x2C, 0x63, 0x79, 0xCE, 0x82, 0x1E, 0x00, 0xDF, 0xF7, 0x83, 0x33, 0x82, 0x19,
+    0x02, 0xFF, 0xFF, 0xDB, 0xDE, 0xEC, 0x5A, 0x83, 0xD0, 0x01, 0x01, 0x00, 0x00, 0x92, 0x94, 0x85,
+    0x39, 0x01, 0xFF, 0xFF, 0x2D, 0x63, 0x84, 0xE8, 0x07, 0x01, 0x0C, 0x63, 0xDB, 0xDE, 0x82, 0x9A,
+    0x03, 0x81, 0x28, 0x01, 0xDF, 0xF7, 0xDF, 0xFF, 0x81, 0x27, 0x02, 0x9E, 0xF7, 0xAF, 0x73, 0x87,
+    0x31, 0x80, 0x07, 0x82, 0x4C, 0x80, 0x98, 0x04, 0x00, 0x31, 0x84, 0x81, 0x4B, 0x81, 0x8C, 0x09,
+    0x02, 0x62, 0x08, 0x8E, 0x73, 0xBA, 0xD6, 0x83, 0xBC, 0x03, 0x83, 0x16, 0x00, 0xDF, 0xF7, 0x82,
+    0x0B, 0x01, 0x59, 0xCE, 0x6A, 0x4A, 0x80, 0x1A, 0x81, 0xA9, 0x03, 0x01, 0x00, 0x00, 0xF8, 0xBD,
+    0x85, 0x49, 0x00, 0x9A, 0xD6, 0x80, 0xC6, 0x05, 0x00, 0xD3, 0x9C, 0x81, 0xFD, 0x03, 0x86, 0x83,
+    0x01, 0x00, 0x5D, 0xEF, 0x80, 0x9D, 0x05, 0x85, 0x96, 0x04, 0x01, 0xE8, 0x41, 0x76, 0xB5, 0x82,
+    0x98, 0x05, 0x80, 0x18, 0x81, 0x82, 0x01, 0x00, 0xDF, 0xF7, 0x80, 0x5E, 0x81, 0x0B, 0x01, 0x7D,
+    0xEF, 0x50, 0x8C, 0x80, 0x94, 0x06, 0x85, 0xB3, 0x04, 0x02, 0x25, 0x21, 0xD3, 0x9C, 0x5D, 0xEF,
+    0x84, 0x1C, 0x82, 0x85, 0x05, 0x82, 0x1C, 0x02, 0xBE, 0xF7, 0x34, 0xA5, 0x24, 0x21, 0x83, 0x1C,
+    0x83, 0xFD, 0x01, 0x03, 0xC4, 0x10, 0x09, 0x3A, 0x90, 0x6B, 0xD5, 0x94, 0x81, 0x97, 0x04, 0x00,
+    0x36, 0x9D, 0x80, 0xD8, 0x0C, 0x04, 0x97, 0xAD, 0x15, 0x9D, 0xF1, 0x73, 0x2A, 0x3A, 0xA5, 0x08,
+    0x81, 0x9A, 0x04, 0x01, 0x43, 0x00, 0x43, 0x00, 0x82, 0xA0, 0x06, 0x01, 0xE6, 0x18, 0x06, 0x19,
+    0x83, 0xFD, 0x03, 0x83, 0xC6, 0x0C, 0x81, 0x98, 0x04, 0x83, 0x9A, 0x04, 0x81, 0xD6, 0x0C, 0x86,
+    0xA3, 0x04, 0x81, 0xB3, 0x0F, 0x81, 0x87, 0x04, 0x80, 0x0D, 0x82, 0xD0, 0x05, 0x81, 0x9C, 0x04,
+    0x01, 0x06, 0x19, 0x06, 0x19, 0x80, 0xFE, 0x02, 0x01, 0xE5, 0x18, 0xC5, 0x10, 0x81, 0xAA, 0x04,
+    0x01, 0xA4, 0x08, 0xA4, 0x08, 0x81, 0x99, 0x04, 0x82, 0xC2, 0x04, 0x88, 0xB0, 0x08, 0x80, 0x9A,
+    0x03, 0x00, 0x83, 0x08, 0xBE, 0x98, 0x04, 0x81, 0xE5, 0x03, 0x82, 0xA8, 0x0E, 0x8E, 0x1E, 0x00,
+    0x42, 0x08, 0x80, 0x9C, 0x0C, 0x01, 0xC4, 0x18, 0x83, 0x10, 0x80, 0x17, 0x81, 0x96, 0x0A, 0x81,
+    0xD2, 0x0D, 0x81, 0xF1, 0x0D, 0x81, 0xB8, 0x08, 0x82, 0xA2, 0x0A, 0x81, 0xAA, 0x08, 0x81, 0x97,
+    0x04, 0x81, 0xBF, 0x0C, 0x0C, 0xA3, 0x10, 0xE4, 0x18, 0x05, 0x19, 0x26, 0x21, 0x47, 0x21, 0x67,
+    0x29, 0x67, 0x29, 0x67, 0x21, 0x67, 0x21, 0x46, 0x21, 0x26, 0x21, 0x05, 0x19, 0xC4, 0x10, 0x80,
+    0x1D, 0x85, 0x92, 0x0D, 0x1E, 0x21, 0x00, 0x61, 0x00, 0xC2, 0x08, 0x62, 0x11, 0x43, 0x2A, 0x24,
+    0x43, 0x05, 0x5C, 0xE7, 0x7C, 0xA9, 0x95, 0x4C, 0xAE, 0xAD, 0xBE, 0xCF, 0xCE, 0x10, 0xDF, 0x52,
+    0x86, 0x31, 0x2D, 0xEF, 0x34, 0x6E, 0x2C, 0x0C, 0x24, 0xCB, 0x13, 0x8A, 0x13, 0x49, 0x0B, 0x29,
+    0x03, 0x49, 0x03, 0x87, 0x02, 0xC4, 0x10, 0xA9, 0x31, 0x88, 0x29, 0x68, 0x29, 0xA9, 0x31, 0xA3,
+    0x10, 0x06, 0x19, 0x80, 0xC5, 0x05, 0x81, 0x84, 0x09, 0x80, 0xDC, 0x04, 0x83, 0x2D, 0x02, 0x67,
+    0x29, 0x98, 0xAD, 0xCD, 0x52, 0x81, 0xAA, 0x06, 0x82, 0xAC, 0x08, 0x00, 0x42, 0x00, 0x80, 0x96,
+    0x02, 0x80, 0xA1, 0x08, 0x84, 0xF9, 0x02, 0x81, 0xB1, 0x03, 0x02, 0x52, 0x84, 0x01, 0x00, 0x63,
+    0x00, 0x80, 0x0F, 0x00, 0xB7, 0xB5, 0x82, 0xD6, 0x0C, 0x80, 0xD7, 0x0C, 0x02, 0xFF, 0xFF, 0x6A,
+    0x4A, 0x2D, 0x63, 0x80, 0xFC, 0x02, 0x80, 0xF0, 0x06, 0x83, 0xDE, 0x02, 0x82, 0xFD, 0x0B, 0x80,
+    0x10, 0x82, 0xC7, 0x0B, 0x02, 0x00, 0x00, 0xC3, 0x18, 0xD7, 0xBD, 0x81, 0xDC, 0x07, 0x82, 0x15,
+    0x81, 0x17, 0x84, 0xE6, 0x08, 0x80, 0x37, 0x81, 0xE9, 0x03, 0x82, 0xF7, 0x02, 0x00, 0x76, 0xAD,
+    0x80, 0xFC, 0x03, 0x82, 0x10, 0x80, 0xE2, 0x03, 0x00, 0xC7, 0x31, 0x81, 0xE0, 0x01, 0x80, 0xAD,
+    0x08, 0x00, 0x55, 0xAD, 0x81, 0x92, 0x03, 0x85, 0x3E, 0x81, 0x28, 0x81, 0x26, 0x01, 0x18, 0xC6,
+    0xBE, 0xF7, 0x81, 0x68, 0x81, 0x86, 0x04, 0x01, 0xFF, 0xFF, 0xCB, 0x5A, 0x83, 0xA3, 0x0D, 0x00,
+    0xA7, 0x31, 0x80, 0xD7, 0x0C, 0x81, 0x4A, 0x82, 0x93, 0x04, 0x82, 0x20, 0x82, 0x01, 0x81, 0xC5,
+    0x03, 0x00, 0x4D, 0x6B, 0x81, 0x65, 0x01, 0x01, 0x00, 0x42, 0x08, 0x80, 0xD1, 0x04, 0x83, 0x37,
+    0x03, 0xFF, 0xFF, 0x92, 0x8C, 0xE7, 0x39, 0xFC, 0xE6, 0x80, 0x83, 0x01, 0x86, 0x82, 0x01, 0x81,
+    0x84, 0x01, 0x00, 0x9E, 0xF7, 0x80, 0xF5, 0x08, 0x82, 0x69, 0x01, 0x20, 0x00, 0x72, 0x94, 0x81,
+    0xF8, 0x03, 0x83, 0x32, 0x84, 0xB8, 0x01, 0x81, 0x3F, 0x81, 0x5E, 0x80, 0xCE, 0x0C, 0x83, 0xFD,
+    0x03, 0x00, 0x0C, 0x63, 0x81, 0xC9, 0x04, 0x84, 0x4F, 0x84, 0x21, 0x82, 0x57, 0x02, 0x5D, 0xEF,
+    0x08, 0x42, 0x42, 0x00, 0x80, 0xE0, 0x06, 0x81, 0x98, 0x04, 0x84, 0x84, 0x0E, 0x08, 0x42, 0x00,
+    0x87, 0x29, 0x2E, 0x5B, 0xB4, 0x8C, 0x97, 0xA5, 0x98, 0xAD, 0x56, 0x9D, 0x16, 0x9D, 0x57, 0x9D,
+    0x80, 0xD5, 0x0C, 0x02, 0x15, 0x9D, 0x6F, 0x63, 0x47, 0x21, 0x80, 0x9A, 0x04, 0x00, 0x23, 0x00,
+    0x81, 0x8B, 0x02, 0x80, 0xF9, 0x0A, 0x83, 0xAC, 0x0C, 0x81, 0x99, 0x04, 0x81, 0x03, 0x82, 0xE6,
+    0x03, 0x82, 0x9C, 0x04, 0x02, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0x82, 0xA8, 0x04, 0x80, 0x0A,
+    0x82, 0xB6, 0x08, 0x83, 0xFF, 0x03, 0x81, 0x9B, 0x0A, 0x82, 0x82, 0x06, 0x05, 0x42, 0x00, 0x26,
+    0x21, 0xC5, 0x10, 0xC5, 0x10, 0xE5, 0x10, 0xE5, 0x18, 0x80, 0x9C, 0x04, 0x80, 0x06, 0x82, 0x9C,
+    0x04, 0x82, 0x22, 0x84, 0x98, 0x04, 0x82, 0xA4, 0x04, 0x81, 0x98, 0x04, 0x00, 0xA4, 0x10, 0xB6,
+    0x97, 0x04, 0x83, 0x8E, 0x09, 0x83, 0x98, 0x0C, 0x81, 0x9C, 0x03, 0x81, 0xFD, 0x03, 0x80, 0x92,
+    0x0E, 0x89, 0x9D, 0x0F, 0x82, 0x01, 0x01, 0x41, 0x00, 0xA3, 0x10, 0x80, 0xFA, 0x03, 0x00, 0xE5,
+    0x18, 0x80, 0xCB, 0x01, 0x83, 0xB1, 0x08, 0x81, 0xA1, 0x09, 0x80, 0x9C, 0x08, 0x00, 0xC4, 0x18,
+    0x80, 0x9B, 0x01, 0x81, 0x9A, 0x04, 0x83, 0x93, 0x04, 0x01, 0x25, 0x21, 0x26, 0x21, 0x80, 0x8F,
+    0x04, 0x01, 0x26, 0x21, 0x26, 0x19, 0x80, 0xAF, 0x05, 0x80, 0xB7, 0x09, 0x82, 0xC9, 0x0E, 0x85,
+    0x30, 0x13, 0x82, 0x00, 0x03, 0x09, 0xC5, 0x19, 0x87, 0x2A, 0x48, 0x33, 0x0A, 0x4C, 0xEB, 0x6C,
+    0x0C, 0xA6, 0x8D, 0xC6, 0xEF, 0xCE, 0x10, 0xDF, 0x32, 0xDF, 0x32, 0xE7, 0x32, 0xDF, 0x31, 0xDF,
+    0x0E, 0xD7, 0xAB, 0xBE, 0x0A, 0x34, 0x29, 0x03, 0x08, 0x0B, 0x80, 0x01, 0x06, 0x29, 0x0B, 0x29,
+    0x0B, 0x49, 0x0B, 0x69, 0x0B, 0x49, 0x0B, 0x04, 0x09, 0x06, 0x21, 0x80, 0x2F, 0x00, 0x47, 0x21,
+    0x80, 0xBF, 0x01, 0x81, 0xD1, 0x0E, 0x88, 0x01, 0x02, 0x6B, 0x4A, 0x94, 0x8C, 0x84, 0x08, 0x82,
+    0x97, 0x04, 0x80, 0x01, 0x80, 0x97, 0x04, 0x02, 0x43, 0x00, 0x00, 0x00, 0x4E, 0x63, 0x80, 0xE5,
+    0x02, 0x81, 0xD2, 0x07, 0x81, 0xB4, 0x03, 0x01, 0xFF, 0xFF, 0x0D, 0x5B, 0x80, 0x98, 0x04, 0x01,
+    0x22, 0x00, 0x62, 0x08, 0x80, 0xD6, 0x0C, 0x82, 0x0C, 0x01, 0xDF, 0xFF, 0x7E, 0xEF, 0x80, 0xA0,
+    0x04, 0x82, 0x9E, 0x03, 0x83, 0x92, 0x07, 0x83, 0xA5, 0x03, 0x00, 0x76, 0xAD, 0x81, 0xCC, 0x07,
+    0x01, 0x00, 0x00, 0x82, 0x08, 0x80, 0xAD, 0x08, 0x00, 0xDF, 0xF7, 0x84, 0x8F, 0x03, 0x83, 0xEB,
+    0x07, 0x82, 0xC8, 0x07, 0x01, 0xBF, 0xFF, 0xBF, 0xFF, 0x80, 0xF9, 0x02, 0x81, 0xE8, 0x07, 0x80,
+    0xD3, 0x01, 0x00, 0x7A, 0xD6, 0x85, 0xA7, 0x0C, 0x01, 0x5D, 0xEF, 0xC3, 0x10, 0x80, 0xDD, 0x03,
+    0x80, 0x10, 0x80, 0x3F, 0x82, 0xCB, 0x03, 0x83, 0xAE, 0x08, 0x83, 0x95, 0x08, 0x82, 0xFB, 0x08,
+    0x80, 0x49, 0x81, 0x5B, 0x80, 0x03, 0x00, 0xA7, 0x31, 0x81, 0x98, 0x04, 0x80, 0x97, 0x04, 0x80,
+    0xD6, 0x0C, 0x83, 0x1F, 0x82, 0x19, 0x84, 0x21, 0x82, 0xB3, 0x04, 0x01, 0xDF, 0xFF, 0xE8, 0x39,
+    0x81, 0x3C, 0x00, 0x25, 0x21, 0x81, 0x91, 0x05, 0x82, 0x01, 0x01, 0xFF, 0xFF, 0x39, 0xC6, 0x85,
+    0xFA, 0x0C, 0x83, 0xBC, 0x04, 0x81, 0x04, 0x01, 0xFF, 0xFF, 0x51, 0x84, 0x81, 0xFC, 0x03, 0x80,
+    0x5B, 0x80, 0xF2, 0x04, 0x80, 0x96, 0x04, 0x84, 0x91, 0x04, 0x84, 0xD0, 0x09, 0x80, 0x03, 0x82,
+    0xB5, 0x08, 0x00, 0xD2, 0x94, 0x83, 0xB4, 0x04, 0x00, 0x4D, 0x6B, 0x82, 0xB6, 0x01, 0x83, 0x98,
+    0x01, 0x86, 0xA1, 0x01, 0x82, 0x93, 0x01, 0x01, 0x9A, 0xD6, 0x82, 0x10, 0x80, 0xF3, 0x0E, 0x00,
+    0x05, 0x19, 0x80, 0xD5, 0x0A, 0x81, 0xB0, 0x02, 0x82, 0xEF, 0x07, 0x81, 0x9B, 0x04, 0x0B, 0xA8,
+    0x29, 0x6F, 0x63, 0x16, 0x9D, 0xD8, 0xAD, 0x98, 0xAD, 0x36, 0x9D, 0xF6, 0x94, 0x16, 0x95, 0x97,
+    0xA5, 0x77, 0xA5, 0xF1, 0x73, 0xC8, 0x31, 0x80, 0xC5, 0x0C, 0x01, 0x01, 0x00, 0xA4, 0x10, 0x80,
+    0xE9, 0x03, 0x84, 0x97, 0x04, 0x83, 0xCA, 0x0C, 0x82, 0x01, 0x81, 0xF9, 0x02, 0x80, 0x98, 0x04,
+    0x00, 0xA3, 0x18, 0x83, 0x98, 0x04, 0x83, 0xAF, 0x04, 0x83, 0x93, 0x08, 0x00, 0xA3, 0x10, 0x80,
+    0x98, 0x04, 0x80, 0xB4, 0x03, 0x81, 0x98, 0x04, 0x00, 0x63, 0x08, 0x83, 0xC6, 0x04, 0x83, 0x93,
+    0x04, 0x84, 0x01, 0x85, 0x0A, 0x82, 0x97, 0x04, 0x80, 0x01, 0x01, 0xA4, 0x08, 0xC4, 0x10, 0x8F,
+    0xEA, 0x07, 0x9F, 0x01, 0x00, 0x20, 0x00, 0x80, 0x56, 0x81, 0xB2, 0x07, 0x85, 0x98, 0x04, 0x82,
+    0x9A, 0x0C, 0x82, 0x9D, 0x03, 0x80, 0x9A, 0x04, 0x80, 0x50, 0x01, 0x62, 0x08, 0x41, 0x00, 0x82,
+    0x9B, 0x04, 0x82, 0xA8, 0x0B, 0x85, 0xBB, 0x04, 0x04, 0x83, 0x08, 0x26, 0x21, 0xA8, 0x29, 0x87,
+    0x29, 0xE5, 0x18, 0x80, 0xB2, 0x04, 0x80, 0x8C, 0x01, 0x82, 0xC8, 0x0D, 0x04, 0xA4, 0x10, 0xC5,
+    0x10, 0x06, 0x19, 0x26, 0x21, 0x06, 0x21, 0x80, 0x88, 0x01, 0x80, 0xDC, 0x01, 0x80, 0xE3, 0x03,
+    0x80, 0xA3, 0x08, 0x00, 0xE4, 0x18, 0x81, 0xA4, 0x08, 0x80, 0x3B, 0x86, 0x28, 0x81, 0xD2, 0x0C,
+    0x1E, 0x25, 0x19, 0xC6, 0x21, 0x45, 0x4B, 0xA6, 0x6C, 0x6C, 0x44, 0x4F, 0x34, 0xCF, 0x54, 0x10,
+    0x5D, 0x51, 0x6D, 0x93, 0x75, 0x13, 0x96, 0xF2, 0xCE, 0x10, 0xD7, 0xCF, 0xCE, 0xCD, 0xC6, 0xAB,
+    0xBE, 0x69, 0xAE, 0x27, 0xA6, 0xE5, 0x95, 0x05, 0x96, 0xE7, 0x64, 0x28, 0x03, 0x28, 0x0B, 0x49,
+    0x0B, 0x49, 0x0B, 0x69, 0x13, 0x49, 0x13, 0x28, 0x13, 0x08, 0x13, 0x66, 0x0A, 0xE3, 0x08, 0x81,
+    0xD5, 0x05, 0x00, 0x83, 0x08, 0x80, 0xFC, 0x01, 0x80, 0x2A, 0x00, 0x42, 0x00, 0x82, 0x92, 0x02,
+    0x80, 0x62, 0x02, 0x62, 0x08, 0x84, 0x08, 0xA4, 0x08, 0x80, 0x07, 0x02, 0xF1, 0x7B, 0x67, 0x29,
+    0x02, 0x00, 0x81, 0xAD, 0x08, 0x82, 0x97, 0x04, 0x80, 0x98, 0x04, 0x00, 0x31, 0x84, 0x84, 0x86,
+    0x03, 0x81, 0x01, 0x05, 0xC8, 0x31, 0x02, 0x00, 0x63, 0x00, 0x02, 0x00, 0x25, 0x21, 0x7E, 0xEF,
+    0x85, 0x0F, 0x81, 0x07, 0x88, 0xB2, 0x03, 0x81, 0x0C, 0x00, 0x9A, 0xD6, 0x82, 0xFA, 0x0F, 0x00,
+    0x14, 0xA5, 0x82, 0xA9, 0x03, 0x81, 0xA4, 0x0B, 0x82, 0xD6, 0x0B, 0x00, 0x1C, 0xE7, 0x81, 0xB0,
+    0x0B, 0x85, 0x1C, 0x00, 0xD7, 0xBD, 0x81, 0xC2, 0x0F, 0x00, 0xE4, 0x20, 0x81, 0xE9, 0x03, 0x80,
+    0xA5, 0x04, 0x81, 0xDC, 0x03, 0x00, 0x59, 0xCE, 0x82, 0xBD, 0x03, 0x00, 0xF0, 0x7B, 0x80, 0x0D,
+    0x83, 0xE4, 0x0B, 0x82, 0xA0, 0x03, 0x02, 0xBE, 0xF7, 0x5D, 0xEF, 0x5D, 0xEF, 0x82, 0xC1, 0x03,
+    0x86, 0x49, 0x01, 0x3D, 0xE7, 0xC3, 0x10, 0x80, 0xC5, 0x0D, 0x01, 0x01, 0x00, 0x62, 0x08, 0x80,
+    0x94, 0x08, 0x86, 0xDA, 0x03, 0x03, 0x5D, 0xEF, 0x7A, 0xCE, 0x39, 0xC6, 0x7A, 0xCE, 0x87, 0x75,
+    0x80, 0xFE, 0x04, 0x01, 0x02, 0x00, 0x00, 0x00, 0x81, 0xC1, 0x09, 0x86, 0x83, 0x01, 0x82, 0x69,
+    0x82, 0xD1, 0x04, 0x81, 0xFB, 0x03, 0x81, 0x4E, 0x82, 0x68, 0x80, 0x5B, 0x00, 0x51, 0x8C, 0x81,
+    0xEF, 0x03, 0x83, 0xFD, 0x0C, 0x82, 0x5A, 0x80, 0x39, 0x86, 0x3A, 0x01, 0x5D, 0xEF, 0xA2, 0x10,
+    0x80, 0xE3, 0x01, 0x01, 0x00, 0x00, 0x29, 0x4A, 0x81, 0x84, 0x09, 0x81, 0x1E, 0x81, 0x57, 0x04,
+    0x9E, 0xF7, 0xBB, 0xD6, 0x39, 0xC6, 0x59, 0xCE, 0xFB, 0xDE, 0x81, 0xF0, 0x0D, 0x84, 0x1D, 0x80,
+    0xEF, 0x04, 0x80, 0x86, 0x09, 0x04, 0xC4, 0x10, 0x26, 0x21, 0x67, 0x29, 0x46, 0x21, 0xA3, 0x10,
+    0x87, 0x9B, 0x04, 0x0D, 0x83, 0x08, 0x2A, 0x42, 0x52, 0x84, 0xB8, 0xAD, 0xD9, 0xAD, 0x36, 0x9D,
+    0xD5, 0x8C, 0xD5, 0x8C, 0x57, 0x9D, 0x77, 0xA5, 0x53, 0x84, 0x09, 0x3A, 0x63, 0x08, 0x84, 0x08,
+    0x84, 0xC4, 0x0C, 0x82, 0xB9, 0x0C, 0x84, 0xCD, 0x0C, 0x83, 0x0C, 0x80, 0x97, 0x04, 0x01, 0xC3,
+    0x18, 0xA3, 0x18, 0x82, 0x08, 0x82, 0xB3, 0x0B, 0x84, 0x01, 0x80, 0xDD, 0x06, 0x82, 0xB8, 0x03,
+    0x02, 0x01, 0x00, 0x83, 0x10, 0x26, 0x19, 0x87, 0x94, 0x04, 0x80, 0xC9, 0x0C, 0x88, 0x9D, 0x04,
+    0x82, 0x01, 0x81, 0x9D, 0x04, 0x01, 0xA4, 0x08, 0xE5, 0x10, 0x8B, 0x84, 0x07, 0xA5, 0x01, 0x02,
+    0x21, 0x00, 0x41, 0x08, 0x41, 0x08, 0x83, 0xA3, 0x0D, 0x86, 0xCA, 0x0C, 0x81, 0xC9, 0x0C, 0x82,
+    0x89, 0x08, 0x81, 0xAC, 0x09, 0x80, 0xA9, 0x0C, 0x80, 0xB5, 0x01, 0x81, 0x18, 0x86, 0x29, 0x05,
+    0x01, 0x00, 0x83, 0x08, 0x46, 0x21, 0xE9, 0x39, 0xE9, 0x39, 0x26, 0x21, 0x81, 0xA9, 0x05, 0x84,
+    0x76, 0x81, 0x9A, 0x04, 0x06, 0x26, 0x19, 0xE5, 0x18, 0xE5, 0x10, 0xE4, 0x18, 0xA4, 0x10, 0x82,
+    0x08, 0x41, 0x08, 0x86, 0xB8, 0x0C, 0x27, 0x62, 0x08, 0xA3, 0x08, 0xC4, 0x10, 0xE5, 0x10, 0x26,
+    0x19, 0x87, 0x21, 0xC8, 0x29, 0x4A, 0x3A, 0xCC, 0x52, 0x6E, 0x63, 0xF0, 0x73, 0x2F, 0x9D, 0xEF,
+    0xFF, 0xB2, 0xE7, 0x91, 0x65, 0x31, 0x55, 0x31, 0x65, 0x10, 0x65, 0xAF, 0x54, 0x4E, 0x3C, 0x8B,
+    0x5C, 0x06, 0xA6, 0xE5, 0x95, 0xC4, 0x8D, 0xC4, 0x8D, 0xA4, 0x85, 0xA5, 0x85, 0xA5, 0x85, 0xC4,
+    0x8D, 0x86, 0x7D, 0x88, 0x0B, 0x08, 0x0B, 0xC7, 0x12, 0x86, 0x12, 0x05, 0x0A, 0xA4, 0x09, 0x23,
+    0x09, 0xC2, 0x08, 0x82, 0x00, 0x62, 0x00, 0x83, 0x90, 0x04, 0x80, 0x01, 0x80, 0x87, 0x04, 0x81,
+    0xCC, 0x05, 0x0A, 0x84, 0x08, 0xA5, 0x10, 0xE6, 0x18, 0xA9, 0x29, 0xAD, 0x4A, 0x94, 0x8C, 0xD5,
+    0x94, 0xC3, 0x18, 0x4A, 0x4A, 0x0A, 0x3A, 0x01, 0x00, 0x80, 0x98, 0x04, 0x82, 0xCB, 0x0C, 0x81,
+    0x98, 0x04, 0x00, 0x35, 0xA5, 0x86, 0xDA, 0x02, 0x05, 0x3C, 0xE7, 0xE5, 0x10, 0x22, 0x00, 0x63,
+    0x00, 0x01, 0x00, 0xE9, 0x39, 0x88, 0x8A, 0x04, 0x04, 0xFF, 0xFF, 0x1C, 0xE7, 0x35, 0xA5, 0xD0,
+    0x7B, 0xF0, 0x7B, 0x80, 0xEE, 0x0B, 0x85, 0x0E, 0x00, 0xDB, 0xDE, 0x81, 0x8A, 0x0B, 0x00, 0x6A,
+    0x4A, 0x81, 0xA3, 0x03, 0x83, 0xEA, 0x02, 0x07, 0xFF, 0xFF, 0x14, 0x9D, 0xC7, 0x39, 0xE4, 0x18,
+    0xA3, 0x10, 0xC4, 0x18, 0xAB, 0x52, 0x3C, 0xE7, 0x83, 0x1D, 0x81, 0xDB, 0x03, 0x00, 0xC4, 0x18,
+    0x80, 0x1C, 0x00, 0xE8, 0x39, 0x86, 0x29, 0x00, 0xF4, 0x9C, 0x81, 0xA5, 0x04, 0x00, 0xC3, 0x18,
+    0x80, 0xA5, 0x04, 0x86, 0x46, 0x06, 0x76, 0xAD, 0x6A, 0x4A, 0x25, 0x21, 0xC4, 0x18, 0xC3, 0x18,
+    0x86, 0x31, 0x8E, 0x73, 0x81, 0xA4, 0x03, 0x85, 0x86, 0x08, 0x00, 0x59, 0xCE, 0x80, 0xDC, 0x03,
+    0x80, 0x94, 0x08, 0x00, 0xCF, 0x7B, 0x86, 0x2E, 0x02, 0x7A, 0xCE, 0xAB, 0x52, 0xC4, 0x18, 0x80,
+    0xF3, 0x01, 0x02, 0x21, 0x00, 0x04, 0x21, 0x75, 0xAD, 0x85, 0xD5, 0x08, 0x01, 0xFB, 0xDE, 0x62,
+    0x08, 0x83, 0xF4, 0x07, 0x84, 0x1D, 0x81, 0x8A, 0x09, 0x04, 0x9E, 0xF7, 0x96, 0xB5, 0xF0, 0x7B,
+    0x6E, 0x6B, 0xD3, 0x94, 0x87, 0xD3, 0x04, 0x00, 0x79, 0xCE, 0x81, 0xCB, 0x01, 0x00, 0x66, 0x31,
+    0x82, 0xB2, 0x05, 0x83, 0x0E, 0x06, 0x38, 0xC6, 0xAB, 0x52, 0x45, 0x29, 0xE4, 0x18, 0xE4, 0x18,
+    0x28, 0x42, 0x38, 0xC6, 0x86, 0x0F, 0x00, 0x08, 0x42, 0x80, 0xE4, 0x01, 0x01, 0x62, 0x08, 0xBA,
+    0xD6, 0x86, 0x77, 0x02, 0x10, 0x84, 0x25, 0x21, 0x41, 0x08, 0x81, 0x0F, 0x00, 0x49, 0x4A, 0x80,
+    0xBB, 0x05, 0x84, 0x1C, 0x80, 0xA0, 0x0D, 0x82, 0x84, 0x02, 0x05, 0x42, 0x08, 0xE4, 0x18, 0x87,
+    0x29, 0xE9, 0x39, 0xA8, 0x31, 0xC4, 0x18, 0x82, 0x9D, 0x06, 0x83, 0xE7, 0x02, 0x0B, 0x66, 0x29,
+    0xD0, 0x73, 0x98, 0xAD, 0xD9, 0xAD, 0x16, 0x95, 0xB5, 0x8C, 0xB5, 0x8C, 0x36, 0x9D, 0x77, 0xA5,
+    0xD4, 0x94, 0xCC, 0x52, 0x84, 0x08, 0x80, 0xEE, 0x02, 0x81, 0x8D, 0x04, 0x82, 0xA7, 0x08, 0x82,
+    0x01, 0x82, 0x88, 0x04, 0x81, 0x8D, 0x04, 0x01, 0xC4, 0x18, 0xC4, 0x20, 0x82, 0xC9, 0x0C, 0x84,
+    0x01, 0x83, 0x1B, 0x01, 0x83, 0x08, 0x41, 0x00, 0x83, 0x98, 0x04, 0x02, 0x00, 0x00, 0xA4, 0x10,
+    0x06, 0x19, 0x89, 0x8C, 0x04, 0x88, 0xE9, 0x08, 0x86, 0xA3, 0x04, 0x80, 0xCF, 0x07, 0xB1, 0x98,
+    0x04, 0x83, 0x9A, 0x04, 0x82, 0x9B, 0x04, 0x86, 0xC9, 0x0C, 0x87, 0x99, 0x04, 0x01, 0xC4, 0x10,
+    0xC4, 0x18, 0x80, 0x9C, 0x0C, 0x81, 0xD2, 0x0C, 0x88, 0x85, 0x09, 0x05, 0x01, 0x00, 0x63, 0x08,
+    0x67, 0x29, 0x4B, 0x42, 0x2A, 0x42, 0x67, 0x29, 0x80, 0x79, 0x82, 0x88, 0x05, 0x81, 0xCB, 0x0D,
+    0x02, 0xE5, 0x10, 0x05, 0x19, 0xA4, 0x10, 0x87, 0xA6, 0x08, 0x80, 0x2D, 0x19, 0x05, 0x19, 0x47,
+    0x21, 0xA9, 0x29, 0xE9, 0x31, 0x2B, 0x3A, 0x8C, 0x4A, 0xED, 0x52, 0x4F, 0x63, 0xD0, 0x73, 0x32,
+    0x7C, 0x73, 0x8C, 0xB4, 0x94, 0xD4, 0x94, 0x94, 0x94, 0x32, 0xC6, 0xCF, 0xF7, 0x0C, 0x9E, 0xAB,
+    0x2B, 0x6B, 0x23, 0x29, 0x13, 0xE8, 0x12, 0xE9, 0x0A, 0x08, 0x0B, 0xC5, 0x64, 0xA4, 0x85, 0x85,
+    0x7D, 0x80, 0x96, 0x04, 0x08, 0x85, 0x7D, 0x45, 0x75, 0xE4, 0x6C, 0x24, 0x54, 0x04, 0x0A, 0x43,
+    0x01, 0x02, 0x09, 0xC2, 0x08, 0x82, 0x08, 0x80, 0x94, 0x04, 0x85, 0x95, 0x04, 0x81, 0x97, 0x04,
+    0x80, 0x94, 0x04, 0x80, 0xDB, 0x04, 0x0A, 0x68, 0x21, 0x4B, 0x42, 0x4F, 0x63, 0x53, 0x84, 0x16,
+    0x9D, 0x16, 0x9D, 0x73, 0x8C, 0x73, 0x8C, 0xC8, 0x39, 0x66, 0x29, 0x6B, 0x42, 0x80, 0x9C, 0x03,
+    0x82, 0x01, 0x81, 0x99, 0x04, 0x01, 0x22, 0x00, 0x59, 0xCE, 0x86, 0xD9, 0x02, 0x00, 0x39, 0xC6,
+    0x80, 0xA5, 0x04, 0x02, 0x63, 0x00, 0x00, 0x00, 0x0D, 0x5B, 0x86, 0xBF, 0x03, 0x80, 0xD8, 0x07,
+    0x01, 0x8F, 0x73, 0xC4, 0x10, 0x81, 0x9E, 0x07, 0x00, 0x67, 0x29, 0x80, 0xB0, 0x0F, 0x85, 0xB0,
+    0x08, 0x81, 0xF4, 0x08, 0x00, 0x76, 0xAD, 0x86, 0x2B, 0x80, 0xD1, 0x0B, 0x83, 0xB6, 0x0B, 0x00,
+    0x4E, 0x6B, 0x85, 0x1C, 0x00, 0xBE, 0xF7, 0x80, 0xF9, 0x0F, 0x80, 0xD9, 0x0F, 0x86, 0x1C, 0x00,
+    0xCF, 0x7B, 0x81, 0xB8, 0x07, 0x00, 0xEC, 0x62, 0x87, 0xC7, 0x07, 0x00, 0x51, 0x8C, 0x85, 0xB3,
+    0x01, 0x00, 0xC3, 0x18, 0x80, 0xE1, 0x04, 0x85, 0x2D, 0x00, 0x55, 0xAD, 0x80, 0x8C, 0x01, 0x82,
+    0xAF, 0x08, 0x84, 0x0D, 0x01, 0xBA, 0xD6, 0xA3, 0x10, 0x84, 0x4A, 0x00, 0x86, 0x31, 0x84, 0x1E,
+    0x80, 0x9C, 0x05, 0x80, 0x74, 0x01, 0x00, 0x00, 0x92, 0x94, 0x82, 0xF2, 0x0C, 0x83, 0x80, 0x0C,
+    0x01, 0xDF, 0xFF, 0xB3, 0x94, 0x81, 0x59, 0x80, 0x01, 0x80, 0x11, 0x81, 0x10, 0x81, 0x96, 0x0D,
+    0x80, 0xA2, 0x01, 0x81, 0x2A, 0x00, 0x72, 0x8C, 0x87, 0xA5, 0x09, 0x80, 0xA6, 0x03, 0x82, 0x01,
+    0x00, 0xA6, 0x31, 0x80, 0x0B, 0x82, 0x91, 0x0D, 0x80, 0x1D, 0x00, 0x8A, 0x4A, 0x80, 0x0C, 0x00,
+    0xAB, 0x52, 0x86, 0x1C, 0x00, 0x6D, 0x6B, 0x85, 0x76, 0x00, 0x71, 0x8C, 0x85, 0x67, 0x80, 0x94,
+    0x01, 0x82, 0x65, 0x81, 0x01, 0x04, 0x62, 0x08, 0x46, 0x21, 0x4A, 0x42, 0x4A, 0x42, 0x66, 0x29,
+    0x81, 0xB3, 0x04, 0x84, 0xB5, 0x08, 0x0C, 0x05, 0x19, 0x6F, 0x63, 0x57, 0xA5, 0xB8, 0xAD, 0xF5,
+    0x94, 0xB4, 0x8C, 0xB4, 0x8C, 0xD5, 0x94, 0x56, 0x9D, 0xB4, 0x8C, 0x6B, 0x42, 0x63, 0x08, 0x42,
+    0x00, 0x84, 0x97, 0x08, 0x84, 0xA1, 0x08, 0x81, 0x07, 0x82, 0xC7, 0x0C, 0x00, 0xC3, 0x20, 0x87,
+    0x98, 0x04, 0x80, 0x10, 0x82, 0xD3, 0x0F, 0x81, 0xC2, 0x05, 0x81, 0xE5, 0x0B, 0x02, 0x01, 0x00,
+    0xC4, 0x10, 0x06, 0x19, 0x80, 0x95, 0x03, 0x80, 0x85, 0x0B, 0x80, 0x94, 0x03, 0x84, 0xA3, 0x08,
+    0x00, 0xA4, 0x08, 0x80, 0xA2, 0x08, 0x82, 0xC4, 0x0C, 0x01, 0xA4, 0x10, 0x84, 0x10, 0x81, 0xD8,
+    0x0B, 0x01, 0xA4, 0x10, 0xA3, 0x08, 0x80, 0x05, 0x00, 0xA3, 0x08, 0x80, 0xC7, 0x03, 0xB3, 0x98,
+    0x04, 0x82, 0x9A, 0x04, 0x80, 0x89, 0x04, 0x00, 0x41, 0x08, 0x80, 0x94, 0x04, 0x83, 0x96, 0x04,
+    0x83, 0x94, 0x04, 0x81, 0xAD, 0x05, 0x82, 0x62, 0x80, 0x99, 0x04, 0x00, 0xE5, 0x18, 0x81, 0xA4,
+    0x0C, 0x89, 0x9E, 0x0D, 0x80, 0x9A, 0x04, 0x06, 0x87, 0x29, 0xAC, 0x4A, 0xAC, 0x4A, 0xC8, 0x31,
+    0x06, 0x19, 0xC5, 0x10, 0xC5, 0x18, 0x80, 0x19, 0x00, 0x05, 0x19, 0x80, 0x01, 0x00, 0x06, 0x19,
+    0x80, 0xB1, 0x08, 0x82, 0xA2, 0x09, 0x00, 0x41, 0x08, 0x80, 0xBA, 0x0C, 0x22, 0x47, 0x21, 0x06,
+    0x19, 0xA9, 0x31, 0x4B, 0x42, 0x8C, 0x4A, 0xEE, 0x5A, 0x4F, 0x63, 0x90, 0x6B, 0xD1, 0x73, 0xF1,
+    0x7B, 0x12, 0x7C, 0xF1, 0x7B, 0xD1, 0x73, 0x8F, 0x6B, 0x2E, 0x5B, 0xAC, 0x4A, 0x2A, 0x3A, 0x08,
+    0x32, 0x65, 0x95, 0xC3, 0x95, 0x46, 0x1B, 0xC8, 0x02, 0xE8, 0x0A, 0x08, 0x0B, 0x29, 0x13, 0x29,
+    0x0B, 0xE6, 0x3B, 0xE5, 0x6C, 0x84, 0x5C, 0x04, 0x4C, 0x63, 0x3B, 0xC3, 0x2A, 0x03, 0x1A, 0x63,
+    0x09, 0xE3, 0x00, 0x87, 0xA8, 0x08, 0x80, 0x01, 0x00, 0x41, 0x00, 0x81, 0xB1, 0x01, 0x80, 0x93,
+    0x04, 0x0E, 0x0A, 0x3A, 0xCD, 0x52, 0xB0, 0x6B, 0x73, 0x84, 0x16, 0x9D, 0x56, 0xA5, 0xD5, 0x94,
+    0xF1, 0x73, 0x6B, 0x4A, 0x26, 0x21, 0x83, 0x08, 0x42, 0x00, 0x01, 0x00, 0x46, 0x29, 0x4B, 0x42,
+    0x81, 0x98, 0x04, 0x81, 0xB2, 0x08, 0x80, 0x81, 0x01, 0x02, 0x02, 0x00, 0xE4, 0x10, 0x3D, 0xE7,
+    0x81, 0xE9, 0x0F, 0x82, 0x01, 0x02, 0xFF, 0xFF, 0x15, 0xA5, 0x01, 0x00, 0x83, 0xD6, 0x0C, 0x81,
+    0x91, 0x03, 0x81, 0xE8, 0x02, 0x80, 0xE8, 0x07, 0x00, 0xE5, 0x18, 0x80, 0x23, 0x80, 0x10, 0x02,
+    0x22, 0x00, 0xA4, 0x08, 0x1C, 0xE7, 0x81, 0xB1, 0x0F, 0x82, 0x1E, 0x80, 0xC4, 0x0B, 0x01, 0x00,
+    0x00, 0xA3, 0x10, 0x80, 0x0C, 0x84, 0xFD, 0x0B, 0x01, 0x9E, 0xF7, 0x05, 0x19, 0x83, 0xEF, 0x08,
+    0x81, 0x88, 0x03, 0x83, 0xC1, 0x03, 0x02, 0xFF, 0xFF, 0x7D, 0xEF, 0xE4, 0x18, 0x80, 0x1D, 0x83,
+    0x39, 0x82, 0x0D, 0x00, 0x8A, 0x52, 0x81, 0x9C, 0x07, 0x00, 0xD3, 0x9C, 0x82, 0x90, 0x03, 0x82,
+    0x0D, 0x00, 0x1C, 0xE7, 0x80, 0x93, 0x0F, 0x81, 0x92, 0x03, 0x82, 0x95, 0x03, 0x80, 0xFF, 0x0B,
+    0x81, 0x58, 0x82, 0x49, 0x00, 0x31, 0x84, 0x80, 0x98, 0x04, 0x01, 0x00, 0x00, 0x09, 0x42, 0x84,
+    0xFB, 0x0F, 0x80, 0xB1, 0x03, 0x00, 0x10, 0x84, 0x80, 0x0D, 0x00, 0x22, 0x00, 0x82, 0x83, 0x07,
+    0x00, 0x87, 0x31, 0x85, 0xDD, 0x03, 0x01, 0xFC, 0xE6, 0xA3, 0x10, 0x80, 0x2A, 0x00, 0xB7, 0xB5,
+    0x80, 0xA6, 0x08, 0x83, 0x01, 0x01, 0xDF, 0xFF, 0x79, 0xCE, 0x80, 0xFF, 0x0B, 0x83, 0xC2, 0x0A,
+    0x00, 0x2D, 0x63, 0x84, 0x11, 0x02, 0x9E, 0xEF, 0xFF, 0xFF, 0x75, 0xAD, 0x80, 0x10, 0x00, 0x20,
+    0x00, 0x80, 0xC7, 0x05, 0x82, 0x46, 0x00, 0x9E, 0xF7, 0x80, 0x2B, 0x00, 0x69, 0x4A, 0x83, 0x5A,
+    0x04, 0x00, 0x00, 0x45, 0x29, 0x9E, 0xF7, 0xBF, 0xF7, 0x9E, 0xEF, 0x80, 0x01, 0x02, 0x7E, 0xEF,
+    0x9E, 0xEF, 0xDF, 0xFF, 0x81, 0x2D, 0x80, 0x77, 0x83, 0x63, 0x80, 0xA0, 0x01, 0x80, 0x90, 0x01,
+    0x84, 0x75, 0x84, 0x95, 0x01, 0x80, 0x2C, 0x83, 0x98, 0x04, 0x85, 0x8F, 0x02, 0x04, 0xC4, 0x18,
+    0x29, 0x42, 0xED, 0x5A, 0x29, 0x42, 0x82, 0x10, 0x83, 0x59, 0x81, 0xEA, 0x02, 0x0C, 0xC4, 0x10,
+    0x6F, 0x63, 0x97, 0xA5, 0x98, 0xAD, 0xB5, 0x8C, 0x74, 0x84, 0x53, 0x7C, 0x94, 0x8C, 0x36, 0x9D,
+    0x52, 0x84, 0xA8, 0x31, 0x22, 0x00, 0x62, 0x08, 0x83, 0xAF, 0x0C, 0x83, 0xC3, 0x0C, 0x83, 0xB1,
+    0x08, 0x03, 0xA3, 0x18, 0xC3, 0x20, 0xE3, 0x20, 0xC3, 0x20, 0x80, 0x06, 0x00, 0xC4, 0x10, 0x88,
+    0xB2, 0x08, 0x02, 0x62, 0x08, 0x21, 0x08, 0x20, 0x00, 0x81, 0x97, 0x04, 0x80, 0x01, 0x00, 0xE5,
+    0x18, 0x80, 0x98, 0x04, 0x80, 0x95, 0x04, 0x83, 0xB6, 0x0C, 0x83, 0xB0, 0x08, 0x86, 0xCC, 0x0C,
+    0x00, 0x84, 0x08, 0x81, 0x94, 0x04, 0x81, 0x98, 0x04, 0x00, 0x83, 0x08, 0x80, 0xAF, 0x03, 0xB5,
+    0x98, 0x04, 0x81, 0xDE, 0x01, 0x81, 0x9A, 0x04, 0x84, 0x01, 0x80, 0x47, 0x83, 0xB4, 0x09, 0x81,
+    0xD4, 0x0D, 0x84, 0x99, 0x09, 0x01, 0xC4, 0x18, 0xC4, 0x10, 0x89, 0x9E, 0x0D, 0x80, 0xCA, 0x01,
+    0x80, 0xCC, 0x0D, 0x04, 0xC8, 0x31, 0x0D, 0x5B, 0x0D, 0x5B, 0x0A, 0x3A, 0x47, 0x21, 0x80, 0x98,
+    0x04, 0x00, 0x06, 0x19, 0x80, 0x96, 0x04, 0x02, 0x26, 0x21, 0x26, 0x21, 0x67, 0x21, 0x80, 0x09,
+    0x80, 0x96, 0x01, 0x0B, 0x84, 0x10, 0x67, 0x21, 0x26, 0x21, 0x66, 0x29, 0x0A, 0x3A, 0x26, 0x21,
+    0xCD, 0x52, 0x2F, 0x63, 0x4F, 0x63, 0x6F, 0x6B, 0x4F, 0x63, 0x0E, 0x5B, 0x80, 0x92, 0x04, 0x13,
+    0xA8, 0x29, 0x46, 0x21, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x26, 0x19, 0x06, 0x11, 0x05, 0x64,
+    0x43, 0xA6, 0x26, 0x44, 0xE8, 0x02, 0xE8, 0x0A, 0xA7, 0x0A, 0x87, 0x0A, 0x45, 0x0A, 0xE3, 0x11,
+    0xA3, 0x11, 0x42, 0x01, 0xE2, 0x00, 0xA2, 0x00, 0x82, 0x93, 0x04, 0x84, 0x85, 0x02, 0x12, 0x21,
+    0x00, 0xA2, 0x08, 0x04, 0x11, 0x25, 0x19, 0x67, 0x21, 0xA8, 0x29, 0xEA, 0x31, 0x6C, 0x42, 0x2F,
+    0x5B, 0x12, 0x74, 0xF5, 0x94, 0x77, 0xA5, 0x76, 0xA5, 0xD4, 0x94, 0xB0, 0x6B, 0x6B, 0x4A, 0x67,
+    0x29, 0xC5, 0x10, 0x83, 0x08, 0x80, 0xCD, 0x0C, 0x80, 0x9A, 0x0D, 0x02, 0xA4, 0x08, 0x46, 0x21,
+    0x6B, 0x4A, 0x80, 0x7A, 0x82, 0xDA, 0x03, 0x80, 0xFA, 0x03, 0x00, 0x01, 0x00, 0x80, 0x80, 0x0C,
+    0x84, 0x86, 0x03, 0x80, 0xF6, 0x02, 0x01, 0xF0, 0x7B, 0x00, 0x00, 0x80, 0x13, 0x81, 0x93, 0x08,
+    0x82, 0x0C, 0x80, 0xE6, 0x02, 0x00, 0xDB, 0xD6, 0x80, 0xBD, 0x04, 0x00, 0x43, 0x00, 0x81, 0xCE,
+    0x08, 0x80, 0xC2, 0x04, 0x83, 0xF7, 0x02, 0x80, 0xF8, 0x02, 0x01, 0xFF, 0xFF, 0xD3, 0x9C, 0x80,
+    0x4E, 0x81, 0xBD, 0x03, 0x82, 0x1D, 0x80, 0xB1, 0x03, 0x01, 0xFB, 0xDE, 0x83, 0x10, 0x82, 0xD5,
+    0x04, 0x80, 0x2D, 0x00, 0x11, 0x84, 0x83, 0xFE, 0x0F, 0x81, 0xFE, 0x0B, 0x81, 0x82, 0x07, 0x80,
+    0x8A, 0x0C, 0x83, 0x47, 0x02, 0xBF, 0xF7, 0xDF, 0xF7, 0x66, 0x29, 0x81, 0xB7, 0x01, 0x00, 0xF7,
+    0xBD, 0x80, 0xBD, 0x03, 0x83, 0x0E, 0x01, 0xFF, 0xFF, 0x18, 0xC6, 0x83, 0x80, 0x03, 0x82, 0x94,
+    0x03, 0x01, 0x96, 0xB5, 0xFF, 0xFF, 0x82, 0x47, 0x80, 0x01, 0x01, 0xFF, 0xFF, 0x0C, 0x5B, 0x81,
+    0x98, 0x04, 0x80, 0xAB, 0x0C, 0x84, 0x75, 0x01, 0xFF, 0xFF, 0x2D, 0x63, 0x85, 0x98, 0x04, 0x00,
+    0x8A, 0x52, 0x84, 0x11, 0x80, 0xE5, 0x0C, 0x82, 0xCC, 0x08, 0x00, 0xDF, 0xF7, 0x81, 0x28, 0x81,
+    0x03, 0x81, 0xFA, 0x03, 0x83, 0x3C, 0x02, 0x00, 0x00, 0xF0, 0x7B, 0xFF, 0xFF, 0x81, 0x38, 0x82,
+    0x3B, 0x81, 0xFD, 0x08, 0x01, 0xA3, 0x10, 0x3C, 0xE7, 0x80, 0xF6, 0x03, 0x80, 0x82, 0x01, 0x80,
+    0x4A, 0x80, 0x60, 0x00, 0x25, 0x21, 0x80, 0x1E, 0x82, 0x58, 0x00, 0x49, 0x4A, 0x80, 0x3A, 0x82,
+    0x59, 0x80, 0xA6, 0x01, 0x00, 0x04, 0x21, 0x80, 0x1D, 0x00, 0x39, 0xC6, 0x81, 0x46, 0x81, 0x0D,
+    0x01, 0xDF, 0xFF, 0x9A, 0xD6, 0x81, 0x92, 0x0F, 0x83, 0x89, 0x04, 0x00, 0x35, 0xAD, 0x80, 0x11,
+    0x82, 0xBF, 0x01, 0x01, 0xFF, 0xFF, 0xEB, 0x5A, 0x86, 0x9E, 0x05, 0x83, 0x01, 0x03, 0x82, 0x10,
+    0x29, 0x42, 0x6F, 0x6B, 0xCC, 0x5A, 0x81, 0xCA, 0x05, 0x82, 0xE3, 0x03, 0x80, 0x12, 0x0B, 0x05,
+    0x19, 0xF0, 0x7B, 0xF9, 0xB5, 0x57, 0xA5, 0x53, 0x7C, 0x12, 0x74, 0xF2, 0x73, 0x94, 0x84, 0x15,
+    0x9D, 0x6F, 0x6B, 0xC4, 0x10, 0x21, 0x00, 0x80, 0xA0, 0x07, 0x83, 0x99, 0x04, 0x84, 0xBA, 0x08,
+    0x00, 0xA3, 0x18, 0x80, 0x98, 0x04, 0x02, 0xE3, 0x28, 0xC3, 0x20, 0xA3, 0x18, 0x80, 0xCE, 0x0C,
+    0x80, 0x0D, 0x00, 0xC3, 0x10, 0x80, 0x9D, 0x04, 0x80, 0x03, 0x82, 0x99, 0x04, 0x00, 0x21, 0x08,
+    0x81, 0xEC, 0x0B, 0x81, 0x35, 0x00, 0x05, 0x19, 0x80, 0x92, 0x08, 0x84, 0xC6, 0x0B, 0x84, 0x01,
+    0x83, 0x94, 0x04, 0x00, 0x84, 0x08, 0x82, 0x06, 0x81, 0x99, 0x04, 0x81, 0x98, 0x04, 0x00, 0xC4,
+    0x10, 0x80, 0xA5, 0x03, 0xB7, 0x99, 0x04, 0x81, 0x96, 0x01, 0x04, 0x62, 0x08, 0x82, 0x10, 0x82,
+    0x10, 0x83, 0x10, 0x82, 0x08, 0x83, 0xAE, 0x08, 0x82, 0x01, 0x81, 0xA6, 0x09, 0x82, 0x92, 0x01,
+    0x81, 0x99, 0x04, 0x80, 0xE2, 0x06, 0x89, 0x99, 0x04, 0x81, 0xFB, 0x01, 0x04, 0x83, 0x10, 0x09,
+    0x3A, 0x4F, 0x63, 0x4F, 0x63, 0x2B, 0x3A, 0x80, 0xA2, 0x08, 0x80, 0x97, 0x04, 0x06, 0x47, 0x21,
+    0x47, 0x21, 0x67, 0x21, 0x68, 0x29, 0x88, 0x29, 0x47, 0x21, 0x63, 0x08, 0x80, 0x8B, 0x0E, 0x0F,
+    0xC8, 0x29, 0xE5, 0x18, 0x8C, 0x4A, 0x8B, 0x4A, 0x67, 0x29, 0x6B, 0x42, 0xC9, 0x31, 0x67, 0x29,
+    0x26, 0x19, 0xE5, 0x10, 0xC4, 0x10, 0xC4, 0x08, 0xE4, 0x10, 0x05, 0x11, 0x25, 0x19, 0x46, 0x19,
+    0x80, 0x01, 0x0A, 0xE5, 0x10, 0x45, 0x32, 0x64, 0x64, 0xC4, 0x22, 0xA5, 0x01, 0x43, 0x01, 0xE2,
+    0x00, 0xC2, 0x00, 0xA2, 0x00, 0x81, 0x00, 0x61, 0x00, 0x80, 0xD2, 0x05, 0x85, 0xFE, 0x01, 0x11,
+    0x62, 0x08, 0xC3, 0x10, 0x45, 0x19, 0xA6, 0x21, 0x27, 0x2A, 0xA9, 0x32, 0xEC, 0x42, 0x4E, 0x53,
+    0xF1, 0x73, 0xB4, 0x8C, 0x36, 0x9D, 0x56, 0xA5, 0xF5, 0x94, 0x32, 0x84, 0x2E, 0x63, 0x2A, 0x3A,
+    0x47, 0x21, 0xC4, 0x10, 0x80, 0x93, 0x04, 0x81, 0x69, 0x80, 0x04, 0x81, 0xD5, 0x01, 0x01, 0x06,
+    0x19, 0x8B, 0x4A, 0x80, 0xF1, 0x01, 0x80, 0xFF, 0x05, 0x82, 0x99, 0x04, 0x81, 0x8D, 0x07, 0x01,
+    0x5E, 0xEF, 0x7E, 0xEF, 0x80, 0x02, 0x04, 0x5D, 0xEF, 0x5D, 0xEF, 0x5E, 0xEF, 0xFF, 0xFF, 0xAB,
+    0x52, 0x80, 0xA4, 0x03, 0x80, 0xA7, 0x0A, 0x01, 0x9A, 0xCE, 0xDF, 0xFF, 0x80, 0x80, 0x03, 0x00,
+    0x5D, 0xEF, 0x80, 0x02, 0x81, 0x9F, 0x08, 0x83, 0xE9, 0x0C, 0x81, 0x93, 0x08, 0x00, 0x5D, 0xE7,
+    0x83, 0x01, 0x01, 0xFF, 0xFF, 0xAE, 0x73, 0x80, 0x52, 0x80, 0x0C, 0x83, 0x9F, 0x03, 0x01, 0x5D,
+    0xEF, 0xDF, 0xFF, 0x80, 0xD0, 0x0B, 0x84, 0x98, 0x04, 0x08, 0x6E, 0x6B, 0xBA, 0xD6, 0xBA, 0xD6,
+    0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFC, 0xDE, 0x3C, 0xE7, 0x34, 0xA5, 0x81, 0xCF, 0x01, 0x03,
+    0x7A, 0xCE, 0xDF, 0xF7, 0x7E, 0xEF, 0x7D, 0xEF, 0x80, 0x1C, 0x02, 0x5E, 0xEF, 0xBE, 0xF7, 0x1C,
+    0xE7, 0x80, 0x9A, 0x0C, 0x80, 0xDB, 0x03, 0x00, 0xDB, 0xD6, 0x81, 0x46, 0x81, 0x01, 0x80, 0x54,
+    0x80, 0xB5, 0x0C, 0x84, 0xB2, 0x0E, 0x80, 0x13, 0x02, 0xBB, 0xD6, 0x9E, 0xEF, 0x3D, 0xE7, 0x83,
+    0x49, 0x00, 0xDF, 0xF7, 0x80, 0xD8, 0x07, 0x80, 0xB7, 0x02, 0x80, 0xD9, 0x07, 0x85, 0xEA, 0x03,
+    0x00, 0x08, 0x3A, 0x85, 0xC1, 0x03, 0x02, 0x8E, 0x73, 0xFF, 0xFF, 0x5D, 0xEF, 0x81, 0x3E, 0x80,
+    0x77, 0x00, 0x76, 0xAD, 0x80, 0x4A, 0x00, 0x46, 0x29, 0x80, 0x08, 0x84, 0x73, 0x01, 0xBE, 0xF7,
+    0x86, 0x31, 0x85, 0x98, 0x04, 0x00, 0x55, 0xAD, 0x82, 0x84, 0x01, 0x00, 0x3D, 0xE7, 0x80, 0x01,
+    0x81, 0xC6, 0x04, 0x01, 0x00, 0x00, 0xA7, 0x31, 0x80, 0xE8, 0x03, 0x82, 0x59, 0x02, 0x5E, 0xEF,
+    0x9E, 0xF7, 0xDB, 0xD6, 0x84, 0x8A, 0x09, 0x80, 0x98, 0x04, 0x03, 0x1C, 0xE7, 0x1C, 0xDF, 0xFC,
+    0xDE, 0x1C, 0xDF, 0x80, 0x03, 0x01, 0x1C, 0xE7, 0xF7, 0xBD, 0x80, 0x9C, 0x05, 0x02, 0xC3, 0x18,
+    0x5D, 0xEF, 0xBF, 0xF7, 0x82, 0x55, 0x80, 0xAC, 0x01, 0x80, 0xD8, 0x08, 0x82, 0xB9, 0x02, 0x80,
+    0x1C, 0x80, 0x95, 0x01, 0x83, 0x88, 0x01, 0x01, 0x9E, 0xEF, 0xDF, 0xF7, 0x80, 0x4A, 0x8A, 0x98,
+    0x04, 0x81, 0x9C, 0x02, 0x02, 0x29, 0x42, 0xF1, 0x7B, 0x6E, 0x6B, 0x85, 0x9A, 0x04, 0x81, 0x53,
+    0x0A, 0xD4, 0x94, 0xD9, 0xB5, 0x94, 0x84, 0xF1, 0x6B, 0xB0, 0x6B, 0xD1, 0x6B, 0xF5, 0x94, 0xD4,
+    0x94, 0x09, 0x3A, 0x21, 0x00, 0x42, 0x08, 0x84, 0xAE, 0x08, 0x82, 0x8D, 0x04, 0x81, 0xC7, 0x0C,
+    0x03, 0xE3, 0x20, 0x03, 0x29, 0xE3, 0x20, 0xC3, 0x18, 0x80, 0x9E, 0x04, 0x80, 0x08, 0x00, 0xA3,
+    0x10, 0x83, 0xCF, 0x0C, 0x80, 0x98, 0x04, 0x80, 0xB0, 0x08, 0x00, 0x21, 0x08, 0x80, 0x98, 0x04,
+    0x00, 0x42, 0x08, 0x80, 0x04, 0x00, 0x06, 0x21, 0x83, 0x8B, 0x04, 0x82, 0x01, 0x84, 0xB6, 0x08,
+    0x81, 0xB0, 0x08, 0x83, 0x97, 0x04, 0x00, 0xA4, 0x08, 0x82, 0x96, 0x04, 0x81, 0x98, 0x04, 0x00,
+    0x05, 0x19, 0x89, 0xDB, 0x07, 0xB2, 0x9A, 0x04, 0x00, 0x41, 0x08, 0x80, 0x99, 0x04, 0x00, 0x83,
+    0x08, 0x81, 0x9A, 0x04, 0x80, 0x9B, 0x04, 0x83, 0xB1, 0x03, 0x82, 0x98, 0x04, 0x81, 0x97, 0x04,
+    0x01, 0xE5, 0x18, 0x83, 0x08, 0x8B, 0x24, 0x82, 0x99, 0x02, 0x14, 0xC4, 0x10, 0x6B, 0x4A, 0xD1,
+    0x73, 0x90, 0x6B, 0x4B, 0x42, 0x67, 0x21, 0x27, 0x21, 0x67, 0x21, 0x67, 0x29, 0x67, 0x29, 0x68,
+    0x29, 0x68, 0x29, 0x0A, 0x3A, 0xEE, 0x52, 0x05, 0x19, 0x00, 0x00, 0xA4, 0x08, 0xC8, 0x29, 0x26,
+    0x21, 0x2E, 0x5B, 0xC4, 0x10, 0x80, 0x7F, 0x02, 0xC4, 0x10, 0xE5, 0x10, 0xE5, 0x10, 0x80, 0xBA,
+    0x05, 0x01, 0xE5, 0x10, 0xE4, 0x10, 0x80, 0x0A, 0x80, 0xFB, 0x07, 0x80, 0xD7, 0x0B, 0x01, 0xC2,
+    0x00, 0x82, 0x00, 0x81, 0x92, 0x04, 0x86, 0xA8, 0x05, 0x0E, 0x21, 0x00, 0x82, 0x08, 0x04, 0x11,
+    0x65, 0x19, 0xC6, 0x21, 0x48, 0x32, 0xCA, 0x42, 0x4C, 0x53, 0xCF, 0x6B, 0x72, 0x7C, 0xF5, 0x94,
+    0x56, 0xA5, 0x15, 0x9D, 0x93, 0x8C, 0x8F, 0x6B, 0x83, 0xA7, 0x08, 0x81, 0x86, 0x0E, 0x80, 0x8B,
+    0x04, 0x80, 0xBC, 0x02, 0x00, 0x42, 0x00, 0x81, 0x85, 0x0E, 0x80, 0xC1, 0x01, 0x01, 0xE5, 0x10,
+    0x4B, 0x42, 0x83, 0xF6, 0x03, 0x82, 0xDC, 0x03, 0x06, 0x92, 0x8C, 0xDF, 0xF7, 0x1D, 0xDF, 0x3D,
+    0xE7, 0x1D, 0xDF, 0x1D, 0xDF, 0x3D, 0xDF, 0x80, 0x05, 0x01, 0xBE, 0xF7, 0x86, 0x29, 0x81, 0xF9,
+    0x0F, 0x00, 0x04, 0x19, 0x80, 0x94, 0x04, 0x82, 0x82, 0x03, 0x80, 0x83, 0x03, 0x80, 0x9F, 0x08,
+    0x84, 0x1F, 0x80, 0x93, 0x08, 0x82, 0x0F, 0x81, 0x11, 0x00, 0x6A, 0x4A, 0x80, 0x57, 0x00, 0x10,
+    0x84, 0x80, 0x0C, 0x8B, 0x1D, 0x81, 0xEF, 0x0E, 0x81, 0xF8, 0x09, 0x80, 0xDF, 0x05, 0x00, 0x82,
+    0x10, 0x81, 0xAF, 0x08, 0x81, 0x39, 0x83, 0x28, 0x00, 0xBF, 0xF7, 0x81, 0xA2, 0x08, 0x01, 0x00,
+    0x00, 0x04, 0x21, 0x85, 0x46, 0x80, 0x2A, 0x00, 0xEF, 0x7B, 0x85, 0x98, 0x04, 0x01, 0x00, 0x00,
+    0x86, 0x31, 0x80, 0x1F, 0x00, 0x1C, 0xDF, 0x80, 0x67, 0x80, 0x03, 0x80, 0x18, 0x00, 0x04, 0x19,
+    0x81, 0xA4, 0x03, 0x01, 0x18, 0xC6, 0xBF, 0xF7, 0x83, 0xEA, 0x03, 0x02, 0x7E, 0xEF, 0x1C, 0xE7,
+    0xC3, 0x18, 0x85, 0x98, 0x04, 0x00, 0xB3, 0x94, 0x84, 0xFB, 0x03, 0x82, 0x92, 0x08, 0x01, 0x8A,
+    0x52, 0xDF, 0xFF, 0x81, 0x27, 0x80, 0x03, 0x02, 0x1C, 0xDF, 0x7E, 0xE7, 0xFC, 0xDE, 0x80, 0xEE,
+    0x0B, 0x81, 0xFE, 0x01, 0x81, 0x65, 0x01, 0x7A, 0xCE, 0x9E, 0xEF, 0x82, 0x3A, 0x80, 0x02, 0x01,
+    0xBF, 0xF7, 0x08, 0x42, 0x80, 0x1E, 0x00, 0xCB, 0x5A, 0x84, 0x90, 0x01, 0x80, 0x0C, 0x00, 0xF7,
+    0xBD, 0x84, 0xFC, 0x03, 0x80, 0x3B, 0x01, 0x62, 0x08, 0xA2, 0x10, 0x81, 0xB5, 0x03, 0x01, 0xA2,
+    0x10, 0xA2, 0x10, 0x81, 0xCF, 0x06, 0x02, 0x08, 0x42, 0xDF, 0xFF, 0x5E, 0xE7, 0x80, 0x44, 0x81,
+    0x47, 0x01, 0xFF, 0xFF, 0x30, 0x84, 0x85, 0x88, 0x02, 0x02, 0xE4, 0x18, 0x5D, 0xEF, 0x9E, 0xEF,
+    0x82, 0x57, 0x01, 0x7E, 0xEF, 0x3C, 0xE7, 0x80, 0x67, 0x83, 0x2C, 0x81, 0xAA, 0x04, 0x83, 0xEE,
+    0x06, 0x81, 0xA0, 0x04, 0x03, 0x21, 0x00, 0xAB, 0x52, 0xD4, 0x94, 0x8F, 0x6B, 0x81, 0xC2, 0x05,
+    0x83, 0x9C, 0x01, 0x09, 0x01, 0x00, 0xCC, 0x52, 0x97, 0xAD, 0x36, 0x9D, 0xD1, 0x6B, 0x90, 0x63,
+    0x4F, 0x63, 0x32, 0x7C, 0x56, 0xA5, 0x8F, 0x6B, 0x80, 0xC5, 0x0F, 0x83, 0xB0, 0x08, 0x81, 0x8D,
+    0x04, 0x81, 0x8F, 0x04, 0x80, 0x97, 0x04, 0x02, 0x24, 0x31, 0x03, 0x31, 0xC3, 0x20, 0x82, 0x99,
+    0x04, 0x81, 0x9A, 0x04, 0x00, 0x82, 0x10, 0x82, 0x98, 0x04, 0x00, 0x62, 0x10, 0x82, 0x98, 0x04,
+    0x02, 0x41, 0x08, 0x21, 0x08, 0x62, 0x08, 0x80, 0x98, 0x04, 0x81, 0x9A, 0x0F, 0x84, 0xDF, 0x0B,
+    0x82, 0x01, 0x80, 0x9D, 0x04, 0x83, 0x0C, 0x81, 0x9E, 0x04, 0x80, 0x03, 0x83, 0x9A, 0x04, 0x00,
+    0x05, 0x19, 0x8B, 0xC3, 0x03, 0xB3, 0x9B, 0x04, 0x01, 0x42, 0x08, 0x82, 0x08, 0x80, 0xB4, 0x08,
+    0x00, 0x82, 0x10, 0x80, 0xD9, 0x03, 0x80, 0x4C, 0x81, 0xC8, 0x0C, 0x81, 0x03, 0x81, 0x66, 0x00,
+    0x05, 0x19, 0x80, 0xAE, 0x01, 0x88, 0x01, 0x81, 0xC9, 0x01, 0x82, 0x9A, 0x04, 0x0B, 0x42, 0x00,
+    0x46, 0x21, 0xED, 0x5A, 0xF1, 0x73, 0x6F, 0x63, 0x2B, 0x42, 0x88, 0x29, 0x88, 0x29, 0xA8, 0x29,
+    0xA9, 0x31, 0x2B, 0x42, 0x6F, 0x63, 0x80, 0xE8, 0x03, 0x80, 0x86, 0x03, 0x04, 0x67, 0x21, 0xE4,
+    0x18, 0x46, 0x19, 0x05, 0x19, 0xA4, 0x10, 0x80, 0x94, 0x04, 0x80, 0xFB, 0x0D, 0x81, 0x93, 0x04,
+    0x82, 0x9F, 0x08, 0x8A, 0x8C, 0x06, 0x00, 0x41, 0x00, 0x80, 0xBB, 0x0C, 0x0E, 0x85, 0x19, 0xE7,
+    0x29, 0x89, 0x32, 0x0B, 0x43, 0xAE, 0x5B, 0x51, 0x7C, 0xF4, 0x94, 0x36, 0x9D, 0x15, 0x9D, 0x94,
+    0x8C, 0xD1, 0x7B, 0xED, 0x5A, 0xE9, 0x39, 0x26, 0x19, 0xA4, 0x10, 0x82, 0x93, 0x04, 0x80, 0x5D,
+    0x00, 0x82, 0x08, 0x80, 0x82, 0x0A, 0x82, 0x1F, 0x00, 0x42, 0x00, 0x80, 0x86, 0x0E, 0x00, 0xA3,
+    0x08, 0x81, 0x68, 0x00, 0x2A, 0x42, 0x81, 0xF1, 0x02, 0x81, 0x01, 0x81, 0xF9, 0x03, 0x08, 0xB7,
+    0xB5, 0x7E, 0xEF, 0xDC, 0xD6, 0xFC, 0xD6, 0xFC, 0xD6, 0xFC, 0xDE, 0xFC, 0xD6, 0xDC, 0xD6, 0x1D,
+    0xDF, 0x80, 0x87, 0x03, 0x80, 0x86, 0x08, 0x80, 0xDB, 0x02, 0x00, 0xBF, 0xF7, 0x82, 0x93, 0x03,
+    0x80, 0xFF, 0x06, 0x01, 0xFF, 0xFF, 0x8E, 0x73, 0x80, 0x7A, 0x83, 0xFA, 0x03, 0x01, 0xB7, 0xB5,
+    0xBF, 0xF7, 0x80, 0x8E, 0x07, 0x00, 0xFC, 0xDE, 0x80, 0x01, 0x01, 0x3D, 0xE7, 0x9E, 0xF7, 0x80,
+    0x9F, 0x0C, 0x01, 0x00, 0x00, 0x35, 0xA5, 0x80, 0xC3, 0x04, 0x83, 0x1E, 0x81, 0x1D, 0x81, 0x1B,
+    0x81, 0x02, 0x87, 0x75, 0x80, 0x28, 0x00, 0x08, 0x3A, 0x80, 0x1C, 0x82, 0x38, 0x02, 0xFC, 0xDE,
+    0xBF, 0xF7, 0xF3, 0x9C, 0x81, 0xB5, 0x01, 0x01, 0x28, 0x42, 0xBF, 0xF7, 0x80, 0xB9, 0x03, 0x80,
+    0xEA, 0x04, 0x80, 0x11, 0x01, 0xFC, 0xDE, 0xDF, 0xF7, 0x80, 0x84, 0x09, 0x83, 0xDA, 0x05, 0x80,
+    0x20, 0x01, 0xCB, 0x5A, 0xDF, 0xF7, 0x81, 0x65, 0x81, 0x67, 0x02, 0x5E, 0xE7, 0x7A, 0xCE, 0x41,
+    0x00, 0x80, 0x0F, 0x02, 0xA3, 0x10, 0xFC, 0xDE, 0x5E, 0xE7, 0x83, 0xA5, 0x04, 0x80, 0xE0, 0x03,
+    0x00, 0x18, 0xBE, 0x82, 0x01, 0x04, 0x18, 0xC6, 0x18, 0xC6, 0x18, 0xBE, 0x1C, 0xDF, 0x5D, 0xE7,
+    0x81, 0x5B, 0x80, 0x3E, 0x01, 0xDF, 0xF7, 0x0C, 0x63, 0x80, 0x4C, 0x01, 0xAF, 0x73, 0xDF, 0xF7,
+    0x81, 0x91, 0x01, 0x80, 0x29, 0x01, 0xDC, 0xD6, 0x7E, 0xE7, 0x85, 0xFA, 0x03, 0x03, 0x00, 0x00,
+    0x24, 0x21, 0x5D, 0xEF, 0x3D, 0xDF, 0x80, 0x39, 0x81, 0x12, 0x01, 0x1C, 0xDF, 0x3D, 0xE7, 0x81,
+    0xAB, 0x0C, 0x01, 0x10, 0x84, 0xDF, 0xFF, 0x81, 0xA2, 0x04, 0x81, 0x69, 0x00, 0xDF, 0xF7, 0x80,
+    0x68, 0x82, 0xC3, 0x01, 0x89, 0x84, 0x08, 0x80, 0x09, 0x80, 0x9E, 0x0D, 0x81, 0x45, 0x81, 0x58,
+    0x80, 0x64, 0x00, 0xB7, 0xB5, 0x80, 0x01, 0x00, 0xD7, 0xBD, 0x80, 0x01, 0x01, 0xB7, 0xB5, 0x18,
+    0xC6, 0x80, 0x8D, 0x05, 0x82, 0x87, 0x01, 0x01, 0x7E, 0xEF, 0x7A, 0xCE, 0x80, 0xB3, 0x02, 0x8A,
+    0xA3, 0x02, 0x84, 0x0B, 0x03, 0x82, 0x10, 0x8F, 0x73, 0x56, 0xA5, 0xCC, 0x5A, 0x83, 0xF9, 0x06,
+    0x81, 0xC2, 0x02, 0x09, 0xE5, 0x18, 0x73, 0x8C, 0xB8, 0xAD, 0x12, 0x7C, 0x6F, 0x63, 0x4F, 0x63,
+    0x8F, 0x6B, 0xD5, 0x94, 0x73, 0x8C, 0x46, 0x29, 0x81, 0x99, 0x04, 0x83, 0x96, 0x04, 0x80, 0x9C,
+    0x04, 0x05, 0xC3, 0x20, 0xE3, 0x20, 0x03, 0x31, 0x44, 0x39, 0x24, 0x39, 0xE3, 0x20, 0x80, 0x99,
+    0x04, 0x01, 0xC4, 0x18, 0xC3, 0x18, 0x81, 0x01, 0x82, 0x97, 0x04, 0x02, 0xA3, 0x10, 0x62, 0x10,
+    0x20, 0x08, 0x80, 0x87, 0x06, 0x81, 0x98, 0x04, 0x02, 0x82, 0x10, 0x26, 0x21, 0xC4, 0x10, 0x80,
+    0x0C, 0x00, 0xA4, 0x10, 0x80, 0xD3, 0x07, 0x81, 0x03, 0x85, 0x9F, 0x04, 0x85, 0xA5, 0x04, 0x84,
+    0xCB, 0x0C, 0x80, 0x01, 0x80, 0xE7, 0x0C, 0xBE, 0x98, 0x04, 0x81, 0x98, 0x01, 0x01, 0x62, 0x08,
+    0x83, 0x10, 0x81, 0xBC, 0x0D, 0x82, 0x01, 0x85, 0xFE, 0x04, 0x8B, 0x98, 0x04, 0x84, 0xB8, 0x01,
+    0x80, 0x01, 0x0D, 0x62, 0x08, 0xC4, 0x18, 0xA8, 0x31, 0xED, 0x5A, 0xF2, 0x73, 0x70, 0x6B, 0xCD,
+    0x52, 0x4B, 0x42, 0xED, 0x52, 0xF1, 0x73, 0xD5, 0x94, 0x97, 0xAD, 0x3A, 0xC6, 0x4A, 0x42, 0x80,
+    0xA3, 0x06, 0x80, 0x91, 0x04, 0x81, 0x95, 0x0C, 0x80, 0x93, 0x04, 0x81, 0xD2, 0x01, 0x8C, 0x93,
+    0x04, 0x11, 0xE3, 0x10, 0x44, 0x11, 0x85, 0x19, 0xE7, 0x21, 0x69, 0x32, 0x0C, 0x4B, 0xCF, 0x63,
+    0x72, 0x7C, 0xF4, 0x94, 0x15, 0x9D, 0xD4, 0x94, 0x32, 0x84, 0x4F, 0x63, 0x4B, 0x42, 0x67, 0x29,
+    0xE5, 0x10, 0xA4, 0x08, 0x84, 0x08, 0x81, 0x93, 0x04, 0x80, 0xAC, 0x01, 0x02, 0x62, 0x08, 0x41,
+    0x00, 0x20, 0x00, 0x86, 0x50, 0x80, 0xB0, 0x08, 0x81, 0xA6, 0x04, 0x80, 0xCF, 0x01, 0x00, 0x2A,
+    0x3A, 0x80, 0xD4, 0x03, 0x83, 0x97, 0x04, 0x80, 0xE0, 0x0B, 0x02, 0x7A, 0xCE, 0x1D, 0xDF, 0xBB,
+    0xCE, 0x80, 0x01, 0x04, 0xBC, 0xD6, 0xBB, 0xCE, 0x9B, 0xCE, 0x5E, 0xE7, 0x18, 0xBE, 0x81, 0x87,
+    0x03, 0x80, 0xDB, 0x02, 0x81, 0x95, 0x03, 0x80, 0x93, 0x03, 0x80, 0x01, 0x01, 0xBF, 0xF7, 0x49,
+    0x4A, 0x82, 0x7A, 0x81, 0x1F, 0x01, 0x9A, 0xD6, 0x3D, 0xE7, 0x82, 0x0F, 0x02, 0xDC, 0xD6, 0x5D,
+    0xE7, 0xBB, 0xD6, 0x80, 0x90, 0x07, 0x01, 0x21, 0x00, 0x38, 0xC6, 0x80, 0xC3, 0x07, 0x83, 0xA1,
+    0x03, 0x00, 0xBF, 0xF7, 0x80, 0xBC, 0x08, 0x80, 0x95, 0x04, 0x8C, 0x01, 0x81, 0x8F, 0x0D, 0x83,
+    0x28, 0x02, 0xBB, 0xD6, 0xBF, 0xF7, 0xAF, 0x73, 0x81, 0xA1, 0x03, 0x00, 0x2D, 0x63, 0x80, 0x85,
+    0x04, 0x84, 0x01, 0x01, 0x7E, 0xEF, 0xC7, 0x39, 0x84, 0xA9, 0x07, 0x80, 0x20, 0x03, 0xF0, 0x7B,
+    0xBF, 0xF7, 0xBB, 0xCE, 0xBB, 0xD6, 0x81, 0x69, 0x80, 0x67, 0x00, 0x96, 0xB5, 0x81, 0x20, 0x80,
+    0xBD, 0x08, 0x81, 0xA2, 0x04, 0x82, 0x20, 0x00, 0x1D, 0xDF, 0x80, 0xE5, 0x0B, 0x01, 0x7E, 0xE7,
+    0x7E, 0xE7, 0x82, 0xEB, 0x0B, 0x00, 0x3D, 0xE7, 0x82, 0xB4, 0x04, 0x80, 0x01, 0x81, 0x30, 0x04,
+    0x00, 0x00, 0xD3, 0x94, 0x9E, 0xEF, 0xBB, 0xD6, 0xDB, 0xD6, 0x82, 0x2A, 0x01, 0x9E, 0xEF, 0xB3,
+    0x94, 0x85, 0xDD, 0x01, 0x01, 0x29, 0x42, 0xBF, 0xF7, 0x81, 0x58, 0x81, 0x3D, 0x01, 0x1D, 0xDF,
+    0x9A, 0xD6, 0x81, 0x98, 0x09, 0x01, 0x14, 0xA5, 0x9F, 0xEF, 0x82, 0xB4, 0x04, 0x80, 0x10, 0x01,
+    0xDF, 0xF7, 0x6E, 0x6B, 0x84, 0xD3, 0x03, 0x82, 0x02, 0x85, 0x01, 0x01, 0x00, 0x00, 0x72, 0x8C,
+    0x81, 0xFC, 0x04, 0x83, 0xA1, 0x01, 0x04, 0x5E, 0xE7, 0x7F, 0xEF, 0x9F, 0xEF, 0x9E, 0xEF, 0x9F,
+    0xEF, 0x81, 0x03, 0x00, 0x7E, 0xE7, 0x82, 0x64, 0x81, 0x56, 0x00, 0x96, 0xAD, 0x8C, 0xC7, 0x0C,
+    0x86, 0x0D, 0x02, 0x45, 0x29, 0xB3, 0x94, 0xF4, 0x9C, 0x81, 0xEE, 0x05, 0x83, 0xBF, 0x01, 0x03,
+    0x21, 0x00, 0x0D, 0x5B, 0xB8, 0xB5, 0x93, 0x8C, 0x80, 0x99, 0x04, 0x05, 0x4E, 0x63, 0x32, 0x84,
+    0xF5, 0x9C, 0x4A, 0x4A, 0x21, 0x08, 0x62, 0x10, 0x83, 0xBC, 0x0C, 0x80, 0x03, 0x05, 0xC3, 0x20,
+    0xC3, 0x28, 0x03, 0x31, 0x64, 0x41, 0x23, 0x39, 0xE3, 0x28, 0x80, 0x0A, 0x80, 0x9A, 0x04, 0x83,
+    0x01, 0x81, 0x15, 0x00, 0x61, 0x10, 0x80, 0x98, 0x04, 0x01, 0x42, 0x10, 0x42, 0x10, 0x80, 0xB5,
+    0x08, 0x00, 0x83, 0x10, 0x80, 0x98, 0x04, 0x80, 0xE7, 0x06, 0x81, 0x94, 0x04, 0x81, 0xE2, 0x0B,
+    0x83, 0x06, 0x83, 0x01, 0x82, 0xAD, 0x08, 0x04, 0x83, 0x08, 0x84, 0x08, 0xA3, 0x08, 0xA4, 0x08,
+    0xA4, 0x08, 0x82, 0xC9, 0x0C, 0x00, 0xC4, 0x18, 0x87, 0xAD, 0x05, 0xBA, 0x01, 0x80, 0xCF, 0x0C,
+    0x04, 0xC4, 0x10, 0xE4, 0x18, 0xC4, 0x18, 0xC4, 0x18, 0xC3, 0x10, 0x84, 0x97, 0x09, 0x80, 0x04,
+    0x8B, 0x98, 0x04, 0x84, 0xE9, 0x09, 0x80, 0x03, 0x00, 0x42, 0x08, 0x80, 0x9F, 0x08, 0x09, 0x09,
+    0x3A, 0xF1, 0x73, 0x94, 0x8C, 0x6F, 0x63, 0x53, 0x84, 0x36, 0xA5, 0x97, 0xAD, 0xB7, 0xB5, 0x16,
+    0x9D, 0xAC, 0x4A, 0x81, 0xCC, 0x01, 0x80, 0x84, 0x08, 0x80, 0xBC, 0x0C, 0x89, 0xAC, 0x06, 0x02,
+    0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0x80, 0xA7, 0x08, 0x0C, 0x65, 0x11, 0xC6, 0x19, 0x48, 0x2A,
+    0xEB, 0x3A, 0x6D, 0x53, 0xF0, 0x6B, 0x73, 0x7C, 0x94, 0x8C, 0x94, 0x8C, 0x32, 0x7C, 0x4F, 0x63,
+    0x6B, 0x4A, 0x88, 0x29, 0x80, 0xD0, 0x08, 0x82, 0x81, 0x04, 0x80, 0xD3, 0x05, 0x80, 0xE1, 0x05,
+    0x84, 0x93, 0x04, 0x85, 0xBF, 0x03, 0x01, 0x00, 0x00, 0x42, 0x08, 0x82, 0xC4, 0x01, 0x80, 0x89,
+    0x0E, 0x00, 0x2A, 0x42, 0x80, 0x3F, 0x84, 0xAF, 0x08, 0x03, 0x05, 0x21, 0xFC, 0xDE, 0xDC, 0xD6,
+    0x9B, 0xCE, 0x81, 0x01, 0x02, 0x9B, 0xC6, 0x7B, 0xC6, 0x7E, 0xEF, 0x82, 0x87, 0x03, 0x02, 0x00,
+    0x00, 0x92, 0x94, 0x9F, 0xEF, 0x81, 0x93, 0x03, 0x80, 0x01, 0x02, 0xDC, 0xD6, 0x7D, 0xEF, 0x45,
+    0x29, 0x84, 0xB0, 0x02, 0x00, 0x25, 0x21, 0x80, 0x97, 0x04, 0x82, 0x10, 0x01, 0x9B, 0xCE, 0x7E,
+    0xE7, 0x80, 0xCF, 0x03, 0x04, 0x00, 0x00, 0xA3, 0x10, 0xDB, 0xD6, 0xFD, 0xDE, 0xBC, 0xCE, 0x83,
+    0x1D, 0x01, 0x3D, 0xE7, 0x65, 0x29, 0x85, 0x4F, 0x84, 0x01, 0x83, 0xF8, 0x03, 0x02, 0x92, 0x8C,
+    0x9F, 0xEF, 0x9B, 0xCE, 0x80, 0x26, 0x81, 0x03, 0x01, 0x9E, 0xEF, 0x8A, 0x52, 0x81, 0xF8, 0x03,
+    0x00, 0x72, 0x8C, 0x80, 0x46, 0x80, 0xBA, 0x03, 0x80, 0x29, 0x00, 0xBB, 0xD6, 0x80, 0x94, 0x03,
+    0x85, 0xA8, 0x0C, 0x80, 0x13, 0x01, 0x14, 0xA5, 0x7E, 0xEF, 0x80, 0x1E, 0x05, 0x7B, 0xCE, 0x7B,
+    0xCE, 0x7A, 0xC6, 0x7A, 0xC6, 0x7E, 0xE7, 0x72, 0x8C, 0x81, 0x20, 0x00, 0x8A, 0x52, 0x82, 0x66,
+    0x83, 0x59, 0x82, 0x5C, 0x81, 0x36, 0x00, 0x9B, 0xC6, 0x81, 0x04, 0x82, 0x09, 0x00, 0xFC, 0xDE,
+    0x81, 0xF5, 0x0F, 0x01, 0xB7, 0xB5, 0x3D, 0xDF, 0x82, 0x91, 0x01, 0x80, 0x2A, 0x00, 0x9E, 0xEF,
+    0x80, 0x96, 0x09, 0x84, 0x3B, 0x01, 0x8E, 0x73, 0xBF, 0xEF, 0x82, 0x1C, 0x80, 0x01, 0x01, 0x5E,
+    0xE7, 0x76, 0xAD, 0x81, 0xE8, 0x01, 0x02, 0x18, 0xC6, 0x5D, 0xE7, 0xDB, 0xD6, 0x80, 0xC5, 0x05,
+    0x82, 0xB6, 0x04, 0x00, 0x49, 0x42, 0x83, 0xB0, 0x08, 0x83, 0x7E, 0x85, 0x9D, 0x04, 0x01, 0x00,
+    0x00, 0x76, 0xAD, 0x80, 0xFB, 0x09, 0x80, 0x01, 0x81, 0xD4, 0x04, 0x80, 0x2F, 0x82, 0x22, 0x80,
+    0x54, 0x82, 0x01, 0x81, 0xB2, 0x01, 0x01, 0x7B, 0xC6, 0x9F, 0xEF, 0x81, 0x74, 0x90, 0x98, 0x04,
+    0x82, 0xE9, 0x0A, 0x02, 0x8A, 0x52, 0x97, 0xAD, 0xAF, 0x73, 0x82, 0xDE, 0x02, 0x82, 0xEA, 0x01,
+    0x09, 0xE8, 0x39, 0x76, 0xAD, 0x15, 0x9D, 0x6F, 0x63, 0x2E, 0x63, 0x0D, 0x5B, 0x8F, 0x6B, 0x35,
+    0xA5, 0x6D, 0x6B, 0x41, 0x10, 0x80, 0x99, 0x04, 0x00, 0xC3, 0x20, 0x81, 0x01, 0x06, 0xA3, 0x20,
+    0xC3, 0x20, 0xE3, 0x28, 0x23, 0x39, 0x84, 0x51, 0x43, 0x41, 0xE3, 0x28, 0x81, 0x0A, 0x86, 0x97,
+    0x04, 0x80, 0x98, 0x04, 0x01, 0x41, 0x08, 0x41, 0x10, 0x82, 0x98, 0x04, 0x02, 0xA3, 0x10, 0x25,
+    0x21, 0xC4, 0x18, 0x87, 0xA4, 0x08, 0x81, 0x9A, 0x04, 0x80, 0xD2, 0x07, 0x84, 0x98, 0x04, 0x00,
+    0x84, 0x10, 0x80, 0xA7, 0x04, 0x86, 0xA4, 0x04, 0x00, 0xE5, 0x18, 0x86, 0xD1, 0x0F, 0xBD, 0x01,
+    0x80, 0x90, 0x08, 0x04, 0xC3, 0x10, 0x04, 0x19, 0x05, 0x21, 0x05, 0x19, 0xE4, 0x18, 0x84, 0x6B,
+    0x89, 0x98, 0x04, 0x81, 0x8F, 0x08, 0x81, 0x62, 0x81, 0x03, 0x81, 0xC6, 0x01, 0x0A, 0x62, 0x08,
+    0xE5, 0x18, 0xE9, 0x31, 0x0E, 0x5B, 0x67, 0x21, 0x6F, 0x6B, 0xD9, 0xB5, 0x56, 0xA5, 0x12, 0x7C,
+    0x6B, 0x42, 0x26, 0x19, 0x83, 0xE6, 0x03, 0x88, 0x94, 0x04, 0x81, 0xA7, 0x08, 0x0D, 0x24, 0x11,
+    0x66, 0x19, 0xC7, 0x19, 0x08, 0x22, 0xAA, 0x3A, 0x6E, 0x53, 0x31, 0x74, 0xB3, 0x8C, 0xD4, 0x94,
+    0x94, 0x8C, 0xD1, 0x73, 0xCD, 0x52, 0xC9, 0x31, 0x26, 0x21, 0x80, 0x93, 0x04, 0x80, 0xB7, 0x04,
+    0x81, 0xE0, 0x04, 0x01, 0x82, 0x08, 0x42, 0x08, 0x85, 0x9F, 0x01, 0x81, 0x2E, 0x00, 0x41, 0x00,
+    0x81, 0x01, 0x83, 0xFF, 0x01, 0x00, 0x42, 0x08, 0x81, 0xD1, 0x05, 0x81, 0xD5, 0x05, 0x01, 0x0A,
+    0x3A, 0x42, 0x08, 0x84, 0x9C, 0x02, 0x80, 0xB9, 0x0C, 0x00, 0x3D, 0xE7, 0x80, 0x82, 0x03, 0x00,
+    0x5A, 0xC6, 0x80, 0x02, 0x02, 0x5A, 0xC6, 0x3A, 0xBE, 0x7E, 0xE7, 0x80, 0x81, 0x07, 0x81, 0xB9,
+    0x02, 0x02, 0xB7, 0xB5, 0x1D, 0xDF, 0x7B, 0xC6, 0x80, 0x10, 0x80, 0x03, 0x01, 0xDC, 0xD6, 0xBA,
+    0xD6, 0x81, 0x9F, 0x08, 0x82, 0xDC, 0x0F, 0x01, 0x08, 0x42, 0x5E, 0xE7, 0x80, 0xDB, 0x02, 0x80,
+    0x0F, 0x02, 0x7B, 0xC6, 0x5A, 0xC6, 0x9E, 0xEF, 0x81, 0xF9, 0x0F, 0x01, 0xA7, 0x31, 0x5D, 0xE7,
+    0x80, 0x0B, 0x80, 0xC0, 0x04, 0x80, 0x01, 0x80, 0xF0, 0x03, 0x82, 0xEE, 0x03, 0x8B, 0xAF, 0x08,
+    0x81, 0x94, 0x03, 0x00, 0x3E, 0xDF, 0x80, 0x19, 0x80, 0x28, 0x80, 0x01, 0x01, 0x1D, 0xDF, 0xA6,
+    0x31, 0x81, 0xB6, 0x01, 0x00, 0x96, 0xAD, 0x83, 0xDB, 0x03, 0x80, 0x01, 0x01, 0xFC, 0xD6, 0x39,
+    0xBE, 0x81, 0xBD, 0x0F, 0x84, 0x92, 0x03, 0x01, 0xF8, 0xBD, 0x1D, 0xD7, 0x82, 0x65, 0x80, 0x02,
+    0x00, 0x5E, 0xE7, 0x80, 0xAA, 0x0C, 0x80, 0x0D, 0x01, 0xCF, 0x7B, 0x9F, 0xEF, 0x81, 0x2D, 0x80,
+    0xB8, 0x03, 0x03, 0x7B, 0xC6, 0x9B, 0xCE, 0x3E, 0xDF, 0x5E, 0xE7, 0x80, 0xAE, 0x08, 0x80, 0xB1,
+    0x08, 0x01, 0x7E, 0xE7, 0x5E, 0xE7, 0x85, 0x01, 0x00, 0x9F, 0xEF, 0x81, 0xF1, 0x0B, 0x02, 0x82,
+    0x08, 0x7A, 0xCE, 0xBC, 0xCE, 0x80, 0x29, 0x00, 0x5A, 0xBE, 0x81, 0x2C, 0x01, 0x5D, 0xE7, 0x29,
+    0x42, 0x85, 0x98, 0x04, 0x01, 0x92, 0x94, 0x5E, 0xE7, 0x81, 0x92, 0x01, 0x81, 0x01, 0x01, 0x5E,
+    0xE7, 0x51, 0x84, 0x80, 0x84, 0x01, 0x00, 0xC3, 0x18, 0x82, 0xC7, 0x05, 0x80, 0x85, 0x01, 0x03,
+    0x7A, 0xC6, 0x9B, 0xCE, 0x1C, 0xDF, 0x25, 0x21, 0x84, 0xB4, 0x06, 0x82, 0xA5, 0x0D, 0x83, 0x8D,
+    0x01, 0x80, 0x28, 0x01, 0x41, 0x08, 0x59, 0xC6, 0x80, 0xFB, 0x09, 0x83, 0xE3, 0x05, 0x00, 0xFC,
+    0xD6, 0x80, 0x52, 0x80, 0xAD, 0x08, 0x82, 0x58, 0x82, 0x01, 0x80, 0x56, 0x02, 0x3E, 0xDF, 0xFF,
+    0xFF, 0x2D, 0x63, 0x94, 0x98, 0x04, 0x81, 0x11, 0x02, 0xC3, 0x18, 0xB3, 0x94, 0x56, 0xAD, 0x83,
+    0x82, 0x06, 0x80, 0x9E, 0x02, 0x0B, 0x00, 0x00, 0xC4, 0x18, 0xF4, 0x9C, 0xB8, 0xB5, 0x8F, 0x6B,
+    0xED, 0x5A, 0xEC, 0x5A, 0x0D, 0x63, 0x14, 0xA5, 0x10, 0x8C, 0xA2, 0x18, 0x61, 0x10, 0x80, 0xC3,
+    0x0C, 0x00, 0xE3, 0x28, 0x80, 0x91, 0x04, 0x04, 0xE3, 0x28, 0x03, 0x31, 0x43, 0x41, 0xC4, 0x59,
+    0x84, 0x51, 0x80, 0xB1, 0x08, 0x80, 0xCA, 0x0C, 0x80, 0x02, 0x81, 0x9C, 0x04, 0x80, 0xB8, 0x08,
+    0x80, 0x03, 0x03, 0x62, 0x10, 0x41, 0x10, 0x61, 0x10, 0x62, 0x10, 0x80, 0x01, 0x02, 0x21, 0x08,
+    0xC4, 0x18, 0x05, 0x21, 0x81, 0xB0, 0x08, 0x81, 0xDF, 0x0B, 0x85, 0xBE, 0x0C, 0x81, 0xCC, 0x07,
+    0x82, 0xBF, 0x0C, 0x00, 0xA4, 0x08, 0x80, 0x98, 0x04, 0x83, 0x99, 0x04, 0x80, 0xC8, 0x0B, 0x80,
+    0xFD, 0x02, 0x00, 0x05, 0x19, 0x80, 0xBE, 0x02, 0xC6, 0x01, 0x80, 0xAA, 0x0C, 0x04, 0x25, 0x21,
+    0x46, 0x29, 0x46, 0x21, 0x25, 0x21, 0xE4, 0x18, 0x8F, 0xB0, 0x08, 0x80, 0xF6, 0x03, 0x03, 0x25,
+    0x21, 0x2A, 0x42, 0x4A, 0x42, 0x83, 0x10, 0x82, 0xCB, 0x01, 0x01, 0x41, 0x00, 0x67, 0x29, 0x80,
+    0xCD, 0x06, 0x03, 0x82, 0x08, 0xD1, 0x73, 0x2E, 0x5B, 0x67, 0x21, 0x80, 0x88, 0x01, 0x88, 0x8E,
+    0x05, 0x0A, 0x41, 0x08, 0x82, 0x08, 0xC3, 0x10, 0x04, 0x11, 0x45, 0x19, 0x86, 0x19, 0xE7, 0x29,
+    0x69, 0x32, 0xEC, 0x4A, 0x8F, 0x63, 0x32, 0x7C, 0x82, 0xA7, 0x08, 0x04, 0x4B, 0x42, 0x87, 0x29,
+    0xE5, 0x18, 0x83, 0x08, 0x63, 0x00, 0x80, 0x97, 0x01, 0x81, 0xD2, 0x09, 0x80, 0xA7, 0x08, 0x84,
+    0x25, 0x85, 0x93, 0x04, 0x86, 0x97, 0x04, 0x80, 0x15, 0x01, 0x42, 0x00, 0x84, 0x08, 0x80, 0xBB,
+    0x01, 0x80, 0xEE, 0x09, 0x01, 0x83, 0x08, 0x09, 0x3A, 0x86, 0x98, 0x04, 0x02, 0x2D, 0x63, 0x3E,
+    0xDF, 0x3A, 0xBE, 0x81, 0x01, 0x00, 0x39, 0xBE, 0x80, 0x02, 0x01, 0x5D, 0xE7, 0x08, 0x42, 0x81,
+    0x6D, 0x03, 0xA3, 0x10, 0x9A, 0xD6, 0x9B, 0xC6, 0x3A, 0xBE, 0x80, 0x94, 0x03, 0x02, 0x5A, 0xBE,
+    0x5A, 0xBE, 0xFC, 0xD6, 0x81, 0xFA, 0x0A, 0x83, 0x98, 0x04, 0x01, 0x4D, 0x6B, 0x5E, 0xE7, 0x81,
+    0xA3, 0x03, 0x80, 0x10, 0x80, 0xCF, 0x03, 0x00, 0xCB, 0x5A, 0x80, 0x4C, 0x00, 0xCB, 0x5A, 0x80,
+    0x0C, 0x81, 0xDC, 0x03, 0x80, 0x0E, 0x01, 0xDC, 0xCE, 0xF8, 0xBD, 0x83, 0xA3, 0x08, 0x86, 0x9B,
+    0x04, 0x83, 0xE6, 0x0F, 0x02, 0x42, 0x08, 0x59, 0xC6, 0xDC, 0xCE, 0x80, 0x25, 0x81, 0x01, 0x00,
+    0x7B, 0xC6, 0x81, 0xB4, 0x04, 0x80, 0xFC, 0x04, 0x00, 0x59, 0xCE, 0x80, 0xDB, 0x03, 0x81, 0xED,
+    0x04, 0x03, 0x7A, 0xC6, 0x5A, 0xBE, 0x1D, 0xD7, 0x55, 0xA5, 0x86, 0x91, 0x03, 0x01, 0xA3, 0x10,
+    0xBB, 0xD6, 0x80, 0x59, 0x81, 0x67, 0x80, 0x01, 0x00, 0x1C, 0xDF, 0x80, 0xAA, 0x0C, 0x80, 0x0E,
+    0x01, 0xF4, 0x9C, 0x3D, 0xDF, 0x80, 0x53, 0x82, 0x4A, 0x06, 0xDC, 0xD6, 0xD0, 0x73, 0xAB, 0x52,
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x52, 0xAB, 0x52, 0x80, 0x01, 0x01, 0xCC, 0x5A, 0xEC, 0x5A, 0x83,
+    0x01, 0x00, 0x0C, 0x5B, 0x80, 0x8B, 0x04, 0x80, 0xA2, 0x09, 0x00, 0xDC, 0xD6, 0x81, 0x49, 0x05,
+    0x19, 0xBE, 0x19, 0xBE, 0x39, 0xBE, 0x5A, 0xBE, 0xBB, 0xD6, 0xE3, 0x18, 0x84, 0x84, 0x0D, 0x80,
+    0xAC, 0x05, 0x00, 0xDC, 0xD6, 0x80, 0x94, 0x01, 0x81, 0x83, 0x01, 0x01, 0x19, 0xBE, 0x7E, 0xE7,
+    0x80, 0xD3, 0x04, 0x80, 0x82, 0x0D, 0x00, 0x3D, 0xE7, 0x81, 0xA7, 0x05, 0x81, 0x3A, 0x01, 0x9B,
+    0xCE, 0x79, 0xC6, 0x82, 0xB9, 0x05, 0x85, 0x7F, 0x84, 0x9F, 0x04, 0x03, 0x00, 0x00, 0xE4, 0x20,
+    0x1C, 0xDF, 0xBC, 0xCE, 0x81, 0x99, 0x05, 0x03, 0x7B, 0xC6, 0x5A, 0xBE, 0xBC, 0xCE, 0x19, 0xBE,
+    0x81, 0x55, 0x80, 0x03, 0x81, 0x01, 0x81, 0x52, 0x81, 0x56, 0x80, 0x5D, 0x80, 0x4A, 0x8C, 0x98,
+    0x04, 0x85, 0x0F, 0x83, 0x12, 0x02, 0xAB, 0x52, 0xD8, 0xBD, 0xAB, 0x52, 0x82, 0x4A, 0x00, 0x41,
+    0x08, 0x80, 0x92, 0x05, 0x0A, 0x62, 0x08, 0xF0, 0x7B, 0xF8, 0xBD, 0x8F, 0x73, 0xCC, 0x5A, 0xCC,
+    0x5A, 0xCB, 0x5A, 0xB2, 0x9C, 0x50, 0x94, 0xC3, 0x20, 0x82, 0x18, 0x80, 0x97, 0x04, 0x00, 0x03,
+    0x29, 0x80, 0x03, 0x05, 0x03, 0x31, 0x63, 0x49, 0x04, 0x72, 0xA3, 0x61, 0x43, 0x41, 0x03, 0x31,
+    0x80, 0x08, 0x81, 0xA4, 0x04, 0x00, 0xE3, 0x20, 0x82, 0x9C, 0x04, 0x05, 0xC3, 0x20, 0x81, 0x18,
+    0x61, 0x10, 0x82, 0x18, 0x82, 0x18, 0x62, 0x18, 0x80, 0x9D, 0x04, 0x01, 0x05, 0x21, 0xE5, 0x18,
+    0x80, 0x95, 0x04, 0x80, 0xA8, 0x08, 0x80, 0xCA, 0x0C, 0x81, 0xCD, 0x0C, 0x83, 0x99, 0x04, 0x01,
+    0xC5, 0x10, 0xC5, 0x10, 0x83, 0x9B, 0x04, 0x80, 0xB1, 0x08, 0x81, 0x03, 0x80, 0x01, 0x82, 0xB1,
+    0x08, 0x00, 0xE5, 0x18, 0x80, 0xB1, 0x03, 0xC8, 0x01, 0x08, 0x41, 0x08, 0xC4, 0x18, 0x46, 0x29,
+    0xA7, 0x31, 0xA7, 0x31, 0x66, 0x29, 0x25, 0x21, 0xE5, 0x18, 0xA4, 0x10, 0x8B, 0x9D, 0x0D, 0x05,
+    0x21, 0x00, 0x46, 0x21, 0xA9, 0x31, 0xCD, 0x52, 0xF2, 0x7B, 0x2E, 0x63, 0x80, 0xB5, 0x01, 0x81,
+    0xD3, 0x03, 0x00, 0xC4, 0x10, 0x80, 0xA3, 0x06, 0x04, 0x00, 0x00, 0xA4, 0x10, 0x26, 0x19, 0xA4,
+    0x08, 0xC4, 0x10, 0x84, 0x8E, 0x05, 0x12, 0x41, 0x08, 0xA3, 0x10, 0xE4, 0x18, 0x25, 0x19, 0x45,
+    0x19, 0x66, 0x19, 0xA7, 0x21, 0x08, 0x32, 0x8B, 0x42, 0x2D, 0x5B, 0xF1, 0x73, 0x93, 0x8C, 0xB4,
+    0x94, 0x53, 0x8C, 0xB0, 0x73, 0xAC, 0x52, 0xC8, 0x31, 0x05, 0x19, 0xA3, 0x08, 0x81, 0x93, 0x04,
+    0x00, 0xA3, 0x08, 0x80, 0x95, 0x01, 0x89, 0x93, 0x04, 0x82, 0x95, 0x04, 0x82, 0x03, 0x81, 0xAC,
+    0x0A, 0x80, 0x90, 0x06, 0x00, 0x62, 0x08, 0x81, 0x0E, 0x81, 0x98, 0x04, 0x82, 0xB8, 0x01, 0x03,
+    0xA4, 0x08, 0x63, 0x08, 0xE9, 0x39, 0x42, 0x08, 0x85, 0x8D, 0x07, 0x02, 0x72, 0x8C, 0xFD, 0xD6,
+    0x19, 0xB6, 0x82, 0x01, 0x01, 0xF9, 0xB5, 0x19, 0xB6, 0x82, 0x81, 0x07, 0x80, 0xF7, 0x02, 0x01,
+    0x1C, 0xDF, 0x3A, 0xBE, 0x80, 0x0C, 0x80, 0x97, 0x03, 0x01, 0x19, 0xB6, 0x3D, 0xDF, 0x81, 0xFA,
+    0x0A, 0x83, 0xEC, 0x02, 0x02, 0x93, 0x94, 0x1D, 0xDF, 0x1A, 0xB6, 0x81, 0xD0, 0x03, 0x03, 0x1A,
+    0xBE, 0x19, 0xB6, 0xFC, 0xDE, 0xA7, 0x31, 0x80, 0x51, 0x01, 0xF0, 0x7B, 0x3D, 0xDF, 0x82, 0xFA,
+    0x03, 0x80, 0x01, 0x01, 0xFD, 0xD6, 0x35, 0xA5, 0x87, 0xAB, 0x07, 0x87, 0xDF, 0x02, 0x01, 0x04,
+    0x21, 0xBB, 0xCE, 0x80, 0xB9, 0x03, 0x80, 0x26, 0x80, 0x47, 0x00, 0x7B, 0xC6, 0x80, 0xB4, 0x04,
+    0x81, 0xDB, 0x03, 0x01, 0xFC, 0xDE, 0x7B, 0xC6, 0x84, 0x2A, 0x82, 0x47, 0x84, 0x20, 0x01, 0x86,
+    0x31, 0x1D, 0xDF, 0x81, 0x59, 0x81, 0x20, 0x01, 0x3A, 0xBE, 0xBB, 0xCE, 0x80, 0xDD, 0x05, 0x81,
+    0xBD, 0x08, 0x00, 0xFD, 0xD6, 0x84, 0x20, 0x01, 0xFC, 0xD6, 0x04, 0x21, 0x8E, 0x85, 0x02, 0x80,
+    0x1C, 0x02, 0x49, 0x4A, 0x1D, 0xDF, 0xF9, 0xB5, 0x83, 0x01, 0x02, 0x5A, 0xBE, 0x39, 0xC6, 0x21,
+    0x08, 0x83, 0x3D, 0x03, 0x00, 0x00, 0x82, 0x10, 0x7A, 0xCE, 0x7B, 0xC6, 0x80, 0x9E, 0x01, 0x01,
+    0x19, 0xB6, 0x19, 0xBE, 0x80, 0x03, 0x01, 0x5E, 0xE7, 0xE7, 0x39, 0x80, 0x20, 0x01, 0x8A, 0x4A,
+    0x7E, 0xE7, 0x80, 0x36, 0x80, 0x6A, 0x80, 0x02, 0x00, 0xDC, 0xCE, 0x81, 0xB9, 0x05, 0x87, 0xC7,
+    0x0C, 0x85, 0x64, 0x01, 0xC7, 0x39, 0x5E, 0xE7, 0x80, 0x94, 0x04, 0x81, 0xB3, 0x04, 0x02, 0x1A,
+    0xB6, 0x1D, 0xDF, 0xD3, 0x94, 0x8F, 0xDC, 0x02, 0x87, 0x86, 0x04, 0x86, 0x0E, 0x87, 0x38, 0x81,
+    0xAE, 0x01, 0x80, 0xCC, 0x0C, 0x81, 0xD0, 0x01, 0x00, 0x21, 0x08, 0x80, 0x99, 0x04, 0x80, 0x70,
+    0x0C, 0x2C, 0x63, 0x18, 0xC6, 0xD0, 0x7B, 0xAB, 0x5A, 0xCB, 0x62, 0xAA, 0x5A, 0x71, 0x9C, 0x91,
+    0x9C, 0x03, 0x31, 0xA2, 0x28, 0x03, 0x31, 0x23, 0x39, 0x03, 0x31, 0x80, 0x03, 0x03, 0x83, 0x51,
+    0x23, 0x7A, 0xE3, 0x69, 0x63, 0x49, 0x80, 0x08, 0x00, 0x03, 0x29, 0x80, 0x01, 0x83, 0x9C, 0x04,
+    0x80, 0x01, 0x01, 0x81, 0x20, 0x81, 0x18, 0x81, 0x98, 0x04, 0x03, 0x61, 0x18, 0x61, 0x10, 0xE4,
+    0x20, 0xC4, 0x18, 0x80, 0xAE, 0x08, 0x81, 0x01, 0x81, 0x9A, 0x04, 0x81, 0x01, 0x81, 0xB9, 0x08,
+    0x84, 0x96, 0x04, 0x85, 0x01, 0x83, 0x99, 0x04, 0x01, 0xE5, 0x18, 0xC4, 0x10, 0x8B, 0xC4, 0x03,
+    0xBE, 0x01, 0x06, 0x21, 0x00, 0xA3, 0x10, 0x45, 0x29, 0xC7, 0x39, 0xE8, 0x39, 0xC7, 0x39, 0x45,
+    0x29, 0x8B, 0x9D, 0x0D, 0x80, 0xC2, 0x08, 0x04, 0x42, 0x08, 0x26, 0x21, 0xCD, 0x52, 0xD1, 0x73,
+    0x2A, 0x42, 0x82, 0xD6, 0x0B, 0x80, 0xBA, 0x08, 0x00, 0x41, 0x00, 0x80, 0xA0, 0x04, 0x01, 0xE5,
+    0x18, 0x05, 0x19, 0x81, 0x01, 0x12, 0x83, 0x10, 0x82, 0x08, 0xC4, 0x10, 0x26, 0x21, 0x67, 0x21,
+    0x67, 0x21, 0xA8, 0x29, 0x6B, 0x42, 0xEC, 0x52, 0x8F, 0x6B, 0x31, 0x7C, 0x53, 0x84, 0x32, 0x84,
+    0xD0, 0x73, 0x2E, 0x63, 0x2A, 0x42, 0x47, 0x21, 0xC4, 0x10, 0x63, 0x08, 0x81, 0x94, 0x04, 0x81,
+    0x01, 0x89, 0xBA, 0x0C, 0x81, 0x90, 0x04, 0x00, 0x42, 0x00, 0x83, 0x03, 0x82, 0x8A, 0x0D, 0x00,
+    0x25, 0x21, 0x80, 0x85, 0x09, 0x02, 0x28, 0x42, 0xB5, 0xB5, 0x0F, 0x7C, 0x83, 0xB0, 0x08, 0x82,
+    0x27, 0x02, 0x84, 0x08, 0x63, 0x08, 0xC9, 0x31, 0x86, 0x98, 0x04, 0x02, 0x56, 0xA5, 0x9B, 0xC6,
+    0xF9, 0xAD, 0x81, 0x85, 0x03, 0x01, 0xD9, 0xAD, 0xD9, 0xAD, 0x80, 0xE3, 0x0B, 0x80, 0xEE, 0x04,
+    0x80, 0x0E, 0x00, 0xAB, 0x52, 0x82, 0x95, 0x03, 0x80, 0x82, 0x03, 0x01, 0xD9, 0xAD, 0x1D, 0xDF,
+    0x85, 0xFA, 0x0A, 0x80, 0xAC, 0x07, 0x00, 0xBC, 0xCE, 0x84, 0xCF, 0x03, 0x00, 0x5A, 0xC6, 0x81,
+    0xC6, 0x09, 0x01, 0x14, 0x9D, 0xDC, 0xCE, 0x80, 0xB3, 0x04, 0x82, 0x0D, 0x01, 0x1D, 0xD7, 0x31,
+    0x84, 0x82, 0x94, 0x03, 0x82, 0xE2, 0x0D, 0x88, 0xCE, 0x03, 0x01, 0x08, 0x42, 0xFC, 0xD6, 0x82,
+    0xCC, 0x03, 0x03, 0xD9, 0xAD, 0xD8, 0xAD, 0x9B, 0xC6, 0x15, 0x9D, 0x81, 0x0D, 0x00, 0x29, 0x42,
+    0x80, 0xCD, 0x04, 0x82, 0x36, 0x02, 0x1A, 0xB6, 0xF9, 0xB5, 0x3E, 0xDF, 0x87, 0xC1, 0x0B, 0x00,
+    0x8B, 0x52, 0x80, 0x59, 0x81, 0x3A, 0x03, 0xF9, 0xB5, 0xF9, 0xAD, 0x7A, 0xC6, 0x18, 0xBE, 0x80,
+    0xC3, 0x01, 0x80, 0xEA, 0x03, 0x02, 0x9A, 0xCE, 0x7B, 0xC6, 0x1A, 0xB6, 0x80, 0x01, 0x81, 0x56,
+    0x00, 0x7A, 0xC6, 0x80, 0x56, 0x83, 0xFF, 0x04, 0x83, 0xC1, 0x07, 0x83, 0x49, 0x81, 0xC1, 0x09,
+    0x01, 0xFD, 0xD6, 0xB8, 0xAD, 0x80, 0x8E, 0x01, 0x80, 0x49, 0x01, 0xD8, 0xAD, 0x7B, 0xC6, 0x80,
+    0xEC, 0x08, 0x81, 0x0F, 0x81, 0x17, 0x01, 0x66, 0x29, 0xDC, 0xD6, 0x84, 0xA9, 0x04, 0x01, 0x3A,
+    0xB6, 0xDC, 0xD6, 0x80, 0xF7, 0x07, 0x02, 0x00, 0x00, 0x8E, 0x6B, 0x5E, 0xE7, 0x80, 0xA8, 0x05,
+    0x00, 0x1A, 0xBE, 0x81, 0x86, 0x01, 0x01, 0xFC, 0xD6, 0xB3, 0x94, 0x83, 0xDE, 0x03, 0x8B, 0xAB,
+    0x02, 0x01, 0xEC, 0x5A, 0x5E, 0xE7, 0x83, 0xED, 0x04, 0x02, 0xF9, 0xB5, 0x1D, 0xDF, 0x10, 0x7C,
+    0x8C, 0x9F, 0x08, 0x83, 0x89, 0x04, 0x83, 0x9D, 0x0A, 0x82, 0xAA, 0x01, 0x83, 0x66, 0x8B, 0xD0,
+    0x04, 0x01, 0x62, 0x08, 0xB3, 0x94, 0x80, 0xD1, 0x01, 0x01, 0x00, 0x00, 0x21, 0x08, 0x81, 0x99,
+    0x04, 0x80, 0x9B, 0x01, 0x11, 0x0C, 0x63, 0x38, 0xC6, 0xCF, 0x83, 0xAA, 0x62, 0xCA, 0x62, 0xAA,
+    0x62, 0x91, 0xA4, 0xD1, 0xAC, 0x03, 0x31, 0xC1, 0x30, 0x43, 0x39, 0x23, 0x39, 0x22, 0x39, 0x43,
+    0x41, 0xA3, 0x61, 0x63, 0x8A, 0x23, 0x7A, 0x83, 0x59, 0x80, 0xB1, 0x08, 0x05, 0x23, 0x31, 0x23,
+    0x31, 0x03, 0x31, 0x24, 0x31, 0x24, 0x31, 0x04, 0x29, 0x81, 0x9D, 0x04, 0x04, 0xC3, 0x28, 0x81,
+    0x20, 0x81, 0x20, 0xA2, 0x20, 0xA2, 0x20, 0x80, 0x9A, 0x04, 0x81, 0x98, 0x04, 0x00, 0xC4, 0x18,
+    0x80, 0x8B, 0x04, 0x80, 0x04, 0x00, 0xC4, 0x18, 0x80, 0xB5, 0x08, 0x81, 0x9A, 0x04, 0x81, 0x9F,
+    0x04, 0x8C, 0xD2, 0x0C, 0x81, 0x9A, 0x07, 0x02, 0x83, 0x08, 0xE5, 0x10, 0xE5, 0x18, 0x8B, 0x98,
+    0x04, 0x82, 0x0D, 0x8B, 0xAA, 0x01, 0xA7, 0x01, 0x87, 0xC4, 0x01, 0x03, 0x82, 0x10, 0x45, 0x29,
+    0x08, 0x42, 0xE8, 0x39, 0x88, 0x43, 0x81, 0xC6, 0x0C, 0x00, 0xA3, 0x10, 0x81, 0xFC, 0x01, 0x03,
+    0x62, 0x08, 0xA8, 0x29, 0x4F, 0x63, 0x05, 0x19, 0x81, 0xD4, 0x0A, 0x07, 0x21, 0x00, 0xE5, 0x18,
+    0x42, 0x08, 0xC4, 0x10, 0x00, 0x00, 0x26, 0x19, 0x47, 0x21, 0x26, 0x19, 0x80, 0x98, 0x04, 0x03,
+    0xA8, 0x29, 0x4B, 0x42, 0x0A, 0x3A, 0x4B, 0x42, 0x80, 0xAD, 0x04, 0x05, 0xED, 0x5A, 0x6B, 0x4A,
+    0xD0, 0x73, 0xCC, 0x52, 0xE9, 0x39, 0x67, 0x29, 0x80, 0x93, 0x04, 0x01, 0x42, 0x00, 0x42, 0x00,
+    0x82, 0x94, 0x04, 0x00, 0x62, 0x08, 0x82, 0x81, 0x04, 0x84, 0x93, 0x04, 0x85, 0xB9, 0x0C, 0x80,
+    0x18, 0x82, 0x01, 0x0A, 0x21, 0x00, 0x62, 0x08, 0xEB, 0x5A, 0x53, 0xA5, 0x78, 0xCE, 0xF9, 0xD6,
+    0xC7, 0x31, 0x00, 0x00, 0x34, 0xA5, 0x50, 0x84, 0x94, 0xAD, 0x81, 0xB2, 0x08, 0x83, 0xC8, 0x0C,
+    0x81, 0x98, 0x04, 0x00, 0xA8, 0x29, 0x80, 0xC8, 0x0C, 0x83, 0x90, 0x03, 0x02, 0x62, 0x10, 0x39,
+    0xBE, 0x3A, 0xB6, 0x82, 0x86, 0x03, 0x02, 0xD9, 0xAD, 0xB8, 0xAD, 0x9B, 0xC6, 0x82, 0x87, 0x03,
+    0x80, 0xF9, 0x0F, 0x01, 0xDC, 0xD6, 0xD8, 0xAD, 0x82, 0xA5, 0x04, 0x02, 0xD8, 0xAD, 0xFC, 0xD6,
+    0x08, 0x3A, 0x84, 0xAC, 0x07, 0x00, 0xA3, 0x10, 0x80, 0xE7, 0x0F, 0x83, 0xF0, 0x03, 0x01, 0x5B,
+    0xBE, 0x97, 0xAD, 0x80, 0x0C, 0x02, 0x21, 0x00, 0x97, 0xAD, 0x7B, 0xBE, 0x83, 0xA0, 0x03, 0x02,
+    0xD9, 0xB5, 0x1D, 0xD7, 0x0C, 0x5B, 0x84, 0x1D, 0x05, 0x04, 0x21, 0x15, 0xA5, 0x56, 0xA5, 0x35,
+    0xA5, 0x35, 0xA5, 0x56, 0xA5, 0x80, 0x01, 0x01, 0x96, 0xAD, 0x4D, 0x6B, 0x80, 0x3B, 0x01, 0xCB,
+    0x5A, 0xFD, 0xD6, 0x82, 0xCC, 0x03, 0x02, 0xB8, 0xAD, 0x98, 0xA5, 0xBC, 0xCE, 0x81, 0xB4, 0x04,
+    0x01, 0x00, 0x00, 0x0C, 0x5B, 0x80, 0x0D, 0x81, 0x28, 0x81, 0xF0, 0x04, 0x00, 0x3D, 0xDF, 0x80,
+    0x98, 0x0C, 0x85, 0xFC, 0x02, 0x03, 0xAF, 0x73, 0xDC, 0xD6, 0xD9, 0xAD, 0xF9, 0xAD, 0x82, 0x69,
+    0x00, 0x9B, 0xC6, 0x81, 0xEC, 0x08, 0x81, 0xAB, 0x0C, 0x00, 0x3A, 0xB6, 0x80, 0xA6, 0x04, 0x82,
+    0x56, 0x01, 0xB7, 0xAD, 0x20, 0x00, 0x83, 0xC2, 0x05, 0x89, 0xC5, 0x02, 0x81, 0xC1, 0x09, 0x01,
+    0xDC, 0xCE, 0xB8, 0xAD, 0x81, 0x01, 0x80, 0x4B, 0x00, 0xDC, 0xCE, 0x81, 0x4A, 0x83, 0xA3, 0x01,
+    0x00, 0x29, 0x42, 0x80, 0x4E, 0x80, 0xA0, 0x01, 0x81, 0x3B, 0x80, 0xC1, 0x08, 0x81, 0xD3, 0x04,
+    0x01, 0x93, 0x94, 0x1D, 0xD7, 0x83, 0xE0, 0x04, 0x02, 0xD9, 0xAD, 0x1D, 0xD7, 0xF0, 0x7B, 0x84,
+    0x84, 0x01, 0x09, 0x61, 0x08, 0xF4, 0x9C, 0xD7, 0xB5, 0xB7, 0xAD, 0x76, 0xAD, 0x76, 0xA5, 0x56,
+    0xA5, 0x76, 0xAD, 0x97, 0xAD, 0xB3, 0x94, 0x80, 0xDB, 0x01, 0x01, 0xAF, 0x73, 0x1E, 0xDF, 0x80,
+    0x8B, 0x05, 0x81, 0x91, 0x05, 0x02, 0xD9, 0xB5, 0x1D, 0xDF, 0xCB, 0x52, 0x85, 0xD5, 0x05, 0x88,
+    0x56, 0x84, 0xF9, 0x0D, 0x87, 0x10, 0x82, 0x84, 0x0E, 0x86, 0x97, 0x04, 0x82, 0x17, 0x01, 0xAF,
+    0x73, 0xF0, 0x7B, 0x80, 0x3E, 0x81, 0x97, 0x04, 0x15, 0x61, 0x10, 0x41, 0x10, 0x00, 0x08, 0x0B,
+    0x6B, 0x17, 0xC6, 0xCE, 0x83, 0xCA, 0x6A, 0xCA, 0x72, 0x89, 0x6A, 0x90, 0xA4, 0x90, 0xA4, 0xE1,
+    0x30, 0x02, 0x39, 0x43, 0x41, 0x43, 0x41, 0x63, 0x49, 0xE3, 0x69, 0xA3, 0xA2, 0x63, 0x8A, 0xC3,
+    0x61, 0x63, 0x49, 0x43, 0x39, 0x81, 0x01, 0x01, 0x44, 0x39, 0x23, 0x39, 0x81, 0x9D, 0x04, 0x80,
+    0x01, 0x02, 0xA1, 0x28, 0xA1, 0x20, 0xC2, 0x20, 0x81, 0x99, 0x04, 0x01, 0x62, 0x10, 0x04, 0x21,
+    0x84, 0xB0, 0x08, 0x81, 0x01, 0x83, 0x8F, 0x04, 0x80, 0x06, 0x88, 0x9A, 0x04, 0x83, 0x04, 0x81,
+    0xC2, 0x08, 0x00, 0x06, 0x19, 0x8B, 0x87, 0x04, 0xB4, 0x94, 0x04, 0x85, 0x01, 0x80, 0xA3, 0x02,
+    0x85, 0x9A, 0x04, 0x00, 0x25, 0x21, 0x81, 0xFF, 0x01, 0x87, 0xA6, 0x02, 0x03, 0x42, 0x08, 0x62,
+    0x08, 0x42, 0x00, 0x42, 0x08, 0x80, 0x83, 0x0C, 0x02, 0x42, 0x00, 0xAD, 0x4A, 0x6B, 0x4A, 0x82,
+    0xEB, 0x01, 0x10, 0xE4, 0x18, 0x21, 0x00, 0x05, 0x19, 0x42, 0x08, 0x05, 0x19, 0x47, 0x21, 0x06,
+    0x19, 0x06, 0x19, 0x47, 0x21, 0xEA, 0x31, 0x0F, 0x5B, 0x90, 0x6B, 0x8F, 0x6B, 0x4E, 0x63, 0xAC,
+    0x52, 0xA8, 0x31, 0x22, 0x00, 0x81, 0x01, 0x82, 0x80, 0x08, 0x90, 0x93, 0x04, 0x82, 0x96, 0x04,
+    0x80, 0x10, 0x80, 0x3B, 0x81, 0x98, 0x04, 0x05, 0x01, 0x00, 0x45, 0x21, 0x7C, 0xE7, 0xF2, 0x94,
+    0xEB, 0x5A, 0x65, 0x29, 0x80, 0x9F, 0x08, 0x02, 0x0C, 0x5B, 0x54, 0xA5, 0x07, 0x3A, 0x80, 0xE6,
+    0x04, 0x81, 0xD1, 0x0C, 0x84, 0xB0, 0x08, 0x81, 0x98, 0x04, 0x83, 0xBB, 0x02, 0x01, 0x45, 0x29,
+    0xBC, 0xCE, 0x80, 0x93, 0x04, 0x84, 0x87, 0x03, 0x00, 0x52, 0x84, 0x82, 0x9D, 0x05, 0x02, 0xF4,
+    0x9C, 0x9C, 0xC6, 0xB8, 0xA5, 0x80, 0x82, 0x03, 0x04, 0xB8, 0xAD, 0xB8, 0xA5, 0xF9, 0xAD, 0xBB,
+    0xCE, 0x04, 0x19, 0x84, 0xF7, 0x02, 0x81, 0xAC, 0x07, 0x81, 0x93, 0x03, 0x03, 0xD9, 0xAD, 0x98,
+    0xA5, 0x9C, 0xC6, 0xB3, 0x8C, 0x80, 0x4E, 0x02, 0xA2, 0x10, 0xF9, 0xBD, 0x1A, 0xB6, 0x82, 0xDB,
+    0x03, 0x80, 0x01, 0x01, 0xDC, 0xCE, 0xE8, 0x39, 0x84, 0x1D, 0x03, 0xAB, 0x52, 0x7F, 0xE7, 0x5A,
+    0xBE, 0x5B, 0xBE, 0x80, 0x01, 0x03, 0x7B, 0xC6, 0x5B, 0xBE, 0x9F, 0xE7, 0x11, 0x7C, 0x80, 0x1D,
+    0x03, 0xF0, 0x7B, 0xBC, 0xCE, 0xB8, 0xA5, 0xB8, 0xA5, 0x80, 0x96, 0x04, 0x80, 0x01, 0x00, 0xBC,
+    0xCE, 0x81, 0xB4, 0x04, 0x02, 0x00, 0x00, 0xD0, 0x7B, 0xDC, 0xCE, 0x83, 0x28, 0x80, 0x9D, 0x04,
+    0x01, 0xDC, 0xD6, 0x66, 0x29, 0x86, 0x98, 0x04, 0x00, 0x92, 0x8C, 0x80, 0x20, 0x81, 0xDB, 0x03,
+    0x80, 0x22, 0x82, 0x67, 0x03, 0x00, 0x00, 0x08, 0x3A, 0xFD, 0xD6, 0xF9, 0xAD, 0x80, 0x01, 0x81,
+    0x20, 0x81, 0x56, 0x80, 0x97, 0x03, 0x00, 0x22, 0x00, 0x81, 0xAD, 0x05, 0x09, 0x45, 0x29, 0xB7,
+    0xB5, 0x96, 0xAD, 0x96, 0xAD, 0x76, 0xAD, 0x55, 0xAD, 0x55, 0xA5, 0x35, 0xA5, 0x55, 0xA5, 0x45,
+    0x29, 0x80, 0x4A, 0x01, 0x76, 0xAD, 0x7B, 0xC6, 0x80, 0x46, 0x80, 0x4C, 0x80, 0x04, 0x01, 0xFC,
+    0xD6, 0xEC, 0x5A, 0x82, 0xA4, 0x0A, 0x81, 0x3B, 0x01, 0x4D, 0x63, 0xDD, 0xCE, 0x80, 0x10, 0x82,
+    0xA2, 0x01, 0x00, 0xBC, 0xCE, 0x80, 0xD3, 0x04, 0x80, 0x01, 0x00, 0x35, 0xA5, 0x80, 0xB0, 0x01,
+    0x80, 0xF0, 0x04, 0x80, 0x3C, 0x01, 0xD8, 0xAD, 0x1D, 0xDF, 0x80, 0x1E, 0x84, 0xA1, 0x01, 0x04,
+    0x3E, 0xDF, 0x9B, 0xC6, 0x9B, 0xC6, 0x7B, 0xC6, 0x9B, 0xCE, 0x80, 0x03, 0x01, 0x5E, 0xDF, 0xD8,
+    0xB5, 0x80, 0x1C, 0x01, 0x52, 0x84, 0xDD, 0xCE, 0x83, 0xC4, 0x05, 0x01, 0xD9, 0xAD, 0xDC, 0xD6,
+    0x80, 0xF4, 0x0D, 0x84, 0x88, 0x08, 0x00, 0x92, 0x8C, 0x80, 0x53, 0x80, 0x54, 0x81, 0x01, 0x00,
+    0xCF, 0x73, 0x83, 0x10, 0x89, 0x98, 0x04, 0x83, 0xEB, 0x08, 0x84, 0x9A, 0x04, 0x84, 0x97, 0x05,
+    0x03, 0xEC, 0x5A, 0xF0, 0x7B, 0x41, 0x08, 0x20, 0x00, 0x80, 0x98, 0x04, 0x18, 0x41, 0x10, 0x61,
+    0x10, 0x61, 0x18, 0x20, 0x10, 0x6C, 0x7B, 0x37, 0xD6, 0xAD, 0x8B, 0xC9, 0x72, 0xC9, 0x7A, 0xA8,
+    0x72, 0xF1, 0xB4, 0x4E, 0xA4, 0xC1, 0x38, 0x22, 0x49, 0x62, 0x51, 0x82, 0x51, 0x02, 0x7A, 0x03,
+    0xBB, 0xA3, 0xA2, 0xE3, 0x69, 0x83, 0x51, 0x63, 0x49, 0x63, 0x41, 0x63, 0x41, 0x64, 0x41, 0x81,
+    0x01, 0x80, 0xC0, 0x08, 0x0C, 0x44, 0x39, 0x03, 0x39, 0xC1, 0x28, 0xA1, 0x28, 0xC2, 0x28, 0xC2,
+    0x28, 0xA2, 0x20, 0x61, 0x10, 0xA2, 0x18, 0x05, 0x21, 0xC4, 0x18, 0xC3, 0x18, 0xA3, 0x18, 0x85,
+    0x97, 0x04, 0x85, 0x9B, 0x04, 0x85, 0x01, 0x81, 0x0D, 0x00, 0x83, 0x10, 0x80, 0x03, 0x81, 0xE0,
+    0x02, 0x80, 0xEE, 0x0F, 0x83, 0xEB, 0x0F, 0x82, 0x69, 0xBA, 0x93, 0x04, 0x87, 0x86, 0x04, 0x84,
+    0x01, 0x87, 0xDF, 0x04, 0x81, 0x11, 0x84, 0xF3, 0x07, 0x02, 0x21, 0x00, 0x0A, 0x3A, 0xAC, 0x4A,
+    0x82, 0xD8, 0x06, 0x80, 0x98, 0x04, 0x09, 0xC4, 0x10, 0x62, 0x08, 0xE5, 0x18, 0xA9, 0x29, 0xA8,
+    0x29, 0xE9, 0x31, 0x0A, 0x3A, 0xE9, 0x31, 0x46, 0x21, 0x83, 0x10, 0x80, 0x7C, 0x02, 0x83, 0x08,
+    0x62, 0x00, 0x62, 0x08, 0x80, 0xC7, 0x09, 0x02, 0x63, 0x08, 0x41, 0x08, 0x41, 0x00, 0x82, 0xD1,
+    0x04, 0x80, 0x90, 0x04, 0x00, 0x62, 0x08, 0x80, 0x9D, 0x04, 0x89, 0x94, 0x04, 0x81, 0x04, 0x04,
+    0x00, 0x00, 0x65, 0x29, 0x30, 0x84, 0xC3, 0x10, 0x21, 0x00, 0x82, 0x98, 0x04, 0x01, 0x86, 0x29,
+    0x78, 0xCE, 0x80, 0x0C, 0x81, 0x21, 0x81, 0x26, 0x80, 0x97, 0x04, 0x85, 0x98, 0x04, 0x80, 0x3B,
+    0x01, 0x88, 0x29, 0x62, 0x08, 0x84, 0xB0, 0x03, 0x01, 0x49, 0x42, 0xDC, 0xCE, 0x82, 0x85, 0x03,
+    0x81, 0x03, 0x00, 0xDD, 0xCE, 0x81, 0xF3, 0x0B, 0x80, 0x1D, 0x01, 0xD8, 0xB5, 0x3A, 0xBE, 0x81,
+    0x83, 0x03, 0x80, 0xBE, 0x03, 0x01, 0x3A, 0xBE, 0xF8, 0xB5, 0x80, 0x29, 0x83, 0x1F, 0x02, 0x6A,
+    0x4A, 0x1D, 0xD7, 0xB9, 0xAD, 0x80, 0xA6, 0x04, 0x81, 0x1E, 0x01, 0xFD, 0xCE, 0x6E, 0x6B, 0x80,
+    0x3E, 0x02, 0xC3, 0x18, 0x19, 0xBE, 0xF9, 0xAD, 0x83, 0xE2, 0x0B, 0x02, 0xD9, 0xAD, 0x7B, 0xC6,
+    0xE4, 0x18, 0x84, 0x1D, 0x80, 0xFF, 0x03, 0x84, 0x3C, 0x01, 0xFD, 0xD6, 0x49, 0x42, 0x80, 0x1D,
+    0x01, 0xD4, 0x94, 0x3A, 0xBE, 0x81, 0x95, 0x04, 0x82, 0x98, 0x04, 0x81, 0xE9, 0x08, 0x02, 0x00,
+    0x00, 0x10, 0x7C, 0xBC, 0xC6, 0x80, 0x15, 0x00, 0xB9, 0xAD, 0x81, 0x03, 0x80, 0x98, 0x04, 0x85,
+    0x2A, 0x80, 0xBF, 0x03, 0x80, 0xB9, 0x0C, 0x80, 0x98, 0x04, 0x80, 0x59, 0x80, 0x2E, 0x00, 0xDC,
+    0xCE, 0x82, 0x67, 0x02, 0x29, 0x42, 0xDC, 0xCE, 0xB9, 0xAD, 0x82, 0xB7, 0x04, 0x01, 0xB8, 0xA5,
+    0xBC, 0xC6, 0x80, 0xF5, 0x07, 0x80, 0x92, 0x01, 0x80, 0xDB, 0x05, 0x80, 0x6C, 0x02, 0x4E, 0x63,
+    0x5E, 0xDF, 0x5A, 0xBE, 0x80, 0x01, 0x80, 0xE3, 0x04, 0x02, 0x9B, 0xCE, 0x1D, 0xDF, 0x04, 0x21,
+    0x80, 0xCD, 0x03, 0x01, 0x3A, 0xBE, 0x1A, 0xB6, 0x83, 0x49, 0x01, 0x97, 0xA5, 0xDC, 0xD6, 0x81,
+    0x4A, 0x82, 0xBC, 0x03, 0x02, 0x00, 0x00, 0x72, 0x84, 0x9C, 0xC6, 0x82, 0x10, 0x81, 0x3B, 0x80,
+    0x9F, 0x0C, 0x81, 0xB6, 0x04, 0x00, 0x9C, 0xCE, 0x83, 0xF2, 0x04, 0x01, 0xB9, 0xAD, 0xFD, 0xD6,
+    0x83, 0xD1, 0x09, 0x80, 0x3A, 0x01, 0x8B, 0x52, 0xDD, 0xD6, 0x81, 0xB2, 0x04, 0x81, 0xB2, 0x01,
+    0x01, 0xDD, 0xD6, 0xD0, 0x73, 0x80, 0x1C, 0x00, 0xF4, 0x9C, 0x80, 0xB4, 0x04, 0x83, 0x01, 0x00,
+    0x9B, 0xC6, 0x80, 0x46, 0x83, 0x76, 0x02, 0x86, 0x31, 0x3D, 0xDF, 0x9C, 0xCE, 0x80, 0xB5, 0x04,
+    0x80, 0xB3, 0x04, 0x02, 0x7B, 0xC6, 0x7F, 0xE7, 0xD4, 0x94, 0x83, 0xA7, 0x0D, 0x8C, 0xD7, 0x0C,
+    0x81, 0x5B, 0x83, 0x99, 0x04, 0x85, 0xB0, 0x09, 0x01, 0xAA, 0x52, 0x8E, 0x73, 0x80, 0xCA, 0x0C,
+    0x80, 0xB0, 0x08, 0x16, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0x60, 0x20, 0x4F, 0x9C, 0x36, 0xD6,
+    0x6B, 0x8B, 0xE9, 0x82, 0xC8, 0x82, 0xC8, 0x82, 0x72, 0xCD, 0xAB, 0x93, 0xE0, 0x40, 0x62, 0x59,
+    0xA2, 0x61, 0x22, 0x8A, 0x82, 0xCB, 0x03, 0xB3, 0x03, 0x7A, 0xA3, 0x59, 0x83, 0x51, 0x83, 0x49,
+    0x83, 0x49, 0x80, 0x9B, 0x04, 0x81, 0x9D, 0x04, 0x05, 0x64, 0x49, 0x64, 0x49, 0x23, 0x41, 0xC1,
+    0x30, 0xE1, 0x38, 0x02, 0x31, 0x80, 0xB0, 0x08, 0x04, 0x61, 0x18, 0xA3, 0x18, 0x25, 0x29, 0xE4,
+    0x20, 0xE4, 0x18, 0x81, 0xC6, 0x0C, 0x02, 0xC4, 0x18, 0xA3, 0x18, 0xC4, 0x10, 0x82, 0x9B, 0x04,
+    0x86, 0xB6, 0x08, 0x81, 0x01, 0x80, 0xDE, 0x0C, 0x82, 0x0F, 0x83, 0xE0, 0x02, 0x01, 0x06, 0x19,
+    0x83, 0x10, 0x89, 0xC7, 0x03, 0xC6, 0x01, 0x89, 0x98, 0x04, 0x00, 0x01, 0x00, 0x84, 0x8D, 0x0C,
+    0x80, 0xCD, 0x03, 0x00, 0x26, 0x21, 0x81, 0xF8, 0x0B, 0x09, 0x21, 0x00, 0xC4, 0x18, 0x21, 0x00,
+    0xA4, 0x10, 0x62, 0x08, 0xA3, 0x10, 0xC9, 0x31, 0x67, 0x29, 0x05, 0x19, 0x83, 0x10, 0x80, 0x0B,
+    0x80, 0xA7, 0x08, 0x01, 0xE4, 0x10, 0xA3, 0x10, 0x80, 0x8E, 0x08, 0x02, 0x62, 0x08, 0xA5, 0x08,
+    0xA5, 0x08, 0x80, 0xE8, 0x08, 0x00, 0x41, 0x00, 0x80, 0xD4, 0x08, 0x00, 0x62, 0x08, 0x82, 0xC9,
+    0x0C, 0x89, 0x97, 0x04, 0x80, 0x01, 0x04, 0x41, 0x00, 0x01, 0x00, 0xCE, 0x73, 0x9D, 0xF7, 0x7C,
+    0xEF, 0x80, 0xC8, 0x04, 0x82, 0x98, 0x04, 0x04, 0x66, 0x29, 0x78, 0xCE, 0x45, 0x21, 0x24, 0x21,
+    0x82, 0x08, 0x80, 0x94, 0x04, 0x81, 0x95, 0x04, 0x81, 0x01, 0x86, 0x98, 0x04, 0x00, 0x87, 0x29,
+    0x80, 0xD1, 0x05, 0x83, 0xBC, 0x02, 0x02, 0x8E, 0x6B, 0xDC, 0xCE, 0x78, 0x9D, 0x84, 0xD1, 0x03,
+    0x00, 0xDC, 0xCE, 0x80, 0xF3, 0x0B, 0x81, 0xFB, 0x03, 0x01, 0x7B, 0xC6, 0xF9, 0xAD, 0x81, 0x81,
+    0x03, 0x03, 0x98, 0xA5, 0x77, 0x9D, 0x7B, 0xC6, 0xF4, 0x9C, 0x85, 0x8A, 0x0B, 0x01, 0x4D, 0x6B,
+    0xFD, 0xD6, 0x84, 0x1E, 0x00, 0xDD, 0xCE, 0x81, 0x1E, 0x00, 0x82, 0x10, 0x80, 0x8B, 0x07, 0x81,
+    0xF4, 0x07, 0x81, 0xCE, 0x08, 0x00, 0xBC, 0xCE, 0x80, 0x95, 0x0D, 0x82, 0x01, 0x02, 0x62, 0x08,
+    0x19, 0xBE, 0x3A, 0xBE, 0x80, 0x0C, 0x81, 0xEB, 0x03, 0x02, 0xF9, 0xB5, 0x7A, 0xC6, 0xA3, 0x10,
+    0x80, 0x85, 0x0B, 0x02, 0xD8, 0xB5, 0xF9, 0xAD, 0x78, 0xA5, 0x80, 0x26, 0x04, 0x78, 0xA5, 0x78,
+    0xA5, 0xB8, 0xA5, 0x7B, 0xC6, 0x25, 0x21, 0x83, 0xB0, 0x08, 0x81, 0x46, 0x81, 0x48, 0x80, 0x55,
+    0x81, 0xCF, 0x04, 0x81, 0x01, 0x01, 0xA3, 0x10, 0x2D, 0x63, 0x80, 0xD5, 0x08, 0x81, 0xC0, 0x04,
+    0x82, 0xC5, 0x04, 0x82, 0xEC, 0x08, 0x01, 0x00, 0x00, 0xC8, 0x39, 0x80, 0xD5, 0x0C, 0x80, 0xEF,
+    0x04, 0x00, 0xB9, 0xAD, 0x80, 0xBA, 0x04, 0x00, 0x5B, 0xBE, 0x80, 0xB1, 0x03, 0x82, 0xA5, 0x03,
+    0x80, 0x04, 0x02, 0x76, 0xA5, 0x3A, 0xB6, 0x77, 0x9D, 0x82, 0x66, 0x01, 0x5A, 0xBE, 0x96, 0xAD,
+    0x80, 0x0B, 0x80, 0xC1, 0x09, 0x00, 0xB9, 0xAD, 0x80, 0x4A, 0x05, 0x78, 0xA5, 0x77, 0xA5, 0x77,
+    0xA5, 0xB8, 0xA5, 0x9B, 0xCE, 0x24, 0x21, 0x82, 0x80, 0x0A, 0x81, 0x1D, 0x01, 0x56, 0xA5, 0x5B,
+    0xBE, 0x81, 0x5B, 0x81, 0x5D, 0x00, 0xFD, 0xD6, 0x80, 0x9F, 0x0C, 0x80, 0x01, 0x01, 0x35, 0xA5,
+    0x9C, 0xC6, 0x80, 0xD3, 0x04, 0x80, 0xF1, 0x04, 0x80, 0x3B, 0x01, 0xDC, 0xCE, 0xAB, 0x52, 0x84,
+    0xA3, 0x02, 0x01, 0x35, 0xA5, 0x9B, 0xC6, 0x80, 0x98, 0x04, 0x82, 0xF2, 0x09, 0x00, 0xFD, 0xD6,
+    0x80, 0xA4, 0x08, 0x01, 0x00, 0x00, 0xB3, 0x94, 0x80, 0x3B, 0x80, 0x58, 0x01, 0xB9, 0xAD, 0xB9,
+    0xA5, 0x80, 0x9C, 0x05, 0x00, 0x86, 0x31, 0x82, 0xBB, 0x02, 0x80, 0x01, 0x01, 0x6E, 0x6B, 0xBC,
+    0xCE, 0x83, 0xF9, 0x08, 0x01, 0x77, 0x9D, 0xDC, 0xD6, 0x80, 0x2C, 0x8B, 0xD6, 0x0C, 0x83, 0xE4,
+    0x02, 0x84, 0x95, 0x04, 0x84, 0xB0, 0x08, 0x02, 0x21, 0x00, 0x21, 0x08, 0x21, 0x08, 0x80, 0x89,
+    0x0E, 0x02, 0xEB, 0x62, 0x00, 0x00, 0x61, 0x10, 0x81, 0x98, 0x04, 0x16, 0xA1, 0x20, 0x80, 0x28,
+    0xC1, 0x30, 0x32, 0xBD, 0x93, 0xCD, 0x09, 0x8B, 0xE8, 0x8A, 0xC7, 0x8A, 0x48, 0x93, 0x92, 0xCD,
+    0xA6, 0x7A, 0x20, 0x59, 0xC2, 0x71, 0x82, 0x9A, 0x02, 0xE4, 0x82, 0xCB, 0x63, 0x92, 0x03, 0x72,
+    0xA2, 0x59, 0xA3, 0x59, 0xA3, 0x59, 0xA3, 0x51, 0x83, 0x51, 0x80, 0x9D, 0x04, 0x05, 0xA3, 0x51,
+    0xA4, 0x51, 0x84, 0x51, 0x42, 0x49, 0x21, 0x49, 0x22, 0x41, 0x80, 0xAF, 0x08, 0x80, 0x98, 0x04,
+    0x02, 0xC3, 0x20, 0x05, 0x29, 0xE4, 0x20, 0x82, 0x97, 0x04, 0x80, 0x01, 0x00, 0xE4, 0x18, 0x80,
+    0x9F, 0x04, 0x00, 0xC4, 0x10, 0x80, 0x01, 0x82, 0xB4, 0x08, 0x83, 0x9F, 0x04, 0x83, 0x01, 0x01,
+    0xA3, 0x08, 0xA3, 0x08, 0x80, 0xB2, 0x07, 0x81, 0x01, 0x01, 0xE5, 0x18, 0xA4, 0x10, 0x84, 0x83,
+    0x01, 0xD4, 0x98, 0x04, 0x83, 0xC0, 0x01, 0x80, 0xDC, 0x03, 0x80, 0xE8, 0x03, 0x02, 0x21, 0x00,
+    0x62, 0x08, 0xC4, 0x10, 0x80, 0x89, 0x0C, 0x80, 0xC0, 0x01, 0x80, 0xE8, 0x03, 0x00, 0x83, 0x08,
+    0x80, 0x83, 0x03, 0x81, 0x12, 0x00, 0x42, 0x08, 0x80, 0x79, 0x01, 0xA3, 0x08, 0xA3, 0x10, 0x80,
+    0xF2, 0x03, 0x06, 0x84, 0x08, 0xC6, 0x08, 0xE8, 0x08, 0xAC, 0x19, 0x49, 0x11, 0x63, 0x08, 0x82,
+    0x08, 0x80, 0x96, 0x04, 0x81, 0x01, 0x80, 0x12, 0x00, 0x83, 0x10, 0x89, 0x96, 0x04, 0x81, 0x98,
+    0x04, 0x05, 0x62, 0x08, 0xEB, 0x5A, 0x8D, 0x6B, 0x1A, 0xDF, 0x24, 0x21, 0x01, 0x00, 0x82, 0x98,
+    0x04, 0x05, 0x24, 0x21, 0x7C, 0xEF, 0x5B, 0xE7, 0x9C, 0xEF, 0xD9, 0xD6, 0xA6, 0x31, 0x85, 0x99,
+    0x04, 0x86, 0x98, 0x04, 0x00, 0x67, 0x29, 0x83, 0x98, 0x04, 0x80, 0x60, 0x01, 0xB3, 0x8C, 0x7B,
+    0xBE, 0x83, 0x92, 0x03, 0x80, 0xC1, 0x02, 0x81, 0xD1, 0x03, 0x80, 0x01, 0x02, 0x86, 0x31, 0xDC,
+    0xD6, 0xB9, 0xAD, 0x82, 0x0D, 0x01, 0x57, 0x9D, 0xBC, 0xCE, 0x84, 0xBE, 0x0F, 0x80, 0x20, 0x01,
+    0x52, 0x84, 0xBC, 0xCE, 0x83, 0x94, 0x03, 0x01, 0x98, 0xA5, 0x9B, 0xCE, 0x82, 0x1E, 0x02, 0x76,
+    0xAD, 0x3B, 0xB6, 0x98, 0xA5, 0x83, 0xF4, 0x07, 0x02, 0x3A, 0xBE, 0xF8, 0xBD, 0x6A, 0x4A, 0x80,
+    0xE3, 0x0E, 0x02, 0xE4, 0x18, 0x08, 0x42, 0x76, 0xAD, 0x80, 0x9B, 0x0C, 0x80, 0x0D, 0x80, 0xA5,
+    0x03, 0x02, 0x77, 0x9D, 0xDC, 0xCE, 0x92, 0x8C, 0x80, 0x1B, 0x02, 0xE4, 0x18, 0x5A, 0xC6, 0x98,
+    0xA5, 0x80, 0xE0, 0x04, 0x80, 0x97, 0x04, 0x02, 0x77, 0x9D, 0xD9, 0xAD, 0xF8, 0xB5, 0x81, 0x58,
+    0x03, 0x00, 0x00, 0xCC, 0x5A, 0xFD, 0xD6, 0x98, 0x9D, 0x84, 0xCF, 0x04, 0x09, 0xB8, 0xA5, 0x9B,
+    0xC6, 0xF4, 0x94, 0x6E, 0x6B, 0x0C, 0x5B, 0x8E, 0x6B, 0x93, 0x94, 0x5A, 0xC6, 0xFD, 0xD6, 0x3A,
+    0xB6, 0x82, 0x0D, 0x81, 0xA5, 0x03, 0x83, 0xEC, 0x08, 0x80, 0x2E, 0x02, 0x7A, 0xC6, 0xD9, 0xAD,
+    0xB9, 0xA5, 0x82, 0x87, 0x09, 0x09, 0xB9, 0xA5, 0xDC, 0xCE, 0x8E, 0x6B, 0x04, 0x21, 0x62, 0x08,
+    0x41, 0x08, 0x82, 0x10, 0xC7, 0x39, 0x15, 0x9D, 0x9B, 0xC6, 0x83, 0x85, 0x01, 0x02, 0x77, 0xA5,
+    0x1D, 0xD7, 0x4D, 0x63, 0x80, 0x4A, 0x00, 0x6A, 0x4A, 0x80, 0x8A, 0x05, 0x06, 0x78, 0x9D, 0x77,
+    0x9D, 0x77, 0x9D, 0x77, 0xA5, 0x77, 0x9D, 0xF9, 0xAD, 0x19, 0xBE, 0x80, 0xCF, 0x0E, 0x83, 0xC7,
+    0x0C, 0x02, 0x61, 0x08, 0x39, 0xBE, 0x3A, 0xB6, 0x82, 0x84, 0x01, 0x00, 0x77, 0xA5, 0x80, 0xEF,
+    0x03, 0x00, 0xC7, 0x39, 0x81, 0x84, 0x01, 0x00, 0x31, 0x84, 0x81, 0xD5, 0x0C, 0x82, 0xED, 0x03,
+    0x03, 0x1A, 0xB6, 0x39, 0xBE, 0x49, 0x42, 0xA3, 0x10, 0x80, 0xA4, 0x06, 0x00, 0xC7, 0x31, 0x80,
+    0x8B, 0x04, 0x83, 0x87, 0x0E, 0x02, 0x98, 0xA5, 0x7B, 0xC6, 0x97, 0xAD, 0x81, 0xB6, 0x0A, 0x00,
+    0x8F, 0x73, 0x80, 0x3B, 0x82, 0xFD, 0x04, 0x0A, 0x78, 0x9D, 0x5B, 0xBE, 0x56, 0xA5, 0xA7, 0x31,
+    0x62, 0x08, 0x21, 0x00, 0x41, 0x08, 0xE3, 0x18, 0xEC, 0x5A, 0x5A, 0xC6, 0xF9, 0xAD, 0x81, 0xDC,
+    0x0D, 0x80, 0x2C, 0x00, 0xF9, 0xAD, 0x81, 0xB8, 0x05, 0x8E, 0xA4, 0x03, 0x81, 0x92, 0x04, 0x81,
+    0x02, 0x81, 0xE9, 0x02, 0x84, 0xB1, 0x08, 0x80, 0x98, 0x04, 0x04, 0x20, 0x08, 0x00, 0x00, 0x0B,
+    0x6B, 0x28, 0x4A, 0x00, 0x08, 0x80, 0x97, 0x04, 0x80, 0x98, 0x04, 0x18, 0xC1, 0x28, 0xA0, 0x30,
+    0x83, 0x49, 0xD4, 0xD5, 0xAF, 0xB4, 0x08, 0x93, 0x27, 0x9B, 0xE6, 0x92, 0xEA, 0xAB, 0x91, 0xD5,
+    0x22, 0x82, 0xE1, 0x81, 0xC2, 0xAA, 0x81, 0xF4, 0x22, 0xE4, 0xC3, 0xAA, 0x63, 0x8A, 0x03, 0x72,
+    0x03, 0x6A, 0xE3, 0x69, 0xE3, 0x61, 0xC2, 0x61, 0xC3, 0x61, 0xC3, 0x61, 0xE3, 0x61, 0x80, 0x03,
+    0x0A, 0xA2, 0x69, 0x41, 0x51, 0xE2, 0x30, 0xE2, 0x28, 0xC2, 0x20, 0xA2, 0x20, 0x81, 0x20, 0xE3,
+    0x28, 0x04, 0x29, 0xC3, 0x20, 0xC3, 0x18, 0x80, 0x01, 0x80, 0x81, 0x02, 0x80, 0x02, 0x01, 0x05,
+    0x19, 0x05, 0x19, 0x81, 0x9E, 0x04, 0x81, 0x9A, 0x04, 0x00, 0xC4, 0x18, 0x81, 0x02, 0x85, 0xBB,
+    0x08, 0x81, 0x04, 0x82, 0xE0, 0x02, 0x01, 0xC5, 0x10, 0xE5, 0x18, 0xCF, 0x98, 0x04, 0x83, 0xAF,
+    0x01, 0x86, 0x96, 0x04, 0x81, 0x0D, 0x82, 0xEB, 0x03, 0x80, 0x06, 0x80, 0xA9, 0x08, 0x81, 0xC3,
+    0x01, 0x00, 0x05, 0x19, 0x80, 0x9A, 0x08, 0x01, 0xA3, 0x10, 0x01, 0x00, 0x82, 0x9B, 0x08, 0x81,
+    0xC2, 0x0D, 0x03, 0xA4, 0x10, 0x42, 0x00, 0xC6, 0x08, 0xE7, 0x10, 0x80, 0x01, 0x01, 0xE6, 0x10,
+    0xA4, 0x08, 0x80, 0x97, 0x04, 0x06, 0x22, 0x00, 0x02, 0x00, 0x02, 0x00, 0x22, 0x00, 0x62, 0x08,
+    0x42, 0x00, 0x83, 0x10, 0x80, 0xBF, 0x08, 0x81, 0xBF, 0x0C, 0x81, 0xC1, 0x0C, 0x81, 0x94, 0x04,
+    0x82, 0x99, 0x04, 0x80, 0xC8, 0x04, 0x02, 0x25, 0x21, 0x1A, 0xDF, 0x45, 0x21, 0x82, 0x98, 0x04,
+    0x06, 0x21, 0x00, 0x04, 0x19, 0xB2, 0x94, 0x8A, 0x52, 0xC6, 0x31, 0x37, 0xBE, 0xD6, 0xB5, 0x81,
+    0xCA, 0x0C, 0x82, 0x99, 0x04, 0x86, 0x98, 0x04, 0x00, 0x47, 0x21, 0x85, 0x98, 0x04, 0x01, 0x77,
+    0xAD, 0x1A, 0xB6, 0x80, 0xF1, 0x02, 0x82, 0x01, 0x01, 0xF9, 0xAD, 0xF8, 0xBD, 0x82, 0xD1, 0x03,
+    0x80, 0x95, 0x03, 0x81, 0xAC, 0x07, 0x81, 0xDF, 0x03, 0x01, 0xFD, 0xCE, 0xEB, 0x5A, 0x85, 0x98,
+    0x04, 0x00, 0x36, 0xA5, 0x80, 0xE8, 0x07, 0x82, 0xAB, 0x07, 0x01, 0xF9, 0xAD, 0xF8, 0xB5, 0x80,
+    0xA5, 0x03, 0x80, 0x0D, 0x02, 0x0D, 0x5B, 0x1E, 0xD7, 0x98, 0xA5, 0x81, 0x97, 0x04, 0x81, 0x95,
+    0x03, 0x06, 0x3A, 0xBE, 0xBC, 0xCE, 0x5A, 0xC6, 0x3A, 0xBE, 0x3A, 0xBE, 0x9C, 0xCE, 0x7B, 0xBE,
+    0x82, 0x85, 0x03, 0x03, 0xB8, 0xA5, 0x78, 0xA5, 0x3A, 0xBE, 0x9B, 0xCE, 0x80, 0xB7, 0x0B, 0x02,
+    0x00, 0x00, 0xE8, 0x39, 0x9B, 0xCE, 0x80, 0xCC, 0x03, 0x00, 0x78, 0x9D, 0x80, 0xD0, 0x03, 0x02,
+    0x57, 0x9D, 0x3A, 0xB6, 0x56, 0xA5, 0x82, 0x80, 0x08, 0x02, 0xE4, 0x18, 0xBC, 0xCE, 0xF9, 0xAD,
+    0x86, 0x99, 0x04, 0x05, 0x7B, 0xBE, 0xDD, 0xCE, 0xFD, 0xD6, 0xDD, 0xCE, 0x9C, 0xC6, 0x3A, 0xB6,
+    0x80, 0x87, 0x04, 0x81, 0x36, 0x82, 0xC3, 0x08, 0x01, 0x1A, 0xB6, 0x19, 0xBE, 0x80, 0xC0, 0x0D,
+    0x81, 0x84, 0x08, 0x00, 0xF4, 0x94, 0x80, 0x9B, 0x0C, 0x83, 0xDE, 0x03, 0x00, 0xD9, 0xAD, 0x80,
+    0x49, 0x03, 0xF8, 0xB5, 0xB7, 0xB5, 0xF8, 0xBD, 0x9B, 0xCE, 0x80, 0x65, 0x00, 0x77, 0x9D, 0x81,
+    0xFB, 0x03, 0x01, 0x57, 0x9D, 0x5A, 0xBE, 0x80, 0x1D, 0x80, 0x4A, 0x01, 0x8E, 0x73, 0xDD, 0xCE,
+    0x81, 0x95, 0x04, 0x81, 0x01, 0x01, 0x3A, 0xB6, 0x55, 0xA5, 0x83, 0x95, 0x06, 0x80, 0x2C, 0x00,
+    0x24, 0x21, 0x80, 0xFB, 0x03, 0x81, 0x82, 0x01, 0x80, 0x98, 0x04, 0x02, 0xB8, 0xA5, 0x5A, 0xC6,
+    0xC3, 0x18, 0x81, 0x92, 0x02, 0x01, 0xE8, 0x39, 0x1E, 0xD7, 0x80, 0x4B, 0x82, 0x3A, 0x80, 0x77,
+    0x04, 0xFC, 0xD6, 0x5A, 0xC6, 0xF8, 0xBD, 0x39, 0xC6, 0xBC, 0xCE, 0x80, 0xAE, 0x08, 0x83, 0xE7,
+    0x0D, 0x02, 0xD9, 0xAD, 0x3D, 0xDF, 0x08, 0x42, 0x82, 0xD6, 0x05, 0x00, 0xFD, 0xD6, 0x81, 0x2A,
+    0x82, 0x01, 0x06, 0x5B, 0xBE, 0xBC, 0xCE, 0xF8, 0xB5, 0x96, 0xAD, 0xB7, 0xB5, 0x3A, 0xBE, 0x7B,
+    0xC6, 0x82, 0x0E, 0x81, 0x2B, 0x00, 0x3E, 0xDF, 0x84, 0xB5, 0x09, 0x88, 0x01, 0x84, 0x8F, 0x04,
+    0x82, 0x91, 0x04, 0x82, 0xED, 0x02, 0x84, 0x98, 0x04, 0x07, 0x41, 0x08, 0x20, 0x08, 0x41, 0x10,
+    0x2B, 0x6B, 0x24, 0x31, 0x40, 0x10, 0x81, 0x20, 0x81, 0x20, 0x80, 0x98, 0x04, 0x24, 0xE1, 0x38,
+    0xA0, 0x38, 0xA7, 0x72, 0xF4, 0xD5, 0xEB, 0xAB, 0x47, 0xA3, 0x67, 0xAB, 0x66, 0xAB, 0x0D, 0xD5,
+    0x0D, 0xD5, 0x20, 0x9A, 0x21, 0xC3, 0x22, 0xF5, 0xA2, 0xEC, 0x22, 0xC3, 0xE3, 0xA2, 0x83, 0x92,
+    0x63, 0x8A, 0x43, 0x82, 0x43, 0x7A, 0x22, 0x7A, 0x23, 0x7A, 0x43, 0x7A, 0x23, 0x7A, 0x23, 0x7A,
+    0x63, 0x8A, 0xA2, 0x69, 0x01, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xC2, 0x28, 0xC2, 0x28, 0xA1, 0x20,
+    0x04, 0x29, 0x24, 0x29, 0xE4, 0x20, 0xE3, 0x20, 0x82, 0x99, 0x04, 0x82, 0x03, 0x82, 0xB1, 0x08,
+    0x02, 0xC4, 0x10, 0xC4, 0x18, 0xA4, 0x18, 0x83, 0xBF, 0x08, 0x83, 0xB6, 0x08, 0x80, 0xB0, 0x07,
+    0x83, 0x98, 0x04, 0x01, 0xC4, 0x10, 0x05, 0x19, 0x82, 0xC5, 0x03, 0x8E, 0xA5, 0x09, 0xBB, 0x97,
+    0x04, 0x80, 0xEA, 0x07, 0x00, 0x42, 0x00, 0x89, 0xC2, 0x01, 0x81, 0xCC, 0x03, 0x83, 0x98, 0x04,
+    0x01, 0xC5, 0x10, 0x83, 0x08, 0x81, 0xC4, 0x01, 0x00, 0x05, 0x19, 0x80, 0x98, 0x08, 0x01, 0xA4,
+    0x10, 0x01, 0x00, 0x83, 0xD8, 0x03, 0x80, 0x98, 0x04, 0x03, 0xC4, 0x10, 0x42, 0x00, 0xA4, 0x08,
+    0xC5, 0x10, 0x80, 0x01, 0x00, 0x84, 0x08, 0x80, 0x9E, 0x0F, 0x07, 0x82, 0x08, 0x42, 0x29, 0x42,
+    0x52, 0x43, 0x83, 0x63, 0xAC, 0x84, 0xD5, 0x82, 0x5A, 0x43, 0x00, 0x82, 0x98, 0x04, 0x82, 0xA9,
+    0x08, 0x83, 0xAF, 0x08, 0x80, 0x97, 0x04, 0x80, 0xA8, 0x08, 0x04, 0x45, 0x21, 0xD9, 0xD6, 0x86,
+    0x29, 0x01, 0x00, 0x42, 0x08, 0x80, 0x01, 0x80, 0x0C, 0x81, 0x49, 0x02, 0xCA, 0x52, 0xFA, 0xD6,
+    0xA3, 0x10, 0x84, 0xE1, 0x04, 0x80, 0x46, 0x00, 0x83, 0x08, 0x82, 0xD9, 0x04, 0x01, 0x62, 0x00,
+    0x26, 0x21, 0x84, 0x98, 0x04, 0x02, 0x82, 0x10, 0x19, 0xBE, 0xB9, 0xAD, 0x81, 0xAB, 0x07, 0x80,
+    0xF6, 0x02, 0x02, 0x77, 0x9D, 0x5A, 0xBE, 0x15, 0x9D, 0x81, 0x7B, 0x02, 0x00, 0x00, 0xAF, 0x73,
+    0xDD, 0xCE, 0x83, 0xF6, 0x07, 0x01, 0x78, 0x9D, 0xDC, 0xCE, 0x80, 0x9B, 0x07, 0x83, 0x97, 0x04,
+    0x80, 0xAB, 0x0C, 0x00, 0xFA, 0xB5, 0x82, 0x97, 0x04, 0x01, 0x77, 0x9D, 0x3A, 0xBE, 0x80, 0xD8,
+    0x0C, 0x81, 0x1E, 0x02, 0x41, 0x08, 0x97, 0xAD, 0xFD, 0xCE, 0x85, 0xF7, 0x07, 0x81, 0xD0, 0x0C,
+    0x81, 0xD9, 0x08, 0x83, 0xAC, 0x0C, 0x02, 0x5A, 0xBE, 0xFC, 0xD6, 0x49, 0x42, 0x81, 0x1B, 0x02,
+    0xEC, 0x5A, 0xBC, 0xCE, 0x57, 0x9D, 0x81, 0xCC, 0x03, 0x03, 0x57, 0x9D, 0x37, 0x9D, 0x7B, 0xBE,
+    0x31, 0x84, 0x83, 0x57, 0x01, 0xD0, 0x73, 0x5E, 0xDF, 0x81, 0xBF, 0x08, 0x83, 0x98, 0x04, 0x80,
+    0x94, 0x08, 0x82, 0x01, 0x02, 0xF9, 0xAD, 0x9B, 0xC6, 0x5A, 0xC6, 0x80, 0xD4, 0x07, 0x82, 0xD9,
+    0x0C, 0x01, 0x5B, 0xBE, 0x76, 0xA5, 0x83, 0xF8, 0x05, 0x02, 0x66, 0x29, 0xFC, 0xD6, 0x3A, 0xB6,
+    0x80, 0x20, 0x82, 0xDF, 0x03, 0x81, 0x4A, 0x03, 0xF9, 0xAD, 0xB9, 0xA5, 0x78, 0x9D, 0x57, 0x9D,
+    0x80, 0xD2, 0x04, 0x80, 0xD5, 0x04, 0x00, 0x57, 0x9D, 0x80, 0xEA, 0x03, 0x82, 0xE4, 0x0C, 0x03,
+    0x72, 0x8C, 0x9C, 0xC6, 0x57, 0x9D, 0x78, 0xA5, 0x80, 0x0F, 0x80, 0x73, 0x01, 0x9B, 0xC6, 0x51,
+    0x84, 0x82, 0x2A, 0x80, 0x03, 0x01, 0x00, 0x00, 0x08, 0x42, 0x84, 0xCB, 0x0D, 0x80, 0xC1, 0x08,
+    0x00, 0xB7, 0xAD, 0x83, 0xB0, 0x06, 0x00, 0xB4, 0x94, 0x85, 0xDA, 0x0D, 0x80, 0x40, 0x80, 0x3A,
+    0x80, 0x90, 0x08, 0x82, 0x62, 0x81, 0xD5, 0x05, 0x01, 0x5E, 0xDF, 0x4D, 0x6B, 0x83, 0xAF, 0x02,
+    0x00, 0x52, 0x84, 0x80, 0xB9, 0x05, 0x84, 0x2C, 0x00, 0x78, 0x9D, 0x80, 0x72, 0x80, 0x95, 0x04,
+    0x80, 0x92, 0x01, 0x83, 0x0D, 0x01, 0x1D, 0xD7, 0x35, 0xA5, 0x80, 0xCB, 0x08, 0x90, 0xA0, 0x03,
+    0x01, 0x21, 0x00, 0x20, 0x00, 0x82, 0x99, 0x04, 0x80, 0x05, 0x87, 0x98, 0x04, 0x80, 0x99, 0x04,
+    0x01, 0xA2, 0x18, 0xEA, 0x62, 0x80, 0x97, 0x04, 0x15, 0xA1, 0x28, 0xC1, 0x28, 0xC1, 0x30, 0xE1,
+    0x38, 0x21, 0x49, 0x00, 0x49, 0x0C, 0xA4, 0x71, 0xD5, 0xC9, 0xB3, 0xA7, 0xBB, 0xE7, 0xC3, 0x07,
+    0xC4, 0x0F, 0xEE, 0x47, 0xD4, 0x40, 0xD3, 0xC2, 0xFD, 0x42, 0xF5, 0x82, 0xD3, 0x42, 0xBB, 0xE2,
+    0xAA, 0xC3, 0xA2, 0xA3, 0x9A, 0x80, 0x01, 0x05, 0x83, 0x92, 0x83, 0x92, 0x82, 0x9A, 0xC2, 0xA2,
+    0x42, 0x82, 0x41, 0x51, 0x80, 0xC8, 0x0C, 0x81, 0x99, 0x04, 0x06, 0xA1, 0x28, 0x24, 0x31, 0x24,
+    0x31, 0xE4, 0x28, 0x04, 0x21, 0x04, 0x21, 0xE4, 0x20, 0x81, 0x01, 0x81, 0xC8, 0x0C, 0x00, 0xC4,
+    0x18, 0x81, 0xA3, 0x08, 0x84, 0x95, 0x04, 0x01, 0xA4, 0x18, 0xA4, 0x18, 0x80, 0xAB, 0x07, 0x80,
+    0x01, 0x82, 0xCA, 0x0C, 0x83, 0x9F, 0x03, 0x00, 0xE5, 0x18, 0x80, 0x98, 0x07, 0xC9, 0x01, 0x81,
+    0xA3, 0x0C, 0x00, 0x62, 0x08, 0x80, 0xB7, 0x03, 0x8B, 0x98, 0x04, 0x80, 0xF0, 0x07, 0x83, 0x01,
+    0x01, 0xA4, 0x10, 0x63, 0x08, 0x81, 0x9A, 0x03, 0x00, 0x05, 0x21, 0x80, 0x98, 0x04, 0x00, 0xC4,
+    0x10, 0x84, 0xB0, 0x08, 0x00, 0xA3, 0x08, 0x80, 0x98, 0x04, 0x0F, 0x41, 0x08, 0x83, 0x08, 0xA4,
+    0x08, 0xA4, 0x10, 0x83, 0x08, 0xE1, 0x20, 0x82, 0x6A, 0xC2, 0x9B, 0x02, 0xC5, 0x02, 0xEE, 0xA3,
+    0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x84, 0xFF, 0x23, 0x9C, 0x23, 0x00, 0x80, 0x98, 0x04, 0x84, 0x92,
+    0x04, 0x85, 0x98, 0x04, 0x00, 0x42, 0x08, 0x80, 0xA8, 0x08, 0x01, 0xB9, 0xD6, 0xE7, 0x39, 0x83,
+    0x98, 0x04, 0x00, 0x41, 0x00, 0x81, 0x47, 0x02, 0x2B, 0x5B, 0xFA, 0xD6, 0x82, 0x08, 0x85, 0x98,
+    0x04, 0x00, 0x00, 0x00, 0x80, 0x98, 0x04, 0x81, 0x42, 0x01, 0x42, 0x00, 0x26, 0x21, 0x80, 0x50,
+    0x82, 0xC1, 0x03, 0x01, 0x66, 0x29, 0x5B, 0xC6, 0x80, 0xCD, 0x03, 0x81, 0x01, 0x80, 0x05, 0x00,
+    0x7B, 0xC6, 0x82, 0xD1, 0x03, 0x80, 0xA2, 0x0F, 0x00, 0x7C, 0xC6, 0x81, 0x0B, 0x80, 0x01, 0x80,
+    0x97, 0x0B, 0x80, 0x9B, 0x07, 0x83, 0x98, 0x04, 0x01, 0x25, 0x21, 0x9B, 0xCE, 0x80, 0xA7, 0x0C,
+    0x81, 0x01, 0x02, 0x37, 0x95, 0xBC, 0xC6, 0xD0, 0x73, 0x83, 0x2E, 0x03, 0xE4, 0x18, 0xD8, 0xB5,
+    0x1D, 0xD7, 0x1A, 0xB6, 0x84, 0xEE, 0x03, 0x82, 0xE5, 0x03, 0x00, 0x98, 0x9D, 0x81, 0x01, 0x02,
+    0xF9, 0xAD, 0xFD, 0xD6, 0x39, 0xBE, 0x80, 0xCD, 0x03, 0x81, 0xF7, 0x02, 0x03, 0xF0, 0x7B, 0x7B,
+    0xBE, 0x36, 0x95, 0x37, 0x95, 0x81, 0x01, 0x02, 0x16, 0x95, 0xBC, 0xC6, 0x2D, 0x5B, 0x83, 0x39,
+    0x03, 0x21, 0x00, 0xD4, 0x94, 0x5E, 0xE7, 0x1A, 0xB6, 0x80, 0x37, 0x86, 0x99, 0x04, 0x01, 0xD9,
+    0xAD, 0x9B, 0xC6, 0x80, 0xB0, 0x0C, 0x01, 0xB7, 0xAD, 0x1A, 0xB6, 0x80, 0xFA, 0x03, 0x81, 0xD1,
+    0x08, 0x00, 0x9C, 0xC6, 0x80, 0xF4, 0x0C, 0x83, 0xCE, 0x0D, 0x02, 0x4A, 0x4A, 0xBC, 0xD6, 0x9C,
+    0xC6, 0x80, 0xEA, 0x08, 0x85, 0xE1, 0x03, 0x81, 0x93, 0x04, 0x81, 0x01, 0x03, 0xB8, 0xA5, 0xDC,
+    0xCE, 0x7A, 0xC6, 0x29, 0x42, 0x82, 0x83, 0x01, 0x02, 0x76, 0xA5, 0x1A, 0xB6, 0x37, 0x95, 0x82,
+    0x0F, 0x02, 0x37, 0x95, 0xBC, 0xCE, 0x8E, 0x6B, 0x82, 0xC7, 0x0C, 0x81, 0x2B, 0x01, 0x0C, 0x5B,
+    0xFD, 0xD6, 0x82, 0x83, 0x01, 0x02, 0x57, 0x9D, 0x36, 0x95, 0x3A, 0xB6, 0x81, 0x9C, 0x05, 0x81,
+    0x6A, 0x02, 0x62, 0x08, 0x15, 0x9D, 0x1E, 0xD7, 0x81, 0x5B, 0x82, 0xE0, 0x08, 0x85, 0x93, 0x09,
+    0x80, 0xA0, 0x04, 0x00, 0xBC, 0xC6, 0x82, 0x80, 0x0D, 0x80, 0x1A, 0x81, 0xB9, 0x05, 0x01, 0x15,
+    0x9D, 0x3E, 0xDF, 0x81, 0x67, 0x80, 0xC8, 0x05, 0x81, 0xB9, 0x09, 0x82, 0xD4, 0x01, 0x81, 0x27,
+    0x04, 0x78, 0x9D, 0x3A, 0xB6, 0x7E, 0xE7, 0x75, 0xA5, 0x61, 0x08, 0x82, 0xCA, 0x02, 0x81, 0xE7,
+    0x0C, 0x89, 0x01, 0x80, 0x59, 0x81, 0x92, 0x04, 0x85, 0xAC, 0x08, 0x83, 0x97, 0x04, 0x80, 0x98,
+    0x04, 0x26, 0x41, 0x10, 0x41, 0x10, 0x00, 0x08, 0x85, 0x39, 0x88, 0x5A, 0x60, 0x18, 0xA1, 0x28,
+    0xC1, 0x30, 0x01, 0x41, 0x21, 0x49, 0x41, 0x51, 0x41, 0x59, 0xC2, 0x71, 0x2F, 0xCD, 0xED, 0xD4,
+    0x07, 0xCC, 0x48, 0xCC, 0x87, 0xD4, 0x4A, 0xE5, 0x50, 0xFE, 0x42, 0xEC, 0x41, 0xFE, 0xE2, 0xFD,
+    0x01, 0xEC, 0xC2, 0xD3, 0x83, 0xC3, 0x63, 0xBB, 0x43, 0xB3, 0x23, 0xB3, 0x23, 0xB3, 0x03, 0xAB,
+    0x22, 0xB3, 0x42, 0xC3, 0xA2, 0x9A, 0x03, 0x72, 0x81, 0x61, 0x41, 0x51, 0x42, 0x49, 0x02, 0x41,
+    0x80, 0x99, 0x04, 0x04, 0xC2, 0x30, 0x44, 0x39, 0x44, 0x39, 0x03, 0x29, 0x04, 0x29, 0x81, 0x98,
+    0x04, 0x80, 0x9C, 0x04, 0x02, 0x04, 0x21, 0x05, 0x21, 0xE5, 0x20, 0x80, 0x9A, 0x04, 0x81, 0xB6,
+    0x08, 0x83, 0xB0, 0x08, 0x84, 0x95, 0x04, 0x80, 0xB6, 0x0B, 0x82, 0x9A, 0x04, 0x81, 0xAD, 0x04,
+    0x00, 0x05, 0x19, 0x80, 0xC8, 0x07, 0xC8, 0x95, 0x04, 0x00, 0x42, 0x00, 0x80, 0xF8, 0x03, 0x80,
+    0xAD, 0x08, 0x80, 0xCA, 0x03, 0x80, 0xC9, 0x03, 0x88, 0x98, 0x04, 0x86, 0xBB, 0x01, 0x82, 0x93,
+    0x09, 0x80, 0xC8, 0x0C, 0x80, 0x1E, 0x86, 0x98, 0x04, 0x80, 0xBE, 0x09, 0x00, 0x41, 0x00, 0x80,
+    0x09, 0x05, 0xA3, 0x08, 0x42, 0x00, 0xE1, 0x9B, 0x02, 0xFF, 0xE2, 0xFE, 0x02, 0xFF, 0x81, 0x01,
+    0x01, 0x23, 0xFF, 0xC4, 0xFF, 0x81, 0x98, 0x04, 0x80, 0x1D, 0x89, 0xAF, 0x08, 0x81, 0x98, 0x04,
+    0x02, 0xC3, 0x18, 0xB9, 0xCE, 0x28, 0x42, 0x80, 0xC6, 0x02, 0x80, 0x39, 0x80, 0x55, 0x00, 0x25,
+    0x21, 0x80, 0x0B, 0x01, 0x98, 0xCE, 0x12, 0x9D, 0x81, 0xE2, 0x04, 0x81, 0xE5, 0x0C, 0x81, 0x98,
+    0x04, 0x80, 0x97, 0x04, 0x83, 0x98, 0x04, 0x00, 0x83, 0x10, 0x83, 0xEA, 0x03, 0x09, 0x8A, 0x4A,
+    0x3E, 0xDF, 0x9B, 0xC6, 0x9B, 0xC6, 0x9C, 0xC6, 0xBC, 0xCE, 0xBC, 0xC6, 0xBC, 0xCE, 0xDC, 0xCE,
+    0xBF, 0xEF, 0x81, 0xDB, 0x02, 0x80, 0x01, 0x02, 0x39, 0xC6, 0x5E, 0xDF, 0x9C, 0xC6, 0x80, 0x01,
+    0x03, 0x7B, 0xC6, 0x5B, 0xBE, 0xFD, 0xD6, 0xF9, 0xBD, 0x82, 0xBB, 0x02, 0x81, 0x1F, 0x02, 0x49,
+    0x4A, 0x9F, 0xEF, 0xBC, 0xC6, 0x81, 0x11, 0x02, 0x7C, 0xC6, 0x7B, 0xC6, 0x3E, 0xDF, 0x82, 0xB3,
+    0x03, 0x81, 0x10, 0x06, 0x41, 0x00, 0x6E, 0x6B, 0x39, 0xBE, 0xFD, 0xD6, 0xBC, 0xCE, 0x5B, 0xBE,
+    0x1A, 0xB6, 0x80, 0x8D, 0x07, 0x81, 0x01, 0x07, 0xFA, 0xAD, 0x3B, 0xB6, 0x7C, 0xBE, 0xDD, 0xCE,
+    0xDC, 0xCE, 0x39, 0xBE, 0xAF, 0x73, 0x82, 0x10, 0x83, 0xAE, 0x0A, 0x02, 0x76, 0xAD, 0x1D, 0xD7,
+    0x7B, 0xC6, 0x80, 0x01, 0x04, 0x7B, 0xBE, 0x5B, 0xBE, 0x5B, 0xBE, 0x5E, 0xDF, 0x08, 0x3A, 0x85,
+    0x81, 0x0D, 0x04, 0x6D, 0x6B, 0x7A, 0xCE, 0xFD, 0xD6, 0x9C, 0xC6, 0x1A, 0xB6, 0x82, 0x26, 0x00,
+    0x3A, 0xB6, 0x81, 0xCA, 0x0C, 0x00, 0xB7, 0xAD, 0x80, 0xBC, 0x04, 0x01, 0xBB, 0xD6, 0x1E, 0xD7,
+    0x82, 0x49, 0x01, 0x7B, 0xBE, 0x7F, 0xE7, 0x80, 0xEE, 0x03, 0x00, 0x22, 0x00, 0x80, 0xCD, 0x01,
+    0x80, 0xE5, 0x09, 0x05, 0x00, 0x00, 0x46, 0x29, 0x15, 0x9D, 0xDC, 0xCE, 0xDD, 0xCE, 0x5B, 0xBE,
+    0x82, 0xF0, 0x07, 0x82, 0x98, 0x04, 0x80, 0xDB, 0x03, 0x80, 0xFA, 0x0B, 0x02, 0x7A, 0xC6, 0x31,
+    0x7C, 0xA3, 0x10, 0x81, 0xA1, 0x08, 0x80, 0xB1, 0x01, 0x00, 0xBC, 0xCE, 0x82, 0x29, 0x80, 0x93,
+    0x01, 0x02, 0xBC, 0xCE, 0xBF, 0xEF, 0xAA, 0x52, 0x85, 0x4A, 0x01, 0x51, 0x84, 0xBF, 0xEF, 0x80,
+    0x0D, 0x80, 0xA2, 0x01, 0x80, 0x88, 0x01, 0x01, 0x9F, 0xE7, 0x10, 0x7C, 0x83, 0x95, 0x01, 0x80,
+    0x05, 0x02, 0x2D, 0x63, 0x19, 0xBE, 0xDC, 0xD6, 0x80, 0x84, 0x01, 0x81, 0x90, 0x08, 0x81, 0xB9,
+    0x09, 0x80, 0x5F, 0x00, 0x5B, 0xBE, 0x80, 0x95, 0x04, 0x02, 0xDC, 0xCE, 0xF4, 0x94, 0x86, 0x31,
+    0x85, 0xEE, 0x03, 0x80, 0x03, 0x04, 0x6E, 0x6B, 0x7A, 0xC6, 0xFD, 0xD6, 0x7B, 0xBE, 0xF9, 0xAD,
+    0x80, 0x53, 0x80, 0x96, 0x04, 0x00, 0x57, 0x95, 0x81, 0x9A, 0x04, 0x04, 0x78, 0x9D, 0xFA, 0xAD,
+    0xBC, 0xC6, 0x1D, 0xDF, 0x9A, 0xCE, 0x80, 0x71, 0x85, 0x1B, 0x88, 0x01, 0x81, 0xA4, 0x04, 0x80,
+    0xAA, 0x08, 0x80, 0x05, 0x82, 0xDD, 0x02, 0x82, 0xB1, 0x08, 0x81, 0x96, 0x04, 0x83, 0x98, 0x04,
+    0x04, 0x61, 0x18, 0x20, 0x10, 0x47, 0x52, 0x64, 0x39, 0x80, 0x20, 0x80, 0x98, 0x04, 0x23, 0x61,
+    0x59, 0x81, 0x69, 0xA1, 0x79, 0x80, 0x79, 0x46, 0xAB, 0xD1, 0xE5, 0xEA, 0xDC, 0xC8, 0xDC, 0x09,
+    0xE5, 0x48, 0xE5, 0x4E, 0xF6, 0x4B, 0xFE, 0xC2, 0xFE, 0xA4, 0xFE, 0xE2, 0xFC, 0xA3, 0xEC, 0x43,
+    0xDC, 0x23, 0xD4, 0x03, 0xD4, 0xE3, 0xCB, 0xC3, 0xCB, 0xE3, 0xD3, 0x02, 0xDC, 0x02, 0xB3, 0x83,
+    0x92, 0x43, 0x82, 0xA1, 0x69, 0x81, 0x61, 0x62, 0x59, 0x42, 0x49, 0x22, 0x41, 0x01, 0x39, 0x02,
+    0x39, 0x64, 0x41, 0x44, 0x39, 0x23, 0x31, 0x80, 0xB3, 0x08, 0x00, 0x04, 0x29, 0x80, 0x01, 0x00,
+    0xE3, 0x20, 0x82, 0xB4, 0x08, 0x02, 0xE4, 0x20, 0xC4, 0x20, 0xC3, 0x20, 0x82, 0xD0, 0x0C, 0x01,
+    0xA3, 0x18, 0xA3, 0x18, 0x85, 0x95, 0x04, 0x00, 0x83, 0x10, 0x80, 0x95, 0x03, 0x80, 0xB1, 0x08,
+    0x81, 0xA4, 0x04, 0x01, 0xE5, 0x18, 0xA4, 0x10, 0x8A, 0xDA, 0x03, 0xBA, 0x95, 0x04, 0x00, 0x41,
+    0x00, 0x81, 0xDA, 0x07, 0x80, 0xBC, 0x03, 0x81, 0xF5, 0x07, 0x80, 0xD3, 0x03, 0x8A, 0x19, 0x81,
+    0x90, 0x0F, 0x82, 0xE1, 0x06, 0x82, 0xDC, 0x01, 0x01, 0x21, 0x00, 0xE5, 0x18, 0x80, 0xF5, 0x07,
+    0x88, 0xB0, 0x08, 0x80, 0xF0, 0x0C, 0x80, 0x84, 0x01, 0x02, 0x22, 0x00, 0x62, 0xB4, 0x42, 0xFF,
+    0x80, 0x98, 0x04, 0x05, 0x41, 0xFF, 0x61, 0xFF, 0x42, 0xFF, 0xE3, 0xFE, 0x23, 0xDE, 0x62, 0x5A,
+    0x80, 0xC8, 0x0C, 0x00, 0x62, 0x08, 0x85, 0x94, 0x04, 0x85, 0x01, 0x03, 0x21, 0x00, 0xA3, 0x10,
+    0xB8, 0xCE, 0x8A, 0x4A, 0x80, 0xC9, 0x03, 0x01, 0x45, 0x21, 0xC7, 0x31, 0x80, 0x08, 0x03, 0x98,
+    0xCE, 0xB9, 0xD6, 0x3A, 0xE7, 0xD5, 0xB5, 0x80, 0xC7, 0x0C, 0x81, 0x5E, 0x88, 0x98, 0x04, 0x01,
+    0x62, 0x00, 0x26, 0x19, 0x82, 0x98, 0x04, 0x80, 0x0D, 0x04, 0xA7, 0x31, 0x72, 0x8C, 0x72, 0x8C,
+    0x92, 0x8C, 0xB3, 0x94, 0x80, 0x01, 0x03, 0xD3, 0x94, 0xD4, 0x94, 0xF3, 0x9C, 0x66, 0x29, 0x82,
+    0x85, 0x01, 0x04, 0x10, 0x7C, 0xF4, 0x9C, 0xD3, 0x9C, 0xD3, 0x94, 0xD3, 0x94, 0x80, 0x0F, 0x01,
+    0xD4, 0x94, 0x0C, 0x5B, 0x85, 0x94, 0x03, 0x00, 0xC7, 0x39, 0x81, 0x0D, 0x82, 0x01, 0x01, 0x31,
+    0x84, 0xA2, 0x10, 0x85, 0x11, 0x80, 0x93, 0x07, 0x0D, 0x08, 0x42, 0xF0, 0x7B, 0x35, 0xA5, 0xD8,
+    0xB5, 0x5A, 0xC6, 0xBB, 0xCE, 0xDC, 0xD6, 0xDC, 0xD6, 0x9B, 0xC6, 0x5A, 0xBE, 0xD8, 0xB5, 0x15,
+    0x9D, 0xD0, 0x7B, 0x29, 0x42, 0x80, 0x8E, 0x0D, 0x84, 0xAC, 0x03, 0x02, 0x4E, 0x63, 0x72, 0x8C,
+    0x72, 0x84, 0x80, 0x49, 0x02, 0x92, 0x8C, 0x93, 0x8C, 0x93, 0x8C, 0x82, 0xDD, 0x03, 0x81, 0xE6,
+    0x07, 0x00, 0x22, 0x00, 0x81, 0xA2, 0x0D, 0x0A, 0xCB, 0x52, 0xB3, 0x94, 0x76, 0xAD, 0x19, 0xBE,
+    0x9B, 0xCE, 0x9B, 0xCE, 0x7B, 0xC6, 0xF8, 0xB5, 0x36, 0xA5, 0xF0, 0x73, 0x08, 0x3A, 0x81, 0xEF,
+    0x03, 0x00, 0x31, 0x84, 0x81, 0x4A, 0x82, 0x4D, 0x00, 0x87, 0x31, 0x81, 0x98, 0x04, 0x80, 0x97,
+    0x04, 0x81, 0x99, 0x04, 0x04, 0x00, 0x00, 0x87, 0x31, 0x11, 0x7C, 0xB7, 0xAD, 0x7B, 0xCE, 0x80,
+    0x47, 0x00, 0xFD, 0xD6, 0x80, 0x01, 0x80, 0xE6, 0x03, 0x03, 0x9B, 0xCE, 0xF8, 0xB5, 0xB3, 0x94,
+    0xEC, 0x5A, 0x80, 0xA2, 0x09, 0x81, 0xA0, 0x08, 0x80, 0x29, 0x02, 0x42, 0x08, 0xF0, 0x7B, 0xF4,
+    0x94, 0x80, 0x82, 0x01, 0x80, 0x01, 0x03, 0xD4, 0x94, 0xF4, 0x9C, 0xD3, 0x94, 0x04, 0x21, 0x84,
+    0xFA, 0x08, 0x01, 0x00, 0x00, 0x6A, 0x4A, 0x80, 0x93, 0x01, 0x83, 0x84, 0x01, 0x00, 0xD3, 0x94,
+    0x80, 0xDC, 0x0D, 0x85, 0xE2, 0x03, 0x0F, 0x41, 0x08, 0x08, 0x3A, 0xD0, 0x73, 0x35, 0x9D, 0xB8,
+    0xAD, 0x19, 0xBE, 0x7A, 0xC6, 0xBB, 0xCE, 0xBB, 0xCE, 0x9B, 0xCE, 0x5A, 0xC6, 0x19, 0xBE, 0x76,
+    0xA5, 0x92, 0x8C, 0xEB, 0x5A, 0x24, 0x21, 0x87, 0x96, 0x04, 0x81, 0x01, 0x80, 0x77, 0x02, 0xD4,
+    0x94, 0xF8, 0xB5, 0x9B, 0xC6, 0x81, 0xC9, 0x04, 0x82, 0x01, 0x00, 0x9B, 0xC6, 0x80, 0x57, 0x00,
+    0xAB, 0x52, 0x80, 0xB7, 0x05, 0x89, 0x1E, 0x85, 0x9E, 0x04, 0x80, 0x94, 0x04, 0x86, 0x01, 0x81,
+    0x98, 0x04, 0x80, 0x93, 0x04, 0x01, 0x20, 0x08, 0x20, 0x08, 0x82, 0xC7, 0x0C, 0x00, 0x40, 0x10,
+    0x80, 0x98, 0x04, 0x24, 0x60, 0x18, 0xA1, 0x20, 0x26, 0x52, 0xA1, 0x28, 0xC1, 0x38, 0x01, 0x41,
+    0x41, 0x51, 0xA1, 0x71, 0x01, 0x8A, 0x41, 0x9A, 0x60, 0xAA, 0x4D, 0xDD, 0xEF, 0xED, 0x49, 0xE5,
+    0x89, 0xED, 0xCA, 0xF5, 0x2B, 0xFE, 0x50, 0xFF, 0xA9, 0xFF, 0x27, 0xFF, 0xE3, 0xFD, 0xA4, 0xFD,
+    0x44, 0xF5, 0x04, 0xED, 0xC3, 0xEC, 0xA3, 0xE4, 0x02, 0xED, 0x02, 0xF5, 0xA2, 0xCB, 0x03, 0xAB,
+    0xE3, 0xA2, 0x82, 0x92, 0xE1, 0x79, 0xC1, 0x71, 0xA2, 0x69, 0x82, 0x59, 0x42, 0x51, 0x80, 0xCC,
+    0x0C, 0x02, 0x84, 0x49, 0x64, 0x41, 0x43, 0x39, 0x80, 0xB3, 0x08, 0x03, 0x44, 0x31, 0x23, 0x31,
+    0x23, 0x31, 0x03, 0x29, 0x81, 0x01, 0x00, 0xE3, 0x28, 0x82, 0x01, 0x01, 0xE3, 0x20, 0xE3, 0x20,
+    0x81, 0x9C, 0x04, 0x80, 0x99, 0x04, 0x00, 0x83, 0x10, 0x83, 0xAD, 0x08, 0x80, 0x01, 0x82, 0xA0,
+    0x03, 0x00, 0x83, 0x10, 0x80, 0xB8, 0x07, 0x94, 0xE7, 0x03, 0xAE, 0x95, 0x04, 0x80, 0xB6, 0x03,
+    0x81, 0x05, 0x81, 0xD9, 0x03, 0x80, 0x95, 0x04, 0x80, 0xB3, 0x08, 0x00, 0x42, 0x08, 0x8A, 0xDE,
+    0x05, 0x01, 0x83, 0x08, 0x82, 0x08, 0x82, 0xB4, 0x08, 0x83, 0x26, 0x01, 0x01, 0x00, 0xE4, 0x18,
+    0x81, 0x98, 0x04, 0x00, 0x21, 0x00, 0x83, 0x98, 0x04, 0x00, 0x83, 0x08, 0x81, 0xB0, 0x08, 0x82,
+    0x98, 0x04, 0x09, 0x62, 0xAC, 0xA3, 0xFF, 0x23, 0xFF, 0x83, 0xF6, 0xA3, 0xD5, 0x62, 0xA4, 0xE2,
+    0x6A, 0x82, 0x39, 0x82, 0x10, 0x42, 0x00, 0x80, 0x90, 0x01, 0x81, 0xEB, 0x08, 0x89, 0xC8, 0x0C,
+    0x80, 0x98, 0x04, 0x02, 0x62, 0x08, 0x98, 0xCE, 0x0B, 0x5B, 0x80, 0x35, 0x01, 0x16, 0xBE, 0x58,
+    0xC6, 0x80, 0x57, 0x02, 0x28, 0x42, 0x4D, 0x63, 0x28, 0x42, 0x81, 0xB7, 0x08, 0x82, 0xAE, 0x08,
+    0x80, 0x03, 0x82, 0x98, 0x04, 0x81, 0x3F, 0x01, 0x62, 0x00, 0x05, 0x19, 0x84, 0xB0, 0x08, 0x8B,
+    0x01, 0x89, 0x0F, 0x83, 0x86, 0x04, 0x8A, 0x20, 0x85, 0x11, 0x83, 0x12, 0x80, 0xEA, 0x04, 0x81,
+    0xC4, 0x0A, 0x01, 0xE4, 0x18, 0xA2, 0x10, 0x83, 0x9B, 0x0B, 0x90, 0x29, 0x83, 0xFE, 0x0B, 0x80,
+    0xF9, 0x03, 0x82, 0x13, 0x00, 0xA3, 0x10, 0x81, 0x82, 0x0F, 0x81, 0xBA, 0x04, 0x82, 0x14, 0x87,
+    0x1F, 0x82, 0x95, 0x04, 0x82, 0x01, 0x00, 0x02, 0x00, 0x81, 0x0C, 0x08, 0xC3, 0x18, 0x66, 0x29,
+    0x08, 0x3A, 0x6A, 0x4A, 0x8A, 0x4A, 0x8A, 0x4A, 0x4A, 0x4A, 0xC7, 0x39, 0x04, 0x21, 0x82, 0x8A,
+    0x06, 0x82, 0x95, 0x0A, 0x81, 0x03, 0x99, 0x84, 0x01, 0x85, 0x14, 0x84, 0xB3, 0x02, 0x80, 0x84,
+    0x01, 0x03, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0xC3, 0x18, 0x83, 0xA4, 0x0C, 0x8D, 0x01, 0x0A,
+    0x61, 0x08, 0x24, 0x21, 0xC7, 0x39, 0x49, 0x4A, 0xAA, 0x52, 0xAB, 0x52, 0xAB, 0x52, 0x6A, 0x4A,
+    0xC7, 0x39, 0x24, 0x21, 0x41, 0x08, 0x87, 0x14, 0x84, 0x87, 0x04, 0x82, 0x09, 0x87, 0x0D, 0x82,
+    0x01, 0x80, 0x93, 0x04, 0x84, 0x01, 0x80, 0x97, 0x04, 0x80, 0xAF, 0x08, 0x08, 0x61, 0x10, 0x61,
+    0x18, 0x61, 0x18, 0x40, 0x18, 0xA4, 0x49, 0xA4, 0x49, 0xC0, 0x38, 0x21, 0x49, 0x61, 0x59, 0x80,
+    0x98, 0x04, 0x22, 0x81, 0xAA, 0xE0, 0xBA, 0x65, 0xDC, 0x50, 0xF6, 0xEC, 0xF5, 0x0A, 0xF6, 0x6B,
+    0xFE, 0xCB, 0xFE, 0x6F, 0xFF, 0xF2, 0xFF, 0x8B, 0xFF, 0xE5, 0xFE, 0x86, 0xFE, 0x25, 0xFE, 0xE4,
+    0xFD, 0xC3, 0xFD, 0x43, 0xFE, 0xE3, 0xFD, 0x63, 0xE4, 0xC3, 0xCB, 0x83, 0xBB, 0x23, 0xB3, 0xC3,
+    0xA2, 0x21, 0x8A, 0x02, 0x7A, 0xE2, 0x71, 0xA2, 0x61, 0x62, 0x59, 0x41, 0x49, 0x42, 0x51, 0xA4,
+    0x51, 0x63, 0x49, 0x63, 0x49, 0x63, 0x41, 0x64, 0x41, 0x81, 0x01, 0x80, 0x9D, 0x04, 0x00, 0x44,
+    0x39, 0x80, 0xB8, 0x08, 0x81, 0xB9, 0x08, 0x80, 0x98, 0x04, 0x01, 0xE4, 0x20, 0xE3, 0x20, 0x82,
+    0x98, 0x04, 0x00, 0xC3, 0x10, 0x84, 0x97, 0x04, 0x80, 0x9F, 0x04, 0x81, 0x01, 0x80, 0xA0, 0x03,
+    0x00, 0xE5, 0x18, 0xB9, 0xA5, 0x08, 0x84, 0xE2, 0x01, 0x00, 0x21, 0x00, 0x81, 0xBA, 0x0C, 0x83,
+    0xAC, 0x0C, 0x81, 0xB2, 0x08, 0x82, 0xCA, 0x0C, 0x8C, 0x98, 0x04, 0x01, 0x20, 0x00, 0x66, 0x29,
+    0x82, 0xDA, 0x02, 0x83, 0x29, 0x80, 0x98, 0x04, 0x01, 0x83, 0x10, 0x01, 0x00, 0x80, 0x98, 0x04,
+    0x00, 0x62, 0x08, 0x84, 0x98, 0x04, 0x00, 0xC5, 0x10, 0x80, 0xC1, 0x04, 0x80, 0x7E, 0x06, 0x42,
+    0x00, 0x02, 0x4A, 0xA3, 0x83, 0x43, 0x52, 0x22, 0x21, 0x42, 0x08, 0x02, 0x00, 0x80, 0x01, 0x01,
+    0x42, 0x00, 0x82, 0x08, 0x80, 0xAD, 0x05, 0x83, 0xC8, 0x0C, 0x88, 0x99, 0x04, 0x80, 0x4F, 0x01,
+    0x16, 0xBE, 0xEB, 0x5A, 0x80, 0x34, 0x01, 0xE7, 0x39, 0x86, 0x29, 0x80, 0x56, 0x82, 0x3C, 0x81,
+    0xAC, 0x08, 0x81, 0xF2, 0x04, 0x80, 0x01, 0x80, 0x0B, 0x83, 0xD8, 0x04, 0x83, 0x98, 0x04, 0x83,
+    0xB2, 0x08, 0x8B, 0xF6, 0x02, 0x81, 0x03, 0x8F, 0x01, 0x83, 0x19, 0x8F, 0x12, 0x8B, 0x16, 0x82,
+    0xE7, 0x0D, 0x88, 0x0B, 0x82, 0x90, 0x08, 0x80, 0x04, 0x82, 0xE7, 0x03, 0x87, 0x25, 0x81, 0xA9,
+    0x04, 0x82, 0x24, 0x82, 0xB0, 0x04, 0x89, 0x01, 0x00, 0x02, 0x00, 0x89, 0x4A, 0x87, 0xEC, 0x0F,
+    0x94, 0x81, 0x01, 0x8A, 0x72, 0x95, 0xC8, 0x02, 0x97, 0x19, 0x82, 0xC5, 0x02, 0x85, 0x86, 0x04,
+    0x81, 0x9B, 0x04, 0x8B, 0x90, 0x04, 0x84, 0x01, 0x02, 0x40, 0x08, 0x41, 0x08, 0x40, 0x08, 0x82,
+    0x97, 0x04, 0x2C, 0x81, 0x18, 0x81, 0x20, 0x80, 0x20, 0xC1, 0x28, 0x46, 0x62, 0x01, 0x41, 0x41,
+    0x59, 0x81, 0x69, 0xC1, 0x79, 0x21, 0x8A, 0x81, 0xA2, 0x21, 0xC3, 0x02, 0xE4, 0x2C, 0xF6, 0x8F,
+    0xF6, 0x8B, 0xFE, 0x0B, 0xFF, 0x6D, 0xFF, 0xAF, 0xFF, 0xF9, 0xFF, 0xD2, 0xFF, 0x89, 0xFF, 0x49,
+    0xFF, 0x07, 0xFF, 0xE5, 0xFE, 0x46, 0xFF, 0xE4, 0xFE, 0x63, 0xF5, 0xA4, 0xEC, 0x43, 0xDC, 0xE3,
+    0xCB, 0x83, 0xBB, 0x02, 0xAB, 0x60, 0x9A, 0x41, 0x8A, 0x22, 0x82, 0xE2, 0x71, 0xC2, 0x69, 0x81,
+    0x61, 0xA2, 0x61, 0xE4, 0x69, 0xA4, 0x59, 0xA4, 0x51, 0x84, 0x51, 0x64, 0x49, 0x80, 0x9A, 0x04,
+    0x05, 0x44, 0x41, 0x44, 0x39, 0x24, 0x39, 0x24, 0x39, 0x24, 0x31, 0x04, 0x31, 0x80, 0x01, 0x02,
+    0x04, 0x29, 0xE4, 0x28, 0xE4, 0x28, 0x81, 0xCE, 0x0C, 0x00, 0xC4, 0x18, 0x80, 0xCA, 0x0C, 0x00,
+    0xC3, 0x18, 0x86, 0x98, 0x04, 0x82, 0x9B, 0x04, 0x01, 0xA3, 0x10, 0xE5, 0x18, 0x8B, 0xF6, 0x0B,
+    0xAE, 0x01, 0x81, 0xE0, 0x0D, 0x81, 0xC7, 0x07, 0x84, 0x96, 0x04, 0x01, 0x41, 0x00, 0x41, 0x08,
+    0x81, 0xAE, 0x08, 0x83, 0x99, 0x04, 0x84, 0xE2, 0x01, 0x85, 0xE8, 0x01, 0x01, 0x83, 0x10, 0x09,
+    0x3A, 0x82, 0xB2, 0x08, 0x81, 0x09, 0x80, 0x05, 0x03, 0xC4, 0x18, 0xA3, 0x10, 0x01, 0x00, 0xE5,
+    0x10, 0x86, 0x98, 0x04, 0x00, 0xC4, 0x10, 0x80, 0x2D, 0x80, 0xCB, 0x08, 0x80, 0x99, 0x04, 0x80,
+    0x93, 0x04, 0x00, 0x22, 0x00, 0x80, 0x09, 0x81, 0x33, 0x00, 0x82, 0x08, 0x82, 0xB0, 0x08, 0x8C,
+    0x01, 0x02, 0x62, 0x08, 0x25, 0x21, 0x82, 0x08, 0x80, 0x1B, 0x80, 0x37, 0x80, 0xF5, 0x04, 0x81,
+    0x01, 0x81, 0x21, 0x80, 0x2E, 0x80, 0x05, 0x83, 0xC8, 0x0C, 0x87, 0x98, 0x04, 0x85, 0xDC, 0x0A,
+    0x86, 0xD1, 0x02, 0x82, 0x0A, 0xB2, 0x01, 0x83, 0xE8, 0x07, 0x84, 0xD1, 0x03, 0x83, 0x0B, 0x88,
+    0xF9, 0x03, 0x81, 0x0C, 0x82, 0x16, 0x80, 0xA3, 0x01, 0x99, 0x01, 0x87, 0x91, 0x04, 0x89, 0x01,
+    0x91, 0xF1, 0x04, 0x8E, 0x9E, 0x01, 0x91, 0x97, 0x04, 0x99, 0x98, 0x04, 0x92, 0x8E, 0x04, 0x83,
+    0x92, 0x04, 0x82, 0x01, 0x00, 0x40, 0x10, 0x80, 0x01, 0x01, 0x60, 0x10, 0x60, 0x10, 0x81, 0x96,
+    0x04, 0x2D, 0x81, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xA0, 0x28, 0xE4, 0x59, 0x03, 0x62, 0x40, 0x61,
+    0xA1, 0x71, 0xE1, 0x81, 0x41, 0x9A, 0xC1, 0xAA, 0x41, 0xC3, 0x01, 0xE4, 0xA7, 0xF5, 0x10, 0xFF,
+    0x0E, 0xFF, 0x6D, 0xFF, 0xCF, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xCE, 0xFF,
+    0xAC, 0xFF, 0xCE, 0xFF, 0x8A, 0xFF, 0x85, 0xFE, 0xC5, 0xFD, 0x44, 0xF5, 0xC3, 0xEC, 0x63, 0xDC,
+    0x03, 0xD4, 0x82, 0xC3, 0xE0, 0xB2, 0xA1, 0xA2, 0x82, 0x9A, 0x42, 0x8A, 0x02, 0x82, 0xC1, 0x71,
+    0xE2, 0x71, 0x04, 0x72, 0xC4, 0x61, 0xA4, 0x59, 0xA4, 0x59, 0x83, 0x51, 0x64, 0x49, 0x80, 0x98,
+    0x04, 0x07, 0x44, 0x41, 0x24, 0x39, 0x03, 0x31, 0x04, 0x31, 0xE3, 0x30, 0xE3, 0x28, 0xE4, 0x28,
+    0xC4, 0x28, 0x80, 0x01, 0x00, 0xC4, 0x20, 0x80, 0x01, 0x80, 0x97, 0x04, 0x82, 0x01, 0x84, 0x9A,
+    0x04, 0x83, 0x9D, 0x04, 0x80, 0xC4, 0x07, 0xB9, 0x94, 0x04, 0x83, 0x8B, 0x0B, 0x82, 0x93, 0x04,
+    0x81, 0xC3, 0x0C, 0x82, 0xA9, 0x08, 0x83, 0xD3, 0x07, 0x80, 0x01, 0x84, 0x83, 0x09, 0x84, 0x80,
+    0x02, 0x80, 0x0C, 0x03, 0xA3, 0x10, 0xA7, 0x31, 0xE4, 0x18, 0x63, 0x08, 0x83, 0x27, 0x01, 0x21,
+    0x00, 0xE4, 0x18, 0x80, 0xBE, 0x0F, 0x00, 0xC5, 0x10, 0x85, 0x98, 0x04, 0x01, 0xA4, 0x10, 0xC4,
+    0x10, 0x80, 0x2D, 0x00, 0x83, 0x08, 0x81, 0x0B, 0x82, 0x36, 0x82, 0xFD, 0x02, 0x01, 0x22, 0x08,
+    0x83, 0x08, 0x8E, 0x98, 0x04, 0x80, 0xE3, 0x04, 0x80, 0xD7, 0x02, 0x81, 0xBC, 0x0C, 0x82, 0x93,
+    0x04, 0x81, 0xC2, 0x05, 0x80, 0x29, 0x84, 0x95, 0x09, 0x85, 0x98, 0x04, 0x00, 0x62, 0x08, 0x85,
+    0x98, 0x04, 0x82, 0xF1, 0x02, 0x84, 0x04, 0x93, 0xAC, 0x08, 0x8E, 0x82, 0x04, 0x87, 0x05, 0x8B,
+    0x16, 0x00, 0x02, 0x00, 0x83, 0xA2, 0x08, 0x82, 0xC6, 0x03, 0x9A, 0x81, 0x04, 0x9C, 0x01, 0x85,
+    0x3B, 0x85, 0x98, 0x04, 0x87, 0xE6, 0x04, 0x99, 0x01, 0x87, 0xB9, 0x06, 0x87, 0xB2, 0x04, 0x8A,
+    0x89, 0x0E, 0x91, 0xEF, 0x02, 0x8F, 0x95, 0x04, 0x81, 0x91, 0x04, 0x81, 0x93, 0x04, 0x01, 0x60,
+    0x18, 0x80, 0x18, 0x80, 0x93, 0x04, 0x00, 0xA1, 0x20, 0x80, 0x01, 0x2C, 0xA1, 0x28, 0xC1, 0x28,
+    0xC1, 0x28, 0xE1, 0x30, 0xE1, 0x38, 0x00, 0x41, 0x61, 0x51, 0xA5, 0x82, 0xA1, 0x79, 0x01, 0x8A,
+    0x61, 0x9A, 0xC1, 0xB2, 0x22, 0xC3, 0xA2, 0xD3, 0x21, 0xE4, 0x43, 0xFD, 0x0E, 0xFF, 0x92, 0xFF,
+    0xB1, 0xFF, 0xF4, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0xF9, 0xFF, 0xF7, 0xFF, 0xF9, 0xFF,
+    0xF4, 0xFF, 0x8C, 0xFF, 0x29, 0xFF, 0xA7, 0xFE, 0x25, 0xFE, 0xC5, 0xFD, 0x24, 0xF5, 0xC4, 0xE4,
+    0x23, 0xDC, 0x41, 0xC3, 0x01, 0xBB, 0xC2, 0xAA, 0x62, 0x9A, 0x22, 0x8A, 0xE1, 0x81, 0x02, 0x7A,
+    0x24, 0x7A, 0xE4, 0x71, 0xC4, 0x69, 0x81, 0x9A, 0x04, 0x80, 0xB3, 0x08, 0x08, 0x44, 0x49, 0x44,
+    0x41, 0x24, 0x41, 0x04, 0x39, 0x04, 0x39, 0xE4, 0x38, 0xE4, 0x30, 0xE4, 0x30, 0xC3, 0x28, 0x80,
+    0x01, 0x04, 0xA4, 0x28, 0xA4, 0x20, 0xC4, 0x20, 0xA3, 0x20, 0xA3, 0x20, 0x84, 0x9A, 0x04, 0x82,
+    0xC6, 0x0C, 0x81, 0x98, 0x04, 0x80, 0xB9, 0x07, 0x00, 0xA4, 0x10, 0x83, 0x8E, 0x01, 0x83, 0xE2,
+    0x03, 0xB5, 0x01, 0x81, 0x99, 0x04, 0x84, 0x96, 0x04, 0x81, 0x97, 0x04, 0x81, 0xD5, 0x07, 0x86,
+    0xB0, 0x08, 0x82, 0xF1, 0x01, 0x83, 0xCB, 0x03, 0x01, 0x01, 0x00, 0x41, 0x00, 0x84, 0x26, 0x01,
+    0x21, 0x00, 0xC4, 0x10, 0x81, 0x98, 0x04, 0x80, 0x8F, 0x0C, 0x85, 0xB0, 0x08, 0x80, 0xFD, 0x07,
+    0x81, 0x95, 0x04, 0x00, 0x83, 0x08, 0x81, 0x94, 0x04, 0x07, 0x21, 0x00, 0x82, 0x08, 0x63, 0x19,
+    0x66, 0x2A, 0xE8, 0x43, 0x67, 0x33, 0xA3, 0x08, 0xA3, 0x10, 0x81, 0x9E, 0x08, 0x81, 0x89, 0x0D,
+    0x86, 0x01, 0x82, 0xEC, 0x04, 0x81, 0x50, 0x81, 0xA4, 0x01, 0x80, 0xA5, 0x01, 0x85, 0x94, 0x04,
+    0x88, 0x98, 0x04, 0x03, 0x84, 0x08, 0x63, 0x08, 0xE5, 0x18, 0x82, 0x10, 0x86, 0x91, 0x04, 0x81,
+    0xFD, 0x02, 0x84, 0xED, 0x06, 0x92, 0x89, 0x04, 0x8C, 0x9A, 0x03, 0x83, 0xFC, 0x03, 0x81, 0xB6,
+    0x03, 0x85, 0x19, 0x85, 0x1E, 0x81, 0xA4, 0x0C, 0xA2, 0xFA, 0x03, 0x00, 0x43, 0x00, 0xA7, 0xA3,
+    0x04, 0x99, 0xC1, 0x08, 0x8A, 0x98, 0x04, 0x83, 0xB5, 0x01, 0x85, 0xAA, 0x02, 0x8B, 0x0E, 0x8A,
+    0x01, 0x89, 0xAD, 0x04, 0x85, 0xB1, 0x08, 0x83, 0x8E, 0x04, 0x84, 0x01, 0x80, 0xA7, 0x08, 0x06,
+    0x60, 0x18, 0x60, 0x18, 0x80, 0x20, 0x80, 0x20, 0x81, 0x28, 0xA1, 0x28, 0xC1, 0x30, 0x80, 0x01,
+    0x17, 0xC1, 0x38, 0xC1, 0x38, 0xE1, 0x40, 0xE1, 0x48, 0x01, 0x51, 0x21, 0x61, 0x41, 0x69, 0x60,
+    0x71, 0xA4, 0x9A, 0x82, 0xA2, 0x60, 0xB2, 0xE1, 0xC2, 0x61, 0xD3, 0xE1, 0xE3, 0x60, 0xEC, 0x20,
+    0xF5, 0xC1, 0xFD, 0x09, 0xFF, 0xD3, 0xFF, 0xF5, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF,
+    0xFF, 0x80, 0x02, 0x1D, 0xFD, 0xFF, 0xF6, 0xFF, 0xF2, 0xFF, 0xAD, 0xFF, 0x69, 0xFF, 0x05, 0xFF,
+    0x84, 0xFE, 0xE3, 0xFD, 0x63, 0xF5, 0xA2, 0xEC, 0x00, 0xE4, 0x81, 0xD3, 0x22, 0xCB, 0xC2, 0xBA,
+    0x81, 0xAA, 0x41, 0xA2, 0x63, 0x9A, 0x43, 0x9A, 0x03, 0x8A, 0xE3, 0x81, 0xC4, 0x79, 0xC4, 0x71,
+    0xA4, 0x69, 0x84, 0x61, 0x84, 0x59, 0x64, 0x59, 0x44, 0x51, 0x24, 0x49, 0x24, 0x49, 0x04, 0x41,
+    0x80, 0x01, 0x03, 0xE4, 0x38, 0xE3, 0x38, 0xC3, 0x30, 0xC3, 0x28, 0x81, 0xB4, 0x08, 0x00, 0xC4,
+    0x28, 0x80, 0x99, 0x04, 0x82, 0x9A, 0x04, 0x00, 0x83, 0x18, 0x82, 0x98, 0x04, 0x80, 0x01, 0x80,
+    0xE3, 0x02, 0x01, 0xA3, 0x10, 0xC4, 0x18, 0x84, 0xE4, 0x0B, 0xB2, 0x91, 0x04, 0x00, 0x20, 0x00,
+    0x83, 0xE8, 0x02, 0x84, 0xC6, 0x0C, 0x84, 0xAB, 0x08, 0x00, 0x82, 0x08, 0x80, 0xDC, 0x07, 0x00,
+    0x83, 0x10, 0x80, 0x9B, 0x04, 0x87, 0xCB, 0x01, 0x84, 0x89, 0x03, 0x85, 0x85, 0x03, 0x83, 0x98,
+    0x04, 0x00, 0xE5, 0x10, 0x80, 0xFB, 0x03, 0x85, 0xB0, 0x08, 0x80, 0xD6, 0x08, 0x80, 0x98, 0x04,
+    0x0B, 0x82, 0x08, 0x22, 0x08, 0xC2, 0x08, 0x65, 0x1A, 0x87, 0x33, 0x67, 0x3C, 0x08, 0x45, 0x88,
+    0x45, 0xA9, 0x3D, 0xA8, 0x35, 0x47, 0x35, 0xA4, 0x19, 0x80, 0x38, 0x80, 0x44, 0x81, 0xA5, 0x08,
+    0x82, 0x91, 0x04, 0x82, 0x04, 0x80, 0x50, 0x00, 0x82, 0x10, 0x82, 0xD1, 0x09, 0x80, 0x4D, 0x85,
+    0x94, 0x04, 0x81, 0xAF, 0x0D, 0x82, 0xDB, 0x04, 0x84, 0x98, 0x04, 0x03, 0xA4, 0x10, 0x83, 0x08,
+    0xE4, 0x18, 0x82, 0x18, 0x85, 0xA5, 0x08, 0x84, 0xC7, 0x0C, 0x93, 0x92, 0x07, 0x90, 0x92, 0x03,
+    0x91, 0xB0, 0x03, 0x98, 0x95, 0x04, 0x03, 0x43, 0x00, 0x43, 0x00, 0x23, 0x00, 0x23, 0x00, 0x81,
+    0x03, 0x80, 0x09, 0x80, 0x04, 0x81, 0x06, 0x82, 0x0B, 0x84, 0x09, 0x88, 0x01, 0xA7, 0x9A, 0x04,
+    0x90, 0x9B, 0x01, 0x83, 0x03, 0x84, 0xA0, 0x04, 0x84, 0xC9, 0x01, 0x85, 0x09, 0x8F, 0xE3, 0x02,
+    0x88, 0xB1, 0x07, 0x00, 0x00, 0x08, 0x81, 0x95, 0x04, 0x00, 0x20, 0x10, 0x81, 0x8E, 0x04, 0x02,
+    0x40, 0x18, 0x60, 0x18, 0x60, 0x20, 0x80, 0x8D, 0x04, 0x80, 0x01, 0x00, 0x80, 0x28, 0x80, 0x01,
+    0x1E, 0xA0, 0x30, 0xA0, 0x30, 0xC0, 0x30, 0xC0, 0x38, 0xE0, 0x40, 0x00, 0x49, 0x20, 0x51, 0x40,
+    0x61, 0x80, 0x69, 0xA0, 0x71, 0xC0, 0x79, 0xE0, 0x81, 0x00, 0x8A, 0x20, 0x92, 0x40, 0x9A, 0x60,
+    0xA2, 0x80, 0xAA, 0xC0, 0xBA, 0x00, 0xC3, 0x81, 0xCB, 0x42, 0xE4, 0x61, 0xE4, 0x01, 0xF5, 0x82,
+    0xFD, 0x02, 0xFE, 0xA3, 0xFE, 0x05, 0xFF, 0x69, 0xFF, 0xB0, 0xFF, 0xF7, 0xFF, 0xFA, 0xFF, 0x81,
+    0x97, 0x04, 0x81, 0x01, 0x2A, 0xFE, 0xFF, 0xFD, 0xFF, 0xFA, 0xFF, 0xF5, 0xFF, 0xF1, 0xFF, 0xCD,
+    0xFF, 0x8A, 0xFF, 0x27, 0xFF, 0xE7, 0xFE, 0x85, 0xFE, 0x23, 0xFE, 0xC3, 0xFD, 0x63, 0xFD, 0x02,
+    0xF5, 0xA2, 0xEC, 0x61, 0xE4, 0x62, 0xE4, 0x22, 0xDC, 0xE2, 0xD3, 0x82, 0xCB, 0x42, 0xC3, 0x23,
+    0xB3, 0x03, 0xAB, 0xE3, 0xA2, 0xA3, 0x9A, 0x63, 0x92, 0x43, 0x8A, 0x23, 0x82, 0x03, 0x7A, 0xE3,
+    0x79, 0xC3, 0x71, 0xA3, 0x69, 0x83, 0x61, 0x63, 0x59, 0x63, 0x59, 0x63, 0x51, 0x43, 0x51, 0x23,
+    0x49, 0x23, 0x41, 0x23, 0x41, 0x03, 0x39, 0x03, 0x39, 0x03, 0x31, 0x80, 0xD6, 0x0C, 0x01, 0xC3,
+    0x28, 0xC3, 0x20, 0x81, 0x01, 0x81, 0x9F, 0x04, 0x81, 0xB4, 0x08, 0x01, 0xE4, 0x18, 0x41, 0x08,
+    0x84, 0xBE, 0x0D, 0xB2, 0x99, 0x04, 0x84, 0x91, 0x08, 0x84, 0x01, 0x80, 0xC9, 0x03, 0x81, 0xDF,
+    0x0B, 0x00, 0x82, 0x08, 0x81, 0x82, 0x09, 0x80, 0x06, 0x85, 0xC8, 0x0C, 0x88, 0x98, 0x04, 0x85,
+    0x01, 0x80, 0xA5, 0x08, 0x00, 0x00, 0x00, 0x80, 0xBF, 0x0C, 0x80, 0x98, 0x04, 0x83, 0xDA, 0x03,
+    0x83, 0x98, 0x04, 0x0B, 0x42, 0x08, 0xE1, 0x08, 0x06, 0x25, 0x4A, 0x36, 0xE8, 0x2D, 0xA7, 0x25,
+    0x47, 0x1D, 0x26, 0x15, 0x26, 0x1D, 0x46, 0x1D, 0x47, 0x25, 0x25, 0x1A, 0x82, 0x98, 0x04, 0x80,
+    0x1D, 0x82, 0xA7, 0x08, 0x80, 0xBB, 0x0C, 0x81, 0xBA, 0x0C, 0x01, 0xC3, 0x10, 0xC3, 0x10, 0x81,
+    0x94, 0x04, 0x00, 0x41, 0x08, 0x83, 0x94, 0x04, 0x81, 0x92, 0x04, 0x80, 0x01, 0x80, 0x05, 0x01,
+    0x20, 0x00, 0xE4, 0x18, 0x81, 0x99, 0x04, 0x80, 0x55, 0x03, 0x42, 0x08, 0x63, 0x08, 0x42, 0x08,
+    0x62, 0x10, 0x80, 0x66, 0x85, 0x98, 0x04, 0x86, 0x99, 0x04, 0x91, 0x95, 0x04, 0x8F, 0xAB, 0x01,
+    0x87, 0x98, 0x04, 0x83, 0xB9, 0x03, 0xA3, 0xFB, 0x07, 0x00, 0x02, 0x00, 0x85, 0x4D, 0x01, 0x02,
+    0x00, 0x02, 0x00, 0x86, 0x90, 0x04, 0x84, 0xA6, 0x04, 0x86, 0x98, 0x04, 0x8D, 0x9B, 0x04, 0x00,
+    0x42, 0x00, 0x84, 0x96, 0x04, 0x83, 0x98, 0x04, 0x89, 0xFA, 0x01, 0x85, 0xA8, 0x01, 0x8C, 0xB8,
+    0x02, 0x85, 0xA8, 0x05, 0x82, 0x03, 0x8D, 0x89, 0x04, 0x84, 0x01, 0x82, 0x9B, 0x08, 0x86, 0x14,
+    0x85, 0xA6, 0x08, 0x00, 0x20, 0x10, 0x82, 0x01, 0x25, 0x00, 0x18, 0x20, 0x18, 0x20, 0x20, 0x40,
+    0x28, 0x60, 0x30, 0x80, 0x38, 0xA0, 0x40, 0xC0, 0x48, 0xE0, 0x50, 0x20, 0x59, 0x20, 0x61, 0x40,
+    0x69, 0x60, 0x71, 0x80, 0x71, 0xC0, 0x81, 0xE0, 0x89, 0x20, 0x92, 0x81, 0xA2, 0xE0, 0xB2, 0x41,
+    0xC3, 0xC1, 0xD3, 0x41, 0xE4, 0xA1, 0xEC, 0x01, 0xF5, 0x81, 0xF5, 0xE1, 0xFD, 0x21, 0xFE, 0x61,
+    0xFE, 0x81, 0xFE, 0xE2, 0xFE, 0x24, 0xFF, 0x46, 0xFF, 0xA9, 0xFF, 0xAB, 0xFF, 0xCC, 0xFF, 0xD0,
+    0xFF, 0xF3, 0xFF, 0xF6, 0xFF, 0x82, 0xAB, 0x08, 0x89, 0x01, 0x80, 0x9C, 0x04, 0x23, 0xFB, 0xFF,
+    0xF9, 0xFF, 0xF8, 0xFF, 0xF6, 0xFF, 0xF4, 0xFF, 0xF1, 0xFF, 0xEF, 0xFF, 0xCD, 0xFF, 0xAA, 0xFF,
+    0x88, 0xFF, 0x67, 0xFF, 0x47, 0xFF, 0x26, 0xFF, 0xC5, 0xFE, 0x84, 0xFE, 0x45, 0xFE, 0x25, 0xFE,
+    0xC4, 0xFD, 0x44, 0xF5, 0xE4, 0xEC, 0xA4, 0xEC, 0x44, 0xE4, 0x24, 0xDC, 0xE4, 0xD3, 0x84, 0xCB,
+    0x44, 0xC3, 0x24, 0xB3, 0xE4, 0xAA, 0xC4, 0xA2, 0xA4, 0x9A, 0x84, 0x92, 0x64, 0x8A, 0x44, 0x82,
+    0x24, 0x7A, 0x04, 0x72, 0xE4, 0x69, 0x80, 0xDE, 0x0C, 0x80, 0xDD, 0x0C, 0x0B, 0x64, 0x41, 0x44,
+    0x41, 0x44, 0x39, 0x44, 0x39, 0x24, 0x31, 0x04, 0x29, 0x04, 0x29, 0xE3, 0x28, 0xE3, 0x20, 0xE3,
+    0x20, 0x25, 0x29, 0xA3, 0x18, 0x82, 0x83, 0x01, 0x01, 0x41, 0x08, 0x41, 0x08, 0x81, 0x05, 0xB1,
+    0x9E, 0x04, 0x8A, 0xF7, 0x03, 0x80, 0x99, 0x04, 0x82, 0xF5, 0x0B, 0x81, 0xB1, 0x08, 0x83, 0x94,
+    0x03, 0x83, 0xF2, 0x01, 0x8C, 0x99, 0x04, 0x80, 0x8D, 0x04, 0x80, 0x98, 0x04, 0x00, 0x62, 0x08,
+    0x8A, 0x98, 0x04, 0x06, 0x22, 0x08, 0x23, 0x0A, 0xE7, 0x1D, 0x87, 0x15, 0x66, 0x15, 0x67, 0x15,
+    0x47, 0x1D, 0x81, 0x01, 0x01, 0x47, 0x25, 0xC6, 0x22, 0x81, 0x98, 0x04, 0x81, 0x96, 0x04, 0x80,
+    0xDE, 0x04, 0x80, 0x93, 0x04, 0x01, 0xC4, 0x10, 0xC4, 0x18, 0x80, 0x94, 0x04, 0x81, 0xA7, 0x08,
+    0x87, 0xBC, 0x0C, 0x80, 0x4F, 0x02, 0xE7, 0x39, 0x6D, 0x6B, 0xE7, 0x39, 0x80, 0x99, 0x04, 0x02,
+    0x0F, 0x7C, 0x36, 0xC6, 0x4C, 0x63, 0x82, 0xD8, 0x09, 0x05, 0x01, 0x00, 0x01, 0x10, 0x61, 0x48,
+    0x60, 0x50, 0x41, 0x20, 0x82, 0x10, 0x86, 0x98, 0x04, 0x85, 0x91, 0x0B, 0x86, 0xE6, 0x02, 0x87,
+    0x01, 0x80, 0xD2, 0x03, 0x07, 0xA3, 0x39, 0xA5, 0x5A, 0xA5, 0x5A, 0x84, 0x5A, 0x84, 0x5A, 0x85,
+    0x5A, 0xA5, 0x5A, 0xA4, 0x5A, 0x80, 0x07, 0x80, 0x04, 0x05, 0x84, 0x5A, 0x64, 0x52, 0x44, 0x52,
+    0x04, 0x4A, 0x43, 0x31, 0x82, 0x10, 0x81, 0x2A, 0x86, 0xD1, 0x07, 0xA3, 0x96, 0x04, 0x80, 0x46,
+    0x09, 0x43, 0x29, 0xC5, 0x62, 0xE6, 0x8B, 0xA7, 0xA4, 0xE7, 0xAC, 0xA6, 0xA4, 0xE6, 0x93, 0x05,
+    0x6B, 0xE3, 0x41, 0xC2, 0x18, 0x8A, 0x8F, 0x04, 0x8A, 0xB1, 0x08, 0x92, 0xB4, 0x08, 0x8A, 0xA3,
+    0x0A, 0x85, 0x95, 0x01, 0x03, 0x00, 0x00, 0x02, 0x31, 0x05, 0x7B, 0x24, 0x83, 0x82, 0x01, 0x03,
+    0x04, 0x83, 0xE4, 0x82, 0xE3, 0x82, 0xE4, 0x82, 0x80, 0x01, 0x01, 0x05, 0x83, 0x03, 0x5A, 0x88,
+    0xC9, 0x05, 0x81, 0xAA, 0x02, 0x00, 0x63, 0x41, 0x81, 0x13, 0x00, 0xE4, 0x8A, 0x83, 0x01, 0x02,
+    0xE3, 0x8A, 0x04, 0x93, 0xC3, 0x51, 0x84, 0xD1, 0x06, 0x84, 0x01, 0x1F, 0x41, 0x10, 0x02, 0x29,
+    0xE3, 0x49, 0xA4, 0x6A, 0x24, 0x8B, 0xA5, 0xA3, 0x06, 0xB4, 0x46, 0xBC, 0x66, 0xC4, 0x66, 0xCC,
+    0x66, 0xCC, 0x67, 0xD4, 0x87, 0xD4, 0x87, 0xD4, 0x87, 0xCC, 0x66, 0xC4, 0x46, 0xBC, 0x26, 0xB4,
+    0xE6, 0xA3, 0xA5, 0x9B, 0x65, 0x93, 0x25, 0x8B, 0x26, 0x83, 0x06, 0x73, 0x65, 0x5A, 0xE3, 0x51,
+    0x62, 0x41, 0x01, 0x31, 0xA1, 0x28, 0x60, 0x28, 0x20, 0x20, 0x40, 0x20, 0x80, 0xB0, 0x08, 0x82,
+    0xAF, 0x08, 0x00, 0x40, 0x59, 0x80, 0xB0, 0x08, 0x00, 0xC0, 0x71, 0x81, 0xAF, 0x08, 0x12, 0x60,
+    0x9A, 0xA0, 0xA2, 0xC0, 0xB2, 0xE0, 0xBA, 0x20, 0xC3, 0x80, 0xCB, 0xC0, 0xDB, 0x81, 0xE4, 0xE1,
+    0xF4, 0x20, 0xFD, 0xA1, 0xFD, 0x22, 0xFE, 0xA4, 0xFE, 0x06, 0xFF, 0x69, 0xFF, 0xAD, 0xFF, 0xF4,
+    0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0x84, 0x95, 0x04, 0x80, 0x94, 0x04, 0x0E, 0xF6, 0xFF, 0xF0, 0xFF,
+    0xCC, 0xFF, 0x88, 0xFF, 0x46, 0xFF, 0x05, 0xFF, 0xA2, 0xFE, 0x61, 0xFE, 0x01, 0xFE, 0xC0, 0xFD,
+    0x40, 0xF5, 0xE0, 0xF4, 0xA1, 0xEC, 0xA2, 0xE4, 0x62, 0xDC, 0x80, 0xB1, 0x08, 0x18, 0xA2, 0xCB,
+    0x83, 0xBB, 0x63, 0xB3, 0x23, 0xAB, 0x03, 0xA3, 0xC3, 0x9A, 0xA3, 0x92, 0x84, 0x8A, 0x64, 0x82,
+    0x23, 0x7A, 0x03, 0x72, 0xE3, 0x69, 0xE3, 0x69, 0xC4, 0x61, 0xC3, 0x61, 0xA3, 0x59, 0x83, 0x51,
+    0x63, 0x49, 0x64, 0x49, 0x43, 0x41, 0x43, 0x41, 0x23, 0x39, 0x03, 0x31, 0x03, 0x31, 0x03, 0x29,
+    0x82, 0x91, 0x04, 0x03, 0xC3, 0x20, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x18, 0x81, 0xC9, 0x03, 0x01,
+    0xE4, 0x18, 0xA3, 0x18, 0x84, 0xA5, 0x05, 0xAE, 0x92, 0x04, 0x91, 0x99, 0x04, 0x81, 0x9A, 0x04,
+    0x01, 0xA4, 0x10, 0xA4, 0x10, 0x81, 0x53, 0x82, 0x98, 0x04, 0x83, 0x97, 0x02, 0x8D, 0xBB, 0x0B,
+    0x00, 0xA4, 0x10, 0x80, 0xF2, 0x07, 0x83, 0x98, 0x04, 0x81, 0x99, 0x04, 0x86, 0x98, 0x04, 0x0A,
+    0xC6, 0x1D, 0xC7, 0x1D, 0x86, 0x1D, 0x66, 0x15, 0x46, 0x15, 0x26, 0x15, 0x06, 0x0D, 0x26, 0x15,
+    0x89, 0x3D, 0x49, 0x43, 0x63, 0x08, 0x80, 0x9F, 0x08, 0x80, 0xEE, 0x08, 0x01, 0xC3, 0x10, 0xC4,
+    0x18, 0x83, 0x94, 0x04, 0x86, 0xE8, 0x06, 0x84, 0x9C, 0x04, 0x09, 0x00, 0x00, 0x50, 0x84, 0x1A,
+    0xDF, 0x78, 0xC6, 0x7B, 0xEF, 0x28, 0x42, 0xC3, 0x18, 0x37, 0xC6, 0x54, 0xAD, 0x70, 0x8C, 0x80,
+    0x6E, 0x07, 0x00, 0x08, 0x00, 0x10, 0x01, 0x18, 0xC2, 0x89, 0x61, 0xF3, 0xC1, 0xF2, 0x21, 0x89,
+    0x21, 0x10, 0x89, 0x98, 0x04, 0x86, 0x99, 0x0B, 0x87, 0xB3, 0x0D, 0x84, 0x11, 0x03, 0x0A, 0xD6,
+    0xEA, 0xFF, 0xA9, 0xFF, 0x88, 0xFF, 0x82, 0x01, 0x0C, 0xA9, 0xFF, 0xA9, 0xFF, 0x89, 0xFF, 0x88,
+    0xFF, 0x89, 0xFF, 0x69, 0xFF, 0x69, 0xFF, 0x49, 0xFF, 0x09, 0xFF, 0x89, 0xE6, 0x28, 0xB5, 0xC5,
+    0x62, 0x21, 0x08, 0x86, 0x99, 0x04, 0xA3, 0xAC, 0x08, 0x0C, 0x84, 0x31, 0x48, 0xB5, 0x49, 0xFF,
+    0xA8, 0xFF, 0x87, 0xFF, 0x67, 0xFF, 0x66, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x87, 0xFF, 0x88, 0xFF,
+    0x2A, 0xDE, 0xA2, 0x10, 0x80, 0xB2, 0x08, 0x95, 0x01, 0x94, 0x3E, 0x83, 0xB1, 0x08, 0x88, 0xCA,
+    0x0D, 0x04, 0x00, 0x00, 0x85, 0xA3, 0x87, 0xFD, 0x45, 0xF4, 0x25, 0xF4, 0x80, 0x01, 0x04, 0x05,
+    0xEC, 0x05, 0xEC, 0xE5, 0xEB, 0xE5, 0xF3, 0xC5, 0xEB, 0x80, 0x01, 0x02, 0x05, 0xEC, 0x68, 0xFD,
+    0x42, 0x39, 0x8A, 0x99, 0x04, 0x03, 0x06, 0xBC, 0x06, 0xFD, 0xA4, 0xEB, 0xC4, 0xEB, 0x81, 0x16,
+    0x81, 0x01, 0x02, 0xC4, 0xEB, 0xA6, 0xFD, 0x05, 0x8B, 0x84, 0x98, 0x04, 0x81, 0x03, 0x25, 0x61,
+    0x10, 0x64, 0x5A, 0x47, 0xAC, 0x48, 0xDD, 0x88, 0xF5, 0x27, 0xFD, 0x86, 0xF4, 0x05, 0xEC, 0x84,
+    0xEB, 0x24, 0xE3, 0xE4, 0xDA, 0x83, 0xDA, 0x63, 0xD2, 0x43, 0xD2, 0x43, 0xD2, 0x63, 0xD2, 0x83,
+    0xD2, 0x83, 0xDA, 0xA3, 0xDA, 0xE4, 0xE2, 0x24, 0xE3, 0x85, 0xEB, 0xA5, 0xEB, 0xC5, 0xEB, 0x06,
+    0xF4, 0xC8, 0xF4, 0x8B, 0xFD, 0xCC, 0xFD, 0xEC, 0xFD, 0x0C, 0xF6, 0xEB, 0xED, 0xCB, 0xDD, 0x6B,
+    0xCD, 0xCA, 0xAC, 0x86, 0x62, 0x00, 0x08, 0x60, 0x10, 0x60, 0x18, 0x80, 0x01, 0x82, 0xD3, 0x0C,
+    0x00, 0xA0, 0x28, 0x80, 0xA1, 0x04, 0x80, 0xA2, 0x04, 0x11, 0xE0, 0x48, 0x00, 0x51, 0x20, 0x59,
+    0x20, 0x69, 0x60, 0x79, 0xA0, 0x81, 0x42, 0x9A, 0xA2, 0xB2, 0xC0, 0xC2, 0x60, 0xDB, 0x00, 0xEC,
+    0xE1, 0xF4, 0xA2, 0xFD, 0x44, 0xFE, 0xE7, 0xFE, 0x90, 0xFF, 0xF8, 0xFF, 0xFA, 0xFF, 0x82, 0x99,
+    0x04, 0x13, 0xFE, 0xFF, 0xFE, 0xFF, 0xF9, 0xFF, 0xF3, 0xFF, 0xCD, 0xFF, 0x87, 0xFF, 0x24, 0xFF,
+    0xA3, 0xFE, 0x23, 0xFE, 0xA3, 0xFD, 0x01, 0xF5, 0xA1, 0xEC, 0x21, 0xE4, 0xC2, 0xDB, 0x61, 0xD3,
+    0x01, 0xC3, 0xE2, 0xBA, 0x04, 0xB3, 0xE3, 0xAA, 0xA4, 0xA2, 0x80, 0xA0, 0x08, 0x02, 0x64, 0x82,
+    0x44, 0x7A, 0x24, 0x72, 0x80, 0xA0, 0x08, 0x05, 0xC4, 0x59, 0xC4, 0x59, 0xA4, 0x51, 0x84, 0x49,
+    0x63, 0x41, 0x63, 0x41, 0x80, 0xA0, 0x08, 0x01, 0x23, 0x39, 0x23, 0x31, 0x80, 0x91, 0x04, 0x00,
+    0x03, 0x29, 0x80, 0x91, 0x04, 0x80, 0xC1, 0x0C, 0x01, 0xE4, 0x20, 0xE4, 0x20, 0x80, 0xFF, 0x02,
+    0x02, 0xC4, 0x18, 0xC3, 0x18, 0xA4, 0x18, 0x83, 0xDD, 0x07, 0x00, 0x83, 0x10, 0x80, 0xDD, 0x0B,
+    0x81, 0x84, 0x07, 0xB5, 0x95, 0x04, 0x83, 0xD2, 0x04, 0x8A, 0xFA, 0x03, 0x01, 0x42, 0x00, 0x63,
+    0x08, 0x80, 0xF1, 0x03, 0x82, 0x51, 0x81, 0xDA, 0x01, 0x85, 0xDC, 0x03, 0x8B, 0x98, 0x04, 0x04,
+    0xE5, 0x18, 0x00, 0x00, 0xA4, 0x10, 0x63, 0x08, 0x21, 0x00, 0x80, 0x97, 0x04, 0x81, 0x98, 0x04,
+    0x01, 0xA3, 0x08, 0xC4, 0x10, 0x80, 0x09, 0x80, 0x89, 0x04, 0x0C, 0x22, 0x08, 0xC2, 0x09, 0xA6,
+    0x1D, 0xA6, 0x15, 0x86, 0x0D, 0x66, 0x15, 0x88, 0x25, 0xAA, 0x45, 0xAC, 0x5D, 0x4D, 0x6D, 0x4D,
+    0x6C, 0x25, 0x21, 0x62, 0x08, 0x80, 0xA8, 0x08, 0x00, 0xC4, 0x10, 0x80, 0x91, 0x01, 0x00, 0x62,
+    0x08, 0x85, 0xBA, 0x0C, 0x81, 0x8E, 0x04, 0x02, 0x00, 0x00, 0xA2, 0x10, 0x82, 0x08, 0x81, 0xBE,
+    0x0C, 0x81, 0x09, 0x08, 0xC6, 0x31, 0x1A, 0xDF, 0xA6, 0x29, 0x00, 0x00, 0xB5, 0xAD, 0x33, 0x9D,
+    0x00, 0x00, 0x8D, 0x6B, 0x92, 0x94, 0x80, 0x89, 0x09, 0x80, 0x0D, 0x07, 0x00, 0x18, 0xE2, 0x70,
+    0x64, 0xFD, 0xE2, 0xFD, 0x42, 0xFD, 0xE2, 0xE2, 0x21, 0x28, 0xC4, 0x18, 0x83, 0x98, 0x04, 0x86,
+    0x86, 0x04, 0x8B, 0x67, 0x84, 0x13, 0x03, 0xA2, 0x10, 0xCA, 0xEE, 0x46, 0xFF, 0x04, 0xFF, 0x81,
+    0x01, 0x00, 0x05, 0xFF, 0x83, 0x01, 0x02, 0xE5, 0xFE, 0xE4, 0xFE, 0xE5, 0xFE, 0x80, 0x05, 0x05,
+    0x26, 0xFF, 0x87, 0xFF, 0xA9, 0xFF, 0x09, 0xD6, 0x83, 0x39, 0x00, 0x00, 0xA7, 0x98, 0x04, 0x05,
+    0x01, 0x00, 0x27, 0x6B, 0x4A, 0xFF, 0xA6, 0xFF, 0x24, 0xFF, 0xE4, 0xFE, 0x80, 0x01, 0x00, 0xC4,
+    0xFE, 0x80, 0x01, 0x03, 0xC3, 0xFE, 0x86, 0xFF, 0xE7, 0xAC, 0x01, 0x00, 0x96, 0x97, 0x04, 0x8E,
+    0x98, 0x04, 0x86, 0xB4, 0x0C, 0x80, 0x82, 0x05, 0x86, 0xAC, 0x0A, 0x83, 0xFD, 0x03, 0x03, 0xE5,
+    0xBB, 0x63, 0xD2, 0x00, 0x90, 0x00, 0x98, 0x87, 0x01, 0x02, 0x00, 0x90, 0x45, 0xE3, 0xC6, 0xAB,
+    0x89, 0x98, 0x04, 0x04, 0x20, 0x00, 0x46, 0xD4, 0xC2, 0xC1, 0x00, 0x88, 0x00, 0x90, 0x81, 0x01,
+    0x80, 0x05, 0x03, 0x00, 0x88, 0x00, 0x88, 0x65, 0xEC, 0xC3, 0x49, 0x83, 0x3C, 0x80, 0x03, 0x0A,
+    0x81, 0x10, 0xC6, 0x93, 0xA8, 0xED, 0x27, 0xFD, 0x85, 0xE3, 0x03, 0xCA, 0x01, 0xB1, 0x61, 0xA0,
+    0x20, 0xA0, 0x00, 0x98, 0x00, 0xA0, 0x88, 0x01, 0x00, 0x00, 0xA8, 0x82, 0x01, 0x0B, 0x00, 0xB0,
+    0x00, 0xB0, 0x20, 0xB8, 0x40, 0xB8, 0x81, 0xB8, 0xE1, 0xC0, 0x42, 0xC9, 0xE3, 0xD1, 0x84, 0xD2,
+    0x8A, 0xFD, 0x28, 0xA4, 0x00, 0x00, 0x80, 0xDC, 0x0C, 0x00, 0x60, 0x10, 0x82, 0x9B, 0x04, 0x00,
+    0x80, 0x18, 0x80, 0x9B, 0x04, 0x13, 0xA0, 0x20, 0xA1, 0x28, 0xA1, 0x28, 0xC1, 0x30, 0xC0, 0x30,
+    0xE0, 0x38, 0x20, 0x49, 0x60, 0x59, 0x81, 0x69, 0xC1, 0x71, 0x22, 0x8A, 0x20, 0x9A, 0xA0, 0xB2,
+    0x41, 0xCB, 0x01, 0xDC, 0xE2, 0xEC, 0xA4, 0xF5, 0x47, 0xFE, 0x0D, 0xFF, 0xD5, 0xFF, 0x80, 0x99,
+    0x04, 0x00, 0xFB, 0xFF, 0x80, 0xB4, 0x08, 0x13, 0xFB, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF,
+    0x67, 0xFF, 0x05, 0xFF, 0x84, 0xFE, 0xE4, 0xFD, 0x85, 0xF5, 0xE3, 0xEC, 0x42, 0xE4, 0xE2, 0xD3,
+    0x82, 0xCB, 0x02, 0xBB, 0xC2, 0xB2, 0x61, 0xA2, 0x62, 0x9A, 0xA4, 0x9A, 0x63, 0x8A, 0x44, 0x82,
+    0x80, 0x95, 0x04, 0x0C, 0x24, 0x6A, 0x04, 0x6A, 0xE4, 0x61, 0xC4, 0x59, 0xC4, 0x51, 0xA4, 0x49,
+    0x84, 0x49, 0x84, 0x41, 0x64, 0x41, 0x43, 0x39, 0x44, 0x39, 0x44, 0x31, 0x24, 0x31, 0x82, 0x95,
+    0x04, 0x81, 0xA7, 0x08, 0x80, 0xA8, 0x08, 0x01, 0xE4, 0x20, 0xE4, 0x18, 0x81, 0x98, 0x04, 0x81,
+    0x04, 0x83, 0xDD, 0x07, 0x02, 0xC4, 0x18, 0xE5, 0x18, 0x41, 0x08, 0x82, 0xA5, 0x01, 0xAE, 0xA6,
+    0x08, 0x80, 0x8F, 0x04, 0x84, 0xF6, 0x01, 0x8B, 0x97, 0x04, 0x82, 0x9A, 0x04, 0x00, 0x83, 0x08,
+    0x80, 0xDF, 0x03, 0x00, 0x41, 0x00, 0x88, 0x98, 0x04, 0x8B, 0x01, 0x81, 0xB0, 0x08, 0x01, 0xA3,
+    0x10, 0x83, 0x08, 0x82, 0x98, 0x04, 0x00, 0x63, 0x08, 0x80, 0xD9, 0x08, 0x00, 0xC4, 0x10, 0x80,
+    0x09, 0x80, 0x98, 0x04, 0x0B, 0x42, 0x08, 0xE2, 0x08, 0xE7, 0x2C, 0xEB, 0x4D, 0xAE, 0x65, 0x4F,
+    0x75, 0x6E, 0x6C, 0x4B, 0x5B, 0x28, 0x3A, 0x05, 0x21, 0x42, 0x08, 0x42, 0x08, 0x80, 0xC8, 0x0C,
+    0x84, 0x94, 0x04, 0x85, 0x01, 0x80, 0x96, 0x04, 0x03, 0x12, 0x9D, 0x3A, 0xDF, 0x3A, 0xDF, 0x89,
+    0x4A, 0x82, 0x8F, 0x09, 0x02, 0x00, 0x00, 0x6C, 0x6B, 0x37, 0xBE, 0x80, 0x4F, 0x01, 0x12, 0x9D,
+    0xB1, 0x94, 0x84, 0x77, 0x0A, 0x00, 0x00, 0x00, 0x08, 0x81, 0xAA, 0x61, 0xFE, 0x42, 0xFE, 0x62,
+    0xFE, 0xC2, 0xF3, 0x21, 0x38, 0xA3, 0x10, 0x82, 0x20, 0x00, 0x08, 0x91, 0x61, 0x84, 0x87, 0x03,
+    0x83, 0x05, 0x02, 0x42, 0x29, 0x4A, 0xFF, 0x25, 0xFF, 0x84, 0x94, 0x04, 0x83, 0x98, 0x04, 0x80,
+    0x97, 0x04, 0x81, 0x99, 0x04, 0x04, 0x05, 0xFF, 0x04, 0xFF, 0x86, 0xFF, 0xE9, 0xEE, 0x83, 0x31,
+    0xA6, 0xB2, 0x08, 0x04, 0x00, 0x00, 0xE6, 0x62, 0xCA, 0xFF, 0x45, 0xFF, 0xE4, 0xFE, 0x82, 0xD2,
+    0x04, 0x81, 0x01, 0x02, 0x04, 0xFF, 0x68, 0xFF, 0x03, 0x42, 0x96, 0x98, 0x04, 0x82, 0xC9, 0x0C,
+    0x8A, 0x9B, 0x04, 0x04, 0x01, 0x00, 0x25, 0x42, 0x28, 0x8C, 0x07, 0x8C, 0x06, 0x8C, 0x80, 0x01,
+    0x02, 0xE6, 0x8B, 0x85, 0x7B, 0xA1, 0x10, 0x82, 0xC2, 0x0C, 0x86, 0x98, 0x04, 0x05, 0x00, 0x00,
+    0x20, 0x08, 0x65, 0xDC, 0xA2, 0xC1, 0x00, 0x98, 0x41, 0xA0, 0x81, 0x01, 0x02, 0x40, 0xA0, 0x41,
+    0xA0, 0x41, 0xA8, 0x80, 0x01, 0x04, 0x40, 0xA8, 0x00, 0xA0, 0x01, 0xB9, 0x08, 0xF5, 0xE2, 0x28,
+    0x88, 0x87, 0x0E, 0x07, 0xA1, 0x20, 0x86, 0xEC, 0x01, 0xB1, 0x00, 0x98, 0x41, 0x98, 0x41, 0x98,
+    0x40, 0x98, 0x40, 0xA0, 0x80, 0x02, 0x03, 0x00, 0x98, 0xC1, 0xA8, 0xC5, 0xE4, 0xC1, 0x20, 0x83,
+    0xEB, 0x0A, 0x05, 0x00, 0x00, 0xC3, 0x49, 0xA9, 0xE5, 0x07, 0xFD, 0xE2, 0xC1, 0x40, 0xA0, 0x81,
+    0x8A, 0x04, 0x02, 0x20, 0xA0, 0x40, 0xA8, 0x40, 0xA8, 0x82, 0x31, 0x80, 0x01, 0x00, 0x41, 0xB0,
+    0x81, 0x01, 0x00, 0x61, 0xB0, 0x81, 0x01, 0x00, 0x41, 0xB8, 0x80, 0x01, 0x00, 0x40, 0xB8, 0x80,
+    0x02, 0x06, 0x40, 0xB8, 0x20, 0xC0, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB0, 0xE6, 0xF3, 0x63, 0x6A,
+    0x81, 0x98, 0x04, 0x84, 0x01, 0x81, 0x9D, 0x04, 0x80, 0x9C, 0x04, 0x03, 0xA0, 0x20, 0xA0, 0x28,
+    0xE1, 0x30, 0x00, 0x39, 0x81, 0xD6, 0x0C, 0x21, 0xE1, 0x79, 0xE0, 0x89, 0x60, 0xA2, 0xC0, 0xB2,
+    0x61, 0xCB, 0x21, 0xDC, 0xE3, 0xEC, 0x84, 0xFD, 0x88, 0xFE, 0xB2, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF,
+    0xF6, 0xFF, 0xF6, 0xFF, 0xF9, 0xFF, 0xF7, 0xFF, 0xCE, 0xFF, 0xAB, 0xFF, 0xAC, 0xFF, 0x68, 0xFF,
+    0x83, 0xFE, 0xC3, 0xFD, 0x44, 0xF5, 0xC4, 0xEC, 0x23, 0xDC, 0xC1, 0xD3, 0x62, 0xC3, 0x02, 0xB3,
+    0xA2, 0xA2, 0x41, 0x9A, 0x01, 0x8A, 0x22, 0x8A, 0x44, 0x82, 0x03, 0x7A, 0x80, 0xAA, 0x08, 0x80,
+    0x95, 0x04, 0x80, 0xAB, 0x08, 0x00, 0xA4, 0x49, 0x80, 0x95, 0x04, 0x00, 0x64, 0x39, 0x80, 0xAC,
+    0x08, 0x81, 0x97, 0x04, 0x02, 0x24, 0x29, 0x04, 0x29, 0x04, 0x21, 0x82, 0xBC, 0x0C, 0x84, 0x01,
+    0x81, 0xC2, 0x0C, 0x80, 0x96, 0x04, 0x83, 0x01, 0x02, 0xC4, 0x10, 0x05, 0x19, 0x62, 0x10, 0x83,
+    0xA2, 0x05, 0xAD, 0xA7, 0x08, 0x95, 0x96, 0x03, 0x81, 0x01, 0x00, 0x42, 0x08, 0x84, 0xC8, 0x0C,
+    0x92, 0x98, 0x04, 0x80, 0xB0, 0x08, 0x00, 0x83, 0x08, 0x80, 0x1D, 0x80, 0x95, 0x04, 0x82, 0xB2,
+    0x08, 0x83, 0x98, 0x04, 0x80, 0x99, 0x04, 0x04, 0xC6, 0x29, 0xCB, 0x52, 0xC8, 0x39, 0xE4, 0x20,
+    0x42, 0x08, 0x81, 0xCB, 0x03, 0x00, 0x41, 0x08, 0x80, 0x0C, 0x81, 0x21, 0x89, 0x99, 0x04, 0x06,
+    0x20, 0x00, 0xB5, 0xB5, 0x36, 0xBE, 0x69, 0x4A, 0xD5, 0xB5, 0x1A, 0xDF, 0x82, 0x08, 0x80, 0xCB,
+    0x0C, 0x80, 0x4D, 0x05, 0x69, 0x4A, 0xD9, 0xD6, 0x48, 0x42, 0xEA, 0x5A, 0x16, 0xBE, 0xE3, 0x18,
+    0x84, 0x51, 0x80, 0x59, 0x07, 0xC1, 0xA2, 0xC1, 0xFE, 0x80, 0xFE, 0x81, 0xFE, 0x23, 0xCB, 0x43,
+    0x28, 0xA3, 0x10, 0xA2, 0x20, 0x97, 0x98, 0x04, 0x83, 0xD4, 0x0F, 0x02, 0x00, 0x00, 0x44, 0x4A,
+    0xAB, 0xFF, 0x84, 0x98, 0x04, 0x00, 0x06, 0xFF, 0x83, 0x97, 0x04, 0x82, 0x96, 0x04, 0x82, 0x99,
+    0x04, 0x03, 0xA6, 0xFF, 0xC9, 0xCD, 0x21, 0x00, 0x02, 0x00, 0x9F, 0x93, 0x04, 0x82, 0x22, 0x03,
+    0x01, 0x00, 0xC2, 0x18, 0xEA, 0xEE, 0x65, 0xFF, 0x83, 0xED, 0x08, 0x06, 0x46, 0xFF, 0xA7, 0xFF,
+    0xA8, 0xFF, 0xA7, 0xFF, 0xC7, 0xFF, 0x28, 0xDE, 0x41, 0x08, 0x97, 0xC7, 0x0C, 0x8D, 0xB1, 0x08,
+    0x03, 0x00, 0x00, 0x49, 0xB5, 0xEA, 0xFF, 0xE8, 0xFF, 0x82, 0x01, 0x01, 0x89, 0xFF, 0x02, 0x21,
+    0x80, 0x86, 0x01, 0x81, 0x0F, 0x84, 0x97, 0x04, 0x80, 0x8E, 0x01, 0x04, 0xC1, 0x20, 0xA5, 0xEC,
+    0x21, 0xB9, 0x21, 0xA8, 0x61, 0xA8, 0x86, 0x01, 0x04, 0x61, 0xB0, 0x61, 0xA8, 0x20, 0xA8, 0x26,
+    0xF4, 0xE4, 0x82, 0x80, 0xE4, 0x05, 0x86, 0x98, 0x04, 0x02, 0x62, 0x41, 0x66, 0xF4, 0x81, 0xA8,
+    0x80, 0xAF, 0x04, 0x02, 0x40, 0xA0, 0x61, 0xA0, 0x61, 0xA0, 0x80, 0x05, 0x03, 0x01, 0xA0, 0xA2,
+    0xC1, 0xA5, 0xD4, 0x20, 0x08, 0x83, 0xDF, 0x02, 0x02, 0x64, 0x62, 0x0A, 0xFE, 0x04, 0xDB, 0x80,
+    0x94, 0x04, 0x00, 0x20, 0xA8, 0x80, 0x90, 0x04, 0x81, 0x2C, 0x84, 0x01, 0x82, 0x94, 0x04, 0x00,
+    0x61, 0xB8, 0x84, 0x01, 0x00, 0x61, 0xC0, 0x83, 0x01, 0x04, 0x61, 0xC8, 0x61, 0xC8, 0xA1, 0xC8,
+    0xA7, 0xFC, 0x62, 0x41, 0x80, 0xEF, 0x04, 0x80, 0x01, 0x00, 0x40, 0x08, 0x81, 0x01, 0x82, 0x9B,
+    0x04, 0x81, 0x9A, 0x04, 0x24, 0x81, 0x20, 0xA1, 0x28, 0xA0, 0x28, 0xE0, 0x30, 0x01, 0x41, 0x20,
+    0x51, 0xC1, 0x69, 0xC0, 0x79, 0x20, 0x8A, 0x80, 0xA2, 0xE0, 0xBA, 0x81, 0xCB, 0x21, 0xE4, 0xE2,
+    0xF4, 0x25, 0xFE, 0x4E, 0xFF, 0x70, 0xFF, 0x8F, 0xFF, 0xD1, 0xFF, 0xF1, 0xFF, 0xF2, 0xFF, 0xD4,
+    0xFF, 0x49, 0xFF, 0xC5, 0xFE, 0x84, 0xFE, 0xC6, 0xFE, 0xA5, 0xFE, 0x63, 0xF5, 0x83, 0xE4, 0x23,
+    0xDC, 0xA2, 0xCB, 0x21, 0xBB, 0xE2, 0xB2, 0xA2, 0xA2, 0x62, 0x92, 0x21, 0x8A, 0xC1, 0x79, 0x80,
+    0x96, 0x04, 0x02, 0xC3, 0x61, 0xA3, 0x59, 0xA4, 0x59, 0x80, 0xC0, 0x0C, 0x81, 0xAB, 0x08, 0x81,
+    0x94, 0x04, 0x80, 0x95, 0x04, 0x80, 0x96, 0x04, 0x81, 0x97, 0x04, 0x80, 0xC0, 0x0C, 0x81, 0xA5,
+    0x08, 0x80, 0x93, 0x04, 0x81, 0x94, 0x04, 0x86, 0x01, 0x80, 0xA7, 0x03, 0x80, 0x9F, 0x04, 0x01,
+    0x05, 0x19, 0x83, 0x10, 0x84, 0xE7, 0x0D, 0xAD, 0x01, 0x96, 0x97, 0x04, 0x83, 0xE3, 0x07, 0x93,
+    0x1F, 0x01, 0x22, 0x00, 0xA4, 0x08, 0x81, 0x98, 0x04, 0x82, 0xB0, 0x08, 0x81, 0x99, 0x04, 0x83,
+    0x98, 0x04, 0x03, 0x83, 0x08, 0x83, 0x10, 0x83, 0x08, 0x42, 0x08, 0x80, 0xBB, 0x02, 0x00, 0x41,
+    0x00, 0x80, 0x01, 0x81, 0x1D, 0x80, 0x99, 0x04, 0x8C, 0x46, 0x06, 0x86, 0x31, 0x5A, 0xE7, 0x24,
+    0x21, 0x00, 0x00, 0x65, 0x29, 0x9C, 0xEF, 0xA6, 0x31, 0x80, 0xCA, 0x0C, 0x80, 0x01, 0x05, 0x00,
+    0x00, 0x0F, 0x7C, 0xBC, 0xEF, 0x77, 0xC6, 0x98, 0xCE, 0xAA, 0x52, 0x84, 0x52, 0x80, 0x59, 0x06,
+    0x01, 0x49, 0x62, 0xC4, 0x81, 0xDD, 0x62, 0xA3, 0x45, 0x41, 0x63, 0x10, 0xC3, 0x18, 0x87, 0x98,
+    0x04, 0x85, 0xC6, 0x0C, 0x89, 0x88, 0x05, 0x82, 0xB2, 0x08, 0x04, 0x00, 0x00, 0x46, 0x73, 0xCB,
+    0xFF, 0x25, 0xFF, 0x26, 0xFF, 0x80, 0x01, 0x0A, 0x06, 0xFF, 0x06, 0xFF, 0x47, 0xFF, 0x88, 0xFF,
+    0x88, 0xFF, 0x87, 0xFF, 0x87, 0xFF, 0x88, 0xFF, 0x67, 0xFF, 0x26, 0xFF, 0x05, 0xFF, 0x81, 0x0F,
+    0x00, 0x25, 0xFF, 0x80, 0x01, 0x01, 0x8A, 0xFF, 0xC4, 0x39, 0xA4, 0xB1, 0x08, 0x03, 0x01, 0x00,
+    0x66, 0x73, 0xC9, 0xFF, 0x04, 0xFF, 0x80, 0x2E, 0x80, 0x97, 0x04, 0x06, 0x87, 0xFF, 0xC9, 0xEE,
+    0x07, 0xAD, 0xA7, 0x9C, 0x07, 0xAD, 0x69, 0xD6, 0x45, 0x73, 0x98, 0xC7, 0x0C, 0x84, 0x9A, 0x04,
+    0x86, 0x9D, 0x04, 0x03, 0x02, 0x00, 0x21, 0x00, 0x28, 0xD6, 0x86, 0xFF, 0x81, 0x66, 0x03, 0x25,
+    0xFF, 0x86, 0xFF, 0x68, 0xDE, 0x41, 0x00, 0x81, 0x98, 0x04, 0x81, 0x02, 0x84, 0x99, 0x04, 0x05,
+    0x00, 0x00, 0x82, 0x41, 0xA6, 0xF4, 0xA1, 0xB0, 0x41, 0xB0, 0x81, 0xB0, 0x83, 0x01, 0x00, 0x61,
+    0xB0, 0x82, 0x05, 0x03, 0x20, 0xB0, 0xE2, 0xD1, 0xA6, 0xDC, 0x20, 0x08, 0x86, 0x86, 0x0E, 0x02,
+    0x00, 0x00, 0x63, 0x72, 0x06, 0xF4, 0x80, 0x82, 0x04, 0x84, 0xB1, 0x04, 0x02, 0x01, 0xA0, 0xA3,
+    0xDA, 0xE5, 0xB3, 0x83, 0xDB, 0x02, 0x04, 0xC3, 0x49, 0xA8, 0xFD, 0x03, 0xCA, 0x00, 0xA0, 0x41,
+    0xA8, 0x85, 0x92, 0x04, 0x85, 0x8E, 0x04, 0x81, 0x01, 0x00, 0x81, 0xC0, 0x83, 0x01, 0x00, 0x81,
+    0xC8, 0x83, 0x01, 0x05, 0xA1, 0xC8, 0xA1, 0xD0, 0x61, 0xD0, 0x82, 0xE1, 0xA7, 0xE4, 0x80, 0x18,
+    0x82, 0x98, 0x04, 0x81, 0x9A, 0x04, 0x81, 0x9C, 0x04, 0x80, 0x98, 0x04, 0x03, 0x41, 0x10, 0x60,
+    0x10, 0x61, 0x18, 0x81, 0x18, 0x80, 0x99, 0x04, 0x27, 0xC1, 0x30, 0x01, 0x39, 0x21, 0x49, 0x82,
+    0x61, 0xA1, 0x69, 0xE1, 0x81, 0x41, 0x92, 0xA1, 0xA2, 0x01, 0xBB, 0x81, 0xD3, 0x81, 0xEC, 0x62,
+    0xFD, 0x6B, 0xFE, 0xEF, 0xFE, 0x0D, 0xFF, 0x4D, 0xFF, 0x6D, 0xFF, 0x8D, 0xFF, 0x91, 0xFF, 0x67,
+    0xFE, 0xE5, 0xFD, 0x64, 0xF5, 0x23, 0xF5, 0x84, 0xF5, 0xA3, 0xFD, 0x82, 0xE4, 0xA2, 0xCB, 0x01,
+    0xB3, 0xC1, 0xAA, 0x82, 0x9A, 0x42, 0x92, 0x22, 0x82, 0xE1, 0x79, 0xA1, 0x71, 0xE3, 0x69, 0xE4,
+    0x69, 0x83, 0x59, 0x83, 0x51, 0x83, 0x49, 0x64, 0x49, 0x81, 0x95, 0x04, 0x80, 0x93, 0x04, 0x80,
+    0x01, 0x00, 0x04, 0x29, 0x80, 0x01, 0x00, 0x04, 0x21, 0x81, 0x01, 0x82, 0xBF, 0x0C, 0x82, 0x01,
+    0x82, 0xBF, 0x0C, 0x01, 0x83, 0x10, 0x83, 0x10, 0x81, 0x05, 0x80, 0x09, 0x80, 0xA8, 0x03, 0x04,
+    0x83, 0x08, 0xE4, 0x18, 0xA4, 0x10, 0x22, 0x08, 0x63, 0x08, 0x80, 0xC7, 0x0B, 0x01, 0x42, 0x08,
+    0x22, 0x08, 0x86, 0xC4, 0x01, 0xA7, 0xB4, 0x08, 0x96, 0x9A, 0x04, 0x97, 0x98, 0x04, 0x01, 0x83,
+    0x08, 0x05, 0x19, 0x84, 0xB0, 0x08, 0x81, 0x01, 0x01, 0x83, 0x08, 0xA4, 0x10, 0x80, 0x98, 0x04,
+    0x81, 0xBA, 0x0C, 0x00, 0x42, 0x08, 0x87, 0xA2, 0x08, 0x8E, 0x98, 0x04, 0x02, 0x89, 0x4A, 0xB9,
+    0xCE, 0x62, 0x08, 0x80, 0xCB, 0x0C, 0x01, 0xFA, 0xDE, 0x69, 0x4A, 0x81, 0x98, 0x04, 0x06, 0x21,
+    0x00, 0xA2, 0x10, 0xD5, 0xB5, 0xAA, 0x52, 0x20, 0x00, 0xAD, 0x6B, 0xD9, 0xD6, 0x80, 0xBB, 0x08,
+    0x84, 0x5A, 0x05, 0x62, 0x10, 0x42, 0x18, 0x82, 0x20, 0x43, 0x10, 0x83, 0x10, 0x42, 0x08, 0x88,
+    0x98, 0x04, 0x85, 0x8C, 0x04, 0x8A, 0x0C, 0x82, 0x98, 0x04, 0x01, 0xA9, 0xA4, 0xCA, 0xFF, 0x81,
+    0x97, 0x04, 0x80, 0x01, 0x04, 0x47, 0xFF, 0xE8, 0xEE, 0x67, 0xBD, 0x47, 0xB5, 0x27, 0xB5, 0x80,
+    0x02, 0x02, 0x08, 0xD6, 0x89, 0xFF, 0x46, 0xFF, 0x82, 0xA7, 0x04, 0x80, 0x01, 0x02, 0xE9, 0xFF,
+    0x86, 0x7B, 0x00, 0x00, 0xA2, 0x97, 0x04, 0x03, 0x02, 0x00, 0x01, 0x00, 0x28, 0xB5, 0xA7, 0xFF,
+    0x81, 0xDF, 0x03, 0x03, 0x26, 0xFF, 0x87, 0xFF, 0x88, 0xDE, 0x02, 0x21, 0x83, 0xCC, 0x01, 0x80,
+    0xF9, 0x03, 0x9D, 0x99, 0x04, 0x86, 0xCF, 0x04, 0x02, 0xC2, 0x18, 0xE9, 0xF6, 0x66, 0xFF, 0x82,
+    0x69, 0x02, 0xC8, 0xFF, 0x48, 0xB5, 0x00, 0x00, 0x83, 0x98, 0x09, 0x84, 0xB3, 0x05, 0x80, 0xD4,
+    0x02, 0x03, 0x64, 0x6A, 0x66, 0xFC, 0x61, 0xB8, 0x81, 0xB8, 0x81, 0x01, 0x01, 0xA1, 0xB8, 0xA1,
+    0xB8, 0x83, 0x05, 0x81, 0x06, 0x01, 0x86, 0xFC, 0x03, 0x5A, 0x86, 0xB1, 0x08, 0x03, 0x00, 0x00,
+    0x45, 0x9B, 0x65, 0xF3, 0x20, 0xB0, 0x81, 0x80, 0x04, 0x82, 0xB3, 0x04, 0x02, 0x01, 0xA8, 0xA5,
+    0xEB, 0x04, 0x83, 0x82, 0xD9, 0x02, 0x03, 0x81, 0x18, 0x47, 0xE5, 0x63, 0xDA, 0x00, 0xA8, 0x81,
+    0x91, 0x04, 0x01, 0x81, 0xB0, 0x81, 0xB8, 0x80, 0x8C, 0x04, 0x80, 0x29, 0x84, 0x8E, 0x04, 0x84,
+    0x01, 0x00, 0xA1, 0xC8, 0x83, 0x01, 0x08, 0xA1, 0xD0, 0xA1, 0xD0, 0xC1, 0xD0, 0xC1, 0xD0, 0xC1,
+    0xD8, 0xC1, 0xD0, 0xA1, 0xD8, 0xA3, 0xF2, 0xA7, 0xCC, 0x80, 0x2A, 0x83, 0x98, 0x04, 0x84, 0x9D,
+    0x04, 0x80, 0x9B, 0x04, 0x00, 0x61, 0x18, 0x81, 0x99, 0x04, 0x18, 0xC1, 0x28, 0xE1, 0x30, 0x01,
+    0x41, 0x82, 0x59, 0x81, 0x61, 0xC1, 0x71, 0x01, 0x82, 0x41, 0x92, 0xA0, 0xAA, 0x41, 0xC3, 0xC1,
+    0xD3, 0x22, 0xDC, 0xAA, 0xED, 0x6F, 0xFE, 0x8C, 0xFE, 0xAB, 0xFE, 0xCB, 0xFE, 0xEB, 0xFE, 0x30,
+    0xFF, 0x86, 0xF5, 0xE4, 0xEC, 0x84, 0xDC, 0x23, 0xD4, 0x03, 0xD4, 0x42, 0xDC, 0x80, 0x98, 0x04,
+    0x06, 0xA1, 0xAA, 0x41, 0x92, 0x22, 0x82, 0x02, 0x7A, 0xC2, 0x71, 0xA1, 0x69, 0x61, 0x61, 0x80,
+    0xC4, 0x0C, 0x03, 0xA3, 0x51, 0x84, 0x49, 0x64, 0x41, 0x44, 0x41, 0x82, 0x97, 0x04, 0x80, 0xA9,
+    0x08, 0x81, 0x96, 0x04, 0x01, 0xE4, 0x20, 0xE3, 0x20, 0x80, 0xAD, 0x08, 0x82, 0x92, 0x04, 0x83,
+    0xBA, 0x0C, 0x88, 0x98, 0x04, 0x82, 0x0A, 0x02, 0xC4, 0x18, 0xE4, 0x18, 0x22, 0x00, 0x81, 0x97,
+    0x04, 0x80, 0x01, 0x00, 0x42, 0x00, 0x83, 0x01, 0x80, 0x07, 0x80, 0x8A, 0x03, 0x81, 0x03, 0x85,
+    0xDE, 0x03, 0xB4, 0xB3, 0x08, 0x95, 0x98, 0x04, 0x00, 0x42, 0x00, 0x81, 0x98, 0x04, 0x01, 0x62,
+    0x08, 0xA4, 0x10, 0x81, 0x98, 0x04, 0x00, 0x42, 0x08, 0x83, 0x98, 0x04, 0x81, 0xA3, 0x0C, 0x89,
+    0x01, 0x8A, 0x98, 0x04, 0x82, 0x9C, 0x05, 0x00, 0xCA, 0x52, 0x80, 0x89, 0x04, 0x80, 0x2D, 0x01,
+    0xB9, 0xD6, 0xCB, 0x52, 0x81, 0x48, 0x02, 0x00, 0x00, 0x2B, 0x5B, 0x16, 0xBE, 0x80, 0x0F, 0x02,
+    0xC7, 0x31, 0xD8, 0xD6, 0xC3, 0x10, 0x80, 0xA3, 0x04, 0x81, 0x1B, 0x07, 0x20, 0x00, 0x00, 0x00,
+    0x83, 0x10, 0x84, 0x10, 0x63, 0x10, 0x63, 0x10, 0x62, 0x10, 0x42, 0x10, 0x82, 0x98, 0x04, 0x80,
+    0xF4, 0x02, 0x01, 0x21, 0x08, 0x21, 0x08, 0x8F, 0x95, 0x04, 0x86, 0x42, 0x01, 0xCA, 0xC5, 0xA9,
+    0xFF, 0x84, 0x88, 0x04, 0x00, 0xE7, 0xA4, 0x84, 0xAA, 0x01, 0x02, 0x05, 0x6B, 0x8A, 0xFF, 0x46,
+    0xFF, 0x84, 0x10, 0x00, 0x68, 0x9C, 0x94, 0x98, 0x04, 0x80, 0xDB, 0x03, 0x8B, 0x90, 0x0C, 0x80,
+    0xF8, 0x07, 0x00, 0x08, 0xD6, 0x80, 0xF8, 0x07, 0x81, 0x32, 0x01, 0xE8, 0xFF, 0xC5, 0x7B, 0x80,
+    0xE0, 0x03, 0x82, 0x01, 0x9C, 0x97, 0x04, 0x88, 0x9B, 0x04, 0x01, 0x01, 0x00, 0xC4, 0x41, 0x80,
+    0x81, 0x05, 0x81, 0x01, 0x02, 0x26, 0xFF, 0xEA, 0xFF, 0x07, 0x84, 0x84, 0x67, 0x85, 0xA8, 0x05,
+    0x05, 0x00, 0x00, 0x85, 0x9B, 0xC5, 0xF3, 0x60, 0xB8, 0xA1, 0xC0, 0xC1, 0xC0, 0x89, 0x01, 0x02,
+    0x61, 0xB8, 0xA3, 0xEA, 0x26, 0xC4, 0x80, 0xEA, 0x0E, 0x85, 0x98, 0x04, 0x02, 0x26, 0xCC, 0x84,
+    0xE2, 0x20, 0xB0, 0x82, 0xB4, 0x04, 0x80, 0xB0, 0x04, 0x03, 0x81, 0xB8, 0x61, 0xB0, 0x86, 0xF4,
+    0xE3, 0x51, 0x82, 0xAD, 0x01, 0x03, 0xC6, 0x9B, 0x45, 0xFC, 0x00, 0xB0, 0x41, 0xB8, 0x81, 0x10,
+    0x01, 0x81, 0xC0, 0xA1, 0xC0, 0x85, 0x8F, 0x04, 0x81, 0x9F, 0x08, 0x83, 0x01, 0x01, 0xC1, 0xC8,
+    0xA1, 0xC8, 0x80, 0x91, 0x04, 0x81, 0x01, 0x01, 0xE1, 0xD0, 0xE1, 0xD8, 0x80, 0x01, 0x04, 0x01,
+    0xD9, 0x01, 0xD9, 0xC1, 0xD8, 0xC5, 0xFB, 0xE7, 0xA3, 0x83, 0x97, 0x04, 0x00, 0x20, 0x00, 0x85,
+    0x99, 0x04, 0x02, 0x41, 0x08, 0x40, 0x10, 0x61, 0x10, 0x80, 0x99, 0x04, 0x80, 0xB1, 0x08, 0x21,
+    0xC0, 0x30, 0x01, 0x41, 0x62, 0x51, 0x61, 0x59, 0x81, 0x61, 0xA1, 0x71, 0xE0, 0x81, 0x41, 0x9A,
+    0xA1, 0xAA, 0xE2, 0xB2, 0x42, 0xC3, 0xE9, 0xDC, 0xEE, 0xED, 0xCA, 0xF5, 0x0A, 0xF6, 0x2A, 0xFE,
+    0x29, 0xFE, 0xCF, 0xFE, 0xC6, 0xE4, 0xE3, 0xCB, 0xA3, 0xC3, 0x83, 0xC3, 0x43, 0xBB, 0x23, 0xB3,
+    0x43, 0xBB, 0x82, 0xC3, 0xC1, 0xAA, 0x21, 0x8A, 0xE2, 0x71, 0xC2, 0x69, 0x82, 0x61, 0x61, 0x59,
+    0x41, 0x51, 0xC4, 0x59, 0x82, 0xC4, 0x0C, 0x00, 0x64, 0x39, 0x87, 0x97, 0x04, 0x81, 0xC3, 0x0C,
+    0x80, 0x01, 0x00, 0xC4, 0x18, 0x80, 0x92, 0x04, 0x01, 0xC4, 0x10, 0xC4, 0x10, 0x82, 0x8F, 0x04,
+    0x80, 0xC0, 0x0B, 0x80, 0x02, 0x87, 0x01, 0x80, 0xC9, 0x0C, 0x80, 0x8C, 0x04, 0x82, 0x02, 0x80,
+    0x8E, 0x04, 0x83, 0x03, 0x83, 0x9D, 0x04, 0x84, 0x01, 0x00, 0x41, 0x08, 0x80, 0x8A, 0x03, 0x80,
+    0xB7, 0x01, 0x9A, 0x9F, 0x04, 0x80, 0xB3, 0x08, 0x82, 0x9C, 0x07, 0xA2, 0x98, 0x04, 0x00, 0x22,
+    0x00, 0x81, 0xD5, 0x03, 0x85, 0x98, 0x04, 0x80, 0x95, 0x04, 0x00, 0x42, 0x00, 0x80, 0x03, 0x00,
+    0x63, 0x08, 0x80, 0x98, 0x04, 0x80, 0x99, 0x02, 0x8A, 0x21, 0x00, 0x41, 0x00, 0x87, 0x98, 0x04,
+    0x80, 0x3C, 0x02, 0x61, 0x08, 0xA6, 0x31, 0x48, 0x42, 0x80, 0xB0, 0x08, 0x00, 0x1A, 0xDF, 0x81,
+    0x89, 0x04, 0x01, 0x78, 0xC6, 0xEB, 0x5A, 0x82, 0x98, 0x04, 0x01, 0x6C, 0x63, 0xB8, 0xCE, 0x80,
+    0x04, 0x01, 0x0F, 0x7C, 0x16, 0xBE, 0x81, 0x23, 0x80, 0x44, 0x80, 0x02, 0x80, 0xB0, 0x08, 0x00,
+    0x83, 0x10, 0x80, 0x98, 0x04, 0x02, 0x63, 0x10, 0x42, 0x10, 0xC3, 0x20, 0x80, 0x98, 0x04, 0x01,
+    0x21, 0x08, 0x01, 0x08, 0x80, 0x02, 0x80, 0x01, 0x83, 0xDC, 0x02, 0x90, 0x98, 0x04, 0x04, 0xA2,
+    0x10, 0xCC, 0xE6, 0x88, 0xFF, 0x46, 0xFF, 0x47, 0xFF, 0x80, 0x01, 0x02, 0x26, 0xFF, 0xEB, 0xFF,
+    0xC7, 0x7B, 0x84, 0x80, 0x03, 0x02, 0x00, 0x00, 0x29, 0xD6, 0xA8, 0xFF, 0x80, 0x10, 0x81, 0xB2,
+    0x03, 0x01, 0xEA, 0xFF, 0xA9, 0x9C, 0x83, 0xB1, 0x03, 0x80, 0x90, 0x08, 0x85, 0x01, 0x83, 0xD6,
+    0x07, 0x81, 0x10, 0x83, 0x01, 0x86, 0x19, 0x81, 0x06, 0x02, 0x81, 0x10, 0xE8, 0xEE, 0x86, 0xFF,
+    0x82, 0xE1, 0x03, 0x01, 0xA9, 0xFF, 0xE3, 0x39, 0x82, 0x3F, 0x82, 0xB8, 0x04, 0x81, 0x01, 0x85,
+    0x35, 0x01, 0x02, 0x00, 0x03, 0x00, 0x89, 0x8F, 0x04, 0x80, 0x35, 0x89, 0x49, 0x80, 0x0C, 0x02,
+    0x00, 0x00, 0x05, 0x6B, 0xE9, 0xFF, 0x82, 0x37, 0x02, 0x46, 0xFF, 0xEB, 0xFF, 0x85, 0x52, 0x83,
+    0x77, 0x87, 0x98, 0x04, 0x05, 0x66, 0xCC, 0xE3, 0xEA, 0xA0, 0xC0, 0xE1, 0xC8, 0xE1, 0xC8, 0x01,
+    0xC9, 0x80, 0x03, 0x86, 0x01, 0x03, 0xA1, 0xC8, 0x21, 0xD1, 0xE6, 0xFC, 0x42, 0x39, 0x85, 0x99,
+    0x01, 0x05, 0x81, 0x20, 0xA7, 0xEC, 0xA2, 0xD1, 0x80, 0xC0, 0xC1, 0xC0, 0xA1, 0xC0, 0x81, 0x01,
+    0x04, 0xC1, 0xC0, 0x81, 0xC0, 0x21, 0xC9, 0xE7, 0xF4, 0xE1, 0x28, 0x81, 0xBA, 0x02, 0x03, 0xE1,
+    0x20, 0x47, 0xF5, 0xA2, 0xD1, 0x40, 0xC0, 0x80, 0x94, 0x04, 0x80, 0x0F, 0x01, 0xA1, 0xC0, 0xC1,
+    0xC8, 0x81, 0x01, 0x80, 0x8E, 0x04, 0x02, 0x81, 0xC8, 0x60, 0xC8, 0x40, 0xC8, 0x81, 0x01, 0x04,
+    0x60, 0xC8, 0x60, 0xC8, 0x60, 0xD0, 0x61, 0xD0, 0x81, 0xD0, 0x80, 0x01, 0x03, 0xA1, 0xD0, 0xA1,
+    0xD8, 0xC1, 0xD8, 0xC1, 0xD8, 0x80, 0x95, 0x04, 0x06, 0x01, 0xE1, 0x01, 0xE1, 0x21, 0xE1, 0x21,
+    0xE1, 0x01, 0xE1, 0x87, 0xFC, 0xC5, 0x72, 0x80, 0x98, 0x04, 0x00, 0x00, 0x08, 0x81, 0x98, 0x04,
+    0x80, 0x01, 0x01, 0x21, 0x08, 0x20, 0x08, 0x81, 0x02, 0x01, 0x41, 0x08, 0x41, 0x08, 0x83, 0x98,
+    0x04, 0x1E, 0xE1, 0x30, 0xE0, 0x38, 0x21, 0x49, 0x21, 0x49, 0x41, 0x59, 0x80, 0x61, 0xA1, 0x71,
+    0xE1, 0x81, 0x21, 0x8A, 0x61, 0x9A, 0xC1, 0xAA, 0x68, 0xD4, 0x4C, 0xE5, 0x29, 0xE5, 0x48, 0xED,
+    0x68, 0xF5, 0x88, 0xF5, 0x6F, 0xFE, 0x25, 0xD4, 0x22, 0xB3, 0x23, 0xAB, 0xE3, 0xA2, 0xC3, 0x9A,
+    0x83, 0x9A, 0x83, 0x92, 0x62, 0x92, 0x61, 0x9A, 0x21, 0x8A, 0xA1, 0x69, 0x82, 0x59, 0x42, 0x51,
+    0x80, 0x1D, 0x00, 0xA4, 0x51, 0x80, 0xC4, 0x0C, 0x81, 0x97, 0x04, 0x03, 0x44, 0x31, 0x44, 0x31,
+    0x24, 0x29, 0x24, 0x29, 0x80, 0xC0, 0x0C, 0x83, 0x95, 0x04, 0x83, 0x98, 0x04, 0x81, 0x01, 0x81,
+    0xB1, 0x08, 0x81, 0xAD, 0x08, 0x83, 0x92, 0x04, 0x82, 0xC6, 0x0C, 0x00, 0x83, 0x08, 0x80, 0xEB,
+    0x0F, 0x01, 0x05, 0x19, 0x62, 0x08, 0x80, 0xB1, 0x08, 0x84, 0x90, 0x04, 0x81, 0x01, 0x81, 0xD0,
+    0x0F, 0x84, 0xF1, 0x0F, 0x8A, 0xE5, 0x03, 0x92, 0x93, 0x04, 0x81, 0x02, 0x97, 0xB3, 0x08, 0x91,
+    0x98, 0x04, 0x80, 0x5A, 0x81, 0x98, 0x04, 0x02, 0x26, 0x21, 0x00, 0x00, 0x42, 0x08, 0x80, 0x98,
+    0x04, 0x81, 0x84, 0x05, 0x80, 0x01, 0x01, 0x62, 0x08, 0xA3, 0x08, 0x80, 0x98, 0x04, 0x8C, 0x89,
+    0x0D, 0x86, 0x98, 0x04, 0x09, 0x00, 0x00, 0xAA, 0x52, 0xB5, 0xB5, 0x3A, 0xE7, 0xFE, 0xFF, 0x95,
+    0xAD, 0x00, 0x00, 0x28, 0x42, 0x3A, 0xDF, 0x04, 0x19, 0x80, 0x44, 0x01, 0x57, 0xC6, 0xEB, 0x52,
+    0x82, 0x64, 0x05, 0x86, 0x29, 0xBC, 0xEF, 0x36, 0xC6, 0xB4, 0xB5, 0x19, 0xDF, 0x07, 0x3A, 0x80,
+    0x0E, 0x84, 0x98, 0x04, 0x00, 0x42, 0x08, 0x81, 0x97, 0x04, 0x04, 0x62, 0x10, 0x62, 0x10, 0xA3,
+    0x20, 0x82, 0x20, 0x00, 0x10, 0x82, 0x96, 0x04, 0x80, 0x01, 0x80, 0x06, 0x92, 0x99, 0x04, 0x03,
+    0x00, 0x00, 0x23, 0x29, 0x6D, 0xFF, 0x68, 0xFF, 0x81, 0x97, 0x04, 0x80, 0x01, 0x01, 0xEC, 0xFF,
+    0x65, 0x52, 0x81, 0xFF, 0x04, 0x81, 0x21, 0x02, 0x61, 0x08, 0x8B, 0xDE, 0xA8, 0xFF, 0x80, 0x0D,
+    0x00, 0x67, 0xFF, 0x80, 0x03, 0x01, 0xEB, 0xFF, 0xE8, 0x83, 0x81, 0x98, 0x04, 0x00, 0x02, 0x00,
+    0x80, 0x14, 0x08, 0x43, 0x29, 0xA6, 0x5A, 0xE8, 0x83, 0xA9, 0x9C, 0xE9, 0xA4, 0x88, 0x94, 0xC7,
+    0x7B, 0x45, 0x4A, 0x82, 0x10, 0x83, 0xF0, 0x0B, 0x07, 0x21, 0x00, 0x43, 0x29, 0x84, 0x31, 0x84,
+    0x31, 0x63, 0x29, 0x43, 0x29, 0xE3, 0x18, 0x21, 0x00, 0x80, 0xD9, 0x03, 0x14, 0x22, 0x00, 0xC5,
+    0x39, 0x27, 0x6B, 0xE8, 0x83, 0x27, 0x6B, 0x41, 0x00, 0xA2, 0x10, 0x03, 0x21, 0x06, 0x6B, 0x89,
+    0xFF, 0x66, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x66, 0xFF, 0x87, 0xFF, 0x2A, 0xF7, 0x85, 0x52, 0x84,
+    0x31, 0x83, 0x31, 0x63, 0x31, 0x03, 0x21, 0x81, 0x99, 0x04, 0x82, 0x95, 0x04, 0x09, 0x23, 0x21,
+    0x86, 0x52, 0xA7, 0x73, 0x68, 0x94, 0x88, 0x94, 0x48, 0x8C, 0x46, 0x6B, 0xE4, 0x41, 0x42, 0x08,
+    0x01, 0x00, 0x85, 0x95, 0x04, 0x00, 0x43, 0x00, 0x81, 0x30, 0x07, 0x64, 0x29, 0x86, 0x52, 0xA7,
+    0x7B, 0x48, 0x8C, 0x89, 0x94, 0x28, 0x8C, 0x87, 0x73, 0x85, 0x52, 0x80, 0x25, 0x80, 0x68, 0x05,
+    0xA2, 0x10, 0x23, 0x29, 0x05, 0x42, 0xC9, 0xC5, 0xC8, 0xFF, 0x46, 0xFF, 0x80, 0x38, 0x80, 0x03,
+    0x02, 0x8A, 0xFF, 0x05, 0x6B, 0xA3, 0x31, 0x80, 0x01, 0x01, 0xA4, 0x39, 0x22, 0x21, 0x84, 0x98,
+    0x01, 0x80, 0x1A, 0x04, 0x81, 0x18, 0x07, 0xED, 0x42, 0xE2, 0xE1, 0xD0, 0x21, 0xD1, 0x88, 0x01,
+    0x00, 0x01, 0xD1, 0x80, 0x02, 0x02, 0xA0, 0xC8, 0xA4, 0xFB, 0x85, 0xA3, 0x85, 0x98, 0x04, 0x03,
+    0xA2, 0x49, 0x07, 0xFD, 0x21, 0xC9, 0xC1, 0xC8, 0x84, 0xAD, 0x04, 0x02, 0x80, 0xC0, 0x02, 0xDA,
+    0x86, 0xD4, 0x82, 0xEF, 0x01, 0x02, 0x04, 0x83, 0xA6, 0xFC, 0x80, 0xC8, 0x83, 0x11, 0x02, 0xE1,
+    0xD0, 0xE1, 0xD0, 0x01, 0xD1, 0x80, 0x03, 0x1B, 0xC1, 0xD0, 0x80, 0xC8, 0x01, 0xD1, 0x03, 0xDA,
+    0xA4, 0xEA, 0xE4, 0xEA, 0xC4, 0xEA, 0xA4, 0xEA, 0xA4, 0xEA, 0x83, 0xEA, 0x63, 0xE2, 0x63, 0xEA,
+    0x23, 0xE2, 0x02, 0xE2, 0xE2, 0xE1, 0xC2, 0xE1, 0xC2, 0xE9, 0xC2, 0xE9, 0xA2, 0xE9, 0xA1, 0xE1,
+    0x61, 0xE1, 0x20, 0xE1, 0x20, 0xE9, 0x20, 0xE9, 0x00, 0xE9, 0x20, 0xE9, 0x28, 0xFD, 0xC3, 0x49,
+    0x81, 0xB0, 0x08, 0x80, 0xC4, 0x02, 0x81, 0x88, 0x03, 0x80, 0x01, 0x83, 0x99, 0x04, 0x00, 0x41,
+    0x10, 0x80, 0x99, 0x04, 0x80, 0xC9, 0x0C, 0x06, 0xA0, 0x20, 0xA0, 0x28, 0xE1, 0x30, 0xC1, 0x38,
+    0x01, 0x41, 0x21, 0x51, 0x41, 0x59, 0x80, 0xCC, 0x0C, 0x18, 0xE1, 0x81, 0x41, 0x92, 0xE8, 0xC3,
+    0xCB, 0xD4, 0x88, 0xD4, 0xA8, 0xDC, 0xC7, 0xE4, 0xE7, 0xE4, 0xEE, 0xF5, 0xA4, 0xC3, 0xA2, 0x9A,
+    0xA3, 0x92, 0x63, 0x8A, 0x43, 0x82, 0x23, 0x7A, 0x03, 0x7A, 0xC2, 0x69, 0xA1, 0x69, 0xC1, 0x71,
+    0xA1, 0x69, 0x62, 0x59, 0x21, 0x49, 0x01, 0x41, 0x02, 0x41, 0x84, 0x41, 0x81, 0xAB, 0x08, 0x00,
+    0x44, 0x31, 0x81, 0xAE, 0x08, 0x83, 0x98, 0x04, 0x81, 0x93, 0x04, 0x81, 0x01, 0x85, 0x96, 0x04,
+    0x84, 0x01, 0x81, 0x9C, 0x04, 0x86, 0xB4, 0x08, 0x01, 0xE5, 0x18, 0x83, 0x10, 0x80, 0xB3, 0x03,
+    0x87, 0x95, 0x04, 0x82, 0xB3, 0x08, 0x82, 0x82, 0x03, 0x86, 0xC7, 0x07, 0x97, 0xAF, 0x08, 0x83,
+    0x19, 0x81, 0xF4, 0x02, 0x91, 0x97, 0x04, 0x82, 0x88, 0x0C, 0x8D, 0x99, 0x04, 0x80, 0xB0, 0x08,
+    0x84, 0x98, 0x04, 0x01, 0x42, 0x00, 0xC4, 0x10, 0x82, 0x6C, 0x81, 0x98, 0x04, 0x80, 0x94, 0x05,
+    0x8D, 0x23, 0x87, 0x98, 0x04, 0x03, 0x50, 0x8C, 0x38, 0xC6, 0x50, 0x84, 0x69, 0x4A, 0x80, 0xAC,
+    0x08, 0x09, 0xA6, 0x31, 0x7B, 0xE7, 0x86, 0x29, 0x00, 0x00, 0xC3, 0x10, 0x1A, 0xDF, 0xC7, 0x31,
+    0x00, 0x00, 0x30, 0x84, 0xB1, 0x94, 0x80, 0x28, 0x03, 0x49, 0x42, 0x12, 0x9D, 0x70, 0x8C, 0x45,
+    0x21, 0x81, 0x2D, 0x81, 0x9E, 0x01, 0x00, 0x41, 0x08, 0x80, 0x1F, 0x02, 0x42, 0x10, 0x83, 0x10,
+    0x63, 0x18, 0x80, 0x01, 0x04, 0x62, 0x18, 0xA3, 0x20, 0x82, 0x28, 0x00, 0x10, 0x21, 0x10, 0x80,
+    0x01, 0x80, 0xC8, 0x0C, 0x81, 0x01, 0x90, 0x97, 0x04, 0x80, 0x10, 0x02, 0x00, 0x00, 0x46, 0x4A,
+    0xEE, 0xFF, 0x80, 0x9F, 0x03, 0x05, 0x67, 0xFF, 0x68, 0xFF, 0x67, 0xFF, 0x88, 0xFF, 0x8E, 0xFF,
+    0x63, 0x29, 0x81, 0xD5, 0x03, 0x80, 0xCD, 0x07, 0x03, 0x01, 0x00, 0x03, 0x21, 0x4D, 0xF7, 0x88,
+    0xFF, 0x81, 0x0F, 0x80, 0x01, 0x01, 0xED, 0xFF, 0x07, 0x63, 0x80, 0x98, 0x04, 0x80, 0x30, 0x05,
+    0xA7, 0x52, 0xCB, 0xBD, 0x8D, 0xFF, 0xEC, 0xFF, 0xEB, 0xFF, 0xEA, 0xFF, 0x80, 0x01, 0x03, 0xEB,
+    0xFF, 0xEC, 0xFF, 0xEC, 0xE6, 0x88, 0x73, 0x80, 0x2E, 0x14, 0x22, 0x00, 0x00, 0x00, 0xC5, 0x39,
+    0xB1, 0xFF, 0xCF, 0xFF, 0xCF, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0x0F, 0xE7, 0xE2, 0x20, 0x00, 0x00,
+    0xC8, 0x5A, 0x6E, 0xD6, 0xEE, 0xFF, 0xEE, 0xFF, 0xEF, 0xFF, 0x4E, 0xCE, 0x43, 0x29, 0xED, 0xE6,
+    0x6A, 0xFF, 0xCA, 0xFF, 0x80, 0x2F, 0x82, 0x30, 0x05, 0x89, 0xFF, 0xCC, 0xFF, 0xCD, 0xFF, 0xAD,
+    0xFF, 0xEF, 0xFF, 0xAB, 0x9C, 0x81, 0xCB, 0x04, 0x04, 0x01, 0x00, 0x22, 0x08, 0x08, 0x63, 0xEC,
+    0xC5, 0x6D, 0xF7, 0x84, 0x34, 0x02, 0xCC, 0xFF, 0x8C, 0xD6, 0x27, 0x6B, 0x85, 0x99, 0x04, 0x03,
+    0x01, 0x00, 0xC3, 0x18, 0xC9, 0x7B, 0x4C, 0xCE, 0x83, 0x49, 0x00, 0xEB, 0xFF, 0x80, 0x49, 0x07,
+    0x4C, 0xF7, 0xEB, 0xC5, 0x05, 0x42, 0x23, 0x21, 0xED, 0xE6, 0x8B, 0xFF, 0xCA, 0xFF, 0xA9, 0xFF,
+    0x81, 0x64, 0x81, 0x01, 0x02, 0x89, 0xFF, 0xCB, 0xFF, 0xCB, 0xFF, 0x80, 0x3A, 0x00, 0xEE, 0xFF,
+    0x80, 0x9C, 0x09, 0x83, 0x8D, 0x01, 0x80, 0x8E, 0x01, 0x04, 0x82, 0x39, 0x67, 0xFD, 0xC1, 0xD9,
+    0x41, 0xD9, 0x61, 0xD9, 0x88, 0x01, 0x06, 0x41, 0xD1, 0x41, 0xD9, 0x41, 0xD9, 0x01, 0xD1, 0x02,
+    0xE2, 0x47, 0xF5, 0xC1, 0x20, 0x84, 0x98, 0x04, 0x02, 0xE4, 0x7A, 0xC7, 0xFC, 0xE1, 0xC8, 0x85,
+    0xAF, 0x04, 0x02, 0xA0, 0xC8, 0x24, 0xF3, 0x26, 0xBC, 0x82, 0xB9, 0x02, 0x01, 0x86, 0xC4, 0x44,
+    0xF3, 0x80, 0x8C, 0x04, 0x81, 0xBB, 0x04, 0x81, 0x01, 0x1E, 0x42, 0xD1, 0x22, 0xD1, 0x01, 0xD9,
+    0x21, 0xD1, 0x85, 0xEB, 0xAA, 0xFD, 0xAA, 0xED, 0x29, 0xCD, 0x29, 0xCD, 0x28, 0xCD, 0x29, 0xD5,
+    0x49, 0xD5, 0x69, 0xD5, 0x89, 0xDD, 0xC9, 0xE5, 0xC9, 0xE5, 0xA9, 0xED, 0xA9, 0xED, 0xA8, 0xF5,
+    0xA9, 0xF5, 0xA9, 0xF5, 0xC9, 0xFD, 0x4C, 0xFE, 0x0C, 0xFE, 0x8A, 0xFD, 0x49, 0xFD, 0xE8, 0xFC,
+    0x67, 0xFC, 0x86, 0xFC, 0x89, 0xFD, 0xA1, 0x20, 0x80, 0x98, 0x04, 0x81, 0x93, 0x04, 0x83, 0x98,
+    0x04, 0x81, 0x9A, 0x04, 0x80, 0xC9, 0x0C, 0x82, 0x99, 0x04, 0x80, 0x9A, 0x04, 0x20, 0x81, 0x18,
+    0xA1, 0x28, 0xA1, 0x28, 0xC1, 0x30, 0xE1, 0x38, 0x01, 0x41, 0x21, 0x49, 0x61, 0x59, 0x81, 0x69,
+    0xC1, 0x79, 0x88, 0xAB, 0x4B, 0xC4, 0x08, 0xC4, 0x27, 0xCC, 0x47, 0xD4, 0x67, 0xD4, 0x8E, 0xE5,
+    0x24, 0xAB, 0x22, 0x82, 0x22, 0x7A, 0x02, 0x72, 0xE2, 0x69, 0xC3, 0x61, 0xA3, 0x61, 0x62, 0x51,
+    0x21, 0x51, 0x21, 0x49, 0x41, 0x51, 0x61, 0x51, 0x21, 0x49, 0xE1, 0x38, 0x02, 0x39, 0x64, 0x39,
+    0x80, 0x94, 0x04, 0x81, 0x95, 0x04, 0x81, 0xC4, 0x0C, 0x85, 0xB0, 0x08, 0x83, 0x98, 0x04, 0x87,
+    0x96, 0x04, 0x81, 0x98, 0x04, 0x82, 0xCE, 0x0C, 0x83, 0x01, 0x00, 0x63, 0x08, 0x80, 0xDB, 0x0C,
+    0x86, 0x98, 0x04, 0x83, 0x9C, 0x04, 0x84, 0x8F, 0x04, 0x9B, 0x97, 0x04, 0x81, 0x8E, 0x01, 0x84,
+    0x9C, 0x04, 0x87, 0xBF, 0x04, 0x81, 0x31, 0x83, 0x0E, 0x83, 0xA4, 0x03, 0x81, 0x1A, 0x81, 0x97,
+    0x0C, 0x88, 0xAE, 0x03, 0x82, 0xC4, 0x0C, 0x85, 0xB0, 0x08, 0x00, 0x21, 0x00, 0x83, 0x98, 0x04,
+    0x80, 0x01, 0x80, 0xB0, 0x08, 0x80, 0x75, 0x94, 0x98, 0x04, 0x83, 0x3F, 0x80, 0x01, 0x05, 0x62,
+    0x08, 0xB9, 0xCE, 0x74, 0xA5, 0x28, 0x42, 0xB5, 0xB5, 0x95, 0xAD, 0x80, 0x68, 0x01, 0xCE, 0x73,
+    0x4C, 0x63, 0x84, 0x82, 0x05, 0x82, 0x45, 0x82, 0x8E, 0x01, 0x01, 0x83, 0x10, 0x42, 0x10, 0x80,
+    0x96, 0x04, 0x08, 0x62, 0x20, 0x62, 0x28, 0x62, 0x28, 0xA3, 0x28, 0x82, 0x30, 0x00, 0x18, 0x21,
+    0x18, 0x21, 0x10, 0x01, 0x10, 0x83, 0x9A, 0x04, 0x81, 0xB4, 0x08, 0x81, 0x6B, 0x83, 0x6E, 0x83,
+    0xA3, 0x04, 0x82, 0x03, 0x05, 0x00, 0x00, 0x69, 0x6B, 0xF0, 0xFF, 0x68, 0xFF, 0x88, 0xFF, 0x68,
+    0xFF, 0x80, 0x01, 0x02, 0xCA, 0xFF, 0xEF, 0xE6, 0x82, 0x10, 0x82, 0x86, 0x0C, 0x80, 0xA1, 0x08,
+    0x02, 0x46, 0x4A, 0xEF, 0xFF, 0x88, 0xFF, 0x83, 0x01, 0x01, 0xD0, 0xFF, 0xC5, 0x39, 0x80, 0x43,
+    0x03, 0x24, 0x29, 0xAD, 0xB5, 0xEE, 0xFF, 0xEA, 0xFF, 0x81, 0x1D, 0x83, 0xF9, 0x03, 0x03, 0xA9,
+    0xFF, 0xED, 0xFF, 0x4B, 0xB5, 0x41, 0x08, 0x80, 0x1E, 0x11, 0x07, 0x63, 0xF1, 0xFF, 0xCA, 0xFF,
+    0xC9, 0xFF, 0xAA, 0xFF, 0xEA, 0xFF, 0x4B, 0xF7, 0x61, 0x08, 0xCB, 0x7B, 0xF1, 0xFF, 0xEB, 0xFF,
+    0x89, 0xFF, 0x89, 0xFF, 0xEE, 0xFF, 0x6A, 0x8C, 0xE5, 0x39, 0xED, 0xFF, 0xA7, 0xFF, 0x84, 0x2E,
+    0x80, 0x01, 0x80, 0x0F, 0x80, 0x10, 0x00, 0x68, 0x73, 0x80, 0x98, 0x04, 0x04, 0x00, 0x00, 0x06,
+    0x42, 0x4E, 0xCE, 0xEE, 0xFF, 0xEB, 0xFF, 0x81, 0x34, 0x82, 0x83, 0x09, 0x03, 0x68, 0xFF, 0xC9,
+    0xFF, 0xEE, 0xFF, 0x4A, 0x94, 0x82, 0x99, 0x04, 0x05, 0x03, 0x00, 0x01, 0x00, 0x08, 0x63, 0x0F,
+    0xE7, 0xED, 0xFF, 0xE9, 0xFF, 0x80, 0x15, 0x84, 0x8A, 0x04, 0x03, 0x88, 0xFF, 0xED, 0xFF, 0x86,
+    0x52, 0x65, 0x4A, 0x80, 0x37, 0x00, 0x87, 0xFF, 0x81, 0x74, 0x84, 0x39, 0x00, 0xA8, 0xFF, 0x80,
+    0x01, 0x01, 0xEB, 0xFF, 0xA6, 0x7B, 0x84, 0x98, 0x04, 0x80, 0x8E, 0x01, 0x07, 0x84, 0x6A, 0x26,
+    0xFD, 0xA1, 0xD9, 0xA1, 0xE1, 0xA1, 0xE1, 0xA1, 0xD9, 0xA1, 0xD9, 0xA2, 0xD9, 0x85, 0x01, 0x80,
+    0x09, 0x04, 0x81, 0xD9, 0x61, 0xD9, 0x41, 0xD9, 0xE7, 0xFC, 0x05, 0x83, 0x80, 0x1E, 0x82, 0x1C,
+    0x02, 0x26, 0xB4, 0x05, 0xFC, 0x21, 0xD1, 0x80, 0x0E, 0x83, 0x01, 0x02, 0x01, 0xD9, 0x86, 0xFC,
+    0x25, 0x8B, 0x81, 0xE9, 0x01, 0x03, 0xA1, 0x18, 0x27, 0xED, 0x22, 0xE2, 0x01, 0xD9, 0x82, 0xC5,
+    0x04, 0x01, 0x81, 0xD9, 0x82, 0xD9, 0x80, 0x01, 0x05, 0x62, 0xD9, 0x61, 0xD9, 0xE7, 0xFC, 0xEB,
+    0xE5, 0x65, 0x5A, 0xA1, 0x18, 0x82, 0xED, 0x02, 0x11, 0x20, 0x00, 0x40, 0x08, 0x40, 0x08, 0x61,
+    0x10, 0x81, 0x10, 0xA1, 0x18, 0xC1, 0x18, 0xE1, 0x20, 0xE1, 0x20, 0x02, 0x29, 0x62, 0x31, 0xE4,
+    0x41, 0x45, 0x52, 0xE6, 0x6A, 0x87, 0x7B, 0xE8, 0x93, 0x08, 0x9C, 0x68, 0xAC, 0x80, 0xC7, 0x0C,
+    0x84, 0x92, 0x04, 0x82, 0x01, 0x00, 0x21, 0x00, 0x82, 0xCD, 0x0C, 0x80, 0x22, 0x80, 0x9A, 0x04,
+    0x81, 0x9B, 0x04, 0x05, 0xA2, 0x20, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x30,
+    0x80, 0xB4, 0x08, 0x18, 0x61, 0x61, 0x48, 0x9B, 0xCA, 0xAB, 0x87, 0xAB, 0xA7, 0xB3, 0xA6, 0xBB,
+    0x28, 0xC4, 0x0D, 0xD5, 0x83, 0x92, 0xE2, 0x71, 0xC2, 0x61, 0xA2, 0x59, 0x82, 0x51, 0x62, 0x51,
+    0x63, 0x49, 0x22, 0x41, 0xE1, 0x38, 0xE1, 0x38, 0x01, 0x39, 0x01, 0x41, 0x01, 0x41, 0xE1, 0x38,
+    0x03, 0x31, 0x44, 0x39, 0x04, 0x31, 0x81, 0x94, 0x04, 0x00, 0x04, 0x29, 0x81, 0x94, 0x04, 0x80,
+    0x03, 0x82, 0xC2, 0x0C, 0x87, 0xC4, 0x0C, 0x86, 0x01, 0x88, 0xAF, 0x08, 0x80, 0xF3, 0x0F, 0x00,
+    0xE4, 0x18, 0x84, 0xAC, 0x03, 0x82, 0xBE, 0x03, 0x8C, 0xC3, 0x0C, 0x00, 0x42, 0x08, 0x9A, 0x97,
+    0x04, 0x80, 0xD3, 0x01, 0x87, 0x89, 0x0C, 0x81, 0xE1, 0x0B, 0x80, 0x83, 0x08, 0x81, 0xCC, 0x07,
+    0x81, 0xC0, 0x08, 0x83, 0x9F, 0x03, 0x81, 0xC7, 0x03, 0x00, 0x63, 0x08, 0x80, 0x62, 0x80, 0xF0,
+    0x0A, 0x83, 0x0E, 0x83, 0xEB, 0x04, 0x81, 0x5F, 0x80, 0xCB, 0x0C, 0x01, 0x63, 0x08, 0x26, 0x21,
+    0x80, 0x12, 0x86, 0x98, 0x04, 0x01, 0x83, 0x08, 0xA3, 0x08, 0x97, 0x98, 0x04, 0x84, 0x9D, 0x04,
+    0x03, 0x28, 0x42, 0x98, 0xCE, 0xB8, 0xD6, 0xD2, 0x94, 0x80, 0xE6, 0x0B, 0x81, 0x54, 0x84, 0xD7,
+    0x0D, 0x83, 0x06, 0x10, 0x62, 0x08, 0x66, 0x29, 0x2E, 0x63, 0x46, 0x31, 0x21, 0x18, 0x82, 0x20,
+    0x62, 0x28, 0x62, 0x38, 0x83, 0x38, 0x82, 0x38, 0xA3, 0x40, 0x82, 0x40, 0x00, 0x28, 0x21, 0x20,
+    0x21, 0x20, 0x21, 0x18, 0x21, 0x18, 0x81, 0x9A, 0x04, 0x82, 0xCC, 0x0C, 0x84, 0x95, 0x04, 0x83,
+    0x02, 0x85, 0x98, 0x04, 0x00, 0x8C, 0x94, 0x80, 0x88, 0x04, 0x81, 0xD3, 0x03, 0x02, 0x89, 0xFF,
+    0xEC, 0xFF, 0x0F, 0xC6, 0x80, 0x93, 0x01, 0x83, 0x98, 0x04, 0x01, 0xE9, 0x7B, 0xEF, 0xFF, 0x82,
+    0x0F, 0x07, 0x88, 0xFF, 0xEA, 0xFF, 0xF0, 0xE6, 0x62, 0x08, 0x00, 0x00, 0xE6, 0x41, 0x50, 0xEF,
+    0xEC, 0xFF, 0x81, 0x93, 0x04, 0x80, 0x1F, 0x00, 0xA9, 0xFF, 0x80, 0x0F, 0x82, 0xBB, 0x04, 0x01,
+    0xEE, 0xFF, 0xA8, 0x7B, 0x80, 0x63, 0x02, 0x6B, 0x94, 0xF0, 0xFF, 0xA9, 0xFF, 0x80, 0x0E, 0x02,
+    0xE9, 0xFF, 0x49, 0xCE, 0x49, 0x6B, 0x80, 0x07, 0x07, 0x89, 0xFF, 0x8A, 0xFF, 0x8A, 0xFF, 0xF1,
+    0xFF, 0x28, 0x63, 0x07, 0x63, 0xED, 0xFF, 0x88, 0xFF, 0x80, 0x09, 0x81, 0x01, 0x83, 0x05, 0x02,
+    0x89, 0xFF, 0xEF, 0xFF, 0x46, 0x4A, 0x80, 0x21, 0x01, 0x2A, 0x6B, 0xD0, 0xFF, 0x82, 0x96, 0x04,
+    0x02, 0x69, 0xFF, 0x69, 0xFF, 0x89, 0xFF, 0x81, 0x31, 0x81, 0xFA, 0x03, 0x03, 0xF0, 0xFF, 0x26,
+    0x4A, 0x01, 0x00, 0x43, 0x00, 0x80, 0xC3, 0x08, 0x02, 0x8B, 0x94, 0xEF, 0xFF, 0xCA, 0xFF, 0x80,
+    0x48, 0x84, 0x87, 0x04, 0x81, 0x07, 0x03, 0x6E, 0xFF, 0xC2, 0x10, 0x29, 0x84, 0xEC, 0xFF, 0x81,
+    0x74, 0x86, 0xD1, 0x04, 0x81, 0x9A, 0x04, 0x01, 0xED, 0xFF, 0xA5, 0x5A, 0x85, 0xAB, 0x06, 0x06,
+    0x00, 0x00, 0xE6, 0xA3, 0xC6, 0xFC, 0xC1, 0xE1, 0x01, 0xE2, 0x01, 0xE2, 0xE2, 0xE1, 0x83, 0x01,
+    0x00, 0x02, 0xE2, 0x80, 0x01, 0x82, 0x07, 0x04, 0xC2, 0xE1, 0x61, 0xE1, 0x24, 0xF3, 0xAC, 0xE5,
+    0x41, 0x08, 0x81, 0xC6, 0x05, 0x0A, 0x01, 0x00, 0x41, 0x08, 0x08, 0xDD, 0x44, 0xF3, 0x81, 0xD9,
+    0xC1, 0xE1, 0xC1, 0xE1, 0xC2, 0xE1, 0xC1, 0xD9, 0xC2, 0xD9, 0xC1, 0xD9, 0x80, 0xBB, 0x04, 0x01,
+    0x68, 0xFD, 0x23, 0x5A, 0x81, 0xD7, 0x02, 0x04, 0x83, 0x41, 0x47, 0xFD, 0xA1, 0xE1, 0x81, 0xE1,
+    0xA2, 0xE1, 0x80, 0x01, 0x00, 0xC2, 0xE1, 0x82, 0x01, 0x03, 0x61, 0xE1, 0x84, 0xF3, 0x4B, 0xF6,
+    0x02, 0x29, 0x96, 0xB0, 0x0B, 0x83, 0x96, 0x04, 0x82, 0x05, 0x81, 0x0A, 0x82, 0x68, 0x80, 0xC9,
+    0x0C, 0x01, 0x41, 0x08, 0x21, 0x08, 0x80, 0x9A, 0x04, 0x02, 0x40, 0x10, 0x61, 0x10, 0x82, 0x18,
+    0x82, 0xCF, 0x0C, 0x00, 0xA1, 0x20, 0x80, 0xB4, 0x08, 0x17, 0x42, 0x51, 0x29, 0x8B, 0x69, 0x9B,
+    0x27, 0x9B, 0x47, 0xA3, 0x46, 0xAB, 0xE9, 0xB3, 0x8D, 0xC4, 0xE2, 0x79, 0x82, 0x61, 0x82, 0x51,
+    0x62, 0x49, 0x42, 0x41, 0x22, 0x41, 0x23, 0x39, 0xE2, 0x30, 0xC1, 0x30, 0xC1, 0x28, 0xC2, 0x28,
+    0xC1, 0x28, 0xC1, 0x30, 0xC1, 0x30, 0x03, 0x31, 0x24, 0x31, 0x82, 0x96, 0x04, 0x80, 0xA9, 0x08,
+    0x82, 0xAB, 0x08, 0x82, 0x98, 0x04, 0x82, 0x97, 0x04, 0x00, 0xA4, 0x10, 0x8C, 0xB1, 0x08, 0x84,
+    0x98, 0x04, 0x01, 0x63, 0x08, 0x63, 0x08, 0x80, 0xA3, 0x03, 0x00, 0xC4, 0x18, 0x81, 0xB4, 0x03,
+    0x81, 0xCF, 0x07, 0x81, 0x99, 0x04, 0x8B, 0x01, 0x81, 0xF4, 0x07, 0x94, 0xC2, 0x0C, 0x85, 0xD2,
+    0x03, 0x85, 0xD8, 0x03, 0x80, 0xDD, 0x0B, 0x82, 0xE1, 0x0B, 0x80, 0x99, 0x04, 0x00, 0x62, 0x08,
+    0x80, 0x01, 0x82, 0x30, 0x83, 0x97, 0x03, 0x81, 0x05, 0x01, 0x41, 0x00, 0x83, 0x08, 0x80, 0x88,
+    0x09, 0x83, 0xEC, 0x03, 0x86, 0x89, 0x09, 0x82, 0xB0, 0x08, 0x87, 0x98, 0x04, 0x00, 0x42, 0x08,
+    0x9E, 0x98, 0x04, 0x80, 0x1E, 0x00, 0x41, 0x08, 0x80, 0xC3, 0x03, 0x80, 0x94, 0x04, 0x83, 0xF4,
+    0x04, 0x82, 0x93, 0x04, 0x83, 0x8B, 0x05, 0x0F, 0x6A, 0x4A, 0xD0, 0x73, 0xC8, 0x41, 0x00, 0x20,
+    0x82, 0x38, 0x83, 0x48, 0x41, 0x48, 0x21, 0x48, 0x62, 0x50, 0x83, 0x58, 0xC3, 0x58, 0x82, 0x58,
+    0x21, 0x40, 0x21, 0x38, 0x21, 0x30, 0x21, 0x28, 0x82, 0x9A, 0x04, 0x00, 0x01, 0x10, 0x80, 0xB1,
+    0x08, 0x81, 0xB4, 0x08, 0x8C, 0xCB, 0x0C, 0x80, 0x81, 0x01, 0x01, 0xD0, 0xBD, 0xEE, 0xFF, 0x83,
+    0x98, 0x04, 0x01, 0xEF, 0xFF, 0xED, 0xA4, 0x81, 0x84, 0x0C, 0x82, 0x98, 0x04, 0x01, 0x2D, 0xCE,
+    0xED, 0xFF, 0x81, 0xFA, 0x03, 0x07, 0xA9, 0xFF, 0x88, 0xFF, 0xEE, 0xFF, 0x0D, 0xA5, 0x00, 0x00,
+    0x44, 0x29, 0x50, 0xEF, 0xEB, 0xFF, 0x81, 0xCB, 0x08, 0x05, 0x88, 0xFF, 0xEC, 0xFF, 0xEE, 0xFF,
+    0xAD, 0xFF, 0xCE, 0xFF, 0xEC, 0xFF, 0x82, 0x23, 0x01, 0xEB, 0xFF, 0x6D, 0xD6, 0x80, 0x6B, 0x0A,
+    0x8E, 0xB5, 0xEF, 0xFF, 0xA9, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xCA, 0xFF, 0xCB, 0xE6, 0xED, 0xE6,
+    0xEB, 0xFF, 0x8A, 0xFF, 0xAB, 0xFF, 0x80, 0x01, 0x03, 0xF3, 0xFF, 0x06, 0x3A, 0xCB, 0x9C, 0xED,
+    0xFF, 0x80, 0x0E, 0x00, 0xAA, 0xFF, 0x80, 0x30, 0x81, 0x01, 0x81, 0x08, 0x06, 0xCB, 0xFF, 0x50,
+    0xF7, 0xE3, 0x18, 0x00, 0x00, 0xE9, 0x62, 0xF1, 0xFF, 0xA9, 0xFF, 0x81, 0x80, 0x04, 0x80, 0xE6,
+    0x04, 0x02, 0xEE, 0xFF, 0xCD, 0xFF, 0xEC, 0xFF, 0x80, 0x09, 0x80, 0x9E, 0x04, 0x02, 0x68, 0xFF,
+    0xED, 0xFF, 0xAC, 0x94, 0x81, 0x8E, 0x0D, 0x02, 0x2B, 0x8C, 0xEE, 0xFF, 0xA8, 0xFF, 0x81, 0xDE,
+    0x04, 0x82, 0xBF, 0x04, 0x81, 0x5B, 0x04, 0x69, 0xFF, 0xEB, 0xFF, 0x2E, 0xCE, 0x00, 0x00, 0xEC,
+    0xBD, 0x80, 0x1D, 0x84, 0xCF, 0x04, 0x84, 0x3A, 0x02, 0xCA, 0xFF, 0xCE, 0xFF, 0x63, 0x29, 0x86,
+    0x98, 0x04, 0x05, 0x09, 0xCD, 0x25, 0xFC, 0xE1, 0xE9, 0x42, 0xEA, 0x42, 0xEA, 0x22, 0xEA, 0x80,
+    0x03, 0x81, 0x05, 0x83, 0x06, 0x81, 0x07, 0x03, 0x02, 0xE2, 0xE1, 0xE9, 0x2D, 0xFE, 0xE8, 0x6A,
+    0x82, 0xCA, 0x02, 0x06, 0x23, 0x31, 0xEB, 0xFD, 0xE3, 0xEA, 0xE1, 0xE1, 0x22, 0xE2, 0x22, 0xE2,
+    0x02, 0xE2, 0x80, 0x02, 0x04, 0x02, 0xE2, 0xE1, 0xE1, 0xA2, 0xEA, 0xC9, 0xFD, 0x22, 0x31, 0x81,
+    0xE4, 0x01, 0x02, 0xA5, 0x6A, 0xE7, 0xFC, 0xA1, 0xE1, 0x82, 0xBF, 0x04, 0x07, 0x02, 0xEA, 0x02,
+    0xEA, 0x02, 0xE2, 0x22, 0xEA, 0x02, 0xEA, 0xE2, 0xE9, 0x68, 0xFD, 0x66, 0x8B, 0x83, 0x95, 0x0B,
+    0x00, 0x01, 0x00, 0x83, 0x84, 0x04, 0x95, 0x98, 0x04, 0x00, 0x20, 0x00, 0x80, 0x60, 0x84, 0xF6,
+    0x01, 0x82, 0xD5, 0x0E, 0x04, 0x20, 0x08, 0x41, 0x10, 0x62, 0x10, 0x41, 0x08, 0x61, 0x10, 0x82,
+    0x9A, 0x04, 0x11, 0xA1, 0x28, 0x22, 0x41, 0x29, 0x83, 0x08, 0x8B, 0xC7, 0x8A, 0xE7, 0x92, 0xE6,
+    0x92, 0xCA, 0xAB, 0x0C, 0xAC, 0x41, 0x59, 0x42, 0x51, 0x42, 0x49, 0x22, 0x39, 0x02, 0x39, 0x02,
+    0x31, 0x03, 0x31, 0xC2, 0x28, 0xA1, 0x20, 0x81, 0xC8, 0x08, 0x80, 0x04, 0x00, 0xE3, 0x28, 0x80,
+    0x98, 0x04, 0x83, 0xBF, 0x0C, 0x84, 0x95, 0x04, 0x84, 0x97, 0x04, 0x87, 0x98, 0x04, 0x00, 0x83,
+    0x10, 0x80, 0x94, 0x04, 0x00, 0x83, 0x10, 0x82, 0x9A, 0x04, 0x87, 0x98, 0x04, 0x80, 0x94, 0x03,
+    0x85, 0xBB, 0x03, 0x83, 0x91, 0x0C, 0x86, 0x97, 0x04, 0x01, 0x82, 0x08, 0x41, 0x00, 0x96, 0xAB,
+    0x05, 0x8C, 0xC2, 0x03, 0x80, 0x94, 0x04, 0x00, 0x41, 0x08, 0x80, 0xAE, 0x08, 0x82, 0xB3, 0x08,
+    0x00, 0x83, 0x08, 0x80, 0x9D, 0x0D, 0x00, 0x62, 0x08, 0x81, 0xAC, 0x08, 0x81, 0x89, 0x02, 0x84,
+    0xA7, 0x03, 0x80, 0xA2, 0x0D, 0x01, 0xC4, 0x10, 0x83, 0x08, 0x88, 0x99, 0x04, 0x82, 0x98, 0x04,
+    0x80, 0x0D, 0x83, 0x98, 0x04, 0x81, 0x04, 0x80, 0x7A, 0x9D, 0x98, 0x04, 0x81, 0xE4, 0x04, 0x83,
+    0x86, 0x01, 0x81, 0x04, 0x83, 0x93, 0x02, 0x12, 0x82, 0x10, 0x46, 0x21, 0xC8, 0x31, 0x2A, 0x42,
+    0xC4, 0x18, 0x00, 0x08, 0x00, 0x18, 0x20, 0x38, 0x62, 0x70, 0x41, 0xB0, 0x00, 0xC8, 0x00, 0xC8,
+    0x00, 0xA8, 0x62, 0x88, 0xC3, 0x88, 0xA2, 0x80, 0x21, 0x60, 0x41, 0x50, 0x21, 0x48, 0x84, 0x9A,
+    0x04, 0x83, 0xB3, 0x08, 0x80, 0x01, 0x89, 0x9A, 0x04, 0x80, 0x81, 0x01, 0x01, 0xA2, 0x10, 0x13,
+    0xE7, 0x81, 0x88, 0x04, 0x81, 0x01, 0x01, 0xF1, 0xFF, 0xAA, 0x73, 0x81, 0x8E, 0x01, 0x81, 0x90,
+    0x01, 0x00, 0xE7, 0x5A, 0x80, 0xDB, 0x07, 0x82, 0xEB, 0x03, 0x04, 0xC9, 0xFF, 0xF2, 0xFF, 0xE5,
+    0x39, 0x00, 0x00, 0xEF, 0xC5, 0x83, 0xD6, 0x07, 0x05, 0xEE, 0xFF, 0x0D, 0xC6, 0xC6, 0x5A, 0x63,
+    0x29, 0xC4, 0x39, 0xAD, 0xBD, 0x81, 0x99, 0x04, 0x06, 0x8A, 0xFF, 0xCA, 0xFF, 0x4F, 0xEF, 0xA2,
+    0x10, 0x00, 0x00, 0x70, 0xCE, 0xEE, 0xFF, 0x81, 0x1E, 0x80, 0x82, 0x04, 0x01, 0xCB, 0xFF, 0xAA,
+    0xFF, 0x81, 0x97, 0x04, 0x06, 0xEC, 0xFF, 0x73, 0xF7, 0x03, 0x21, 0xAE, 0xBD, 0xB0, 0xFF, 0x8F,
+    0xFF, 0xAC, 0xFF, 0x82, 0x11, 0x0A, 0xAA, 0xFF, 0xCC, 0xFF, 0xEE, 0xFF, 0xAE, 0xFF, 0xAD, 0xFF,
+    0xEF, 0xFF, 0x8E, 0xB5, 0x00, 0x00, 0x85, 0x29, 0xB3, 0xFF, 0xCA, 0xFF, 0x81, 0x34, 0x07, 0xA9,
+    0xFF, 0xEE, 0xFF, 0xAC, 0xB5, 0xC6, 0x5A, 0xE5, 0x39, 0x07, 0x63, 0x0D, 0xEF, 0xAA, 0xFF, 0x80,
+    0x0A, 0x80, 0x85, 0x04, 0x00, 0xEE, 0xBD, 0x80, 0x53, 0x00, 0xA8, 0x5A, 0x80, 0xDD, 0x08, 0x84,
+    0x93, 0x09, 0x80, 0xE1, 0x04, 0x07, 0x6D, 0xF7, 0x8D, 0xFF, 0xEE, 0xFF, 0xED, 0xFF, 0xF2, 0xFF,
+    0xEB, 0x7B, 0x20, 0x00, 0xCF, 0xDE, 0x80, 0x0A, 0x00, 0xAD, 0xFF, 0x84, 0xCF, 0x04, 0x80, 0x38,
+    0x05, 0xCE, 0xFF, 0xCD, 0xFF, 0xCE, 0xFF, 0xEF, 0xFF, 0x8E, 0xD6, 0x40, 0x08, 0x83, 0xBF, 0x09,
+    0x80, 0x01, 0x04, 0x82, 0x10, 0xEC, 0xE5, 0x84, 0xFB, 0x41, 0xEA, 0x82, 0xEA, 0x83, 0x01, 0x03,
+    0x62, 0xF2, 0xA2, 0xF2, 0xE3, 0xEA, 0x62, 0xEA, 0x82, 0x08, 0x00, 0x62, 0xEA, 0x80, 0x01, 0x02,
+    0x01, 0xEA, 0xA8, 0xFC, 0xF0, 0xD5, 0x81, 0xE8, 0x09, 0x03, 0x00, 0x00, 0x66, 0x5A, 0x6D, 0xFE,
+    0xA2, 0xEA, 0x81, 0x0D, 0x82, 0x01, 0x03, 0x21, 0xEA, 0x84, 0xFB, 0x8A, 0xDD, 0x41, 0x10, 0x81,
+    0xE8, 0x01, 0x02, 0xA7, 0x9B, 0x86, 0xFC, 0xE1, 0xE1, 0x84, 0xBC, 0x04, 0x80, 0x12, 0x03, 0x42,
+    0xEA, 0xC3, 0xF2, 0xC9, 0xFD, 0x42, 0x31, 0x81, 0xFA, 0x03, 0x81, 0x81, 0x02, 0x81, 0x8D, 0x02,
+    0x8F, 0x98, 0x04, 0x86, 0xB8, 0x0B, 0x81, 0xB9, 0x0B, 0x86, 0xB4, 0x0F, 0x80, 0x98, 0x04, 0x80,
+    0x8D, 0x03, 0x82, 0x01, 0x81, 0x9A, 0x04, 0x0A, 0x60, 0x18, 0x43, 0x41, 0x0A, 0x7B, 0xA8, 0x7A,
+    0xA7, 0x7A, 0xA7, 0x7A, 0x86, 0x82, 0xCB, 0x9B, 0x4A, 0x8B, 0xE1, 0x40, 0x02, 0x39, 0x80, 0x96,
+    0x04, 0x02, 0xE2, 0x30, 0xE3, 0x28, 0xE3, 0x28, 0x80, 0xDF, 0x0C, 0x00, 0x61, 0x18, 0x80, 0xAE,
+    0x04, 0x04, 0x81, 0x18, 0x61, 0x18, 0xC3, 0x20, 0xE4, 0x28, 0x04, 0x29, 0x81, 0x97, 0x04, 0x01,
+    0xC3, 0x18, 0xC3, 0x18, 0x82, 0x94, 0x04, 0x00, 0xC4, 0x18, 0x81, 0x84, 0x04, 0x83, 0xC6, 0x0C,
+    0x89, 0x9C, 0x04, 0x81, 0x98, 0x04, 0x80, 0x9E, 0x04, 0x85, 0x98, 0x04, 0x80, 0xBF, 0x03, 0x80,
+    0xA4, 0x03, 0x00, 0x42, 0x08, 0x85, 0xBC, 0x03, 0x88, 0x98, 0x04, 0x02, 0x42, 0x08, 0x83, 0x10,
+    0x41, 0x08, 0x97, 0xC3, 0x09, 0x8A, 0x9A, 0x04, 0x83, 0x31, 0x81, 0x99, 0x04, 0x80, 0x01, 0x81,
+    0x0C, 0x00, 0x62, 0x08, 0x80, 0xB1, 0x0D, 0x84, 0x37, 0x85, 0x1A, 0x03, 0x62, 0x08, 0xC4, 0x10,
+    0xE5, 0x18, 0xA3, 0x10, 0x81, 0x18, 0x85, 0x9A, 0x04, 0x80, 0xC8, 0x0C, 0x80, 0xC1, 0x01, 0x80,
+    0x98, 0x04, 0x80, 0x0E, 0x00, 0x01, 0x00, 0x80, 0x0A, 0x80, 0x02, 0x9F, 0x98, 0x04, 0x86, 0x9E,
+    0x04, 0x83, 0x94, 0x04, 0x15, 0x09, 0x3A, 0x6B, 0x4A, 0x8C, 0x4A, 0x2A, 0x42, 0xA8, 0x29, 0x26,
+    0x21, 0x42, 0x08, 0x00, 0x18, 0x00, 0x28, 0x41, 0x60, 0x21, 0xC0, 0x00, 0xF0, 0x60, 0xF8, 0x60,
+    0xF8, 0x00, 0xF0, 0x00, 0xD0, 0xA3, 0xB8, 0xA3, 0xA8, 0x21, 0x88, 0x41, 0x78, 0x41, 0x68, 0x21,
+    0x50, 0x80, 0xB4, 0x08, 0x84, 0xB3, 0x08, 0x83, 0x98, 0x04, 0x84, 0xC6, 0x0C, 0x84, 0x35, 0x03,
+    0x84, 0x29, 0xD2, 0xFF, 0xA9, 0xFF, 0x87, 0xFF, 0x82, 0xCC, 0x0B, 0x08, 0xEF, 0xFF, 0x29, 0x84,
+    0xA3, 0x39, 0xA3, 0x31, 0x63, 0x31, 0xA4, 0x31, 0xC6, 0x5A, 0x2B, 0xA5, 0xCE, 0xFF, 0x80, 0xD9,
+    0x03, 0x81, 0xAF, 0x03, 0x80, 0xA5, 0x08, 0x03, 0xCF, 0xBD, 0x00, 0x00, 0xE9, 0x5A, 0xF2, 0xFF,
+    0x81, 0xCB, 0x07, 0x02, 0x89, 0xFF, 0xED, 0xFF, 0xCD, 0xBD, 0x82, 0xD3, 0x02, 0x00, 0xE5, 0x39,
+    0x82, 0xA7, 0x08, 0x05, 0xCB, 0xFF, 0x90, 0xF7, 0xC2, 0x18, 0x61, 0x08, 0x33, 0xEF, 0xEC, 0xFF,
+    0x80, 0xDE, 0x07, 0x01, 0xCA, 0xFF, 0xCB, 0xFF, 0x80, 0xBB, 0x04, 0x0A, 0xCB, 0xFF, 0xEE, 0xFF,
+    0xF0, 0xFF, 0xF1, 0xFF, 0xF3, 0xFF, 0x30, 0xCE, 0x20, 0x00, 0xC3, 0x18, 0x03, 0x21, 0xA8, 0x52,
+    0xD2, 0xFF, 0x80, 0xA4, 0x04, 0x81, 0x1B, 0x07, 0xD1, 0xFF, 0xE7, 0x5A, 0x83, 0x31, 0x63, 0x31,
+    0x84, 0x31, 0xC2, 0x18, 0x00, 0x00, 0xB0, 0xB5, 0x80, 0x95, 0x0D, 0x81, 0x89, 0x08, 0x01, 0xED,
+    0xFF, 0x29, 0x84, 0x82, 0x83, 0x03, 0x01, 0x8B, 0x94, 0xED, 0xFF, 0x80, 0xCB, 0x04, 0x80, 0x98,
+    0x04, 0x03, 0x4F, 0xCE, 0x01, 0x00, 0x62, 0x08, 0xF1, 0xE6, 0x81, 0xD5, 0x04, 0x81, 0x97, 0x08,
+    0x0E, 0xEF, 0xFF, 0xCC, 0xBD, 0xE6, 0x62, 0x83, 0x31, 0x03, 0x21, 0x63, 0x29, 0x25, 0x42, 0x87,
+    0x73, 0xCF, 0xBD, 0xC5, 0x39, 0x00, 0x00, 0x43, 0x29, 0x84, 0x31, 0x83, 0x31, 0x0D, 0xA5, 0x82,
+    0x52, 0x80, 0x38, 0x06, 0x91, 0xF7, 0x86, 0x52, 0x83, 0x31, 0xA3, 0x31, 0xA3, 0x39, 0xC4, 0x39,
+    0x02, 0x21, 0x84, 0xDF, 0x0D, 0x80, 0x34, 0x07, 0x64, 0x31, 0x6E, 0xFE, 0x22, 0xF3, 0x81, 0xF2,
+    0xA2, 0xF2, 0xC2, 0xF2, 0xC2, 0xF2, 0xA2, 0xF2, 0x80, 0x01, 0x03, 0x81, 0xF2, 0xA4, 0xFB, 0xCB,
+    0xFD, 0xC2, 0xEA, 0x80, 0x09, 0x81, 0x01, 0x80, 0x0B, 0x09, 0x82, 0xF2, 0x23, 0xF3, 0x53, 0xFF,
+    0x67, 0x52, 0x00, 0x00, 0x42, 0x08, 0x00, 0x00, 0xA9, 0x83, 0x2C, 0xFE, 0xA1, 0xF2, 0x81, 0x18,
+    0x82, 0x01, 0x02, 0x61, 0xF2, 0x66, 0xFC, 0xCA, 0xB4, 0x82, 0xEC, 0x01, 0x02, 0xCA, 0xC4, 0x05,
+    0xFC, 0x42, 0xEA, 0x80, 0xB8, 0x04, 0x00, 0x82, 0xF2, 0x81, 0x01, 0x81, 0x2E, 0x02, 0x84, 0xFB,
+    0xCA, 0xE5, 0x61, 0x10, 0x82, 0x92, 0x08, 0x80, 0xAF, 0x08, 0x83, 0xB1, 0x08, 0x90, 0x9A, 0x04,
+    0x80, 0x12, 0x82, 0xF5, 0x05, 0x81, 0xD0, 0x0F, 0x87, 0xD3, 0x0F, 0x01, 0x00, 0x00, 0x62, 0x08,
+    0x80, 0xCE, 0x0C, 0x81, 0x99, 0x04, 0x13, 0x41, 0x10, 0x61, 0x10, 0x40, 0x10, 0x85, 0x41, 0xC9,
+    0x6A, 0x68, 0x6A, 0x67, 0x6A, 0x67, 0x72, 0x66, 0x72, 0xCD, 0x93, 0x67, 0x6A, 0x80, 0x28, 0xE2,
+    0x30, 0xC2, 0x28, 0xC2, 0x28, 0xC2, 0x20, 0xC2, 0x20, 0xC3, 0x20, 0x82, 0x18, 0x61, 0x18, 0x80,
+    0xAD, 0x04, 0x81, 0x01, 0x00, 0xA3, 0x18, 0x80, 0x96, 0x04, 0x80, 0xB0, 0x08, 0x82, 0xA8, 0x08,
+    0x00, 0xC3, 0x10, 0x80, 0xC4, 0x07, 0x82, 0x01, 0x89, 0xC1, 0x0C, 0x85, 0xB3, 0x08, 0x80, 0xAF,
+    0x08, 0x81, 0xB2, 0x08, 0x81, 0x9B, 0x04, 0x80, 0x98, 0x04, 0x80, 0xBD, 0x03, 0x00, 0x83, 0x10,
+    0x86, 0xBA, 0x03, 0x88, 0x97, 0x04, 0x00, 0x62, 0x08, 0x9B, 0x97, 0x04, 0x88, 0xFA, 0x03, 0x81,
+    0xE5, 0x0B, 0x83, 0x06, 0x80, 0x97, 0x04, 0x80, 0x92, 0x01, 0x81, 0x97, 0x01, 0x04, 0x20, 0x00,
+    0x62, 0x08, 0xC3, 0x10, 0x04, 0x19, 0xA3, 0x10, 0x81, 0xE8, 0x08, 0x83, 0x1E, 0x82, 0x1B, 0x80,
+    0x5D, 0x01, 0x25, 0x19, 0xE5, 0x18, 0x81, 0xF3, 0x03, 0x81, 0x5C, 0x80, 0xAC, 0x0D, 0x81, 0x98,
+    0x04, 0x00, 0x00, 0x00, 0x81, 0x98, 0x04, 0x03, 0x21, 0x00, 0xC4, 0x18, 0x46, 0x21, 0xA3, 0x10,
+    0xA3, 0x98, 0x04, 0x84, 0xA8, 0x08, 0x07, 0x25, 0x21, 0xE9, 0x31, 0x4B, 0x42, 0x6C, 0x4A, 0x2A,
+    0x3A, 0xA8, 0x29, 0x05, 0x19, 0xA4, 0x08, 0x80, 0xC2, 0x05, 0x11, 0x83, 0x08, 0x41, 0x08, 0x00,
+    0x18, 0x20, 0x30, 0x41, 0x80, 0x01, 0xE0, 0x65, 0xF9, 0xF4, 0xFD, 0x52, 0xFD, 0xA7, 0xFA, 0xE2,
+    0xF8, 0x61, 0xF0, 0x21, 0xD8, 0x00, 0xB0, 0x21, 0x98, 0x41, 0x80, 0x21, 0x68, 0x21, 0x58, 0x80,
+    0xB3, 0x08, 0x04, 0x01, 0x30, 0x01, 0x20, 0x01, 0x18, 0x01, 0x18, 0x01, 0x10, 0x84, 0xB2, 0x08,
+    0x81, 0x84, 0x03, 0x86, 0x9E, 0x02, 0x05, 0x86, 0x52, 0xCC, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x05,
+    0xFF, 0x05, 0xFF, 0x80, 0x03, 0x00, 0x46, 0xFF, 0x80, 0xF5, 0x0B, 0x08, 0x69, 0xFF, 0x49, 0xFF,
+    0x6A, 0xFF, 0xCA, 0xFF, 0xC9, 0xFF, 0x45, 0xFF, 0x04, 0xFF, 0x24, 0xFF, 0x25, 0xFF, 0x80, 0x01,
+    0x05, 0x85, 0xFF, 0xAC, 0xFF, 0x84, 0x31, 0x20, 0x00, 0x8F, 0xDE, 0xCA, 0xFF, 0x80, 0x89, 0x0C,
+    0x80, 0xE6, 0x03, 0x01, 0x8F, 0xFF, 0x44, 0x29, 0x82, 0xD6, 0x09, 0x01, 0x69, 0x6B, 0xEE, 0xFF,
+    0x81, 0xEF, 0x03, 0x04, 0xCA, 0xFF, 0x30, 0xEF, 0x41, 0x08, 0x64, 0x29, 0xD2, 0xFF, 0x80, 0xC1,
+    0x08, 0x82, 0xB8, 0x04, 0x06, 0xED, 0xFF, 0xD0, 0xFF, 0x2E, 0xC6, 0x6B, 0x94, 0x08, 0x63, 0x26,
+    0x4A, 0x24, 0x29, 0x81, 0x1A, 0x00, 0xC8, 0x5A, 0x80, 0xB9, 0x0C, 0x81, 0x01, 0x02, 0xEC, 0xFF,
+    0x32, 0xEF, 0x61, 0x08, 0x82, 0x27, 0x01, 0xE7, 0x39, 0xF5, 0xFF, 0x82, 0xA5, 0x04, 0x01, 0xEC,
+    0xFF, 0x6E, 0xD6, 0x80, 0x0C, 0x00, 0x02, 0x00, 0x80, 0x0D, 0x08, 0x8F, 0xB5, 0xED, 0xFF, 0x8A,
+    0xFF, 0x8B, 0xFF, 0x8A, 0xFF, 0xED, 0xFF, 0xAE, 0xBD, 0x00, 0x00, 0x6A, 0x73, 0x80, 0x22, 0x82,
+    0xD2, 0x08, 0x01, 0xEF, 0xFF, 0xAB, 0x94, 0x82, 0xA0, 0x0A, 0x81, 0x9C, 0x03, 0x80, 0x06, 0x80,
+    0xDA, 0x0C, 0x80, 0x05, 0x01, 0xAF, 0xBD, 0xEF, 0xFF, 0x80, 0x95, 0x04, 0x03, 0xAB, 0xFF, 0xAA,
+    0xFF, 0xEE, 0xFF, 0x91, 0xD6, 0x83, 0xC7, 0x07, 0x80, 0x12, 0x85, 0x8E, 0x01, 0x02, 0xA8, 0x5A,
+    0x6F, 0xFE, 0xE2, 0xF2, 0x85, 0x01, 0x05, 0xA1, 0xFA, 0x05, 0xFC, 0x2E, 0xFF, 0x25, 0xF4, 0xC2,
+    0xF2, 0x02, 0xF3, 0x81, 0x01, 0x81, 0x0C, 0x02, 0x81, 0xF2, 0xED, 0xFD, 0x90, 0xBD, 0x80, 0x82,
+    0x02, 0x03, 0x00, 0x00, 0x6F, 0xB5, 0x8A, 0xFD, 0xA1, 0xF2, 0x85, 0x1C, 0x02, 0xA1, 0xF2, 0x8A,
+    0xFD, 0x0A, 0x8C, 0x81, 0x10, 0x02, 0x81, 0x10, 0xAD, 0xDD, 0x84, 0xFB, 0x81, 0xC3, 0x04, 0x80,
+    0x01, 0x83, 0x12, 0x01, 0xA7, 0xFC, 0x4C, 0xC5, 0x83, 0xFD, 0x03, 0x81, 0xD9, 0x01, 0x94, 0x84,
+    0x03, 0x81, 0xA1, 0x02, 0x85, 0xB3, 0x08, 0x86, 0xB2, 0x02, 0x80, 0xC7, 0x02, 0x82, 0xCE, 0x0C,
+    0x81, 0x9B, 0x04, 0x0A, 0x20, 0x10, 0xE7, 0x49, 0x69, 0x5A, 0x07, 0x52, 0x27, 0x5A, 0x27, 0x62,
+    0x47, 0x62, 0xCD, 0x8B, 0x85, 0x49, 0x60, 0x20, 0xA2, 0x20, 0x81, 0x01, 0x03, 0xA2, 0x18, 0xA3,
+    0x18, 0x82, 0x18, 0x61, 0x10, 0x80, 0xAD, 0x04, 0x81, 0xC9, 0x08, 0x01, 0xC3, 0x18, 0xE4, 0x20,
+    0x80, 0x02, 0x81, 0x99, 0x04, 0x80, 0xC4, 0x0C, 0x82, 0xFD, 0x03, 0x83, 0x99, 0x04, 0x84, 0xBC,
+    0x0C, 0x00, 0x83, 0x08, 0x83, 0xBC, 0x08, 0x82, 0x9A, 0x04, 0x82, 0xAB, 0x04, 0x80, 0x14, 0x82,
+    0x9A, 0x04, 0x81, 0x14, 0x85, 0x98, 0x04, 0x8A, 0x97, 0x04, 0x84, 0xAA, 0x07, 0x9D, 0x9B, 0x04,
+    0x81, 0xFA, 0x03, 0x80, 0xC6, 0x0C, 0x82, 0x04, 0x81, 0x06, 0x80, 0x03, 0x84, 0xDE, 0x07, 0x02,
+    0x21, 0x00, 0x83, 0x10, 0x83, 0x08, 0x83, 0x98, 0x04, 0x81, 0x18, 0x83, 0x83, 0x09, 0x80, 0x9A,
+    0x04, 0x02, 0x26, 0x21, 0x26, 0x21, 0xA4, 0x10, 0x81, 0x8A, 0x09, 0x80, 0x64, 0x80, 0x98, 0x04,
+    0x80, 0xB2, 0x04, 0x00, 0xC4, 0x10, 0x80, 0x03, 0x03, 0xA3, 0x10, 0x4B, 0x42, 0x2E, 0x63, 0xE9,
+    0x31, 0x80, 0x96, 0x04, 0x8E, 0x98, 0x04, 0x81, 0xD6, 0x04, 0x8F, 0xA8, 0x08, 0x00, 0x62, 0x08,
+    0x80, 0xA8, 0x08, 0x04, 0x6B, 0x42, 0x6C, 0x42, 0x2A, 0x3A, 0x88, 0x29, 0x06, 0x19, 0x81, 0x94,
+    0x04, 0x80, 0x95, 0x04, 0x81, 0xCB, 0x05, 0x81, 0x98, 0x04, 0x12, 0x61, 0x78, 0x21, 0xD8, 0x85,
+    0xF9, 0xD9, 0xFE, 0xFE, 0xFF, 0xD6, 0xFE, 0x32, 0xFE, 0x90, 0xFD, 0x4C, 0xFC, 0x66, 0xF2, 0x02,
+    0xE1, 0x40, 0xC0, 0x00, 0x98, 0x00, 0x80, 0x01, 0x60, 0x01, 0x48, 0x01, 0x38, 0x01, 0x28, 0x01,
+    0x20, 0x80, 0x9A, 0x04, 0x83, 0xB2, 0x08, 0x81, 0xC5, 0x0A, 0x83, 0x01, 0x81, 0xB8, 0x08, 0x04,
+    0x00, 0x00, 0xA7, 0x7B, 0x87, 0xFF, 0x82, 0xFE, 0xA3, 0xFE, 0x83, 0x01, 0x05, 0xA2, 0xFE, 0xC3,
+    0xFE, 0xC2, 0xFE, 0xC2, 0xFE, 0xA2, 0xFE, 0x82, 0xFE, 0x81, 0x01, 0x00, 0xA2, 0xFE, 0x80, 0x01,
+    0x0B, 0xE2, 0xFE, 0xC7, 0xFF, 0x25, 0x6B, 0x00, 0x00, 0x45, 0x4A, 0xCB, 0xFF, 0xE4, 0xFE, 0xE4,
+    0xFE, 0x05, 0xFF, 0xE5, 0xFE, 0xA7, 0xFF, 0x6A, 0xB5, 0x82, 0xCC, 0x02, 0x02, 0xC4, 0x41, 0xEC,
+    0xE6, 0x66, 0xFF, 0x81, 0xBC, 0x04, 0x06, 0xA7, 0xFF, 0xCB, 0xC5, 0x00, 0x00, 0xA6, 0x5A, 0xAB,
+    0xFF, 0xC4, 0xFE, 0xE4, 0xFE, 0x80, 0xC8, 0x04, 0x03, 0x06, 0xFF, 0xEB, 0xFF, 0x8B, 0xB5, 0xC4,
+    0x39, 0x83, 0xE5, 0x03, 0x0A, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x29, 0x8C, 0xEB, 0xFF, 0x05,
+    0xFF, 0x25, 0xFF, 0x26, 0xFF, 0x25, 0xFF, 0xCA, 0xFF, 0xEC, 0xC5, 0x80, 0x0D, 0x06, 0x02, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xEE, 0xA4, 0xEF, 0xFF, 0x68, 0xFF, 0x68, 0xFF, 0x80, 0xB8, 0x04, 0x01,
+    0xEE, 0xFF, 0x69, 0x6B, 0x82, 0x1C, 0x01, 0x28, 0x63, 0xCF, 0xFF, 0x80, 0xC6, 0x0C, 0x07, 0x69,
+    0xFF, 0x68, 0xFF, 0xED, 0xFF, 0xC9, 0x7B, 0x00, 0x00, 0x8F, 0xD6, 0xCB, 0xFF, 0x68, 0xFF, 0x81,
+    0xC5, 0x0C, 0x02, 0xEB, 0xFF, 0x0F, 0xE7, 0x61, 0x08, 0x81, 0x2F, 0x82, 0x01, 0x00, 0x02, 0x00,
+    0x80, 0x03, 0x80, 0x78, 0x02, 0x62, 0x10, 0x10, 0xE7, 0xCC, 0xFF, 0x80, 0xC4, 0x08, 0x80, 0xCB,
+    0x0C, 0x01, 0xEF, 0xFF, 0x2D, 0xAD, 0x83, 0xDB, 0x01, 0x85, 0x97, 0x04, 0x80, 0xCB, 0x01, 0x03,
+    0x4D, 0x8C, 0x2E, 0xFE, 0xE1, 0xFA, 0x22, 0xFB, 0x84, 0x01, 0x09, 0xE1, 0xFA, 0xC7, 0xFC, 0xB0,
+    0xFF, 0x4B, 0xFE, 0x22, 0xF3, 0x22, 0xFB, 0x42, 0xFB, 0x22, 0xF3, 0x22, 0xF3, 0x23, 0xFB, 0x80,
+    0x01, 0x03, 0x02, 0xFB, 0x06, 0xFC, 0x75, 0xFF, 0xC5, 0x41, 0x80, 0xE2, 0x01, 0x01, 0xB4, 0xDE,
+    0xC8, 0xFC, 0x86, 0x1C, 0x02, 0x02, 0xFB, 0x6E, 0xFE, 0x87, 0x52, 0x81, 0xE6, 0x03, 0x04, 0xC6,
+    0x39, 0xB2, 0xFE, 0x23, 0xF3, 0xE2, 0xF2, 0x02, 0xFB, 0x81, 0x01, 0x01, 0x02, 0xF3, 0x02, 0xFB,
+    0x80, 0x12, 0x02, 0xC1, 0xFA, 0xAC, 0xFD, 0x6C, 0x94, 0x84, 0xF6, 0x03, 0x87, 0x88, 0x04, 0x8A,
+    0xB6, 0x08, 0x80, 0x58, 0x81, 0x18, 0x84, 0xBC, 0x06, 0x83, 0xB0, 0x0D, 0x84, 0x6D, 0x81, 0x9E,
+    0x0B, 0x80, 0x01, 0x81, 0x9A, 0x04, 0x10, 0x62, 0x10, 0x28, 0x4A, 0x08, 0x4A, 0xC7, 0x41, 0xE7,
+    0x49, 0xE6, 0x49, 0x68, 0x5A, 0x6D, 0x7B, 0xA2, 0x28, 0x60, 0x18, 0x81, 0x18, 0x82, 0x18, 0x82,
+    0x18, 0x62, 0x18, 0x62, 0x10, 0x82, 0x10, 0x82, 0x10, 0x83, 0xC8, 0x08, 0x03, 0x41, 0x08, 0xA3,
+    0x18, 0xC3, 0x18, 0xA3, 0x18, 0x80, 0x95, 0x04, 0x80, 0x96, 0x04, 0x80, 0xB0, 0x08, 0x81, 0x87,
+    0x04, 0x81, 0x83, 0x04, 0x80, 0x02, 0x80, 0xAD, 0x03, 0x80, 0xFF, 0x03, 0x82, 0xB8, 0x0C, 0x87,
+    0xB2, 0x08, 0x81, 0x15, 0x80, 0x94, 0x04, 0x81, 0x16, 0x80, 0xAF, 0x04, 0x80, 0x14, 0x00, 0xC4,
+    0x10, 0x82, 0xF2, 0x0F, 0x84, 0xC9, 0x0C, 0xA9, 0x97, 0x04, 0x82, 0xA9, 0x01, 0x84, 0xC2, 0x0C,
+    0x80, 0x01, 0x80, 0xD3, 0x04, 0x00, 0x42, 0x08, 0x86, 0x98, 0x04, 0x81, 0xA6, 0x01, 0x83, 0x98,
+    0x04, 0x86, 0x99, 0x04, 0x81, 0x01, 0x02, 0xC4, 0x10, 0x46, 0x21, 0x47, 0x21, 0x82, 0x63, 0x80,
+    0x98, 0x04, 0x80, 0xB8, 0x0A, 0x80, 0x98, 0x04, 0x05, 0x21, 0x00, 0x6B, 0x4A, 0x7B, 0xCE, 0x3E,
+    0xDF, 0x33, 0x7C, 0xCA, 0x29, 0x80, 0xE9, 0x03, 0x80, 0xA1, 0x04, 0x96, 0x98, 0x04, 0x83, 0x46,
+    0x07, 0x41, 0x08, 0x05, 0x19, 0xC8, 0x31, 0x6B, 0x42, 0x8C, 0x4A, 0x4B, 0x42, 0xC9, 0x31, 0x26,
+    0x19, 0x80, 0xD3, 0x04, 0x80, 0x50, 0x02, 0x62, 0x08, 0xA3, 0x08, 0xA4, 0x08, 0x83, 0xBC, 0x01,
+    0x14, 0x41, 0x08, 0x00, 0x10, 0x00, 0x28, 0x61, 0x58, 0x81, 0xB0, 0x61, 0xE8, 0x02, 0xF9, 0xC4,
+    0xF9, 0x62, 0xF9, 0x04, 0xFA, 0x48, 0xFB, 0x0A, 0xFC, 0x8B, 0xFC, 0x6B, 0xFC, 0xC8, 0xFB, 0xC4,
+    0xFA, 0xC3, 0xE9, 0x01, 0xC9, 0x81, 0x98, 0x20, 0x68, 0x01, 0x40, 0x80, 0x99, 0x04, 0x81, 0x98,
+    0x04, 0x81, 0x99, 0x04, 0x83, 0xA9, 0x06, 0x82, 0xA1, 0x02, 0x81, 0xBF, 0x07, 0x04, 0x87, 0xA4,
+    0x25, 0xFF, 0x41, 0xFE, 0x62, 0xFE, 0x62, 0xFE, 0x82, 0x8F, 0x04, 0x00, 0x82, 0xFE, 0x80, 0x07,
+    0x01, 0x61, 0xFE, 0x41, 0xFE, 0x84, 0x01, 0x02, 0xE3, 0xFE, 0x87, 0xFF, 0xA5, 0x7B, 0x80, 0x56,
+    0x0D, 0x47, 0x94, 0x66, 0xFF, 0x62, 0xFE, 0x83, 0xFE, 0x83, 0xFE, 0x82, 0xFE, 0x67, 0xFF, 0x06,
+    0x6B, 0x61, 0x08, 0x63, 0x31, 0xC4, 0x62, 0x06, 0xB5, 0x27, 0xFF, 0x04, 0xFF, 0x80, 0x1D, 0x80,
+    0x25, 0x04, 0x88, 0xFF, 0xA5, 0x5A, 0x00, 0x00, 0xE6, 0x8B, 0x45, 0xFF, 0x81, 0x2E, 0x02, 0x42,
+    0xFE, 0x25, 0xFF, 0x07, 0xAD, 0x80, 0x1F, 0x81, 0xDE, 0x03, 0x82, 0xE4, 0x03, 0x02, 0x00, 0x00,
+    0x08, 0xAD, 0x46, 0xFF, 0x81, 0xD8, 0x04, 0x02, 0xA2, 0xFE, 0x87, 0xFF, 0x67, 0x9C, 0x82, 0xA3,
+    0x08, 0x0E, 0x62, 0x10, 0xAD, 0xE6, 0x46, 0xFF, 0xE4, 0xFE, 0xE5, 0xFE, 0xE5, 0xFE, 0x25, 0xFF,
+    0x2B, 0xF7, 0x64, 0x29, 0xC2, 0x18, 0xE4, 0x41, 0x86, 0x7B, 0xC9, 0xC5, 0x89, 0xFF, 0x04, 0xFF,
+    0x80, 0x0C, 0x06, 0xC4, 0xFE, 0x45, 0xFF, 0x0A, 0xF7, 0xA2, 0x10, 0x43, 0x29, 0x8C, 0xFF, 0xE4,
+    0xFE, 0x80, 0xCC, 0x04, 0x80, 0x0A, 0x00, 0xC9, 0xFF, 0x80, 0xDC, 0x0C, 0x82, 0xC8, 0x04, 0x84,
+    0x36, 0x80, 0x0A, 0x02, 0x43, 0x29, 0x4D, 0xFF, 0x25, 0xFF, 0x80, 0xEA, 0x04, 0x80, 0x03, 0x01,
+    0xCA, 0xFF, 0xA7, 0x7B, 0x81, 0xDB, 0x01, 0x86, 0x96, 0x04, 0x81, 0xCF, 0x01, 0x03, 0x92, 0xBD,
+    0x6B, 0xFD, 0x01, 0xFB, 0x62, 0xFB, 0x84, 0x01, 0x06, 0x01, 0xFB, 0x0C, 0xFE, 0xEF, 0xCD, 0xB0,
+    0xE6, 0xE7, 0xFC, 0x42, 0xFB, 0x63, 0xFB, 0x84, 0x01, 0x07, 0x22, 0xFB, 0xB0, 0xFE, 0x10, 0xAD,
+    0x00, 0x00, 0x85, 0x31, 0x97, 0xFF, 0x25, 0xFC, 0x22, 0xFB, 0x83, 0x1A, 0x04, 0x63, 0xFB, 0x62,
+    0xFB, 0xA3, 0xFB, 0xD1, 0xFE, 0x64, 0x29, 0x81, 0x98, 0x04, 0x04, 0x0A, 0x63, 0xB2, 0xFE, 0x02,
+    0xFB, 0x23, 0xFB, 0x43, 0xFB, 0x80, 0x01, 0x00, 0x42, 0xFB, 0x82, 0x01, 0x02, 0x21, 0xFB, 0xB2,
+    0xFE, 0x4A, 0x63, 0x85, 0xE8, 0x02, 0x07, 0xE5, 0x41, 0x31, 0xCE, 0x12, 0xCE, 0x12, 0xCE, 0xF1,
+    0xCD, 0xD1, 0xCD, 0xD1, 0xCD, 0xF1, 0xCD, 0x82, 0x01, 0x06, 0xD0, 0xCD, 0xB0, 0xCD, 0xB0, 0xCD,
+    0x8E, 0xCD, 0x6D, 0xCD, 0x2B, 0xCD, 0xE8, 0x9B, 0x82, 0xAF, 0x04, 0x81, 0xEB, 0x01, 0x83, 0xAD,
+    0x09, 0x81, 0xC4, 0x0E, 0x83, 0xCD, 0x02, 0x80, 0x0B, 0x80, 0xFA, 0x03, 0x83, 0x73, 0x0B, 0x21,
+    0x08, 0x00, 0x00, 0xC4, 0x18, 0x29, 0x4A, 0xA7, 0x39, 0x86, 0x39, 0xA6, 0x39, 0x85, 0x39, 0x8A,
+    0x5A, 0xAA, 0x5A, 0x20, 0x10, 0x41, 0x10, 0x80, 0xD4, 0x0C, 0x01, 0x61, 0x10, 0x62, 0x10, 0x80,
+    0x01, 0x00, 0x42, 0x10, 0x84, 0xC8, 0x08, 0x80, 0xDD, 0x06, 0x80, 0x02, 0x81, 0xC7, 0x0C, 0x81,
+    0x99, 0x04, 0x81, 0x01, 0x87, 0xBD, 0x0C, 0x82, 0x9D, 0x04, 0x01, 0xA4, 0x10, 0x84, 0x10, 0x82,
+    0xE3, 0x02, 0x80, 0x0B, 0x80, 0x21, 0x81, 0x06, 0x82, 0xAE, 0x08, 0x81, 0x9E, 0x04, 0x00, 0xA4,
+    0x10, 0x80, 0xC5, 0x0B, 0x81, 0xB7, 0x03, 0x87, 0xAD, 0x08, 0x80, 0xCC, 0x07, 0xA5, 0x97, 0x04,
+    0x83, 0xB7, 0x05, 0x00, 0x41, 0x00, 0x80, 0x89, 0x0D, 0x80, 0x01, 0x82, 0x9C, 0x04, 0x80, 0x9B,
+    0x04, 0x84, 0x9A, 0x04, 0x85, 0x98, 0x04, 0x86, 0x95, 0x04, 0x00, 0x42, 0x00, 0x80, 0x1D, 0x80,
+    0x04, 0x05, 0xA4, 0x08, 0x06, 0x19, 0x26, 0x21, 0x62, 0x08, 0x42, 0x00, 0x63, 0x00, 0x82, 0x98,
+    0x04, 0x80, 0x5D, 0x06, 0xB4, 0x94, 0x9F, 0xEF, 0x19, 0xBE, 0x70, 0x63, 0xEB, 0x31, 0x27, 0x19,
+    0x83, 0x08, 0x8D, 0x98, 0x04, 0x85, 0xC8, 0x0C, 0x83, 0x9C, 0x06, 0x10, 0x21, 0x00, 0xC4, 0x10,
+    0x87, 0x29, 0x4A, 0x42, 0x8C, 0x4A, 0x6B, 0x42, 0xC9, 0x29, 0x26, 0x19, 0xA4, 0x08, 0x62, 0x00,
+    0x62, 0x00, 0x83, 0x08, 0x42, 0x00, 0x05, 0x19, 0xEC, 0x52, 0x6A, 0x4A, 0x04, 0x21, 0x80, 0x64,
+    0x82, 0xB5, 0x01, 0x08, 0x83, 0x08, 0x42, 0x08, 0x00, 0x10, 0x00, 0x18, 0x20, 0x40, 0x40, 0x70,
+    0x40, 0xA8, 0x00, 0xC8, 0x00, 0xD8, 0x80, 0x01, 0x10, 0x00, 0xD0, 0x00, 0xC8, 0x00, 0xC8, 0x20,
+    0xC0, 0xA2, 0xC0, 0x42, 0xC9, 0xC3, 0xD9, 0xE3, 0xE9, 0xA2, 0xF1, 0x42, 0xE9, 0xE2, 0xD0, 0x81,
+    0xB0, 0x41, 0x80, 0x21, 0x50, 0x00, 0x28, 0x00, 0x10, 0x00, 0x08, 0x85, 0x98, 0x04, 0x81, 0x9A,
+    0x04, 0x81, 0xB0, 0x08, 0x05, 0x01, 0x00, 0x87, 0xC5, 0xE3, 0xFE, 0x41, 0xFE, 0x42, 0xFE, 0x42,
+    0xFE, 0x81, 0xF6, 0x03, 0x00, 0x61, 0xFE, 0x80, 0x01, 0x80, 0x91, 0x04, 0x00, 0x21, 0xFE, 0x80,
+    0x01, 0x05, 0x41, 0xFE, 0x81, 0xFE, 0xE3, 0xFE, 0x26, 0xFF, 0xE7, 0xD5, 0x43, 0x52, 0x81, 0x9A,
+    0x01, 0x02, 0xE7, 0xD5, 0xC3, 0xFE, 0x21, 0xFE, 0x80, 0x19, 0x07, 0x41, 0xFE, 0xA4, 0xFE, 0xA5,
+    0xDD, 0x25, 0xE6, 0xE6, 0xFE, 0x46, 0xFF, 0x03, 0xFF, 0x81, 0xFE, 0x81, 0x19, 0x02, 0xA2, 0xFE,
+    0x06, 0xFF, 0xA5, 0x8B, 0x80, 0x6F, 0x08, 0x06, 0xB5, 0xC3, 0xFE, 0x00, 0xFE, 0x01, 0xFE, 0x01,
+    0xFE, 0x00, 0xFE, 0x25, 0xFF, 0xA3, 0x62, 0x00, 0x00, 0x86, 0xE2, 0x03, 0x02, 0x21, 0x00, 0xE7,
+    0xCD, 0xC3, 0xFE, 0x81, 0x40, 0x02, 0x41, 0xFE, 0x67, 0xFF, 0x45, 0x73, 0x82, 0x98, 0x04, 0x01,
+    0xA3, 0x39, 0x28, 0xFF, 0x80, 0xDE, 0x04, 0x80, 0xCB, 0x04, 0x08, 0xA3, 0xFE, 0xC6, 0xFE, 0x27,
+    0xDE, 0xA7, 0xF6, 0x27, 0xFF, 0x66, 0xFF, 0x04, 0xFF, 0x81, 0xFE, 0x61, 0xFE, 0x80, 0xCA, 0x04,
+    0x05, 0x23, 0xFF, 0xC6, 0xF6, 0x24, 0x4A, 0x00, 0x00, 0x46, 0x73, 0x67, 0xFF, 0x81, 0xCB, 0x04,
+    0x80, 0x01, 0x01, 0x28, 0xFF, 0xA3, 0x39, 0x82, 0x94, 0x03, 0x86, 0x98, 0x04, 0x02, 0x00, 0x00,
+    0x44, 0x4A, 0x49, 0xFF, 0x82, 0x8B, 0x05, 0x02, 0x81, 0xFE, 0x48, 0xFF, 0x84, 0x52, 0x8A, 0xDB,
+    0x01, 0x07, 0x01, 0x00, 0x62, 0x08, 0xB5, 0xDE, 0xE8, 0xFC, 0x62, 0xFB, 0xA2, 0xFB, 0xC2, 0xFB,
+    0xA2, 0xFB, 0x82, 0x01, 0x06, 0x62, 0xFB, 0x32, 0xFF, 0x4A, 0x63, 0xAB, 0x73, 0x31, 0xFF, 0x82,
+    0xFB, 0xA3, 0xFB, 0x84, 0x01, 0x07, 0x42, 0xFB, 0x87, 0xFC, 0x77, 0xF7, 0x82, 0x10, 0xA8, 0x52,
+    0x94, 0xFF, 0xC3, 0xFB, 0x82, 0xFB, 0x81, 0x18, 0x00, 0xA3, 0xFB, 0x80, 0x02, 0x02, 0x82, 0xFB,
+    0xC7, 0xFC, 0x92, 0xDE, 0x82, 0xBA, 0x0F, 0x06, 0xAF, 0x94, 0x30, 0xFE, 0x01, 0xFB, 0x63, 0xFB,
+    0x83, 0xFB, 0x82, 0xFB, 0x82, 0xFB, 0x81, 0x03, 0x80, 0x01, 0x02, 0xA3, 0xFB, 0x35, 0xFF, 0xE7,
+    0x39, 0x85, 0xB0, 0x08, 0x08, 0xEB, 0x7B, 0x32, 0xFF, 0xE8, 0xFC, 0x09, 0xFD, 0x08, 0xFD, 0x08,
+    0xFD, 0xE8, 0xFC, 0xC8, 0xFC, 0xC8, 0xFC, 0x80, 0x07, 0x01, 0x09, 0xFD, 0xE8, 0xFC, 0x81, 0x01,
+    0x02, 0xA6, 0xFC, 0x2B, 0xFE, 0x2C, 0xBD, 0x82, 0x8E, 0x04, 0x86, 0x96, 0x04, 0x83, 0x04, 0x83,
+    0x93, 0x06, 0x86, 0x8E, 0x0F, 0x09, 0x01, 0x00, 0x66, 0x29, 0xE8, 0x39, 0x66, 0x29, 0x66, 0x31,
+    0x66, 0x31, 0x65, 0x31, 0xCB, 0x62, 0xA6, 0x39, 0x00, 0x08, 0x81, 0xBE, 0x0C, 0x80, 0xBC, 0x07,
+    0x02, 0x62, 0x08, 0x62, 0x10, 0x42, 0x08, 0x83, 0xCE, 0x0A, 0x80, 0x98, 0x04, 0x81, 0x01, 0x80,
+    0x90, 0x08, 0x81, 0xC6, 0x0C, 0x87, 0xB8, 0x0C, 0x8A, 0x01, 0x82, 0x97, 0x04, 0x82, 0x93, 0x04,
+    0x85, 0x01, 0x01, 0x83, 0x10, 0xC4, 0x10, 0x80, 0xD5, 0x0B, 0x84, 0xC8, 0x0C, 0x83, 0x54, 0x00,
+    0x41, 0x00, 0x80, 0x11, 0x87, 0xAD, 0x09, 0x9C, 0x93, 0x04, 0x85, 0xBE, 0x04, 0x80, 0xD4, 0x03,
+    0x01, 0x82, 0x08, 0x82, 0x08, 0x81, 0x9B, 0x04, 0x81, 0xBB, 0x08, 0x83, 0x11, 0x86, 0x98, 0x04,
+    0x88, 0x99, 0x04, 0x82, 0x9A, 0x04, 0x03, 0xA4, 0x10, 0x26, 0x21, 0x42, 0x00, 0x62, 0x00, 0x80,
+    0x9C, 0x04, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x06, 0x42, 0x00, 0x53, 0x7C, 0xD5, 0x8C, 0xEE,
+    0x52, 0xCA, 0x29, 0xCA, 0x29, 0x67, 0x21, 0x91, 0xB0, 0x08, 0x84, 0xA8, 0x08, 0x00, 0xE4, 0x18,
+    0x80, 0x94, 0x04, 0x04, 0x6B, 0x4A, 0x4B, 0x42, 0xE9, 0x31, 0x46, 0x21, 0xA3, 0x08, 0x81, 0x39,
+    0x80, 0xBD, 0x0C, 0x05, 0x83, 0x08, 0x63, 0x08, 0xA3, 0x10, 0xB4, 0x8C, 0x98, 0xA5, 0xE9, 0x39,
+    0x80, 0xB8, 0x05, 0x00, 0x00, 0x00, 0x81, 0x0B, 0x81, 0x01, 0x0D, 0x41, 0x10, 0x00, 0x10, 0x00,
+    0x20, 0x20, 0x48, 0x20, 0x68, 0x20, 0x78, 0x20, 0x88, 0x20, 0x90, 0x20, 0x88, 0x41, 0x80, 0x21,
+    0x70, 0x21, 0x70, 0x00, 0x68, 0x00, 0x58, 0x81, 0x01, 0x0B, 0x20, 0x60, 0x41, 0x78, 0x61, 0x90,
+    0x82, 0xB0, 0xA2, 0xC8, 0x82, 0xD0, 0x42, 0xC0, 0x21, 0x98, 0x21, 0x68, 0x21, 0x40, 0x01, 0x20,
+    0x01, 0x08, 0x81, 0xCA, 0x0A, 0x82, 0x99, 0x04, 0x00, 0x01, 0x00, 0x80, 0x02, 0x02, 0x81, 0x10,
+    0x27, 0xE6, 0x82, 0xFE, 0x82, 0x8D, 0x04, 0x80, 0xBB, 0x03, 0x01, 0x03, 0xFF, 0x24, 0xFF, 0x80,
+    0xA0, 0x0C, 0x01, 0x03, 0xFF, 0x03, 0xFF, 0x80, 0xE4, 0x07, 0x03, 0xA4, 0xFE, 0x04, 0xDE, 0x84,
+    0xA4, 0x43, 0x52, 0x80, 0xC4, 0x06, 0x80, 0xB7, 0x02, 0x02, 0xE2, 0x20, 0xA8, 0xF6, 0x42, 0xFE,
+    0x80, 0x82, 0x04, 0x80, 0x01, 0x00, 0x21, 0xFE, 0x81, 0xC8, 0x08, 0x03, 0x42, 0xFE, 0x43, 0xFE,
+    0x63, 0xFE, 0xA3, 0xFE, 0x80, 0x1B, 0x00, 0x84, 0xCD, 0x81, 0xAD, 0x04, 0x03, 0x41, 0x08, 0xE6,
+    0xD5, 0x62, 0xFE, 0xE0, 0xFD, 0x80, 0x01, 0x02, 0x00, 0xFE, 0xE5, 0xFE, 0x22, 0x4A, 0x83, 0xC4,
+    0x0C, 0x81, 0x01, 0x03, 0x01, 0x00, 0xA2, 0x18, 0x67, 0xEE, 0x62, 0xFE, 0x81, 0x40, 0x02, 0x21,
+    0xFE, 0x26, 0xFF, 0x03, 0x4A, 0x81, 0xC8, 0x0C, 0x02, 0x01, 0x00, 0x45, 0x73, 0x26, 0xFF, 0x82,
+    0x4C, 0x0C, 0x42, 0xFE, 0x82, 0xFE, 0xC3, 0xFE, 0xA3, 0xFE, 0x83, 0xFE, 0x63, 0xFE, 0x63, 0xFE,
+    0xA2, 0xFE, 0xE3, 0xFE, 0x24, 0xFF, 0xE4, 0xFE, 0xE4, 0xB4, 0x42, 0x31, 0x80, 0xA6, 0x01, 0x01,
+    0xE6, 0xAC, 0xE4, 0xFE, 0x82, 0x48, 0x02, 0x62, 0xFE, 0x47, 0xE6, 0x61, 0x10, 0x82, 0xEA, 0x0C,
+    0x85, 0xCF, 0x04, 0x80, 0xFF, 0x0C, 0x00, 0x65, 0x73, 0x80, 0x2B, 0x81, 0x87, 0x05, 0x02, 0x41,
+    0xFE, 0xE7, 0xFE, 0x83, 0x31, 0x81, 0xAC, 0x04, 0x81, 0xD3, 0x01, 0x84, 0xB3, 0x08, 0x03, 0x00,
+    0x00, 0x64, 0x29, 0x14, 0xFF, 0xA5, 0xFB, 0x83, 0x94, 0x08, 0x81, 0xED, 0x03, 0x05, 0xC3, 0xFB,
+    0x74, 0xFF, 0xC5, 0x31, 0x82, 0x10, 0x96, 0xF7, 0x08, 0xFD, 0x80, 0x07, 0x83, 0x01, 0x0A, 0xA3,
+    0xFB, 0x83, 0xFB, 0x11, 0xFF, 0x6B, 0x9C, 0xEC, 0xB4, 0xCE, 0xFE, 0xA2, 0xFB, 0xC3, 0xFB, 0x03,
+    0xFC, 0x03, 0xFC, 0xE3, 0xFB, 0x81, 0x01, 0x02, 0xA2, 0xFB, 0x0E, 0xFE, 0xB2, 0xB5, 0x82, 0xFF,
+    0x01, 0x02, 0x14, 0xC6, 0xAD, 0xFD, 0x62, 0xFB, 0x84, 0x1E, 0x80, 0x01, 0x03, 0xA2, 0xFB, 0x87,
+    0xFC, 0x59, 0xEF, 0xE3, 0x18, 0x85, 0xEA, 0x02, 0x02, 0x92, 0xB5, 0xCC, 0xFD, 0x00, 0xFB, 0x83,
+    0xC2, 0x08, 0x80, 0xDC, 0x0C, 0x83, 0x07, 0x03, 0x42, 0xFB, 0x01, 0xFB, 0x50, 0xFE, 0x0C, 0x84,
+    0x80, 0xBE, 0x02, 0x84, 0x98, 0x04, 0x82, 0x9B, 0x04, 0x81, 0x04, 0x81, 0x0E, 0x81, 0xD4, 0x06,
+    0x00, 0x21, 0x08, 0x86, 0x98, 0x04, 0x09, 0x42, 0x08, 0xC8, 0x31, 0x66, 0x29, 0x25, 0x21, 0x45,
+    0x29, 0x45, 0x29, 0x86, 0x31, 0xCC, 0x5A, 0xC3, 0x18, 0x20, 0x08, 0x80, 0x96, 0x03, 0x81, 0x98,
+    0x03, 0x80, 0x81, 0x03, 0x84, 0xE5, 0x0E, 0x82, 0x98, 0x04, 0x80, 0xA9, 0x0C, 0x80, 0x91, 0x04,
+    0x81, 0xAD, 0x0C, 0x80, 0x09, 0x85, 0x8C, 0x04, 0x00, 0x84, 0x08, 0x82, 0xD3, 0x0C, 0x02, 0xC4,
+    0x10, 0xE5, 0x10, 0xC5, 0x10, 0x85, 0xA7, 0x04, 0x81, 0xAF, 0x08, 0x87, 0x01, 0x80, 0x12, 0x80,
+    0x49, 0x84, 0xC3, 0x03, 0x81, 0x9A, 0x04, 0x02, 0x42, 0x08, 0x83, 0x10, 0x82, 0x10, 0x9E, 0x91,
+    0x04, 0x81, 0x82, 0x03, 0x86, 0x9A, 0x04, 0x84, 0x0A, 0x80, 0x71, 0x80, 0x9B, 0x04, 0x82, 0xB6,
+    0x08, 0x82, 0xEE, 0x07, 0x83, 0x1D, 0x8A, 0xB0, 0x08, 0x00, 0x42, 0x00, 0x80, 0x97, 0x01, 0x81,
+    0x01, 0x80, 0xF8, 0x07, 0x80, 0xFB, 0x07, 0x00, 0x06, 0x21, 0x80, 0xE0, 0x03, 0x00, 0x83, 0x08,
+    0x80, 0x03, 0x04, 0x4B, 0x3A, 0x4C, 0x3A, 0x27, 0x19, 0xA9, 0x29, 0x0A, 0x32, 0x80, 0x90, 0x01,
+    0x8C, 0x98, 0x04, 0x84, 0x4F, 0x08, 0xC3, 0x10, 0x67, 0x29, 0x2A, 0x3A, 0x6B, 0x42, 0x6C, 0x42,
+    0x0A, 0x3A, 0x67, 0x21, 0xC4, 0x10, 0x63, 0x00, 0x81, 0x94, 0x04, 0x81, 0x01, 0x82, 0xA3, 0x08,
+    0x02, 0x4B, 0x42, 0xCD, 0x4A, 0x63, 0x08, 0x81, 0x53, 0x01, 0x01, 0x00, 0x42, 0x00, 0x81, 0xA3,
+    0x04, 0x81, 0xC2, 0x05, 0x07, 0x21, 0x10, 0x00, 0x18, 0x00, 0x28, 0x00, 0x38, 0x21, 0x48, 0x21,
+    0x50, 0x20, 0x50, 0x21, 0x48, 0x81, 0x01, 0x06, 0x21, 0x40, 0x21, 0x38, 0x21, 0x38, 0x21, 0x30,
+    0x21, 0x30, 0x21, 0x28, 0x01, 0x20, 0x81, 0x01, 0x09, 0x21, 0x30, 0x21, 0x50, 0x21, 0x70, 0x21,
+    0x90, 0x41, 0x98, 0x41, 0x98, 0x21, 0x80, 0x21, 0x60, 0x21, 0x40, 0x21, 0x28, 0x80, 0xCF, 0x0C,
+    0x82, 0x9D, 0x04, 0x03, 0x01, 0x00, 0x42, 0x31, 0xA7, 0xFE, 0x21, 0xFE, 0x81, 0x82, 0x08, 0x80,
+    0xFF, 0x03, 0x0A, 0xC4, 0xFE, 0xE5, 0xB4, 0x05, 0x8C, 0x05, 0x94, 0x04, 0x8C, 0xC4, 0x8B, 0xA4,
+    0x83, 0x23, 0x73, 0x42, 0x52, 0x62, 0x31, 0x61, 0x08, 0x83, 0xDF, 0x06, 0x05, 0x00, 0x00, 0xE3,
+    0x41, 0xE6, 0xFE, 0x01, 0xFE, 0xE1, 0xFD, 0xE1, 0xFD, 0x80, 0x84, 0x04, 0x80, 0x98, 0x04, 0x07,
+    0xC3, 0xFE, 0xE5, 0xFE, 0x26, 0xFF, 0x06, 0xFF, 0x86, 0xF6, 0x85, 0xD5, 0x03, 0x94, 0x02, 0x4A,
+    0x81, 0xA5, 0x0F, 0x04, 0x01, 0x00, 0x02, 0x21, 0x86, 0xF6, 0x01, 0xFE, 0xC0, 0xFD, 0x80, 0x01,
+    0x02, 0x01, 0xFE, 0xA6, 0xFE, 0x21, 0x29, 0x87, 0x98, 0x04, 0x02, 0xA3, 0x39, 0xC7, 0xFE, 0x22,
+    0xFE, 0x81, 0x3F, 0x02, 0x41, 0xFE, 0xC7, 0xFE, 0x22, 0x29, 0x80, 0x10, 0x80, 0x98, 0x04, 0x03,
+    0x86, 0xA4, 0xE4, 0xFE, 0xE0, 0xFD, 0xE1, 0xFD, 0x82, 0xCB, 0x04, 0x08, 0xE4, 0xFE, 0x05, 0xFF,
+    0x46, 0xFF, 0x46, 0xFF, 0x27, 0xFF, 0xA6, 0xEE, 0x65, 0xC5, 0x84, 0x83, 0x62, 0x31, 0x81, 0x27,
+    0x01, 0x20, 0x00, 0xA6, 0xD5, 0x80, 0xCB, 0x04, 0x81, 0x49, 0x01, 0x82, 0xFE, 0x86, 0xCD, 0x81,
+    0xD1, 0x08, 0x81, 0x97, 0x04, 0x86, 0xFF, 0x0C, 0x01, 0x86, 0x9C, 0xC5, 0xFE, 0x82, 0xAE, 0x04,
+    0x02, 0x41, 0xFE, 0x67, 0xEE, 0xA2, 0x10, 0x85, 0xDC, 0x0C, 0x84, 0xDA, 0x01, 0x06, 0x25, 0x4A,
+    0xCB, 0xFD, 0xA1, 0xE1, 0xA1, 0xE1, 0xC1, 0xE1, 0xE1, 0xE1, 0x01, 0xE2, 0x80, 0x01, 0x17, 0x01,
+    0xEA, 0xE1, 0xE9, 0xE3, 0xF2, 0x4E, 0xF6, 0xE2, 0x18, 0x00, 0x00, 0xAD, 0x9C, 0xCB, 0xFD, 0xC1,
+    0xE9, 0x22, 0xEA, 0x42, 0xEA, 0x42, 0xEA, 0x62, 0xEA, 0x62, 0xEA, 0x42, 0xEA, 0x22, 0xEA, 0xE1,
+    0xE9, 0xC6, 0xF3, 0x2C, 0xFF, 0x0B, 0xFF, 0x66, 0xFC, 0x21, 0xEA, 0x82, 0xEA, 0xA2, 0xF2, 0x83,
+    0x01, 0x02, 0x61, 0xF2, 0x0E, 0xFE, 0x2C, 0x84, 0x81, 0x82, 0x02, 0x02, 0x81, 0x10, 0xD4, 0xE6,
+    0xC7, 0xFB, 0x80, 0x11, 0x84, 0x01, 0x03, 0x82, 0xF2, 0x21, 0xF2, 0x48, 0xFC, 0x12, 0xCE, 0x85,
+    0xF0, 0x02, 0x05, 0x20, 0x00, 0xAD, 0xD5, 0xC6, 0xFB, 0xE1, 0xE9, 0x22, 0xE2, 0x02, 0xE2, 0x86,
+    0x01, 0x05, 0x02, 0xEA, 0x02, 0xEA, 0xE2, 0xE9, 0xE1, 0xE9, 0x0F, 0xFE, 0xA7, 0x5A, 0x83, 0x98,
+    0x04, 0x81, 0xCB, 0x08, 0x83, 0x03, 0x83, 0x01, 0x81, 0x6B, 0x80, 0x82, 0x03, 0x85, 0xCE, 0x02,
+    0x07, 0xE4, 0x18, 0xE8, 0x31, 0x26, 0x21, 0x05, 0x21, 0x25, 0x21, 0x25, 0x21, 0x09, 0x3A, 0x29,
+    0x42, 0x80, 0xAA, 0x04, 0x81, 0xAE, 0x08, 0x81, 0x80, 0x03, 0x80, 0x18, 0x81, 0x1F, 0x82, 0x98,
+    0x04, 0x80, 0x0B, 0x00, 0x63, 0x08, 0x83, 0xB4, 0x08, 0x83, 0xB8, 0x08, 0x85, 0xFF, 0x03, 0x00,
+    0xA3, 0x08, 0x80, 0xA7, 0x04, 0x86, 0xBE, 0x08, 0x83, 0x06, 0x87, 0xB3, 0x08, 0x80, 0x0B, 0x84,
+    0xB0, 0x08, 0x82, 0x98, 0x04, 0x01, 0x62, 0x08, 0xA3, 0x10, 0x80, 0xBA, 0x03, 0x9F, 0x98, 0x04,
+    0x83, 0x65, 0x86, 0x99, 0x08, 0x85, 0xFC, 0x0B, 0x80, 0x9B, 0x04, 0x80, 0x7E, 0x85, 0x1D, 0x84,
+    0x17, 0x88, 0x99, 0x04, 0x83, 0x98, 0x04, 0x80, 0x67, 0x01, 0x62, 0x08, 0x05, 0x19, 0x83, 0x98,
+    0x04, 0x04, 0x21, 0x00, 0xE5, 0x10, 0x68, 0x21, 0x8C, 0x42, 0xE5, 0x18, 0x80, 0x0F, 0x80, 0xB6,
+    0x0A, 0x81, 0x24, 0x00, 0x20, 0x00, 0x82, 0x29, 0x83, 0x9E, 0x09, 0x09, 0x21, 0x00, 0xA3, 0x10,
+    0x46, 0x21, 0xE9, 0x31, 0x4B, 0x42, 0x2A, 0x3A, 0xC9, 0x31, 0x47, 0x21, 0xC4, 0x10, 0x63, 0x08,
+    0x83, 0xA8, 0x08, 0x80, 0x86, 0x04, 0x83, 0x98, 0x04, 0x03, 0x42, 0x00, 0x87, 0x29, 0xD1, 0x6B,
+    0xE5, 0x18, 0x80, 0x94, 0x04, 0x00, 0x22, 0x00, 0x80, 0xE6, 0x0D, 0x80, 0xFF, 0x0C, 0x81, 0x0F,
+    0x80, 0x02, 0x07, 0x83, 0x10, 0x42, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x28, 0x00, 0x28, 0x80, 0x04, 0x01, 0x00, 0x30, 0x01, 0x28, 0x80, 0x01, 0x04, 0x01, 0x20, 0x21,
+    0x20, 0x01, 0x18, 0x01, 0x18, 0x01, 0x10, 0x80, 0x01, 0x81, 0xA4, 0x08, 0x0A, 0x01, 0x08, 0x01,
+    0x10, 0x21, 0x28, 0x21, 0x40, 0x21, 0x50, 0x21, 0x68, 0x21, 0x68, 0x21, 0x60, 0x21, 0x50, 0x01,
+    0x38, 0x01, 0x20, 0x80, 0x0F, 0x04, 0x00, 0x00, 0x44, 0x52, 0xE6, 0xFE, 0xE0, 0xFD, 0xC0, 0xFD,
+    0x80, 0xB8, 0x03, 0x80, 0xFF, 0x03, 0x01, 0xA5, 0xFE, 0x21, 0x29, 0x86, 0xB0, 0x01, 0x85, 0xD9,
+    0x06, 0x01, 0x04, 0x6B, 0xC5, 0xFE, 0x81, 0x82, 0x04, 0x08, 0xC0, 0xFD, 0x21, 0xFE, 0x24, 0xEE,
+    0x24, 0xC5, 0xA4, 0xB4, 0x04, 0x94, 0x04, 0x73, 0x23, 0x4A, 0x02, 0x21, 0x85, 0xF2, 0x06, 0x03,
+    0xE3, 0x41, 0xA5, 0xFE, 0xC0, 0xFD, 0xA0, 0xFD, 0x80, 0x01, 0x02, 0x01, 0xFE, 0x25, 0xE6, 0x81,
+    0x10, 0x86, 0xFC, 0x07, 0x02, 0x01, 0x00, 0x83, 0x5A, 0xE5, 0xFE, 0x80, 0xF5, 0x03, 0x80, 0x3F,
+    0x02, 0x62, 0xFE, 0x06, 0xDE, 0x61, 0x08, 0x81, 0x98, 0x04, 0x03, 0x21, 0x00, 0x66, 0xCD, 0x63,
+    0xFE, 0xA0, 0xFD, 0x81, 0x34, 0x07, 0x42, 0xFE, 0xE4, 0xE5, 0x25, 0xC5, 0x85, 0xAC, 0xC5, 0x8B,
+    0x04, 0x6B, 0xE3, 0x41, 0xC2, 0x18, 0x84, 0x33, 0x01, 0xC2, 0x18, 0x46, 0xEE, 0x82, 0xCB, 0x04,
+    0x02, 0xC0, 0xFD, 0xA3, 0xFE, 0xC6, 0xB4, 0x8A, 0x98, 0x04, 0x80, 0x17, 0x01, 0x86, 0xCD, 0x63,
+    0xFE, 0x81, 0x38, 0x03, 0xE1, 0xFD, 0x82, 0xFE, 0xA7, 0xCD, 0x21, 0x00, 0x85, 0xC3, 0x08, 0x84,
+    0xA4, 0x03, 0x04, 0xA4, 0x72, 0x45, 0xFC, 0xE0, 0xD0, 0x01, 0xD1, 0x21, 0xD1, 0x81, 0x01, 0x04,
+    0x21, 0xD9, 0x41, 0xD9, 0xE0, 0xD8, 0xC4, 0xF2, 0xC9, 0xD4, 0x80, 0xEC, 0x01, 0x04, 0x02, 0x29,
+    0xC7, 0xF4, 0x81, 0xE1, 0x01, 0xD9, 0x21, 0xD9, 0x82, 0x0F, 0x06, 0x21, 0xD9, 0x01, 0xD1, 0x41,
+    0xD9, 0x04, 0xEB, 0xA4, 0xEB, 0xE2, 0xE1, 0xE1, 0xD0, 0x82, 0x0A, 0x81, 0x01, 0x02, 0x20, 0xD9,
+    0x2B, 0xFD, 0x65, 0x5A, 0x81, 0xAA, 0x01, 0x04, 0x23, 0x29, 0xEC, 0xFD, 0xA2, 0xE1, 0xE1, 0xD8,
+    0x01, 0xD9, 0x84, 0x2E, 0x03, 0x21, 0xD9, 0xE0, 0xD0, 0xC6, 0xFB, 0xC8, 0x93, 0x85, 0xF0, 0x02,
+    0x04, 0xC1, 0x18, 0xA6, 0xEC, 0x81, 0xD9, 0xA0, 0xD0, 0xE1, 0xC8, 0x83, 0x01, 0x00, 0xE1, 0xD0,
+    0x81, 0x01, 0x04, 0x01, 0xD1, 0xE1, 0xD0, 0xC1, 0xD0, 0x21, 0xD9, 0xC9, 0xF4, 0x80, 0xB4, 0x09,
+    0x84, 0xBF, 0x0C, 0x82, 0x06, 0x83, 0x08, 0x81, 0xCD, 0x01, 0x80, 0xC4, 0x02, 0x80, 0xF8, 0x0B,
+    0x85, 0xC7, 0x0C, 0x03, 0x87, 0x29, 0x87, 0x29, 0x05, 0x19, 0x05, 0x19, 0x80, 0x99, 0x04, 0x01,
+    0x6B, 0x4A, 0x25, 0x21, 0x80, 0xFF, 0x0A, 0x83, 0x01, 0x81, 0xCA, 0x0B, 0x83, 0xB9, 0x04, 0x01,
+    0x62, 0x08, 0x83, 0x10, 0x81, 0xD6, 0x02, 0x80, 0x92, 0x08, 0x81, 0x9B, 0x04, 0x82, 0xE5, 0x06,
+    0x80, 0x9C, 0x07, 0x81, 0x04, 0x01, 0xA4, 0x08, 0xA4, 0x08, 0x89, 0xA1, 0x08, 0x82, 0x8B, 0x04,
+    0x80, 0x97, 0x04, 0x81, 0xCD, 0x08, 0x81, 0xD2, 0x0C, 0x83, 0xC9, 0x0C, 0x83, 0xAF, 0x08, 0x80,
+    0xFA, 0x0B, 0xA4, 0x97, 0x04, 0x85, 0xA9, 0x08, 0x85, 0x83, 0x01, 0x84, 0x06, 0x83, 0xD7, 0x05,
+    0x84, 0xC7, 0x0C, 0x80, 0x1D, 0x81, 0x20, 0x83, 0x50, 0x8A, 0xB2, 0x08, 0x00, 0x42, 0x08, 0x84,
+    0x98, 0x04, 0x01, 0x63, 0x08, 0x62, 0x08, 0x81, 0xC2, 0x01, 0x81, 0xD8, 0x0C, 0x80, 0x98, 0x01,
+    0x80, 0xB0, 0x08, 0x00, 0x20, 0x00, 0x80, 0x01, 0x85, 0xA8, 0x08, 0x81, 0x94, 0x04, 0x03, 0x2A,
+    0x3A, 0x0A, 0x3A, 0xA8, 0x31, 0x26, 0x21, 0x80, 0xB0, 0x0C, 0x81, 0xC4, 0x04, 0x82, 0x90, 0x04,
+    0x02, 0x62, 0x08, 0x41, 0x00, 0x62, 0x08, 0x83, 0x9B, 0x04, 0x80, 0x98, 0x04, 0x01, 0x26, 0x21,
+    0xE9, 0x31, 0x80, 0xD4, 0x01, 0x80, 0x3F, 0x81, 0x87, 0x06, 0x84, 0xA9, 0x04, 0x80, 0xAF, 0x01,
+    0x02, 0x63, 0x10, 0x21, 0x18, 0x00, 0x18, 0x81, 0x01, 0x01, 0x01, 0x18, 0x21, 0x18, 0x81, 0x02,
+    0x83, 0x95, 0x04, 0x00, 0x21, 0x10, 0x80, 0xA4, 0x08, 0x01, 0x00, 0x08, 0x01, 0x08, 0x80, 0x01,
+    0x83, 0x99, 0x02, 0x09, 0x01, 0x08, 0x01, 0x18, 0x21, 0x28, 0x01, 0x38, 0x01, 0x40, 0x01, 0x38,
+    0x01, 0x30, 0x00, 0x10, 0x44, 0x83, 0xA5, 0xFE, 0x81, 0xE9, 0x03, 0x80, 0x01, 0x01, 0x21, 0xFE,
+    0xE5, 0xE5, 0x81, 0xE7, 0x0B, 0x83, 0xCA, 0x06, 0x86, 0x99, 0x04, 0x07, 0xC4, 0x8B, 0xA4, 0xFE,
+    0x80, 0xFD, 0xA0, 0xFD, 0x80, 0xFD, 0x80, 0xFD, 0xA3, 0xFE, 0x04, 0x9C, 0x88, 0xE5, 0x06, 0x81,
+    0x01, 0x01, 0xE3, 0x6A, 0xC4, 0xFE, 0x80, 0x13, 0x03, 0x80, 0xFD, 0x60, 0xFD, 0x42, 0xFE, 0x25,
+    0xCD, 0x81, 0x12, 0x80, 0xD0, 0x03, 0x82, 0xD2, 0x03, 0x04, 0x01, 0x00, 0xE5, 0x8B, 0xC4, 0xFE,
+    0xC1, 0xFD, 0xC1, 0xFD, 0x81, 0xF6, 0x03, 0x00, 0x25, 0xBD, 0x81, 0xC0, 0x08, 0x03, 0x02, 0x00,
+    0x82, 0x10, 0xC6, 0xDD, 0x02, 0xFE, 0x80, 0x34, 0x80, 0x01, 0x01, 0xC4, 0xFE, 0x83, 0x62, 0x81,
+    0x34, 0x87, 0x33, 0x02, 0x22, 0x21, 0x66, 0xF6, 0xC1, 0xFD, 0x82, 0x61, 0x01, 0xA3, 0xFE, 0x85,
+    0xAC, 0x81, 0x98, 0x04, 0x84, 0xAC, 0x08, 0x81, 0x07, 0x80, 0xBF, 0x0D, 0x02, 0x26, 0xE6, 0x22,
+    0xFE, 0xA0, 0xFD, 0x80, 0x39, 0x03, 0xA0, 0xFD, 0xC3, 0xFE, 0xA6, 0xAC, 0x00, 0x00, 0x86, 0xDA,
+    0x0C, 0x82, 0x9B, 0x04, 0x03, 0x00, 0x00, 0x24, 0x93, 0x43, 0xFB, 0x80, 0xC8, 0x85, 0xD4, 0x03,
+    0x02, 0x80, 0xC8, 0xE4, 0xF2, 0x65, 0xAB, 0x81, 0x46, 0x03, 0x04, 0xA3, 0xE3, 0xF2, 0x81, 0xC8,
+    0xC1, 0xC8, 0x83, 0x01, 0x03, 0xC1, 0xD0, 0xA1, 0xC8, 0x40, 0xC8, 0x40, 0xC8, 0x84, 0x0B, 0x05,
+    0xA1, 0xC8, 0xC1, 0xD0, 0x80, 0xD0, 0x21, 0xD1, 0x46, 0xEC, 0xE2, 0x28, 0x81, 0x8A, 0x02, 0x03,
+    0xA2, 0x51, 0x84, 0xFC, 0xA1, 0xD0, 0xA1, 0xC8, 0x81, 0x01, 0x83, 0x15, 0x02, 0x80, 0xC8, 0xA4,
+    0xFB, 0x63, 0x72, 0x85, 0xEE, 0x02, 0x04, 0x41, 0x39, 0x04, 0xF4, 0x80, 0xC8, 0x60, 0xC0, 0x80,
+    0xC0, 0x80, 0x01, 0x00, 0xA1, 0xC0, 0x83, 0x01, 0x81, 0x1F, 0x03, 0x61, 0xC8, 0x81, 0xD9, 0x26,
+    0xDC, 0x60, 0x10, 0x82, 0x98, 0x04, 0x8A, 0xC6, 0x01, 0x81, 0x88, 0x03, 0x80, 0xD8, 0x02, 0x85,
+    0xC7, 0x0C, 0x03, 0x01, 0x00, 0xA3, 0x10, 0xC8, 0x31, 0x26, 0x21, 0x80, 0x98, 0x04, 0x00, 0x05,
+    0x19, 0x80, 0x91, 0x0F, 0x80, 0xFC, 0x06, 0x85, 0x98, 0x04, 0x83, 0x82, 0x02, 0x81, 0x21, 0x82,
+    0x90, 0x04, 0x82, 0xF1, 0x03, 0x87, 0x88, 0x04, 0x00, 0xA3, 0x08, 0x83, 0x8B, 0x04, 0x80, 0xBE,
+    0x0C, 0x81, 0xA4, 0x04, 0x82, 0xF2, 0x02, 0x8A, 0xA3, 0x04, 0x80, 0xB7, 0x08, 0x01, 0xA3, 0x10,
+    0xC4, 0x10, 0x80, 0x51, 0x81, 0xAB, 0x08, 0x83, 0x97, 0x04, 0x83, 0xF4, 0x07, 0x9A, 0x01, 0x00,
+    0x20, 0x00, 0x82, 0x8E, 0x01, 0x8A, 0x83, 0x0C, 0x8A, 0x8A, 0x0C, 0x83, 0x01, 0x80, 0x47, 0x80,
+    0xEA, 0x03, 0x81, 0x89, 0x04, 0x81, 0xD1, 0x03, 0x89, 0xB1, 0x08, 0x81, 0x98, 0x04, 0x81, 0xCB,
+    0x0C, 0x80, 0xEA, 0x09, 0x80, 0x9B, 0x04, 0x83, 0x11, 0x80, 0x82, 0x01, 0x85, 0x69, 0x81, 0x94,
+    0x04, 0x06, 0xC9, 0x39, 0x2A, 0x42, 0x4B, 0x42, 0xE9, 0x31, 0x47, 0x21, 0xA4, 0x10, 0x62, 0x00,
+    0x84, 0x94, 0x04, 0x82, 0xFE, 0x03, 0x00, 0x42, 0x00, 0x81, 0x62, 0x81, 0x9E, 0x08, 0x82, 0xA1,
+    0x04, 0x80, 0x0A, 0x00, 0x22, 0x00, 0x81, 0x3D, 0x80, 0x88, 0x06, 0x84, 0x1B, 0x80, 0x14, 0x80,
+    0x48, 0x80, 0x87, 0x04, 0x01, 0x00, 0x10, 0x01, 0x10, 0x80, 0x02, 0x81, 0x91, 0x04, 0x80, 0x92,
+    0x04, 0x80, 0x01, 0x81, 0x92, 0x04, 0x86, 0x01, 0x85, 0x9F, 0x02, 0x80, 0xBA, 0x08, 0x04, 0x01,
+    0x18, 0x00, 0x08, 0x24, 0xAC, 0x63, 0xFE, 0x60, 0xFD, 0x82, 0xEB, 0x03, 0x01, 0x62, 0xFE, 0xC4,
+    0xBC, 0x89, 0xB7, 0x02, 0x83, 0x01, 0x00, 0xE4, 0x8B, 0x80, 0x98, 0x04, 0x80, 0x17, 0x02, 0x60,
+    0xFD, 0x82, 0xFE, 0xC5, 0xB4, 0x86, 0x18, 0x02, 0x00, 0x00, 0x81, 0x18, 0x63, 0x31, 0x80, 0x05,
+    0x01, 0xE4, 0x93, 0xA3, 0xFE, 0x80, 0x13, 0x80, 0x01, 0x01, 0x63, 0xFE, 0x44, 0xA4, 0x83, 0x98,
+    0x04, 0x82, 0xE3, 0x03, 0x02, 0x01, 0x00, 0xC5, 0xB4, 0x83, 0xFE, 0x81, 0xA3, 0x08, 0x80, 0xE0,
+    0x03, 0x00, 0x44, 0x9C, 0x81, 0xE7, 0x01, 0x80, 0x98, 0x04, 0x01, 0xC5, 0xE5, 0xE2, 0xFD, 0x80,
+    0x1D, 0x80, 0x36, 0x01, 0xE4, 0xFE, 0x23, 0x7B, 0x82, 0x1F, 0x80, 0x1B, 0x81, 0x8D, 0x03, 0x05,
+    0x02, 0x29, 0x02, 0x21, 0x00, 0x00, 0x22, 0x29, 0x66, 0xF6, 0xA1, 0xFD, 0x81, 0x61, 0x02, 0x80,
+    0xFD, 0x21, 0xFE, 0xC6, 0xDD, 0x80, 0xAA, 0x09, 0x80, 0x14, 0x81, 0x01, 0x80, 0x29, 0x00, 0x82,
+    0x10, 0x80, 0xC3, 0x04, 0x80, 0xBF, 0x0D, 0x00, 0x87, 0xFE, 0x83, 0xAE, 0x04, 0x02, 0xC4, 0xFE,
+    0x84, 0x83, 0x00, 0x00, 0x82, 0x14, 0x85, 0x98, 0x04, 0x80, 0x17, 0x03, 0x25, 0xC4, 0x62, 0xE2,
+    0x40, 0xB8, 0xA0, 0xC0, 0x84, 0xD2, 0x03, 0x02, 0x60, 0xC0, 0xA4, 0xF3, 0xA4, 0x7A, 0x81, 0xFF,
+    0x0B, 0x02, 0x22, 0x39, 0x45, 0xFC, 0xC0, 0xC8, 0x80, 0xE3, 0x03, 0x01, 0x81, 0xC0, 0x81, 0xC0,
+    0x81, 0x11, 0x80, 0x05, 0x87, 0x01, 0x03, 0x40, 0xC0, 0xA2, 0xD9, 0x05, 0xDC, 0x41, 0x10, 0x81,
+    0x5D, 0x03, 0xC3, 0x82, 0xE4, 0xFB, 0x20, 0xB8, 0x61, 0xC0, 0x86, 0x13, 0x02, 0x80, 0xC0, 0x25,
+    0xFC, 0xC2, 0x51, 0x85, 0x8F, 0x0B, 0x09, 0x22, 0x6A, 0x03, 0xFC, 0x81, 0xB8, 0x80, 0xB8, 0x80,
+    0xB8, 0x81, 0xB8, 0x80, 0xB0, 0x60, 0xB8, 0x60, 0xB8, 0x81, 0xB8, 0x83, 0x01, 0x03, 0x81, 0xC0,
+    0x20, 0xB8, 0x22, 0xDA, 0xC5, 0xC3, 0x82, 0x80, 0x07, 0x82, 0x8D, 0x01, 0x84, 0xF0, 0x03, 0x83,
+    0x8E, 0x08, 0x80, 0x02, 0x80, 0xEC, 0x06, 0x85, 0x98, 0x04, 0x01, 0x67, 0x21, 0x67, 0x29, 0x81,
+    0x97, 0x04, 0x02, 0x05, 0x19, 0x2A, 0x3A, 0x46, 0x21, 0x80, 0x40, 0x83, 0xC8, 0x0C, 0x84, 0xAF,
+    0x08, 0x81, 0xCE, 0x01, 0x89, 0x91, 0x04, 0x85, 0x9F, 0x04, 0x83, 0xAD, 0x0F, 0x01, 0xA3, 0x10,
+    0x84, 0x08, 0x80, 0x9A, 0x04, 0x00, 0x84, 0x10, 0x8B, 0x1A, 0x80, 0x17, 0x82, 0xE4, 0x0B, 0x80,
+    0xB3, 0x04, 0x00, 0x83, 0x10, 0x82, 0x98, 0x04, 0x80, 0x99, 0x04, 0x01, 0x63, 0x08, 0xA3, 0x10,
+    0x80, 0xE2, 0x04, 0x9C, 0x01, 0x8D, 0x92, 0x04, 0x82, 0x35, 0x81, 0xCF, 0x04, 0x82, 0x01, 0x81,
+    0x41, 0x83, 0xB6, 0x08, 0x80, 0x01, 0x01, 0x42, 0x00, 0x62, 0x00, 0x81, 0xEF, 0x03, 0x80, 0xA3,
+    0x08, 0x80, 0xD5, 0x03, 0x81, 0xBE, 0x0C, 0x86, 0xAF, 0x08, 0x82, 0xC8, 0x0C, 0x80, 0x98, 0x04,
+    0x00, 0xA3, 0x10, 0x86, 0x98, 0x04, 0x80, 0x12, 0x80, 0x7A, 0x81, 0xCA, 0x04, 0x08, 0x62, 0x08,
+    0x46, 0x21, 0x09, 0x3A, 0x8B, 0x4A, 0x6B, 0x42, 0xE9, 0x39, 0x67, 0x21, 0xE5, 0x10, 0x62, 0x00,
+    0x80, 0xBF, 0x02, 0x00, 0x62, 0x00, 0x82, 0xF8, 0x03, 0x81, 0x16, 0x82, 0x03, 0x81, 0x67, 0x00,
+    0x22, 0x00, 0x84, 0xA0, 0x08, 0x80, 0xDE, 0x08, 0x82, 0x4A, 0x80, 0x3D, 0x01, 0x42, 0x08, 0xA4,
+    0x10, 0x82, 0x0F, 0x80, 0xDF, 0x01, 0x80, 0x95, 0x04, 0x82, 0x01, 0x82, 0x06, 0x82, 0xA6, 0x08,
+    0x82, 0xA9, 0x08, 0x84, 0x05, 0x8C, 0xFF, 0x03, 0x02, 0x04, 0xC5, 0x01, 0xFE, 0x40, 0xFD, 0x80,
+    0x01, 0x03, 0x60, 0xFD, 0x40, 0xFD, 0x82, 0xFE, 0x04, 0xA4, 0x80, 0xA6, 0x04, 0x8B, 0x1B, 0x02,
+    0x00, 0x00, 0x64, 0x7B, 0xA4, 0xFE, 0x81, 0x82, 0x04, 0x03, 0x40, 0xFD, 0xC0, 0xFD, 0x85, 0xFE,
+    0xE4, 0x72, 0x80, 0xC9, 0x08, 0x80, 0x63, 0x05, 0x21, 0x08, 0xC2, 0x20, 0x43, 0x5A, 0x45, 0xA4,
+    0x86, 0xEE, 0x66, 0xAC, 0x80, 0x08, 0x01, 0xE4, 0xBC, 0x62, 0xFE, 0x82, 0x2E, 0x01, 0xA4, 0xFE,
+    0x43, 0x7B, 0x82, 0xE5, 0x02, 0x82, 0xD0, 0x03, 0x80, 0xBB, 0x0C, 0x01, 0xA5, 0xD5, 0x22, 0xFE,
+    0x82, 0xA3, 0x08, 0x01, 0xE4, 0xFE, 0x23, 0x73, 0x82, 0x98, 0x04, 0x02, 0x21, 0x00, 0x86, 0xCD,
+    0x22, 0xFE, 0x80, 0x1D, 0x80, 0x01, 0x03, 0x01, 0xFE, 0x25, 0xEE, 0x22, 0x5A, 0x41, 0x08, 0x81,
+    0x20, 0x09, 0x41, 0x10, 0x22, 0x31, 0xC4, 0x6A, 0xE5, 0xBC, 0x07, 0xFF, 0x84, 0x62, 0x00, 0x00,
+    0x82, 0x10, 0x06, 0xEE, 0xE1, 0xFD, 0x82, 0x98, 0x04, 0x03, 0xA0, 0xFD, 0xA5, 0xFE, 0xE5, 0x9B,
+    0xC1, 0x20, 0x81, 0x8F, 0x03, 0x04, 0x62, 0x10, 0x83, 0x39, 0x24, 0x7B, 0xC7, 0xD5, 0xC4, 0x6A,
+    0x80, 0xC0, 0x05, 0x02, 0x01, 0x00, 0x43, 0x52, 0xA6, 0xFE, 0x81, 0x8D, 0x09, 0x80, 0x03, 0x01,
+    0xA3, 0xFE, 0xC5, 0xB4, 0x81, 0xE2, 0x03, 0x02, 0x41, 0x08, 0xE2, 0x20, 0x42, 0x08, 0x84, 0x98,
+    0x04, 0x06, 0x02, 0x00, 0x81, 0x10, 0xE5, 0xE4, 0x81, 0xC9, 0x20, 0xB0, 0x60, 0xB0, 0x81, 0xB0,
+    0x80, 0x01, 0x80, 0xD0, 0x03, 0x02, 0x61, 0xC0, 0x80, 0xC0, 0x65, 0xFC, 0x80, 0xEA, 0x03, 0x81,
+    0x86, 0x01, 0x02, 0x05, 0xBC, 0xA2, 0xE2, 0x00, 0xB8, 0x84, 0xE1, 0x03, 0x80, 0x01, 0x03, 0x61,
+    0xB8, 0x61, 0xB8, 0x81, 0xB8, 0x61, 0xB0, 0x80, 0x02, 0x80, 0x01, 0x03, 0x61, 0xB8, 0x20, 0xB0,
+    0xC3, 0xE2, 0xA4, 0xBB, 0x82, 0x1B, 0x04, 0xC4, 0xAB, 0x23, 0xEB, 0x00, 0xB0, 0x60, 0xB0, 0x60,
+    0xB0, 0x81, 0x10, 0x81, 0x01, 0x03, 0x21, 0xB0, 0xC1, 0xC0, 0xC5, 0xF4, 0x01, 0x29, 0x83, 0x98,
+    0x04, 0x80, 0x8E, 0x02, 0x08, 0x05, 0xB4, 0x28, 0xFE, 0x87, 0xFD, 0x67, 0xFD, 0x66, 0xFD, 0x67,
+    0xF5, 0x84, 0xDB, 0x20, 0xA8, 0x40, 0xB0, 0x85, 0x1B, 0x02, 0x20, 0xB0, 0x43, 0xEB, 0x64, 0x9B,
+    0x82, 0x8B, 0x03, 0x86, 0x98, 0x04, 0x85, 0xAE, 0x08, 0x87, 0xAF, 0x08, 0x08, 0x00, 0x00, 0xA4,
+    0x10, 0xA8, 0x29, 0x06, 0x19, 0xE5, 0x18, 0x05, 0x19, 0xE5, 0x18, 0x67, 0x21, 0x2A, 0x42, 0x80,
+    0xFB, 0x06, 0x83, 0xA4, 0x03, 0x86, 0x98, 0x04, 0x81, 0xB9, 0x04, 0x8B, 0xB1, 0x0C, 0x00, 0xC4,
+    0x10, 0x80, 0xA5, 0x08, 0x8C, 0xA8, 0x04, 0x8A, 0x99, 0x04, 0x81, 0x83, 0x07, 0x80, 0x01, 0x01,
+    0xA3, 0x10, 0xA3, 0x10, 0x81, 0xF9, 0x0B, 0x80, 0x03, 0x00, 0x83, 0x10, 0x9F, 0x97, 0x04, 0x81,
+    0xF1, 0x03, 0x8A, 0x96, 0x04, 0x80, 0x01, 0x82, 0xE4, 0x03, 0x80, 0x01, 0x84, 0x9B, 0x04, 0x81,
+    0x97, 0x08, 0x84, 0x40, 0x83, 0xA0, 0x04, 0x80, 0xE3, 0x07, 0x81, 0xBA, 0x0C, 0x80, 0xD2, 0x03,
+    0x80, 0x1A, 0x84, 0xB0, 0x08, 0x80, 0x98, 0x04, 0x02, 0x63, 0x08, 0x42, 0x00, 0x06, 0x19, 0x80,
+    0x98, 0x04, 0x80, 0x0B, 0x80, 0xC1, 0x02, 0x85, 0xAA, 0x04, 0x05, 0x83, 0x08, 0x26, 0x21, 0x4B,
+    0x42, 0xED, 0x52, 0x8B, 0x4A, 0xA8, 0x31, 0x80, 0xC4, 0x08, 0x80, 0x0E, 0x80, 0x9D, 0x08, 0x02,
+    0x26, 0x21, 0x66, 0x29, 0xC3, 0x10, 0x83, 0xAE, 0x08, 0x82, 0xA6, 0x05, 0x00, 0x63, 0x08, 0x80,
+    0xE2, 0x0C, 0x80, 0x01, 0x80, 0xD7, 0x01, 0x00, 0x42, 0x08, 0x82, 0x98, 0x04, 0x80, 0xA9, 0x08,
+    0x80, 0x0B, 0x81, 0xF8, 0x08, 0x01, 0x21, 0x00, 0xC4, 0x10, 0x81, 0xA9, 0x08, 0x88, 0x93, 0x09,
+    0x85, 0x9B, 0x04, 0x81, 0x06, 0x80, 0x01, 0x83, 0xA0, 0x02, 0x8C, 0x01, 0x03, 0x81, 0x10, 0xE5,
+    0xED, 0xA1, 0xFD, 0x20, 0xFD, 0x82, 0x01, 0x02, 0x83, 0xFE, 0x03, 0x7B, 0x00, 0x00, 0x84, 0xD2,
+    0x08, 0x85, 0xB8, 0x02, 0x80, 0x40, 0x01, 0xE3, 0x41, 0xA6, 0xFE, 0x82, 0x98, 0x04, 0x0C, 0x40,
+    0xFD, 0xC1, 0xFD, 0x85, 0xFE, 0xA5, 0xE5, 0xC4, 0xBC, 0xA4, 0xB4, 0xE4, 0xBC, 0xA4, 0xD5, 0x44,
+    0xF6, 0xA4, 0xFE, 0x82, 0xFE, 0x24, 0xFF, 0x03, 0x73, 0x80, 0xEA, 0x0A, 0x00, 0xA4, 0xDD, 0x83,
+    0xC6, 0x04, 0x01, 0xC5, 0xFE, 0x22, 0x52, 0x85, 0x98, 0x04, 0x80, 0x01, 0x02, 0xC2, 0x18, 0x26,
+    0xEE, 0xC1, 0xFD, 0x82, 0xF5, 0x03, 0x01, 0xC5, 0xFE, 0xE2, 0x49, 0x81, 0x33, 0x80, 0xEE, 0x03,
+    0x01, 0x65, 0xA4, 0xC4, 0xFE, 0x81, 0x1F, 0x80, 0x01, 0x0B, 0x01, 0xFE, 0xA4, 0xFE, 0xC5, 0xDD,
+    0x25, 0xC5, 0x05, 0xBD, 0x65, 0xCD, 0xE5, 0xE5, 0xA5, 0xFE, 0xE4, 0xFE, 0xA2, 0xFE, 0xC5, 0xFE,
+    0x22, 0x31, 0x80, 0x18, 0x01, 0xE6, 0xB4, 0x62, 0xFE, 0x82, 0xE4, 0x08, 0x0B, 0x60, 0xFD, 0xA0,
+    0xFD, 0x84, 0xFE, 0x25, 0xEE, 0x86, 0xCD, 0x45, 0xC5, 0x85, 0xD5, 0xE5, 0xE5, 0x85, 0xFE, 0xC3,
+    0xFE, 0x26, 0xFF, 0x03, 0x4A, 0x81, 0xB0, 0x08, 0x01, 0xC3, 0x62, 0x84, 0xFE, 0x82, 0xAD, 0x04,
+    0x08, 0x80, 0xFD, 0xC0, 0xFD, 0xC5, 0xFE, 0x07, 0xDE, 0x47, 0xC5, 0x66, 0xCD, 0x26, 0xDE, 0xC8,
+    0xD5, 0x41, 0x08, 0x84, 0xB2, 0x08, 0x07, 0x01, 0x00, 0x62, 0x39, 0x05, 0xFD, 0xC1, 0xB0, 0x20,
+    0xA8, 0x60, 0xA8, 0x60, 0xA8, 0x61, 0xA8, 0x80, 0x01, 0x80, 0xCF, 0x03, 0x02, 0x01, 0xB9, 0xE6,
+    0xF4, 0x02, 0x31, 0x82, 0xFD, 0x03, 0x02, 0x23, 0x5A, 0xA5, 0xFC, 0x40, 0xB0, 0x80, 0xDC, 0x03,
+    0x81, 0x11, 0x82, 0x01, 0x83, 0x1A, 0x80, 0x01, 0x03, 0x41, 0xA8, 0x20, 0xA0, 0xE4, 0xF3, 0x03,
+    0x93, 0x81, 0x1B, 0x07, 0x21, 0x00, 0x85, 0xD4, 0x42, 0xD2, 0x00, 0xA0, 0x60, 0xA0, 0x60, 0xA0,
+    0x61, 0xA0, 0x61, 0xA0, 0x82, 0x13, 0x03, 0x00, 0xA0, 0x82, 0xC1, 0xC6, 0xDC, 0x60, 0x08, 0x82,
+    0x13, 0x81, 0x31, 0x08, 0x42, 0x31, 0xE3, 0x51, 0xE3, 0x59, 0x02, 0x52, 0xE2, 0x49, 0xC4, 0xA3,
+    0x04, 0xEC, 0x00, 0x98, 0x40, 0xA0, 0x80, 0x1C, 0x82, 0x1E, 0x03, 0x41, 0xA8, 0x40, 0xA8, 0x64,
+    0xFC, 0xA3, 0x72, 0x86, 0xF7, 0x01, 0x85, 0x89, 0x08, 0x82, 0xA5, 0x08, 0x80, 0x92, 0x0B, 0x86,
+    0x98, 0x03, 0x03, 0x87, 0x29, 0x47, 0x21, 0xE5, 0x10, 0xE5, 0x18, 0x80, 0x01, 0x00, 0x0A, 0x3A,
+    0x81, 0xAF, 0x08, 0x85, 0xA8, 0x03, 0x80, 0xC1, 0x02, 0x86, 0x98, 0x04, 0x80, 0xB1, 0x0C, 0x00,
+    0xA4, 0x08, 0x84, 0xF9, 0x03, 0x00, 0x84, 0x10, 0x89, 0x98, 0x04, 0x80, 0x9E, 0x0F, 0x90, 0x98,
+    0x04, 0x83, 0x8D, 0x03, 0x01, 0xA3, 0x10, 0xA4, 0x10, 0x81, 0xBE, 0x03, 0x00, 0x42, 0x08, 0x81,
+    0x9E, 0x04, 0x9F, 0x97, 0x04, 0x8B, 0xB3, 0x08, 0x82, 0x98, 0x04, 0x82, 0xAD, 0x0C, 0x81, 0xA6,
+    0x0C, 0x81, 0x04, 0x00, 0x83, 0x10, 0x80, 0x96, 0x04, 0x82, 0x40, 0x00, 0x20, 0x00, 0x88, 0x25,
+    0x81, 0x9A, 0x04, 0x80, 0x8D, 0x04, 0x85, 0xB2, 0x08, 0x82, 0x98, 0x04, 0x81, 0xB0, 0x08, 0x81,
+    0x98, 0x04, 0x82, 0xC2, 0x04, 0x83, 0xAB, 0x04, 0x02, 0xA4, 0x10, 0x26, 0x19, 0xC4, 0x10, 0x80,
+    0xBD, 0x0C, 0x80, 0xFF, 0x03, 0x06, 0x83, 0x08, 0x22, 0x00, 0x46, 0x21, 0x36, 0x9D, 0xF5, 0x9C,
+    0x8B, 0x52, 0x66, 0x29, 0x80, 0xED, 0x05, 0x85, 0x98, 0x04, 0x80, 0x01, 0x80, 0x43, 0x01, 0xE5,
+    0x18, 0x4B, 0x3A, 0x80, 0xD4, 0x04, 0x83, 0x98, 0x04, 0x00, 0x83, 0x08, 0x82, 0x4F, 0x00, 0x20,
+    0x00, 0x80, 0x3E, 0x85, 0x8B, 0x09, 0x86, 0x07, 0x86, 0xAC, 0x06, 0x90, 0x95, 0x04, 0x81, 0x14,
+    0x02, 0x22, 0x29, 0x65, 0xFE, 0x60, 0xFD, 0x81, 0x96, 0x04, 0x03, 0x00, 0xFD, 0x40, 0xFD, 0xA4,
+    0xFE, 0x02, 0x52, 0x81, 0xB6, 0x0B, 0x81, 0x97, 0x04, 0x01, 0x21, 0x08, 0x21, 0x08, 0x81, 0x03,
+    0x80, 0xF2, 0x0B, 0x81, 0xBB, 0x02, 0x01, 0x41, 0x08, 0xA8, 0xD5, 0x80, 0xFD, 0x07, 0x82, 0x01,
+    0x06, 0x60, 0xFD, 0xC1, 0xFD, 0x21, 0xFE, 0x41, 0xFE, 0x21, 0xFE, 0x00, 0xFE, 0xA0, 0xFD, 0x80,
+    0xD9, 0x03, 0x04, 0x84, 0xFE, 0xA2, 0x41, 0x00, 0x00, 0xE1, 0x20, 0x44, 0xF6, 0x80, 0xC6, 0x04,
+    0x04, 0x40, 0xFD, 0x20, 0xFD, 0xA0, 0xFD, 0x65, 0xFE, 0x21, 0x29, 0x82, 0x3C, 0x83, 0x98, 0x04,
+    0x01, 0xA2, 0x39, 0x85, 0xFE, 0x80, 0xED, 0x0C, 0x81, 0xDF, 0x03, 0x01, 0x85, 0xFE, 0x41, 0x29,
+    0x83, 0x98, 0x04, 0x02, 0xC3, 0x41, 0xE7, 0xFE, 0x80, 0xFD, 0x80, 0x20, 0x81, 0x01, 0x05, 0x80,
+    0xFD, 0x01, 0xFE, 0x41, 0xFE, 0x61, 0xFE, 0x41, 0xFE, 0x01, 0xFE, 0x80, 0x34, 0x01, 0xE0, 0xFD,
+    0xC5, 0xE5, 0x80, 0xF2, 0x03, 0x02, 0x01, 0x00, 0x44, 0x52, 0xE6, 0xFE, 0x83, 0x98, 0x04, 0x80,
+    0x01, 0x80, 0x49, 0x80, 0x01, 0x80, 0x15, 0x02, 0xC0, 0xFD, 0x46, 0xF6, 0x02, 0x21, 0x81, 0x98,
+    0x04, 0x01, 0x83, 0x5A, 0x84, 0xFE, 0x82, 0xBF, 0x0D, 0x80, 0x3C, 0x05, 0xA0, 0xFD, 0x42, 0xFE,
+    0x82, 0xFE, 0x62, 0xFE, 0xC3, 0xFE, 0x25, 0xC5, 0x80, 0x11, 0x83, 0xB0, 0x08, 0x0D, 0x01, 0x00,
+    0x63, 0x6A, 0x85, 0xFC, 0x20, 0xA0, 0x40, 0xA0, 0x40, 0x98, 0x40, 0x98, 0x60, 0x98, 0x61, 0x98,
+    0x60, 0x98, 0x60, 0xA0, 0x00, 0xA0, 0xC2, 0xC1, 0xC6, 0xE4, 0x80, 0xA8, 0x09, 0x81, 0x01, 0x02,
+    0x41, 0x08, 0xE6, 0xE4, 0xE2, 0xC9, 0x81, 0xFE, 0x03, 0x87, 0x01, 0x81, 0x1B, 0x00, 0x61, 0x98,
+    0x80, 0x20, 0x01, 0xA4, 0xFC, 0x22, 0x6A, 0x81, 0xDD, 0x01, 0x04, 0xA1, 0x18, 0xC6, 0xEC, 0x61,
+    0xB1, 0x00, 0x98, 0x60, 0x98, 0x80, 0x01, 0x80, 0x11, 0x81, 0x12, 0x02, 0x00, 0x90, 0x83, 0xD2,
+    0x26, 0xBC, 0x82, 0xF0, 0x01, 0x83, 0xD2, 0x01, 0x82, 0x01, 0x02, 0x64, 0x9B, 0x23, 0xE3, 0x00,
+    0x90, 0x80, 0x47, 0x80, 0x28, 0x81, 0x1D, 0x03, 0x20, 0x98, 0xA0, 0xA0, 0x05, 0xFD, 0xA2, 0x49,
+    0x83, 0x18, 0x85, 0xEE, 0x03, 0x84, 0x97, 0x04, 0x80, 0xF5, 0x03, 0x81, 0xBA, 0x06, 0x83, 0xAF,
+    0x08, 0x02, 0x05, 0x19, 0x87, 0x29, 0x05, 0x19, 0x80, 0x98, 0x04, 0x02, 0xE5, 0x10, 0x67, 0x21,
+    0xE9, 0x39, 0x81, 0xCF, 0x0F, 0x82, 0x01, 0x80, 0x96, 0x03, 0x80, 0xF3, 0x0A, 0x85, 0x2A, 0x81,
+    0x80, 0x04, 0x80, 0x03, 0x81, 0x92, 0x04, 0x86, 0x01, 0x00, 0x84, 0x08, 0x80, 0xC1, 0x0C, 0x80,
+    0x12, 0x02, 0x84, 0x08, 0x83, 0x08, 0xA3, 0x08, 0x85, 0xAC, 0x04, 0x85, 0x01, 0x00, 0xA3, 0x10,
+    0x80, 0x02, 0x80, 0x03, 0x83, 0x9B, 0x04, 0x01, 0x83, 0x08, 0xC4, 0x10, 0x80, 0x3A, 0x82, 0xB5,
+    0x08, 0x8E, 0x82, 0x04, 0x85, 0x87, 0x03, 0x93, 0xB4, 0x08, 0x81, 0x95, 0x04, 0x81, 0xA7, 0x08,
+    0x81, 0xAE, 0x08, 0x82, 0xF6, 0x03, 0x80, 0x4A, 0x01, 0xC4, 0x18, 0xA3, 0x10, 0x81, 0xFF, 0x0B,
+    0x80, 0x1A, 0x80, 0xB5, 0x09, 0x81, 0xD9, 0x07, 0x88, 0x25, 0x82, 0x9A, 0x04, 0x83, 0xCD, 0x0C,
+    0x81, 0x98, 0x04, 0x80, 0x03, 0x01, 0x05, 0x19, 0xA4, 0x10, 0x80, 0x98, 0x04, 0x00, 0x63, 0x08,
+    0x80, 0x19, 0x80, 0xB1, 0x08, 0x00, 0x01, 0x00, 0x80, 0x07, 0x81, 0xB2, 0x08, 0x81, 0xCD, 0x04,
+    0x81, 0x8A, 0x04, 0x80, 0x18, 0x03, 0x83, 0x10, 0x2F, 0x5B, 0x90, 0x6B, 0x82, 0x10, 0x80, 0x6C,
+    0x81, 0x82, 0x01, 0x84, 0xAF, 0x08, 0x80, 0x02, 0x03, 0x47, 0x21, 0xEA, 0x39, 0x8C, 0x4A, 0x06,
+    0x19, 0x80, 0x22, 0x82, 0xCD, 0x09, 0x80, 0xB3, 0x01, 0x81, 0xEE, 0x01, 0x84, 0xEA, 0x04, 0x8E,
+    0x99, 0x01, 0x95, 0x96, 0x04, 0x81, 0x16, 0x01, 0x23, 0x52, 0xA5, 0xFE, 0x80, 0x95, 0x04, 0x81,
+    0x98, 0x04, 0x01, 0x60, 0xFD, 0x44, 0xFE, 0x83, 0xEB, 0x03, 0x83, 0x93, 0x02, 0x81, 0x98, 0x04,
+    0x82, 0x01, 0x02, 0x00, 0x00, 0x44, 0x52, 0xE8, 0xFE, 0x81, 0x85, 0x04, 0x88, 0x01, 0x06, 0xA0,
+    0xFD, 0x04, 0xF6, 0xA1, 0x18, 0x00, 0x00, 0xC2, 0x41, 0xA4, 0xFE, 0x61, 0xFD, 0x81, 0x98, 0x04,
+    0x01, 0xE1, 0xFD, 0xC5, 0xE5, 0x83, 0xB3, 0x03, 0x82, 0x97, 0x04, 0x80, 0xE0, 0x03, 0x82, 0xEE,
+    0x0C, 0x02, 0x60, 0xFD, 0xE1, 0xFD, 0xE5, 0xE5, 0x82, 0x12, 0x80, 0xAD, 0x01, 0x02, 0x00, 0x00,
+    0x46, 0x9C, 0xE5, 0xFE, 0x80, 0x1F, 0x83, 0x35, 0x82, 0x16, 0x80, 0x0B, 0x01, 0x42, 0xFE, 0xC5,
+    0xBC, 0x80, 0xF2, 0x03, 0x80, 0x24, 0x01, 0xC8, 0xB4, 0xC5, 0xFE, 0x81, 0xF8, 0x08, 0x81, 0x12,
+    0x82, 0x04, 0x80, 0x8A, 0x04, 0x01, 0x01, 0xFE, 0xC6, 0xDD, 0x80, 0xE5, 0x0C, 0x80, 0x98, 0x04,
+    0x01, 0x42, 0x29, 0x86, 0xFE, 0x80, 0xB6, 0x04, 0x80, 0x0C, 0x81, 0x9C, 0x04, 0x81, 0x03, 0x01,
+    0x83, 0xFE, 0xE4, 0x93, 0x80, 0x98, 0x0A, 0x84, 0xB0, 0x08, 0x03, 0x44, 0x93, 0xA3, 0xEB, 0x00,
+    0x90, 0x40, 0x90, 0x80, 0x01, 0x00, 0x60, 0x90, 0x80, 0x01, 0x03, 0x40, 0x90, 0x00, 0x90, 0xA3,
+    0xD2, 0x25, 0xC4, 0x84, 0xE7, 0x03, 0x02, 0x45, 0x93, 0x24, 0xF4, 0x00, 0x98, 0x81, 0xE1, 0x03,
+    0x81, 0x13, 0x82, 0x16, 0x81, 0x04, 0x05, 0x61, 0x90, 0x60, 0x90, 0x20, 0x88, 0xC0, 0x98, 0xE4,
+    0xF4, 0x22, 0x39, 0x81, 0x85, 0x04, 0x07, 0x62, 0x39, 0xC6, 0xF4, 0xA1, 0x98, 0x20, 0x90, 0x40,
+    0x90, 0x40, 0x88, 0x40, 0x88, 0x60, 0x88, 0x80, 0x01, 0x80, 0x15, 0x01, 0x00, 0x88, 0xC3, 0xD2,
+    0x80, 0x98, 0x04, 0x84, 0xD0, 0x01, 0x84, 0x01, 0x02, 0x85, 0xD4, 0x42, 0xBA, 0x00, 0x80, 0x80,
+    0x1A, 0x83, 0x01, 0x03, 0x00, 0x88, 0x41, 0xA1, 0x05, 0xED, 0xA1, 0x20, 0x82, 0xCA, 0x08, 0x83,
+    0x8F, 0x04, 0x86, 0xA6, 0x07, 0x81, 0xC6, 0x0C, 0x80, 0x96, 0x08, 0x83, 0x09, 0x03, 0x82, 0x08,
+    0x87, 0x29, 0x06, 0x19, 0xE5, 0x10, 0x80, 0x01, 0x02, 0x05, 0x19, 0xE9, 0x39, 0xC4, 0x10, 0x85,
+    0xAF, 0x08, 0x80, 0x98, 0x04, 0x85, 0xB0, 0x08, 0x80, 0x10, 0x00, 0xA3, 0x08, 0x80, 0xF0, 0x03,
+    0x83, 0xED, 0x06, 0x81, 0x01, 0x80, 0x92, 0x04, 0x82, 0xB1, 0x08, 0x80, 0x01, 0x81, 0x0B, 0x80,
+    0xE4, 0x02, 0x8E, 0x01, 0x80, 0xB9, 0x0C, 0x85, 0x09, 0x80, 0x98, 0x04, 0x02, 0x42, 0x00, 0xC4,
+    0x10, 0x83, 0x10, 0xA3, 0xAE, 0x08, 0x87, 0x8E, 0x08, 0x80, 0xA2, 0x0C, 0x83, 0xAC, 0x08, 0x82,
+    0xFA, 0x07, 0x80, 0x88, 0x09, 0x00, 0x82, 0x08, 0x81, 0xAB, 0x08, 0x80, 0xDA, 0x03, 0x82, 0xEB,
+    0x03, 0x83, 0x8A, 0x08, 0x84, 0xCF, 0x0C, 0x82, 0x90, 0x01, 0x00, 0x41, 0x00, 0x87, 0x9A, 0x04,
+    0x81, 0x06, 0x00, 0x05, 0x19, 0x81, 0xAB, 0x01, 0x81, 0xB0, 0x08, 0x80, 0x97, 0x04, 0x02, 0x66,
+    0x29, 0x4A, 0x42, 0x66, 0x29, 0x80, 0xF5, 0x09, 0x82, 0xCB, 0x0C, 0x81, 0x8A, 0x04, 0x80, 0xC8,
+    0x0C, 0x01, 0xED, 0x52, 0xAD, 0x4A, 0x80, 0xB3, 0x01, 0x80, 0xD9, 0x06, 0x80, 0x01, 0x85, 0xC7,
+    0x0C, 0x03, 0x63, 0x08, 0x62, 0x00, 0x83, 0x08, 0xE5, 0x18, 0x80, 0x15, 0x84, 0x98, 0x01, 0x81,
+    0xEC, 0x01, 0x83, 0x4A, 0x00, 0x62, 0x08, 0x8D, 0xA2, 0x05, 0x82, 0x94, 0x04, 0x83, 0x07, 0x91,
+    0x9C, 0x04, 0x02, 0x00, 0x00, 0x64, 0x83, 0xC3, 0xFE, 0x82, 0xC6, 0x03, 0x01, 0x20, 0xFD, 0xC1,
+    0xFD, 0x80, 0xD9, 0x07, 0x86, 0x98, 0x04, 0x84, 0xEE, 0x0A, 0x81, 0xB8, 0x08, 0x03, 0x00, 0x00,
+    0x06, 0x73, 0xA8, 0xFE, 0x63, 0xFE, 0x80, 0xBD, 0x03, 0x84, 0x95, 0x04, 0x04, 0x60, 0xFD, 0xC0,
+    0xFD, 0x42, 0xFE, 0x04, 0xFF, 0xE5, 0xC4, 0x80, 0x44, 0x03, 0xC3, 0x6A, 0xC4, 0xFE, 0x61, 0xFD,
+    0x61, 0xFD, 0x80, 0x12, 0x01, 0x22, 0xFE, 0x05, 0xC5, 0x84, 0x49, 0x82, 0x98, 0x04, 0x01, 0x43,
+    0x7B, 0x83, 0xFE, 0x82, 0xF1, 0x03, 0x01, 0x01, 0xFE, 0x24, 0xCD, 0x82, 0x12, 0x81, 0xB1, 0x08,
+    0x03, 0x41, 0x08, 0xC6, 0xAC, 0x04, 0xFF, 0x01, 0xFE, 0x80, 0x81, 0x09, 0x84, 0x99, 0x04, 0x04,
+    0x80, 0xFD, 0xE1, 0xFD, 0x63, 0xFE, 0x06, 0xFF, 0xE4, 0x72, 0x82, 0x15, 0x03, 0x61, 0x10, 0xC7,
+    0xB4, 0xC5, 0xFE, 0x21, 0xFE, 0x80, 0x80, 0x04, 0x83, 0x48, 0x04, 0x80, 0xFD, 0xC1, 0xFD, 0x22,
+    0xFE, 0x45, 0xFF, 0xC5, 0xB4, 0x80, 0x39, 0x80, 0x83, 0x04, 0x03, 0x00, 0x00, 0x66, 0xA4, 0x06,
+    0xFF, 0xC0, 0xFD, 0x84, 0xC6, 0x08, 0x80, 0x85, 0x0D, 0x01, 0x25, 0xFF, 0x24, 0x7B, 0x84, 0xB0,
+    0x08, 0x80, 0x4E, 0x03, 0x45, 0xC4, 0xC2, 0xCA, 0x00, 0x80, 0x40, 0x80, 0x82, 0x01, 0x04, 0x61,
+    0x80, 0x40, 0x80, 0x00, 0x80, 0xA4, 0xE3, 0x64, 0x9B, 0x84, 0x98, 0x04, 0x03, 0x22, 0x31, 0x66,
+    0xFD, 0x21, 0xA9, 0x20, 0x88, 0x81, 0xFC, 0x03, 0x82, 0x80, 0x04, 0x00, 0x60, 0x80, 0x80, 0x19,
+    0x01, 0x40, 0x88, 0x40, 0x80, 0x80, 0x05, 0x03, 0x00, 0x78, 0xA1, 0xA9, 0xC5, 0xE4, 0x61, 0x10,
+    0x81, 0xD2, 0x01, 0x03, 0x63, 0x6A, 0x46, 0xEC, 0x20, 0x80, 0x20, 0x80, 0x82, 0x2C, 0x00, 0x60,
+    0x80, 0x80, 0x01, 0x80, 0x13, 0x02, 0x82, 0xA9, 0x67, 0xF5, 0xE1, 0x28, 0x89, 0xF2, 0x01, 0x04,
+    0x60, 0x18, 0xC6, 0xEC, 0x21, 0x91, 0x00, 0x70, 0x40, 0x78, 0x80, 0x1A, 0x81, 0x03, 0x03, 0x40,
+    0x80, 0x00, 0x70, 0x22, 0xB2, 0xC5, 0xDC, 0x80, 0xAB, 0x06, 0x88, 0xB6, 0x0B, 0x86, 0xC6, 0x0C,
+    0x81, 0xB3, 0x0F, 0x83, 0x01, 0x01, 0x46, 0x21, 0x26, 0x19, 0x81, 0x97, 0x04, 0x02, 0xC4, 0x10,
+    0xA8, 0x29, 0x66, 0x29, 0x81, 0xB7, 0x02, 0x87, 0xCE, 0x08, 0x80, 0x0A, 0x83, 0xC7, 0x02, 0x83,
+    0x87, 0x04, 0x84, 0xF1, 0x06, 0x81, 0x01, 0x86, 0xB6, 0x08, 0x80, 0xDC, 0x0C, 0x00, 0xA4, 0x10,
+    0x81, 0x9B, 0x04, 0x80, 0x06, 0x8F, 0x9F, 0x04, 0x81, 0x98, 0x04, 0x80, 0xC6, 0x0B, 0x00, 0x83,
+    0x08, 0xA7, 0x96, 0x04, 0x85, 0x9A, 0x04, 0x80, 0xF6, 0x03, 0x82, 0x85, 0x04, 0x00, 0x82, 0x08,
+    0x80, 0x95, 0x04, 0x01, 0x62, 0x08, 0x41, 0x00, 0x81, 0x11, 0x81, 0x81, 0x04, 0x80, 0xF1, 0x08,
+    0x81, 0x80, 0x09, 0x82, 0x84, 0x04, 0x81, 0xA1, 0x04, 0x84, 0xE4, 0x04, 0x80, 0x26, 0x81, 0xC4,
+    0x05, 0x81, 0x19, 0x80, 0x89, 0x01, 0x80, 0xB1, 0x04, 0x85, 0x98, 0x04, 0x80, 0x67, 0x80, 0x97,
+    0x04, 0x01, 0xC8, 0x31, 0x09, 0x3A, 0x80, 0x20, 0x81, 0xC5, 0x01, 0x81, 0x9A, 0x08, 0x83, 0xA0,
+    0x08, 0x01, 0xD1, 0x6B, 0x4B, 0x42, 0x82, 0xDA, 0x05, 0x80, 0x11, 0x00, 0xA3, 0x10, 0x84, 0xC7,
+    0x0C, 0x81, 0x9F, 0x04, 0x80, 0x57, 0x82, 0xC0, 0x01, 0x85, 0xF9, 0x08, 0x81, 0x01, 0x80, 0x0D,
+    0x91, 0x82, 0x01, 0x82, 0x93, 0x04, 0x85, 0x0A, 0x8C, 0x98, 0x04, 0x08, 0x05, 0x9C, 0xA5, 0xFE,
+    0x24, 0xFE, 0x23, 0xFE, 0x24, 0xFE, 0x24, 0xFE, 0x04, 0xFE, 0x65, 0xFE, 0xA5, 0xB4, 0x8F, 0xB4,
+    0x04, 0x80, 0xD4, 0x0C, 0x0E, 0x00, 0x00, 0x83, 0x41, 0xA5, 0xB4, 0x25, 0xEE, 0x85, 0xFE, 0x83,
+    0xFE, 0x63, 0xFE, 0x62, 0xFE, 0x63, 0xFE, 0x83, 0xFE, 0x84, 0xFE, 0xA5, 0xFE, 0x26, 0xEE, 0xE5,
+    0xBC, 0xE3, 0x72, 0x80, 0xAF, 0x08, 0x08, 0x00, 0x00, 0x84, 0x8B, 0xC6, 0xFE, 0x45, 0xF6, 0x45,
+    0xFE, 0x44, 0xFE, 0x04, 0xFE, 0x85, 0xFE, 0xA4, 0x8B, 0x80, 0x2D, 0x80, 0xEE, 0x0C, 0x81, 0xDE,
+    0x03, 0x81, 0x98, 0x04, 0x01, 0x64, 0xAC, 0x42, 0xFE, 0x81, 0x83, 0x04, 0x02, 0x40, 0xFD, 0x42,
+    0xFE, 0x63, 0xAC, 0x82, 0x3F, 0x82, 0xF2, 0x07, 0x04, 0x01, 0x00, 0xA3, 0x62, 0x45, 0xCD, 0x24,
+    0xFE, 0x63, 0xFE, 0x82, 0x01, 0x05, 0xA3, 0xFE, 0xC4, 0xFE, 0x85, 0xFE, 0xC5, 0xDD, 0x44, 0xA4,
+    0xE3, 0x49, 0x80, 0xE4, 0x02, 0x80, 0x25, 0x80, 0x15, 0x04, 0x00, 0x00, 0xA4, 0x62, 0x25, 0xC5,
+    0x45, 0xF6, 0x84, 0xFE, 0x80, 0x01, 0x00, 0x83, 0xFE, 0x81, 0x48, 0x03, 0x86, 0xF6, 0xA6, 0xD5,
+    0xC4, 0x8B, 0x02, 0x29, 0x82, 0x29, 0x04, 0x02, 0x00, 0x61, 0x08, 0x26, 0x9C, 0x86, 0xF6, 0xC4,
+    0xFE, 0x80, 0x5C, 0x80, 0x01, 0x04, 0x83, 0xFE, 0xA5, 0xFE, 0x86, 0xFE, 0x66, 0xCD, 0x42, 0x31,
+    0x84, 0x98, 0x04, 0x80, 0xC1, 0x04, 0x01, 0x06, 0xE5, 0xE1, 0xA9, 0x80, 0xD0, 0x03, 0x80, 0x01,
+    0x00, 0x60, 0x78, 0x80, 0x01, 0x03, 0x40, 0x78, 0x20, 0x78, 0x85, 0xEC, 0x43, 0x6A, 0x85, 0x82,
+    0x08, 0x02, 0x25, 0xBC, 0x03, 0xD3, 0x00, 0x78, 0x81, 0x91, 0x04, 0x83, 0x16, 0x80, 0x17, 0x82,
+    0x01, 0x01, 0x00, 0x68, 0x82, 0xBA, 0x80, 0xCB, 0x08, 0x81, 0x98, 0x04, 0x04, 0x25, 0x8B, 0xE5,
+    0xDB, 0x00, 0x68, 0x40, 0x78, 0x40, 0x70, 0x80, 0x01, 0x00, 0x60, 0x70, 0x80, 0x02, 0x80, 0x03,
+    0x12, 0x40, 0x70, 0x20, 0x70, 0xA4, 0xCB, 0x66, 0xE5, 0xC3, 0x7A, 0xC2, 0x49, 0x42, 0x39, 0x02,
+    0x29, 0xE2, 0x28, 0xE1, 0x20, 0xC1, 0x20, 0xC1, 0x20, 0xE2, 0x20, 0x02, 0x29, 0x42, 0x41, 0x64,
+    0x9B, 0x65, 0xEC, 0x40, 0x70, 0x20, 0x68, 0x81, 0x1B, 0x82, 0x01, 0x02, 0x00, 0x68, 0x43, 0xCB,
+    0x05, 0xB4, 0x86, 0xAF, 0x08, 0x87, 0x97, 0x04, 0x00, 0x42, 0x00, 0x80, 0x86, 0x03, 0x85, 0xAF,
+    0x08, 0x03, 0x05, 0x19, 0x26, 0x21, 0xE5, 0x10, 0xE4, 0x10, 0x80, 0x97, 0x04, 0x01, 0x26, 0x21,
+    0xC8, 0x31, 0x82, 0x95, 0x03, 0x83, 0x9C, 0x02, 0x85, 0xDE, 0x0C, 0x83, 0x99, 0x04, 0x80, 0xAE,
+    0x03, 0x83, 0xA3, 0x0C, 0x84, 0x01, 0x83, 0xA6, 0x04, 0x85, 0x01, 0x80, 0x99, 0x04, 0x00, 0xA4,
+    0x10, 0x88, 0x19, 0x82, 0x01, 0x81, 0xC6, 0x0C, 0x81, 0xDB, 0x08, 0x80, 0xB4, 0x04, 0xAB, 0x96,
+    0x04, 0x85, 0x9A, 0x04, 0x81, 0x96, 0x04, 0x00, 0x82, 0x08, 0x83, 0x9C, 0x08, 0x80, 0xC1, 0x0D,
+    0x81, 0xF0, 0x04, 0x80, 0x01, 0x82, 0xF5, 0x04, 0x80, 0x4A, 0x80, 0xB9, 0x05, 0x80, 0xA2, 0x01,
+    0x81, 0x03, 0x87, 0x9A, 0x04, 0x80, 0x0B, 0x80, 0x1E, 0x82, 0xC0, 0x09, 0x81, 0x98, 0x04, 0x00,
+    0xC4, 0x18, 0x82, 0x98, 0x04, 0x02, 0x00, 0x00, 0x46, 0x29, 0x09, 0x3A, 0x84, 0xEE, 0x05, 0x81,
+    0xBF, 0x04, 0x82, 0x87, 0x04, 0x01, 0x41, 0x00, 0xA4, 0x10, 0x80, 0xBE, 0x02, 0x81, 0x4C, 0x03,
+    0x42, 0x00, 0x41, 0x08, 0xE4, 0x18, 0x62, 0x00, 0x84, 0x97, 0x04, 0x81, 0xCE, 0x05, 0x81, 0x8D,
+    0x0D, 0x86, 0xA2, 0x08, 0x81, 0x1C, 0x01, 0x62, 0x08, 0xE5, 0x18, 0x80, 0xE6, 0x08, 0x92, 0xD3,
+    0x0D, 0x83, 0x98, 0x04, 0x8F, 0xB2, 0x08, 0x02, 0x00, 0x00, 0x81, 0x10, 0x01, 0x29, 0x80, 0x01,
+    0x00, 0x21, 0x29, 0x80, 0x01, 0x00, 0x01, 0x29, 0x81, 0xF5, 0x03, 0x8F, 0x98, 0x04, 0x80, 0x99,
+    0x04, 0x09, 0x00, 0x00, 0xE1, 0x20, 0x02, 0x52, 0xE2, 0x72, 0xA3, 0x93, 0xC3, 0x93, 0xC3, 0x93,
+    0x42, 0x83, 0xA2, 0x62, 0xE2, 0x41, 0x81, 0x20, 0x00, 0x00, 0x00, 0x80, 0x10, 0x01, 0xA1, 0x18,
+    0x22, 0x29, 0x80, 0x2B, 0x02, 0x41, 0x31, 0x21, 0x31, 0x01, 0x29, 0x83, 0xC7, 0x0C, 0x82, 0xB0,
+    0x08, 0x80, 0x04, 0x01, 0x44, 0xD5, 0xE1, 0xFD, 0x82, 0x98, 0x04, 0x01, 0x82, 0xFE, 0xA3, 0x93,
+    0x83, 0xD5, 0x02, 0x81, 0x9B, 0x04, 0x81, 0x66, 0x09, 0x21, 0x29, 0x42, 0x5A, 0x02, 0x7B, 0xA3,
+    0x8B, 0xA3, 0x93, 0x83, 0x8B, 0x23, 0x73, 0x63, 0x5A, 0x41, 0x31, 0x40, 0x08, 0x81, 0x54, 0x81,
+    0x85, 0x08, 0x83, 0xDF, 0x0B, 0x08, 0x01, 0x29, 0x22, 0x52, 0x03, 0x73, 0x63, 0x83, 0x63, 0x83,
+    0x22, 0x73, 0x82, 0x62, 0x02, 0x4A, 0x01, 0x29, 0x81, 0xBE, 0x07, 0x84, 0x9D, 0x08, 0x80, 0x28,
+    0x07, 0xE3, 0x6A, 0x24, 0x9C, 0xA4, 0xAC, 0xA4, 0xAC, 0x64, 0xA4, 0xC4, 0x93, 0xE3, 0x6A, 0x82,
+    0x39, 0x83, 0xD2, 0x04, 0x82, 0x98, 0x04, 0x03, 0x22, 0x31, 0x07, 0xF5, 0x01, 0x89, 0x20, 0x70,
+    0x81, 0xE7, 0x03, 0x81, 0x01, 0x03, 0x40, 0x70, 0xA0, 0x78, 0x26, 0xF5, 0x82, 0x41, 0x84, 0xA8,
+    0x03, 0x04, 0x00, 0x00, 0xC2, 0x51, 0xC5, 0xF4, 0x20, 0x78, 0x40, 0x70, 0x80, 0x8D, 0x04, 0x81,
+    0x81, 0x04, 0x82, 0x17, 0x82, 0x01, 0x01, 0x00, 0x60, 0x83, 0xD3, 0x80, 0xCB, 0x08, 0x81, 0xCA,
+    0x01, 0x03, 0x04, 0x8B, 0xE5, 0xDB, 0x00, 0x60, 0x40, 0x68, 0x81, 0x01, 0x00, 0x60, 0x68, 0x83,
+    0x03, 0x0F, 0x20, 0x60, 0x20, 0x58, 0x42, 0xA2, 0x65, 0xE4, 0x26, 0xF5, 0x66, 0xFD, 0x66, 0xF5,
+    0x46, 0xF5, 0x46, 0xF5, 0x47, 0xED, 0x27, 0xF5, 0x47, 0xF5, 0x27, 0xFD, 0x06, 0xFD, 0xA5, 0xEC,
+    0x82, 0x89, 0x83, 0x1B, 0x82, 0x01, 0x02, 0x00, 0x60, 0x24, 0xDC, 0x04, 0x83, 0x85, 0xA3, 0x0C,
+    0x87, 0x97, 0x04, 0x00, 0x21, 0x00, 0x81, 0x97, 0x04, 0x83, 0xAF, 0x08, 0x03, 0x00, 0x00, 0xC4,
+    0x10, 0x26, 0x19, 0xC4, 0x10, 0x81, 0x01, 0x01, 0xE5, 0x10, 0xC9, 0x31, 0x80, 0xB3, 0x0F, 0x83,
+    0xA1, 0x02, 0x8C, 0x27, 0x82, 0xAB, 0x03, 0x81, 0xF7, 0x02, 0x82, 0xA7, 0x03, 0x86, 0xBD, 0x0C,
+    0x82, 0xBB, 0x08, 0x86, 0xDC, 0x0C, 0x8C, 0x99, 0x04, 0x82, 0x8C, 0x03, 0x80, 0xC6, 0x04, 0xA8,
+    0xC5, 0x0C, 0x88, 0xB0, 0x03, 0x00, 0x41, 0x00, 0x81, 0xBE, 0x0C, 0x82, 0xFA, 0x03, 0x81, 0x8D,
+    0x0C, 0x84, 0x01, 0x80, 0x47, 0x80, 0xF6, 0x04, 0x81, 0x03, 0x00, 0x83, 0x08, 0x80, 0xD6, 0x03,
+    0x80, 0x15, 0x00, 0x42, 0x08, 0x80, 0xA8, 0x01, 0x84, 0x29, 0x81, 0xF2, 0x0C, 0x80, 0x03, 0x81,
+    0x1B, 0x81, 0x98, 0x04, 0x00, 0xE4, 0x18, 0x80, 0x2E, 0x81, 0xC8, 0x0C, 0x00, 0xC8, 0x31, 0x80,
+    0xB2, 0x08, 0x83, 0xA7, 0x01, 0x83, 0x98, 0x04, 0x80, 0x93, 0x01, 0x83, 0x0C, 0x80, 0x44, 0x80,
+    0xAF, 0x08, 0x00, 0xC4, 0x10, 0x80, 0x05, 0x83, 0xA6, 0x05, 0x80, 0x80, 0x09, 0x86, 0x8D, 0x01,
+    0x83, 0xC5, 0x01, 0x80, 0xB5, 0x05, 0x01, 0x05, 0x19, 0x05, 0x19, 0x84, 0xB7, 0x0C, 0x87, 0x7B,
+    0x85, 0x96, 0x04, 0x81, 0x08, 0x83, 0xA2, 0x03, 0x8C, 0xFD, 0x03, 0x88, 0xCA, 0x01, 0x83, 0x0E,
+    0x83, 0xC4, 0x0C, 0x8A, 0x9A, 0x04, 0x88, 0x4A, 0x80, 0x0E, 0x82, 0xC2, 0x08, 0x82, 0x4F, 0x8A,
+    0x44, 0x02, 0x22, 0x31, 0x44, 0xF6, 0x80, 0xFD, 0x82, 0x9E, 0x0C, 0x01, 0xA4, 0xFE, 0x63, 0x5A,
+    0x83, 0x14, 0x84, 0xDE, 0x03, 0x83, 0x82, 0x05, 0x85, 0x52, 0x89, 0x82, 0x05, 0x86, 0x14, 0x84,
+    0x84, 0x04, 0x83, 0x29, 0x85, 0x14, 0x81, 0xD7, 0x0C, 0x00, 0x22, 0x00, 0x80, 0xEB, 0x05, 0x81,
+    0x11, 0x02, 0xE3, 0x51, 0xC6, 0xF4, 0x80, 0x70, 0x80, 0xE5, 0x03, 0x83, 0x01, 0x03, 0x20, 0x60,
+    0x61, 0x89, 0x46, 0xF5, 0xC1, 0x20, 0x84, 0xAA, 0x03, 0x05, 0x01, 0x00, 0x20, 0x08, 0xA5, 0xDC,
+    0xC2, 0xA1, 0x00, 0x68, 0x40, 0x70, 0x82, 0x81, 0x04, 0x83, 0x01, 0x80, 0x08, 0x03, 0x40, 0x60,
+    0x20, 0x60, 0xA5, 0xEC, 0x63, 0x6A, 0x82, 0xE6, 0x05, 0x03, 0x83, 0x72, 0x45, 0xE4, 0x00, 0x60,
+    0x40, 0x60, 0x81, 0x01, 0x00, 0x60, 0x60, 0x82, 0x01, 0x00, 0x40, 0x58, 0x80, 0x01, 0x0D, 0x00,
+    0x50, 0x20, 0x50, 0x80, 0x60, 0xE1, 0x68, 0x01, 0x71, 0x21, 0x71, 0x21, 0x79, 0x41, 0x79, 0x61,
+    0x81, 0x41, 0x81, 0x21, 0x79, 0xC1, 0x68, 0x40, 0x58, 0x20, 0x50, 0x82, 0x1A, 0x84, 0x01, 0x01,
+    0xC6, 0xEC, 0x03, 0x5A, 0x8D, 0x98, 0x04, 0x82, 0x97, 0x04, 0x83, 0xAF, 0x08, 0x02, 0x00, 0x00,
+    0x83, 0x10, 0x26, 0x21, 0x82, 0x97, 0x04, 0x02, 0xC4, 0x10, 0x88, 0x29, 0x26, 0x21, 0x81, 0xBD,
+    0x02, 0x83, 0xD5, 0x01, 0x8F, 0x99, 0x04, 0x83, 0x9F, 0x01, 0x00, 0x41, 0x08, 0x82, 0xF9, 0x02,
+    0x80, 0xBC, 0x08, 0x80, 0x9F, 0x04, 0x00, 0x84, 0x08, 0x87, 0x9D, 0x04, 0x86, 0x06, 0x89, 0x09,
+    0x81, 0x08, 0x00, 0xA3, 0x10, 0x82, 0xF7, 0x07, 0xA4, 0x01, 0x8B, 0x65, 0x83, 0xAA, 0x08, 0x88,
+    0xE5, 0x04, 0x82, 0xCB, 0x0C, 0x00, 0xA4, 0x10, 0x81, 0x98, 0x01, 0x82, 0xA8, 0x01, 0x00, 0x42,
+    0x08, 0x89, 0x9A, 0x04, 0x80, 0xB5, 0x01, 0x00, 0x41, 0x00, 0x80, 0xCA, 0x0C, 0x01, 0x42, 0x00,
+    0xE5, 0x18, 0x83, 0x98, 0x04, 0x80, 0xFE, 0x03, 0x82, 0x43, 0x81, 0x13, 0x83, 0xAF, 0x08, 0x80,
+    0xA0, 0x01, 0x00, 0x42, 0x00, 0x80, 0x15, 0x81, 0xFC, 0x0C, 0x80, 0xE4, 0x04, 0x80, 0xCC, 0x0D,
+    0x82, 0x94, 0x04, 0x80, 0x17, 0x88, 0xFE, 0x03, 0x81, 0x5D, 0x05, 0xA4, 0x10, 0xE5, 0x18, 0x05,
+    0x19, 0x26, 0x19, 0x46, 0x21, 0x87, 0x29, 0x8D, 0xAF, 0x08, 0x84, 0x94, 0x03, 0x88, 0x06, 0x90,
+    0x01, 0x90, 0xC6, 0x08, 0xA5, 0x01, 0x80, 0x8B, 0x08, 0x02, 0x00, 0x00, 0x65, 0xAC, 0x83, 0xFE,
+    0x81, 0x97, 0x04, 0x02, 0x40, 0xFD, 0xE1, 0xFD, 0x04, 0xEE, 0x80, 0xCF, 0x08, 0x83, 0x12, 0x84,
+    0xF1, 0x03, 0x83, 0xA3, 0x08, 0x86, 0x24, 0x82, 0xD5, 0x08, 0x8A, 0x01, 0x00, 0x21, 0x00, 0x84,
+    0x24, 0x84, 0x07, 0x81, 0x1D, 0x80, 0x09, 0x85, 0x12, 0x81, 0x98, 0x04, 0x02, 0x83, 0x7A, 0x25,
+    0xE4, 0x20, 0x58, 0x84, 0xE8, 0x03, 0x03, 0x60, 0x60, 0x00, 0x50, 0x63, 0xA2, 0x07, 0xDD, 0x80,
+    0xA9, 0x0D, 0x82, 0xA9, 0x03, 0x81, 0xBA, 0x05, 0x02, 0xE4, 0x82, 0x05, 0xDC, 0x00, 0x58, 0x86,
+    0x80, 0x04, 0x83, 0x84, 0x04, 0x00, 0xA1, 0x68, 0x81, 0xCB, 0x08, 0x81, 0xD1, 0x02, 0x03, 0x82,
+    0x41, 0x06, 0xED, 0x60, 0x60, 0x20, 0x58, 0x81, 0x90, 0x04, 0x00, 0x60, 0x58, 0x81, 0x01, 0x01,
+    0x60, 0x50, 0x40, 0x50, 0x82, 0x01, 0x01, 0x40, 0x48, 0x20, 0x48, 0x86, 0x01, 0x80, 0x0C, 0x81,
+    0x19, 0x83, 0x1B, 0x03, 0x20, 0x58, 0xC1, 0x70, 0x27, 0xF5, 0x42, 0x31, 0x8B, 0x98, 0x04, 0x80,
+    0x50, 0x81, 0xE0, 0x0A, 0x83, 0x97, 0x04, 0x80, 0xDE, 0x02, 0x01, 0x25, 0x19, 0xC4, 0x10, 0x81,
+    0xFF, 0x02, 0x02, 0xA4, 0x10, 0x46, 0x21, 0x67, 0x29, 0x80, 0x99, 0x02, 0x01, 0x21, 0x08, 0x41,
+    0x08, 0x80, 0xB6, 0x07, 0x84, 0x1E, 0x86, 0x26, 0x81, 0xA2, 0x06, 0x00, 0x42, 0x08, 0x89, 0xE7,
+    0x03, 0x80, 0x11, 0x80, 0x9E, 0x04, 0x80, 0xB1, 0x03, 0x80, 0x9B, 0x04, 0x82, 0x01, 0x90, 0xAF,
+    0x08, 0x84, 0xB8, 0x0B, 0x80, 0x80, 0x03, 0x80, 0xFB, 0x02, 0xAC, 0x98, 0x04, 0x83, 0x0A, 0x00,
+    0x41, 0x00, 0x80, 0xFD, 0x03, 0x81, 0x5B, 0x89, 0xB3, 0x0D, 0x81, 0x68, 0x83, 0xB0, 0x05, 0x80,
+    0x01, 0x80, 0x59, 0x81, 0x1C, 0x87, 0xFA, 0x07, 0x80, 0xE2, 0x03, 0x81, 0xA4, 0x08, 0x82, 0x98,
+    0x04, 0x00, 0x00, 0x00, 0x81, 0x68, 0x83, 0xB6, 0x0C, 0x81, 0xC8, 0x01, 0x80, 0xCD, 0x01, 0x85,
+    0xB1, 0x08, 0x83, 0x54, 0x81, 0xDC, 0x01, 0x80, 0xE7, 0x08, 0x80, 0x92, 0x0B, 0x8F, 0x6D, 0x80,
+    0xD1, 0x04, 0x80, 0xF9, 0x04, 0x8E, 0x16, 0x98, 0xD8, 0x03, 0x8C, 0x9E, 0x08, 0xB1, 0x01, 0x04,
+    0x41, 0x08, 0xE5, 0x93, 0xC5, 0xFE, 0x80, 0xFD, 0x20, 0xFD, 0x80, 0x97, 0x04, 0x02, 0x20, 0xFD,
+    0xA3, 0xFE, 0x24, 0x9C, 0x85, 0x66, 0x81, 0xEA, 0x03, 0x8D, 0x98, 0x04, 0x81, 0x9A, 0x04, 0x90,
+    0x98, 0x04, 0x88, 0xB4, 0x08, 0x8B, 0x01, 0x04, 0x01, 0x00, 0x84, 0xA3, 0x64, 0xC3, 0x00, 0x48,
+    0x60, 0x50, 0x82, 0xE8, 0x03, 0x80, 0x01, 0x02, 0x00, 0x48, 0x64, 0xC3, 0x26, 0xB4, 0x86, 0xD9,
+    0x0B, 0x04, 0x00, 0x00, 0xC1, 0x20, 0x47, 0xF5, 0x21, 0x81, 0x00, 0x50, 0x83, 0xFF, 0x03, 0x84,
+    0x01, 0x03, 0x20, 0x50, 0x82, 0x81, 0x47, 0xF5, 0xC1, 0x18, 0x82, 0xFB, 0x05, 0x04, 0x41, 0x08,
+    0xE6, 0xE4, 0x22, 0x92, 0x00, 0x40, 0x60, 0x50, 0x89, 0x01, 0x00, 0x60, 0x48, 0x85, 0x01, 0x88,
+    0x12, 0x81, 0x2D, 0x03, 0x00, 0x50, 0xC2, 0x89, 0x07, 0xDD, 0x41, 0x08, 0x8A, 0x87, 0x08, 0x82,
+    0x97, 0x04, 0x84, 0xAE, 0x08, 0x80, 0xF7, 0x03, 0x00, 0x05, 0x19, 0x82, 0xFB, 0x02, 0x02, 0xA4,
+    0x10, 0x26, 0x19, 0x87, 0x29, 0x82, 0xD3, 0x02, 0x80, 0x99, 0x04, 0x83, 0xE8, 0x02, 0x83, 0x1A,
+    0x86, 0x01, 0x00, 0x42, 0x08, 0x82, 0xB3, 0x07, 0x82, 0xE6, 0x0B, 0x88, 0x9D, 0x04, 0x01, 0x42,
+    0x08, 0x82, 0x08, 0x80, 0xD6, 0x0C, 0x82, 0x35, 0x89, 0xDE, 0x07, 0x83, 0xDB, 0x0C, 0x84, 0xB5,
+    0x07, 0x01, 0xA3, 0x10, 0x82, 0x08, 0xA8, 0x98, 0x04, 0x84, 0xBD, 0x03, 0x83, 0x87, 0x0C, 0x81,
+    0x77, 0x80, 0x07, 0x80, 0x58, 0x80, 0x9A, 0x04, 0x00, 0x83, 0x10, 0x81, 0x01, 0x81, 0xBA, 0x08,
+    0x82, 0xFF, 0x04, 0x02, 0xC4, 0x10, 0xE4, 0x18, 0xE5, 0x18, 0x80, 0x81, 0x04, 0x80, 0x69, 0x80,
+    0xAD, 0x04, 0x83, 0x5A, 0x80, 0xEC, 0x03, 0x85, 0x36, 0x81, 0x93, 0x02, 0x00, 0xA4, 0x10, 0x84,
+    0x98, 0x04, 0x85, 0xAF, 0x01, 0x83, 0x96, 0x04, 0x82, 0x98, 0x04, 0x80, 0x85, 0x01, 0x80, 0xAD,
+    0x08, 0x81, 0x94, 0x04, 0xA3, 0x7D, 0x8D, 0xF4, 0x0B, 0x8C, 0x01, 0x9A, 0xB1, 0x04, 0xA3, 0x01,
+    0x05, 0x81, 0x10, 0x22, 0x29, 0xC4, 0x72, 0xA6, 0xD5, 0xE4, 0xFE, 0x81, 0xFD, 0x82, 0x97, 0x04,
+    0x02, 0xC1, 0xFD, 0x85, 0xF6, 0x21, 0x29, 0x84, 0x96, 0x04, 0x80, 0x95, 0x04, 0x81, 0x9F, 0x08,
+    0x84, 0x01, 0x84, 0x90, 0x04, 0x83, 0x94, 0x04, 0x89, 0x99, 0x04, 0x82, 0x8A, 0x05, 0x98, 0x97,
+    0x04, 0x03, 0x01, 0x00, 0x65, 0xD4, 0x63, 0x9A, 0x00, 0x40, 0x85, 0xD7, 0x03, 0x02, 0x20, 0x48,
+    0x66, 0xDC, 0x25, 0x83, 0x85, 0xD4, 0x06, 0x81, 0xAA, 0x01, 0x03, 0x46, 0xBC, 0x43, 0xC3, 0x00,
+    0x48, 0x40, 0x50, 0x88, 0xED, 0x03, 0x02, 0x00, 0x48, 0x83, 0xA2, 0xC7, 0xD4, 0x84, 0xDD, 0x01,
+    0x02, 0xA4, 0x72, 0x47, 0xF5, 0x60, 0x50, 0x80, 0xC7, 0x04, 0x8B, 0x93, 0x04, 0x89, 0x01, 0x85,
+    0x2E, 0x02, 0x00, 0x40, 0xC4, 0xAA, 0x46, 0xBC, 0x8A, 0xAF, 0x08, 0x80, 0x8D, 0x04, 0x82, 0x9D,
+    0x0B, 0x82, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x84, 0x97, 0x04, 0x03, 0xA4, 0x08, 0x05, 0x19, 0x87,
+    0x29, 0x42, 0x08, 0x82, 0xE5, 0x02, 0x84, 0x01, 0x80, 0xD7, 0x06, 0x82, 0xE8, 0x02, 0x81, 0xBB,
+    0x0B, 0x84, 0x01, 0x80, 0xD1, 0x0F, 0x81, 0x85, 0x04, 0x80, 0xAE, 0x03, 0x81, 0x97, 0x03, 0x87,
+    0xD5, 0x0C, 0x81, 0x2C, 0x80, 0xB9, 0x08, 0x84, 0xB8, 0x08, 0x81, 0xE2, 0x07, 0x83, 0xC8, 0x03,
+    0x83, 0xCE, 0x0F, 0x82, 0x9A, 0x04, 0x00, 0x63, 0x08, 0x80, 0x0E, 0xA5, 0x96, 0x04, 0x85, 0x95,
+    0x04, 0x80, 0x4B, 0x80, 0x6F, 0x80, 0x72, 0x80, 0x01, 0x80, 0x97, 0x04, 0x81, 0x9A, 0x04, 0x81,
+    0xA6, 0x08, 0x82, 0xC0, 0x0C, 0x80, 0x05, 0x84, 0xAD, 0x08, 0x84, 0x98, 0x04, 0x82, 0xCE, 0x0C,
+    0x00, 0x82, 0x08, 0x82, 0x92, 0x01, 0x86, 0xB4, 0x08, 0x80, 0xF7, 0x01, 0x01, 0x42, 0x08, 0xA3,
+    0x10, 0x81, 0xB3, 0x0C, 0x81, 0x90, 0x01, 0x80, 0x9E, 0x01, 0x81, 0x97, 0x01, 0x80, 0xCF, 0x0C,
+    0x80, 0x3B, 0x84, 0x9A, 0x04, 0x81, 0xD4, 0x01, 0x88, 0xF6, 0x03, 0x01, 0x00, 0x00, 0x41, 0x00,
+    0x82, 0x05, 0x99, 0xA5, 0x04, 0x9A, 0xD8, 0x03, 0x86, 0x1F, 0x91, 0x25, 0x94, 0xC9, 0x08, 0x8C,
+    0x16, 0x04, 0xC1, 0x18, 0xC5, 0xDD, 0x85, 0xFE, 0xC4, 0xFE, 0x41, 0xFE, 0x80, 0x94, 0x04, 0x81,
+    0x97, 0x04, 0x02, 0x60, 0xFD, 0xC5, 0xFE, 0x23, 0x73, 0x83, 0x44, 0x82, 0x8A, 0x08, 0x80, 0x91,
+    0x04, 0x82, 0x04, 0x86, 0x9C, 0x04, 0x82, 0x05, 0x88, 0xD9, 0x0C, 0x82, 0xFA, 0x03, 0x81, 0xA5,
+    0x04, 0x83, 0x18, 0x81, 0x9C, 0x04, 0x87, 0xBF, 0x0C, 0x87, 0x98, 0x04, 0x02, 0x81, 0x18, 0x06,
+    0xED, 0x61, 0x79, 0x85, 0x98, 0x04, 0x03, 0x40, 0x48, 0x60, 0x50, 0xE7, 0xEC, 0xE3, 0x51, 0x88,
+    0x98, 0x04, 0x03, 0xE3, 0x51, 0xC5, 0xF4, 0x60, 0x58, 0x20, 0x48, 0x82, 0xFC, 0x03, 0x85, 0xEB,
+    0x03, 0x01, 0x85, 0xC3, 0x06, 0xB4, 0x85, 0xDE, 0x01, 0x03, 0xA7, 0xBC, 0xC6, 0xE4, 0x80, 0x58,
+    0x00, 0x40, 0x80, 0x2A, 0x83, 0x96, 0x04, 0x00, 0x61, 0x48, 0x93, 0x97, 0x04, 0x04, 0x40, 0x50,
+    0x20, 0x48, 0x00, 0x38, 0xE6, 0xCB, 0x25, 0x8B, 0x88, 0x98, 0x04, 0x80, 0x4B, 0x80, 0x97, 0x07,
+    0x81, 0x97, 0x04, 0x81, 0xE5, 0x02, 0x81, 0x97, 0x04, 0x80, 0xF6, 0x02, 0x81, 0x86, 0x03, 0x00,
+    0xA3, 0x08, 0x80, 0x97, 0x04, 0x81, 0xFC, 0x06, 0x80, 0xA7, 0x03, 0x88, 0xD3, 0x08, 0x80, 0x9B,
+    0x04, 0x85, 0xA2, 0x07, 0x83, 0xEF, 0x01, 0x80, 0xF9, 0x02, 0x00, 0x62, 0x00, 0x80, 0x8B, 0x07,
+    0x80, 0xA9, 0x03, 0x81, 0x83, 0x04, 0x82, 0xF9, 0x02, 0x87, 0x9D, 0x04, 0x83, 0x27, 0x80, 0x96,
+    0x04, 0x84, 0xD7, 0x0C, 0x81, 0x81, 0x0C, 0x84, 0xB0, 0x08, 0x81, 0x8E, 0x0C, 0xA4, 0xB0, 0x07,
+    0x83, 0x9B, 0x04, 0x80, 0x95, 0x04, 0x80, 0x01, 0x80, 0x8A, 0x01, 0x85, 0x6F, 0x81, 0x71, 0x82,
+    0x3F, 0x85, 0xBF, 0x0C, 0x00, 0xC4, 0x18, 0x80, 0x01, 0x80, 0x04, 0x80, 0x02, 0x80, 0x99, 0x04,
+    0x80, 0x01, 0x81, 0x08, 0x81, 0x61, 0x80, 0x98, 0x04, 0x82, 0xCD, 0x05, 0x86, 0x7D, 0x83, 0xD9,
+    0x03, 0x82, 0x06, 0x01, 0x20, 0x00, 0x41, 0x00, 0x81, 0x90, 0x04, 0x84, 0x95, 0x04, 0x89, 0xB8,
+    0x05, 0x80, 0xAB, 0x01, 0x80, 0x05, 0x00, 0x42, 0x00, 0x82, 0xDC, 0x03, 0x87, 0xAA, 0x04, 0x95,
+    0x98, 0x04, 0xB0, 0xAF, 0x0C, 0x82, 0xB0, 0x09, 0x9E, 0x9C, 0x04, 0x03, 0x41, 0x08, 0xC4, 0xDD,
+    0x41, 0xFE, 0x60, 0xFD, 0x80, 0x95, 0x04, 0x80, 0x96, 0x04, 0x03, 0x20, 0xFD, 0xC2, 0xFD, 0xE6,
+    0xFE, 0x05, 0x9C, 0x83, 0x68, 0x85, 0xDE, 0x03, 0x81, 0xF4, 0x03, 0x85, 0x97, 0x04, 0x83, 0x0D,
+    0x83, 0x98, 0x04, 0x84, 0x99, 0x04, 0x80, 0x07, 0x80, 0x8B, 0x04, 0x81, 0xD4, 0x08, 0x87, 0x4A,
+    0x83, 0xA3, 0x08, 0x82, 0xA2, 0x04, 0x83, 0x01, 0x81, 0xC6, 0x01, 0x01, 0x82, 0x41, 0x27, 0xF5,
+    0x81, 0xE8, 0x03, 0x83, 0x01, 0x03, 0x00, 0x40, 0xE1, 0x60, 0x27, 0xED, 0xE1, 0x28, 0x83, 0xD0,
+    0x03, 0x82, 0x2A, 0x80, 0x80, 0x02, 0x03, 0xA6, 0xDC, 0x22, 0x9A, 0x00, 0x38, 0x20, 0x48, 0x81,
+    0x01, 0x00, 0x40, 0x48, 0x81, 0x03, 0x80, 0x04, 0x02, 0x00, 0x40, 0x86, 0xDC, 0xE4, 0x7A, 0x85,
+    0xDE, 0x01, 0x08, 0x60, 0x10, 0xC7, 0xBC, 0xC7, 0xFD, 0x62, 0x9A, 0x40, 0x50, 0x00, 0x38, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x48, 0x8F, 0x9A, 0x04, 0x80, 0x27, 0x01, 0x20, 0x40, 0x00, 0x40, 0x80,
+    0x19, 0x05, 0x20, 0x40, 0x60, 0x50, 0x01, 0x69, 0x02, 0x92, 0x88, 0xFD, 0xC3, 0x51, 0x81, 0xFE,
+    0x0A, 0x86, 0xC4, 0x0C, 0x80, 0x86, 0x0C, 0x81, 0xE0, 0x06, 0x82, 0x98, 0x04, 0x80, 0x8A, 0x0B,
+    0x00, 0xE4, 0x10, 0x81, 0xED, 0x03, 0x80, 0x01, 0x01, 0x05, 0x19, 0x67, 0x29, 0x81, 0xC5, 0x02,
+    0x83, 0xA7, 0x02, 0x88, 0xD4, 0x08, 0x81, 0xF0, 0x0F, 0x81, 0xBE, 0x07, 0x01, 0x83, 0x10, 0x63,
+    0x08, 0x84, 0x95, 0x0B, 0x82, 0xEF, 0x05, 0x82, 0xB3, 0x03, 0x82, 0xFF, 0x03, 0x83, 0xB0, 0x04,
+    0x88, 0xEE, 0x02, 0x81, 0xF0, 0x07, 0x81, 0x9D, 0x04, 0x82, 0xE3, 0x07, 0x81, 0xB8, 0x04, 0x83,
+    0xF1, 0x0B, 0x01, 0xA3, 0x10, 0x41, 0x08, 0xA5, 0x96, 0x04, 0x83, 0x95, 0x04, 0x80, 0x03, 0x80,
+    0xF0, 0x03, 0x80, 0x02, 0x86, 0x89, 0x0C, 0x82, 0xDC, 0x04, 0x81, 0x67, 0x81, 0x90, 0x04, 0x80,
+    0x03, 0x81, 0xAA, 0x0D, 0x82, 0xB6, 0x08, 0x01, 0xE4, 0x18, 0x05, 0x19, 0x81, 0x01, 0x82, 0xC0,
+    0x05, 0x81, 0xCE, 0x05, 0x8A, 0x9A, 0x04, 0x83, 0x42, 0x81, 0xA8, 0x05, 0x80, 0x12, 0x81, 0xEF,
+    0x08, 0x8A, 0x17, 0x00, 0x01, 0x00, 0x80, 0x4E, 0x03, 0xA4, 0x10, 0xE5, 0x10, 0x47, 0x21, 0x67,
+    0x21, 0x80, 0x09, 0x85, 0x84, 0x0A, 0x9C, 0x98, 0x04, 0x83, 0x86, 0x03, 0x94, 0xE7, 0x03, 0x93,
+    0xD1, 0x08, 0x83, 0xC3, 0x02, 0x95, 0x31, 0x81, 0xE7, 0x07, 0x80, 0x01, 0x82, 0xCF, 0x03, 0x80,
+    0x3B, 0x01, 0xE4, 0x9B, 0x82, 0xFE, 0x82, 0x96, 0x04, 0x03, 0xA1, 0xFD, 0x84, 0xFE, 0xA6, 0xFE,
+    0x64, 0x83, 0x81, 0xBE, 0x05, 0x83, 0xAD, 0x08, 0x88, 0x01, 0x82, 0xB6, 0x08, 0x86, 0x09, 0x85,
+    0xAD, 0x04, 0x89, 0xB6, 0x04, 0x82, 0x9C, 0x04, 0x81, 0x45, 0x88, 0xE0, 0x0C, 0x81, 0x55, 0x80,
+    0x0F, 0x80, 0xC6, 0x01, 0x0D, 0x63, 0x72, 0x45, 0xDC, 0x40, 0x48, 0x80, 0x50, 0x80, 0x58, 0x80,
+    0x58, 0xA0, 0x58, 0xA0, 0x58, 0x80, 0x58, 0x81, 0x58, 0x60, 0x50, 0x43, 0x9A, 0x07, 0xE5, 0x40,
+    0x08, 0x88, 0x84, 0x01, 0x04, 0x00, 0x00, 0xA4, 0x7A, 0x85, 0xEC, 0xA0, 0x58, 0xE1, 0x60, 0x83,
+    0x01, 0x00, 0xE1, 0x68, 0x80, 0x01, 0x03, 0xE1, 0x60, 0x41, 0x71, 0x26, 0xF5, 0xA2, 0x51, 0x87,
+    0xE0, 0x01, 0x06, 0x04, 0x7B, 0x67, 0xED, 0x07, 0xF5, 0x44, 0xBB, 0xE2, 0x81, 0xC1, 0x58, 0x60,
+    0x50, 0x81, 0x85, 0x04, 0x88, 0x01, 0x80, 0x8F, 0x04, 0x02, 0x20, 0x40, 0x40, 0x48, 0x81, 0x50,
+    0x80, 0x26, 0x08, 0xE2, 0x81, 0xA3, 0x9A, 0x84, 0xC3, 0x45, 0xDC, 0xE6, 0xF4, 0x26, 0xED, 0xE6,
+    0xDC, 0x64, 0x9B, 0x60, 0x10, 0x82, 0x96, 0x0F, 0x83, 0xD0, 0x05, 0x80, 0xC4, 0x0C, 0x80, 0xBD,
+    0x03, 0x81, 0xC7, 0x02, 0x81, 0xDD, 0x06, 0x01, 0x01, 0x00, 0x83, 0x08, 0x83, 0x96, 0x04, 0x80,
+    0xAE, 0x08, 0x00, 0x46, 0x21, 0x81, 0xC1, 0x02, 0x82, 0xA7, 0x02, 0x86, 0xBB, 0x04, 0x83, 0xBE,
+    0x0C, 0x81, 0x24, 0x00, 0x22, 0x00, 0x80, 0x05, 0x82, 0xB3, 0x0F, 0x86, 0xB0, 0x0F, 0x81, 0x1E,
+    0x80, 0xB4, 0x03, 0x83, 0x80, 0x04, 0x81, 0xA4, 0x03, 0x81, 0x82, 0x04, 0x87, 0xD6, 0x0B, 0x82,
+    0xA1, 0x03, 0x81, 0xBA, 0x08, 0x81, 0xFA, 0x08, 0x82, 0xBD, 0x03, 0x81, 0x8E, 0x09, 0xA3, 0x95,
+    0x04, 0x80, 0xFB, 0x04, 0x81, 0x97, 0x04, 0x81, 0x06, 0x81, 0x82, 0x05, 0x82, 0x01, 0x84, 0xEC,
+    0x08, 0x81, 0x01, 0x81, 0x9B, 0x04, 0x80, 0x05, 0x80, 0x91, 0x04, 0x80, 0xA6, 0x08, 0x81, 0x9A,
+    0x04, 0x80, 0xA1, 0x04, 0x80, 0xCA, 0x0C, 0x03, 0x05, 0x21, 0x25, 0x21, 0x05, 0x21, 0x05, 0x21,
+    0x80, 0x99, 0x04, 0x00, 0xE5, 0x18, 0x81, 0xCB, 0x0D, 0x80, 0x01, 0x81, 0x75, 0x8C, 0x9A, 0x04,
+    0x81, 0x96, 0x04, 0x83, 0x92, 0x0E, 0x82, 0x0C, 0x81, 0x90, 0x01, 0x80, 0x87, 0x01, 0x81, 0xA3,
+    0x01, 0x02, 0xC4, 0x10, 0xE5, 0x10, 0x26, 0x19, 0x80, 0x96, 0x04, 0x01, 0x67, 0x21, 0x26, 0x21,
+    0x81, 0x0D, 0x84, 0xD0, 0x01, 0x95, 0x95, 0x04, 0x89, 0x98, 0x04, 0x84, 0xE9, 0x07, 0x99, 0xD8,
+    0x0C, 0x8B, 0x87, 0x04, 0x86, 0xB0, 0x08, 0x94, 0x9C, 0x04, 0x81, 0xD7, 0x03, 0x82, 0xEB, 0x07,
+    0x08, 0x23, 0x52, 0xC5, 0xFE, 0x80, 0xFD, 0xC1, 0xFD, 0x43, 0xFE, 0xC5, 0xFE, 0x66, 0xF6, 0x65,
+    0xAC, 0x62, 0x39, 0x82, 0xB7, 0x02, 0x8E, 0x94, 0x0C, 0x9C, 0x01, 0x84, 0xE4, 0x0C, 0x81, 0x60,
+    0x80, 0x04, 0x82, 0xE5, 0x04, 0x85, 0x01, 0x04, 0x00, 0x00, 0x24, 0x8B, 0xC7, 0xFD, 0x07, 0xE5,
+    0x06, 0xE5, 0x80, 0x01, 0x01, 0x06, 0xED, 0x07, 0xED, 0x80, 0x01, 0x01, 0xE6, 0xEC, 0xA7, 0xFD,
+    0x80, 0xAC, 0x0C, 0x87, 0x17, 0x80, 0x01, 0x06, 0xA1, 0x18, 0x47, 0xE5, 0x87, 0xF5, 0x66, 0xED,
+    0x47, 0xED, 0x47, 0xED, 0x26, 0xED, 0x80, 0x01, 0x05, 0x46, 0xF5, 0x46, 0xF5, 0x26, 0xF5, 0x06,
+    0xED, 0x26, 0xF5, 0x06, 0xF5, 0x80, 0xCB, 0x08, 0x87, 0x01, 0x0D, 0x61, 0x10, 0x63, 0x6A, 0x25,
+    0xB4, 0x26, 0xE5, 0x46, 0xED, 0x26, 0xED, 0xC6, 0xDC, 0x66, 0xD4, 0x06, 0xC4, 0xC5, 0xBB, 0x84,
+    0xB3, 0x64, 0xB3, 0x44, 0xAB, 0x24, 0xAB, 0x80, 0x01, 0x10, 0x44, 0xB3, 0x84, 0xBB, 0xA4, 0xBB,
+    0xE5, 0xC3, 0x25, 0xCC, 0x65, 0xDC, 0xE6, 0xE4, 0x47, 0xF5, 0x67, 0xF5, 0x47, 0xF5, 0x26, 0xE5,
+    0xA6, 0xCC, 0x05, 0xB4, 0x04, 0x83, 0xE2, 0x51, 0xE1, 0x20, 0x20, 0x08, 0x87, 0x84, 0x02, 0x80,
+    0xB7, 0x02, 0x81, 0xDC, 0x02, 0x81, 0xDF, 0x06, 0x82, 0xC4, 0x02, 0x80, 0xB1, 0x0B, 0x83, 0xE3,
+    0x03, 0x01, 0x26, 0x21, 0x26, 0x21, 0x81, 0xE0, 0x07, 0x82, 0xEB, 0x01, 0x8D, 0x01, 0x81, 0xA2,
+    0x01, 0x81, 0xF1, 0x0F, 0x80, 0x02, 0x81, 0xC7, 0x07, 0x80, 0xAB, 0x03, 0x85, 0x9C, 0x04, 0x80,
+    0x27, 0x00, 0x42, 0x00, 0x82, 0xE8, 0x0B, 0x81, 0xFF, 0x03, 0x80, 0x99, 0x04, 0x81, 0x01, 0x82,
+    0xF4, 0x0F, 0x88, 0xF9, 0x02, 0x80, 0x09, 0x82, 0x87, 0x0C, 0x81, 0xBC, 0x08, 0x00, 0x83, 0x10,
+    0xA2, 0x96, 0x04, 0x84, 0x96, 0x09, 0x00, 0x21, 0x08, 0x81, 0x9E, 0x04, 0x80, 0xAF, 0x08, 0x85,
+    0xC7, 0x0C, 0x81, 0x93, 0x04, 0x80, 0x88, 0x05, 0x81, 0xF5, 0x08, 0x80, 0x08, 0x80, 0x09, 0x00,
+    0x83, 0x10, 0x80, 0xB2, 0x08, 0x80, 0x9A, 0x04, 0x00, 0xE5, 0x18, 0x84, 0x97, 0x04, 0x00, 0xE5,
+    0x18, 0x80, 0x01, 0x80, 0x98, 0x04, 0x80, 0xD0, 0x0C, 0x83, 0xAF, 0x01, 0x81, 0xCB, 0x0D, 0x8B,
+    0x9A, 0x04, 0x82, 0xA3, 0x03, 0x85, 0x0B, 0x01, 0x41, 0x00, 0xA4, 0x10, 0x80, 0x42, 0x03, 0x2B,
+    0x3A, 0x47, 0x21, 0xE6, 0x10, 0x27, 0x19, 0x80, 0x95, 0x04, 0x02, 0x47, 0x21, 0x05, 0x19, 0xA3,
+    0x10, 0x80, 0x94, 0x04, 0x82, 0xA5, 0x04, 0x96, 0x98, 0x04, 0x93, 0xD2, 0x03, 0x84, 0x16, 0x90,
+    0x1C, 0x92, 0x80, 0x04, 0x97, 0xFE, 0x0C, 0x85, 0x85, 0x08, 0x07, 0x01, 0x00, 0xC2, 0x18, 0xA8,
+    0xF6, 0xE6, 0xFE, 0x46, 0xE6, 0x05, 0xBD, 0x03, 0x73, 0x01, 0x29, 0x80, 0x4E, 0x83, 0xEB, 0x03,
+    0x83, 0xBE, 0x05, 0x82, 0xE9, 0x06, 0x85, 0xFB, 0x03, 0x81, 0x0A, 0x00, 0x43, 0x00, 0x91, 0x92,
+    0x04, 0x84, 0x1F, 0x82, 0xB3, 0x08, 0x82, 0xC5, 0x0C, 0x81, 0xBE, 0x0C, 0x8A, 0x9E, 0x01, 0x02,
+    0xC1, 0x20, 0x62, 0x39, 0x82, 0x41, 0x83, 0x01, 0x04, 0xA2, 0x41, 0xA2, 0x49, 0xA2, 0x49, 0x82,
+    0x41, 0xA1, 0x20, 0x8A, 0x98, 0x04, 0x80, 0x99, 0x04, 0x00, 0x22, 0x31, 0x81, 0x01, 0x00, 0x21,
+    0x31, 0x82, 0x01, 0x80, 0x06, 0x01, 0x01, 0x31, 0xC1, 0x28, 0x8C, 0xEA, 0x01, 0x09, 0x40, 0x08,
+    0x22, 0x31, 0x03, 0x52, 0xC4, 0x72, 0x45, 0x8B, 0xA5, 0x9B, 0xE5, 0xA3, 0x46, 0xB4, 0x66, 0xB4,
+    0x66, 0xBC, 0x81, 0x01, 0x0A, 0x46, 0xB4, 0x05, 0xB4, 0xE5, 0xAB, 0xA5, 0xA3, 0x65, 0x93, 0x04,
+    0x83, 0x83, 0x72, 0xE2, 0x51, 0x62, 0x41, 0xC1, 0x20, 0x40, 0x08, 0x8C, 0x89, 0x02, 0x01, 0x41,
+    0x08, 0x82, 0x08, 0x82, 0xCC, 0x03, 0x80, 0x01, 0x81, 0xCC, 0x02, 0x00, 0x42, 0x08, 0x83, 0x95,
+    0x04, 0x80, 0xE3, 0x07, 0x01, 0x46, 0x21, 0x05, 0x19, 0x84, 0xB9, 0x02, 0x8A, 0x92, 0x04, 0x81,
+    0x86, 0x07, 0x80, 0xF0, 0x03, 0x83, 0xCA, 0x01, 0x81, 0xB3, 0x03, 0x83, 0xCD, 0x07, 0x82, 0xE2,
+    0x0B, 0x84, 0x9F, 0x0C, 0x80, 0x93, 0x02, 0x80, 0x9B, 0x04, 0x81, 0xDF, 0x0B, 0x00, 0xA4, 0x10,
+    0x84, 0x9A, 0x04, 0x80, 0x86, 0x04, 0x83, 0x9E, 0x04, 0x82, 0x51, 0x89, 0x9E, 0x04, 0x98, 0xBB,
+    0x0B, 0x84, 0x01, 0x00, 0x20, 0x00, 0x87, 0x6B, 0x00, 0x21, 0x08, 0x81, 0xC7, 0x0C, 0x86, 0xAD,
+    0x08, 0x82, 0x80, 0x05, 0x83, 0x54, 0x00, 0xA3, 0x08, 0x82, 0xB5, 0x08, 0x00, 0x63, 0x08, 0x81,
+    0xCE, 0x0C, 0x80, 0x95, 0x04, 0x81, 0xAB, 0x08, 0x81, 0xC8, 0x0C, 0x80, 0xBB, 0x08, 0x80, 0x01,
+    0x82, 0x9B, 0x04, 0x83, 0xCF, 0x0C, 0x84, 0x9A, 0x04, 0x8A, 0xAD, 0x09, 0x87, 0x7B, 0x07, 0x83,
+    0x08, 0x42, 0x00, 0x47, 0x21, 0xCD, 0x4A, 0x88, 0x29, 0x26, 0x19, 0xE5, 0x10, 0x83, 0x08, 0x84,
+    0x1C, 0x83, 0xEF, 0x0D, 0x88, 0xB7, 0x04, 0x8B, 0x97, 0x04, 0x8E, 0xFE, 0x03, 0x82, 0x13, 0x81,
+    0xC3, 0x08, 0x96, 0xEE, 0x03, 0x97, 0x01, 0x83, 0xB8, 0x08, 0x89, 0xB9, 0x02, 0x81, 0xCE, 0x06,
+    0x84, 0xD4, 0x06, 0x03, 0x21, 0x00, 0x82, 0x39, 0x82, 0x31, 0x81, 0x10, 0x82, 0x1C, 0x8A, 0x97,
+    0x04, 0x83, 0x01, 0x00, 0x43, 0x00, 0x86, 0x01, 0x82, 0x85, 0x04, 0x81, 0xAB, 0x04, 0x90, 0x98,
+    0x04, 0x87, 0x01, 0x8D, 0xA3, 0x01, 0x93, 0xD9, 0x05, 0x9D, 0xEA, 0x02, 0x9C, 0x01, 0x86, 0xC5,
+    0x01, 0x01, 0x62, 0x08, 0x82, 0x08, 0x82, 0xFF, 0x02, 0x81, 0xE4, 0x07, 0x80, 0xC3, 0x02, 0x01,
+    0x82, 0x08, 0xC3, 0x10, 0x80, 0xE1, 0x02, 0x81, 0xC4, 0x0C, 0x02, 0xC4, 0x10, 0x46, 0x21, 0xC4,
+    0x18, 0x87, 0xD6, 0x02, 0x88, 0xE1, 0x01, 0x8A, 0xC8, 0x01, 0x83, 0xB2, 0x08, 0x83, 0xB9, 0x03,
+    0x81, 0x80, 0x0D, 0x84, 0xE5, 0x02, 0x80, 0xCA, 0x05, 0x81, 0xB5, 0x0C, 0x80, 0xD1, 0x0C, 0x80,
+    0xB6, 0x0C, 0x84, 0x9B, 0x04, 0x81, 0x99, 0x04, 0x85, 0x56, 0xAC, 0x95, 0x01, 0x84, 0xB2, 0x08,
+    0x83, 0x99, 0x04, 0x81, 0xDA, 0x04, 0x85, 0xB3, 0x08, 0x85, 0x01, 0x80, 0x5D, 0x80, 0x56, 0x00,
+    0x63, 0x08, 0x80, 0xB4, 0x08, 0x80, 0x99, 0x04, 0x80, 0x8E, 0x04, 0x80, 0xB7, 0x08, 0x81, 0xD3,
+    0x0C, 0x81, 0x01, 0x81, 0xA0, 0x04, 0x03, 0x05, 0x19, 0x26, 0x21, 0x25, 0x21, 0xE5, 0x18, 0x81,
+    0x76, 0x80, 0xC6, 0x01, 0x81, 0xFD, 0x0C, 0x82, 0x8A, 0x0E, 0x8F, 0x54, 0x80, 0xA1, 0x01, 0x80,
+    0xAA, 0x08, 0x85, 0x16, 0x00, 0x20, 0x00, 0x80, 0x98, 0x04, 0x81, 0xE0, 0x0C, 0x93, 0x97, 0x04,
+    0x88, 0x92, 0x02, 0x86, 0xDC, 0x02, 0x83, 0x92, 0x04, 0x8E, 0x17, 0x97, 0x8C, 0x04, 0x85, 0xC7,
+    0x07, 0x8F, 0xE2, 0x0A, 0x84, 0x85, 0x04, 0x85, 0x07, 0x80, 0x20, 0x83, 0xB9, 0x08, 0x84, 0x9D,
+    0x08, 0x89, 0x8F, 0x04, 0x88, 0x01, 0x81, 0x14, 0x8A, 0xC4, 0x08, 0x96, 0x01, 0x82, 0xC4, 0x01,
+    0x8A, 0xAA, 0x01, 0x8E, 0xBC, 0x01, 0xBA, 0x01, 0x82, 0x4E, 0x80, 0x96, 0x04, 0x82, 0xBE, 0x03,
+    0x80, 0x01, 0x80, 0xC0, 0x03, 0x80, 0x0E, 0x00, 0x41, 0x08, 0x81, 0xED, 0x0B, 0x81, 0xF1, 0x07,
+    0x00, 0xA3, 0x10, 0x80, 0xE9, 0x02, 0x82, 0xF4, 0x0B, 0x84, 0x5D, 0x80, 0xC9, 0x02, 0x85, 0xEA,
+    0x01, 0x80, 0xCF, 0x02, 0x81, 0xA7, 0x08, 0x83, 0x92, 0x04, 0x82, 0xB0, 0x08, 0x82, 0xB3, 0x08,
+    0x81, 0x98, 0x04, 0x81, 0xF6, 0x0F, 0x84, 0x01, 0x82, 0xD2, 0x0C, 0x82, 0x95, 0x02, 0x00, 0x42,
+    0x00, 0x82, 0xF4, 0x0B, 0x82, 0x9B, 0x04, 0x83, 0xEC, 0x04, 0x86, 0x01, 0x00, 0x41, 0x08, 0xA9,
+    0x9D, 0x04, 0x81, 0x6B, 0x80, 0x95, 0x04, 0x82, 0x01, 0x86, 0x95, 0x04, 0x89, 0x98, 0x04, 0x00,
+    0x84, 0x08, 0x80, 0x99, 0x04, 0x80, 0xB6, 0x08, 0x80, 0x61, 0x80, 0x99, 0x04, 0x81, 0x97, 0x04,
+    0x81, 0xD1, 0x0C, 0x01, 0xE4, 0x18, 0x04, 0x19, 0x82, 0x07, 0x80, 0xB0, 0x08, 0x80, 0xD5, 0x0C,
+    0x80, 0x99, 0x04, 0x00, 0xE5, 0x18, 0x82, 0xD0, 0x0C, 0x80, 0x75, 0x81, 0x34, 0x00, 0x41, 0x00,
+    0x8B, 0x4F, 0x81, 0x85, 0x09, 0x89, 0x0E, 0x01, 0x61, 0x08, 0x61, 0x08, 0x81, 0xA5, 0x04, 0x95,
+    0x95, 0x04, 0x83, 0xF1, 0x01, 0x88, 0xDA, 0x02, 0x85, 0xF1, 0x02, 0x85, 0x09, 0x8E, 0x85, 0x04,
+    0x8F, 0x10, 0x90, 0x8F, 0x04, 0x86, 0x92, 0x04, 0x8C, 0xFC, 0x07, 0x84, 0xF0, 0x03, 0x87, 0x92,
+    0x04, 0x00, 0x63, 0x00, 0x82, 0x03, 0x00, 0x63, 0x00, 0x83, 0x01, 0x8C, 0x9E, 0x04, 0x82, 0x22,
+    0x82, 0x05, 0x83, 0x2A, 0x88, 0xF1, 0x0C, 0x85, 0x09, 0x85, 0x9B, 0x04, 0x96, 0xA4, 0x05, 0xA8,
+    0xEE, 0x02, 0x96, 0x85, 0x03, 0x80, 0xAC, 0x08, 0x82, 0xC1, 0x03, 0x83, 0xF2, 0x07, 0x80, 0x0C,
+    0x81, 0xCF, 0x03, 0x80, 0x9A, 0x04, 0x01, 0xA3, 0x10, 0xC4, 0x10, 0x80, 0xE5, 0x02, 0x00, 0x21,
+    0x08, 0x83, 0xA6, 0x02, 0x86, 0xEC, 0x01, 0x84, 0x84, 0x06, 0x82, 0x8D, 0x07, 0x80, 0x2A, 0x85,
+    0x97, 0x04, 0x81, 0xCB, 0x07, 0x8A, 0xF8, 0x03, 0x83, 0xEF, 0x0B, 0x81, 0xBC, 0x0F, 0x84, 0xEA,
+    0x04, 0x00, 0x22, 0x00, 0x80, 0x1C, 0x81, 0x47, 0x86, 0xB2, 0x08, 0x84, 0xD6, 0x03, 0xA6, 0x9B,
+    0x04, 0x82, 0x6A, 0x84, 0x97, 0x04, 0x83, 0xB1, 0x08, 0x88, 0x93, 0x04, 0x87, 0x01, 0x82, 0x91,
+    0x09, 0x80, 0xA4, 0x01, 0x80, 0x8C, 0x04, 0x81, 0x9B, 0x04, 0x00, 0x04, 0x19, 0x80, 0xB8, 0x08,
+    0x80, 0xC4, 0x0C, 0x82, 0xB6, 0x08, 0x80, 0xB5, 0x08, 0x80, 0x9D, 0x04, 0x81, 0xCE, 0x0C, 0x81,
+    0x9B, 0x04, 0x00, 0x82, 0x08, 0x81, 0x96, 0x04, 0x89, 0x8B, 0x04, 0x83, 0xB8, 0x01, 0x87, 0xB3,
+    0x09, 0x02, 0x41, 0x08, 0xA2, 0x10, 0x62, 0x08, 0x99, 0x7B, 0x84, 0x87, 0x04, 0x86, 0x96, 0x04,
+    0x85, 0x11, 0x9C, 0xC6, 0x0C, 0x84, 0xB5, 0x07, 0x8E, 0x95, 0x04, 0x80, 0xB1, 0x03, 0x87, 0x81,
+    0x04, 0x82, 0xCC, 0x03, 0x89, 0xCA, 0x03, 0x80, 0x0D, 0x82, 0xF4, 0x03, 0x00, 0x22, 0x00, 0x89,
+    0x80, 0x04, 0x84, 0x8F, 0x04, 0x8D, 0x97, 0x04, 0x85, 0x8B, 0x04, 0x81, 0x08, 0x81, 0x38, 0x84,
+    0x03, 0x86, 0xA6, 0x08, 0x82, 0x6D, 0x81, 0x60, 0x84, 0x65, 0x85, 0x9E, 0x03, 0x90, 0xAA, 0x05,
+    0x85, 0xBC, 0x01, 0x83, 0x90, 0x03, 0xB1, 0x01, 0x85, 0x96, 0x04, 0x81, 0xAB, 0x08, 0x80, 0x40,
+    0x80, 0x80, 0x10, 0x00, 0x82, 0x08, 0x82, 0xF6, 0x02, 0x80, 0xF3, 0x02, 0x02, 0xE5, 0x18, 0x25,
+    0x21, 0xA3, 0x10, 0x85, 0xA8, 0x02, 0x86, 0xE8, 0x01, 0x81, 0xD9, 0x02, 0x85, 0x09, 0x84, 0xC3,
+    0x0C, 0x89, 0x97, 0x04, 0x84, 0xB8, 0x08, 0x84, 0xB1, 0x08, 0x80, 0x42, 0x82, 0x18, 0x84, 0x84,
+    0x03, 0x81, 0x0D, 0x84, 0x8F, 0x04, 0x81, 0x01, 0x80, 0x58, 0x82, 0xB6, 0x04, 0x81, 0x0C, 0x85,
+    0x1C, 0x98, 0x01, 0x81, 0xD1, 0x03, 0x82, 0x66, 0x81, 0x02, 0x82, 0xCE, 0x03, 0x80, 0x01, 0x85,
+    0x5C, 0x82, 0x49, 0x00, 0x63, 0x08, 0x81, 0x41, 0x84, 0x96, 0x04, 0x00, 0xA4, 0x10, 0x80, 0xAE,
+    0x08, 0x80, 0x86, 0x04, 0x80, 0x82, 0x04, 0x03, 0xC4, 0x18, 0x05, 0x21, 0x46, 0x29, 0x05, 0x21,
+    0x80, 0x01, 0x00, 0x04, 0x19, 0x80, 0xA0, 0x04, 0x80, 0x01, 0x80, 0x9B, 0x04, 0x81, 0x9E, 0x04,
+    0x80, 0xDC, 0x0C, 0x03, 0x25, 0x21, 0x04, 0x19, 0xC4, 0x18, 0xA3, 0x10, 0x81, 0x8B, 0x0E, 0x00,
+    0x41, 0x08, 0x84, 0xBE, 0x0D, 0x85, 0xBA, 0x01, 0x86, 0x01, 0x82, 0x0D, 0x02, 0xA2, 0x10, 0xC3,
+    0x18, 0x41, 0x08, 0x9B, 0x7F, 0x8E, 0xF1, 0x06, 0x87, 0x07, 0x93, 0x9C, 0x04, 0x81, 0x92, 0x03,
+    0x90, 0xA1, 0x08, 0x85, 0xAA, 0x04, 0x89, 0xA6, 0x03, 0x80, 0xB7, 0x0C, 0x00, 0x02, 0x00, 0x84,
+    0x01, 0x84, 0x0E, 0x86, 0x16, 0x82, 0x11, 0x85, 0x19, 0x96, 0x01, 0x85, 0x27, 0x82, 0x09, 0x86,
+    0x37, 0x8F, 0x96, 0x05, 0x89, 0x79, 0x85, 0x0F, 0x83, 0x99, 0x01, 0x8B, 0x01, 0x82, 0xCA, 0x03,
+    0xA9, 0xA0, 0x04, 0x83, 0xC1, 0x02, 0x83, 0xD0, 0x03, 0x82, 0x63, 0x00, 0x41, 0x00, 0x80, 0xBF,
+    0x03, 0x81, 0xA5, 0x04, 0x80, 0x97, 0x04, 0x80, 0x89, 0x07, 0x00, 0xC4, 0x18, 0x81, 0xBD, 0x02,
+    0x80, 0x10, 0x82, 0x90, 0x02, 0x83, 0xBD, 0x07, 0x86, 0x90, 0x04, 0x81, 0xAE, 0x03, 0x83, 0x97,
+    0x04, 0x81, 0x05, 0x84, 0xC9, 0x07, 0x82, 0xFD, 0x0C, 0x81, 0x88, 0x04, 0x82, 0xD3, 0x0C, 0x81,
+    0x0D, 0x80, 0x45, 0x00, 0x42, 0x08, 0x80, 0xD3, 0x04, 0x84, 0xBF, 0x03, 0x85, 0x9B, 0x08, 0x82,
+    0xD4, 0x0C, 0x83, 0xD3, 0x03, 0x80, 0x85, 0x09, 0x84, 0xD5, 0x0C, 0x82, 0xDA, 0x03, 0x80, 0x28,
+    0x9B, 0x93, 0x01, 0x8C, 0x01, 0x80, 0x6B, 0x86, 0x6D, 0x85, 0x95, 0x04, 0x82, 0x97, 0x04, 0x80,
+    0x95, 0x08, 0x00, 0xC4, 0x10, 0x80, 0x93, 0x04, 0x00, 0x26, 0x21, 0x80, 0x01, 0x06, 0xC4, 0x18,
+    0xA4, 0x10, 0xE4, 0x18, 0x25, 0x21, 0x46, 0x21, 0x46, 0x21, 0x45, 0x21, 0x81, 0x04, 0x80, 0xC5,
+    0x0C, 0x80, 0x01, 0x80, 0x95, 0x04, 0x05, 0x46, 0x29, 0x25, 0x21, 0xE4, 0x18, 0x82, 0x10, 0x21,
+    0x00, 0x20, 0x00, 0x80, 0xF3, 0x09, 0x00, 0xC3, 0x10, 0x80, 0x86, 0x01, 0x83, 0x6E, 0x84, 0xF4,
+    0x0D, 0x80, 0xA1, 0x04, 0x80, 0x01, 0x83, 0x91, 0x0D, 0x80, 0x09, 0x02, 0xA2, 0x10, 0x04, 0x19,
+    0xA2, 0x10, 0x9E, 0x93, 0x02, 0x8F, 0xF9, 0x02, 0x8B, 0xFF, 0x02, 0x8C, 0x89, 0x03, 0x8B, 0xA9,
+    0x01, 0x82, 0xDC, 0x09, 0x85, 0xA0, 0x06, 0x82, 0xF1, 0x01, 0x80, 0x01, 0x80, 0xB9, 0x09, 0x83,
+    0xA9, 0x01, 0x82, 0xED, 0x0D, 0x80, 0xE2, 0x0D, 0x80, 0x01, 0x80, 0xCD, 0x09, 0x80, 0xBE, 0x05,
+    0x01, 0x26, 0x21, 0x06, 0x21, 0x80, 0xDE, 0x09, 0x81, 0xB8, 0x01, 0x01, 0x46, 0x29, 0x67, 0x29,
+    0x84, 0x01, 0x00, 0x87, 0x29, 0x84, 0x06, 0x00, 0xA8, 0x31, 0x83, 0x01, 0x00, 0x88, 0x31, 0x82,
+    0x04, 0x80, 0x0E, 0x00, 0x47, 0x29, 0x84, 0x01, 0x80, 0x25, 0x01, 0x06, 0x21, 0x06, 0x19, 0x81,
+    0x01, 0x00, 0x06, 0x21, 0x80, 0x01, 0x80, 0x05, 0x81, 0x3D, 0x00, 0xC5, 0x18, 0x80, 0x02, 0x80,
+    0x01, 0x80, 0x4D, 0x81, 0x92, 0x06, 0x00, 0x84, 0x10, 0x81, 0xE0, 0x02, 0x81, 0x01, 0x82, 0xF4,
+    0x02, 0x83, 0xAC, 0x08, 0x93, 0xAE, 0x04, 0x87, 0xD7, 0x05, 0x8A, 0xD9, 0x01, 0xAE, 0x95, 0x04,
+    0x82, 0xAB, 0x08, 0x82, 0xF0, 0x01, 0x85, 0xD4, 0x01, 0x03, 0xA3, 0x10, 0x05, 0x19, 0x04, 0x19,
+    0x82, 0x10, 0x84, 0xA1, 0x02, 0x86, 0x8B, 0x02, 0x85, 0x09, 0x81, 0xBB, 0x07, 0x83, 0x84, 0x04,
+    0x82, 0x01, 0x00, 0x42, 0x00, 0x80, 0xF1, 0x03, 0x81, 0xF2, 0x02, 0x84, 0xB2, 0x08, 0x83, 0x11,
+    0x82, 0x87, 0x0D, 0x00, 0x42, 0x08, 0x80, 0xDB, 0x0B, 0x82, 0xBA, 0x0C, 0x00, 0x63, 0x08, 0x80,
+    0xC3, 0x03, 0x82, 0xC4, 0x03, 0x80, 0x9A, 0x03, 0x00, 0x41, 0x00, 0x83, 0x8B, 0x01, 0x82, 0xB7,
+    0x08, 0x80, 0x56, 0x82, 0xB1, 0x04, 0x81, 0xAC, 0x03, 0x80, 0x1C, 0xA0, 0xD2, 0x0C, 0x83, 0xB2,
+    0x08, 0x86, 0x80, 0x03, 0x80, 0x75, 0x82, 0x8B, 0x05, 0x84, 0xF2, 0x02, 0x80, 0x56, 0x81, 0xDF,
+    0x04, 0x81, 0x4A, 0x82, 0xAF, 0x08, 0x81, 0xE7, 0x02, 0x00, 0x06, 0x19, 0x81, 0xE2, 0x02, 0x80,
+    0xC9, 0x0C, 0x80, 0x09, 0x81, 0x97, 0x04, 0x02, 0x46, 0x21, 0x46, 0x29, 0x66, 0x29, 0x80, 0x02,
+    0x0A, 0x86, 0x31, 0x45, 0x29, 0xE4, 0x18, 0x62, 0x08, 0x20, 0x00, 0x41, 0x00, 0x82, 0x08, 0xC3,
+    0x10, 0xE4, 0x18, 0xE3, 0x18, 0xE4, 0x18, 0x80, 0x93, 0x03, 0x00, 0x82, 0x10, 0x83, 0x99, 0x04,
+    0x82, 0xAD, 0x05, 0x82, 0xF9, 0x08, 0x82, 0xB6, 0x08, 0x80, 0x42, 0x02, 0xC3, 0x10, 0x25, 0x21,
+    0xE3, 0x18, 0x9C, 0xAD, 0x08, 0x83, 0x95, 0x04, 0x8D, 0xEE, 0x03, 0x82, 0xCC, 0x0D, 0x81, 0xF0,
+    0x09, 0x82, 0xE7, 0x03, 0x81, 0xAC, 0x0D, 0x00, 0xE4, 0x18, 0x80, 0xDC, 0x03, 0x81, 0x82, 0x05,
+    0x80, 0x6C, 0x80, 0xC0, 0x03, 0x04, 0x87, 0x31, 0x87, 0x31, 0xA8, 0x31, 0xC8, 0x31, 0xC8, 0x39,
+    0x80, 0x01, 0x23, 0xE8, 0x39, 0xE8, 0x39, 0x09, 0x3A, 0x09, 0x3A, 0x09, 0x42, 0x29, 0x42, 0x4A,
+    0x42, 0x4A, 0x4A, 0x4A, 0x4A, 0x6A, 0x4A, 0x6B, 0x4A, 0x8B, 0x4A, 0x6A, 0x4A, 0x8B, 0x4A, 0x8B,
+    0x52, 0xAB, 0x52, 0xCC, 0x52, 0xCB, 0x52, 0xCC, 0x52, 0xEC, 0x5A, 0xEC, 0x5A, 0x0D, 0x5B, 0x0D,
+    0x5B, 0x0D, 0x63, 0x2D, 0x63, 0x0D, 0x63, 0x0D, 0x5B, 0x2E, 0x63, 0x6E, 0x6B, 0x8F, 0x73, 0x8F,
+    0x73, 0x8F, 0x6B, 0x8F, 0x6B, 0x8F, 0x73, 0xB0, 0x73, 0xD0, 0x73, 0x80, 0x01, 0x13, 0xD0, 0x7B,
+    0xF1, 0x7B, 0x11, 0x7C, 0x31, 0x84, 0x31, 0x84, 0x52, 0x84, 0x72, 0x8C, 0xB3, 0x94, 0xD4, 0x94,
+    0xD4, 0x94, 0xB3, 0x94, 0x93, 0x94, 0xB3, 0x94, 0xB3, 0x94, 0xD4, 0x9C, 0xD4, 0x9C, 0xF4, 0x9C,
+    0xF4, 0x9C, 0x14, 0xA5, 0x35, 0xA5, 0x83, 0x01, 0x01, 0x56, 0xAD, 0x56, 0xAD, 0x80, 0x04, 0x03,
+    0x56, 0xA5, 0x56, 0xAD, 0x36, 0xA5, 0x15, 0xA5, 0x80, 0x11, 0x01, 0x15, 0x9D, 0x15, 0xA5, 0x80,
+    0x05, 0x80, 0x19, 0x00, 0xB4, 0x94, 0x80, 0x01, 0x80, 0x24, 0x81, 0x01, 0x06, 0xB3, 0x94, 0x93,
+    0x8C, 0x73, 0x8C, 0x52, 0x8C, 0x52, 0x84, 0x32, 0x84, 0x11, 0x7C, 0x80, 0x36, 0x00, 0x52, 0x84,
+    0x80, 0x06, 0x00, 0x32, 0x84, 0x82, 0x05, 0x00, 0x31, 0x84, 0x80, 0x0C, 0x03, 0x11, 0x7C, 0xF1,
+    0x7B, 0xF0, 0x7B, 0xD0, 0x7B, 0x80, 0x4B, 0x08, 0xB0, 0x73, 0xAF, 0x73, 0x6E, 0x6B, 0x4E, 0x63,
+    0x2D, 0x63, 0x0D, 0x5B, 0xEC, 0x5A, 0xCC, 0x52, 0xAB, 0x52, 0x80, 0x01, 0x09, 0x8B, 0x52, 0x6A,
+    0x4A, 0x4A, 0x4A, 0x29, 0x42, 0x09, 0x42, 0xE8, 0x39, 0xC8, 0x39, 0xA7, 0x31, 0x87, 0x31, 0x66,
+    0x29, 0x80, 0xFE, 0x01, 0x80, 0x93, 0x06, 0x80, 0x9A, 0x01, 0x84, 0xD1, 0x0E, 0x80, 0xA8, 0x01,
+    0x80, 0xAC, 0x01, 0x82, 0xFD, 0x01, 0x00, 0x42, 0x08, 0x80, 0xBA, 0x01, 0x96, 0xC4, 0x05, 0x8C,
+    0x01, 0x81, 0x8A, 0x0A, 0x82, 0xE6, 0x03, 0x83, 0x80, 0x02, 0x83, 0xAD, 0x03, 0x81, 0x3E, 0x82,
+    0xAA, 0x08, 0x82, 0x8E, 0x02, 0x80, 0x07, 0x81, 0xD9, 0x07, 0x82, 0x01, 0x00, 0xA3, 0x10, 0x80,
+    0x90, 0x0B, 0x81, 0x89, 0x0B, 0x86, 0xBA, 0x04, 0x8E, 0xBC, 0x07, 0x83, 0x97, 0x08, 0x86, 0x8B,
+    0x04, 0x84, 0x01, 0x85, 0x9C, 0x04, 0x80, 0x34, 0x00, 0x41, 0x00, 0x84, 0x96, 0x04, 0x85, 0x01,
+    0x84, 0xF4, 0x0B, 0x85, 0xB7, 0x0C, 0x82, 0xB7, 0x08, 0x83, 0xB4, 0x08, 0x81, 0x12, 0x80, 0x18,
+    0x83, 0x9B, 0x04, 0x80, 0xA1, 0x04, 0x9A, 0x9B, 0x04, 0x82, 0x6E, 0x83, 0x9F, 0x04, 0x81, 0xEB,
+    0x07, 0x86, 0x9B, 0x09, 0x85, 0xB6, 0x05, 0x84, 0x86, 0x07, 0x81, 0x82, 0x07, 0x80, 0xF9, 0x06,
+    0x81, 0x82, 0x07, 0x84, 0x9B, 0x04, 0x80, 0x9A, 0x04, 0x80, 0x98, 0x02, 0x02, 0x86, 0x31, 0x86,
+    0x31, 0xE3, 0x18, 0x80, 0x51, 0x05, 0x41, 0x08, 0xC3, 0x18, 0x04, 0x19, 0x04, 0x19, 0xE4, 0x18,
+    0xC3, 0x10, 0x81, 0x01, 0x80, 0x9C, 0x04, 0x01, 0xA3, 0x10, 0xA2, 0x10, 0x81, 0x02, 0x81, 0x97,
+    0x0E, 0x80, 0x34, 0x00, 0x41, 0x08, 0x80, 0x44, 0x80, 0x04, 0x80, 0x43, 0x03, 0xA3, 0x10, 0x45,
+    0x21, 0xA6, 0x31, 0xC3, 0x18, 0x9D, 0xAA, 0x06, 0x90, 0xAD, 0x08, 0x8A, 0xFE, 0x01, 0x80, 0x87,
+    0x01, 0x83, 0xA3, 0x04, 0x82, 0x01, 0x81, 0x8E, 0x08, 0x83, 0x91, 0x08, 0x85, 0x01, 0x00, 0xC3,
+    0x10, 0x80, 0x8E, 0x03, 0x00, 0xC4, 0x18, 0x80, 0x99, 0x08, 0x01, 0xC4, 0x18, 0xC3, 0x18, 0x80,
+    0x08, 0x80, 0x99, 0x03, 0x82, 0x01, 0x83, 0xDA, 0x0D, 0x82, 0xC1, 0x04, 0x82, 0x01, 0x80, 0x9E,
+    0x08, 0x81, 0x01, 0x80, 0xC9, 0x04, 0x80, 0xC8, 0x04, 0x01, 0xA7, 0x31, 0xA7, 0x31, 0x80, 0xC9,
+    0x04, 0x80, 0xC6, 0x03, 0x81, 0xCB, 0x04, 0x80, 0xC9, 0x04, 0x01, 0x2A, 0x42, 0x4A, 0x4A, 0x81,
+    0xCA, 0x04, 0x83, 0x01, 0x80, 0xDB, 0x03, 0x82, 0x03, 0x80, 0x0F, 0x03, 0x4A, 0x42, 0x6A, 0x4A,
+    0x8B, 0x52, 0x8B, 0x52, 0x80, 0xD9, 0x04, 0x82, 0x0B, 0x80, 0xE1, 0x04, 0x81, 0x0E, 0x82, 0x1F,
+    0x01, 0x4A, 0x42, 0x2A, 0x42, 0x80, 0xF1, 0x04, 0x82, 0x01, 0x81, 0xF7, 0x04, 0x00, 0x4A, 0x42,
+    0x80, 0x05, 0x84, 0x01, 0x80, 0x3B, 0x80, 0x03, 0x00, 0xE9, 0x39, 0x80, 0x8C, 0x05, 0x00, 0xC8,
+    0x31, 0x80, 0x4C, 0x81, 0x01, 0x80, 0x53, 0x80, 0x91, 0x04, 0x81, 0x93, 0x04, 0x80, 0xB0, 0x0A,
+    0x83, 0xAE, 0x0A, 0x83, 0x01, 0x83, 0x07, 0x84, 0x85, 0x01, 0x83, 0xA2, 0x04, 0x01, 0x82, 0x10,
+    0x82, 0x10, 0x87, 0xBB, 0x02, 0x82, 0xA9, 0x03, 0x81, 0xC3, 0x01, 0x83, 0x01, 0x85, 0xE3, 0x0E,
+    0x89, 0x9C, 0x04, 0x83, 0xEC, 0x01, 0x82, 0x94, 0x04, 0x80, 0x95, 0x04, 0x82, 0xA9, 0x08, 0x82,
+    0x8C, 0x02, 0x82, 0xA6, 0x04, 0x83, 0xFF, 0x02, 0x81, 0xF7, 0x02, 0x80, 0xF1, 0x02, 0x00, 0xA3,
+    0x10, 0x8A, 0xD3, 0x06, 0x88, 0x99, 0x02, 0x83, 0x4A, 0x82, 0x26, 0x83, 0x8E, 0x0C, 0x87, 0x9E,
+    0x04, 0x82, 0xD6, 0x0C, 0x81, 0x13, 0x81, 0xD3, 0x0F, 0x80, 0xFE, 0x0C, 0x00, 0xA4, 0x10, 0x81,
+    0x84, 0x03, 0x84, 0xD3, 0x07, 0x81, 0xC6, 0x0A, 0x84, 0x9D, 0x04, 0x83, 0xB7, 0x08, 0x84, 0x80,
+    0x04, 0x80, 0x4B, 0x82, 0x60, 0x82, 0xA8, 0x03, 0x85, 0x01, 0x80, 0xC7, 0x04, 0x00, 0x83, 0x10,
+    0x9B, 0x98, 0x04, 0x85, 0x78, 0x81, 0xE8, 0x07, 0x87, 0x9D, 0x0B, 0x84, 0x01, 0x80, 0xB8, 0x07,
+    0x00, 0xE5, 0x18, 0x80, 0x02, 0x81, 0xA0, 0x0B, 0x80, 0x9A, 0x04, 0x00, 0x06, 0x21, 0x81, 0x97,
+    0x04, 0x81, 0x01, 0x81, 0x95, 0x02, 0x02, 0x46, 0x29, 0x45, 0x29, 0xA2, 0x10, 0x80, 0xC8, 0x04,
+    0x00, 0x83, 0x10, 0x80, 0xBB, 0x08, 0x80, 0xEC, 0x09, 0x80, 0x98, 0x04, 0x80, 0x94, 0x04, 0x81,
+    0xA1, 0x03, 0x00, 0xC3, 0x18, 0x80, 0x01, 0x00, 0xC3, 0x10, 0x80, 0x02, 0x80, 0xB2, 0x03, 0x80,
+    0x03, 0x84, 0xBA, 0x08, 0x04, 0xA3, 0x10, 0x25, 0x21, 0x08, 0x3A, 0xC8, 0x39, 0x82, 0x08, 0x9E,
+    0x97, 0x04, 0x87, 0x9A, 0x04, 0x83, 0x07, 0x83, 0x0E, 0x82, 0x03, 0x83, 0xA5, 0x02, 0x87, 0x1F,
+    0x8E, 0x30, 0x90, 0x43, 0x88, 0x2F, 0xAF, 0x01, 0x97, 0x96, 0x0C, 0x9C, 0x01, 0x85, 0xF2, 0x0B,
+    0x81, 0xDE, 0x07, 0x88, 0xC4, 0x06, 0x82, 0x9A, 0x07, 0x82, 0x88, 0x03, 0x81, 0xEA, 0x03, 0x88,
+    0xCC, 0x07, 0x81, 0x93, 0x04, 0x80, 0x01, 0x88, 0xA9, 0x08, 0x84, 0x74, 0x82, 0xF4, 0x05, 0x82,
+    0x92, 0x04, 0x82, 0xA8, 0x08, 0x81, 0x1D, 0x86, 0x8A, 0x01, 0x85, 0xF1, 0x03, 0x80, 0x1B, 0x80,
+    0xDB, 0x03, 0x80, 0xAB, 0x03, 0x00, 0x41, 0x00, 0x87, 0xA3, 0x01, 0x82, 0x39, 0x83, 0x03, 0x81,
+    0x6E, 0x83, 0xC4, 0x0C, 0x81, 0x86, 0x04, 0x81, 0x27, 0x82, 0xD5, 0x0B, 0x84, 0x77, 0x80, 0x01,
+    0x85, 0x6F, 0x82, 0x96, 0x04, 0x80, 0xB0, 0x06, 0x80, 0x3C, 0x82, 0x8D, 0x04, 0x80, 0x14, 0x83,
+    0xAC, 0x08, 0x85, 0x98, 0x04, 0x80, 0x0D, 0x81, 0x9D, 0x01, 0x80, 0xB6, 0x05, 0x85, 0xB7, 0x08,
+    0x81, 0x53, 0x81, 0xB8, 0x07, 0x81, 0x21, 0x81, 0xAA, 0x09, 0x80, 0x52, 0x80, 0xD7, 0x03, 0x00,
+    0x83, 0x08, 0x99, 0x9F, 0x02, 0x88, 0xA4, 0x09, 0x84, 0x92, 0x09, 0x81, 0xFA, 0x07, 0x83, 0x94,
+    0x04, 0x81, 0x59, 0x00, 0x83, 0x10, 0x82, 0xC7, 0x0C, 0x80, 0x99, 0x04, 0x80, 0x03, 0x81, 0xB5,
+    0x08, 0x80, 0x9A, 0x04, 0x81, 0xB5, 0x0F, 0x03, 0x66, 0x29, 0xA7, 0x31, 0x66, 0x29, 0xC3, 0x10,
+    0x80, 0xC2, 0x0C, 0x01, 0x61, 0x08, 0x25, 0x21, 0x80, 0x07, 0x85, 0xAB, 0x06, 0x81, 0x99, 0x04,
+    0x81, 0x98, 0x04, 0x80, 0x01, 0x84, 0xCD, 0x07, 0x80, 0x9B, 0x04, 0x80, 0x36, 0x03, 0xE4, 0x18,
+    0xC7, 0x31, 0x49, 0x4A, 0x66, 0x29, 0x99, 0xA0, 0x09, 0x94, 0x97, 0x03, 0x86, 0x10, 0x9D, 0xB4,
+    0x03, 0x8C, 0xF9, 0x06, 0x8E, 0x8A, 0x07, 0x88, 0x01, 0x00, 0x22, 0x00, 0x80, 0x02, 0x80, 0x03,
+    0x83, 0x09, 0xBA, 0x01, 0x85, 0xDF, 0x07, 0x86, 0x05, 0x8C, 0x72, 0x8E, 0x90, 0x01, 0x81, 0x30,
+    0x83, 0x85, 0x0F, 0x82, 0xBF, 0x07, 0x84, 0x01, 0x89, 0xF1, 0x06, 0x84, 0x8B, 0x08, 0x82, 0xC9,
+    0x0B, 0x81, 0xBA, 0x03, 0x81, 0xA7, 0x08, 0x84, 0xAA, 0x04, 0x86, 0xF9, 0x01, 0x84, 0x26, 0x81,
+    0xFE, 0x02, 0x80, 0xC0, 0x07, 0x01, 0xC3, 0x10, 0x82, 0x10, 0x8B, 0xBB, 0x02, 0x8B, 0xD5, 0x01,
+    0x87, 0xB8, 0x07, 0x83, 0x99, 0x04, 0x83, 0xDB, 0x0B, 0x81, 0xF7, 0x03, 0x81, 0xF6, 0x03, 0x80,
+    0xE2, 0x03, 0x80, 0x43, 0x00, 0x62, 0x08, 0x80, 0x95, 0x04, 0x81, 0xC3, 0x0C, 0x81, 0xF9, 0x0F,
+    0x80, 0x06, 0x81, 0x84, 0x03, 0x82, 0x99, 0x04, 0x82, 0xAD, 0x05, 0x82, 0x1D, 0x84, 0xB7, 0x05,
+    0x81, 0x19, 0x80, 0x9C, 0x04, 0x85, 0x5C, 0x83, 0x6C, 0x82, 0xA8, 0x04, 0x80, 0x9C, 0x09, 0x00,
+    0x62, 0x08, 0x97, 0xA0, 0x03, 0x83, 0xC4, 0x0C, 0x85, 0xBE, 0x01, 0x85, 0x82, 0x06, 0x82, 0x86,
+    0x09, 0x82, 0x5C, 0x83, 0xCA, 0x0C, 0x81, 0xB8, 0x0B, 0x81, 0x95, 0x04, 0x80, 0xB7, 0x08, 0x80,
+    0xB8, 0x08, 0x82, 0x99, 0x04, 0x80, 0xE4, 0x09, 0x80, 0x66, 0x01, 0xC4, 0x18, 0x04, 0x19, 0x80,
+    0x86, 0x04, 0x02, 0xE4, 0x18, 0x46, 0x21, 0x67, 0x29, 0x80, 0xE7, 0x0E, 0x80, 0xBC, 0x08, 0x80,
+    0xC7, 0x0B, 0x85, 0xB5, 0x08, 0x86, 0x99, 0x04, 0x80, 0x03, 0x02, 0x45, 0x29, 0x49, 0x4A, 0x49,
+    0x42, 0x9E, 0xC4, 0x0C, 0x87, 0x86, 0x04, 0x8C, 0x99, 0x04, 0xA4, 0xC2, 0x07, 0x8A, 0x89, 0x03,
+    0x85, 0xF9, 0x03, 0x83, 0xCA, 0x0A, 0x88, 0x90, 0x03, 0x83, 0x01, 0x8E, 0x10, 0x83, 0x25, 0x80,
+    0x05, 0x83, 0xF0, 0x03, 0x82, 0x0D, 0x00, 0x43, 0x00, 0x80, 0x01, 0x01, 0x23, 0x00, 0x43, 0x00,
+    0x81, 0x12, 0x83, 0x18, 0x84, 0x1E, 0x83, 0x1D, 0x85, 0x08, 0x84, 0x29, 0x8B, 0xA4, 0x04, 0x82,
+    0xEC, 0x04, 0x83, 0x08, 0x85, 0x04, 0x8D, 0x9E, 0x05, 0x89, 0x9E, 0x01, 0x83, 0x80, 0x01, 0x87,
+    0x93, 0x0F, 0x80, 0xBB, 0x03, 0x80, 0xE9, 0x06, 0x87, 0xC7, 0x08, 0x81, 0xA4, 0x08, 0x94, 0xD0,
+    0x01, 0x83, 0x96, 0x04, 0x80, 0xDD, 0x02, 0x83, 0xBA, 0x03, 0x89, 0x9F, 0x06, 0x8B, 0x97, 0x04,
+    0x80, 0x87, 0x0C, 0x85, 0xDE, 0x04, 0x80, 0x50, 0x82, 0xA8, 0x08, 0x84, 0x60, 0x80, 0xF4, 0x03,
+    0x00, 0x42, 0x08, 0x80, 0x26, 0x81, 0xE7, 0x08, 0x80, 0x90, 0x04, 0x82, 0x0C, 0x84, 0xD2, 0x07,
+    0x81, 0x84, 0x04, 0x84, 0x0A, 0x82, 0x11, 0x82, 0xD7, 0x08, 0x84, 0xD4, 0x03, 0x81, 0x01, 0x80,
+    0xE6, 0x0F, 0x88, 0xF1, 0x04, 0x80, 0x06, 0x01, 0x62, 0x08, 0xA4, 0x10, 0x98, 0x98, 0x04, 0x8A,
+    0x8F, 0x05, 0x85, 0x86, 0x05, 0x84, 0xDA, 0x05, 0x83, 0x97, 0x04, 0x80, 0x63, 0x81, 0xC6, 0x0C,
+    0x81, 0x01, 0x80, 0xF2, 0x08, 0x04, 0x05, 0x19, 0x26, 0x21, 0x46, 0x21, 0x05, 0x19, 0x83, 0x10,
+    0x80, 0x26, 0x01, 0x63, 0x08, 0xE5, 0x18, 0x82, 0xCF, 0x0C, 0x80, 0x9F, 0x04, 0x05, 0x82, 0x10,
+    0xC4, 0x18, 0x05, 0x21, 0x66, 0x29, 0x87, 0x29, 0x46, 0x21, 0x82, 0xF0, 0x0E, 0x80, 0x9A, 0x04,
+    0x85, 0x9F, 0x04, 0x80, 0xE7, 0x0E, 0x80, 0xAF, 0x04, 0x80, 0xC3, 0x0C, 0x01, 0x8A, 0x4A, 0x86,
+    0x31, 0x8A, 0x9E, 0x0E, 0x93, 0x97, 0x04, 0x81, 0xF8, 0x01, 0x8F, 0x88, 0x04, 0x84, 0x18, 0x8D,
+    0xB3, 0x02, 0x9A, 0x9E, 0x04, 0x8C, 0xB7, 0x03, 0x88, 0x81, 0x04, 0x80, 0xF0, 0x03, 0x82, 0xF4,
+    0x03, 0x83, 0x01, 0x00, 0x63, 0x00, 0x80, 0x03, 0x00, 0x43, 0x08, 0x86, 0x0C, 0x87, 0x01, 0x01,
+    0x23, 0x00, 0x22, 0x00, 0x8F, 0x13, 0x91, 0x01, 0x82, 0x44, 0x85, 0xAA, 0x04, 0x99, 0xCE, 0x08,
+    0x82, 0xE5, 0x0B, 0x88, 0xBB, 0x03, 0x83, 0x0E, 0x8D, 0xA6, 0x01, 0x88, 0xDE, 0x01, 0x86, 0xFB,
+    0x01, 0x85, 0xD9, 0x01, 0x83, 0x1B, 0x87, 0xFB, 0x02, 0x00, 0x42, 0x00, 0x80, 0xF1, 0x02, 0x81,
+    0xE6, 0x07, 0x80, 0xE1, 0x03, 0x88, 0x8F, 0x04, 0x83, 0x1D, 0x88, 0x5C, 0x82, 0xBF, 0x0C, 0x83,
+    0xC7, 0x0C, 0x83, 0x06, 0x82, 0xA6, 0x0C, 0x81, 0xA0, 0x03, 0x82, 0x9A, 0x04, 0x80, 0x12, 0x84,
+    0x96, 0x04, 0x84, 0x89, 0x04, 0x83, 0xA8, 0x04, 0x83, 0xD1, 0x07, 0x84, 0xD9, 0x07, 0x84, 0x9A,
+    0x04, 0x83, 0xCD, 0x03, 0x83, 0x0F, 0x80, 0xCF, 0x03, 0x80, 0xB3, 0x04, 0x80, 0x9B, 0x04, 0x82,
+    0xFD, 0x04, 0x81, 0x99, 0x0D, 0x80, 0x6E, 0x9A, 0x98, 0x04, 0x89, 0x93, 0x05, 0x80, 0x92, 0x0E,
+    0x81, 0x94, 0x0E, 0x85, 0xA1, 0x09, 0x81, 0x51, 0x80, 0x7B, 0x81, 0x97, 0x04, 0x82, 0x98, 0x04,
+    0x81, 0x95, 0x04, 0x03, 0x46, 0x21, 0x66, 0x29, 0x46, 0x29, 0x05, 0x21, 0x81, 0x96, 0x04, 0x80,
+    0xAE, 0x09, 0x03, 0x06, 0x19, 0x26, 0x21, 0x06, 0x21, 0x05, 0x19, 0x80, 0xB9, 0x08, 0x80, 0xBA,
+    0x08, 0x81, 0x9A, 0x04, 0x80, 0xD1, 0x0D, 0x82, 0x9B, 0x04, 0x84, 0xD0, 0x0C, 0x84, 0x99, 0x04,
+    0x80, 0xDF, 0x0C, 0x02, 0x6A, 0x4A, 0x49, 0x4A, 0xE4, 0x18, 0x9D, 0x96, 0x04, 0x8E, 0x80, 0x04,
+    0x82, 0x83, 0x02, 0x8F, 0xC2, 0x08, 0x82, 0x97, 0x02, 0x84, 0xB8, 0x02, 0x98, 0xA8, 0x04, 0x84,
+    0xAB, 0x08, 0x8D, 0x9C, 0x04, 0x84, 0xD5, 0x03, 0x80, 0x07, 0x01, 0x63, 0x00, 0x63, 0x08, 0x81,
+    0x02, 0x81, 0x99, 0x04, 0x00, 0x63, 0x00, 0x81, 0x9C, 0x04, 0x8D, 0x98, 0x04, 0x93, 0x88, 0x04,
+    0x92, 0x16, 0x80, 0x52, 0x83, 0x9C, 0x04, 0x89, 0x9E, 0x04, 0x82, 0xDF, 0x08, 0x86, 0x96, 0x04,
+    0x86, 0xE8, 0x0C, 0x94, 0x01, 0x96, 0xE4, 0x05, 0x84, 0x92, 0x04, 0x8A, 0xCE, 0x04, 0x83, 0xAB,
+    0x08, 0x81, 0xC6, 0x03, 0x84, 0xAB, 0x08, 0x87, 0xE1, 0x04, 0x8D, 0x50, 0x80, 0x97, 0x04, 0x86,
+    0x85, 0x09, 0x82, 0xAA, 0x0D, 0x82, 0xBC, 0x07, 0x81, 0xA0, 0x03, 0x81, 0xA5, 0x03, 0x00, 0x41,
+    0x00, 0x80, 0x32, 0x83, 0xAC, 0x08, 0x85, 0xF8, 0x03, 0x83, 0x9A, 0x04, 0x83, 0xB8, 0x0C, 0x83,
+    0xA0, 0x08, 0x85, 0x92, 0x04, 0x81, 0x01, 0x81, 0xE2, 0x07, 0x82, 0x07, 0x83, 0x09, 0x81, 0x0B,
+    0x01, 0x62, 0x08, 0x20, 0x00, 0x81, 0x61, 0x80, 0x6E, 0x80, 0x78, 0x00, 0x42, 0x08, 0x98, 0xA7,
+    0x03, 0x86, 0x7A, 0x82, 0xB2, 0x08, 0x81, 0x01, 0x80, 0x9B, 0x04, 0x82, 0x99, 0x04, 0x00, 0x82,
+    0x08, 0x80, 0xFC, 0x09, 0x82, 0xCD, 0x0C, 0x81, 0xAF, 0x08, 0x81, 0x98, 0x04, 0x80, 0xFF, 0x03,
+    0x02, 0x87, 0x31, 0x66, 0x29, 0xE4, 0x18, 0x80, 0x90, 0x0D, 0x01, 0x42, 0x08, 0xC4, 0x10, 0x80,
+    0xB4, 0x08, 0x00, 0x06, 0x19, 0x80, 0xA4, 0x04, 0x00, 0x26, 0x21, 0x80, 0xA6, 0x04, 0x80, 0x01,
+    0x81, 0x07, 0x04, 0x25, 0x21, 0xE4, 0x18, 0x83, 0x10, 0x82, 0x10, 0xA3, 0x10, 0x80, 0x1B, 0x02,
+    0x66, 0x29, 0x45, 0x21, 0x05, 0x19, 0x80, 0xB1, 0x08, 0x82, 0x95, 0x04, 0x80, 0x9C, 0x04, 0x03,
+    0x46, 0x21, 0xE8, 0x39, 0x49, 0x42, 0x87, 0x31, 0x9A, 0xAD, 0x08, 0x82, 0x80, 0x04, 0x83, 0xBC,
+    0x06, 0x8D, 0x81, 0x04, 0x8E, 0xAB, 0x04, 0x84, 0x92, 0x04, 0x81, 0x16, 0x81, 0xFA, 0x02, 0x86,
+    0x1C, 0x86, 0xEA, 0x02, 0x85, 0xD3, 0x02, 0x83, 0x96, 0x04, 0x83, 0x55, 0x85, 0xB1, 0x03, 0x89,
+    0xC0, 0x08, 0x85, 0xB7, 0x08, 0x80, 0x93, 0x04, 0x81, 0x01, 0x88, 0xE6, 0x03, 0x02, 0x63, 0x00,
+    0x02, 0x00, 0x01, 0x00, 0x93, 0x82, 0x04, 0x85, 0x17, 0x85, 0x1A, 0x82, 0xD9, 0x04, 0x01, 0x01,
+    0x00, 0x02, 0x00, 0x84, 0x97, 0x04, 0x80, 0xDF, 0x02, 0x85, 0x87, 0x09, 0x8D, 0xA9, 0x08, 0x82,
+    0x10, 0x81, 0x83, 0x01, 0x82, 0x05, 0x81, 0xBB, 0x01, 0x83, 0x8E, 0x01, 0x82, 0x07, 0x86, 0xA8,
+    0x04, 0x84, 0xA0, 0x01, 0x89, 0x89, 0x04, 0x90, 0xA3, 0x04, 0x8A, 0xF1, 0x03, 0x80, 0xEC, 0x02,
+    0x80, 0xE1, 0x06, 0x00, 0x82, 0x10, 0x86, 0xFA, 0x0F, 0x8C, 0x1C, 0x87, 0x24, 0x81, 0xC3, 0x0C,
+    0x80, 0x86, 0x01, 0x82, 0xB2, 0x07, 0x83, 0x8C, 0x0D, 0x82, 0xA0, 0x04, 0x82, 0xA9, 0x08, 0x80,
+    0xB7, 0x08, 0x81, 0xD6, 0x03, 0x00, 0x82, 0x08, 0x80, 0xE3, 0x0F, 0x82, 0x96, 0x04, 0x81, 0xBB,
+    0x0C, 0x81, 0xEF, 0x03, 0x88, 0x9B, 0x04, 0x86, 0xF3, 0x0B, 0x82, 0xC3, 0x03, 0x82, 0x03, 0x82,
+    0x93, 0x04, 0x85, 0xAA, 0x04, 0x81, 0xEC, 0x07, 0x80, 0x10, 0x80, 0xCE, 0x03, 0x82, 0xB6, 0x01,
+    0x80, 0x98, 0x04, 0x80, 0xD8, 0x04, 0x9E, 0x98, 0x04, 0x80, 0x7E, 0x82, 0xAF, 0x08, 0x82, 0x96,
+    0x04, 0x82, 0x55, 0x81, 0x93, 0x0E, 0x80, 0x03, 0x83, 0xAF, 0x08, 0x80, 0x96, 0x04, 0x03, 0x46,
+    0x21, 0x46, 0x21, 0xE4, 0x18, 0x83, 0x08, 0x80, 0x1F, 0x03, 0x83, 0x08, 0x05, 0x19, 0x25, 0x21,
+    0x46, 0x21, 0x81, 0xC2, 0x0C, 0x83, 0x94, 0x04, 0x80, 0xB5, 0x08, 0x82, 0x0A, 0x81, 0x04, 0x00,
+    0xC4, 0x18, 0x80, 0x5A, 0x00, 0x04, 0x19, 0x81, 0xB4, 0x08, 0x81, 0xCD, 0x0C, 0x80, 0x97, 0x04,
+    0x04, 0x66, 0x29, 0xA7, 0x31, 0x29, 0x42, 0xE8, 0x39, 0xC4, 0x18, 0xA2, 0xAA, 0x08, 0x87, 0x09,
+    0x8B, 0xB4, 0x02, 0x8B, 0x9C, 0x04, 0x82, 0x97, 0x04, 0x02, 0xE8, 0x39, 0xCF, 0x7B, 0x41, 0x08,
+    0x80, 0x08, 0x02, 0x00, 0x00, 0xEC, 0x62, 0x29, 0x4A, 0x83, 0x19, 0x88, 0x82, 0x07, 0x80, 0xB0,
+    0x01, 0x84, 0xAF, 0x07, 0x80, 0xC0, 0x0A, 0x05, 0x00, 0x00, 0x09, 0x42, 0x31, 0x8C, 0xF4, 0x9C,
+    0xB3, 0x94, 0xEC, 0x5A, 0x80, 0xBD, 0x04, 0x81, 0xAA, 0x03, 0x01, 0x63, 0x08, 0x84, 0x08, 0x8B,
+    0x97, 0x04, 0x84, 0x08, 0x86, 0x91, 0x04, 0x00, 0x64, 0x08, 0x80, 0xE3, 0x03, 0x00, 0x02, 0x00,
+    0x80, 0xD0, 0x0C, 0x02, 0x02, 0x00, 0x6B, 0x4A, 0x72, 0x8C, 0x82, 0x81, 0x08, 0x8F, 0x95, 0x08,
+    0x01, 0x87, 0x31, 0xAF, 0x73, 0x80, 0xFF, 0x03, 0x89, 0x0F, 0x81, 0xA6, 0x08, 0x01, 0x72, 0x94,
+    0xAB, 0x52, 0x80, 0xAB, 0x04, 0x81, 0x44, 0x03, 0x42, 0x00, 0xF8, 0xBD, 0xAB, 0x52, 0x00, 0x00,
+    0x81, 0x06, 0x90, 0xCC, 0x0C, 0x84, 0x13, 0x83, 0xFE, 0x03, 0x02, 0x62, 0x08, 0xCF, 0x7B, 0xEB,
+    0x5A, 0x81, 0xC0, 0x02, 0x03, 0x00, 0x00, 0xA3, 0x10, 0x31, 0x84, 0x4D, 0x6B, 0x81, 0x97, 0x01,
+    0x84, 0xC7, 0x02, 0x87, 0xD0, 0x02, 0x86, 0xC9, 0x01, 0x8B, 0xA7, 0x04, 0x89, 0x14, 0x82, 0xAA,
+    0x08, 0x81, 0xE9, 0x02, 0x80, 0x96, 0x04, 0x84, 0xD9, 0x0B, 0x83, 0x95, 0x02, 0x83, 0x36, 0x90,
+    0x99, 0x04, 0x83, 0x8D, 0x04, 0x83, 0xAE, 0x08, 0x85, 0xF4, 0x03, 0x81, 0x09, 0x80, 0x95, 0x04,
+    0x81, 0xF7, 0x0C, 0x80, 0xAB, 0x07, 0x00, 0xE5, 0x18, 0x80, 0xB9, 0x07, 0x81, 0xF9, 0x03, 0x81,
+    0xF1, 0x03, 0x83, 0x81, 0x04, 0x80, 0x01, 0x84, 0xBD, 0x0C, 0x86, 0x9A, 0x04, 0x84, 0xDD, 0x07,
+    0x82, 0x03, 0x80, 0x04, 0x84, 0xB5, 0x04, 0x80, 0x08, 0x82, 0x96, 0x04, 0x85, 0xCE, 0x05, 0x80,
+    0x16, 0x85, 0x90, 0x05, 0x9A, 0x98, 0x04, 0x81, 0x97, 0x05, 0x84, 0xA8, 0x09, 0x84, 0x55, 0x80,
+    0x97, 0x04, 0x82, 0xF4, 0x08, 0x80, 0xA3, 0x08, 0x81, 0x97, 0x08, 0x80, 0x42, 0x01, 0x42, 0x08,
+    0xA3, 0x10, 0x80, 0x95, 0x04, 0x80, 0x01, 0x80, 0xBE, 0x0C, 0x00, 0x05, 0x21, 0x83, 0x9A, 0x04,
+    0x81, 0x05, 0x01, 0x46, 0x21, 0x06, 0x19, 0x82, 0xB6, 0x08, 0x81, 0x09, 0x80, 0x1E, 0x00, 0x83,
+    0x10, 0x80, 0xBF, 0x0C, 0x00, 0x25, 0x21, 0x80, 0xB6, 0x08, 0x04, 0x66, 0x29, 0xC8, 0x31, 0x29,
+    0x42, 0x09, 0x3A, 0x66, 0x29, 0x9A, 0xAD, 0x08, 0x8B, 0x9C, 0x04, 0x84, 0x06, 0x88, 0xED, 0x03,
+    0x90, 0xD0, 0x06, 0x80, 0x23, 0x02, 0x75, 0xAD, 0xFF, 0xFF, 0xEC, 0x62, 0x80, 0x2E, 0x01, 0x20,
+    0x00, 0x3C, 0xE7, 0x80, 0xF2, 0x02, 0x82, 0xCA, 0x04, 0x82, 0xD6, 0x08, 0x83, 0x38, 0x02, 0x00,
+    0x00, 0xAF, 0x73, 0x14, 0xA5, 0x81, 0xC8, 0x08, 0x81, 0x98, 0x04, 0x07, 0x01, 0x00, 0x83, 0x10,
+    0x76, 0xB5, 0x79, 0xCE, 0x51, 0x8C, 0x2D, 0x63, 0x8E, 0x73, 0x0C, 0x63, 0x81, 0xA7, 0x04, 0x81,
+    0x19, 0x80, 0x99, 0x08, 0x84, 0x57, 0x82, 0xB5, 0x03, 0x81, 0x2E, 0x80, 0x06, 0x82, 0x17, 0x80,
+    0x9A, 0x04, 0x81, 0x1B, 0x80, 0xFD, 0x07, 0x08, 0x84, 0x08, 0x01, 0x00, 0x87, 0x29, 0x76, 0xAD,
+    0x63, 0x08, 0x02, 0x00, 0x22, 0x00, 0x4A, 0x42, 0xD0, 0x7B, 0x81, 0xEA, 0x07, 0x81, 0x10, 0x80,
+    0x97, 0x08, 0x00, 0x23, 0x00, 0x80, 0x0D, 0x80, 0x09, 0x84, 0x95, 0x08, 0x03, 0x63, 0x00, 0x00,
+    0x00, 0x52, 0x8C, 0xFC, 0xDE, 0x80, 0x35, 0x80, 0x14, 0x80, 0xB6, 0x08, 0x82, 0x9D, 0x04, 0x00,
+    0x23, 0x00, 0x81, 0x1F, 0x80, 0x1B, 0x01, 0xD0, 0x7B, 0x2A, 0x42, 0x81, 0x12, 0x80, 0x4C, 0x02,
+    0x26, 0x21, 0xBE, 0xF7, 0xA7, 0x31, 0x80, 0x08, 0x82, 0x53, 0x81, 0x2D, 0x82, 0x7E, 0x82, 0x5B,
+    0x85, 0x0F, 0x86, 0xB5, 0x02, 0x03, 0x00, 0x00, 0x29, 0x42, 0xFF, 0xFF, 0xBA, 0xDE, 0x81, 0xAE,
+    0x01, 0x03, 0x00, 0x00, 0xB3, 0x94, 0xFF, 0xFF, 0x96, 0xAD, 0x82, 0x9F, 0x04, 0x82, 0x17, 0x80,
+    0xA0, 0x01, 0x00, 0x72, 0x8C, 0x82, 0x9B, 0x0F, 0x84, 0xFC, 0x07, 0x82, 0xA0, 0x0E, 0x88, 0xDE,
+    0x03, 0x86, 0x96, 0x04, 0x84, 0xF9, 0x03, 0x80, 0x9A, 0x0C, 0x81, 0xE9, 0x02, 0x00, 0x82, 0x08,
+    0x80, 0xE2, 0x03, 0x84, 0x8B, 0x04, 0x84, 0xB9, 0x04, 0x83, 0x23, 0x86, 0x21, 0x80, 0xB6, 0x04,
+    0x81, 0x92, 0x03, 0x82, 0x28, 0x80, 0x08, 0x81, 0x94, 0x04, 0x85, 0xC5, 0x0C, 0x81, 0x93, 0x04,
+    0x84, 0x9F, 0x03, 0x80, 0x97, 0x04, 0x80, 0x64, 0x02, 0x42, 0x08, 0xA4, 0x10, 0xE4, 0x18, 0x80,
+    0x95, 0x04, 0x81, 0xE9, 0x03, 0x81, 0xD4, 0x0B, 0x80, 0xCB, 0x0C, 0x85, 0xF8, 0x03, 0x87, 0x01,
+    0x80, 0xAA, 0x04, 0x83, 0x27, 0x80, 0x02, 0x82, 0xBD, 0x0C, 0x80, 0x8B, 0x04, 0x81, 0x8E, 0x04,
+    0x82, 0xB5, 0x08, 0x82, 0x08, 0x85, 0x8D, 0x04, 0x81, 0x9E, 0x01, 0x80, 0x34, 0xA2, 0x98, 0x04,
+    0x82, 0xB2, 0x08, 0x89, 0x94, 0x05, 0x80, 0xEF, 0x04, 0x80, 0x46, 0x80, 0xC4, 0x0C, 0x82, 0xF2,
+    0x08, 0x01, 0x62, 0x08, 0xC4, 0x18, 0x80, 0x91, 0x04, 0x81, 0xA6, 0x08, 0x80, 0x04, 0x83, 0x98,
+    0x04, 0x83, 0x01, 0x00, 0x06, 0x21, 0x80, 0xD2, 0x0C, 0x83, 0xBC, 0x08, 0x80, 0xB7, 0x04, 0x01,
+    0x05, 0x19, 0xC4, 0x18, 0x80, 0x86, 0x0A, 0x80, 0xCF, 0x0C, 0x04, 0x09, 0x3A, 0x8B, 0x4A, 0x6A,
+    0x4A, 0xA8, 0x31, 0xA3, 0x10, 0x92, 0x86, 0x04, 0x94, 0x97, 0x04, 0x84, 0x07, 0x80, 0xDE, 0x03,
+    0x90, 0xAA, 0x08, 0x85, 0xB0, 0x06, 0x81, 0x8B, 0x03, 0x02, 0x59, 0xCE, 0xDB, 0xDE, 0x9A, 0xD6,
+    0x80, 0xB6, 0x01, 0x02, 0x24, 0x21, 0x7D, 0xEF, 0x66, 0x29, 0x80, 0x2D, 0x02, 0xA3, 0x18, 0x49,
+    0x4A, 0xC7, 0x39, 0x80, 0x05, 0x01, 0xA3, 0x10, 0xE4, 0x18, 0x81, 0x37, 0x06, 0xA7, 0x31, 0xC3,
+    0x10, 0x29, 0x42, 0x3D, 0xE7, 0x38, 0xC6, 0x08, 0x42, 0xA3, 0x10, 0x83, 0xBC, 0x02, 0x01, 0x39,
+    0xCE, 0xB7, 0xB5, 0x83, 0x87, 0x05, 0x81, 0xA6, 0x03, 0x02, 0x66, 0x29, 0x6A, 0x4A, 0x86, 0x29,
+    0x81, 0xB6, 0x03, 0x80, 0x16, 0x02, 0xA7, 0x31, 0x8A, 0x52, 0xC4, 0x18, 0x80, 0x08, 0x80, 0xAE,
+    0x02, 0x01, 0x29, 0x42, 0x4A, 0x4A, 0x80, 0x0B, 0x80, 0x0E, 0x08, 0xA3, 0x10, 0x42, 0x00, 0xC8,
+    0x39, 0x63, 0x08, 0x00, 0x00, 0x63, 0x08, 0x09, 0x42, 0x6A, 0x4A, 0xE5, 0x18, 0x80, 0x13, 0x07,
+    0x46, 0x29, 0xD4, 0x9C, 0x7E, 0xEF, 0x29, 0x42, 0x26, 0x21, 0x22, 0x00, 0xE4, 0x18, 0x62, 0x08,
+    0x81, 0x8D, 0x04, 0x02, 0xE8, 0x39, 0x6A, 0x4A, 0x05, 0x21, 0x81, 0xFA, 0x0C, 0x04, 0x83, 0x08,
+    0x42, 0x00, 0xC5, 0x10, 0x6B, 0x4A, 0x67, 0x29, 0x82, 0xE2, 0x03, 0x80, 0x36, 0x01, 0x00, 0x00,
+    0xD7, 0xBD, 0x80, 0xE8, 0x04, 0x80, 0xE0, 0x02, 0x04, 0x01, 0x00, 0xC8, 0x31, 0x2A, 0x42, 0x83,
+    0x10, 0x02, 0x00, 0x80, 0x0C, 0x00, 0x02, 0x00, 0x80, 0xDD, 0x05, 0x00, 0x46, 0x29, 0x80, 0xBF,
+    0x0C, 0x00, 0xE5, 0x18, 0x81, 0xA2, 0x0D, 0x05, 0xA4, 0x10, 0x29, 0x42, 0xC8, 0x39, 0x8E, 0x73,
+    0x3D, 0xE7, 0x63, 0x08, 0x80, 0x5B, 0x02, 0x25, 0x21, 0x4A, 0x4A, 0x87, 0x31, 0x81, 0x8A, 0x08,
+    0x80, 0xDA, 0x01, 0x01, 0x46, 0x21, 0x6A, 0x4A, 0x80, 0x8B, 0x0A, 0x81, 0xF1, 0x04, 0x03, 0xA7,
+    0x31, 0x6A, 0x4A, 0xC7, 0x39, 0x62, 0x08, 0x80, 0x15, 0x02, 0x46, 0x29, 0x8A, 0x4A, 0x46, 0x29,
+    0x82, 0xFC, 0x03, 0x81, 0xFE, 0x03, 0x03, 0x10, 0x84, 0xD7, 0xBD, 0xDB, 0xDE, 0x45, 0x29, 0x80,
+    0x16, 0x03, 0xE8, 0x39, 0x9A, 0xD6, 0x9A, 0xD6, 0x92, 0x8C, 0x81, 0x8A, 0x01, 0x80, 0x7F, 0x00,
+    0x25, 0x21, 0x80, 0x2C, 0x03, 0xE8, 0x39, 0x5D, 0xEF, 0x18, 0xC6, 0x28, 0x42, 0x81, 0x89, 0x02,
+    0x80, 0x93, 0x01, 0x80, 0x18, 0x01, 0x01, 0x00, 0x41, 0x08, 0x80, 0x09, 0x00, 0x86, 0x31, 0x80,
+    0x92, 0x01, 0x85, 0xFA, 0x0D, 0x8B, 0x01, 0x82, 0x94, 0x04, 0x81, 0xE3, 0x03, 0x00, 0x21, 0x08,
+    0x82, 0x82, 0x0D, 0x84, 0xBC, 0x07, 0x87, 0x24, 0x89, 0x2D, 0x81, 0x93, 0x04, 0x82, 0xA7, 0x08,
+    0x82, 0x03, 0x84, 0x98, 0x04, 0x84, 0xAB, 0x08, 0x81, 0x0C, 0x81, 0xCF, 0x04, 0x01, 0x00, 0x00,
+    0x41, 0x00, 0x81, 0xAC, 0x08, 0x84, 0xED, 0x03, 0x81, 0xEF, 0x03, 0x82, 0xDA, 0x0B, 0x80, 0x9C,
+    0x04, 0x8D, 0x9B, 0x04, 0x80, 0xB8, 0x08, 0x80, 0x01, 0x82, 0x05, 0x81, 0xBC, 0x0C, 0x82, 0xB4,
+    0x08, 0x82, 0x04, 0x80, 0x26, 0x81, 0xAD, 0x08, 0x87, 0x01, 0x81, 0x46, 0x98, 0x01, 0x01, 0x20,
+    0x00, 0x20, 0x00, 0x89, 0x99, 0x04, 0x80, 0x02, 0x84, 0x97, 0x04, 0x81, 0xAE, 0x08, 0x82, 0x4A,
+    0x80, 0xF8, 0x0D, 0x80, 0xA7, 0x01, 0x80, 0x91, 0x03, 0x81, 0x95, 0x04, 0x80, 0xA7, 0x0C, 0x80,
+    0x98, 0x04, 0x80, 0x97, 0x08, 0x81, 0x98, 0x04, 0x82, 0xB7, 0x08, 0x82, 0x01, 0x80, 0x06, 0x80,
+    0x94, 0x04, 0x81, 0xB4, 0x08, 0x80, 0xDE, 0x0D, 0x80, 0x1B, 0x80, 0xAE, 0x05, 0x80, 0x28, 0x02,
+    0xA4, 0x10, 0x87, 0x29, 0x66, 0x29, 0x9A, 0x64, 0x88, 0x96, 0x04, 0x83, 0xFE, 0x07, 0x84, 0xB1,
+    0x04, 0x90, 0x8E, 0x04, 0x81, 0x6E, 0x86, 0x0E, 0x80, 0xFD, 0x02, 0x06, 0x1C, 0xE7, 0x29, 0x4A,
+    0xBE, 0xF7, 0xAA, 0x52, 0x00, 0x00, 0xAA, 0x52, 0x3C, 0xE7, 0x80, 0xFD, 0x03, 0x07, 0xEC, 0x62,
+    0xD7, 0xBD, 0x30, 0x8C, 0xF7, 0xBD, 0x75, 0xAD, 0x20, 0x00, 0x45, 0x29, 0x3C, 0xE7, 0x80, 0xF6,
+    0x02, 0x07, 0xD3, 0x9C, 0x72, 0x94, 0xC3, 0x18, 0x96, 0xB5, 0xFF, 0xFF, 0x96, 0xB5, 0x92, 0x94,
+    0x04, 0x21, 0x82, 0x98, 0x07, 0x02, 0x0C, 0x63, 0xDF, 0xFF, 0x83, 0x10, 0x84, 0x4F, 0x05, 0x21,
+    0x00, 0xB3, 0x9C, 0x96, 0xB5, 0x31, 0x84, 0x9A, 0xD6, 0xF0, 0x7B, 0x80, 0xD5, 0x0C, 0x02, 0x7A,
+    0xD6, 0x31, 0x84, 0xD3, 0x9C, 0x80, 0xA6, 0x03, 0x00, 0xE4, 0x18, 0x80, 0x9E, 0x03, 0x03, 0x18,
+    0xC6, 0xD3, 0x9C, 0xD3, 0x9C, 0x9A, 0xD6, 0x80, 0xCD, 0x04, 0x13, 0x10, 0x84, 0x59, 0xCE, 0xF4,
+    0x9C, 0x14, 0x9D, 0x21, 0x00, 0xAB, 0x52, 0xF8, 0xBD, 0x30, 0x84, 0xF0, 0x7B, 0xF8, 0xC5, 0x92,
+    0x94, 0x00, 0x00, 0x8F, 0x73, 0x7D, 0xEF, 0x9A, 0xD6, 0xD3, 0x9C, 0x8A, 0x52, 0x21, 0x00, 0xBB,
+    0xDE, 0x0D, 0x63, 0x80, 0x54, 0x04, 0xF8, 0xC5, 0x35, 0xA5, 0x92, 0x94, 0xBB, 0xD6, 0x2D, 0x63,
+    0x80, 0x34, 0x05, 0x76, 0xAD, 0xB7, 0xB5, 0xD3, 0x9C, 0x14, 0xA5, 0x5D, 0xEF, 0xCC, 0x5A, 0x81,
+    0xA1, 0x04, 0x80, 0x01, 0x02, 0x42, 0x08, 0x1C, 0xE7, 0x6E, 0x6B, 0x80, 0xF6, 0x07, 0x01, 0x9A,
+    0xD6, 0x92, 0x94, 0x80, 0x3B, 0x00, 0x7A, 0xCE, 0x80, 0x4F, 0x80, 0x3B, 0x01, 0x35, 0xA5, 0x71,
+    0x8C, 0x80, 0x49, 0x01, 0xAB, 0x52, 0xBB, 0xD6, 0x80, 0xBA, 0x02, 0x05, 0x0D, 0x63, 0x59, 0xCE,
+    0xF3, 0x9C, 0xB3, 0x94, 0x3C, 0xE7, 0xF8, 0xBD, 0x80, 0xA3, 0x01, 0x03, 0x31, 0x84, 0xD7, 0xBD,
+    0x92, 0x94, 0x7A, 0xD6, 0x80, 0x80, 0x08, 0x05, 0x25, 0x21, 0x39, 0xCE, 0xF0, 0x7B, 0x92, 0x8C,
+    0x76, 0xB5, 0xFB, 0xDE, 0x80, 0xE9, 0x03, 0x0B, 0xC4, 0x18, 0x96, 0xB5, 0xB7, 0xB5, 0x51, 0x84,
+    0x31, 0x84, 0x82, 0x10, 0x00, 0x00, 0x72, 0x8C, 0xB7, 0xB5, 0x71, 0x8C, 0xBA, 0xD6, 0x8E, 0x73,
+    0x80, 0x83, 0x01, 0x82, 0x90, 0x08, 0x03, 0x18, 0xC6, 0x2C, 0x63, 0x79, 0xCE, 0xCB, 0x52, 0x80,
+    0x26, 0x03, 0xF8, 0xBD, 0xCF, 0x7B, 0xFB, 0xDE, 0x4D, 0x63, 0x80, 0xAC, 0x0F, 0x00, 0x35, 0xAD,
+    0x80, 0x99, 0x01, 0x09, 0xFB, 0xE6, 0xEC, 0x5A, 0x41, 0x08, 0x55, 0xAD, 0xFF, 0xFF, 0x18, 0xC6,
+    0x55, 0xAD, 0x04, 0x21, 0x20, 0x00, 0xB3, 0x94, 0x80, 0x0C, 0x06, 0xDB, 0xDE, 0xAF, 0x73, 0x00,
+    0x00, 0x08, 0x42, 0x9A, 0xD6, 0x72, 0x94, 0x96, 0xB5, 0x80, 0x8A, 0x01, 0x8D, 0x93, 0x04, 0x83,
+    0xA8, 0x08, 0x80, 0xDC, 0x03, 0x80, 0xBC, 0x0C, 0x83, 0x82, 0x0A, 0x8F, 0xB2, 0x04, 0x8F, 0xC1,
+    0x04, 0x85, 0x8E, 0x04, 0x84, 0xA3, 0x04, 0x83, 0x0D, 0x81, 0x99, 0x04, 0x80, 0xFF, 0x01, 0x01,
+    0x01, 0x00, 0x83, 0x08, 0x80, 0x96, 0x04, 0x80, 0x88, 0x04, 0x82, 0xBA, 0x0C, 0x81, 0xA9, 0x03,
+    0x81, 0xAB, 0x03, 0x84, 0xA2, 0x0C, 0x82, 0xA8, 0x04, 0x86, 0x94, 0x04, 0x88, 0x9E, 0x04, 0x82,
+    0xD2, 0x0C, 0x82, 0xCE, 0x03, 0x82, 0xBC, 0x04, 0x01, 0x83, 0x10, 0x41, 0x00, 0xA1, 0xA7, 0x03,
+    0x8D, 0x98, 0x04, 0x80, 0xB7, 0x09, 0x81, 0x01, 0x85, 0x89, 0x01, 0x00, 0x82, 0x08, 0x80, 0x6F,
+    0x01, 0x82, 0x08, 0x41, 0x00, 0x80, 0xB8, 0x01, 0x01, 0x41, 0x00, 0x83, 0x10, 0x80, 0xB3, 0x08,
+    0x81, 0x01, 0x83, 0x98, 0x04, 0x81, 0x86, 0x04, 0x81, 0xBB, 0x0C, 0x02, 0x46, 0x21, 0x47, 0x21,
+    0x47, 0x21, 0x80, 0x94, 0x04, 0x00, 0x06, 0x19, 0x80, 0xAE, 0x08, 0x00, 0x26, 0x19, 0x80, 0x0E,
+    0x81, 0x98, 0x04, 0x81, 0x9E, 0x04, 0x02, 0xE4, 0x18, 0xE4, 0x10, 0xC4, 0x18, 0x80, 0x07, 0x00,
+    0xC4, 0x10, 0x81, 0xAA, 0x03, 0xA4, 0x01, 0x83, 0x8D, 0x0C, 0x83, 0x9C, 0x04, 0x8D, 0x98, 0x04,
+    0x81, 0xA0, 0x0F, 0x82, 0xA3, 0x0F, 0x84, 0xDF, 0x0C, 0x80, 0x4E, 0x01, 0xEC, 0x62, 0xFB, 0xDE,
+    0x80, 0x87, 0x04, 0x00, 0x79, 0xCE, 0x80, 0x84, 0x03, 0x07, 0x38, 0xC6, 0x00, 0x00, 0x6A, 0x52,
+    0xDB, 0xDE, 0xC3, 0x18, 0x00, 0x00, 0xE7, 0x39, 0xFF, 0xFF, 0x80, 0x8C, 0x04, 0x03, 0xB7, 0xB5,
+    0x92, 0x8C, 0xF0, 0x83, 0x55, 0xAD, 0x80, 0x35, 0x01, 0x25, 0x21, 0x5D, 0xEF, 0x80, 0xB9, 0x07,
+    0x81, 0xD1, 0x03, 0x80, 0x20, 0x80, 0xA4, 0x03, 0x81, 0x41, 0x01, 0x62, 0x08, 0x25, 0x21, 0x80,
+    0x93, 0x07, 0x01, 0xF4, 0x9C, 0xD7, 0xBD, 0x80, 0x11, 0x01, 0xD3, 0x9C, 0xDB, 0xDE, 0x80, 0x89,
+    0x04, 0x01, 0x9E, 0xF7, 0xC7, 0x31, 0x80, 0xF8, 0x03, 0x04, 0xFF, 0xFF, 0xC7, 0x31, 0xC3, 0x10,
+    0x3C, 0xE7, 0xCB, 0x5A, 0x80, 0x0F, 0x00, 0x3D, 0xEF, 0x80, 0xEC, 0x03, 0x01, 0x18, 0xC6, 0xBA,
+    0xD6, 0x80, 0xC8, 0x03, 0x02, 0xC8, 0x39, 0xDF, 0xFF, 0x09, 0x42, 0x80, 0x0C, 0x01, 0x76, 0xB5,
+    0x35, 0xA5, 0x80, 0x04, 0x00, 0xBB, 0xD6, 0x80, 0x93, 0x04, 0x06, 0x00, 0x00, 0x87, 0x29, 0xDF,
+    0xFF, 0x87, 0x31, 0x62, 0x08, 0x1C, 0xE7, 0x11, 0x84, 0x80, 0x08, 0x09, 0xEC, 0x5A, 0x9E, 0xF7,
+    0x63, 0x08, 0xA4, 0x10, 0xDF, 0xFF, 0x55, 0xAD, 0x62, 0x08, 0x00, 0x00, 0x38, 0xC6, 0xD3, 0x9C,
+    0x81, 0x47, 0x07, 0x42, 0x00, 0x01, 0x00, 0x67, 0x29, 0xDF, 0xFF, 0xE9, 0x39, 0x00, 0x00, 0xF0,
+    0x7B, 0xBF, 0xF7, 0x80, 0x28, 0x05, 0xE8, 0x39, 0xFF, 0xFF, 0x05, 0x19, 0xA3, 0x10, 0x9E, 0xF7,
+    0x31, 0x84, 0x82, 0xB0, 0x05, 0x04, 0xD3, 0x9C, 0xF7, 0xBD, 0x00, 0x00, 0x4A, 0x4A, 0xBE, 0xF7,
+    0x81, 0xA1, 0x09, 0x01, 0x18, 0xC6, 0xB3, 0x94, 0x80, 0x54, 0x00, 0x79, 0xCE, 0x80, 0x28, 0x01,
+    0xAF, 0x73, 0x5D, 0xEF, 0x80, 0xAA, 0x04, 0x01, 0xFF, 0xFF, 0xAB, 0x52, 0x80, 0xDE, 0x03, 0x00,
+    0x7D, 0xEF, 0x80, 0x81, 0x04, 0x01, 0x79, 0xCE, 0x76, 0xAD, 0x82, 0xB7, 0x01, 0x00, 0x93, 0x94,
+    0x80, 0x20, 0x01, 0x00, 0x00, 0x55, 0xAD, 0x80, 0x9A, 0x01, 0x82, 0xAF, 0x08, 0x0A, 0x25, 0x21,
+    0x1C, 0xE7, 0xC3, 0x18, 0xD7, 0xBD, 0x71, 0x8C, 0x00, 0x00, 0x2D, 0x6B, 0x18, 0xC6, 0x45, 0x29,
+    0xFF, 0xFF, 0xE7, 0x39, 0x80, 0x9F, 0x01, 0x00, 0x34, 0xA5, 0x80, 0x17, 0x01, 0x38, 0xCE, 0x18,
+    0xC6, 0x80, 0xDC, 0x04, 0x00, 0x3C, 0xEF, 0x80, 0xB9, 0x04, 0x80, 0x43, 0x81, 0xD3, 0x04, 0x05,
+    0xF3, 0x9C, 0x9A, 0xD6, 0x00, 0x00, 0xCF, 0x7B, 0xBE, 0xF7, 0x28, 0x42, 0x80, 0x08, 0x8C, 0x93,
+    0x04, 0x82, 0x01, 0x81, 0x9D, 0x0C, 0x82, 0x80, 0x02, 0x89, 0x8F, 0x06, 0x8E, 0x01, 0x81, 0x22,
+    0x82, 0x8E, 0x03, 0x83, 0xB2, 0x08, 0x88, 0xC0, 0x0B, 0x80, 0x01, 0x84, 0x0E, 0x81, 0x96, 0x04,
+    0x01, 0x21, 0x00, 0x83, 0x08, 0x86, 0x9E, 0x08, 0x82, 0x8D, 0x04, 0x82, 0x01, 0x83, 0x91, 0x04,
+    0x82, 0xA8, 0x0C, 0x80, 0x19, 0x80, 0x0C, 0x8A, 0x96, 0x04, 0x83, 0xD0, 0x08, 0x82, 0x10, 0x00,
+    0x83, 0x10, 0x80, 0xC0, 0x07, 0x80, 0xEF, 0x0C, 0x85, 0xC4, 0x0C, 0xA1, 0x96, 0x04, 0x80, 0x7D,
+    0x00, 0x20, 0x00, 0x86, 0xBD, 0x01, 0x82, 0x8F, 0x01, 0x84, 0x98, 0x04, 0x80, 0xAF, 0x08, 0x81,
+    0xAA, 0x09, 0x80, 0xB5, 0x01, 0x00, 0x42, 0x08, 0x83, 0x4C, 0x80, 0x6C, 0x80, 0x05, 0x81, 0x98,
+    0x04, 0x82, 0x01, 0x82, 0x98, 0x04, 0x84, 0xC9, 0x0C, 0x80, 0x9A, 0x04, 0x80, 0x01, 0x00, 0xE5,
+    0x10, 0x82, 0x13, 0x00, 0xE5, 0x10, 0x80, 0xB7, 0x08, 0x80, 0x08, 0x00, 0xA4, 0x10, 0x90, 0x86,
+    0x05, 0x8F, 0xC2, 0x0C, 0x8B, 0x9A, 0x04, 0x8D, 0xBF, 0x0C, 0x83, 0xDD, 0x0E, 0x82, 0x8F, 0x04,
+    0x81, 0x9A, 0x04, 0x81, 0x09, 0x82, 0xC9, 0x0F, 0x80, 0xC2, 0x07, 0x80, 0xF7, 0x02, 0x02, 0xFF,
+    0xFF, 0xC7, 0x39, 0xB7, 0xB5, 0x80, 0xAE, 0x07, 0x05, 0x38, 0xC6, 0xDB, 0xDE, 0x51, 0x8C, 0x14,
+    0xA5, 0xF8, 0xBD, 0x72, 0x8C, 0x80, 0x61, 0x02, 0x86, 0x31, 0xFF, 0xFF, 0xD7, 0xBD, 0x81, 0xAA,
+    0x01, 0x01, 0x0C, 0x63, 0xDB, 0xDE, 0x81, 0x39, 0x82, 0x94, 0x03, 0x80, 0xE4, 0x07, 0x81, 0x63,
+    0x08, 0x66, 0x29, 0x9E, 0xF7, 0x8A, 0x4A, 0xA3, 0x10, 0xFF, 0xFF, 0xF7, 0xBD, 0xF3, 0x9C, 0x75,
+    0xAD, 0x59, 0xCE, 0x80, 0xB9, 0x03, 0x01, 0x38, 0xC6, 0xD3, 0x94, 0x80, 0x1D, 0x0B, 0xAB, 0x52,
+    0xBE, 0xF7, 0x82, 0x10, 0x6E, 0x6B, 0xFF, 0xFF, 0x35, 0xA5, 0x76, 0xB5, 0x18, 0xC6, 0x59, 0xCE,
+    0x04, 0x19, 0x62, 0x08, 0x5D, 0xEF, 0x80, 0x12, 0x80, 0xBB, 0x04, 0x80, 0xF6, 0x0F, 0x80, 0xC3,
+    0x01, 0x01, 0xDB, 0xDE, 0x0C, 0x63, 0x80, 0x48, 0x00, 0x7E, 0xEF, 0x80, 0x8D, 0x0C, 0x80, 0x83,
+    0x08, 0x03, 0x7D, 0xEF, 0x21, 0x00, 0x4E, 0x6B, 0x3D, 0xE7, 0x81, 0x76, 0x04, 0xC8, 0x31, 0xDF,
+    0xFF, 0xC4, 0x10, 0xE8, 0x39, 0xDF, 0xFF, 0x80, 0xFB, 0x08, 0x00, 0x42, 0x00, 0x81, 0xA8, 0x08,
+    0x81, 0x82, 0x07, 0x03, 0x00, 0x00, 0x0C, 0x5B, 0x9E, 0xF7, 0xC4, 0x10, 0x80, 0xF0, 0x07, 0x80,
+    0xA3, 0x04, 0x01, 0x00, 0x00, 0x4D, 0x63, 0x80, 0xFF, 0x03, 0x01, 0xD0, 0x7B, 0x5D, 0xEF, 0x80,
+    0x7C, 0x81, 0x79, 0x01, 0x59, 0xCE, 0x51, 0x8C, 0x80, 0x93, 0x04, 0x80, 0x11, 0x80, 0xF3, 0x04,
+    0x07, 0x1C, 0xE7, 0xAB, 0x52, 0x41, 0x08, 0x7D, 0xEF, 0x9A, 0xCE, 0x55, 0xA5, 0xD7, 0xBD, 0x59,
+    0xCE, 0x80, 0xE0, 0x08, 0x00, 0xB3, 0x94, 0x81, 0x8A, 0x04, 0x04, 0x05, 0x21, 0x7D, 0xEF, 0x45,
+    0x21, 0x08, 0x42, 0xDF, 0xFF, 0x80, 0x8E, 0x09, 0x80, 0x78, 0x06, 0x04, 0x21, 0xDF, 0xFF, 0x18,
+    0xC6, 0x34, 0xA5, 0xB6, 0xB5, 0x9A, 0xD6, 0x8A, 0x4A, 0x80, 0x0A, 0x80, 0xAE, 0x02, 0x80, 0x8D,
+    0x01, 0x10, 0xBA, 0xD6, 0x00, 0x00, 0x92, 0x94, 0x55, 0xAD, 0x61, 0x08, 0x3C, 0xE7, 0xE7, 0x39,
+    0x29, 0x42, 0xFF, 0xFF, 0xA3, 0x10, 0xA7, 0x31, 0xFF, 0xFF, 0x75, 0xAD, 0xB3, 0x94, 0x75, 0xAD,
+    0x7A, 0xCE, 0xE8, 0x39, 0x80, 0x8C, 0x04, 0x80, 0xB2, 0x04, 0x80, 0x23, 0x08, 0xFF, 0xFF, 0x38,
+    0xC6, 0x55, 0xA5, 0xB6, 0xB5, 0x59, 0xCE, 0x8A, 0x52, 0x00, 0x00, 0xB6, 0xB5, 0xB2, 0x94, 0x81,
+    0xED, 0x01, 0x86, 0x92, 0x0C, 0x83, 0xA6, 0x08, 0x81, 0x95, 0x0F, 0x82, 0xEB, 0x01, 0x82, 0x9E,
+    0x02, 0x84, 0xF1, 0x01, 0x92, 0x9B, 0x04, 0x80, 0x91, 0x04, 0x80, 0x2E, 0x84, 0xC3, 0x0C, 0x84,
+    0xA4, 0x08, 0x80, 0x38, 0x83, 0xD6, 0x0F, 0x82, 0x96, 0x0C, 0x82, 0x9C, 0x04, 0x81, 0xDA, 0x03,
+    0x80, 0xD9, 0x0F, 0x80, 0xFD, 0x03, 0x82, 0x93, 0x04, 0x83, 0x9D, 0x08, 0x83, 0x9A, 0x04, 0x82,
+    0x8E, 0x08, 0x82, 0xA9, 0x04, 0x81, 0xBC, 0x08, 0x85, 0xB8, 0x08, 0x84, 0x95, 0x04, 0x81, 0x0F,
+    0x82, 0x9B, 0x04, 0x82, 0x27, 0x82, 0xCB, 0x03, 0x80, 0xE7, 0x05, 0xA6, 0x01, 0x81, 0xAE, 0x08,
+    0x81, 0x06, 0x89, 0x95, 0x01, 0x83, 0xC9, 0x0C, 0x80, 0xD4, 0x05, 0x81, 0xAF, 0x01, 0x00, 0x62,
+    0x08, 0x80, 0x96, 0x04, 0x81, 0x60, 0x82, 0x76, 0x80, 0x53, 0x82, 0x98, 0x04, 0x81, 0xB1, 0x08,
+    0x82, 0xBE, 0x0C, 0x80, 0x88, 0x04, 0x82, 0xAE, 0x08, 0x82, 0x98, 0x04, 0x81, 0xC6, 0x0C, 0x01,
+    0xC4, 0x10, 0xC5, 0x10, 0x80, 0x05, 0x00, 0xC4, 0x10, 0x80, 0xAF, 0x0F, 0xA7, 0x6F, 0x81, 0xA8,
+    0x02, 0x86, 0x8C, 0x04, 0x82, 0x9A, 0x02, 0x80, 0x87, 0x03, 0x90, 0x9B, 0x04, 0x82, 0xA8, 0x02,
+    0x81, 0x1E, 0x01, 0x79, 0xCE, 0x10, 0x84, 0x80, 0x2D, 0x02, 0x55, 0xAD, 0x39, 0xC6, 0xDB, 0xDE,
+    0x80, 0xDF, 0x03, 0x03, 0x3C, 0xEF, 0x51, 0x8C, 0xA6, 0x31, 0xC7, 0x39, 0x80, 0xB2, 0x08, 0x80,
+    0xA9, 0x01, 0x02, 0xD3, 0x94, 0x3C, 0xE7, 0x96, 0xB5, 0x81, 0x40, 0x00, 0x14, 0xA5, 0x80, 0xFF,
+    0x07, 0x84, 0xDB, 0x0F, 0x00, 0xF8, 0xBD, 0x80, 0xB0, 0x08, 0x80, 0x01, 0x80, 0x92, 0x08, 0x01,
+    0xC3, 0x10, 0x08, 0x42, 0x80, 0xCD, 0x07, 0x01, 0xC7, 0x39, 0xA7, 0x31, 0x80, 0xFA, 0x0B, 0x01,
+    0x21, 0x00, 0x1C, 0xE7, 0x80, 0xCB, 0x0B, 0x80, 0xA5, 0x03, 0x80, 0x95, 0x03, 0x04, 0xF4, 0x9C,
+    0x7A, 0xCE, 0x08, 0x42, 0x09, 0x42, 0x86, 0x31, 0x80, 0xC5, 0x04, 0x02, 0xA7, 0x31, 0x7D, 0xEF,
+    0x05, 0x21, 0x80, 0x28, 0x01, 0xFB, 0xDE, 0x8E, 0x6B, 0x80, 0x13, 0x80, 0x94, 0x04, 0x80, 0xCA,
+    0x0B, 0x02, 0xCB, 0x52, 0xFC, 0xDE, 0x42, 0x08, 0x80, 0x50, 0x01, 0xB3, 0x94, 0x59, 0xCE, 0x80,
+    0xEB, 0x04, 0x80, 0xCF, 0x07, 0x80, 0x08, 0x80, 0xF4, 0x0B, 0x80, 0x83, 0x08, 0x00, 0x3C, 0xE7,
+    0x80, 0xB1, 0x01, 0x02, 0x46, 0x29, 0xBF, 0xF7, 0xC8, 0x39, 0x82, 0xC8, 0x0C, 0x80, 0xFE, 0x07,
+    0x00, 0x7A, 0xCE, 0x80, 0xE6, 0x02, 0x00, 0x3C, 0xE7, 0x81, 0x3B, 0x80, 0xFB, 0x04, 0x01, 0x00,
+    0x00, 0x35, 0xA5, 0x81, 0x1F, 0x80, 0x01, 0x01, 0x63, 0x08, 0x3C, 0xE7, 0x80, 0xF4, 0x03, 0x01,
+    0x3C, 0xE7, 0xEC, 0x5A, 0x80, 0x11, 0x01, 0x45, 0x29, 0x9E, 0xF7, 0x80, 0xB6, 0x0E, 0x01, 0xDF,
+    0xFF, 0x4D, 0x63, 0x80, 0x5B, 0x81, 0xFF, 0x07, 0x00, 0x39, 0xC6, 0x80, 0x9D, 0x05, 0x80, 0xF3,
+    0x04, 0x03, 0x1C, 0xE7, 0x00, 0x00, 0x6D, 0x6B, 0x5D, 0xEF, 0x82, 0xE9, 0x09, 0x80, 0x84, 0x04,
+    0x02, 0xAA, 0x52, 0x08, 0x42, 0xE8, 0x39, 0x80, 0x15, 0x82, 0xC0, 0x05, 0x80, 0x32, 0x80, 0xA4,
+    0x08, 0x02, 0x6E, 0x6B, 0xF7, 0xBD, 0x71, 0x8C, 0x80, 0x97, 0x01, 0x06, 0xF0, 0x7B, 0x3C, 0xE7,
+    0x00, 0x00, 0xCB, 0x5A, 0x7E, 0xF7, 0x29, 0x42, 0xE8, 0x39, 0x81, 0x87, 0x01, 0x01, 0x00, 0x00,
+    0xD7, 0xBD, 0x81, 0xE4, 0x04, 0x80, 0xC1, 0x04, 0x02, 0x6A, 0x4A, 0xC7, 0x39, 0x86, 0x29, 0x80,
+    0x80, 0x0E, 0x01, 0x21, 0x00, 0xBA, 0xD6, 0x80, 0xBB, 0x09, 0x83, 0xE7, 0x03, 0x83, 0xA6, 0x08,
+    0x81, 0xB9, 0x0C, 0x87, 0x88, 0x04, 0x86, 0xAC, 0x0E, 0x96, 0xB2, 0x08, 0x83, 0x99, 0x04, 0x82,
+    0xA1, 0x07, 0x83, 0x3A, 0x88, 0xB2, 0x08, 0x80, 0xDE, 0x03, 0x80, 0xD9, 0x0F, 0x80, 0x5F, 0x01,
+    0x42, 0x08, 0xC4, 0x10, 0x80, 0x88, 0x07, 0x80, 0x01, 0x84, 0x80, 0x04, 0x82, 0x91, 0x04, 0x83,
+    0xC8, 0x0C, 0x00, 0x83, 0x10, 0x83, 0xB6, 0x08, 0x83, 0x9C, 0x08, 0x82, 0x90, 0x04, 0x80, 0x18,
+    0x83, 0xC3, 0x08, 0x83, 0x97, 0x04, 0x83, 0xD7, 0x08, 0x80, 0xC7, 0x08, 0x81, 0xEF, 0x0F, 0xA6,
+    0xAD, 0x08, 0x83, 0x01, 0x80, 0xB0, 0x08, 0x8A, 0x9B, 0x01, 0x82, 0xC6, 0x01, 0x82, 0xB9, 0x01,
+    0x00, 0x41, 0x00, 0x80, 0x85, 0x01, 0x80, 0x53, 0x85, 0x8F, 0x05, 0x82, 0x54, 0x00, 0xE4, 0x18,
+    0x80, 0xAD, 0x0C, 0x02, 0x05, 0x19, 0x05, 0x21, 0x46, 0x21, 0x83, 0x98, 0x04, 0x80, 0x01, 0x80,
+    0x96, 0x04, 0x00, 0x26, 0x19, 0x82, 0xC8, 0x0C, 0x81, 0x98, 0x04, 0x80, 0xAF, 0x08, 0x00, 0xC5,
+    0x10, 0x99, 0x96, 0x04, 0x83, 0x9B, 0x06, 0x86, 0x0C, 0x8A, 0x16, 0x84, 0xFC, 0x03, 0x87, 0x90,
+    0x04, 0x86, 0x97, 0x04, 0x80, 0xAE, 0x08, 0x84, 0x98, 0x04, 0x81, 0x37, 0x02, 0xC3, 0x18, 0xDF,
+    0xFF, 0xAA, 0x52, 0x80, 0x2A, 0x02, 0x66, 0x29, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x8E, 0x0C, 0x01,
+    0x79, 0xCE, 0xB7, 0xBD, 0x80, 0xA7, 0x08, 0x04, 0xE3, 0x18, 0x21, 0x00, 0x41, 0x08, 0x76, 0xAD,
+    0x72, 0x8C, 0x80, 0xBF, 0x08, 0x00, 0x69, 0x4A, 0x80, 0x13, 0x00, 0xBA, 0xD6, 0x80, 0xA4, 0x03,
+    0x83, 0xBA, 0x04, 0x07, 0x00, 0x00, 0x8B, 0x52, 0xFF, 0xFF, 0x8F, 0x73, 0xA3, 0x10, 0x61, 0x08,
+    0x92, 0x94, 0x1C, 0xDF, 0x81, 0xD5, 0x08, 0x00, 0x8F, 0x73, 0x80, 0x16, 0x80, 0xCE, 0x0C, 0x80,
+    0x80, 0x04, 0x00, 0x86, 0x29, 0x80, 0x07, 0x00, 0x79, 0xCE, 0x80, 0x1D, 0x00, 0xAF, 0x73, 0x81,
+    0x8C, 0x08, 0x80, 0xE6, 0x0A, 0x02, 0x00, 0x00, 0x4E, 0x63, 0xDB, 0xDE, 0x81, 0x84, 0x02, 0x09,
+    0x59, 0xCE, 0x76, 0xAD, 0x20, 0x00, 0x82, 0x10, 0xF4, 0x9C, 0x7E, 0xEF, 0x83, 0x10, 0x00, 0x00,
+    0x52, 0x8C, 0xFB, 0xDE, 0x81, 0x51, 0x00, 0x59, 0xCE, 0x80, 0xB1, 0x03, 0x01, 0x2D, 0x63, 0xDF,
+    0xFF, 0x80, 0xB2, 0x04, 0x04, 0x29, 0x4A, 0x9E, 0xF7, 0xCC, 0x5A, 0x00, 0x00, 0x96, 0xAD, 0x81,
+    0xFA, 0x0C, 0x80, 0xCF, 0x0C, 0x00, 0x83, 0x08, 0x82, 0x6C, 0x06, 0x00, 0x00, 0x7A, 0xCE, 0xF4,
+    0x9C, 0x00, 0x00, 0x87, 0x31, 0xDF, 0xFF, 0xA7, 0x31, 0x80, 0x94, 0x01, 0x00, 0xBA, 0xD6, 0x80,
+    0xC4, 0x0C, 0x80, 0xEB, 0x08, 0x05, 0x87, 0x31, 0x01, 0x00, 0xA3, 0x10, 0x01, 0x00, 0xA7, 0x31,
+    0xBF, 0xFF, 0x80, 0x41, 0x04, 0xDB, 0xDE, 0x14, 0xA5, 0x20, 0x00, 0xA2, 0x10, 0xF4, 0x9C, 0x80,
+    0xBE, 0x08, 0x80, 0xF5, 0x08, 0x80, 0x50, 0x00, 0x41, 0x08, 0x80, 0xA4, 0x08, 0x00, 0x83, 0x10,
+    0x82, 0xFC, 0x08, 0x00, 0xB3, 0x94, 0x80, 0xB5, 0x04, 0x80, 0xEB, 0x0C, 0x00, 0x2D, 0x63, 0x80,
+    0x13, 0x00, 0x21, 0x00, 0x80, 0x70, 0x00, 0x8E, 0x73, 0x80, 0x0E, 0x80, 0x8F, 0x0B, 0x83, 0xB0,
+    0x01, 0x00, 0x1C, 0xE7, 0x80, 0xCC, 0x08, 0x80, 0xA7, 0x04, 0x00, 0x3C, 0xE7, 0x80, 0xE3, 0x0D,
+    0x00, 0x96, 0xB5, 0x80, 0x1D, 0x80, 0xAB, 0x01, 0x80, 0x25, 0x00, 0x41, 0x08, 0x80, 0x87, 0x01,
+    0x00, 0x21, 0x00, 0x80, 0x33, 0x01, 0x41, 0x08, 0x20, 0x00, 0x80, 0xD3, 0x08, 0x00, 0x4D, 0x6B,
+    0x80, 0x09, 0x80, 0x0C, 0x01, 0x45, 0x29, 0x5D, 0xEF, 0x80, 0xBD, 0x01, 0x84, 0x93, 0x0C, 0x83,
+    0x01, 0x8A, 0x93, 0x04, 0x83, 0xF0, 0x01, 0x92, 0xC2, 0x0C, 0x80, 0x91, 0x04, 0x82, 0x03, 0x82,
+    0x99, 0x04, 0x80, 0x01, 0x82, 0xA0, 0x07, 0x82, 0x04, 0x87, 0x9D, 0x04, 0x80, 0xAF, 0x08, 0x81,
+    0x97, 0x0B, 0x03, 0x42, 0x08, 0xA3, 0x10, 0xE5, 0x18, 0xC5, 0x10, 0x80, 0x80, 0x04, 0x82, 0xAD,
+    0x07, 0x85, 0xC2, 0x0C, 0x81, 0x81, 0x04, 0x8D, 0xD1, 0x0C, 0x85, 0x01, 0x82, 0x98, 0x04, 0x85,
+    0xB6, 0x04, 0x80, 0xF2, 0x0B, 0x81, 0xC3, 0x03, 0xA8, 0xAD, 0x08, 0x84, 0xA7, 0x03, 0x83, 0xA6,
+    0x07, 0x86, 0x96, 0x04, 0x80, 0xC8, 0x01, 0x81, 0xC1, 0x03, 0x80, 0x9C, 0x01, 0x81, 0x9B, 0x05,
+    0x83, 0xF8, 0x04, 0x80, 0x6F, 0x81, 0x55, 0x80, 0xA0, 0x05, 0x80, 0x56, 0x80, 0xB0, 0x08, 0x80,
+    0x97, 0x04, 0x01, 0x05, 0x19, 0x06, 0x21, 0x83, 0xAD, 0x08, 0x84, 0xAA, 0x08, 0x00, 0xC5, 0x10,
+    0x81, 0x94, 0x04, 0x80, 0x9F, 0x04, 0x00, 0x05, 0x19, 0xA6, 0x9B, 0x09, 0x8B, 0xD7, 0x0C, 0x89,
+    0xC2, 0x0C, 0x8A, 0x01, 0x84, 0xED, 0x02, 0x83, 0xBB, 0x02, 0x80, 0xF1, 0x07, 0x00, 0x59, 0xCE,
+    0x80, 0xEF, 0x02, 0x80, 0x01, 0x80, 0xCD, 0x0C, 0x80, 0x5F, 0x06, 0xA7, 0x31, 0x79, 0xCE, 0x59,
+    0xCE, 0xD7, 0xBD, 0xB3, 0x94, 0x41, 0x08, 0x10, 0x84, 0x81, 0x88, 0x07, 0x80, 0xA9, 0x0B, 0x80,
+    0xA2, 0x04, 0x02, 0xF0, 0x7B, 0xFC, 0xDE, 0x75, 0xAD, 0x80, 0x81, 0x08, 0x82, 0x25, 0x80, 0xC5,
+    0x0B, 0x03, 0xBB, 0xD6, 0x9A, 0xD6, 0xF8, 0xBD, 0x38, 0xC6, 0x80, 0x99, 0x03, 0x80, 0xCF, 0x03,
+    0x06, 0x1C, 0xDF, 0xF7, 0xBD, 0x34, 0xA5, 0x0C, 0x5B, 0x00, 0x00, 0x09, 0x42, 0xB6, 0xB5, 0x80,
+    0xAD, 0x07, 0x08, 0x62, 0x08, 0x39, 0xC6, 0x49, 0x4A, 0x00, 0x00, 0x82, 0x10, 0x75, 0xAD, 0xFB,
+    0xDE, 0x96, 0xB5, 0xF4, 0x9C, 0x80, 0xB7, 0x0C, 0x01, 0xCF, 0x73, 0x51, 0x84, 0x81, 0x72, 0x05,
+    0xC7, 0x31, 0xBB, 0xD6, 0xD7, 0xBD, 0xF4, 0x9C, 0x34, 0xA5, 0x15, 0xA5, 0x80, 0x08, 0x05, 0xE8,
+    0x39, 0x9A, 0xD6, 0xB7, 0xB5, 0x09, 0x42, 0x21, 0x00, 0x18, 0xC6, 0x81, 0xBD, 0x07, 0x02, 0x72,
+    0x8C, 0x9A, 0xD6, 0xF7, 0xBD, 0x81, 0x97, 0x0C, 0x01, 0x00, 0x00, 0xB7, 0xB5, 0x80, 0xC3, 0x0C,
+    0x01, 0x00, 0x00, 0x8E, 0x73, 0x80, 0xE6, 0x07, 0x82, 0x68, 0x01, 0x62, 0x08, 0x18, 0xC6, 0x80,
+    0xCF, 0x03, 0x01, 0x6A, 0x4A, 0x79, 0xCE, 0x80, 0xC8, 0x04, 0x02, 0x83, 0x10, 0x7A, 0xCE, 0x09,
+    0x42, 0x80, 0xF2, 0x02, 0x06, 0xB3, 0x94, 0x7A, 0xCE, 0x75, 0xAD, 0x92, 0x94, 0x21, 0x00, 0x8A,
+    0x52, 0xD7, 0xBD, 0x80, 0xD2, 0x04, 0x04, 0x4A, 0x4A, 0xBB, 0xD6, 0xD7, 0xB5, 0xB3, 0x94, 0x14,
+    0xA5, 0x81, 0x71, 0x03, 0x29, 0x42, 0x7A, 0xCE, 0x38, 0xC6, 0xD7, 0xBD, 0x80, 0x2C, 0x01, 0x66,
+    0x29, 0x79, 0xCE, 0x80, 0x9C, 0x04, 0x02, 0x00, 0x00, 0x76, 0xAD, 0xF0, 0x7B, 0x80, 0x04, 0x03,
+    0xCF, 0x7B, 0xDB, 0xDE, 0xD7, 0xB5, 0x72, 0x8C, 0x80, 0xE6, 0x04, 0x03, 0x6E, 0x6B, 0xDB, 0xDE,
+    0xF8, 0xBD, 0x55, 0xAD, 0x80, 0x35, 0x82, 0xA4, 0x01, 0x01, 0xE4, 0x18, 0x18, 0xC6, 0x80, 0xF9,
+    0x03, 0x02, 0x04, 0x21, 0x18, 0xC6, 0xAE, 0x73, 0x81, 0x1D, 0x00, 0xCF, 0x7B, 0x80, 0x04, 0x03,
+    0x2D, 0x63, 0x9A, 0xD6, 0xD7, 0xBD, 0xB6, 0xB5, 0x80, 0x87, 0x01, 0x03, 0x00, 0x00, 0x30, 0x84,
+    0xFC, 0xDE, 0x18, 0xBE, 0x80, 0xE6, 0x04, 0x06, 0xCB, 0x5A, 0x79, 0xCE, 0xB7, 0xB5, 0x55, 0xAD,
+    0xCB, 0x52, 0x00, 0x00, 0x49, 0x4A, 0x80, 0x4A, 0x83, 0x80, 0x06, 0x83, 0x03, 0x83, 0x09, 0x93,
+    0x8B, 0x04, 0x8E, 0x99, 0x04, 0x81, 0xA6, 0x08, 0x86, 0xC2, 0x0C, 0x88, 0xAA, 0x08, 0x83, 0xBC,
+    0x08, 0x81, 0x96, 0x04, 0x80, 0xC2, 0x0C, 0x80, 0xF9, 0x02, 0x81, 0xA7, 0x07, 0x83, 0x82, 0x04,
+    0x81, 0x08, 0x84, 0x0A, 0x82, 0xC4, 0x0C, 0x81, 0xD8, 0x0C, 0x85, 0xC2, 0x0C, 0x81, 0xA7, 0x04,
+    0x85, 0xA5, 0x08, 0x82, 0xAE, 0x04, 0x83, 0x01, 0x83, 0xAD, 0x08, 0x80, 0xC1, 0x09, 0xAC, 0x01,
+    0x81, 0xFC, 0x06, 0x85, 0x85, 0x0E, 0x00, 0x41, 0x08, 0x81, 0xEC, 0x09, 0x82, 0x11, 0x84, 0x8E,
+    0x01, 0x85, 0x5A, 0x84, 0x82, 0x01, 0x80, 0xB0, 0x08, 0x81, 0x9C, 0x08, 0x82, 0xAB, 0x08, 0x80,
+    0x93, 0x04, 0x00, 0x06, 0x19, 0x81, 0x9E, 0x04, 0x80, 0x98, 0x04, 0x00, 0xC5, 0x18, 0x80, 0x14,
+    0x04, 0x05, 0x19, 0x27, 0x21, 0x26, 0x19, 0xE5, 0x10, 0x83, 0x08, 0xAB, 0x9B, 0x09, 0x8A, 0x9A,
+    0x04, 0x82, 0xDA, 0x02, 0x84, 0x89, 0x04, 0x8A, 0xDD, 0x0A, 0x84, 0xC0, 0x02, 0x82, 0xA9, 0x05,
+    0x80, 0x83, 0x04, 0x82, 0xCF, 0x07, 0x83, 0xD1, 0x04, 0x01, 0x04, 0x21, 0x04, 0x21, 0x80, 0x66,
+    0x80, 0xFF, 0x06, 0x81, 0x0A, 0x80, 0xAE, 0x07, 0x80, 0x09, 0x00, 0xE3, 0x18, 0x80, 0x0D, 0x81,
+    0xD9, 0x08, 0x80, 0xDA, 0x08, 0x80, 0x0A, 0x02, 0x21, 0x00, 0xE4, 0x18, 0xE4, 0x20, 0x82, 0x8B,
+    0x0B, 0x80, 0x16, 0x01, 0x25, 0x21, 0xC3, 0x18, 0x85, 0xC1, 0x01, 0x00, 0x62, 0x08, 0x81, 0x9C,
+    0x0B, 0x80, 0xAE, 0x03, 0x01, 0x45, 0x29, 0x82, 0x10, 0x81, 0x0F, 0x83, 0xB9, 0x03, 0x01, 0x41,
+    0x08, 0x25, 0x21, 0x80, 0xD7, 0x04, 0x80, 0x0B, 0x80, 0xAD, 0x0C, 0x00, 0x42, 0x08, 0x80, 0x08,
+    0x81, 0xEA, 0x07, 0x81, 0xB6, 0x0C, 0x01, 0xC4, 0x18, 0x45, 0x21, 0x81, 0xF2, 0x0C, 0x81, 0x0B,
+    0x80, 0x90, 0x07, 0x80, 0xE7, 0x02, 0x81, 0x19, 0x81, 0x87, 0x03, 0x80, 0x07, 0x81, 0x98, 0x07,
+    0x80, 0x1A, 0x80, 0xF3, 0x01, 0x82, 0x6E, 0x01, 0xA3, 0x10, 0x05, 0x21, 0x80, 0x07, 0x81, 0x99,
+    0x06, 0x80, 0x3D, 0x00, 0x42, 0x00, 0x80, 0x09, 0x82, 0x97, 0x09, 0x80, 0x45, 0x00, 0xE4, 0x18,
+    0x80, 0xC2, 0x0D, 0x01, 0x01, 0x00, 0x41, 0x08, 0x81, 0x1C, 0x81, 0x34, 0x82, 0x6A, 0x00, 0x04,
+    0x21, 0x82, 0x62, 0x80, 0x70, 0x00, 0xC4, 0x18, 0x87, 0xC8, 0x05, 0x82, 0xFF, 0x01, 0x80, 0x05,
+    0x81, 0xB4, 0x0C, 0x81, 0x6D, 0x00, 0x24, 0x21, 0x81, 0x2C, 0x80, 0x0E, 0x00, 0xC3, 0x18, 0x81,
+    0xAD, 0x01, 0x80, 0x0F, 0x01, 0x04, 0x21, 0xA2, 0x10, 0x80, 0x05, 0x01, 0x41, 0x08, 0x21, 0x08,
+    0x85, 0xD9, 0x02, 0x86, 0xB7, 0x0E, 0x94, 0xB5, 0x0C, 0x81, 0x85, 0x01, 0x80, 0x74, 0x82, 0xA5,
+    0x08, 0x82, 0xC2, 0x01, 0x82, 0x04, 0x82, 0x9B, 0x04, 0x86, 0x8D, 0x04, 0x84, 0x01, 0x00, 0x63,
+    0x08, 0x80, 0xAA, 0x08, 0x81, 0xB0, 0x01, 0x80, 0x52, 0x01, 0x42, 0x08, 0xE4, 0x18, 0x80, 0xF9,
+    0x02, 0x84, 0x93, 0x04, 0x86, 0x05, 0x80, 0x99, 0x03, 0x82, 0x9B, 0x04, 0x83, 0x90, 0x04, 0x81,
+    0xB6, 0x08, 0x80, 0x99, 0x04, 0x82, 0x8A, 0x04, 0x81, 0xA2, 0x08, 0x85, 0xD6, 0x07, 0x81, 0xC6,
+    0x0C, 0x81, 0xAD, 0x04, 0x83, 0xC0, 0x04, 0xAD, 0xAD, 0x08, 0x85, 0x9A, 0x04, 0x80, 0x01, 0x80,
+    0x94, 0x04, 0x81, 0x96, 0x04, 0x82, 0x0D, 0x80, 0xDD, 0x02, 0x01, 0x82, 0x08, 0x82, 0x08, 0x81,
+    0x8B, 0x01, 0x00, 0x82, 0x08, 0x83, 0xAE, 0x08, 0x82, 0xAA, 0x0D, 0x80, 0x78, 0x81, 0x97, 0x04,
+    0x80, 0x02, 0x80, 0xA9, 0x05, 0x83, 0x99, 0x04, 0x84, 0x9E, 0x04, 0x82, 0x08, 0x03, 0x26, 0x19,
+    0x47, 0x21, 0x27, 0x21, 0xC5, 0x10, 0x81, 0xD1, 0x0E, 0x91, 0xF4, 0x03, 0x82, 0xCE, 0x07, 0x9F,
+    0x95, 0x04, 0x80, 0x89, 0x02, 0x86, 0xBE, 0x0C, 0x87, 0x98, 0x04, 0x81, 0x04, 0x81, 0xCA, 0x0C,
+    0x82, 0xF7, 0x03, 0x84, 0xC8, 0x02, 0x82, 0x47, 0x82, 0x87, 0x0F, 0x84, 0x9E, 0x04, 0x82, 0x94,
+    0x0D, 0x82, 0xF1, 0x03, 0x83, 0xED, 0x02, 0x80, 0xCA, 0x03, 0x80, 0x01, 0x83, 0xB6, 0x04, 0x83,
+    0x6C, 0x84, 0x97, 0x07, 0x82, 0x3C, 0x86, 0x0F, 0x88, 0xB5, 0x03, 0x83, 0x18, 0x82, 0xE4, 0x04,
+    0x80, 0x5C, 0x83, 0xA7, 0x0D, 0x80, 0x85, 0x03, 0x80, 0xFD, 0x02, 0x82, 0xC0, 0x0F, 0x81, 0x8B,
+    0x03, 0x82, 0x01, 0x00, 0x22, 0x00, 0x83, 0x04, 0x00, 0x43, 0x00, 0x82, 0x08, 0x80, 0xA7, 0x07,
+    0x80, 0x53, 0x80, 0x07, 0x80, 0x04, 0x81, 0x12, 0x85, 0x8C, 0x01, 0x82, 0x31, 0x83, 0xF2, 0x0B,
+    0x83, 0x3A, 0x82, 0x5C, 0x88, 0x06, 0x82, 0x01, 0x82, 0xBA, 0x02, 0x86, 0xA7, 0x01, 0x92, 0xF3,
+    0x01, 0x87, 0x87, 0x04, 0x85, 0xD0, 0x01, 0x89, 0x99, 0x0B, 0x83, 0xF4, 0x02, 0x83, 0x0A, 0x80,
+    0x8D, 0x01, 0x81, 0x98, 0x08, 0x81, 0x7D, 0x83, 0xA1, 0x08, 0x81, 0x06, 0x83, 0x99, 0x04, 0x83,
+    0x92, 0x04, 0x82, 0x8F, 0x04, 0x86, 0x98, 0x04, 0x82, 0xC2, 0x0C, 0x81, 0x96, 0x04, 0x83, 0xA1,
+    0x08, 0x81, 0x80, 0x04, 0x85, 0xAF, 0x08, 0x84, 0xE4, 0x0F, 0x85, 0xC0, 0x08, 0x82, 0xC3, 0x0C,
+    0x84, 0xA5, 0x08, 0x81, 0xA0, 0x04, 0x83, 0xBC, 0x03, 0x82, 0xCD, 0x0C, 0x81, 0x22, 0x80, 0xC6,
+    0x0C, 0xAF, 0xAD, 0x08, 0x81, 0x01, 0x8A, 0x96, 0x04, 0x80, 0x0A, 0x83, 0x91, 0x01, 0x80, 0x95,
+    0x04, 0x82, 0x57, 0x83, 0x83, 0x09, 0x84, 0x81, 0x01, 0x80, 0x86, 0x04, 0x81, 0xB1, 0x08, 0x81,
+    0xB3, 0x08, 0x01, 0x05, 0x19, 0x26, 0x21, 0x81, 0x9A, 0x01, 0x81, 0xA1, 0x04, 0x80, 0x01, 0x03,
+    0x26, 0x21, 0x47, 0x21, 0x67, 0x21, 0x06, 0x19, 0x96, 0xAD, 0x08, 0x8F, 0x98, 0x04, 0x86, 0xB0,
+    0x06, 0x86, 0x0C, 0x82, 0x01, 0x83, 0x98, 0x04, 0x85, 0xC3, 0x06, 0x86, 0x09, 0x80, 0x94, 0x03,
+    0x84, 0x86, 0x0F, 0x82, 0x9E, 0x03, 0x87, 0xB2, 0x04, 0x86, 0x27, 0x86, 0xE7, 0x0C, 0x83, 0x01,
+    0x80, 0x22, 0x81, 0x9B, 0x04, 0x82, 0x32, 0x86, 0xFA, 0x02, 0x81, 0xD8, 0x03, 0x81, 0xAB, 0x04,
+    0x83, 0x05, 0x84, 0xB6, 0x04, 0x87, 0x19, 0x85, 0x0B, 0x82, 0x08, 0x81, 0x33, 0x89, 0xCD, 0x0B,
+    0x82, 0x43, 0x82, 0x97, 0x04, 0x87, 0x01, 0x82, 0x98, 0x03, 0x01, 0x43, 0x08, 0x43, 0x08, 0x81,
+    0xA3, 0x03, 0x80, 0x88, 0x03, 0x00, 0x63, 0x08, 0x82, 0x04, 0x80, 0x8E, 0x03, 0x84, 0xAA, 0x03,
+    0x87, 0x01, 0x83, 0xCE, 0x03, 0x84, 0xD4, 0x03, 0x88, 0x01, 0x84, 0x8E, 0x08, 0x87, 0xDA, 0x01,
+    0x88, 0xFD, 0x01, 0x96, 0x9F, 0x08, 0x82, 0x43, 0x81, 0xA8, 0x09, 0x81, 0x92, 0x04, 0x82, 0xAA,
+    0x0C, 0x87, 0xAE, 0x0C, 0x87, 0x0D, 0x84, 0xA3, 0x04, 0x86, 0xB2, 0x0B, 0x83, 0x9D, 0x04, 0x81,
+    0xE9, 0x02, 0x01, 0x41, 0x08, 0xE4, 0x18, 0x82, 0xFC, 0x02, 0x83, 0xA5, 0x08, 0x82, 0x95, 0x03,
+    0x85, 0xC7, 0x0C, 0x86, 0x9C, 0x04, 0x84, 0x07, 0x81, 0xCD, 0x0C, 0x85, 0xBD, 0x0C, 0x82, 0xA4,
+    0x04, 0x83, 0xC4, 0x03, 0x01, 0xC4, 0x10, 0xE4, 0x18, 0x80, 0xD2, 0x07, 0x01, 0xC4, 0x18, 0x82,
+    0x10, 0xB0, 0x96, 0x04, 0x83, 0x97, 0x04, 0x81, 0xBA, 0x05, 0x84, 0x0B, 0x80, 0x9E, 0x04, 0x84,
+    0xA5, 0x01, 0x83, 0x99, 0x04, 0x80, 0xEC, 0x04, 0x82, 0x97, 0x04, 0x81, 0x04, 0x82, 0xAF, 0x08,
+    0x80, 0x60, 0x83, 0x8F, 0x04, 0x80, 0xC0, 0x0C, 0x80, 0xE0, 0x0D, 0x81, 0x9F, 0x01, 0x80, 0xA0,
+    0x04, 0x02, 0x47, 0x21, 0x47, 0x21, 0xC5, 0x10, 0x99, 0xC3, 0x0C, 0x87, 0xBF, 0x06, 0x83, 0xD4,
+    0x07, 0x85, 0xD5, 0x07, 0x83, 0xF1, 0x07, 0x89, 0x88, 0x04, 0x87, 0x98, 0x04, 0x80, 0xA4, 0x02,
+    0x88, 0x86, 0x04, 0x84, 0x06, 0x81, 0xB6, 0x06, 0x89, 0xB6, 0x04, 0x85, 0xFE, 0x02, 0x85, 0x0A,
+    0x81, 0x93, 0x04, 0x82, 0x06, 0x82, 0x14, 0x88, 0xF3, 0x03, 0x82, 0xE2, 0x03, 0x87, 0x05, 0x82,
+    0x06, 0x82, 0xEB, 0x0C, 0x84, 0x18, 0x83, 0x91, 0x04, 0x84, 0xAB, 0x04, 0x84, 0x0D, 0x86, 0xCF,
+    0x03, 0x83, 0xBE, 0x07, 0x85, 0x9B, 0x04, 0x8A, 0xCA, 0x04, 0x88, 0xCE, 0x03, 0x89, 0xDD, 0x04,
+    0x96, 0xE2, 0x03, 0x84, 0x48, 0x86, 0xD6, 0x01, 0x86, 0x3C, 0x82, 0x10, 0x88, 0x98, 0x04, 0x8E,
+    0xA0, 0x04, 0x84, 0xD9, 0x04, 0x81, 0xC7, 0x01, 0x85, 0x94, 0x04, 0x84, 0x06, 0x82, 0xD2, 0x03,
+    0x85, 0xA0, 0x08, 0x84, 0xA4, 0x08, 0x00, 0x63, 0x08, 0x81, 0x94, 0x04, 0x83, 0x9A, 0x04, 0x00,
+    0x42, 0x00, 0x81, 0x96, 0x04, 0x01, 0xC4, 0x18, 0x05, 0x21, 0x80, 0xC2, 0x0C, 0x82, 0xBC, 0x0B,
+    0x81, 0x01, 0x82, 0xAE, 0x08, 0x00, 0xC4, 0x10, 0x80, 0x88, 0x03, 0x86, 0x98, 0x04, 0x80, 0x9B,
+    0x03, 0x88, 0xA4, 0x04, 0x83, 0xD4, 0x0C, 0x82, 0xCF, 0x07, 0x82, 0xA8, 0x08, 0x80, 0x29, 0x81,
+    0x31, 0x80, 0x1F, 0x80, 0xD3, 0x07, 0xB1, 0xAD, 0x08, 0x80, 0x01, 0x00, 0x20, 0x00, 0x81, 0xA3,
+    0x01, 0x80, 0xCC, 0x0F, 0x83, 0xA0, 0x04, 0x01, 0x41, 0x00, 0x41, 0x08, 0x80, 0x02, 0x80, 0x01,
+    0x83, 0x96, 0x01, 0x81, 0xC7, 0x0C, 0x81, 0x84, 0x09, 0x82, 0x94, 0x04, 0x81, 0x5A, 0x81, 0xA9,
+    0x09, 0x82, 0xC6, 0x0C, 0x81, 0x01, 0x00, 0xE4, 0x18, 0x81, 0xAD, 0x08, 0x81, 0x89, 0x01, 0x04,
+    0x05, 0x19, 0x67, 0x21, 0x67, 0x29, 0x26, 0x21, 0x83, 0x08, 0x8D, 0x8A, 0x04, 0x9A, 0x64, 0x84,
+    0xAF, 0x08, 0x81, 0x24, 0x88, 0xC3, 0x06, 0x84, 0xD6, 0x0A, 0x89, 0xB2, 0x08, 0x87, 0xAA, 0x03,
+    0x83, 0x88, 0x03, 0x87, 0x19, 0x83, 0xBA, 0x03, 0x83, 0x05, 0x84, 0xC5, 0x03, 0x87, 0xA5, 0x03,
+    0x85, 0x1F, 0x84, 0x11, 0x85, 0x9A, 0x04, 0x84, 0x9A, 0x0C, 0x86, 0xB8, 0x08, 0x91, 0x01, 0x85,
+    0x2B, 0x83, 0xB0, 0x0D, 0x88, 0xFC, 0x08, 0x82, 0x30, 0x82, 0xA5, 0x07, 0x85, 0x37, 0x84, 0x63,
+    0x81, 0x1E, 0x84, 0xF4, 0x0F, 0x85, 0xAA, 0x04, 0x82, 0x18, 0x86, 0xA6, 0x05, 0x8A, 0xA6, 0x04,
+    0x88, 0xAA, 0x01, 0x85, 0xAE, 0x08, 0x86, 0x32, 0x86, 0xBE, 0x08, 0x88, 0x8A, 0x04, 0x88, 0x51,
+    0x86, 0xBA, 0x01, 0x80, 0x89, 0x07, 0x87, 0xAF, 0x08, 0x81, 0x01, 0x82, 0xF8, 0x0B, 0x83, 0x8A,
+    0x0C, 0x82, 0x07, 0x00, 0x83, 0x10, 0x82, 0x98, 0x04, 0x82, 0x9E, 0x04, 0x00, 0x42, 0x08, 0x80,
+    0xB7, 0x02, 0x80, 0x96, 0x04, 0x01, 0x26, 0x21, 0x05, 0x19, 0x85, 0xAC, 0x0C, 0x84, 0x01, 0x80,
+    0x9F, 0x07, 0x80, 0x98, 0x04, 0x81, 0x04, 0x00, 0xC5, 0x18, 0x89, 0xB3, 0x08, 0x87, 0xC3, 0x08,
+    0x82, 0xCB, 0x07, 0x84, 0xEA, 0x0B, 0x82, 0xBB, 0x03, 0x80, 0xFC, 0x0C, 0x00, 0x83, 0x10, 0xB2,
+    0x96, 0x04, 0x81, 0x90, 0x04, 0x82, 0x95, 0x04, 0x82, 0x97, 0x04, 0x84, 0xF3, 0x0D, 0x81, 0x01,
+    0x82, 0xA8, 0x01, 0x00, 0x82, 0x08, 0x81, 0x99, 0x01, 0x84, 0xC6, 0x0C, 0x80, 0x5B, 0x80, 0x8E,
+    0x04, 0x81, 0x01, 0x81, 0x95, 0x04, 0x81, 0x99, 0x05, 0x82, 0xB6, 0x08, 0x80, 0x6A, 0x03, 0x67,
+    0x29, 0x88, 0x29, 0x47, 0x21, 0xC4, 0x10, 0x9B, 0xAD, 0x08, 0x92, 0x15, 0x82, 0xC1, 0x06, 0x82,
+    0x1C, 0x82, 0x9F, 0x02, 0x82, 0xE3, 0x02, 0x8F, 0xB8, 0x08, 0x86, 0xC6, 0x02, 0x85, 0xF6, 0x03,
+    0x84, 0xD7, 0x0F, 0x82, 0x2E, 0x82, 0x2F, 0x81, 0x06, 0x81, 0x1A, 0x82, 0x05, 0x87, 0xD7, 0x02,
+    0x86, 0x86, 0x08, 0x85, 0xB8, 0x0C, 0x82, 0xA6, 0x08, 0x80, 0x02, 0x01, 0x43, 0x00, 0x43, 0x00,
+    0x96, 0x95, 0x04, 0x00, 0x43, 0x00, 0x81, 0x47, 0x87, 0x9A, 0x04, 0x81, 0x5E, 0x85, 0xA2, 0x04,
+    0x83, 0x83, 0x05, 0x82, 0x5B, 0x80, 0x0C, 0x84, 0xE7, 0x0F, 0x85, 0xF5, 0x08, 0x85, 0x63, 0x84,
+    0xC1, 0x03, 0x86, 0x93, 0x05, 0x84, 0xBD, 0x05, 0x8D, 0x01, 0x88, 0x96, 0x08, 0x87, 0xCB, 0x05,
+    0x87, 0xCE, 0x04, 0x8F, 0x2D, 0x86, 0x76, 0x82, 0x0B, 0x81, 0xF1, 0x02, 0x81, 0xD0, 0x0C, 0x82,
+    0xBE, 0x0D, 0x87, 0x9A, 0x04, 0x81, 0xA7, 0x08, 0x80, 0xFB, 0x0B, 0x83, 0xC5, 0x0F, 0x80, 0x94,
+    0x04, 0x84, 0xBE, 0x08, 0x00, 0x42, 0x08, 0x80, 0xB4, 0x02, 0x83, 0x96, 0x04, 0x00, 0x83, 0x08,
+    0x88, 0xF7, 0x03, 0x83, 0x09, 0x80, 0x04, 0x84, 0xAA, 0x07, 0x84, 0x11, 0x83, 0x12, 0x89, 0xB7,
+    0x08, 0x80, 0x0D, 0x80, 0xB2, 0x08, 0x80, 0x32, 0x81, 0x96, 0x04, 0x01, 0x25, 0x21, 0xE4, 0x18,
+    0xB3, 0xAD, 0x08, 0x8B, 0xB8, 0x03, 0x83, 0xD9, 0x05, 0x85, 0xCA, 0x0C, 0x00, 0x82, 0x08, 0x81,
+    0xCA, 0x0C, 0x83, 0xF6, 0x04, 0x81, 0xF4, 0x04, 0x81, 0x96, 0x04, 0x00, 0x05, 0x19, 0x80, 0x90,
+    0x04, 0x80, 0x02, 0x83, 0xB8, 0x08, 0x80, 0x07, 0x04, 0x46, 0x21, 0x67, 0x29, 0x87, 0x29, 0x26,
+    0x21, 0x62, 0x08, 0x9C, 0x4C, 0x91, 0x99, 0x04, 0x8A, 0xFD, 0x03, 0x80, 0x83, 0x06, 0x83, 0xC6,
+    0x02, 0x83, 0xBB, 0x02, 0x8C, 0x98, 0x04, 0x80, 0xB3, 0x0A, 0x83, 0xCA, 0x07, 0x84, 0xE5, 0x02,
+    0x80, 0xE7, 0x0A, 0x00, 0x63, 0x08, 0x82, 0xC1, 0x03, 0x82, 0xFF, 0x03, 0x85, 0x2F, 0x8A, 0xCF,
+    0x0B, 0x85, 0xA2, 0x08, 0x88, 0xF9, 0x03, 0x83, 0xF0, 0x07, 0x80, 0xFE, 0x03, 0x82, 0x13, 0x84,
+    0x03, 0x9A, 0x01, 0x81, 0x56, 0x85, 0xCC, 0x04, 0x83, 0x9B, 0x08, 0x84, 0xBD, 0x0D, 0x81, 0x0F,
+    0x81, 0xA7, 0x03, 0x85, 0xBC, 0x04, 0x87, 0xD3, 0x07, 0x88, 0x6E, 0x85, 0xED, 0x03, 0x8C, 0x1A,
+    0x8E, 0xA5, 0x04, 0x8F, 0x8B, 0x04, 0x8A, 0x01, 0x82, 0xFC, 0x06, 0x82, 0x80, 0x05, 0x87, 0x01,
+    0x83, 0x96, 0x04, 0x88, 0x98, 0x04, 0x80, 0xA1, 0x08, 0x83, 0x9B, 0x04, 0x82, 0xD6, 0x03, 0x83,
+    0x01, 0x81, 0x96, 0x04, 0x03, 0x21, 0x00, 0xA3, 0x10, 0x25, 0x21, 0x26, 0x21, 0x80, 0xC3, 0x0C,
+    0x82, 0x0D, 0x82, 0x82, 0x08, 0x8A, 0xFC, 0x03, 0x81, 0x01, 0x81, 0xAD, 0x07, 0x84, 0xB4, 0x08,
+    0x87, 0xAE, 0x04, 0x84, 0xDA, 0x0C, 0x82, 0x99, 0x04, 0x81, 0x11, 0x02, 0x05, 0x21, 0x46, 0x21,
+    0xC3, 0x18, 0x93, 0xA0, 0x03, 0xAF, 0x9B, 0x04, 0x82, 0xC9, 0x0C, 0x81, 0xEF, 0x0D, 0x85, 0xC9,
+    0x0C, 0x82, 0x97, 0x04, 0x81, 0x96, 0x04, 0x81, 0xB0, 0x08, 0x81, 0x96, 0x04, 0x84, 0x01, 0x05,
+    0x05, 0x19, 0x25, 0x21, 0x46, 0x29, 0x67, 0x29, 0x46, 0x21, 0xA4, 0x10, 0x9E, 0x59, 0x87, 0x20,
+    0x80, 0x09, 0x80, 0x54, 0x84, 0x0F, 0x81, 0x04, 0x80, 0xB2, 0x03, 0x8A, 0xC7, 0x0C, 0x8B, 0xC5,
+    0x0C, 0x86, 0x0C, 0x82, 0xB1, 0x03, 0x80, 0xAC, 0x02, 0x85, 0xB0, 0x04, 0x81, 0x98, 0x04, 0x82,
+    0x0B, 0x86, 0xDE, 0x0C, 0x85, 0x06, 0x86, 0x09, 0x87, 0xA7, 0x08, 0x86, 0x97, 0x04, 0x83, 0x05,
+    0x80, 0xB0, 0x08, 0x84, 0x9A, 0x04, 0x9D, 0x98, 0x04, 0x82, 0xEE, 0x04, 0x83, 0xCB, 0x04, 0x83,
+    0x98, 0x04, 0x87, 0x16, 0x82, 0x01, 0x82, 0xF6, 0x08, 0x89, 0xF1, 0x04, 0x86, 0x83, 0x04, 0x89,
+    0x22, 0x84, 0x0D, 0x9A, 0xFF, 0x03, 0x8A, 0x01, 0x83, 0xE3, 0x09, 0x80, 0xD3, 0x02, 0x8B, 0x14,
+    0x83, 0x93, 0x0B, 0x80, 0xE8, 0x02, 0x80, 0x82, 0x04, 0x87, 0xA0, 0x04, 0x82, 0x0D, 0x82, 0x12,
+    0x87, 0xB6, 0x08, 0x82, 0xCB, 0x0C, 0x00, 0x62, 0x08, 0x80, 0xBC, 0x02, 0x80, 0x96, 0x04, 0x00,
+    0x05, 0x21, 0x80, 0x96, 0x04, 0x83, 0x81, 0x04, 0x81, 0xEA, 0x03, 0x80, 0x15, 0x83, 0xFE, 0x03,
+    0x80, 0x8C, 0x03, 0x00, 0x05, 0x19, 0x82, 0xA8, 0x08, 0x83, 0x82, 0x04, 0x80, 0xCB, 0x0C, 0x89,
+    0x99, 0x04, 0x81, 0xC2, 0x0C, 0x85, 0xB7, 0x04, 0x81, 0x08, 0x80, 0xC6, 0x07, 0x02, 0x05, 0x19,
+    0x26, 0x21, 0x05, 0x21, 0x94, 0xC0, 0x07, 0x99, 0xEC, 0x0B, 0x94, 0x01, 0x82, 0xC1, 0x01, 0x80,
+    0x01, 0x84, 0xB6, 0x01, 0x00, 0x62, 0x08, 0x80, 0xA0, 0x05, 0x83, 0xB0, 0x08, 0x80, 0x95, 0x04,
+    0x82, 0xB1, 0x08, 0x80, 0x05, 0x81, 0x95, 0x09, 0x80, 0x8E, 0x01, 0x80, 0x96, 0x04, 0x02, 0x66,
+    0x29, 0x46, 0x29, 0xC4, 0x18, 0xAB, 0x9A, 0x09, 0x81, 0xC7, 0x03, 0x82, 0xBD, 0x0C, 0x83, 0xF6,
+    0x03, 0x88, 0xAC, 0x0C, 0x8A, 0xA4, 0x08, 0x80, 0x6E, 0x8B, 0x0F, 0x80, 0xC9, 0x02, 0x80, 0x8B,
+    0x0C, 0x84, 0x96, 0x07, 0x80, 0xC1, 0x07, 0x00, 0x42, 0x00, 0x82, 0x99, 0x04, 0x83, 0x2E, 0x84,
+    0x89, 0x04, 0x82, 0x92, 0x03, 0x86, 0xB2, 0x07, 0x84, 0x07, 0x88, 0x9E, 0x04, 0x85, 0x8F, 0x04,
+    0x81, 0x01, 0x85, 0x9A, 0x04, 0x85, 0x16, 0x81, 0x05, 0x81, 0xDC, 0x0C, 0x89, 0xAA, 0x04, 0x8A,
+    0xE3, 0x08, 0x8D, 0xC0, 0x04, 0x84, 0x56, 0x82, 0x15, 0x81, 0xD0, 0x0C, 0x83, 0x80, 0x09, 0x85,
+    0x4A, 0x89, 0x84, 0x05, 0x84, 0xD1, 0x04, 0x80, 0xD6, 0x08, 0x87, 0xE5, 0x03, 0x83, 0xDE, 0x0D,
+    0x81, 0xB7, 0x02, 0x81, 0xC9, 0x01, 0x81, 0x16, 0x82, 0x37, 0x85, 0x91, 0x04, 0x82, 0xBC, 0x01,
+    0x82, 0x90, 0x08, 0x83, 0x48, 0x86, 0x2E, 0x00, 0x41, 0x00, 0x80, 0x01, 0x84, 0x08, 0x81, 0x8C,
+    0x04, 0x82, 0xAE, 0x0C, 0x82, 0xA0, 0x04, 0x81, 0xB6, 0x08, 0x82, 0x98, 0x04, 0x83, 0xAD, 0x08,
+    0x84, 0x08, 0x80, 0x03, 0x80, 0x9A, 0x04, 0x00, 0x63, 0x08, 0x82, 0x96, 0x04, 0x80, 0xDC, 0x03,
+    0x81, 0x91, 0x04, 0x82, 0x82, 0x08, 0x84, 0xB5, 0x0C, 0x81, 0x0B, 0x84, 0xB7, 0x0C, 0x83, 0x0F,
+    0x80, 0x93, 0x04, 0x80, 0xE4, 0x0F, 0x84, 0xA1, 0x04, 0x00, 0xE4, 0x18, 0x82, 0xC9, 0x08, 0x81,
+    0x96, 0x04, 0x84, 0x98, 0x04, 0x81, 0x0C, 0x81, 0xAE, 0x03, 0x00, 0x46, 0x21, 0x80, 0xAA, 0x03,
+    0xAE, 0x80, 0x04, 0x99, 0xC7, 0x03, 0x80, 0xAF, 0x08, 0x85, 0xB0, 0x08, 0x81, 0xC9, 0x0C, 0x81,
+    0xBB, 0x09, 0x81, 0x01, 0x83, 0x66, 0x82, 0x01, 0x80, 0x98, 0x04, 0x80, 0xBC, 0x05, 0x01, 0x46,
+    0x29, 0xE5, 0x18, 0x9C, 0xC3, 0x0C, 0x80, 0x01, 0x80, 0xDA, 0x02, 0x82, 0x05, 0x88, 0xB2, 0x08,
+    0x83, 0x01, 0x80, 0xCA, 0x02, 0x82, 0x97, 0x04, 0x84, 0x0D, 0x83, 0x86, 0x04, 0x88, 0xD8, 0x0C,
+    0x81, 0x96, 0x08, 0x87, 0x98, 0x04, 0x80, 0x8F, 0x03, 0x82, 0xB9, 0x0C, 0x88, 0xAB, 0x0B, 0x81,
+    0x82, 0x03, 0x87, 0x97, 0x0B, 0x81, 0xAD, 0x03, 0x82, 0x11, 0x82, 0xD9, 0x0C, 0x85, 0xB7, 0x04,
+    0x84, 0xA7, 0x04, 0x87, 0xD1, 0x0C, 0x86, 0xC1, 0x0C, 0x81, 0xB3, 0x08, 0x81, 0xB5, 0x08, 0x84,
+    0x8C, 0x04, 0x01, 0x02, 0x00, 0x02, 0x00, 0x81, 0x56, 0x00, 0x02, 0x00, 0x80, 0x08, 0x00, 0x23,
+    0x00, 0x82, 0x0D, 0x84, 0x13, 0x89, 0x01, 0x01, 0x43, 0x08, 0x84, 0x08, 0x8F, 0x13, 0x89, 0xA9,
+    0x04, 0x81, 0xD4, 0x0C, 0x83, 0x03, 0x81, 0xB4, 0x03, 0x87, 0xF3, 0x04, 0x85, 0xE5, 0x03, 0x82,
+    0xAF, 0x04, 0x87, 0x90, 0x08, 0x83, 0x17, 0x82, 0x19, 0x80, 0x29, 0x81, 0x16, 0x83, 0x89, 0x04,
+    0x82, 0xFF, 0x03, 0x81, 0x90, 0x0F, 0x86, 0xAC, 0x0C, 0x83, 0x01, 0x83, 0x8D, 0x04, 0x85, 0xC2,
+    0x04, 0x84, 0x39, 0x80, 0x9B, 0x04, 0x81, 0x84, 0x04, 0x82, 0x01, 0x84, 0xA3, 0x08, 0x81, 0x08,
+    0x83, 0x0B, 0x80, 0x05, 0x82, 0xB5, 0x0C, 0x80, 0x92, 0x06, 0x82, 0xAC, 0x08, 0x80, 0x99, 0x08,
+    0x85, 0xA1, 0x0C, 0x82, 0x9C, 0x08, 0x84, 0x8B, 0x04, 0x85, 0x9A, 0x08, 0x85, 0x10, 0x83, 0x14,
+    0x83, 0x8C, 0x04, 0x82, 0x02, 0x82, 0xB2, 0x08, 0x84, 0xD4, 0x08, 0x80, 0xAD, 0x08, 0x01, 0x46,
+    0x29, 0x05, 0x21, 0x81, 0x85, 0x0D, 0xC8, 0x01, 0x80, 0xEE, 0x02, 0x00, 0x41, 0x00, 0x82, 0xA6,
+    0x01, 0x00, 0x82, 0x08, 0x82, 0xC8, 0x09, 0x81, 0xCB, 0x0C, 0x80, 0x05, 0x80, 0xCE, 0x0C, 0x84,
+    0x86, 0x05, 0x80, 0x97, 0x04, 0x00, 0x05, 0x21, 0x80, 0xAE, 0x08, 0x01, 0x05, 0x21, 0x83, 0x10,
+    0x98, 0xC3, 0x0C, 0x8B, 0x1A, 0x84, 0x0D, 0x89, 0x87, 0x08, 0x89, 0x93, 0x08, 0x8A, 0x01, 0x83,
+    0xDE, 0x03, 0x87, 0x0E, 0x80, 0xDB, 0x02, 0x84, 0xD9, 0x08, 0x83, 0xA2, 0x08, 0x84, 0xFA, 0x02,
+    0x82, 0x08, 0x8B, 0xB6, 0x0B, 0x87, 0xAF, 0x08, 0x84, 0xE3, 0x0B, 0x85, 0xC4, 0x07, 0x00, 0x63,
+    0x00, 0x84, 0xE0, 0x07, 0x81, 0xAB, 0x08, 0x82, 0x94, 0x04, 0x80, 0x01, 0x81, 0x85, 0x04, 0x82,
+    0x83, 0x01, 0x05, 0x22, 0x00, 0xC4, 0x10, 0x46, 0x29, 0x87, 0x29, 0x46, 0x29, 0xA3, 0x10, 0x80,
+    0x0A, 0x00, 0x02, 0x00, 0x82, 0x81, 0x04, 0x81, 0x16, 0x80, 0xA0, 0x04, 0x00, 0x23, 0x00, 0x83,
+    0x1D, 0x82, 0x0F, 0x81, 0x8E, 0x09, 0x80, 0x98, 0x04, 0x84, 0x18, 0x81, 0x07, 0x82, 0xC2, 0x04,
+    0x84, 0xB4, 0x01, 0x87, 0xBC, 0x08, 0x81, 0x9A, 0x04, 0x81, 0xE9, 0x0B, 0x82, 0xA9, 0x03, 0x80,
+    0x04, 0x85, 0xBA, 0x08, 0x84, 0xAC, 0x04, 0x82, 0xB8, 0x06, 0x82, 0xEE, 0x03, 0x84, 0xAC, 0x04,
+    0x85, 0xD8, 0x08, 0x85, 0x9A, 0x05, 0x83, 0xAA, 0x04, 0x81, 0x23, 0x82, 0x20, 0x82, 0x94, 0x04,
+    0x83, 0x99, 0x04, 0x85, 0x9F, 0x04, 0x80, 0xAD, 0x04, 0x81, 0x04, 0x86, 0xC8, 0x04, 0x80, 0x10,
+    0x80, 0xB9, 0x08, 0x80, 0x9A, 0x04, 0x82, 0xF7, 0x04, 0x81, 0x89, 0x04, 0x83, 0x03, 0x82, 0xA8,
+    0x08, 0x82, 0x9D, 0x04, 0x82, 0x97, 0x04, 0x82, 0x96, 0x04, 0x00, 0x25, 0x21, 0x82, 0xAC, 0x08,
+    0x82, 0x88, 0x08, 0x83, 0x96, 0x04, 0x85, 0x9B, 0x04, 0x00, 0xC5, 0x18, 0x82, 0xB7, 0x08, 0x86,
+    0xB7, 0x0C, 0x86, 0xAE, 0x04, 0x80, 0x9B, 0x04, 0x84, 0x10, 0x81, 0x97, 0x04, 0x84, 0xE3, 0x0B,
+    0x80, 0xD9, 0x0B, 0x01, 0x26, 0x21, 0xA3, 0x10, 0x9B, 0xA0, 0x03, 0xAB, 0x93, 0x04, 0x88, 0xDA,
+    0x0B, 0x01, 0x62, 0x08, 0x82, 0x10, 0x83, 0x96, 0x04, 0x81, 0x65, 0x81, 0xA0, 0x04, 0x81, 0xB3,
+    0x08, 0x82, 0x80, 0x01, 0x80, 0xAD, 0x08, 0x01, 0x25, 0x21, 0xC4, 0x10, 0xA7, 0x9A, 0x0D, 0x81,
+    0x91, 0x08, 0x88, 0x50, 0x85, 0xC1, 0x0C, 0x92, 0x97, 0x04, 0x84, 0xE4, 0x03, 0x84, 0x0C, 0x00,
+    0x83, 0x10, 0x80, 0xD1, 0x0C, 0x81, 0xEF, 0x03, 0x82, 0xF1, 0x03, 0x84, 0xE3, 0x08, 0x84, 0xB9,
+    0x0C, 0x83, 0x98, 0x04, 0x8E, 0x96, 0x04, 0x88, 0xC5, 0x0B, 0x80, 0xD6, 0x03, 0x82, 0x8D, 0x03,
+    0x89, 0xE6, 0x07, 0x83, 0xB0, 0x08, 0x80, 0x0F, 0x80, 0x7F, 0x06, 0xA4, 0x10, 0x6A, 0x4A, 0x71,
+    0x8C, 0xF7, 0xBD, 0xBB, 0xDE, 0xDB, 0xDE, 0x1C, 0xE7, 0x81, 0x01, 0x01, 0x59, 0xCE, 0x2D, 0x63,
+    0x80, 0x38, 0x81, 0x8D, 0x04, 0x00, 0x23, 0x00, 0x80, 0x01, 0x83, 0xCC, 0x08, 0x82, 0x98, 0x04,
+    0x81, 0x05, 0x84, 0xC2, 0x04, 0x80, 0xAA, 0x04, 0x80, 0x91, 0x04, 0x83, 0x8E, 0x04, 0x80, 0x9D,
+    0x07, 0x06, 0x66, 0x29, 0xC7, 0x39, 0x08, 0x42, 0x49, 0x4A, 0x8A, 0x52, 0x49, 0x4A, 0x05, 0x21,
+    0x81, 0x7A, 0x81, 0xE2, 0x08, 0x84, 0xBB, 0x08, 0x82, 0xF7, 0x04, 0x84, 0xC6, 0x03, 0x83, 0xD9,
+    0x03, 0x86, 0xC9, 0x08, 0x83, 0xF1, 0x0B, 0x82, 0x11, 0x84, 0x83, 0x0C, 0x81, 0xAA, 0x08, 0x81,
+    0x09, 0x82, 0x12, 0x84, 0x15, 0x81, 0x17, 0x81, 0x3C, 0x84, 0xAD, 0x04, 0x82, 0x3E, 0x84, 0x1A,
+    0x82, 0x88, 0x0B, 0x82, 0xCC, 0x08, 0x80, 0x9A, 0x04, 0x80, 0x02, 0x83, 0xAC, 0x04, 0x84, 0xE9,
+    0x0C, 0x00, 0x41, 0x08, 0x81, 0xD9, 0x08, 0x81, 0x91, 0x04, 0x82, 0x98, 0x04, 0x82, 0x01, 0x80,
+    0x08, 0x80, 0xF8, 0x02, 0x01, 0x62, 0x08, 0x41, 0x00, 0x80, 0x91, 0x01, 0x00, 0x82, 0x10, 0x80,
+    0xEF, 0x02, 0x00, 0x05, 0x19, 0x85, 0x91, 0x07, 0x84, 0x8F, 0x08, 0x83, 0x9F, 0x04, 0x83, 0x94,
+    0x04, 0x00, 0xC5, 0x18, 0x81, 0x9C, 0x04, 0x00, 0xC5, 0x18, 0x84, 0x9E, 0x08, 0x81, 0x15, 0x80,
+    0x0B, 0x82, 0x17, 0x80, 0xC9, 0x0C, 0x85, 0xAB, 0x04, 0x81, 0xDD, 0x0B, 0x80, 0x0E, 0x02, 0x05,
+    0x21, 0x46, 0x29, 0xE4, 0x18, 0xAB, 0xED, 0x0F, 0xA2, 0x9C, 0x04, 0x83, 0xEF, 0x02, 0x80, 0xAA,
+    0x01, 0x80, 0xC7, 0x0C, 0x83, 0x97, 0x04, 0x83, 0x01, 0x80, 0xA0, 0x01, 0x81, 0x83, 0x05, 0x02,
+    0x05, 0x21, 0x05, 0x21, 0xE4, 0x18, 0xA0, 0x99, 0x09, 0x83, 0xF4, 0x06, 0x82, 0xE4, 0x03, 0x81,
+    0xF3, 0x01, 0x83, 0x9B, 0x04, 0x81, 0xE3, 0x03, 0x80, 0x9A, 0x0D, 0x00, 0x41, 0x08, 0x86, 0xC3,
+    0x0C, 0x8E, 0x95, 0x04, 0x84, 0x05, 0x84, 0x9A, 0x04, 0x80, 0xC9, 0x02, 0x80, 0x82, 0x05, 0x85,
+    0xC1, 0x04, 0x85, 0x81, 0x04, 0x83, 0xEF, 0x0F, 0x82, 0x93, 0x04, 0x89, 0xAE, 0x08, 0x84, 0x99,
+    0x04, 0x81, 0xD2, 0x02, 0x85, 0xB2, 0x0F, 0x80, 0xFE, 0x02, 0x00, 0x63, 0x00, 0x81, 0xAB, 0x08,
+    0x85, 0xB7, 0x08, 0x84, 0x98, 0x04, 0x82, 0x01, 0x80, 0x70, 0x0F, 0x29, 0x42, 0x96, 0xB5, 0x9E,
+    0xF7, 0x7D, 0xEF, 0x18, 0xC6, 0x51, 0x8C, 0xCB, 0x5A, 0xD0, 0x7B, 0xC7, 0x31, 0xE4, 0x18, 0x45,
+    0x21, 0xE8, 0x39, 0x72, 0x8C, 0xFF, 0xFF, 0x18, 0xC6, 0xC4, 0x18, 0x80, 0xB2, 0x08, 0x80, 0x95,
+    0x04, 0x86, 0x98, 0x04, 0x81, 0x01, 0x00, 0x63, 0x00, 0x80, 0x82, 0x03, 0x81, 0xDC, 0x08, 0x82,
+    0xD4, 0x08, 0x0B, 0x01, 0x00, 0xC4, 0x18, 0xC8, 0x39, 0x0C, 0x63, 0x51, 0x8C, 0x14, 0x9D, 0xD7,
+    0xBD, 0xFB, 0xDE, 0x7D, 0xEF, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0x82, 0x01, 0x01, 0xBE, 0xF7,
+    0x25, 0x21, 0x80, 0x13, 0x00, 0x42, 0x08, 0x80, 0x8E, 0x01, 0x84, 0x84, 0x04, 0x83, 0x63, 0x83,
+    0xD4, 0x03, 0x84, 0xED, 0x0B, 0x81, 0xF4, 0x03, 0x87, 0x64, 0x84, 0xF6, 0x03, 0x83, 0xCB, 0x08,
+    0x83, 0xF8, 0x03, 0x80, 0x22, 0x83, 0x25, 0x84, 0x9E, 0x04, 0x81, 0xD1, 0x0C, 0x86, 0x22, 0x82,
+    0xBA, 0x04, 0x84, 0x99, 0x04, 0x81, 0xFF, 0x03, 0x83, 0x21, 0x81, 0xD1, 0x0C, 0x81, 0xC4, 0x01,
+    0x83, 0xC7, 0x08, 0x87, 0xF5, 0x04, 0x00, 0x62, 0x08, 0x82, 0xA6, 0x08, 0x81, 0x9D, 0x04, 0x80,
+    0x85, 0x02, 0x00, 0x63, 0x08, 0x81, 0x96, 0x04, 0x01, 0x42, 0x08, 0xE4, 0x18, 0x80, 0x96, 0x04,
+    0x87, 0xE9, 0x03, 0x93, 0x01, 0x82, 0xAE, 0x04, 0x8A, 0x1F, 0x80, 0xE7, 0x0F, 0x83, 0xBF, 0x04,
+    0x80, 0x0F, 0x80, 0xAC, 0x08, 0x80, 0xAD, 0x08, 0x01, 0x25, 0x21, 0x83, 0x10, 0x82, 0x8D, 0x03,
+    0x00, 0x20, 0x00, 0xCA, 0x97, 0x04, 0x86, 0x91, 0x07, 0x01, 0x42, 0x08, 0x83, 0x08, 0x82, 0xAD,
+    0x08, 0x85, 0x99, 0x04, 0x80, 0x6D, 0x80, 0xC4, 0x0C, 0x00, 0x05, 0x19, 0x83, 0x6C, 0xA3, 0x45,
+    0x81, 0xDF, 0x03, 0x83, 0xEC, 0x03, 0x83, 0x50, 0x80, 0x98, 0x04, 0x00, 0xA2, 0x10, 0x81, 0x98,
+    0x04, 0x8A, 0xCE, 0x0C, 0x89, 0xFE, 0x03, 0x84, 0x92, 0x08, 0x85, 0xF0, 0x0E, 0x83, 0xF5, 0x03,
+    0x84, 0xDC, 0x0C, 0x80, 0xFB, 0x02, 0x83, 0x81, 0x04, 0x83, 0xF1, 0x03, 0x89, 0x2B, 0x87, 0x31,
+    0x87, 0xB4, 0x03, 0x80, 0x29, 0x80, 0xE0, 0x03, 0x86, 0x91, 0x04, 0x86, 0x9A, 0x04, 0x80, 0xF1,
+    0x03, 0x06, 0x00, 0x00, 0x87, 0x31, 0x18, 0xC6, 0xBE, 0xF7, 0xB6, 0xB5, 0xCB, 0x5A, 0xC3, 0x10,
+    0x81, 0xE0, 0x02, 0x01, 0x3C, 0xE7, 0xF4, 0x9C, 0x82, 0xAC, 0x05, 0x02, 0xA7, 0x31, 0xDF, 0xFF,
+    0x96, 0xB5, 0x80, 0xB1, 0x08, 0x81, 0x01, 0x82, 0x98, 0x04, 0x00, 0x63, 0x00, 0x85, 0x99, 0x04,
+    0x02, 0x64, 0x08, 0x63, 0x08, 0x22, 0x00, 0x80, 0x20, 0x04, 0x05, 0x21, 0x0D, 0x63, 0xF4, 0x9C,
+    0xBA, 0xD6, 0xBE, 0xF7, 0x80, 0x8C, 0x04, 0x00, 0x9E, 0xF7, 0x80, 0x93, 0x04, 0x08, 0xCF, 0x7B,
+    0xEC, 0x5A, 0x4A, 0x4A, 0xE8, 0x39, 0xC8, 0x31, 0xA7, 0x31, 0x87, 0x31, 0x49, 0x4A, 0x96, 0xB5,
+    0x80, 0xC3, 0x04, 0x05, 0x00, 0x00, 0x10, 0x84, 0xBB, 0xD6, 0x4A, 0x4A, 0x01, 0x00, 0xA4, 0x08,
+    0x86, 0xE9, 0x04, 0x84, 0xA1, 0x01, 0x81, 0x93, 0x08, 0x80, 0x01, 0x81, 0xCA, 0x07, 0x82, 0xD3,
+    0x07, 0x82, 0xA3, 0x0C, 0x8A, 0x01, 0x83, 0xB3, 0x0C, 0x84, 0x83, 0x08, 0x82, 0x95, 0x0C, 0x81,
+    0xA0, 0x04, 0x84, 0xCD, 0x08, 0x83, 0xF5, 0x0C, 0x83, 0x04, 0x87, 0x81, 0x04, 0x82, 0x9B, 0x04,
+    0x86, 0x21, 0x8C, 0x01, 0x83, 0x5F, 0x82, 0x01, 0x81, 0xFD, 0x06, 0x02, 0x41, 0x08, 0xC4, 0x18,
+    0x05, 0x19, 0x80, 0x98, 0x08, 0x80, 0xA1, 0x04, 0x83, 0xF3, 0x03, 0x85, 0xAE, 0x0C, 0x00, 0xC5,
+    0x18, 0x80, 0xC7, 0x0F, 0x84, 0xC1, 0x0C, 0x89, 0x9A, 0x04, 0x80, 0x14, 0x82, 0xC6, 0x08, 0x8B,
+    0xBE, 0x04, 0x82, 0xD4, 0x0C, 0x80, 0xAB, 0x03, 0x00, 0xC4, 0x18, 0x87, 0xD7, 0x0B, 0x82, 0x09,
+    0x86, 0x0D, 0x81, 0x9D, 0x07, 0xB5, 0x95, 0x04, 0x88, 0xD3, 0x03, 0x82, 0xF4, 0x02, 0x80, 0xA8,
+    0x01, 0x81, 0xC3, 0x0C, 0x81, 0x9A, 0x04, 0x80, 0x06, 0x80, 0x94, 0x01, 0x00, 0x05, 0x21, 0x80,
+    0xD4, 0x09, 0x9F, 0xC3, 0x0C, 0x81, 0x3C, 0x86, 0x48, 0x85, 0x87, 0x04, 0x82, 0x98, 0x04, 0x81,
+    0x49, 0x80, 0x9D, 0x06, 0x82, 0x96, 0x0C, 0x84, 0x8B, 0x04, 0x86, 0xD5, 0x0C, 0x82, 0x0D, 0x81,
+    0xF4, 0x02, 0x87, 0xF3, 0x03, 0x81, 0x89, 0x04, 0x82, 0x1A, 0x86, 0x22, 0x80, 0xA5, 0x04, 0x86,
+    0x90, 0x03, 0x86, 0x86, 0x04, 0x82, 0x0D, 0x84, 0x1F, 0x83, 0xDE, 0x0B, 0x85, 0xD0, 0x04, 0x82,
+    0x87, 0x04, 0x81, 0x6F, 0x80, 0x5D, 0x86, 0xB1, 0x08, 0x82, 0x9E, 0x04, 0x04, 0x43, 0x00, 0x00,
+    0x00, 0xCC, 0x5A, 0xDF, 0xFF, 0x55, 0xAD, 0x80, 0xF6, 0x07, 0x81, 0x17, 0x04, 0x00, 0x00, 0x31,
+    0x84, 0xFF, 0xFF, 0x92, 0x94, 0x00, 0x00, 0x81, 0x16, 0x06, 0x00, 0x00, 0x52, 0x8C, 0xFF, 0xFF,
+    0x87, 0x29, 0x02, 0x00, 0x84, 0x08, 0x44, 0x00, 0x81, 0x8F, 0x04, 0x00, 0x64, 0x00, 0x87, 0x99,
+    0x04, 0x80, 0xCF, 0x04, 0x02, 0x01, 0x00, 0xEC, 0x5A, 0x59, 0xCE, 0x80, 0x93, 0x04, 0x07, 0xFB,
+    0xDE, 0x55, 0xAD, 0x8E, 0x73, 0x29, 0x42, 0x25, 0x21, 0x82, 0x08, 0x7A, 0xCE, 0x9A, 0xD6, 0x83,
+    0xB9, 0x01, 0x81, 0xB3, 0x01, 0x81, 0x03, 0x04, 0x83, 0x10, 0x7D, 0xEF, 0xFF, 0xFF, 0xCB, 0x52,
+    0x00, 0x00, 0x82, 0x9F, 0x0D, 0x85, 0x9E, 0x0D, 0x87, 0xA4, 0x0D, 0x81, 0xCF, 0x03, 0x83, 0x99,
+    0x04, 0x81, 0xD8, 0x07, 0x81, 0xF7, 0x07, 0x86, 0x97, 0x04, 0x82, 0x82, 0x08, 0x85, 0x9F, 0x04,
+    0x83, 0xF0, 0x03, 0x83, 0x23, 0x81, 0xFD, 0x03, 0x81, 0x22, 0x83, 0xFC, 0x0C, 0x85, 0x98, 0x04,
+    0x87, 0xD1, 0x0C, 0x82, 0x9B, 0x04, 0x83, 0x42, 0x84, 0xDC, 0x08, 0x83, 0xD1, 0x08, 0x83, 0x0D,
+    0x82, 0xCD, 0x0C, 0x83, 0x96, 0x04, 0x80, 0x9B, 0x0B, 0x80, 0xF2, 0x03, 0x80, 0xA5, 0x0B, 0x82,
+    0xC6, 0x0C, 0x82, 0xEF, 0x03, 0x82, 0xB2, 0x0C, 0x81, 0x05, 0x81, 0x9F, 0x0C, 0x84, 0x01, 0x83,
+    0xFD, 0x03, 0x82, 0xBE, 0x0C, 0x85, 0x01, 0x86, 0x9A, 0x04, 0x81, 0x01, 0x00, 0xE5, 0x18, 0x80,
+    0xD0, 0x04, 0x03, 0x05, 0x19, 0x46, 0x21, 0x25, 0x21, 0x82, 0x10, 0x94, 0xA0, 0x03, 0x86, 0xC1,
+    0x03, 0x81, 0xC6, 0x02, 0xAE, 0x9A, 0x04, 0x8C, 0xBF, 0x0F, 0x80, 0xD2, 0x01, 0x83, 0x9B, 0x04,
+    0x00, 0xA3, 0x10, 0x81, 0xAB, 0x05, 0x00, 0xC4, 0x10, 0xA0, 0xC3, 0x0C, 0x80, 0x3D, 0x85, 0x70,
+    0x84, 0xDE, 0x02, 0x82, 0xF7, 0x07, 0x83, 0x0C, 0x85, 0x9E, 0x08, 0x82, 0xF7, 0x07, 0x84, 0xF6,
+    0x04, 0x83, 0x06, 0x83, 0x13, 0x84, 0xA2, 0x08, 0x83, 0x05, 0x83, 0x98, 0x04, 0x83, 0x9B, 0x04,
+    0x85, 0x9B, 0x05, 0x85, 0x83, 0x01, 0x88, 0xEE, 0x03, 0x8B, 0x14, 0x87, 0xAC, 0x04, 0x81, 0x03,
+    0x04, 0xA3, 0x10, 0x2D, 0x63, 0x25, 0x21, 0x21, 0x00, 0x63, 0x08, 0x87, 0xBC, 0x03, 0x81, 0x01,
+    0x03, 0x01, 0x00, 0x46, 0x29, 0xBF, 0xFF, 0x8E, 0x73, 0x81, 0x8F, 0x01, 0x81, 0x09, 0x03, 0xA4,
+    0x10, 0x7D, 0xEF, 0x1C, 0xE7, 0x62, 0x08, 0x81, 0x93, 0x05, 0x80, 0x98, 0x04, 0x04, 0x8B, 0x52,
+    0xFF, 0xFF, 0xEC, 0x5A, 0x01, 0x00, 0x64, 0x08, 0x88, 0xC5, 0x0C, 0x82, 0x0B, 0x06, 0x23, 0x00,
+    0x83, 0x08, 0x76, 0xB5, 0xFF, 0xFF, 0x38, 0xC6, 0x6D, 0x6B, 0x46, 0x29, 0x83, 0xB4, 0x01, 0x03,
+    0x4A, 0x4A, 0xFF, 0xFF, 0xCB, 0x5A, 0x00, 0x00, 0x80, 0xAF, 0x04, 0x81, 0xDC, 0x03, 0x82, 0xBF,
+    0x05, 0x05, 0x00, 0x00, 0x8E, 0x73, 0xFF, 0xFF, 0x96, 0xAD, 0x00, 0x00, 0x02, 0x00, 0x81, 0x0B,
+    0x84, 0x03, 0x87, 0xB8, 0x08, 0x84, 0x05, 0x82, 0xF8, 0x03, 0x80, 0xBF, 0x03, 0x81, 0xD8, 0x03,
+    0x83, 0x9C, 0x04, 0x84, 0x92, 0x04, 0x81, 0x95, 0x0D, 0x81, 0xCF, 0x0D, 0x80, 0x04, 0x85, 0xB4,
+    0x08, 0x85, 0x96, 0x08, 0x81, 0x95, 0x0C, 0x83, 0x20, 0x85, 0xF7, 0x0C, 0x83, 0xFC, 0x03, 0x86,
+    0xAA, 0x08, 0x86, 0xDE, 0x04, 0x81, 0x2B, 0x85, 0x31, 0x84, 0x1E, 0x80, 0x8E, 0x01, 0x80, 0x96,
+    0x04, 0x82, 0xC2, 0x0C, 0x81, 0xEF, 0x03, 0x81, 0xF5, 0x02, 0x83, 0xF6, 0x03, 0x88, 0xA0, 0x08,
+    0x86, 0x99, 0x04, 0x82, 0x19, 0x81, 0x82, 0x04, 0x80, 0x10, 0x84, 0xBC, 0x0C, 0x87, 0x9F, 0x04,
+    0x82, 0xB1, 0x04, 0x02, 0x05, 0x21, 0x46, 0x21, 0xE4, 0x18, 0xAF, 0xF6, 0x03, 0xAF, 0x99, 0x04,
+    0x81, 0xDC, 0x0B, 0x80, 0xE1, 0x01, 0x81, 0xCA, 0x0D, 0x01, 0xA3, 0x10, 0x62, 0x08, 0x9B, 0x6C,
+    0x86, 0xA7, 0x08, 0x83, 0xB0, 0x08, 0x82, 0xD9, 0x03, 0x83, 0x0C, 0x85, 0xE2, 0x03, 0x85, 0x9E,
+    0x08, 0x84, 0x9F, 0x0C, 0x84, 0xF3, 0x03, 0x81, 0xA7, 0x08, 0x87, 0xCA, 0x0C, 0x83, 0xA0, 0x04,
+    0x86, 0xFE, 0x07, 0x87, 0x93, 0x08, 0x86, 0xB0, 0x0C, 0x89, 0x96, 0x03, 0x8B, 0x96, 0x01, 0x82,
+    0x91, 0x04, 0x82, 0xF1, 0x02, 0x81, 0xA8, 0x08, 0x80, 0x74, 0x03, 0xD0, 0x7B, 0xFF, 0xFF, 0x10,
+    0x7C, 0x00, 0x00, 0x87, 0xC0, 0x03, 0x82, 0xD5, 0x0C, 0x03, 0x00, 0x00, 0x0C, 0x63, 0xFF, 0xFF,
+    0x62, 0x08, 0x82, 0xA6, 0x08, 0x80, 0x88, 0x01, 0x00, 0xCF, 0x73, 0x80, 0x8F, 0x04, 0x82, 0xA0,
+    0x04, 0x80, 0x12, 0x02, 0x6E, 0x6B, 0xFF, 0xFF, 0x8B, 0x52, 0x81, 0xC9, 0x0C, 0x81, 0xAD, 0x08,
+    0x83, 0x01, 0x01, 0x64, 0x00, 0x64, 0x00, 0x80, 0x99, 0x04, 0x04, 0x44, 0x00, 0x01, 0x00, 0x4E,
+    0x63, 0xFF, 0xFF, 0xC8, 0x39, 0x83, 0xB6, 0x01, 0x81, 0x71, 0x01, 0x9A, 0xCE, 0xDB, 0xDE, 0x80,
+    0x26, 0x80, 0x17, 0x84, 0x8A, 0x0D, 0x04, 0x01, 0x00, 0x42, 0x08, 0x1C, 0xE7, 0xBE, 0xF7, 0x05,
+    0x21, 0x80, 0x3F, 0x80, 0x0D, 0x81, 0x4B, 0x8A, 0xEE, 0x04, 0x87, 0x87, 0x01, 0x82, 0xE8, 0x03,
+    0x83, 0xF7, 0x0B, 0x81, 0xCE, 0x0A, 0x00, 0x83, 0x10, 0x81, 0xDD, 0x03, 0x80, 0xC9, 0x0D, 0x80,
+    0x92, 0x04, 0x80, 0x02, 0x81, 0x57, 0x80, 0x06, 0x82, 0x89, 0x04, 0x83, 0xA7, 0x08, 0x86, 0x96,
+    0x08, 0x81, 0xFA, 0x0C, 0x83, 0xBB, 0x04, 0x83, 0xB5, 0x08, 0x82, 0xD1, 0x04, 0x82, 0x8B, 0x04,
+    0x81, 0x04, 0x83, 0x22, 0x82, 0x20, 0x82, 0xD8, 0x08, 0x84, 0x01, 0x81, 0x3D, 0x80, 0xCC, 0x01,
+    0x00, 0x21, 0x00, 0x80, 0x96, 0x04, 0x00, 0x26, 0x21, 0x80, 0xF7, 0x03, 0x83, 0x96, 0x0C, 0x81,
+    0xB8, 0x0C, 0x82, 0x98, 0x0C, 0x86, 0xA0, 0x0C, 0x87, 0x83, 0x04, 0x82, 0x09, 0x82, 0xB0, 0x08,
+    0x84, 0xA7, 0x04, 0x82, 0x0E, 0x83, 0xC6, 0x0C, 0x80, 0xA4, 0x04, 0x82, 0xAD, 0x08, 0x00, 0x26,
+    0x21, 0x96, 0xAD, 0x08, 0xBE, 0x01, 0x90, 0xCD, 0x0F, 0x80, 0x9B, 0x04, 0x80, 0xCB, 0x07, 0xAB,
+    0x41, 0x83, 0xA7, 0x04, 0x88, 0x8F, 0x04, 0x89, 0x01, 0x86, 0xE0, 0x03, 0x82, 0xF8, 0x06, 0x86,
+    0xB9, 0x04, 0x85, 0x12, 0x87, 0x8C, 0x08, 0x83, 0x0C, 0x84, 0x29, 0x86, 0x96, 0x08, 0x81, 0xEE,
+    0x03, 0x00, 0x43, 0x00, 0x85, 0x0F, 0x88, 0x26, 0x80, 0x9D, 0x04, 0x82, 0xB5, 0x03, 0x81, 0xA3,
+    0x09, 0x02, 0x42, 0x00, 0xFC, 0xDE, 0xBE, 0xF7, 0x80, 0xB4, 0x0C, 0x87, 0xC2, 0x04, 0x00, 0x63,
+    0x00, 0x82, 0xDA, 0x03, 0x02, 0xA3, 0x10, 0x96, 0xB5, 0x51, 0x84, 0x80, 0x5A, 0x81, 0x62, 0x01,
+    0x62, 0x08, 0x3C, 0xE7, 0x81, 0x9F, 0x0C, 0x82, 0xB8, 0x08, 0x04, 0x01, 0x00, 0x9A, 0xD6, 0x7E,
+    0xF7, 0xC4, 0x18, 0x02, 0x00, 0x85, 0x94, 0x04, 0x83, 0x06, 0x00, 0x84, 0x08, 0x80, 0x01, 0x04,
+    0x22, 0x00, 0xA7, 0x31, 0xBB, 0xD6, 0xCF, 0x7B, 0x04, 0x21, 0x81, 0x93, 0x01, 0x81, 0x43, 0x03,
+    0x6A, 0x4A, 0xFF, 0xFF, 0x4D, 0x6B, 0x00, 0x00, 0x81, 0xF2, 0x08, 0x84, 0x98, 0x04, 0x03, 0x00,
+    0x00, 0xEC, 0x5A, 0xFF, 0xFF, 0xF0, 0x7B, 0x82, 0xD6, 0x04, 0x02, 0x22, 0x00, 0x84, 0x08, 0x06,
+    0x19, 0x80, 0x78, 0x83, 0xEA, 0x07, 0x82, 0xA1, 0x04, 0x86, 0xA2, 0x04, 0x84, 0x7C, 0x84, 0xB3,
+    0x06, 0x81, 0x99, 0x04, 0x81, 0xE8, 0x0E, 0x80, 0x95, 0x03, 0x01, 0x83, 0x08, 0x84, 0x10, 0x80,
+    0xDF, 0x03, 0x84, 0x94, 0x08, 0x81, 0xA1, 0x04, 0x83, 0xC2, 0x0C, 0x86, 0x85, 0x08, 0x84, 0xFA,
+    0x03, 0x81, 0x88, 0x04, 0x82, 0xCB, 0x04, 0x83, 0xE2, 0x0C, 0x83, 0xAF, 0x0C, 0x85, 0x25, 0x87,
+    0x20, 0x84, 0x33, 0x80, 0x88, 0x01, 0x80, 0xB9, 0x01, 0x00, 0x05, 0x19, 0x81, 0xAC, 0x08, 0x82,
+    0xB8, 0x0C, 0x82, 0x01, 0x81, 0x07, 0x81, 0xCA, 0x0C, 0x83, 0x88, 0x04, 0x81, 0xC6, 0x0C, 0x83,
+    0x8E, 0x04, 0x00, 0xE4, 0x18, 0x86, 0x9D, 0x04, 0x82, 0x99, 0x04, 0x80, 0x94, 0x04, 0x80, 0x03,
+    0x80, 0x8B, 0x04, 0x82, 0x15, 0x82, 0x2E, 0x00, 0xC4, 0x18, 0x80, 0x3B, 0x02, 0x05, 0x19, 0x25,
+    0x21, 0x46, 0x29, 0x90, 0xAD, 0x08, 0x85, 0xB5, 0x07, 0xBE, 0x01, 0x84, 0xC7, 0x07, 0x83, 0x9D,
+    0x04, 0x00, 0x41, 0x00, 0x80, 0x01, 0x82, 0x9B, 0x06, 0x83, 0x86, 0x08, 0xA3, 0x3B, 0x85, 0x2A,
+    0x82, 0x85, 0x08, 0x88, 0x98, 0x04, 0x83, 0x93, 0x08, 0x85, 0x0B, 0x80, 0x80, 0x02, 0x83, 0xDC,
+    0x03, 0x82, 0x8D, 0x04, 0x87, 0x66, 0x85, 0x8E, 0x0C, 0x85, 0x8F, 0x05, 0x83, 0xA2, 0x07, 0x85,
+    0x97, 0x04, 0x89, 0xAE, 0x08, 0x83, 0x17, 0x00, 0xA4, 0x08, 0x83, 0x9C, 0x03, 0x84, 0xD6, 0x04,
+    0x83, 0x99, 0x04, 0x83, 0x39, 0x03, 0x00, 0x00, 0xCC, 0x5A, 0xFF, 0xFF, 0x51, 0x84, 0x88, 0xAF,
+    0x08, 0x84, 0x01, 0x80, 0x61, 0x00, 0x62, 0x08, 0x82, 0x24, 0x03, 0x00, 0x00, 0xAF, 0x73, 0xFF,
+    0xFF, 0x8A, 0x4A, 0x80, 0x89, 0x01, 0x80, 0xDD, 0x03, 0x80, 0x8E, 0x01, 0x03, 0x52, 0x8C, 0xFF,
+    0xFF, 0x4E, 0x6B, 0x00, 0x00, 0x82, 0x93, 0x04, 0x80, 0xAC, 0x0C, 0x84, 0xC8, 0x0C, 0x81, 0x0C,
+    0x01, 0x64, 0x08, 0x63, 0x00, 0x80, 0xE6, 0x0C, 0x01, 0x6A, 0x4A, 0x05, 0x21, 0x81, 0x8A, 0x01,
+    0x80, 0x2E, 0x02, 0x00, 0x00, 0x59, 0xCE, 0xFC, 0xDE, 0x80, 0xEE, 0x0C, 0x80, 0xFE, 0x05, 0x82,
+    0xED, 0x01, 0x81, 0x3C, 0x01, 0x21, 0x00, 0xBB, 0xD6, 0x81, 0xFC, 0x0C, 0x00, 0x01, 0x00, 0x81,
+    0x0B, 0x01, 0x63, 0x08, 0xA5, 0x10, 0x81, 0x28, 0x80, 0x95, 0x04, 0x81, 0xE0, 0x0C, 0x83, 0x80,
+    0x01, 0x87, 0x64, 0x86, 0x99, 0x05, 0x81, 0xD4, 0x0C, 0x83, 0xE8, 0x0E, 0x84, 0xC6, 0x03, 0x80,
+    0xE0, 0x03, 0x83, 0xD3, 0x0C, 0x00, 0x62, 0x00, 0x87, 0xF7, 0x03, 0x86, 0xB5, 0x08, 0x84, 0xB7,
+    0x08, 0x81, 0x07, 0x84, 0xC8, 0x08, 0x80, 0x06, 0x84, 0x15, 0x86, 0x01, 0x83, 0x1B, 0x81, 0xD7,
+    0x08, 0x81, 0xD1, 0x03, 0x00, 0x82, 0x08, 0x80, 0xEF, 0x07, 0x00, 0xE5, 0x18, 0x84, 0x4D, 0x86,
+    0x01, 0x01, 0xA3, 0x10, 0x83, 0x08, 0x82, 0x8B, 0x08, 0x84, 0xBA, 0x0C, 0x83, 0xC3, 0x08, 0x81,
+    0xC5, 0x08, 0x80, 0x91, 0x04, 0x87, 0xDC, 0x0C, 0x80, 0xA4, 0x08, 0x81, 0xAF, 0x04, 0x82, 0x13,
+    0x80, 0x08, 0x83, 0x96, 0x04, 0x01, 0x46, 0x29, 0xA3, 0x10, 0xC4, 0x85, 0x04, 0x92, 0xDB, 0x03,
+    0x81, 0xD3, 0x03, 0x88, 0xB0, 0x0B, 0x80, 0xCA, 0x01, 0xA3, 0xAC, 0x08, 0x85, 0xA3, 0x08, 0x81,
+    0x90, 0x03, 0x83, 0xAE, 0x08, 0x83, 0x8C, 0x04, 0x8C, 0xB2, 0x08, 0x85, 0xB1, 0x0C, 0x81, 0xF9,
+    0x0B, 0x85, 0x5E, 0x83, 0x0F, 0x82, 0x11, 0x85, 0xFE, 0x03, 0x84, 0xAA, 0x08, 0x90, 0x01, 0x80,
+    0x9A, 0x03, 0x87, 0x99, 0x04, 0x81, 0xA0, 0x03, 0x83, 0xC1, 0x04, 0x86, 0xCC, 0x08, 0x84, 0x48,
+    0x03, 0x21, 0x00, 0xBB, 0xDE, 0x5D, 0xEF, 0x42, 0x00, 0x80, 0x73, 0x80, 0x20, 0x81, 0x04, 0x81,
+    0x8A, 0x04, 0x83, 0xE9, 0x07, 0x82, 0x99, 0x04, 0x82, 0x05, 0x02, 0x83, 0x10, 0x9E, 0xF7, 0x7A,
+    0xCE, 0x80, 0x11, 0x81, 0xAD, 0x05, 0x03, 0x62, 0x08, 0xD3, 0x9C, 0xFF, 0xFF, 0x92, 0x94, 0x83,
+    0x8F, 0x01, 0x00, 0x63, 0x00, 0x80, 0x98, 0x05, 0x00, 0x01, 0x00, 0x80, 0xB7, 0x08, 0x00, 0x02,
+    0x00, 0x80, 0xD2, 0x0C, 0x00, 0x63, 0x00, 0x80, 0x01, 0x81, 0xCB, 0x0C, 0x80, 0x11, 0x00, 0x02,
+    0x00, 0x82, 0x5A, 0x81, 0xAF, 0x08, 0x80, 0xEE, 0x0C, 0x81, 0x2F, 0x83, 0xC3, 0x01, 0x80, 0x0E,
+    0x02, 0xAB, 0x52, 0xFF, 0xFF, 0x2D, 0x63, 0x82, 0xD2, 0x01, 0x00, 0x42, 0x00, 0x80, 0x27, 0x80,
+    0x28, 0x81, 0x51, 0x83, 0x88, 0x08, 0x82, 0xB0, 0x08, 0x82, 0xE3, 0x01, 0x82, 0xED, 0x04, 0x83,
+    0x53, 0x85, 0xE7, 0x09, 0x81, 0xA3, 0x02, 0x80, 0xFC, 0x03, 0x83, 0x9B, 0x04, 0x80, 0xAC, 0x03,
+    0x00, 0xC5, 0x10, 0x80, 0x9B, 0x04, 0x85, 0xFE, 0x03, 0x81, 0x96, 0x04, 0x83, 0xF2, 0x03, 0x82,
+    0x9E, 0x04, 0x82, 0x8A, 0x08, 0x83, 0x99, 0x04, 0x82, 0x9C, 0x04, 0x82, 0xAC, 0x04, 0x83, 0x85,
+    0x0D, 0x86, 0xAC, 0x04, 0x84, 0x94, 0x04, 0x80, 0xDD, 0x04, 0x82, 0x96, 0x04, 0x00, 0x62, 0x08,
+    0x80, 0xDC, 0x03, 0x85, 0xFF, 0x03, 0x81, 0xF0, 0x03, 0x81, 0xFB, 0x03, 0x88, 0x9E, 0x04, 0x84,
+    0xA0, 0x08, 0x82, 0x9D, 0x04, 0x82, 0x0B, 0x82, 0xC0, 0x0C, 0x81, 0xA3, 0x08, 0x85, 0x2B, 0x81,
+    0x28, 0x80, 0x1D, 0x01, 0x05, 0x19, 0x05, 0x21, 0x80, 0xFE, 0x0C, 0x04, 0x26, 0x21, 0x46, 0x29,
+    0x66, 0x29, 0xE4, 0x18, 0x41, 0x08, 0x9B, 0xA6, 0x03, 0xA7, 0xE1, 0x07, 0x91, 0x3B, 0x8B, 0x01,
+    0x00, 0x41, 0x00, 0x80, 0x95, 0x04, 0x9F, 0x96, 0x04, 0x85, 0xA3, 0x08, 0x83, 0x88, 0x04, 0x82,
+    0xCF, 0x02, 0x84, 0x15, 0x82, 0xE0, 0x04, 0x8A, 0x95, 0x04, 0x81, 0x81, 0x04, 0x83, 0x8A, 0x04,
+    0x84, 0x0D, 0x88, 0xB4, 0x0C, 0x84, 0x9C, 0x08, 0x86, 0x8C, 0x07, 0x83, 0x0C, 0x82, 0xAB, 0x03,
+    0x81, 0x11, 0x81, 0xAA, 0x07, 0x89, 0x1A, 0x85, 0x09, 0x81, 0x9E, 0x03, 0x81, 0xA0, 0x0C, 0x81,
+    0x96, 0x01, 0x88, 0x01, 0x81, 0xAF, 0x08, 0x03, 0x4D, 0x6B, 0x86, 0x31, 0x31, 0x8C, 0xE8, 0x39,
+    0x80, 0x73, 0x01, 0x8B, 0x52, 0xCC, 0x5A, 0x81, 0xD4, 0x03, 0x01, 0x2A, 0x42, 0x8F, 0x73, 0x85,
+    0x30, 0x82, 0x5E, 0x03, 0x00, 0x00, 0xF0, 0x83, 0xFF, 0xFF, 0x4A, 0x4A, 0x82, 0x9C, 0x01, 0x03,
+    0x0C, 0x63, 0x1C, 0xE7, 0xFF, 0xFF, 0xAE, 0x73, 0x80, 0x07, 0x02, 0xA3, 0x10, 0xD0, 0x7B, 0x76,
+    0xAD, 0x80, 0x1D, 0x07, 0x01, 0x00, 0xA8, 0x31, 0xF4, 0x9C, 0x87, 0x29, 0x00, 0x00, 0x46, 0x21,
+    0xCC, 0x5A, 0x06, 0x19, 0x83, 0xB6, 0x08, 0x82, 0xF6, 0x04, 0x83, 0x9F, 0x09, 0x02, 0xBA, 0xD6,
+    0xDB, 0xDE, 0x41, 0x00, 0x80, 0x56, 0x80, 0x98, 0x03, 0x03, 0x2D, 0x63, 0xF4, 0x9C, 0x93, 0x94,
+    0xC8, 0x31, 0x81, 0xF0, 0x04, 0x09, 0x9A, 0xD6, 0xFB, 0xDE, 0x00, 0x00, 0x41, 0x08, 0x31, 0x84,
+    0x9A, 0xD6, 0xC8, 0x39, 0x00, 0x00, 0xE5, 0x18, 0xD3, 0x9C, 0x80, 0xAE, 0x04, 0x02, 0xE5, 0x18,
+    0xD0, 0x7B, 0xEC, 0x5A, 0x81, 0xB0, 0x04, 0x80, 0xA4, 0x04, 0x80, 0xD1, 0x04, 0x80, 0x06, 0x03,
+    0xE8, 0x39, 0x10, 0x7C, 0x51, 0x8C, 0x49, 0x4A, 0x82, 0x70, 0x05, 0xB3, 0x94, 0xE4, 0x18, 0x00,
+    0x00, 0xE4, 0x18, 0x6A, 0x4A, 0x04, 0x19, 0x86, 0xF0, 0x09, 0x83, 0xA1, 0x0C, 0x80, 0xFB, 0x03,
+    0x84, 0xB6, 0x08, 0x81, 0xA7, 0x03, 0x81, 0xD3, 0x0C, 0x81, 0xFC, 0x03, 0x81, 0x80, 0x04, 0x85,
+    0x8A, 0x08, 0x84, 0x9C, 0x08, 0x84, 0x95, 0x08, 0x01, 0x84, 0x08, 0xA4, 0x10, 0x85, 0xB2, 0x0C,
+    0x86, 0xAA, 0x08, 0x83, 0x9B, 0x04, 0x80, 0x96, 0x04, 0x00, 0x83, 0x08, 0x82, 0xAC, 0x08, 0x81,
+    0xF7, 0x07, 0x82, 0xC3, 0x0C, 0x81, 0x94, 0x04, 0x80, 0x9E, 0x0C, 0x84, 0xA1, 0x08, 0x83, 0x91,
+    0x04, 0x85, 0x80, 0x04, 0x82, 0xFD, 0x03, 0x80, 0x01, 0x80, 0x98, 0x08, 0x83, 0x88, 0x04, 0x81,
+    0xA6, 0x04, 0x82, 0xD7, 0x0C, 0x82, 0x04, 0x82, 0xBE, 0x04, 0x80, 0x0F, 0x83, 0x96, 0x04, 0x01,
+    0x46, 0x29, 0x82, 0x10, 0x93, 0x9B, 0x03, 0x88, 0x0A, 0x85, 0x9D, 0x03, 0xB3, 0x01, 0x87, 0xAE,
+    0x08, 0x81, 0x07, 0x9D, 0x96, 0x04, 0x8A, 0x66, 0x84, 0xA8, 0x08, 0x88, 0x19, 0x82, 0x0F, 0x85,
+    0x94, 0x04, 0x85, 0xA3, 0x0C, 0x82, 0xC4, 0x07, 0x83, 0x9A, 0x04, 0x83, 0x5C, 0x85, 0x8F, 0x0B,
+    0x82, 0xF6, 0x07, 0x93, 0x9E, 0x08, 0x88, 0xD0, 0x0F, 0x87, 0x01, 0x83, 0xB5, 0x07, 0x83, 0xC7,
+    0x03, 0x86, 0xD5, 0x04, 0x84, 0xF7, 0x08, 0x0A, 0xBA, 0xD6, 0xBA, 0xD6, 0x6E, 0x6B, 0x92, 0x94,
+    0xB7, 0xB5, 0xBE, 0xF7, 0x04, 0x19, 0x21, 0x00, 0x7D, 0xEF, 0x7D, 0xEF, 0x42, 0x08, 0x80, 0xDD,
+    0x02, 0x01, 0x5D, 0xEF, 0x7D, 0xEF, 0x80, 0x83, 0x0C, 0x85, 0x99, 0x04, 0x80, 0x85, 0x01, 0x80,
+    0xAF, 0x08, 0x00, 0xB7, 0xB5, 0x80, 0x95, 0x04, 0x01, 0x66, 0x29, 0xF0, 0x83, 0x80, 0x96, 0x04,
+    0x01, 0x55, 0xAD, 0x66, 0x29, 0x80, 0x0D, 0x04, 0xAB, 0x52, 0x5D, 0xEF, 0x9A, 0xD6, 0xCF, 0x7B,
+    0xFF, 0xFF, 0x80, 0xBF, 0x04, 0x04, 0x56, 0xAD, 0xFF, 0xFF, 0x8A, 0x52, 0x6E, 0x6B, 0x79, 0xCE,
+    0x8C, 0xF9, 0x0C, 0x03, 0x00, 0x00, 0x8B, 0x52, 0xFF, 0xFF, 0xCB, 0x5A, 0x80, 0xAF, 0x08, 0x80,
+    0x21, 0x00, 0x1C, 0xE7, 0x80, 0x21, 0x01, 0x8E, 0x73, 0xCF, 0x7B, 0x80, 0x37, 0x80, 0xBD, 0x08,
+    0x04, 0xCB, 0x5A, 0x86, 0x31, 0xFB, 0xDE, 0x5D, 0xEF, 0x10, 0x84, 0x80, 0xFD, 0x03, 0x00, 0x10,
+    0x84, 0x80, 0xE5, 0x08, 0x07, 0xE8, 0x39, 0x9A, 0xD6, 0xFF, 0xFF, 0xDF, 0xFF, 0x83, 0x10, 0x05,
+    0x21, 0x51, 0x8C, 0x2D, 0x63, 0x80, 0x8B, 0x02, 0x07, 0x00, 0x00, 0x04, 0x21, 0xB6, 0xB5, 0xBE,
+    0xF7, 0x55, 0xAD, 0xAF, 0x73, 0x10, 0x84, 0xA3, 0x18, 0x80, 0x51, 0x07, 0xFC, 0xDE, 0xFF, 0xFF,
+    0x45, 0x29, 0xCB, 0x5A, 0x38, 0xC6, 0xFF, 0xFF, 0xBA, 0xD6, 0x41, 0x08, 0x84, 0xFB, 0x05, 0x81,
+    0x98, 0x04, 0x81, 0x97, 0x01, 0x81, 0x89, 0x01, 0x81, 0x89, 0x04, 0x00, 0x83, 0x10, 0x86, 0xE0,
+    0x07, 0x82, 0xEF, 0x03, 0x8B, 0xAC, 0x0C, 0x84, 0x99, 0x08, 0x80, 0x05, 0x03, 0xA4, 0x10, 0x84,
+    0x08, 0x84, 0x10, 0x84, 0x08, 0x80, 0x9D, 0x04, 0x84, 0x0C, 0x82, 0x22, 0x82, 0x94, 0x04, 0x83,
+    0xC2, 0x0C, 0x00, 0x82, 0x10, 0x80, 0xC2, 0x0C, 0x83, 0xAD, 0x08, 0x83, 0xF6, 0x03, 0x82, 0x01,
+    0x82, 0x9C, 0x04, 0x86, 0x9B, 0x04, 0x81, 0x88, 0x04, 0x84, 0xA1, 0x04, 0x80, 0xAA, 0x08, 0x80,
+    0x25, 0x83, 0x92, 0x04, 0x81, 0x0D, 0x83, 0x07, 0x82, 0xA8, 0x04, 0x00, 0xA4, 0x10, 0x80, 0xE7,
+    0x08, 0x80, 0x96, 0x04, 0x01, 0x46, 0x21, 0x66, 0x29, 0x80, 0xAD, 0x08, 0x99, 0xAD, 0x03, 0x85,
+    0xB6, 0x07, 0x8B, 0x01, 0xA2, 0x88, 0x0C, 0x8C, 0x45, 0x85, 0xF9, 0x0F, 0xA0, 0xAC, 0x08, 0x8A,
+    0x35, 0x8A, 0x85, 0x01, 0x84, 0xCF, 0x0C, 0x85, 0x9B, 0x08, 0x88, 0xC9, 0x0C, 0x84, 0x03, 0x82,
+    0x01, 0x80, 0x99, 0x0F, 0x00, 0x43, 0x08, 0x87, 0xE2, 0x03, 0x8B, 0xFD, 0x03, 0x01, 0x63, 0x08,
+    0x64, 0x00, 0x83, 0x99, 0x04, 0x8B, 0xA5, 0x08, 0x89, 0x99, 0x04, 0x85, 0x8B, 0x08, 0x83, 0x37,
+    0x81, 0xBB, 0x08, 0x82, 0xA3, 0x01, 0x03, 0x4A, 0x4A, 0xFF, 0xFF, 0x79, 0xCE, 0x4D, 0x6B, 0x81,
+    0xDA, 0x03, 0x03, 0xE8, 0x39, 0x46, 0x29, 0xFF, 0xFF, 0xD3, 0x9C, 0x80, 0x7B, 0x02, 0x52, 0x8C,
+    0xFF, 0xFF, 0xD0, 0x7B, 0x82, 0xEB, 0x0B, 0x81, 0x29, 0x0C, 0x01, 0x00, 0x42, 0x08, 0x2D, 0x63,
+    0x69, 0x4A, 0xF4, 0x9C, 0xFF, 0xFF, 0xB7, 0xBD, 0x55, 0xAD, 0x1C, 0xE7, 0x9E, 0xF7, 0xBA, 0xD6,
+    0x31, 0x84, 0x25, 0x21, 0x81, 0x95, 0x01, 0x0E, 0xAF, 0x7B, 0xFF, 0xFF, 0x71, 0x8C, 0x00, 0x00,
+    0xAF, 0x73, 0x3C, 0xE7, 0xA3, 0x10, 0xE5, 0x18, 0xFF, 0xFF, 0x38, 0xC6, 0x30, 0x84, 0x8A, 0x52,
+    0x6A, 0x4A, 0xDB, 0xD6, 0x46, 0x29, 0x80, 0x82, 0x08, 0x87, 0x57, 0x80, 0xA9, 0x01, 0x01, 0x79,
+    0xCE, 0xDB, 0xDE, 0x81, 0xE2, 0x0A, 0x02, 0x4E, 0x6B, 0xFF, 0xFF, 0x51, 0x8C, 0x80, 0x26, 0x01,
+    0x31, 0x8C, 0xEC, 0x62, 0x80, 0x04, 0x04, 0xB7, 0xB5, 0x7D, 0xEF, 0x51, 0x8C, 0xFC, 0xDE, 0x51,
+    0x8C, 0x81, 0xFB, 0x06, 0x14, 0x42, 0x08, 0x1C, 0xE7, 0x1C, 0xE7, 0xAF, 0x7B, 0xD3, 0x9C, 0x0D,
+    0x63, 0xDF, 0xFF, 0x14, 0xA5, 0xCB, 0x5A, 0xD7, 0xBD, 0xFF, 0xFF, 0xDB, 0xDE, 0x21, 0x08, 0x00,
+    0x00, 0xC7, 0x39, 0x5D, 0xEF, 0x3C, 0xE7, 0xC7, 0x39, 0x00, 0x00, 0x6E, 0x6B, 0x31, 0x84, 0x80,
+    0xFB, 0x04, 0x80, 0xB7, 0x04, 0x04, 0xF7, 0xBD, 0xCF, 0x7B, 0x10, 0x84, 0x86, 0x31, 0xBE, 0xF7,
+    0x80, 0xE2, 0x08, 0x86, 0x95, 0x0A, 0x82, 0xE6, 0x05, 0x84, 0xB2, 0x02, 0x03, 0x41, 0x08, 0x42,
+    0x08, 0x83, 0x08, 0xA3, 0x10, 0x84, 0xB7, 0x08, 0x81, 0x9B, 0x04, 0x89, 0x93, 0x04, 0x84, 0x88,
+    0x04, 0x00, 0x84, 0x08, 0x80, 0x07, 0x80, 0x0A, 0x00, 0xA4, 0x08, 0x81, 0x98, 0x04, 0x82, 0x01,
+    0x83, 0xAA, 0x08, 0x84, 0x1C, 0x81, 0x81, 0x0E, 0x03, 0x42, 0x08, 0x05, 0x19, 0x46, 0x21, 0x05,
+    0x19, 0x80, 0x34, 0x81, 0xBD, 0x0C, 0x83, 0xFF, 0x07, 0x81, 0x01, 0x82, 0x0B, 0x82, 0xAF, 0x0C,
+    0x86, 0xD8, 0x0C, 0x85, 0x9A, 0x04, 0x83, 0x92, 0x09, 0x82, 0x18, 0x87, 0x17, 0x82, 0x1A, 0x81,
+    0x96, 0x04, 0x02, 0x67, 0x29, 0x87, 0x29, 0x45, 0x29, 0x8E, 0xAD, 0x08, 0x88, 0x80, 0x04, 0x84,
+    0xB3, 0x07, 0x9E, 0x98, 0x04, 0x00, 0x20, 0x00, 0x9E, 0xEE, 0x03, 0x85, 0xAD, 0x08, 0x81, 0x05,
+    0x9F, 0x86, 0x04, 0x8B, 0x4B, 0x83, 0x7D, 0x83, 0x09, 0x85, 0xAC, 0x08, 0x83, 0x97, 0x08, 0x84,
+    0x88, 0x04, 0x82, 0x52, 0x83, 0xA7, 0x04, 0x85, 0xE0, 0x0C, 0x80, 0x80, 0x04, 0x82, 0xC1, 0x06,
+    0x84, 0x9B, 0x04, 0x8B, 0x98, 0x04, 0x02, 0x63, 0x00, 0x28, 0x09, 0xA5, 0x00, 0x83, 0xB7, 0x08,
+    0x85, 0x93, 0x04, 0x83, 0xE7, 0x0B, 0x80, 0xD3, 0x0C, 0x84, 0x0E, 0x01, 0x63, 0x08, 0x63, 0x00,
+    0x83, 0xCD, 0x03, 0x86, 0xAF, 0x08, 0x83, 0x09, 0x80, 0x6A, 0x80, 0xB6, 0x03, 0x00, 0x6E, 0x6B,
+    0x80, 0x73, 0x05, 0x55, 0xAD, 0xFF, 0xFF, 0xE4, 0x18, 0x31, 0x8C, 0xFF, 0xFF, 0x87, 0x31, 0x81,
+    0xA4, 0x04, 0x00, 0x9E, 0xF7, 0x80, 0xE7, 0x07, 0x84, 0x52, 0x80, 0x69, 0x00, 0x31, 0x84, 0x80,
+    0xA8, 0x08, 0x04, 0x5D, 0xEF, 0xF7, 0xBD, 0x34, 0xA5, 0x6E, 0x6B, 0x86, 0x29, 0x83, 0xA8, 0x01,
+    0x80, 0xCE, 0x03, 0x09, 0xB6, 0xB5, 0x65, 0x29, 0x75, 0xAD, 0xDB, 0xDE, 0x86, 0x31, 0x00, 0x00,
+    0x72, 0x94, 0xFF, 0xFF, 0x38, 0xCE, 0x45, 0x29, 0x80, 0xAC, 0x08, 0x00, 0x83, 0x10, 0x81, 0x8C,
+    0x0D, 0x88, 0xAF, 0x08, 0x02, 0x49, 0x42, 0xFF, 0xFF, 0x0C, 0x63, 0x80, 0x23, 0x80, 0x3B, 0x00,
+    0x92, 0x94, 0x80, 0x05, 0x00, 0x35, 0xAD, 0x81, 0x0A, 0x04, 0x25, 0x21, 0xDF, 0xFF, 0xDF, 0xFF,
+    0xB6, 0xB5, 0xC3, 0x18, 0x82, 0xCA, 0x01, 0x00, 0x8A, 0x52, 0x80, 0xF1, 0x04, 0x00, 0xB2, 0x94,
+    0x80, 0xA5, 0x04, 0x80, 0x98, 0x04, 0x03, 0x8A, 0x52, 0x51, 0x8C, 0xFF, 0xFF, 0x2D, 0x63, 0x80,
+    0xAE, 0x08, 0x80, 0x97, 0x04, 0x02, 0x04, 0x21, 0x00, 0x00, 0xCB, 0x5A, 0x80, 0xF9, 0x08, 0x02,
+    0x20, 0x00, 0x00, 0x00, 0x96, 0xB5, 0x80, 0x98, 0x04, 0x80, 0x88, 0x05, 0x02, 0xAF, 0x73, 0xFF,
+    0xFF, 0xEB, 0x5A, 0x81, 0x23, 0x84, 0xE5, 0x05, 0x84, 0xAF, 0x02, 0x84, 0xB2, 0x02, 0x80, 0x06,
+    0x01, 0x41, 0x00, 0x42, 0x08, 0x80, 0xD2, 0x0C, 0x81, 0xCC, 0x07, 0x80, 0xC1, 0x03, 0x00, 0x83,
+    0x10, 0x80, 0x01, 0x86, 0xFD, 0x03, 0x83, 0xFF, 0x03, 0x80, 0x93, 0x04, 0x83, 0x8F, 0x04, 0x80,
+    0x03, 0x82, 0x05, 0x82, 0x1F, 0x82, 0xAC, 0x08, 0x80, 0x02, 0x80, 0xE9, 0x04, 0x80, 0xB5, 0x0D,
+    0x03, 0xC4, 0x18, 0x46, 0x21, 0x26, 0x21, 0xE5, 0x18, 0x84, 0xF4, 0x03, 0x81, 0xF6, 0x03, 0x00,
+    0xC5, 0x18, 0x82, 0x3D, 0x81, 0x0C, 0x80, 0x9B, 0x04, 0x82, 0x98, 0x04, 0x82, 0x01, 0x00, 0xC5,
+    0x10, 0x84, 0xA1, 0x08, 0x81, 0x14, 0x00, 0xE4, 0x18, 0x81, 0x05, 0x80, 0xF9, 0x04, 0x82, 0xC7,
+    0x0C, 0x80, 0xB8, 0x08, 0x00, 0xE4, 0x18, 0x80, 0x28, 0x82, 0xD5, 0x0C, 0x01, 0xE4, 0x18, 0x06,
+    0x21, 0x81, 0x97, 0x04, 0x01, 0x87, 0x29, 0x67, 0x29, 0x95, 0xAD, 0x08, 0x81, 0xEF, 0x02, 0x83,
+    0x98, 0x04, 0xBA, 0xC2, 0x0C, 0x88, 0x4C, 0x84, 0xE7, 0x07, 0x9B, 0x23, 0x98, 0x1B, 0x81, 0x03,
+    0x87, 0x01, 0x80, 0xE5, 0x0A, 0x00, 0x42, 0x08, 0x82, 0x96, 0x01, 0x82, 0x86, 0x0F, 0x88, 0xBB,
+    0x08, 0x85, 0xEE, 0x07, 0x03, 0x63, 0x08, 0x84, 0x08, 0xC5, 0x10, 0x83, 0x08, 0x89, 0x8E, 0x08,
+    0x81, 0xA3, 0x0C, 0x81, 0xC0, 0x02, 0x80, 0x98, 0x04, 0x01, 0x07, 0x09, 0x85, 0x00, 0x86, 0xCA,
+    0x0C, 0x82, 0x14, 0x80, 0x11, 0x89, 0x01, 0x85, 0xE4, 0x0C, 0x84, 0xC9, 0x04, 0x82, 0xF3, 0x04,
+    0x81, 0x9A, 0x04, 0x01, 0x00, 0x00, 0x66, 0x29, 0x80, 0xAC, 0x03, 0x80, 0x72, 0x0A, 0xA7, 0x31,
+    0xFF, 0xFF, 0xB7, 0xB5, 0x42, 0x08, 0x5D, 0xEF, 0x18, 0xC6, 0x00, 0x00, 0x45, 0x29, 0xDB, 0xDE,
+    0xFF, 0xFF, 0x14, 0xA5, 0x82, 0xD7, 0x05, 0x85, 0x87, 0x08, 0x02, 0xB3, 0x94, 0xFF, 0xFF, 0x29,
+    0x42, 0x85, 0xD0, 0x01, 0x80, 0x03, 0x05, 0x59, 0xCE, 0xDF, 0xFF, 0xD3, 0x9C, 0xF4, 0x9C, 0x8E,
+    0x73, 0x41, 0x08, 0x80, 0xF6, 0x07, 0x01, 0xBE, 0xF7, 0xBE, 0xF7, 0x80, 0xF6, 0x07, 0x81, 0xAC,
+    0x05, 0x81, 0x6E, 0x84, 0x94, 0x0D, 0x82, 0x98, 0x04, 0x06, 0x39, 0xC6, 0x3D, 0xE7, 0x62, 0x08,
+    0x00, 0x00, 0x62, 0x08, 0x1C, 0xE7, 0xBB, 0xD6, 0x80, 0x2A, 0x01, 0x31, 0x84, 0xFF, 0xFF, 0x80,
+    0x44, 0x02, 0x00, 0x00, 0x92, 0x8C, 0xFF, 0xFF, 0x80, 0xA4, 0x0C, 0x00, 0xA3, 0x10, 0x82, 0xDE,
+    0x06, 0x04, 0xB7, 0xB5, 0xFF, 0xFF, 0xD7, 0xBD, 0x41, 0x08, 0x29, 0x42, 0x80, 0xE9, 0x04, 0x03,
+    0x28, 0x42, 0xA3, 0x10, 0xBE, 0xF7, 0x9A, 0xD6, 0x80, 0x67, 0x80, 0x8E, 0x04, 0x00, 0xE7, 0x39,
+    0x81, 0x3D, 0x00, 0x7D, 0xEF, 0x80, 0xB1, 0x04, 0x02, 0x86, 0x31, 0xDF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x97, 0x04, 0x02, 0x82, 0x10, 0x7D, 0xEF, 0xDB, 0xDE, 0x80, 0xA1, 0x04, 0x00, 0x86, 0x31, 0x80,
+    0xB2, 0x0D, 0x86, 0xE7, 0x01, 0x87, 0x07, 0x84, 0x9C, 0x04, 0x81, 0x9B, 0x04, 0x83, 0xFB, 0x07,
+    0x82, 0xE1, 0x03, 0x81, 0x8C, 0x04, 0x85, 0xC8, 0x0C, 0x81, 0x8F, 0x04, 0x86, 0xAB, 0x08, 0x00,
+    0x84, 0x10, 0x81, 0x19, 0x00, 0x84, 0x10, 0x81, 0xF6, 0x0C, 0x00, 0x83, 0x10, 0x81, 0x96, 0x04,
+    0x01, 0x21, 0x00, 0xC4, 0x18, 0x80, 0xD8, 0x03, 0x80, 0x80, 0x08, 0x82, 0x94, 0x04, 0x83, 0xE8,
+    0x08, 0x85, 0xA7, 0x08, 0x84, 0xA6, 0x04, 0x87, 0x9B, 0x04, 0x84, 0x12, 0x82, 0xAD, 0x08, 0x85,
+    0xA2, 0x04, 0x83, 0x1A, 0x00, 0x05, 0x19, 0x80, 0x06, 0x80, 0x3C, 0x80, 0x01, 0x02, 0x67, 0x29,
+    0x87, 0x31, 0x25, 0x21, 0x80, 0xC1, 0x01, 0x94, 0x8B, 0x03, 0x01, 0x00, 0x00, 0x41, 0x00, 0x82,
+    0xC8, 0x03, 0x81, 0x97, 0x01, 0x00, 0x21, 0x08, 0x81, 0xAB, 0x07, 0xAF, 0x8A, 0x04, 0x8D, 0x4F,
+    0x83, 0xDE, 0x01, 0xB8, 0x3E, 0x8A, 0x01, 0x86, 0xC6, 0x0C, 0x81, 0x88, 0x04, 0x85, 0x87, 0x09,
+    0x86, 0x98, 0x04, 0x80, 0x11, 0x80, 0xED, 0x0E, 0x83, 0xB1, 0x08, 0x84, 0xBA, 0x07, 0x82, 0xA7,
+    0x03, 0x01, 0x63, 0x08, 0x64, 0x08, 0x80, 0x91, 0x08, 0x80, 0xFC, 0x03, 0x8A, 0xAC, 0x04, 0x81,
+    0x21, 0x83, 0xBF, 0x03, 0x8A, 0xCE, 0x0C, 0x84, 0x99, 0x04, 0x83, 0xFC, 0x03, 0x81, 0x99, 0x04,
+    0x03, 0x00, 0x00, 0xF0, 0x7B, 0x9E, 0xEF, 0x83, 0x10, 0x80, 0x97, 0x04, 0x01, 0x7E, 0xEF, 0x1C,
+    0xE7, 0x80, 0xCA, 0x06, 0x80, 0x87, 0x0C, 0x04, 0x45, 0x29, 0x14, 0xA5, 0x14, 0xA5, 0xFF, 0xFF,
+    0xC8, 0x39, 0x85, 0xAF, 0x08, 0x81, 0xEF, 0x03, 0x02, 0x05, 0x21, 0xDF, 0xFF, 0xD7, 0xBD, 0x82,
+    0x92, 0x02, 0x83, 0xD5, 0x0C, 0x80, 0x1E, 0x00, 0x96, 0xB5, 0x82, 0x9D, 0x01, 0x00, 0x28, 0x42,
+    0x80, 0xB9, 0x04, 0x00, 0xCF, 0x73, 0x80, 0x97, 0x04, 0x84, 0x95, 0x04, 0x80, 0x69, 0x83, 0x5A,
+    0x80, 0xC6, 0x0B, 0x80, 0xFC, 0x03, 0x00, 0xF0, 0x7B, 0x80, 0x1A, 0x80, 0xD0, 0x08, 0x00, 0xAB,
+    0x52, 0x80, 0x4B, 0x09, 0xBA, 0xD6, 0xFF, 0xFF, 0x6E, 0x73, 0x00, 0x00, 0x4D, 0x6B, 0xDF, 0xFF,
+    0x1C, 0xE7, 0x0C, 0x63, 0xBE, 0xF7, 0xFB, 0xDE, 0x80, 0xD4, 0x08, 0x80, 0x86, 0x04, 0x03, 0xFF,
+    0xFF, 0x3C, 0xE7, 0x04, 0x19, 0x20, 0x00, 0x80, 0xF3, 0x08, 0x80, 0x98, 0x08, 0x00, 0x8E, 0x73,
+    0x81, 0x04, 0x00, 0x45, 0x29, 0x81, 0xFE, 0x04, 0x05, 0xE7, 0x39, 0xF7, 0xBD, 0xFF, 0xFF, 0x75,
+    0xAD, 0x00, 0x00, 0xA6, 0x39, 0x80, 0x42, 0x00, 0x72, 0x8C, 0x80, 0x1C, 0x00, 0x0C, 0x63, 0x81,
+    0x13, 0x01, 0x4D, 0x6B, 0xCF, 0x73, 0x82, 0xCC, 0x01, 0x88, 0xE3, 0x01, 0x86, 0xF4, 0x05, 0x84,
+    0x15, 0x01, 0x42, 0x08, 0x62, 0x08, 0x80, 0xF7, 0x03, 0x83, 0xC5, 0x03, 0x80, 0xED, 0x07, 0x82,
+    0x9C, 0x04, 0x82, 0xB2, 0x08, 0x82, 0xAC, 0x08, 0x82, 0x05, 0x84, 0xAA, 0x0C, 0x81, 0xDC, 0x03,
+    0x01, 0x84, 0x10, 0x42, 0x08, 0x80, 0xE6, 0x02, 0x80, 0xAC, 0x08, 0x01, 0x47, 0x29, 0x67, 0x29,
+    0x80, 0xAD, 0x08, 0x84, 0x99, 0x0C, 0x83, 0xB0, 0x08, 0x81, 0xA8, 0x08, 0x82, 0xF4, 0x03, 0x00,
+    0xC5, 0x18, 0x85, 0xAB, 0x0C, 0x00, 0xC5, 0x18, 0x81, 0x9D, 0x08, 0x80, 0x9C, 0x08, 0x84, 0x01,
+    0x80, 0xE4, 0x01, 0x82, 0x94, 0x04, 0x83, 0x17, 0x82, 0x08, 0x82, 0x27, 0x81, 0x97, 0x04, 0x00,
+    0x46, 0x29, 0x80, 0x97, 0x04, 0x00, 0xC4, 0x18, 0x9B, 0x83, 0x0C, 0x82, 0xAC, 0x08, 0x82, 0xB8,
+    0x08, 0xBD, 0x01, 0x82, 0xDC, 0x01, 0xAB, 0x30, 0x83, 0x78, 0x84, 0x09, 0x84, 0xC0, 0x0C, 0x8B,
+    0x92, 0x04, 0x88, 0xB1, 0x02, 0x82, 0xDF, 0x07, 0x84, 0xB8, 0x02, 0x81, 0x0A, 0x85, 0x8B, 0x04,
+    0x84, 0xFF, 0x03, 0x82, 0x0C, 0x83, 0x11, 0x87, 0x82, 0x04, 0x85, 0x0F, 0x83, 0x11, 0x81, 0x02,
+    0x86, 0xD7, 0x0C, 0x8C, 0x9F, 0x04, 0x82, 0xB3, 0x08, 0x04, 0x00, 0x00, 0xB2, 0x94, 0x3C, 0xE7,
+    0xCB, 0x52, 0x92, 0x94, 0x80, 0xE7, 0x07, 0x80, 0xE4, 0x0B, 0x06, 0x62, 0x08, 0xD7, 0xBD, 0xFB,
+    0xDE, 0x14, 0xA5, 0x45, 0x29, 0x59, 0xCE, 0x9A, 0xD6, 0x81, 0xBF, 0x01, 0x85, 0x1F, 0x03, 0x00,
+    0x00, 0x72, 0x8C, 0xFF, 0xFF, 0xE8, 0x39, 0x80, 0xA5, 0x04, 0x85, 0x5B, 0x80, 0xB0, 0x08, 0x08,
+    0x3D, 0xE7, 0x29, 0x42, 0x86, 0x31, 0xAA, 0x52, 0x71, 0x8C, 0x6E, 0x73, 0xDB, 0xDE, 0x1C, 0xE7,
+    0x41, 0x00, 0x83, 0xAC, 0x08, 0x80, 0xFF, 0x04, 0x83, 0x01, 0x82, 0x82, 0x01, 0x03, 0x00, 0x00,
+    0xF8, 0xBD, 0xBE, 0xF7, 0xC4, 0x10, 0x80, 0xBD, 0x01, 0x80, 0x9D, 0x04, 0x06, 0x34, 0xA5, 0x35,
+    0xA5, 0x72, 0x8C, 0xA2, 0x10, 0xDB, 0xDE, 0x18, 0xC6, 0x51, 0x8C, 0x80, 0x4D, 0x09, 0x31, 0x84,
+    0x00, 0x00, 0xC8, 0x39, 0xDF, 0xFF, 0x9E, 0xF7, 0xEC, 0x5A, 0xE3, 0x18, 0xF8, 0xBD, 0xFF, 0xFF,
+    0x49, 0x4A, 0x80, 0x3F, 0x01, 0x8E, 0x73, 0x8A, 0x4A, 0x80, 0x1B, 0x80, 0x48, 0x0B, 0xCB, 0x5A,
+    0xAA, 0x52, 0xF4, 0x9C, 0xFF, 0xFF, 0x38, 0xC6, 0x10, 0x84, 0x96, 0xB5, 0x45, 0x29, 0x14, 0x9D,
+    0x1C, 0xE7, 0x51, 0x8C, 0x34, 0xA5, 0x80, 0xCD, 0x08, 0x81, 0x9E, 0x02, 0x80, 0xDA, 0x0C, 0x03,
+    0x2C, 0x63, 0x10, 0x84, 0xEF, 0x7B, 0x20, 0x00, 0x84, 0xAB, 0x0E, 0x80, 0x93, 0x0A, 0x88, 0xE5,
+    0x01, 0x84, 0x98, 0x04, 0x85, 0x9E, 0x04, 0x00, 0x21, 0x00, 0x80, 0x9B, 0x04, 0x80, 0xF4, 0x0B,
+    0x83, 0x81, 0x04, 0x00, 0xC5, 0x10, 0x80, 0xE7, 0x03, 0x82, 0xB8, 0x08, 0x85, 0x01, 0x81, 0xB3,
+    0x08, 0x82, 0x16, 0x00, 0x84, 0x10, 0x80, 0xEF, 0x08, 0x80, 0x60, 0x00, 0xA4, 0x10, 0x80, 0xD9,
+    0x03, 0x00, 0x26, 0x21, 0x82, 0xF7, 0x03, 0x00, 0x05, 0x19, 0x80, 0x01, 0x80, 0x24, 0x84, 0x97,
+    0x04, 0x81, 0xA5, 0x0C, 0x80, 0x95, 0x04, 0x80, 0x0C, 0x80, 0xCF, 0x0C, 0x86, 0xAD, 0x04, 0x81,
+    0x0A, 0x82, 0x15, 0x81, 0x03, 0x83, 0x9C, 0x04, 0x82, 0x51, 0x81, 0xAB, 0x04, 0x82, 0xEE, 0x0C,
+    0x81, 0x97, 0x04, 0x00, 0x67, 0x29, 0x80, 0x01, 0x00, 0x05, 0x21, 0x93, 0xAD, 0x08, 0x89, 0xA1,
+    0x03, 0x9D, 0x1A, 0xA4, 0xE4, 0x0C, 0x81, 0xD0, 0x01, 0xA2, 0x27, 0x89, 0x31, 0x87, 0x8E, 0x04,
+    0x82, 0x93, 0x02, 0x87, 0x99, 0x04, 0x84, 0x9F, 0x08, 0x89, 0x99, 0x04, 0x80, 0x03, 0x83, 0xCC,
+    0x03, 0x83, 0x80, 0x0C, 0x88, 0xA9, 0x0C, 0x83, 0x06, 0x80, 0xA0, 0x03, 0x86, 0xA6, 0x08, 0x86,
+    0xC1, 0x08, 0x83, 0x98, 0x04, 0x81, 0x8E, 0x04, 0x85, 0xB3, 0x04, 0x82, 0xC2, 0x0C, 0x87, 0xF8,
+    0x0B, 0x88, 0xB7, 0x08, 0x83, 0x63, 0x02, 0x8A, 0x52, 0x34, 0xA5, 0x55, 0xAD, 0x80, 0xEB, 0x07,
+    0x81, 0x01, 0x00, 0x21, 0x00, 0x80, 0xE4, 0x07, 0x80, 0xE3, 0x07, 0x00, 0x2D, 0x63, 0x88, 0xC7,
+    0x0C, 0x02, 0xC4, 0x18, 0xBE, 0xF7, 0x59, 0xCE, 0x80, 0x0D, 0x84, 0x84, 0x04, 0x80, 0x04, 0x0A,
+    0x01, 0x00, 0x04, 0x21, 0x14, 0xA5, 0xFB, 0xDE, 0x59, 0xCE, 0x92, 0x94, 0xC7, 0x31, 0x00, 0x00,
+    0xAB, 0x52, 0x09, 0x42, 0x00, 0x00, 0x83, 0x95, 0x04, 0x00, 0x63, 0x00, 0x85, 0x99, 0x04, 0x80,
+    0x1B, 0x00, 0x01, 0x00, 0x80, 0x84, 0x0D, 0x00, 0xD3, 0x9C, 0x80, 0xC3, 0x08, 0x03, 0x43, 0x00,
+    0x21, 0x00, 0x6D, 0x6B, 0x35, 0xA5, 0x81, 0x46, 0x05, 0xE4, 0x18, 0x0C, 0x63, 0xC7, 0x39, 0x21,
+    0x00, 0x51, 0x8C, 0xE4, 0x18, 0x80, 0x08, 0x02, 0x08, 0x3A, 0x7D, 0xEF, 0xFF, 0xFF, 0x80, 0xAF,
+    0x0C, 0x82, 0x4C, 0x81, 0x57, 0x08, 0x00, 0x00, 0x25, 0x21, 0x76, 0xAD, 0xD7, 0xBD, 0xF0, 0x7B,
+    0xA3, 0x10, 0xAB, 0x52, 0xF3, 0x9C, 0xAF, 0x73, 0x80, 0xFF, 0x02, 0x05, 0x42, 0x08, 0xEB, 0x5A,
+    0xCB, 0x52, 0x41, 0x08, 0xCB, 0x5A, 0x08, 0x42, 0x82, 0x13, 0x02, 0xF7, 0xBD, 0xD7, 0xBD, 0xAA,
+    0x52, 0x81, 0x1B, 0x85, 0xF2, 0x0E, 0x85, 0x84, 0x0A, 0x85, 0x82, 0x02, 0x83, 0x0F, 0x80, 0xBF,
+    0x0B, 0x84, 0x10, 0x01, 0x41, 0x08, 0x62, 0x08, 0x80, 0x96, 0x0A, 0x81, 0xEB, 0x03, 0x80, 0xDA,
+    0x03, 0x05, 0x05, 0x19, 0x06, 0x19, 0xE5, 0x18, 0xC5, 0x10, 0xA4, 0x10, 0xA4, 0x08, 0x83, 0xD7,
+    0x0C, 0x82, 0x03, 0x80, 0x08, 0x81, 0xAC, 0x08, 0x81, 0x96, 0x04, 0x00, 0x26, 0x21, 0x80, 0x17,
+    0x86, 0x01, 0x80, 0x9A, 0x04, 0x00, 0x05, 0x21, 0x81, 0x9C, 0x04, 0x80, 0x26, 0x86, 0xBF, 0x0C,
+    0x80, 0xB7, 0x08, 0x81, 0x9F, 0x04, 0x80, 0x01, 0x84, 0xB7, 0x08, 0x84, 0x01, 0x81, 0x18, 0x81,
+    0xC5, 0x04, 0x82, 0x92, 0x04, 0x80, 0x0C, 0x80, 0xA1, 0x04, 0x01, 0xE4, 0x18, 0x05, 0x19, 0x81,
+    0x97, 0x04, 0x01, 0xA7, 0x31, 0x66, 0x29, 0x80, 0xF4, 0x0D, 0x97, 0xF4, 0x03, 0x9E, 0xF1, 0x03,
+    0x85, 0x98, 0x04, 0xA2, 0xF1, 0x03, 0x80, 0xCF, 0x01, 0x80, 0xB9, 0x0E, 0xAD, 0x01, 0x89, 0xFA,
+    0x03, 0x8A, 0x0E, 0x85, 0x98, 0x04, 0x82, 0x9D, 0x08, 0x86, 0x12, 0x83, 0xCB, 0x03, 0x82, 0xD1,
+    0x03, 0x87, 0xE2, 0x03, 0x86, 0x8F, 0x04, 0x85, 0x99, 0x04, 0x83, 0x8F, 0x04, 0x88, 0xFA, 0x03,
+    0x83, 0xB1, 0x08, 0x82, 0x96, 0x04, 0x80, 0x01, 0x02, 0x64, 0x00, 0x84, 0x08, 0x64, 0x00, 0x8A,
+    0xE2, 0x0C, 0x86, 0xB2, 0x08, 0x85, 0xD3, 0x01, 0x03, 0x41, 0x00, 0x83, 0x10, 0xC3, 0x10, 0xC3,
+    0x10, 0x81, 0xB6, 0x06, 0x01, 0xD7, 0xBD, 0x3D, 0xE7, 0x82, 0xE6, 0x01, 0x85, 0xAF, 0x08, 0x80,
+    0xD4, 0x07, 0x00, 0x8E, 0x6B, 0x81, 0x84, 0x04, 0x81, 0x5A, 0x81, 0x84, 0x04, 0x81, 0x99, 0x04,
+    0x80, 0xD5, 0x03, 0x80, 0xB2, 0x0C, 0x81, 0xD2, 0x03, 0x87, 0x97, 0x04, 0x00, 0x63, 0x00, 0x85,
+    0x9B, 0x04, 0x00, 0x00, 0x00, 0x80, 0xA1, 0x08, 0x00, 0x29, 0x42, 0x80, 0x15, 0x00, 0x84, 0x08,
+    0x81, 0x1D, 0x81, 0xDD, 0x08, 0x83, 0xFA, 0x09, 0x82, 0x9A, 0x06, 0x03, 0x25, 0x21, 0x55, 0xAD,
+    0x5D, 0xEF, 0xAF, 0x73, 0x82, 0xED, 0x08, 0x83, 0x4A, 0x82, 0x14, 0x83, 0xC0, 0x02, 0x84, 0x99,
+    0x0A, 0x85, 0x76, 0x85, 0x94, 0x04, 0x86, 0x95, 0x04, 0x86, 0x0D, 0x86, 0xAC, 0x04, 0x85, 0x80,
+    0x02, 0x81, 0x36, 0x02, 0x42, 0x08, 0x83, 0x08, 0xC3, 0x10, 0x80, 0xE4, 0x03, 0x00, 0xE4, 0x18,
+    0x81, 0xD3, 0x03, 0x82, 0x84, 0x04, 0x80, 0xD4, 0x03, 0x82, 0xAE, 0x08, 0x00, 0x84, 0x08, 0x84,
+    0xAC, 0x08, 0x00, 0x47, 0x21, 0x82, 0xC2, 0x0C, 0x88, 0x01, 0x80, 0x9A, 0x04, 0x01, 0x26, 0x21,
+    0x06, 0x21, 0x80, 0x01, 0x82, 0xBF, 0x08, 0x80, 0xF5, 0x03, 0x81, 0x96, 0x04, 0x81, 0x94, 0x04,
+    0x80, 0x9A, 0x04, 0x82, 0x01, 0x85, 0x9D, 0x04, 0x83, 0xC2, 0x0C, 0x81, 0xE4, 0x04, 0x80, 0x90,
+    0x04, 0x82, 0x9B, 0x04, 0x00, 0xC4, 0x18, 0x80, 0x2D, 0x00, 0x26, 0x21, 0x80, 0xC2, 0x0C, 0x02,
+    0x87, 0x31, 0x25, 0x21, 0x41, 0x08, 0x8A, 0xE7, 0x03, 0x83, 0xE8, 0x02, 0x84, 0xC8, 0x03, 0x00,
+    0x41, 0x08, 0x81, 0xA5, 0x01, 0x84, 0x90, 0x03, 0x86, 0x80, 0x04, 0x83, 0xFF, 0x01, 0x84, 0x1C,
+    0xAE, 0xE3, 0x03, 0x01, 0x00, 0x00, 0x20, 0x00, 0xB4, 0x96, 0x04, 0x83, 0x07, 0x83, 0xB7, 0x02,
+    0x8E, 0x01, 0x81, 0x9E, 0x02, 0x80, 0xCF, 0x03, 0x85, 0xE2, 0x0A, 0x83, 0xE8, 0x02, 0x83, 0xE6,
+    0x07, 0x8A, 0xDD, 0x03, 0x80, 0x1F, 0x00, 0x63, 0x08, 0x80, 0x8E, 0x08, 0x81, 0xAD, 0x03, 0x80,
+    0x83, 0x0F, 0x87, 0x98, 0x04, 0x82, 0xBA, 0x0C, 0x84, 0xCA, 0x0C, 0x83, 0x08, 0x80, 0xC2, 0x03,
+    0x80, 0x08, 0x02, 0x64, 0x00, 0x85, 0x08, 0x85, 0x08, 0x81, 0x06, 0x8D, 0x98, 0x04, 0x81, 0x71,
+    0x0A, 0xC3, 0x18, 0x49, 0x4A, 0xCF, 0x7B, 0xB3, 0x94, 0x35, 0xA5, 0x75, 0xAD, 0x75, 0xAD, 0x96,
+    0xB5, 0xD7, 0xBD, 0xF7, 0xC5, 0x18, 0xC6, 0x80, 0xC4, 0x07, 0x03, 0xFF, 0xFF, 0x3C, 0xE7, 0x2D,
+    0x63, 0x86, 0x31, 0x81, 0x9D, 0x02, 0x83, 0x3A, 0x03, 0x00, 0x00, 0x6E, 0x6B, 0x76, 0xAD, 0x83,
+    0x10, 0x81, 0xB3, 0x0C, 0x83, 0x82, 0x04, 0x80, 0x05, 0x00, 0x63, 0x00, 0x86, 0x3B, 0x81, 0x12,
+    0x00, 0x84, 0x08, 0x83, 0xE8, 0x04, 0x81, 0x01, 0x83, 0x98, 0x04, 0x03, 0x01, 0x00, 0x35, 0xAD,
+    0x3D, 0xE7, 0xE5, 0x18, 0x81, 0x32, 0x82, 0xC2, 0x04, 0x87, 0x92, 0x09, 0x81, 0xDD, 0x0C, 0x01,
+    0x00, 0x00, 0x83, 0x08, 0x80, 0xC5, 0x08, 0x84, 0x82, 0x01, 0x81, 0xB3, 0x01, 0x81, 0xEC, 0x04,
+    0x80, 0x08, 0x89, 0xF0, 0x03, 0x82, 0x80, 0x04, 0x01, 0x41, 0x00, 0x42, 0x08, 0x89, 0x0F, 0x82,
+    0x9F, 0x08, 0x88, 0xA6, 0x04, 0x86, 0x04, 0x84, 0xA8, 0x04, 0x82, 0xA4, 0x02, 0x02, 0x42, 0x08,
+    0x62, 0x08, 0xA3, 0x10, 0x80, 0xE9, 0x03, 0x84, 0xFB, 0x03, 0x04, 0xE5, 0x18, 0xE5, 0x10, 0xC5,
+    0x10, 0xC5, 0x10, 0x83, 0x08, 0x81, 0xA5, 0x01, 0x00, 0xA4, 0x10, 0x80, 0xEC, 0x07, 0x80, 0x86,
+    0x04, 0x81, 0xA0, 0x08, 0x81, 0x87, 0x04, 0x82, 0x8A, 0x04, 0x89, 0x9C, 0x04, 0x83, 0xD9, 0x0C,
+    0x81, 0xC4, 0x0C, 0x83, 0x31, 0x81, 0x84, 0x0D, 0x82, 0xD8, 0x0C, 0x80, 0x89, 0x04, 0x84, 0x9A,
+    0x04, 0x80, 0x46, 0x82, 0x08, 0x00, 0xE4, 0x18, 0x80, 0x06, 0x00, 0x05, 0x19, 0x80, 0x80, 0x0D,
+    0x81, 0x97, 0x04, 0x8A, 0xAD, 0x08, 0x82, 0xFF, 0x02, 0x86, 0x07, 0x81, 0xF6, 0x04, 0x82, 0x98,
+    0x04, 0x82, 0x01, 0x01, 0x84, 0x08, 0x63, 0x08, 0x85, 0xA9, 0x0C, 0x89, 0xAF, 0x0C, 0xAD, 0x92,
+    0x0C, 0xAF, 0x01, 0x8A, 0xA0, 0x08, 0x83, 0x8C, 0x02, 0x88, 0xD0, 0x0C, 0x8A, 0x10, 0x82, 0x8A,
+    0x04, 0x84, 0x01, 0x83, 0x98, 0x04, 0x86, 0x05, 0x84, 0x01, 0x80, 0x94, 0x04, 0x00, 0x23, 0x00,
+    0x81, 0xA5, 0x0C, 0x81, 0x89, 0x04, 0x01, 0x84, 0x08, 0x64, 0x08, 0x85, 0xB5, 0x0C, 0x83, 0xBD,
+    0x03, 0x82, 0xFB, 0x0F, 0x82, 0x01, 0x00, 0x64, 0x08, 0x81, 0xD2, 0x03, 0x81, 0xF0, 0x07, 0x85,
+    0xF5, 0x0B, 0x8A, 0xE4, 0x08, 0x81, 0xC9, 0x07, 0x16, 0x83, 0x10, 0x0C, 0x63, 0x14, 0xA5, 0x55,
+    0xAD, 0xD3, 0x9C, 0xEF, 0x7B, 0xAB, 0x52, 0xC7, 0x39, 0x25, 0x21, 0xE4, 0x18, 0xC3, 0x10, 0xA3,
+    0x10, 0xC3, 0x18, 0xE4, 0x18, 0x65, 0x29, 0x7D, 0xEF, 0xBE, 0xF7, 0xAF, 0x7B, 0xF4, 0xA4, 0x18,
+    0xC6, 0x18, 0xC6, 0x31, 0x84, 0x45, 0x21, 0x83, 0xA7, 0x08, 0x81, 0xA2, 0x08, 0x81, 0x97, 0x04,
+    0x82, 0x95, 0x04, 0x83, 0x01, 0x82, 0xB4, 0x08, 0x83, 0xAB, 0x08, 0x80, 0x12, 0x81, 0x92, 0x04,
+    0x00, 0x44, 0x00, 0x81, 0x02, 0x84, 0x03, 0x80, 0x19, 0x01, 0x84, 0x08, 0x06, 0x19, 0x82, 0x88,
+    0x05, 0x84, 0x1C, 0x85, 0x75, 0x82, 0x8E, 0x04, 0x84, 0xDE, 0x04, 0x82, 0xDB, 0x08, 0x00, 0x63,
+    0x08, 0x82, 0x95, 0x01, 0x83, 0x99, 0x01, 0x80, 0xB7, 0x01, 0x01, 0x62, 0x08, 0x62, 0x08, 0x8C,
+    0xA0, 0x04, 0x85, 0x01, 0x00, 0x42, 0x00, 0x87, 0xA5, 0x04, 0x86, 0x80, 0x02, 0x82, 0x99, 0x04,
+    0x8B, 0x9B, 0x04, 0x80, 0xB7, 0x08, 0x00, 0x83, 0x10, 0x80, 0xE9, 0x03, 0x82, 0xB8, 0x08, 0x80,
+    0xF9, 0x03, 0x00, 0xE5, 0x18, 0x80, 0x0F, 0x81, 0xAC, 0x08, 0x00, 0x27, 0x21, 0x81, 0xBF, 0x08,
+    0x82, 0x95, 0x04, 0x82, 0x01, 0x86, 0x96, 0x04, 0x80, 0x99, 0x08, 0x85, 0x9D, 0x04, 0x81, 0x13,
+    0x80, 0x2C, 0x81, 0x84, 0x04, 0x00, 0xC4, 0x18, 0x81, 0x97, 0x04, 0x84, 0xB7, 0x08, 0x82, 0xBE,
+    0x0C, 0x82, 0xC0, 0x0C, 0x83, 0x9A, 0x04, 0x00, 0xE5, 0x18, 0x80, 0xC2, 0x0C, 0x04, 0x26, 0x21,
+    0x47, 0x29, 0x87, 0x29, 0x67, 0x29, 0xE5, 0x18, 0x90, 0xF9, 0x07, 0x85, 0x84, 0x04, 0x80, 0xFA,
+    0x03, 0x86, 0x86, 0x04, 0x81, 0xA7, 0x0A, 0x83, 0xB2, 0x07, 0x9F, 0xD5, 0x0C, 0xC9, 0x01, 0x85,
+    0xB9, 0x09, 0x8E, 0x88, 0x04, 0x88, 0xAD, 0x06, 0x84, 0x14, 0x84, 0xF2, 0x0B, 0x84, 0x8C, 0x04,
+    0x82, 0x84, 0x04, 0x82, 0x0F, 0x86, 0xDF, 0x03, 0x85, 0x90, 0x03, 0x81, 0x17, 0x83, 0x07, 0x81,
+    0xFB, 0x03, 0x80, 0x04, 0x86, 0xA9, 0x08, 0x82, 0x9F, 0x03, 0x84, 0x15, 0x82, 0x25, 0x83, 0x08,
+    0x8A, 0xE6, 0x0C, 0x04, 0x01, 0x00, 0x29, 0x42, 0xF3, 0x9C, 0xF0, 0x7B, 0xE7, 0x39, 0x81, 0xBE,
+    0x0C, 0x86, 0xF4, 0x01, 0x02, 0x4D, 0x6B, 0xFF, 0xFF, 0x4D, 0x6B, 0x80, 0x05, 0x04, 0x41, 0x08,
+    0x08, 0x42, 0x92, 0x94, 0x79, 0xD6, 0x8E, 0x73, 0x80, 0x91, 0x04, 0x83, 0xC5, 0x04, 0x86, 0x87,
+    0x04, 0x80, 0x96, 0x04, 0x81, 0x03, 0x83, 0x9C, 0x04, 0x86, 0xAA, 0x08, 0x80, 0xFE, 0x08, 0x02,
+    0x84, 0x00, 0x85, 0x08, 0xA5, 0x08, 0x80, 0x96, 0x04, 0x81, 0x9A, 0x04, 0x81, 0x9C, 0x04, 0x84,
+    0x17, 0x81, 0xC2, 0x04, 0x81, 0xA5, 0x04, 0x88, 0x01, 0x81, 0x0C, 0x85, 0x9E, 0x01, 0x80, 0xF2,
+    0x06, 0x81, 0xCC, 0x09, 0x83, 0xB3, 0x04, 0x80, 0x11, 0x80, 0xF9, 0x07, 0x80, 0xE8, 0x02, 0x82,
+    0xCB, 0x01, 0x80, 0x89, 0x04, 0x82, 0xD3, 0x01, 0x81, 0x12, 0x8D, 0xA1, 0x04, 0x88, 0xC2, 0x0E,
+    0x86, 0x85, 0x02, 0x85, 0x15, 0x82, 0xCC, 0x0A, 0x80, 0x9B, 0x04, 0x01, 0x62, 0x08, 0x83, 0x10,
+    0x82, 0xB8, 0x08, 0x80, 0x8B, 0x09, 0x01, 0xA4, 0x10, 0x67, 0x29, 0x80, 0xC3, 0x0C, 0x00, 0x06,
+    0x19, 0x86, 0x8F, 0x04, 0x88, 0x97, 0x04, 0x85, 0xB6, 0x0C, 0x88, 0x0B, 0x83, 0xA6, 0x08, 0x00,
+    0xC5, 0x18, 0x81, 0xD0, 0x04, 0x82, 0xB1, 0x08, 0x83, 0xC8, 0x0C, 0x82, 0x01, 0x81, 0xDB, 0x04,
+    0x80, 0x98, 0x04, 0x03, 0x67, 0x29, 0x67, 0x29, 0x46, 0x29, 0x83, 0x10, 0x8C, 0x8C, 0x03, 0x82,
+    0x04, 0x80, 0xB9, 0x09, 0x86, 0x8E, 0x02, 0x82, 0x9C, 0x04, 0x81, 0x05, 0xE9, 0x8E, 0x04, 0x8A,
+    0x8D, 0x01, 0x82, 0xFC, 0x01, 0x89, 0x9C, 0x04, 0x86, 0xBB, 0x0C, 0x81, 0x04, 0x84, 0x8C, 0x04,
+    0x83, 0x19, 0x8A, 0xB5, 0x0C, 0x88, 0xD1, 0x0B, 0x86, 0x07, 0x84, 0x8E, 0x08, 0x83, 0x0F, 0x84,
+    0xEF, 0x0B, 0x00, 0x23, 0x00, 0x86, 0x9B, 0x04, 0x83, 0xC5, 0x0C, 0x82, 0xF4, 0x07, 0x89, 0xB0,
+    0x08, 0x89, 0xCC, 0x0C, 0x01, 0x21, 0x00, 0xE8, 0x39, 0x81, 0xC6, 0x0A, 0x85, 0xE3, 0x0B, 0x81,
+    0xFF, 0x01, 0x02, 0x25, 0x29, 0xFF, 0xFF, 0x96, 0xB5, 0x84, 0x9A, 0x06, 0x01, 0x25, 0x21, 0xAB,
+    0x52, 0x82, 0x92, 0x04, 0x82, 0x89, 0x04, 0x01, 0x64, 0x00, 0x84, 0x00, 0x81, 0xC2, 0x0C, 0x81,
+    0xEF, 0x03, 0x82, 0xFF, 0x03, 0x00, 0x84, 0x00, 0x81, 0xA0, 0x04, 0x82, 0xED, 0x03, 0x84, 0x98,
+    0x04, 0x80, 0x0F, 0x01, 0xA5, 0x08, 0xC6, 0x10, 0x84, 0x09, 0x84, 0xD0, 0x0C, 0x80, 0x23, 0x81,
+    0x18, 0x80, 0x2E, 0x82, 0x2F, 0x82, 0xC0, 0x04, 0x02, 0x64, 0x00, 0xE6, 0x10, 0xA5, 0x08, 0x80,
+    0xBE, 0x0D, 0x87, 0xA6, 0x04, 0x80, 0x0A, 0x01, 0x84, 0x08, 0xA4, 0x08, 0x85, 0xCE, 0x08, 0x82,
+    0x81, 0x01, 0x82, 0xD8, 0x01, 0x00, 0x42, 0x08, 0x81, 0xA1, 0x08, 0x80, 0x0B, 0x83, 0x94, 0x0E,
+    0x82, 0x10, 0x84, 0x87, 0x04, 0x85, 0x92, 0x06, 0x85, 0x9A, 0x04, 0x85, 0xB8, 0x08, 0x8E, 0xB5,
+    0x04, 0x02, 0x41, 0x00, 0x83, 0x08, 0xA3, 0x10, 0x80, 0xB1, 0x03, 0x03, 0xA4, 0x10, 0x47, 0x21,
+    0x46, 0x21, 0x47, 0x21, 0x81, 0x01, 0x80, 0x9C, 0x04, 0x88, 0x8D, 0x04, 0x88, 0x8E, 0x04, 0x8B,
+    0x9C, 0x04, 0x84, 0xC1, 0x0C, 0x80, 0xA6, 0x08, 0x84, 0x06, 0x80, 0xEF, 0x08, 0x81, 0x09, 0x80,
+    0xAD, 0x08, 0x83, 0x97, 0x04, 0x00, 0xE4, 0x18, 0x85, 0xAD, 0x08, 0x81, 0x9D, 0x07, 0x82, 0x99,
+    0x0C, 0x84, 0x96, 0x09, 0x83, 0x80, 0x05, 0x80, 0x03, 0x84, 0xA1, 0x08, 0x84, 0xDB, 0x0F, 0x82,
+    0xA4, 0x02, 0xEA, 0xAC, 0x08, 0x82, 0x82, 0x01, 0x81, 0xF4, 0x03, 0x80, 0xD9, 0x0A, 0x81, 0x0A,
+    0x84, 0x91, 0x06, 0x83, 0x11, 0x80, 0x85, 0x01, 0x81, 0xEB, 0x0A, 0x81, 0x06, 0x84, 0xCC, 0x06,
+    0x81, 0xB7, 0x03, 0x83, 0xBD, 0x02, 0x83, 0xAE, 0x08, 0x87, 0xBF, 0x0F, 0x01, 0x83, 0x08, 0x43,
+    0x08, 0x89, 0xAB, 0x04, 0x82, 0x90, 0x04, 0x85, 0x98, 0x04, 0x84, 0x21, 0x80, 0x95, 0x04, 0x81,
+    0x8B, 0x03, 0x82, 0x95, 0x04, 0x82, 0xDE, 0x03, 0x81, 0xAD, 0x07, 0x82, 0xBC, 0x07, 0x82, 0x0C,
+    0x82, 0x13, 0x83, 0x05, 0x86, 0xB6, 0x08, 0x80, 0x66, 0x82, 0x65, 0x82, 0xDF, 0x0B, 0x06, 0x00,
+    0x00, 0xA8, 0x31, 0xAB, 0x52, 0x04, 0x21, 0x1C, 0xE7, 0xDB, 0xDE, 0x82, 0x10, 0x80, 0x90, 0x02,
+    0x82, 0x68, 0x80, 0x8A, 0x01, 0x82, 0xC7, 0x04, 0x01, 0x63, 0x00, 0xA4, 0x08, 0x83, 0x98, 0x04,
+    0x83, 0x01, 0x85, 0xFF, 0x03, 0x80, 0x47, 0x83, 0x08, 0x83, 0xA6, 0x08, 0x83, 0xA9, 0x04, 0x81,
+    0x01, 0x00, 0x65, 0x00, 0x84, 0x99, 0x04, 0x81, 0x05, 0x00, 0x84, 0x08, 0x81, 0x21, 0x81, 0xBC,
+    0x04, 0x83, 0x10, 0x02, 0x64, 0x00, 0xA5, 0x08, 0x84, 0x08, 0x83, 0x96, 0x04, 0x83, 0xA8, 0x04,
+    0x80, 0x0E, 0x84, 0xA2, 0x04, 0x84, 0x84, 0x01, 0x83, 0x9C, 0x04, 0x86, 0xCF, 0x01, 0x86, 0x87,
+    0x0A, 0x86, 0x82, 0x06, 0x87, 0xBA, 0x0A, 0x88, 0xAE, 0x08, 0x8B, 0x9B, 0x04, 0x83, 0xA2, 0x03,
+    0x80, 0x07, 0x80, 0x03, 0x01, 0x05, 0x19, 0x66, 0x29, 0x80, 0xD9, 0x03, 0x81, 0x99, 0x04, 0x80,
+    0x8E, 0x0C, 0x00, 0x26, 0x21, 0x86, 0xAD, 0x08, 0x00, 0xC5, 0x10, 0x81, 0xB2, 0x0C, 0x83, 0xBE,
+    0x08, 0x8C, 0xBD, 0x08, 0x80, 0x88, 0x04, 0x84, 0xC1, 0x0C, 0x80, 0xAD, 0x08, 0x84, 0x06, 0x80,
+    0x9A, 0x04, 0x82, 0xAD, 0x08, 0x02, 0x46, 0x29, 0x67, 0x29, 0x25, 0x21, 0x80, 0xED, 0x01, 0x87,
+    0x88, 0x03, 0x87, 0xF6, 0x03, 0x85, 0xB3, 0x0D, 0x83, 0x03, 0x87, 0x0F, 0x81, 0x08, 0x81, 0x72,
+    0xEC, 0x01, 0x82, 0x80, 0x04, 0x88, 0xAA, 0x08, 0x85, 0xD6, 0x0C, 0x83, 0x97, 0x04, 0x83, 0xB1,
+    0x08, 0x86, 0x93, 0x02, 0x83, 0x9B, 0x0F, 0x80, 0x01, 0x80, 0x8E, 0x0B, 0x84, 0xD0, 0x03, 0x02,
+    0x63, 0x08, 0xC4, 0x10, 0x63, 0x08, 0x89, 0xB5, 0x08, 0x83, 0xE9, 0x02, 0x85, 0x99, 0x04, 0x81,
+    0x95, 0x04, 0x81, 0x08, 0x86, 0x86, 0x03, 0x81, 0x16, 0x80, 0xFD, 0x0F, 0x00, 0x84, 0x08, 0x84,
+    0xEA, 0x0C, 0x86, 0xDC, 0x0B, 0x86, 0xB7, 0x07, 0x8C, 0x01, 0x05, 0x00, 0x00, 0x87, 0x29, 0x39,
+    0xC6, 0x1C, 0xE7, 0xF7, 0xBD, 0xC3, 0x18, 0x80, 0x90, 0x04, 0x83, 0x4F, 0x82, 0xE2, 0x08, 0x01,
+    0x84, 0x08, 0x64, 0x08, 0x84, 0x92, 0x04, 0x84, 0x9E, 0x0C, 0x84, 0x9A, 0x04, 0x80, 0x05, 0x80,
+    0xBB, 0x0C, 0x85, 0x8E, 0x04, 0x86, 0x01, 0x01, 0x85, 0x00, 0x85, 0x00, 0x83, 0x98, 0x04, 0x83,
+    0xDA, 0x0C, 0x80, 0x98, 0x04, 0x89, 0x01, 0x82, 0xC1, 0x08, 0x85, 0x73, 0x82, 0x85, 0x0D, 0x86,
+    0x78, 0x80, 0xEF, 0x09, 0x81, 0xB1, 0x05, 0x84, 0x97, 0x05, 0x80, 0x04, 0x80, 0xCF, 0x01, 0x82,
+    0x90, 0x04, 0x84, 0x96, 0x04, 0x89, 0xB1, 0x0C, 0x87, 0xC3, 0x0A, 0x8A, 0xC8, 0x0C, 0x82, 0xD6,
+    0x08, 0x82, 0xA0, 0x02, 0x85, 0xC1, 0x04, 0x80, 0x99, 0x04, 0x02, 0x83, 0x10, 0xC4, 0x18, 0x05,
+    0x21, 0x81, 0xF4, 0x07, 0x80, 0xB2, 0x08, 0x00, 0x46, 0x21, 0x80, 0x01, 0x80, 0xE8, 0x03, 0x81,
+    0xD3, 0x0C, 0x8C, 0x8F, 0x04, 0x83, 0xC1, 0x08, 0x80, 0xC1, 0x0C, 0x00, 0xC5, 0x10, 0x81, 0xA2,
+    0x08, 0x83, 0xAA, 0x08, 0x82, 0x93, 0x04, 0x00, 0xA3, 0x10, 0x81, 0x01, 0x01, 0x83, 0x10, 0xA4,
+    0x10, 0x80, 0xB8, 0x04, 0x02, 0x05, 0x21, 0x26, 0x21, 0x46, 0x29, 0x80, 0x01, 0x00, 0xC4, 0x18,
+    0x81, 0xEA, 0x03, 0x00, 0x20, 0x00, 0x84, 0xEE, 0x03, 0x84, 0x91, 0x07, 0x85, 0x03, 0x95, 0xB8,
+    0x0C, 0x86, 0x24, 0x91, 0x1A, 0xB9, 0xB3, 0x04, 0x86, 0xF6, 0x04, 0x90, 0x59, 0x82, 0xE2, 0x01,
+    0x85, 0xA2, 0x06, 0x85, 0x96, 0x04, 0x89, 0x91, 0x02, 0x82, 0x98, 0x04, 0x82, 0x91, 0x04, 0x84,
+    0xB5, 0x08, 0x85, 0xF4, 0x03, 0x84, 0x97, 0x08, 0x84, 0x09, 0x81, 0xE1, 0x02, 0x83, 0x86, 0x04,
+    0x8A, 0xB2, 0x08, 0x81, 0xA3, 0x04, 0x82, 0x20, 0x83, 0x86, 0x03, 0x81, 0x15, 0x00, 0x63, 0x08,
+    0x83, 0xB0, 0x08, 0x83, 0xB2, 0x08, 0x81, 0xED, 0x03, 0x84, 0xC5, 0x07, 0x82, 0xA0, 0x03, 0x84,
+    0xE4, 0x0C, 0x84, 0x4C, 0x82, 0xFD, 0x0C, 0x02, 0x01, 0x00, 0xC4, 0x10, 0x66, 0x29, 0x82, 0xBE,
+    0x08, 0x85, 0x1B, 0x80, 0x2B, 0x00, 0xA5, 0x08, 0x80, 0x83, 0x04, 0x86, 0xA7, 0x08, 0x86, 0x01,
+    0x00, 0x84, 0x00, 0x80, 0x01, 0x00, 0x85, 0x08, 0x8A, 0x92, 0x04, 0x80, 0x03, 0x00, 0xA5, 0x08,
+    0x80, 0x05, 0x80, 0x01, 0x85, 0xA9, 0x04, 0x86, 0xB0, 0x04, 0x88, 0xB8, 0x04, 0x83, 0xC5, 0x08,
+    0x80, 0x04, 0x00, 0x64, 0x08, 0x82, 0xD2, 0x04, 0x86, 0x99, 0x05, 0x85, 0x61, 0x88, 0xD6, 0x05,
+    0x82, 0xCE, 0x0C, 0x83, 0x9E, 0x04, 0x8B, 0xB0, 0x0C, 0x86, 0xDB, 0x0E, 0x82, 0x19, 0x00, 0x42,
+    0x08, 0x81, 0xA7, 0x06, 0x86, 0x9F, 0x04, 0x85, 0xA3, 0x02, 0x80, 0x0B, 0x00, 0x41, 0x08, 0x82,
+    0xB9, 0x02, 0x05, 0x62, 0x08, 0xC4, 0x10, 0x25, 0x21, 0x47, 0x21, 0x47, 0x29, 0x47, 0x29, 0x80,
+    0xB4, 0x08, 0x82, 0x9A, 0x04, 0x82, 0x9B, 0x04, 0x84, 0xAD, 0x08, 0x86, 0xC3, 0x0C, 0x83, 0xB9,
+    0x0C, 0x01, 0xA4, 0x10, 0xC4, 0x18, 0x81, 0xCA, 0x0C, 0x85, 0xCB, 0x0C, 0x81, 0x9D, 0x04, 0x01,
+    0xA3, 0x10, 0xA4, 0x10, 0x81, 0x96, 0x04, 0x80, 0xAD, 0x08, 0x02, 0x26, 0x21, 0xE5, 0x20, 0x62,
+    0x08, 0x83, 0xFD, 0x02, 0x88, 0x91, 0x03, 0x02, 0x01, 0x00, 0x42, 0x08, 0x41, 0x08, 0x84, 0xBA,
+    0x0C, 0x87, 0xBA, 0x0B, 0x91, 0xC6, 0x03, 0x87, 0x1A, 0x8A, 0x8C, 0x04, 0xB6, 0x98, 0x04, 0x82,
+    0x37, 0x85, 0x98, 0x05, 0x8C, 0x98, 0x04, 0x83, 0xC8, 0x0C, 0x82, 0x84, 0x06, 0x83, 0x9A, 0x04,
+    0x84, 0xF5, 0x01, 0x86, 0x9B, 0x04, 0x89, 0xA7, 0x08, 0x83, 0xB3, 0x02, 0x82, 0x94, 0x0F, 0x83,
+    0xA2, 0x04, 0x83, 0xF4, 0x0A, 0x86, 0xD4, 0x02, 0x84, 0x9B, 0x0C, 0x81, 0x96, 0x04, 0x85, 0xA3,
+    0x08, 0x84, 0xD2, 0x0C, 0x84, 0x9E, 0x08, 0x80, 0xF0, 0x07, 0x82, 0x9D, 0x08, 0x84, 0x94, 0x04,
+    0x84, 0x14, 0x83, 0x86, 0x08, 0x81, 0x14, 0x88, 0xF7, 0x0F, 0x86, 0xA6, 0x03, 0x84, 0xDD, 0x0B,
+    0x00, 0x02, 0x00, 0x82, 0x9E, 0x08, 0x82, 0xF7, 0x0B, 0x83, 0xFC, 0x0B, 0x80, 0xC3, 0x04, 0x8C,
+    0x95, 0x04, 0x82, 0x91, 0x08, 0x01, 0xA5, 0x08, 0x85, 0x08, 0x81, 0x9B, 0x04, 0x80, 0x88, 0x04,
+    0x80, 0x01, 0x82, 0x96, 0x04, 0x83, 0x01, 0x00, 0xA5, 0x00, 0x81, 0x9D, 0x04, 0x85, 0xA5, 0x04,
+    0x91, 0x01, 0x84, 0xF0, 0x0C, 0x83, 0x06, 0x88, 0x72, 0x83, 0x8F, 0x05, 0x86, 0xD8, 0x05, 0x82,
+    0x93, 0x04, 0x85, 0xD4, 0x0D, 0x81, 0xD1, 0x05, 0x80, 0x0C, 0x00, 0x42, 0x08, 0x88, 0xA0, 0x04,
+    0x81, 0x8C, 0x06, 0x86, 0x88, 0x02, 0x85, 0x08, 0x8C, 0xB7, 0x06, 0x83, 0xA5, 0x03, 0x80, 0x9B,
+    0x04, 0x03, 0xA3, 0x10, 0xE4, 0x18, 0x06, 0x21, 0x46, 0x21, 0x81, 0xD0, 0x0C, 0x82, 0xD1, 0x0C,
+    0x82, 0xD3, 0x0C, 0x84, 0xB8, 0x08, 0x83, 0x9B, 0x04, 0x80, 0xAF, 0x08, 0x83, 0x01, 0x81, 0xC8,
+    0x0C, 0x82, 0x98, 0x04, 0x80, 0xC1, 0x0C, 0x82, 0x98, 0x04, 0x00, 0xC4, 0x10, 0x80, 0xC4, 0x0C,
+    0x04, 0x46, 0x29, 0x87, 0x31, 0x87, 0x31, 0x46, 0x29, 0xC3, 0x18, 0x84, 0x91, 0x03, 0x89, 0x9E,
+    0x0C, 0x80, 0x98, 0x04, 0x80, 0x7B, 0x80, 0x51, 0x00, 0x41, 0x08, 0x80, 0x9D, 0x04, 0x86, 0xB0,
+    0x09, 0x82, 0x14, 0x8B, 0xF5, 0x03, 0x84, 0xAF, 0x03, 0x83, 0x10, 0xC4, 0xD7, 0x0C, 0x00, 0x20,
+    0x00, 0x95, 0x18, 0x8D, 0xBE, 0x0C, 0x84, 0x8E, 0x05, 0x85, 0xA8, 0x06, 0x86, 0xB1, 0x08, 0x85,
+    0xE3, 0x0A, 0x83, 0x08, 0x85, 0x8C, 0x0F, 0x84, 0x05, 0x84, 0xCB, 0x02, 0x84, 0x95, 0x08, 0x80,
+    0x02, 0x83, 0xDF, 0x0C, 0x81, 0x98, 0x04, 0x82, 0x03, 0x84, 0xA3, 0x04, 0x80, 0xD8, 0x03, 0x00,
+    0xA4, 0x08, 0x83, 0xE7, 0x03, 0x82, 0xB2, 0x08, 0x00, 0xA4, 0x08, 0x84, 0x80, 0x04, 0x82, 0x9E,
+    0x04, 0x82, 0x12, 0x00, 0x64, 0x08, 0x84, 0xB5, 0x08, 0x82, 0xE9, 0x0B, 0x82, 0x88, 0x04, 0x84,
+    0x9F, 0x08, 0x84, 0x92, 0x04, 0x81, 0xA3, 0x08, 0x81, 0x05, 0x82, 0xF8, 0x03, 0x88, 0x8D, 0x04,
+    0x82, 0x85, 0x04, 0x85, 0x11, 0x85, 0x8D, 0x04, 0x80, 0xCB, 0x08, 0x80, 0x8F, 0x04, 0x83, 0x01,
+    0x02, 0xA6, 0x00, 0x86, 0x00, 0xA6, 0x00, 0x85, 0x0A, 0x81, 0x01, 0x89, 0x27, 0x8A, 0x9C, 0x04,
+    0x80, 0xDF, 0x04, 0x80, 0x98, 0x04, 0x82, 0xB9, 0x08, 0x8B, 0x8E, 0x05, 0x83, 0xAC, 0x0D, 0x82,
+    0xD9, 0x05, 0x80, 0x8C, 0x08, 0x82, 0xCD, 0x0C, 0x84, 0x9C, 0x0E, 0x00, 0x42, 0x08, 0x89, 0xD1,
+    0x0C, 0x89, 0xDB, 0x0C, 0x85, 0x97, 0x04, 0x82, 0x9A, 0x06, 0x88, 0xE1, 0x0C, 0x86, 0x9D, 0x04,
+    0x83, 0xDE, 0x03, 0x00, 0x62, 0x08, 0x80, 0x9C, 0x0C, 0x02, 0x26, 0x21, 0x67, 0x29, 0x88, 0x29,
+    0x81, 0xD4, 0x0C, 0x80, 0x9C, 0x04, 0x01, 0x06, 0x19, 0x06, 0x19, 0x81, 0xB3, 0x08, 0x83, 0xD5,
+    0x0C, 0x82, 0xC6, 0x0C, 0x00, 0xC5, 0x18, 0x81, 0x91, 0x04, 0x80, 0x04, 0x81, 0x05, 0x84, 0xB1,
+    0x08, 0x80, 0x96, 0x04, 0x00, 0xE4, 0x18, 0x80, 0x1D, 0x04, 0x46, 0x21, 0x66, 0x29, 0x66, 0x29,
+    0x05, 0x21, 0x62, 0x10, 0x90, 0x8B, 0x03, 0x82, 0xA2, 0x07, 0x80, 0x01, 0x80, 0x9D, 0x04, 0x84,
+    0x0B, 0x81, 0xA4, 0x04, 0x85, 0x80, 0x04, 0x8C, 0x81, 0x04, 0x82, 0xD7, 0x0B, 0x83, 0x08, 0xC1,
+    0x97, 0x04, 0x95, 0x95, 0x04, 0x89, 0xE2, 0x01, 0x85, 0xA4, 0x04, 0x86, 0xA4, 0x0A, 0x83, 0xD5,
+    0x0C, 0x83, 0xB1, 0x06, 0x82, 0x8C, 0x04, 0x80, 0xBC, 0x02, 0x81, 0x85, 0x0F, 0x85, 0x88, 0x04,
+    0x86, 0x01, 0x82, 0xA3, 0x04, 0x86, 0xF0, 0x06, 0x84, 0xA4, 0x08, 0x84, 0x94, 0x0C, 0x80, 0xFF,
+    0x02, 0x86, 0xF1, 0x03, 0x83, 0xE6, 0x03, 0x82, 0x17, 0x81, 0xB1, 0x08, 0x01, 0x84, 0x08, 0xA5,
+    0x10, 0x85, 0x88, 0x04, 0x82, 0x07, 0x82, 0x04, 0x86, 0xE3, 0x0B, 0x81, 0xAA, 0x0C, 0x82, 0xFC,
+    0x0F, 0x81, 0xDD, 0x0C, 0x83, 0x8F, 0x04, 0x81, 0xA7, 0x04, 0x84, 0xD7, 0x03, 0x81, 0xC3, 0x0C,
+    0x83, 0xB6, 0x0C, 0x00, 0x85, 0x00, 0x81, 0x94, 0x04, 0x01, 0xA5, 0x08, 0xE6, 0x10, 0x81, 0xAC,
+    0x0C, 0x81, 0x03, 0x80, 0x0D, 0x86, 0x96, 0x04, 0x80, 0x01, 0x01, 0xA6, 0x08, 0xA6, 0x08, 0x80,
+    0x90, 0x04, 0x80, 0x02, 0x81, 0x01, 0x00, 0xC7, 0x08, 0x80, 0x03, 0x00, 0xA6, 0x08, 0x81, 0x0A,
+    0x02, 0x86, 0x00, 0x86, 0x00, 0x85, 0x00, 0x80, 0x02, 0x82, 0x01, 0x80, 0xD1, 0x08, 0x80, 0x26,
+    0x80, 0x33, 0x83, 0xA4, 0x04, 0x81, 0x47, 0x00, 0x65, 0x00, 0x82, 0x06, 0x00, 0x64, 0x08, 0x87,
+    0xFA, 0x0C, 0x82, 0x64, 0x00, 0x64, 0x08, 0x81, 0x7F, 0x83, 0x9F, 0x09, 0x84, 0xAA, 0x05, 0x80,
+    0xA3, 0x0C, 0x01, 0xA4, 0x10, 0x83, 0x10, 0x80, 0x9B, 0x04, 0x82, 0x90, 0x04, 0x83, 0xB7, 0x08,
+    0x84, 0x91, 0x04, 0x81, 0xF7, 0x01, 0x82, 0xEF, 0x01, 0x83, 0x9C, 0x04, 0x86, 0xA2, 0x06, 0x82,
+    0x87, 0x02, 0x81, 0xAC, 0x03, 0x88, 0xB6, 0x08, 0x83, 0xE2, 0x0A, 0x84, 0xD6, 0x08, 0x83, 0x90,
+    0x0B, 0x80, 0x9C, 0x04, 0x00, 0xC4, 0x18, 0x84, 0x9B, 0x04, 0x82, 0xD1, 0x0C, 0x84, 0xCF, 0x0C,
+    0x82, 0x9A, 0x04, 0x84, 0xB0, 0x08, 0x84, 0xAE, 0x08, 0x82, 0x96, 0x04, 0x05, 0xE5, 0x18, 0xE4,
+    0x18, 0x05, 0x19, 0x25, 0x21, 0x05, 0x21, 0xA3, 0x10, 0x91, 0xED, 0x07, 0x84, 0xFE, 0x02, 0x82,
+    0x9D, 0x04, 0x85, 0x97, 0x03, 0x86, 0x17, 0xD8, 0x82, 0x04, 0x94, 0x01, 0x84, 0xE1, 0x01, 0x84,
+    0xE6, 0x01, 0x83, 0x80, 0x01, 0x88, 0x86, 0x06, 0x85, 0x97, 0x04, 0x85, 0xA8, 0x08, 0x80, 0x91,
+    0x02, 0x01, 0x84, 0x08, 0x43, 0x08, 0x84, 0x0C, 0x86, 0x98, 0x0F, 0x82, 0x05, 0x86, 0xA8, 0x04,
+    0x83, 0x94, 0x0B, 0x85, 0xA0, 0x04, 0x81, 0x82, 0x04, 0x00, 0xA5, 0x08, 0x80, 0xF9, 0x02, 0x80,
+    0xBF, 0x0C, 0x81, 0x9E, 0x04, 0x80, 0xFF, 0x02, 0x83, 0x9E, 0x08, 0x82, 0x8A, 0x08, 0x83, 0x92,
+    0x04, 0x86, 0x90, 0x04, 0x84, 0x9E, 0x04, 0x81, 0xA4, 0x03, 0x89, 0xAC, 0x03, 0x01, 0x84, 0x00,
+    0xC5, 0x10, 0x80, 0xFB, 0x03, 0x81, 0x9B, 0x0C, 0x88, 0xA5, 0x08, 0x82, 0xD8, 0x03, 0x84, 0x98,
+    0x08, 0x00, 0xC6, 0x08, 0x81, 0xE7, 0x03, 0x00, 0x85, 0x08, 0x82, 0xF0, 0x03, 0x02, 0xC6, 0x08,
+    0xC6, 0x08, 0xA6, 0x08, 0x86, 0xAC, 0x08, 0x02, 0xA6, 0x08, 0xA5, 0x00, 0xA5, 0x00, 0x82, 0x93,
+    0x04, 0x80, 0x01, 0x00, 0xA7, 0x00, 0x80, 0x96, 0x04, 0x80, 0xA1, 0x04, 0x80, 0x07, 0x80, 0x1A,
+    0x82, 0x9C, 0x04, 0x81, 0x1F, 0x81, 0x03, 0x81, 0x98, 0x04, 0x81, 0x3C, 0x81, 0xD0, 0x04, 0x80,
+    0x35, 0x80, 0xD1, 0x04, 0x00, 0xC6, 0x10, 0x80, 0x56, 0x82, 0x98, 0x04, 0x81, 0x65, 0x82, 0x84,
+    0x05, 0x84, 0x01, 0x01, 0xA5, 0x08, 0x84, 0x08, 0x86, 0xB4, 0x08, 0x81, 0xA0, 0x08, 0x82, 0xE5,
+    0x09, 0x00, 0x83, 0x10, 0x80, 0x98, 0x04, 0x82, 0xD8, 0x01, 0x85, 0xAA, 0x08, 0x86, 0xF6, 0x05,
+    0x83, 0xC8, 0x08, 0x87, 0xAD, 0x0A, 0x81, 0xD1, 0x0C, 0x8A, 0xC1, 0x08, 0x82, 0xAE, 0x04, 0x85,
+    0xA0, 0x04, 0x87, 0xF2, 0x0C, 0x83, 0xDB, 0x06, 0x01, 0x41, 0x08, 0x83, 0x10, 0x80, 0x9C, 0x04,
+    0x00, 0x47, 0x21, 0x80, 0x9B, 0x04, 0x82, 0xD1, 0x0C, 0x82, 0x97, 0x04, 0x80, 0x01, 0x82, 0x8E,
+    0x04, 0x84, 0xAA, 0x08, 0x81, 0x96, 0x04, 0x01, 0xA3, 0x10, 0xC4, 0x10, 0x81, 0xAD, 0x04, 0x00,
+    0xE4, 0x18, 0x81, 0x01, 0x00, 0x62, 0x08, 0x92, 0x8F, 0x03, 0x85, 0xC9, 0x0F, 0x81, 0x89, 0x08,
+    0x82, 0x02, 0x88, 0x17, 0x85, 0xA9, 0x03, 0xD9, 0xA1, 0x08, 0x90, 0x89, 0x01, 0x87, 0x98, 0x04,
+    0x92, 0x01, 0x85, 0xAF, 0x08, 0x86, 0xAA, 0x02, 0x01, 0x62, 0x08, 0x62, 0x08, 0x84, 0x8B, 0x04,
+    0x84, 0xA0, 0x08, 0x87, 0x01, 0x82, 0xFE, 0x03, 0x88, 0x0D, 0x03, 0x63, 0x08, 0xC5, 0x10, 0x27,
+    0x21, 0xA5, 0x10, 0x80, 0x88, 0x03, 0x03, 0x43, 0x00, 0xA6, 0x08, 0x08, 0x11, 0xA5, 0x08, 0x81,
+    0xA6, 0x08, 0x83, 0x95, 0x04, 0x86, 0x98, 0x04, 0x81, 0x98, 0x08, 0x81, 0x9E, 0x03, 0x84, 0xA7,
+    0x0C, 0x84, 0x9A, 0x04, 0x82, 0x94, 0x04, 0x84, 0x04, 0x80, 0xC8, 0x03, 0x00, 0xA5, 0x08, 0x81,
+    0xC8, 0x03, 0x00, 0xA6, 0x08, 0x80, 0xFB, 0x03, 0x81, 0xD8, 0x03, 0x82, 0xF9, 0x03, 0x00, 0xE7,
+    0x10, 0x80, 0xE9, 0x07, 0x85, 0x83, 0x04, 0x80, 0xA4, 0x0C, 0x86, 0xBC, 0x0C, 0x80, 0x1D, 0x00,
+    0xC6, 0x08, 0x82, 0x1C, 0x81, 0xFD, 0x03, 0x80, 0x09, 0x83, 0x95, 0x04, 0x83, 0xAF, 0x08, 0x80,
+    0x91, 0x04, 0x00, 0xC7, 0x08, 0x80, 0x0F, 0x00, 0xE7, 0x10, 0x81, 0xB5, 0x08, 0x81, 0x0A, 0x80,
+    0x9A, 0x04, 0x80, 0x98, 0x04, 0x81, 0x4B, 0x84, 0xFF, 0x03, 0x00, 0x65, 0x00, 0x80, 0xAB, 0x08,
+    0x02, 0x84, 0x00, 0xC6, 0x10, 0xC5, 0x08, 0x81, 0xBD, 0x08, 0x82, 0x01, 0x87, 0xAC, 0x09, 0x82,
+    0xA6, 0x04, 0x81, 0xB6, 0x05, 0x81, 0xD9, 0x0D, 0x83, 0x98, 0x04, 0x01, 0x83, 0x08, 0x84, 0x08,
+    0x82, 0xBB, 0x01, 0x81, 0x81, 0x04, 0x86, 0xF6, 0x09, 0x84, 0xAF, 0x0E, 0x83, 0x04, 0x01, 0x63,
+    0x08, 0xC4, 0x10, 0x81, 0xB5, 0x04, 0x85, 0xBF, 0x0E, 0x83, 0xC0, 0x08, 0x85, 0x92, 0x04, 0x82,
+    0x0E, 0x00, 0x62, 0x08, 0x87, 0xDE, 0x0C, 0x85, 0xC4, 0x06, 0x84, 0xBE, 0x08, 0x84, 0xE0, 0x0B,
+    0x00, 0x42, 0x08, 0x80, 0x9C, 0x04, 0x02, 0x05, 0x19, 0x26, 0x21, 0x46, 0x21, 0x81, 0xD1, 0x0C,
+    0x00, 0x06, 0x21, 0x81, 0xCA, 0x0C, 0x81, 0x8E, 0x04, 0x80, 0x9A, 0x04, 0x81, 0x9C, 0x04, 0x81,
+    0x07, 0x80, 0x96, 0x04, 0x81, 0xAD, 0x08, 0x01, 0x05, 0x19, 0x05, 0x21, 0x80, 0x96, 0x04, 0x01,
+    0xA3, 0x18, 0x21, 0x08, 0x8F, 0x89, 0x03, 0x87, 0x8E, 0x03, 0x89, 0xC0, 0x0B, 0x88, 0x1B, 0x01,
+    0x21, 0x00, 0x41, 0x00, 0x82, 0xBC, 0x0C, 0x8C, 0xB8, 0x08, 0xC6, 0xC7, 0x08, 0x8D, 0xA6, 0x0D,
+    0x89, 0x99, 0x04, 0x87, 0xBB, 0x0C, 0x86, 0xA5, 0x04, 0x88, 0xAE, 0x08, 0x86, 0xAC, 0x0C, 0x83,
+    0xAB, 0x02, 0x01, 0x83, 0x08, 0xA4, 0x10, 0x87, 0x94, 0x04, 0x85, 0xB5, 0x08, 0x83, 0xD0, 0x02,
+    0x01, 0x63, 0x08, 0xA4, 0x08, 0x80, 0xC0, 0x02, 0x83, 0xB3, 0x08, 0x83, 0x05, 0x03, 0x64, 0x08,
+    0xE6, 0x10, 0x48, 0x21, 0xC6, 0x10, 0x81, 0xF9, 0x02, 0x01, 0xA5, 0x08, 0x28, 0x19, 0x82, 0x06,
+    0x84, 0xAA, 0x0B, 0x84, 0x99, 0x04, 0x84, 0xD9, 0x0C, 0x80, 0xAF, 0x0C, 0x82, 0xA9, 0x0C, 0x80,
+    0xF0, 0x0F, 0x82, 0x01, 0x80, 0x8A, 0x04, 0x87, 0xC4, 0x07, 0x82, 0xFC, 0x03, 0x00, 0xC7, 0x08,
+    0x80, 0xF0, 0x03, 0x80, 0xE3, 0x03, 0x81, 0xDF, 0x03, 0x81, 0xFA, 0x03, 0x80, 0x9D, 0x0C, 0x83,
+    0xAA, 0x0C, 0x80, 0xCC, 0x0C, 0x86, 0xB6, 0x0C, 0x80, 0x9E, 0x04, 0x83, 0x11, 0x84, 0x0D, 0x81,
+    0x8B, 0x04, 0x80, 0x2C, 0x81, 0x97, 0x04, 0x81, 0xAA, 0x04, 0x81, 0x07, 0x06, 0xA6, 0x08, 0xE7,
+    0x08, 0xE7, 0x08, 0xE7, 0x10, 0x28, 0x11, 0x08, 0x11, 0xA7, 0x08, 0x82, 0x97, 0x04, 0x81, 0xC9,
+    0x0C, 0x82, 0xB8, 0x0C, 0x84, 0x82, 0x0D, 0x80, 0x99, 0x04, 0x82, 0x05, 0x00, 0x85, 0x08, 0x80,
+    0x6B, 0x80, 0x02, 0x00, 0x44, 0x00, 0x81, 0xAF, 0x08, 0x80, 0x04, 0x86, 0xA6, 0x08, 0x81, 0x01,
+    0x01, 0x64, 0x08, 0x84, 0x08, 0x81, 0x9D, 0x04, 0x80, 0x97, 0x01, 0x86, 0xC2, 0x01, 0x81, 0xC5,
+    0x0C, 0x85, 0x97, 0x04, 0x8A, 0xEF, 0x05, 0x01, 0x63, 0x08, 0xA4, 0x10, 0x80, 0xBD, 0x0E, 0x83,
+    0xC7, 0x0C, 0x81, 0x85, 0x02, 0x83, 0xDF, 0x0C, 0x87, 0x9A, 0x08, 0x80, 0x01, 0x83, 0xD0, 0x0C,
+    0x82, 0xAE, 0x02, 0x88, 0xC3, 0x02, 0x84, 0x96, 0x0F, 0x85, 0xFC, 0x0F, 0x80, 0xB9, 0x04, 0x04,
+    0xA4, 0x10, 0xE5, 0x18, 0x46, 0x21, 0x67, 0x29, 0x47, 0x29, 0x80, 0x9A, 0x04, 0x81, 0xA0, 0x08,
+    0x82, 0x9B, 0x04, 0x81, 0x96, 0x04, 0x84, 0xAD, 0x08, 0x81, 0xAF, 0x08, 0x00, 0xC4, 0x18, 0x81,
+    0xAD, 0x08, 0x82, 0x8D, 0x03, 0x87, 0xD8, 0x03, 0x87, 0x87, 0x04, 0x83, 0x46, 0x84, 0x43, 0x84,
+    0xAA, 0x04, 0x84, 0x5E, 0x86, 0x27, 0x85, 0x5C, 0xCD, 0x01, 0x91, 0x54, 0x84, 0xD1, 0x0D, 0x96,
+    0xA7, 0x08, 0x81, 0x04, 0x87, 0xFE, 0x03, 0x87, 0x8D, 0x04, 0x87, 0xBF, 0x02, 0x82, 0x0C, 0x83,
+    0xA8, 0x08, 0x81, 0xC0, 0x02, 0x80, 0x99, 0x0B, 0x86, 0xFD, 0x03, 0x81, 0x86, 0x07, 0x00, 0x84,
+    0x08, 0x81, 0xC9, 0x0C, 0x82, 0x81, 0x04, 0x80, 0xF5, 0x03, 0x82, 0x11, 0x80, 0x18, 0x00, 0x63,
+    0x00, 0x81, 0x14, 0x83, 0xA1, 0x08, 0x82, 0xAD, 0x08, 0x82, 0x07, 0x81, 0xB5, 0x03, 0x80, 0x24,
+    0x81, 0x93, 0x04, 0x02, 0x85, 0x00, 0xE7, 0x10, 0x07, 0x11, 0x80, 0xB9, 0x03, 0x81, 0xDD, 0x07,
+    0x84, 0xE0, 0x07, 0x80, 0xF9, 0x0B, 0x80, 0xEC, 0x03, 0x81, 0xF3, 0x03, 0x81, 0x97, 0x04, 0x83,
+    0x84, 0x04, 0x84, 0x80, 0x04, 0x86, 0xB9, 0x0C, 0x82, 0x99, 0x04, 0x83, 0x9D, 0x08, 0x80, 0x06,
+    0x82, 0x24, 0x80, 0x98, 0x04, 0x81, 0xB7, 0x0C, 0x82, 0xA1, 0x08, 0x80, 0xC9, 0x04, 0x81, 0xA2,
+    0x04, 0x03, 0xE7, 0x10, 0x08, 0x11, 0xE7, 0x08, 0xE8, 0x10, 0x81, 0x07, 0x82, 0x3F, 0x80, 0xEA,
+    0x04, 0x82, 0x98, 0x04, 0x00, 0xC6, 0x08, 0x85, 0xEA, 0x04, 0x82, 0x97, 0x0D, 0x84, 0x82, 0x05,
+    0x84, 0xB0, 0x0D, 0x84, 0xCD, 0x0D, 0x81, 0x05, 0x01, 0x63, 0x08, 0x64, 0x08, 0x80, 0xCC, 0x0C,
+    0x81, 0xE6, 0x0D, 0x87, 0xC7, 0x01, 0x8A, 0x84, 0x0A, 0x82, 0xBC, 0x0C, 0x81, 0xA8, 0x04, 0x82,
+    0x01, 0x82, 0xC7, 0x08, 0x86, 0xA6, 0x08, 0x83, 0xCA, 0x08, 0x80, 0x8E, 0x04, 0x86, 0x98, 0x04,
+    0x87, 0x07, 0x85, 0xCF, 0x06, 0x8A, 0x9D, 0x04, 0x89, 0xD3, 0x0C, 0x00, 0x05, 0x21, 0x81, 0xCF,
+    0x0C, 0x00, 0x05, 0x21, 0x81, 0xD0, 0x0C, 0x83, 0xC9, 0x0C, 0x80, 0x07, 0x80, 0xAF, 0x08, 0x03,
+    0x05, 0x19, 0x05, 0x19, 0xC4, 0x18, 0x82, 0x10, 0x82, 0x93, 0x04, 0x86, 0xFB, 0x03, 0x8B, 0xAD,
+    0x0B, 0x86, 0x0B, 0x84, 0x08, 0x86, 0xA9, 0x04, 0x84, 0xC8, 0x0C, 0x83, 0x09, 0x8A, 0xDD, 0x0C,
+    0x8C, 0xE9, 0x0C, 0xCF, 0xAB, 0x04, 0x87, 0xA4, 0x08, 0x89, 0x9F, 0x01, 0x84, 0xD7, 0x0E, 0x80,
+    0xD2, 0x03, 0x83, 0xD1, 0x0E, 0x80, 0x8D, 0x02, 0x80, 0x9F, 0x02, 0x84, 0xFD, 0x0E, 0x86, 0x8F,
+    0x04, 0x87, 0xBD, 0x0C, 0x80, 0x83, 0x04, 0x00, 0x63, 0x00, 0x82, 0x90, 0x04, 0x82, 0x92, 0x04,
+    0x83, 0x98, 0x04, 0x80, 0xAD, 0x0F, 0x80, 0xF0, 0x03, 0x81, 0x85, 0x04, 0x00, 0x64, 0x08, 0x82,
+    0xFD, 0x02, 0x82, 0x9B, 0x04, 0x83, 0x85, 0x03, 0x81, 0xA8, 0x04, 0x84, 0x08, 0x81, 0x01, 0x81,
+    0x82, 0x04, 0x81, 0xAE, 0x04, 0x82, 0x94, 0x04, 0x83, 0xB7, 0x03, 0x00, 0x69, 0x21, 0x80, 0x98,
+    0x04, 0x87, 0xC1, 0x03, 0x84, 0x93, 0x04, 0x83, 0xF5, 0x03, 0x82, 0x07, 0x85, 0x01, 0x81, 0x0C,
+    0x82, 0x11, 0x82, 0x06, 0x82, 0x01, 0x01, 0xA7, 0x00, 0xC7, 0x00, 0x83, 0xB0, 0x0C, 0x01, 0xA6,
+    0x00, 0xA7, 0x08, 0x82, 0x07, 0x81, 0xC6, 0x0C, 0x80, 0xA1, 0x08, 0x81, 0xD3, 0x0C, 0x84, 0xBD,
+    0x08, 0x01, 0xA6, 0x00, 0xC6, 0x08, 0x80, 0x9E, 0x04, 0x80, 0x0E, 0x82, 0xD3, 0x08, 0x82, 0x9A,
+    0x04, 0x83, 0x05, 0x80, 0x57, 0x01, 0x85, 0x08, 0xA5, 0x08, 0x85, 0xD4, 0x0C, 0x82, 0xBE, 0x0C,
+    0x80, 0xA2, 0x04, 0x86, 0x87, 0x01, 0x85, 0xA4, 0x01, 0x87, 0xE4, 0x09, 0x81, 0x06, 0x80, 0x07,
+    0x87, 0xE5, 0x01, 0x83, 0xA1, 0x0A, 0x81, 0x05, 0x86, 0x9A, 0x0A, 0x84, 0x9A, 0x04, 0x84, 0xC3,
+    0x0E, 0x82, 0x91, 0x02, 0x86, 0x98, 0x04, 0x87, 0x9C, 0x04, 0x85, 0xC9, 0x03, 0x84, 0xD6, 0x0C,
+    0x86, 0xB5, 0x04, 0x84, 0xAC, 0x03, 0x80, 0xD8, 0x08, 0x01, 0xA3, 0x10, 0xC4, 0x18, 0x80, 0x8F,
+    0x04, 0x81, 0xA5, 0x08, 0x83, 0x01, 0x80, 0xC1, 0x0C, 0x80, 0x97, 0x04, 0x01, 0xA3, 0x10, 0x41,
+    0x08, 0x85, 0xD7, 0x03, 0x84, 0x93, 0x07, 0x84, 0x44, 0x84, 0x8D, 0x04, 0x81, 0x85, 0x09, 0x83,
+    0xA2, 0x08, 0x86, 0xA5, 0x08, 0x83, 0xBB, 0x0C, 0x83, 0x1D, 0x82, 0xC5, 0x08, 0x88, 0xFD, 0x03,
+    0x84, 0xF5, 0x04, 0x00, 0x41, 0x08, 0xC9, 0x8E, 0x04, 0x91, 0xCB, 0x0C, 0x83, 0xE3, 0x05, 0x88,
+    0xA8, 0x05, 0x83, 0xA8, 0x01, 0x83, 0x9D, 0x06, 0x01, 0x42, 0x08, 0x63, 0x08, 0x80, 0xB6, 0x06,
+    0x81, 0xB1, 0x08, 0x01, 0x42, 0x08, 0x43, 0x08, 0x80, 0xEE, 0x03, 0x84, 0x8D, 0x0C, 0x86, 0x8F,
+    0x04, 0x84, 0xAD, 0x02, 0x81, 0x8E, 0x04, 0x81, 0x86, 0x04, 0x82, 0xDC, 0x02, 0x81, 0x04, 0x84,
+    0xAC, 0x0C, 0x02, 0x84, 0x08, 0xC5, 0x10, 0xA5, 0x10, 0x80, 0xF2, 0x02, 0x81, 0x8D, 0x04, 0x80,
+    0x93, 0x04, 0x00, 0x63, 0x00, 0x80, 0xF7, 0x02, 0x82, 0xBF, 0x0F, 0x85, 0xD6, 0x0F, 0x82, 0xA5,
+    0x07, 0x82, 0x05, 0x82, 0xA9, 0x08, 0x83, 0xAE, 0x03, 0x84, 0xC4, 0x07, 0x80, 0xB3, 0x03, 0x80,
+    0xFB, 0x0F, 0x00, 0x28, 0x19, 0x84, 0xDB, 0x07, 0x81, 0x96, 0x04, 0x80, 0x90, 0x08, 0x81, 0xDD,
+    0x03, 0x82, 0x95, 0x08, 0x82, 0xFB, 0x03, 0x82, 0xB2, 0x08, 0x80, 0x05, 0x00, 0xA5, 0x00, 0x80,
+    0x09, 0x00, 0x07, 0x11, 0x81, 0x0D, 0x80, 0xDB, 0x0C, 0x80, 0xED, 0x03, 0x81, 0x93, 0x04, 0x80,
+    0x94, 0x04, 0x81, 0x01, 0x01, 0xC7, 0x08, 0xC7, 0x00, 0x84, 0xA1, 0x04, 0x85, 0x01, 0x82, 0xF6,
+    0x0C, 0x83, 0x01, 0x80, 0x22, 0x80, 0x01, 0x80, 0x84, 0x0D, 0x83, 0xFB, 0x0C, 0x00, 0x85, 0x08,
+    0x80, 0x06, 0x82, 0x98, 0x04, 0x80, 0x05, 0x82, 0x85, 0x05, 0x86, 0xAE, 0x08, 0x81, 0x97, 0x01,
+    0x81, 0xBA, 0x08, 0x87, 0xA0, 0x05, 0x84, 0xC9, 0x09, 0x85, 0x01, 0x85, 0x99, 0x04, 0x80, 0xE7,
+    0x01, 0x80, 0xF1, 0x01, 0x87, 0x9B, 0x04, 0x82, 0xA2, 0x08, 0x83, 0xB7, 0x04, 0x85, 0xAA, 0x04,
+    0x80, 0x88, 0x02, 0x85, 0xC9, 0x0C, 0x80, 0xA5, 0x06, 0x81, 0xA3, 0x02, 0x84, 0xB7, 0x08, 0x85,
+    0xCA, 0x08, 0x85, 0xDA, 0x03, 0x85, 0x8E, 0x04, 0x82, 0xC5, 0x03, 0x86, 0x0B, 0x85, 0xED, 0x02,
+    0x80, 0xD3, 0x04, 0x82, 0x9C, 0x04, 0x80, 0x92, 0x04, 0x80, 0xB5, 0x08, 0x80, 0xAF, 0x08, 0x00,
+    0xE4, 0x18, 0x83, 0xC3, 0x0C, 0x81, 0x01, 0x84, 0x9B, 0x04, 0x87, 0xD1, 0x04, 0x87, 0xE4, 0x04,
+    0x83, 0x90, 0x03, 0x83, 0x96, 0x03, 0x83, 0x29, 0x80, 0x08, 0x00, 0x41, 0x08, 0x81, 0xB2, 0x0D,
+    0x85, 0xE5, 0x0C, 0x89, 0xC6, 0x03, 0x80, 0x2C, 0x81, 0x18, 0xB4, 0x84, 0x04, 0x00, 0x20, 0x00,
+    0x91, 0x14, 0x00, 0x41, 0x08, 0x92, 0x98, 0x04, 0x88, 0xB0, 0x08, 0x81, 0x07, 0x81, 0xEB, 0x0E,
+    0x83, 0x9A, 0x04, 0x82, 0xB5, 0x0A, 0x80, 0x8B, 0x02, 0x80, 0x02, 0x04, 0x42, 0x08, 0xA4, 0x10,
+    0x84, 0x10, 0x84, 0x10, 0x83, 0x08, 0x82, 0xD0, 0x0A, 0x87, 0x99, 0x04, 0x87, 0xB1, 0x08, 0x80,
+    0x91, 0x04, 0x81, 0x98, 0x04, 0x81, 0x9D, 0x04, 0x81, 0x91, 0x0B, 0x83, 0x97, 0x04, 0x80, 0xBA,
+    0x0C, 0x82, 0x10, 0x83, 0xA5, 0x08, 0x80, 0x9D, 0x07, 0x86, 0x83, 0x03, 0x82, 0x93, 0x04, 0x80,
+    0xCC, 0x0F, 0x80, 0x95, 0x03, 0x80, 0x02, 0x00, 0xA5, 0x08, 0x80, 0xB2, 0x03, 0x82, 0xA8, 0x08,
+    0x04, 0x63, 0x00, 0xA5, 0x08, 0x07, 0x11, 0x85, 0x08, 0x64, 0x08, 0x83, 0xD5, 0x0B, 0x82, 0xB0,
+    0x03, 0x00, 0xA5, 0x08, 0x80, 0x82, 0x04, 0x82, 0xAD, 0x08, 0x80, 0x06, 0x80, 0x85, 0x04, 0x81,
+    0x9B, 0x04, 0x82, 0x8A, 0x04, 0x82, 0x01, 0x00, 0xC6, 0x00, 0x85, 0xED, 0x03, 0x82, 0xF7, 0x03,
+    0x00, 0xC6, 0x00, 0x81, 0x0D, 0x80, 0x8E, 0x04, 0x02, 0xC7, 0x08, 0xC8, 0x08, 0xE8, 0x08, 0x80,
+    0x05, 0x00, 0xA7, 0x00, 0x87, 0x86, 0x04, 0x80, 0xA4, 0x08, 0x84, 0x08, 0x88, 0xA2, 0x04, 0x82,
+    0x99, 0x04, 0x82, 0xC8, 0x0C, 0x84, 0x65, 0x89, 0xBC, 0x0C, 0x84, 0x97, 0x04, 0x88, 0x8E, 0x01,
+    0x8A, 0x96, 0x04, 0x84, 0xC6, 0x0C, 0x83, 0xDC, 0x01, 0x81, 0x98, 0x04, 0x00, 0x83, 0x08, 0x81,
+    0x99, 0x04, 0x81, 0x03, 0x84, 0xDE, 0x01, 0x85, 0xB5, 0x08, 0x82, 0xFA, 0x01, 0x84, 0xA7, 0x06,
+    0x83, 0x94, 0x04, 0x84, 0xBF, 0x03, 0x86, 0xDC, 0x0C, 0x86, 0xD0, 0x03, 0x88, 0xA4, 0x08, 0x8B,
+    0xB9, 0x08, 0x85, 0x8B, 0x0C, 0x83, 0xCA, 0x03, 0x01, 0x42, 0x08, 0x62, 0x08, 0x80, 0xD4, 0x0C,
+    0x03, 0xE4, 0x18, 0xC4, 0x18, 0xC4, 0x18, 0xA3, 0x10, 0x83, 0x80, 0x03, 0x81, 0x21, 0x80, 0x9D,
+    0x03, 0x82, 0xEE, 0x03, 0x87, 0xFA, 0x02, 0x82, 0x3E, 0x00, 0x41, 0x00, 0x82, 0x94, 0x04, 0x83,
+    0x3C, 0x88, 0x9C, 0x03, 0x84, 0x96, 0x0D, 0x89, 0x49, 0x86, 0x98, 0x04, 0x88, 0x0C, 0xAF, 0x97,
+    0x04, 0x00, 0x41, 0x00, 0x97, 0x4C, 0x81, 0x94, 0x01, 0x8C, 0x98, 0x04, 0x86, 0xCA, 0x09, 0x82,
+    0x01, 0x85, 0xB7, 0x0A, 0x86, 0x8F, 0x02, 0x00, 0x42, 0x00, 0x80, 0xEC, 0x03, 0x01, 0xA4, 0x10,
+    0xA4, 0x10, 0x81, 0xB1, 0x08, 0x88, 0xE7, 0x0A, 0x81, 0xC9, 0x02, 0x83, 0x91, 0x0F, 0x81, 0xA9,
+    0x08, 0x82, 0xE8, 0x02, 0x01, 0x64, 0x08, 0xA4, 0x08, 0x80, 0x8A, 0x04, 0x84, 0xEF, 0x02, 0x80,
+    0xA2, 0x04, 0x80, 0xFB, 0x03, 0x80, 0x94, 0x07, 0x80, 0xA3, 0x07, 0x8A, 0x95, 0x07, 0x83, 0x8D,
+    0x03, 0x00, 0xC5, 0x10, 0x81, 0x17, 0x80, 0x01, 0x01, 0xC5, 0x08, 0xC6, 0x08, 0x83, 0x07, 0x80,
+    0xB7, 0x07, 0x01, 0xC6, 0x10, 0xC6, 0x10, 0x80, 0x09, 0x81, 0xD3, 0x08, 0x85, 0xB9, 0x03, 0x86,
+    0xB2, 0x0C, 0x83, 0xB0, 0x08, 0x82, 0x85, 0x04, 0x83, 0x99, 0x04, 0x80, 0x01, 0x00, 0xE7, 0x08,
+    0x80, 0xFC, 0x03, 0x81, 0xA4, 0x0C, 0x00, 0xC6, 0x08, 0x80, 0x92, 0x04, 0x01, 0xC7, 0x08, 0xE8,
+    0x08, 0x83, 0x01, 0x80, 0x08, 0x82, 0x9F, 0x08, 0x85, 0x21, 0x80, 0x9B, 0x08, 0x81, 0x1E, 0x8A,
+    0xB9, 0x08, 0x80, 0xDE, 0x08, 0x00, 0xA6, 0x08, 0x82, 0xD6, 0x04, 0x81, 0xAE, 0x08, 0x80, 0x80,
+    0x01, 0x00, 0x84, 0x08, 0x85, 0xBC, 0x0C, 0x87, 0xA1, 0x04, 0x88, 0x8A, 0x01, 0x85, 0xAA, 0x01,
+    0x82, 0x01, 0x86, 0x98, 0x0E, 0x88, 0xE9, 0x05, 0x80, 0x95, 0x04, 0x82, 0x9D, 0x04, 0x80, 0x98,
+    0x04, 0x85, 0xB0, 0x04, 0x86, 0x9E, 0x04, 0x80, 0x8E, 0x04, 0x81, 0xAB, 0x04, 0x83, 0x94, 0x02,
+    0x01, 0x63, 0x08, 0xA3, 0x10, 0x85, 0x99, 0x04, 0x8A, 0xAC, 0x08, 0x87, 0xAB, 0x08, 0x83, 0xED,
+    0x0A, 0x86, 0xC7, 0x02, 0x83, 0xF5, 0x03, 0x82, 0xD9, 0x03, 0x89, 0xB9, 0x03, 0x81, 0xD8, 0x04,
+    0x82, 0x94, 0x04, 0x85, 0xA9, 0x0C, 0x85, 0xCA, 0x04, 0x86, 0x45, 0x82, 0x8F, 0x09, 0x90, 0x3D,
+    0x85, 0xC7, 0x0C, 0x83, 0x12, 0x8A, 0xB3, 0x03, 0xAE, 0x8D, 0x04, 0x98, 0x01, 0x8A, 0x4C, 0x89,
+    0x93, 0x05, 0x8A, 0xE5, 0x0D, 0x84, 0x97, 0x06, 0x85, 0xC0, 0x0E, 0x86, 0xDB, 0x0E, 0x81, 0xA6,
+    0x02, 0x81, 0xC9, 0x06, 0x84, 0xD4, 0x06, 0x86, 0xCC, 0x02, 0x83, 0x0B, 0x81, 0xA1, 0x08, 0x80,
+    0xDD, 0x06, 0x81, 0xCD, 0x0C, 0x86, 0x87, 0x07, 0x00, 0x42, 0x00, 0x80, 0xBC, 0x0C, 0x03, 0xA5,
+    0x08, 0x27, 0x19, 0x68, 0x21, 0xE6, 0x10, 0x81, 0x9B, 0x04, 0x83, 0xFC, 0x02, 0x88, 0x8D, 0x03,
+    0x87, 0xBF, 0x0C, 0x86, 0xB0, 0x03, 0x00, 0x84, 0x00, 0x80, 0x23, 0x87, 0xF7, 0x0F, 0x81, 0xCC,
+    0x0C, 0x00, 0x85, 0x00, 0x82, 0xC5, 0x0C, 0x80, 0xD6, 0x03, 0x80, 0x04, 0x80, 0xEC, 0x03, 0x81,
+    0x8F, 0x04, 0x81, 0xF9, 0x03, 0x00, 0xC6, 0x00, 0x83, 0x08, 0x82, 0xFA, 0x03, 0x00, 0xC6, 0x08,
+    0x80, 0x94, 0x04, 0x02, 0x2A, 0x09, 0x29, 0x09, 0x09, 0x09, 0x80, 0x01, 0x03, 0x08, 0x09, 0xE8,
+    0x08, 0x08, 0x09, 0x29, 0x11, 0x80, 0x98, 0x04, 0x00, 0xC7, 0x08, 0x81, 0x19, 0x81, 0x05, 0x82,
+    0xB6, 0x04, 0x80, 0x1D, 0x00, 0x07, 0x11, 0x80, 0xE2, 0x0C, 0x81, 0xB6, 0x04, 0x81, 0x15, 0x82,
+    0x07, 0x80, 0x08, 0x81, 0x04, 0x83, 0xB2, 0x08, 0x80, 0xFC, 0x04, 0x81, 0x99, 0x04, 0x80, 0x04,
+    0x81, 0xA2, 0x05, 0x80, 0x5A, 0x80, 0x02, 0x86, 0xC6, 0x0C, 0x85, 0xCA, 0x0C, 0x80, 0xA2, 0x01,
+    0x80, 0x01, 0x80, 0xE0, 0x0D, 0x00, 0x63, 0x08, 0x83, 0xE3, 0x0D, 0x80, 0xB0, 0x01, 0x86, 0x9F,
+    0x0E, 0x86, 0x97, 0x04, 0x87, 0xA5, 0x04, 0x83, 0x11, 0x86, 0xB8, 0x08, 0x83, 0x82, 0x02, 0x85,
+    0x89, 0x04, 0x01, 0x62, 0x08, 0x62, 0x08, 0x80, 0x06, 0x85, 0xD8, 0x0A, 0x88, 0x90, 0x04, 0x83,
+    0xEA, 0x07, 0x87, 0xB5, 0x08, 0x87, 0xDF, 0x06, 0x86, 0xB1, 0x08, 0x86, 0x84, 0x0C, 0x86, 0x98,
+    0x07, 0x81, 0xFB, 0x02, 0x84, 0x17, 0x88, 0x9D, 0x04, 0x02, 0x41, 0x08, 0x82, 0x10, 0x62, 0x08,
+    0x80, 0x42, 0x82, 0x64, 0x82, 0xB2, 0x0C, 0x88, 0x3B, 0x84, 0x9B, 0x03, 0x83, 0xAC, 0x08, 0x8A,
+    0xBD, 0x03, 0x86, 0xEF, 0x04, 0x82, 0xB2, 0x04, 0xCC, 0x9E, 0x04, 0x87, 0xA4, 0x01, 0x83, 0x97,
+    0x04, 0x86, 0x7E, 0x82, 0x93, 0x01, 0x82, 0xBE, 0x0C, 0x81, 0x8C, 0x04, 0x83, 0xA4, 0x04, 0x81,
+    0x0D, 0x83, 0xA9, 0x04, 0x87, 0xD1, 0x06, 0x81, 0x8D, 0x04, 0x87, 0x8C, 0x0F, 0x82, 0xA2, 0x04,
+    0x80, 0x05, 0x82, 0xB7, 0x0C, 0x87, 0xA9, 0x0F, 0x82, 0xB0, 0x0C, 0x83, 0x98, 0x04, 0x80, 0xA5,
+    0x0C, 0x83, 0x98, 0x04, 0x80, 0x8E, 0x04, 0x86, 0x98, 0x04, 0x82, 0xFE, 0x03, 0x82, 0x98, 0x08,
+    0x81, 0xAC, 0x03, 0x00, 0x84, 0x08, 0x81, 0xB6, 0x03, 0x80, 0x23, 0x88, 0xAD, 0x03, 0x84, 0xAB,
+    0x08, 0x00, 0xA5, 0x08, 0x80, 0xD5, 0x03, 0x80, 0x9E, 0x08, 0x81, 0xC3, 0x0C, 0x80, 0xEF, 0x03,
+    0x03, 0xE7, 0x00, 0xE7, 0x08, 0xE7, 0x08, 0xE7, 0x00, 0x81, 0xAA, 0x08, 0x81, 0x81, 0x08, 0x80,
+    0x13, 0x01, 0x08, 0x11, 0x08, 0x11, 0x80, 0xA5, 0x08, 0x80, 0x93, 0x04, 0x81, 0x98, 0x04, 0x80,
+    0x94, 0x04, 0x00, 0x29, 0x11, 0x81, 0x98, 0x04, 0x81, 0x0F, 0x00, 0xE7, 0x08, 0x81, 0xB7, 0x08,
+    0x01, 0x08, 0x09, 0x08, 0x09, 0x80, 0x23, 0x81, 0x01, 0x03, 0x07, 0x11, 0x08, 0x11, 0x28, 0x11,
+    0x08, 0x11, 0x80, 0x04, 0x80, 0x9D, 0x04, 0x80, 0x0A, 0x85, 0x93, 0x04, 0x80, 0x04, 0x80, 0x5F,
+    0x81, 0x94, 0x04, 0x81, 0xC6, 0x0C, 0x80, 0x02, 0x81, 0x8F, 0x04, 0x00, 0x84, 0x00, 0x80, 0x68,
+    0x83, 0x61, 0x81, 0x99, 0x09, 0x89, 0xA6, 0x08, 0x80, 0x99, 0x04, 0x01, 0xA4, 0x08, 0xC5, 0x10,
+    0x83, 0xB7, 0x05, 0x81, 0xAE, 0x01, 0x80, 0x98, 0x04, 0x80, 0xBE, 0x01, 0x85, 0x98, 0x04, 0x80,
+    0x0B, 0x8A, 0x9B, 0x04, 0x81, 0xA1, 0x08, 0x81, 0x85, 0x02, 0x00, 0x62, 0x08, 0x83, 0xBD, 0x0E,
+    0x85, 0xC2, 0x0C, 0x81, 0x9C, 0x02, 0x86, 0xA1, 0x08, 0x85, 0xDD, 0x0A, 0x89, 0xAE, 0x08, 0x81,
+    0x0C, 0x00, 0x41, 0x00, 0x84, 0xE2, 0x0C, 0x88, 0xD2, 0x0C, 0x88, 0xDD, 0x03, 0x85, 0x83, 0x04,
+    0x85, 0xEE, 0x02, 0x81, 0xFC, 0x02, 0x87, 0x9E, 0x0B, 0x83, 0x89, 0x03, 0x82, 0x30, 0x03, 0x41,
+    0x08, 0x83, 0x10, 0x62, 0x08, 0x21, 0x08, 0x83, 0x34, 0x81, 0x46, 0x87, 0xDA, 0x0C, 0x85, 0xAA,
+    0x03, 0x83, 0x13, 0x82, 0xCA, 0x07, 0x84, 0xE7, 0x08, 0x84, 0xD6, 0x04, 0x84, 0x91, 0x04, 0x88,
+    0xC6, 0x03, 0xC0, 0x01, 0x8E, 0x4C, 0x83, 0x61, 0x87, 0xC3, 0x01, 0x85, 0xA1, 0x0A, 0x85, 0xC1,
+    0x0A, 0x85, 0xE1, 0x01, 0x84, 0x0D, 0x83, 0xB1, 0x08, 0x86, 0x8E, 0x0F, 0x80, 0x02, 0x80, 0xEE,
+    0x02, 0x82, 0x99, 0x04, 0x84, 0x98, 0x04, 0x00, 0x63, 0x00, 0x86, 0x98, 0x04, 0x80, 0x01, 0x02,
+    0x84, 0x08, 0xC5, 0x10, 0xA5, 0x10, 0x84, 0xAE, 0x08, 0x83, 0x8E, 0x04, 0x81, 0x9C, 0x04, 0x00,
+    0x44, 0x00, 0x80, 0x01, 0x83, 0xFF, 0x03, 0x83, 0x99, 0x04, 0x80, 0xFF, 0x03, 0x80, 0xBA, 0x03,
+    0x80, 0x03, 0x80, 0xAE, 0x08, 0x00, 0x84, 0x00, 0x81, 0x01, 0x81, 0x8E, 0x04, 0x86, 0xC2, 0x0C,
+    0x80, 0xAA, 0x08, 0x00, 0xA6, 0x00, 0x80, 0xDD, 0x03, 0x81, 0xA5, 0x0C, 0x81, 0xBB, 0x0C, 0x03,
+    0xC6, 0x00, 0xE7, 0x00, 0xE7, 0x00, 0x07, 0x09, 0x80, 0x03, 0x81, 0xEC, 0x03, 0x82, 0xFB, 0x03,
+    0x00, 0x29, 0x11, 0x82, 0xAB, 0x08, 0x80, 0x87, 0x04, 0x80, 0x8A, 0x04, 0x02, 0x08, 0x11, 0x4A,
+    0x11, 0x4A, 0x11, 0x80, 0x9A, 0x04, 0x83, 0x01, 0x80, 0x8C, 0x04, 0x80, 0x0D, 0x84, 0x98, 0x04,
+    0x80, 0xBC, 0x04, 0x86, 0x01, 0x00, 0xA5, 0x08, 0x80, 0x41, 0x80, 0x57, 0x81, 0x47, 0x00, 0x65,
+    0x00, 0x80, 0x02, 0x89, 0x9E, 0x08, 0x84, 0xBE, 0x0C, 0x80, 0x8C, 0x01, 0x80, 0x93, 0x04, 0x80,
+    0x9F, 0x08, 0x86, 0x98, 0x04, 0x82, 0x06, 0x80, 0x8D, 0x04, 0x80, 0xA6, 0x08, 0x83, 0x97, 0x04,
+    0x84, 0x98, 0x0E, 0x82, 0xFB, 0x03, 0x82, 0xA3, 0x0E, 0x8B, 0x98, 0x04, 0x01, 0x83, 0x08, 0x83,
+    0x08, 0x83, 0x07, 0x00, 0x83, 0x10, 0x81, 0xAE, 0x04, 0x82, 0xEE, 0x01, 0x88, 0x99, 0x08, 0x82,
+    0x94, 0x02, 0x83, 0xAC, 0x08, 0x87, 0x96, 0x08, 0x85, 0x98, 0x04, 0x02, 0x42, 0x08, 0xA3, 0x10,
+    0x63, 0x08, 0x84, 0xC1, 0x08, 0x83, 0xD7, 0x03, 0x85, 0x16, 0x88, 0xA0, 0x0F, 0x86, 0xE6, 0x03,
+    0x85, 0x9A, 0x0B, 0x84, 0x1B, 0x84, 0x91, 0x07, 0x82, 0x9C, 0x04, 0x82, 0xF0, 0x08, 0x00, 0x21,
+    0x08, 0x84, 0x9A, 0x04, 0x8B, 0xEE, 0x08, 0x83, 0x98, 0x04, 0x00, 0x41, 0x08, 0x88, 0xE2, 0x04,
+    0x81, 0x1C, 0x81, 0xA6, 0x04, 0x85, 0xD8, 0x08, 0x84, 0x20, 0xC8, 0x9A, 0x04, 0x90, 0x98, 0x04,
+    0x8A, 0x78, 0x88, 0xEE, 0x01, 0x87, 0x94, 0x04, 0x84, 0xA8, 0x04, 0x82, 0xBF, 0x08, 0x83, 0x0A,
+    0x84, 0xCC, 0x02, 0x84, 0xC1, 0x08, 0x81, 0xF2, 0x06, 0x82, 0xF3, 0x06, 0x82, 0xBB, 0x08, 0x85,
+    0x01, 0x80, 0xAA, 0x04, 0x88, 0xC1, 0x0F, 0x84, 0x9E, 0x03, 0x83, 0x98, 0x04, 0x83, 0xB2, 0x0C,
+    0x82, 0xB3, 0x0C, 0x00, 0x85, 0x08, 0x80, 0xD3, 0x07, 0x81, 0x9F, 0x08, 0x85, 0x8F, 0x04, 0x01,
+    0xA5, 0x00, 0xC7, 0x08, 0x80, 0xA4, 0x08, 0x81, 0x08, 0x80, 0x01, 0x80, 0x94, 0x04, 0x80, 0x92,
+    0x04, 0x80, 0xA2, 0x0C, 0x01, 0xC7, 0x00, 0xC7, 0x00, 0x81, 0x96, 0x04, 0x01, 0x08, 0x09, 0x28,
+    0x09, 0x80, 0x01, 0x80, 0x8C, 0x04, 0x04, 0x28, 0x09, 0x29, 0x09, 0x4A, 0x09, 0x4A, 0x09, 0x29,
+    0x09, 0x80, 0x01, 0x80, 0x85, 0x04, 0x80, 0x96, 0x08, 0x80, 0x8B, 0x04, 0x00, 0x28, 0x11, 0x80,
+    0x90, 0x04, 0x80, 0x08, 0x02, 0x09, 0x11, 0x29, 0x11, 0xE8, 0x10, 0x80, 0x8C, 0x04, 0x01, 0x08,
+    0x11, 0xE7, 0x10, 0x82, 0xDC, 0x0C, 0x82, 0x9E, 0x08, 0x80, 0x44, 0x80, 0x04, 0x00, 0xA5, 0x08,
+    0x80, 0x90, 0x04, 0x81, 0x92, 0x04, 0x82, 0xEC, 0x04, 0x80, 0x14, 0x81, 0x56, 0x81, 0x03, 0x8B,
+    0x97, 0x04, 0x81, 0x89, 0x01, 0x83, 0x8C, 0x01, 0x82, 0xB9, 0x0C, 0x81, 0x05, 0x80, 0xCD, 0x09,
+    0x81, 0xBE, 0x0C, 0x82, 0x8A, 0x04, 0x84, 0x90, 0x04, 0x84, 0x09, 0x82, 0xC5, 0x01, 0x00, 0x62,
+    0x08, 0x85, 0xD0, 0x01, 0x84, 0xE7, 0x01, 0x83, 0xB0, 0x08, 0x80, 0x91, 0x04, 0x83, 0xB0, 0x0A,
+    0x86, 0x9A, 0x06, 0x87, 0x01, 0x82, 0xA4, 0x04, 0x82, 0x01, 0x80, 0x07, 0x89, 0x98, 0x04, 0x83,
+    0xDE, 0x0A, 0x00, 0x62, 0x08, 0x83, 0xB0, 0x08, 0x82, 0xB6, 0x08, 0x88, 0xD8, 0x03, 0x83, 0x25,
+    0x8B, 0xB7, 0x08, 0x86, 0x30, 0x87, 0xD6, 0x03, 0x84, 0xA5, 0x04, 0x86, 0x49, 0x81, 0x9B, 0x04,
+    0x82, 0x19, 0x80, 0xFD, 0x08, 0x85, 0x56, 0x83, 0x1C, 0x86, 0xD5, 0x04, 0x81, 0x40, 0x86, 0x2A,
+    0x84, 0xD7, 0x08, 0x81, 0x16, 0x81, 0x23, 0xD6, 0x98, 0x04, 0x83, 0xBD, 0x0D, 0x89, 0xAF, 0x08,
+    0x83, 0xF6, 0x01, 0x88, 0x88, 0x02, 0x82, 0xD6, 0x0C, 0x85, 0x9E, 0x04, 0x84, 0xA8, 0x04, 0x80,
+    0xCC, 0x02, 0x81, 0xA5, 0x08, 0x87, 0xC2, 0x02, 0x80, 0xE9, 0x02, 0x83, 0xD6, 0x0C, 0x82, 0x98,
+    0x04, 0x80, 0xB7, 0x0C, 0x83, 0x96, 0x07, 0x88, 0x97, 0x04, 0x83, 0x99, 0x04, 0x81, 0xE6, 0x0F,
+    0x81, 0x18, 0x86, 0x99, 0x04, 0x80, 0xB7, 0x08, 0x83, 0x91, 0x04, 0x80, 0x92, 0x04, 0x81, 0x09,
+    0x80, 0xDF, 0x03, 0x02, 0x85, 0x00, 0x86, 0x00, 0x48, 0x19, 0x80, 0xB1, 0x0C, 0x80, 0x0D, 0x01,
+    0xC6, 0x08, 0xC6, 0x00, 0x81, 0xAA, 0x08, 0x80, 0xB0, 0x08, 0x00, 0xC7, 0x00, 0x80, 0xF7, 0x03,
+    0x81, 0x90, 0x04, 0x0B, 0x28, 0x09, 0x49, 0x11, 0x29, 0x09, 0x69, 0x11, 0x8A, 0x19, 0x0B, 0x2A,
+    0xEB, 0x29, 0x6A, 0x11, 0x8B, 0x11, 0x8C, 0x11, 0x6B, 0x09, 0x6A, 0x09, 0x80, 0xA5, 0x08, 0x04,
+    0x28, 0x11, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x28, 0x19, 0x80, 0x94, 0x04, 0x00, 0x08, 0x11,
+    0x81, 0xCF, 0x08, 0x02, 0xE8, 0x08, 0x2A, 0x11, 0xE8, 0x08, 0x80, 0x05, 0x80, 0xB3, 0x0C, 0x80,
+    0x03, 0x81, 0x98, 0x04, 0x00, 0xA5, 0x00, 0x80, 0x97, 0x04, 0x82, 0xFD, 0x0C, 0x82, 0xE3, 0x04,
+    0x80, 0xB7, 0x0C, 0x81, 0x03, 0x80, 0x9B, 0x04, 0x81, 0x06, 0x87, 0x96, 0x04, 0x80, 0xC7, 0x0C,
+    0x89, 0xAF, 0x08, 0x85, 0xBF, 0x0C, 0x81, 0xE3, 0x0D, 0x02, 0x63, 0x08, 0xE5, 0x18, 0x26, 0x21,
+    0x80, 0x99, 0x04, 0x84, 0xA3, 0x08, 0x84, 0xA1, 0x08, 0x80, 0xD6, 0x05, 0x83, 0xBE, 0x0C, 0x01,
+    0x63, 0x08, 0xA4, 0x10, 0x82, 0xB0, 0x0C, 0x83, 0xF2, 0x05, 0x80, 0xBF, 0x0C, 0x81, 0x08, 0x00,
+    0x43, 0x08, 0x80, 0xD0, 0x08, 0x85, 0xAF, 0x0A, 0x85, 0x9A, 0x04, 0x8A, 0x9E, 0x04, 0x84, 0x8B,
+    0x08, 0x00, 0x42, 0x08, 0x80, 0xE3, 0x0C, 0x8E, 0xB2, 0x04, 0x84, 0x01, 0x01, 0x83, 0x10, 0x83,
+    0x10, 0x86, 0x28, 0x88, 0x91, 0x04, 0x84, 0x0E, 0x87, 0x04, 0x84, 0xE0, 0x03, 0x85, 0xF4, 0x02,
+    0x84, 0x88, 0x04, 0x86, 0xE4, 0x08, 0x00, 0x41, 0x08, 0x85, 0xB3, 0x08, 0x87, 0x6C, 0x85, 0x21,
+    0x84, 0xFE, 0x03, 0x87, 0x0D, 0x81, 0x97, 0x04, 0x83, 0xB0, 0x08, 0x81, 0x13, 0x80, 0xCA, 0x04,
+    0x8F, 0x98, 0x04, 0x82, 0x62, 0xC2, 0x98, 0x04, 0x83, 0xA4, 0x01, 0x85, 0x9C, 0x04, 0x84, 0xBA,
+    0x01, 0x8D, 0x9C, 0x04, 0x87, 0xA4, 0x04, 0x84, 0xD0, 0x06, 0x80, 0xCE, 0x02, 0x01, 0x27, 0x19,
+    0x47, 0x21, 0x88, 0x8E, 0x0F, 0x83, 0xF1, 0x06, 0x83, 0x9C, 0x04, 0x02, 0x63, 0x00, 0xA4, 0x08,
+    0xC6, 0x08, 0x80, 0xD1, 0x0F, 0x00, 0xA5, 0x08, 0x85, 0xB0, 0x0B, 0x84, 0xB8, 0x0B, 0x83, 0x90,
+    0x04, 0x80, 0xB6, 0x0C, 0x00, 0xA5, 0x08, 0x82, 0x92, 0x04, 0x81, 0x9F, 0x04, 0x82, 0xCB, 0x0C,
+    0x82, 0x9C, 0x04, 0x82, 0xAA, 0x08, 0x80, 0x01, 0x80, 0xA2, 0x08, 0x00, 0xE7, 0x08, 0x80, 0xA6,
+    0x08, 0x82, 0xBC, 0x0C, 0x00, 0xC6, 0x08, 0x84, 0x97, 0x0C, 0x80, 0x92, 0x04, 0x11, 0x29, 0x09,
+    0x49, 0x09, 0x69, 0x09, 0x69, 0x09, 0x49, 0x09, 0x6A, 0x11, 0x8A, 0x11, 0x8A, 0x11, 0xAB, 0x19,
+    0x0C, 0x2A, 0xEF, 0x4A, 0xCE, 0x4A, 0xAB, 0x19, 0x6A, 0x11, 0x4A, 0x11, 0x29, 0x09, 0x49, 0x11,
+    0x49, 0x11, 0x80, 0xAC, 0x08, 0x81, 0xA9, 0x08, 0x00, 0xE8, 0x08, 0x80, 0xC8, 0x0C, 0x80, 0x03,
+    0x83, 0x01, 0x81, 0x9D, 0x04, 0x81, 0xD4, 0x0C, 0x80, 0x99, 0x04, 0x81, 0xE9, 0x08, 0x84, 0x81,
+    0x0D, 0x81, 0xF8, 0x08, 0x82, 0x98, 0x04, 0x81, 0xA2, 0x0D, 0x82, 0x93, 0x0D, 0x8B, 0xC1, 0x0C,
+    0x89, 0x01, 0x83, 0xB6, 0x05, 0x81, 0x03, 0x01, 0x63, 0x08, 0xC4, 0x10, 0x81, 0xB1, 0x08, 0x82,
+    0x0E, 0x85, 0x8B, 0x0E, 0x80, 0x10, 0x00, 0x83, 0x08, 0x83, 0x0D, 0x80, 0x88, 0x04, 0x82, 0xC6,
+    0x01, 0x81, 0xBC, 0x0C, 0x81, 0xA0, 0x04, 0x81, 0xE7, 0x01, 0x80, 0xAE, 0x04, 0x84, 0xC0, 0x08,
+    0x84, 0xD1, 0x0E, 0x84, 0xC8, 0x04, 0x81, 0xFF, 0x01, 0x81, 0xEB, 0x0B, 0x85, 0x87, 0x02, 0x81,
+    0xA4, 0x02, 0x82, 0x11, 0x8A, 0xAE, 0x02, 0x81, 0xD9, 0x0B, 0x84, 0x07, 0x84, 0xEA, 0x07, 0x86,
+    0xCF, 0x0C, 0x87, 0xEB, 0x06, 0x86, 0x09, 0x8A, 0x81, 0x07, 0x87, 0x97, 0x04, 0x85, 0x0A, 0x8B,
+    0xFD, 0x04, 0x87, 0xDA, 0x08, 0x80, 0xE6, 0x03, 0x87, 0xB4, 0x08, 0x83, 0x65, 0x84, 0x98, 0x04,
+    0x86, 0xFD, 0x03, 0x82, 0x41, 0xC3, 0x87, 0x04, 0x8B, 0x93, 0x04, 0x83, 0x03, 0x82, 0x8D, 0x05,
+    0x86, 0xF0, 0x09, 0x86, 0xE8, 0x05, 0x87, 0x95, 0x01, 0x84, 0x8A, 0x02, 0x84, 0xFB, 0x03, 0x82,
+    0x98, 0x04, 0x83, 0xFD, 0x0A, 0x01, 0xA4, 0x08, 0xC5, 0x10, 0x88, 0x98, 0x04, 0x82, 0x12, 0x83,
+    0xCB, 0x0C, 0x80, 0x98, 0x04, 0x02, 0xC6, 0x08, 0x48, 0x19, 0xA5, 0x08, 0x80, 0xA1, 0x08, 0x84,
+    0x90, 0x04, 0x82, 0xC4, 0x0B, 0x81, 0x02, 0x81, 0x07, 0x82, 0x98, 0x04, 0x83, 0x90, 0x04, 0x80,
+    0xB9, 0x03, 0x00, 0xA5, 0x00, 0x82, 0x9B, 0x04, 0x82, 0x91, 0x04, 0x81, 0x8D, 0x04, 0x82, 0x02,
+    0x80, 0x01, 0x80, 0xB8, 0x0C, 0x81, 0xA4, 0x08, 0x81, 0xA6, 0x08, 0x80, 0xB0, 0x0C, 0x01, 0x29,
+    0x11, 0x49, 0x11, 0x80, 0x90, 0x04, 0x00, 0xAB, 0x19, 0x80, 0x01, 0x01, 0xCB, 0x19, 0xAB, 0x11,
+    0x81, 0x01, 0x05, 0x8B, 0x11, 0x8A, 0x11, 0x6A, 0x11, 0xAB, 0x21, 0x89, 0x19, 0x07, 0x09, 0x80,
+    0x17, 0x00, 0xC7, 0x08, 0x81, 0x02, 0x81, 0x06, 0x02, 0xC7, 0x08, 0xA7, 0x08, 0xA7, 0x08, 0x80,
+    0x03, 0x80, 0xB4, 0x0C, 0x81, 0xAB, 0x08, 0x80, 0x38, 0x81, 0x98, 0x04, 0x81, 0x9D, 0x04, 0x81,
+    0xC7, 0x0C, 0x81, 0xFE, 0x0C, 0x81, 0x01, 0x80, 0x94, 0x0D, 0x80, 0x8C, 0x04, 0x00, 0x84, 0x00,
+    0x83, 0x9E, 0x08, 0x81, 0xA2, 0x0D, 0x80, 0xFF, 0x04, 0x83, 0x68, 0x81, 0x86, 0x05, 0x85, 0xA6,
+    0x08, 0x00, 0x64, 0x08, 0x81, 0x07, 0x83, 0xDF, 0x0D, 0x83, 0xB9, 0x0C, 0x84, 0xBD, 0x0C, 0x89,
+    0x0D, 0x81, 0x01, 0x00, 0x43, 0x08, 0x84, 0x81, 0x04, 0x83, 0xDD, 0x01, 0x81, 0x8F, 0x04, 0x81,
+    0x09, 0x82, 0xEE, 0x01, 0x83, 0x0E, 0x83, 0x84, 0x06, 0x83, 0xA0, 0x06, 0x81, 0x14, 0x84, 0xBE,
+    0x0C, 0x02, 0x62, 0x08, 0x83, 0x10, 0x62, 0x08, 0x8A, 0xA7, 0x06, 0x88, 0xC8, 0x03, 0x82, 0x28,
+    0x84, 0x98, 0x04, 0x83, 0x28, 0x82, 0xB9, 0x04, 0x86, 0xC2, 0x02, 0x88, 0x99, 0x04, 0x81, 0x02,
+    0x83, 0xC6, 0x03, 0x86, 0x98, 0x04, 0x81, 0x2B, 0x88, 0xA7, 0x0B, 0x8B, 0xBA, 0x08, 0x86, 0x5B,
+    0x00, 0x41, 0x08, 0x83, 0xAD, 0x0C, 0x89, 0x26, 0x80, 0x8E, 0x09, 0x80, 0xF2, 0x0D, 0x86, 0x1D,
+    0xD6, 0xBF, 0x0C, 0x86, 0x9B, 0x04, 0x82, 0xA3, 0x0D, 0x88, 0xAF, 0x09, 0x85, 0xED, 0x05, 0x8A,
+    0xB2, 0x05, 0x84, 0xF8, 0x01, 0x01, 0x63, 0x08, 0x84, 0x10, 0x83, 0xF9, 0x01, 0x84, 0x91, 0x0F,
+    0x82, 0xDB, 0x0C, 0x86, 0x8E, 0x0F, 0x84, 0xE1, 0x02, 0x82, 0xB7, 0x0F, 0x02, 0x43, 0x00, 0x84,
+    0x08, 0xC5, 0x08, 0x80, 0x99, 0x03, 0x85, 0xAD, 0x08, 0x00, 0x64, 0x00, 0x80, 0xEB, 0x0C, 0x83,
+    0x94, 0x04, 0x81, 0xBA, 0x07, 0x86, 0xC3, 0x07, 0x80, 0x92, 0x04, 0x83, 0xE4, 0x07, 0x80, 0xB6,
+    0x0C, 0x00, 0xA5, 0x00, 0x81, 0x98, 0x04, 0x82, 0x91, 0x04, 0x00, 0x08, 0x09, 0x81, 0xB6, 0x0C,
+    0x80, 0x92, 0x04, 0x05, 0x49, 0x09, 0x49, 0x09, 0x49, 0x11, 0x8A, 0x11, 0x8A, 0x19, 0x8A, 0x19,
+    0x80, 0x8B, 0x04, 0x80, 0x8C, 0x04, 0x04, 0x49, 0x11, 0x69, 0x11, 0x49, 0x11, 0x29, 0x11, 0x28,
+    0x09, 0x81, 0x13, 0x81, 0x01, 0x02, 0xE7, 0x08, 0x08, 0x11, 0x07, 0x09, 0x80, 0x98, 0x04, 0x80,
+    0xAD, 0x0C, 0x00, 0xA6, 0x00, 0x80, 0xB1, 0x0C, 0x80, 0x01, 0x80, 0x84, 0x04, 0x80, 0x03, 0x80,
+    0x80, 0x04, 0x00, 0x85, 0x08, 0x84, 0xBA, 0x0C, 0x80, 0xD4, 0x04, 0x80, 0x0F, 0x81, 0x01, 0x80,
+    0xCD, 0x0C, 0x81, 0xA4, 0x04, 0x84, 0xB2, 0x08, 0x82, 0x81, 0x09, 0x85, 0xBE, 0x0C, 0x00, 0xA5,
+    0x08, 0x80, 0x74, 0x01, 0x44, 0x00, 0x44, 0x00, 0x83, 0x70, 0x84, 0xAE, 0x09, 0x85, 0xAD, 0x08,
+    0x84, 0x06, 0x82, 0x95, 0x04, 0x84, 0xA8, 0x08, 0x80, 0x01, 0x00, 0x63, 0x08, 0x80, 0xA7, 0x08,
+    0x80, 0xB2, 0x0C, 0x80, 0x9C, 0x08, 0x83, 0xCC, 0x01, 0x85, 0xC2, 0x0C, 0x81, 0xFA, 0x03, 0x82,
+    0x9E, 0x08, 0x86, 0x87, 0x06, 0x86, 0x8E, 0x06, 0x85, 0x11, 0x84, 0x87, 0x02, 0x02, 0x83, 0x10,
+    0xC4, 0x18, 0x63, 0x08, 0x85, 0xEC, 0x03, 0x84, 0xAD, 0x03, 0x86, 0x9F, 0x02, 0x01, 0x42, 0x08,
+    0x63, 0x08, 0x86, 0xB0, 0x04, 0x01, 0x42, 0x08, 0x83, 0x10, 0x80, 0x89, 0x0D, 0x83, 0xBD, 0x02,
+    0x81, 0x9B, 0x04, 0x86, 0x8D, 0x04, 0x83, 0xD2, 0x04, 0x01, 0x62, 0x08, 0x41, 0x00, 0x89, 0xFD,
+    0x03, 0x85, 0x9B, 0x0B, 0x87, 0xF4, 0x03, 0x82, 0x10, 0x83, 0x9A, 0x07, 0x86, 0xFD, 0x0C, 0x86,
+    0xCF, 0x04, 0x00, 0x21, 0x08, 0x82, 0xD7, 0x0C, 0x89, 0xB7, 0x04, 0x80, 0x48, 0x81, 0x85, 0x03,
+    0x84, 0x20, 0x80, 0xB6, 0x03, 0xD8, 0x91, 0x04, 0x83, 0xA0, 0x01, 0x81, 0x06, 0x8A, 0xB8, 0x05,
+    0x85, 0x89, 0x01, 0x85, 0xDB, 0x0D, 0x88, 0x98, 0x04, 0x00, 0x42, 0x00, 0x82, 0xAA, 0x05, 0x81,
+    0x0A, 0x86, 0x97, 0x04, 0x84, 0xCC, 0x02, 0x82, 0xEB, 0x02, 0x88, 0x91, 0x07, 0x84, 0xCF, 0x0F,
+    0x83, 0xA5, 0x08, 0x00, 0x63, 0x00, 0x81, 0xB6, 0x07, 0x81, 0x9F, 0x04, 0x83, 0x9A, 0x04, 0x84,
+    0xA5, 0x08, 0x84, 0x01, 0x81, 0x94, 0x04, 0x80, 0xA6, 0x08, 0x82, 0xB4, 0x0C, 0x03, 0x29, 0x09,
+    0x08, 0x09, 0xAA, 0x19, 0xCB, 0x19, 0x80, 0x92, 0x04, 0x81, 0x02, 0x80, 0x03, 0x80, 0xAA, 0x08,
+    0x80, 0x93, 0x04, 0x80, 0x01, 0x01, 0x28, 0x09, 0xE8, 0x08, 0x81, 0x17, 0x00, 0xE7, 0x00, 0x81,
+    0xB0, 0x04, 0x01, 0xC7, 0x00, 0xC6, 0x00, 0x81, 0x91, 0x08, 0x80, 0x01, 0x80, 0x0D, 0x80, 0xFB,
+    0x03, 0x80, 0x80, 0x04, 0x81, 0x96, 0x04, 0x00, 0xA6, 0x08, 0x80, 0x94, 0x04, 0x81, 0xAB, 0x0C,
+    0x80, 0x8E, 0x08, 0x81, 0x9E, 0x04, 0x80, 0xA0, 0x08, 0x83, 0xB7, 0x0C, 0x81, 0x8A, 0x0D, 0x80,
+    0xA6, 0x04, 0x80, 0x01, 0x83, 0xE7, 0x04, 0x82, 0x12, 0x85, 0x98, 0x04, 0x82, 0x90, 0x04, 0x82,
+    0x8D, 0x01, 0x81, 0x8B, 0x05, 0x00, 0x64, 0x08, 0x8C, 0xC8, 0x0C, 0x85, 0xA0, 0x01, 0x85, 0x98,
+    0x08, 0x80, 0x06, 0x01, 0x84, 0x10, 0xA4, 0x10, 0x81, 0xF0, 0x09, 0x81, 0x98, 0x04, 0x80, 0x9C,
+    0x04, 0x85, 0x13, 0x86, 0xFA, 0x03, 0x85, 0xEF, 0x01, 0x87, 0x98, 0x04, 0x86, 0x99, 0x04, 0x85,
+    0xF6, 0x03, 0x82, 0x97, 0x03, 0x82, 0x08, 0x00, 0x42, 0x08, 0x85, 0xA4, 0x0C, 0x81, 0xA5, 0x08,
+    0x82, 0xA6, 0x02, 0x80, 0x8E, 0x04, 0x81, 0xB0, 0x04, 0x83, 0x13, 0x80, 0x22, 0x83, 0x97, 0x04,
+    0x85, 0xD9, 0x06, 0x88, 0xDB, 0x06, 0x83, 0xFA, 0x07, 0x85, 0xDE, 0x03, 0x86, 0xFE, 0x03, 0x8D,
+    0x86, 0x04, 0x87, 0x88, 0x03, 0x84, 0x5B, 0x8A, 0xF8, 0x04, 0x84, 0x52, 0x85, 0xCA, 0x08, 0x84,
+    0x2C, 0x82, 0x2E, 0xD4, 0x98, 0x04, 0x84, 0xA2, 0x01, 0x88, 0xA6, 0x04, 0x82, 0x73, 0x86, 0xB5,
+    0x05, 0x8C, 0xA8, 0x04, 0x8D, 0x01, 0x88, 0xE7, 0x0A, 0x84, 0x85, 0x0B, 0x80, 0xA7, 0x08, 0x00,
+    0x63, 0x00, 0x85, 0x95, 0x04, 0x83, 0x01, 0x85, 0xAB, 0x07, 0x81, 0xB0, 0x08, 0x82, 0xC3, 0x0C,
+    0x80, 0xB3, 0x03, 0x81, 0xE1, 0x0B, 0x84, 0xC9, 0x03, 0x83, 0x93, 0x04, 0x00, 0xC7, 0x08, 0x81,
+    0x8D, 0x08, 0x81, 0x85, 0x04, 0x80, 0xB8, 0x0C, 0x00, 0x49, 0x09, 0x80, 0x03, 0x80, 0x9B, 0x04,
+    0x01, 0x08, 0x09, 0xE8, 0x08, 0x81, 0x0F, 0x82, 0xA3, 0x08, 0x80, 0x9D, 0x0C, 0x80, 0x07, 0x81,
+    0xBE, 0x08, 0x80, 0x07, 0x82, 0x98, 0x04, 0x81, 0xCF, 0x08, 0x80, 0xA7, 0x0C, 0x82, 0x95, 0x08,
+    0x82, 0x94, 0x04, 0x82, 0x95, 0x04, 0x82, 0x97, 0x04, 0x80, 0xFE, 0x03, 0x80, 0x0D, 0x83, 0x96,
+    0x04, 0x85, 0xB7, 0x0C, 0x84, 0xAB, 0x08, 0x81, 0xBC, 0x0C, 0x80, 0x15, 0x00, 0x84, 0x08, 0x86,
+    0xB1, 0x08, 0x8B, 0xA7, 0x08, 0x82, 0x8E, 0x04, 0x80, 0x9C, 0x01, 0x00, 0x63, 0x00, 0x80, 0xA2,
+    0x04, 0x01, 0x63, 0x00, 0x63, 0x08, 0x81, 0xB3, 0x08, 0x84, 0x98, 0x04, 0x86, 0xB4, 0x01, 0x01,
+    0x62, 0x08, 0xA4, 0x10, 0x81, 0xB1, 0x08, 0x85, 0x86, 0x0E, 0x80, 0x9D, 0x04, 0x00, 0x63, 0x08,
+    0x84, 0xE5, 0x07, 0x8A, 0x01, 0x82, 0xF8, 0x01, 0x80, 0xB9, 0x04, 0x83, 0xFE, 0x05, 0x8A, 0x15,
+    0x83, 0xFF, 0x07, 0x80, 0x03, 0x01, 0xA3, 0x10, 0x83, 0x10, 0x84, 0xDE, 0x03, 0x84, 0xF0, 0x0F,
+    0x83, 0xC2, 0x04, 0x85, 0x1F, 0x8A, 0x2B, 0x8B, 0x4F, 0x88, 0xD0, 0x02, 0x88, 0xB7, 0x08, 0x83,
+    0x0C, 0x82, 0xFA, 0x02, 0x8C, 0xF0, 0x02, 0x80, 0xDC, 0x08, 0x86, 0x84, 0x03, 0x87, 0xD8, 0x04,
+    0x00, 0x41, 0x08, 0x85, 0x44, 0xCD, 0x83, 0x04, 0x00, 0x20, 0x00, 0x9F, 0x98, 0x04, 0x85, 0x8C,
+    0x05, 0x81, 0x09, 0x81, 0x88, 0x05, 0x9C, 0x99, 0x04, 0x82, 0x87, 0x0F, 0x84, 0xC2, 0x0C, 0x80,
+    0xD4, 0x02, 0x00, 0x63, 0x08, 0x81, 0x83, 0x07, 0x03, 0x64, 0x08, 0x85, 0x08, 0x07, 0x11, 0xA5,
+    0x08, 0x85, 0xAC, 0x0B, 0x81, 0xFE, 0x02, 0x88, 0x9E, 0x04, 0x80, 0x96, 0x04, 0x81, 0x94, 0x04,
+    0x81, 0xCA, 0x03, 0x01, 0x64, 0x00, 0x65, 0x00, 0x80, 0xFC, 0x0B, 0x81, 0x01, 0x01, 0xE7, 0x08,
+    0x6A, 0x19, 0x81, 0x85, 0x04, 0x80, 0x02, 0x80, 0x9C, 0x08, 0x80, 0x8E, 0x04, 0x00, 0x28, 0x11,
+    0x81, 0xA8, 0x0C, 0x80, 0x0B, 0x80, 0x95, 0x08, 0x02, 0xC7, 0x08, 0xE7, 0x08, 0xE8, 0x08, 0x81,
+    0x9B, 0x04, 0x80, 0x0C, 0x80, 0x01, 0x81, 0x06, 0x80, 0xA3, 0x08, 0x00, 0xC7, 0x08, 0x80, 0xAF,
+    0x04, 0x81, 0x98, 0x04, 0x80, 0x16, 0x82, 0x2E, 0x81, 0xD9, 0x08, 0x85, 0xE1, 0x08, 0x00, 0xA5,
+    0x08, 0x85, 0x95, 0x08, 0x80, 0x83, 0x04, 0x81, 0x9E, 0x04, 0x80, 0x4B, 0x80, 0xE3, 0x04, 0x81,
+    0xAE, 0x0C, 0x01, 0x84, 0x08, 0x64, 0x08, 0x83, 0x85, 0x04, 0x81, 0x04, 0x01, 0x84, 0x08, 0x85,
+    0x08, 0x85, 0xAF, 0x0D, 0x82, 0xB7, 0x0D, 0x82, 0x0A, 0x8B, 0xA9, 0x08, 0x84, 0xCC, 0x09, 0x80,
+    0xA3, 0x05, 0x85, 0x98, 0x04, 0x87, 0xCA, 0x05, 0x80, 0x01, 0x00, 0x63, 0x08, 0x81, 0x99, 0x04,
+    0x82, 0xF6, 0x03, 0x82, 0x84, 0x0A, 0x02, 0x42, 0x00, 0x83, 0x10, 0xE5, 0x18, 0x80, 0xC8, 0x01,
+    0x82, 0xCE, 0x0C, 0x84, 0xC3, 0x03, 0x88, 0xEA, 0x01, 0x80, 0xD1, 0x08, 0x82, 0xEF, 0x01, 0x8D,
+    0xDE, 0x03, 0x82, 0x22, 0x01, 0x42, 0x08, 0x41, 0x08, 0x87, 0x9D, 0x02, 0x83, 0xC2, 0x08, 0x85,
+    0xF1, 0x0F, 0x8B, 0xE0, 0x07, 0x87, 0xB3, 0x08, 0x84, 0xE8, 0x02, 0x88, 0x93, 0x04, 0x89, 0x98,
+    0x04, 0x82, 0xFE, 0x02, 0x86, 0xB5, 0x08, 0x84, 0x93, 0x07, 0x84, 0xF9, 0x0C, 0x89, 0x98, 0x04,
+    0x82, 0x8E, 0x09, 0x82, 0x98, 0x04, 0xD1, 0x96, 0x04, 0x01, 0x00, 0x00, 0x21, 0x08, 0x80, 0xF7,
+    0x09, 0x8E, 0x13, 0x84, 0xB6, 0x09, 0x88, 0x0F, 0x82, 0xE2, 0x01, 0x81, 0x86, 0x02, 0x82, 0x7C,
+    0x8B, 0x95, 0x04, 0x8D, 0x98, 0x04, 0x82, 0xA5, 0x02, 0x01, 0x42, 0x00, 0x83, 0x08, 0x82, 0x8E,
+    0x04, 0x84, 0x98, 0x04, 0x80, 0x9F, 0x07, 0x80, 0xF2, 0x02, 0x02, 0x06, 0x11, 0x27, 0x19, 0xC5,
+    0x08, 0x82, 0xF9, 0x02, 0x84, 0x94, 0x04, 0x83, 0xC4, 0x0C, 0x83, 0xB9, 0x07, 0x84, 0xF2, 0x0F,
+    0x00, 0xA6, 0x08, 0x80, 0xC9, 0x03, 0x80, 0xE5, 0x03, 0x01, 0xC7, 0x08, 0xC7, 0x00, 0x80, 0xF0,
+    0x03, 0x81, 0x99, 0x08, 0x01, 0x09, 0x09, 0x09, 0x09, 0x80, 0x8C, 0x04, 0x80, 0x82, 0x04, 0x81,
+    0x9E, 0x0C, 0x81, 0xA5, 0x0C, 0x80, 0x09, 0x80, 0x07, 0x80, 0x18, 0x80, 0x97, 0x04, 0x02, 0xAB,
+    0x19, 0x28, 0x09, 0xC6, 0x00, 0x82, 0x9E, 0x08, 0x03, 0xA6, 0x08, 0xE7, 0x08, 0x08, 0x11, 0xE7,
+    0x08, 0x80, 0x91, 0x04, 0x80, 0xB0, 0x04, 0x81, 0x15, 0x80, 0xAA, 0x08, 0x81, 0x95, 0x04, 0x85,
+    0x91, 0x04, 0x82, 0x97, 0x08, 0x81, 0x90, 0x08, 0x83, 0x9B, 0x08, 0x80, 0x0A, 0x83, 0xA6, 0x08,
+    0x80, 0x9C, 0x08, 0x03, 0x84, 0x08, 0xC5, 0x10, 0xE6, 0x10, 0xC6, 0x10, 0x89, 0xA4, 0x0D, 0x81,
+    0x08, 0x81, 0xBD, 0x0D, 0x80, 0x90, 0x04, 0x80, 0xBD, 0x0C, 0x01, 0x43, 0x00, 0x44, 0x00, 0x81,
+    0x08, 0x00, 0xE6, 0x10, 0x81, 0xC5, 0x0C, 0x81, 0x0B, 0x84, 0x01, 0x84, 0x97, 0x04, 0x83, 0xB5,
+    0x05, 0x85, 0xC9, 0x0C, 0x84, 0xB7, 0x01, 0x81, 0xC4, 0x0C, 0x82, 0xC9, 0x0C, 0x86, 0xF6, 0x03,
+    0x80, 0xB1, 0x08, 0x83, 0xF7, 0x07, 0x81, 0xD6, 0x0C, 0x83, 0xAB, 0x0E, 0x8C, 0xE2, 0x03, 0x89,
+    0x01, 0x83, 0xB4, 0x03, 0x86, 0xBC, 0x04, 0x85, 0x83, 0x0C, 0x83, 0x3A, 0x85, 0xB3, 0x0C, 0x87,
+    0x20, 0x86, 0x12, 0x85, 0x48, 0x8C, 0x91, 0x08, 0x8A, 0xB8, 0x08, 0x86, 0xED, 0x02, 0x82, 0xF6,
+    0x02, 0x82, 0x92, 0x03, 0x84, 0x34, 0x85, 0x38, 0x81, 0x06, 0x81, 0x9F, 0x01, 0x86, 0x0B, 0x84,
+    0x06, 0xCC, 0x99, 0x04, 0x94, 0x4F, 0x89, 0xAD, 0x04, 0x81, 0x21, 0x00, 0x01, 0x00, 0x81, 0xB6,
+    0x02, 0x81, 0x7B, 0x83, 0xB0, 0x04, 0x8B, 0x95, 0x04, 0x84, 0xC5, 0x01, 0x88, 0x9B, 0x04, 0x87,
+    0xA5, 0x0F, 0x80, 0x01, 0x80, 0x88, 0x03, 0x00, 0x63, 0x08, 0x80, 0x03, 0x01, 0xA4, 0x08, 0xA5,
+    0x08, 0x81, 0x9E, 0x04, 0x85, 0xA8, 0x08, 0x82, 0xA4, 0x08, 0x83, 0xB3, 0x03, 0x80, 0x01, 0x80,
+    0xD8, 0x07, 0x80, 0xD9, 0x07, 0x80, 0xFF, 0x03, 0x00, 0x08, 0x11, 0x82, 0x97, 0x08, 0x80, 0x80,
+    0x04, 0x00, 0xC8, 0x08, 0x81, 0x05, 0x82, 0x87, 0x08, 0x82, 0x01, 0x00, 0xA5, 0x00, 0x80, 0xD2,
+    0x0C, 0x80, 0xFC, 0x03, 0x00, 0xC6, 0x00, 0x80, 0xA4, 0x08, 0x80, 0xA1, 0x08, 0x00, 0xC6, 0x00,
+    0x81, 0x9D, 0x08, 0x81, 0x17, 0x81, 0x8A, 0x04, 0x80, 0x15, 0x81, 0xAC, 0x04, 0x87, 0x92, 0x04,
+    0x84, 0x97, 0x04, 0x81, 0x98, 0x04, 0x82, 0x9F, 0x0C, 0x81, 0x83, 0x0D, 0x80, 0xAA, 0x08, 0x82,
+    0x0C, 0x86, 0xAD, 0x0C, 0x04, 0x84, 0x08, 0xC6, 0x10, 0x06, 0x11, 0xC6, 0x10, 0x85, 0x08, 0x82,
+    0x8C, 0x04, 0x82, 0x70, 0x8B, 0xB7, 0x0C, 0x82, 0x01, 0x87, 0x94, 0x04, 0x87, 0x01, 0x82, 0xBC,
+    0x05, 0x82, 0xBB, 0x08, 0x81, 0x02, 0x85, 0x98, 0x04, 0x80, 0xFF, 0x03, 0x82, 0x9C, 0x04, 0x8B,
+    0xA3, 0x0C, 0x85, 0x01, 0x81, 0x98, 0x04, 0x85, 0x9B, 0x04, 0x84, 0xCA, 0x0C, 0x8A, 0xAE, 0x08,
+    0x87, 0xEF, 0x03, 0x88, 0xEA, 0x03, 0x89, 0x13, 0x85, 0x9F, 0x08, 0x8C, 0xD1, 0x04, 0x87, 0x99,
+    0x08, 0x84, 0x06, 0x8C, 0x01, 0x82, 0x94, 0x04, 0x88, 0xB8, 0x0F, 0x83, 0xC5, 0x0F, 0x87, 0x97,
+    0x04, 0x84, 0x92, 0x04, 0x86, 0xDD, 0x04, 0x83, 0xAA, 0x08, 0x83, 0x04, 0x81, 0x12, 0xCC, 0x9A,
+    0x04, 0x96, 0x01, 0x8A, 0xC9, 0x08, 0x84, 0x85, 0x01, 0x86, 0xC3, 0x05, 0x83, 0x97, 0x01, 0x84,
+    0x99, 0x04, 0x8B, 0xEC, 0x01, 0x85, 0x89, 0x0B, 0x82, 0xE5, 0x02, 0x81, 0x9A, 0x04, 0x80, 0xBD,
+    0x07, 0x80, 0xAC, 0x08, 0x83, 0xB6, 0x0C, 0x81, 0x93, 0x04, 0x85, 0xB2, 0x08, 0x80, 0x09, 0x81,
+    0x9E, 0x04, 0x81, 0xD8, 0x03, 0x81, 0x95, 0x08, 0x80, 0x91, 0x04, 0x81, 0xA0, 0x0C, 0x80, 0xFA,
+    0x03, 0x82, 0xF9, 0x03, 0x02, 0xA5, 0x08, 0xC5, 0x08, 0xC6, 0x08, 0x81, 0xDD, 0x03, 0x00, 0xA5,
+    0x00, 0x81, 0x82, 0x04, 0x80, 0x0E, 0x00, 0xA6, 0x08, 0x80, 0x1B, 0x80, 0x99, 0x04, 0x00, 0xC7,
+    0x08, 0x80, 0xA9, 0x08, 0x82, 0xAB, 0x08, 0x84, 0x01, 0x89, 0x90, 0x04, 0x83, 0xF9, 0x0C, 0x81,
+    0x2B, 0x80, 0xD7, 0x04, 0x00, 0x65, 0x00, 0x84, 0x88, 0x04, 0x81, 0x01, 0x01, 0xA6, 0x08, 0xE7,
+    0x10, 0x80, 0x11, 0x81, 0xFD, 0x08, 0x00, 0x85, 0x08, 0x81, 0x9A, 0x04, 0x80, 0x61, 0x00, 0x64,
+    0x08, 0x81, 0xBC, 0x0C, 0x81, 0x90, 0x04, 0x81, 0x67, 0x83, 0x78, 0x90, 0x87, 0x04, 0x87, 0x01,
+    0x80, 0x9D, 0x01, 0x82, 0xD6, 0x0C, 0x80, 0xBB, 0x05, 0x01, 0x63, 0x08, 0xA4, 0x08, 0x81, 0xA8,
+    0x0C, 0x01, 0x63, 0x08, 0x43, 0x08, 0x84, 0xC6, 0x0C, 0x81, 0xB7, 0x01, 0x83, 0xB6, 0x0C, 0x81,
+    0x01, 0x82, 0xCD, 0x01, 0x82, 0xD0, 0x01, 0x82, 0x91, 0x06, 0x8C, 0x01, 0x00, 0x41, 0x00, 0x80,
+    0x88, 0x08, 0x83, 0x89, 0x08, 0x91, 0x91, 0x04, 0x89, 0xB7, 0x04, 0x84, 0xD5, 0x03, 0x85, 0xCD,
+    0x03, 0x82, 0x12, 0x00, 0x42, 0x08, 0x8B, 0x49, 0x83, 0x1D, 0x86, 0xE8, 0x03, 0x85, 0x2E, 0x8D,
+    0xA0, 0x04, 0x83, 0x83, 0x03, 0x8C, 0x86, 0x07, 0x83, 0x35, 0x84, 0x41, 0x82, 0x88, 0x04, 0x82,
+    0x90, 0x03, 0x89, 0xAF, 0x03, 0x81, 0xD2, 0x0C, 0x94, 0xC9, 0x03, 0xCC, 0xB1, 0x04, 0x83, 0xBE,
+    0x09, 0x85, 0x91, 0x04, 0x82, 0xB4, 0x08, 0x85, 0x15, 0x87, 0xA7, 0x01, 0x84, 0xB3, 0x05, 0x8B,
+    0x92, 0x02, 0x85, 0x94, 0x04, 0x83, 0x01, 0x00, 0x63, 0x00, 0x80, 0xFA, 0x02, 0x01, 0xE5, 0x10,
+    0xA4, 0x08, 0x82, 0x8B, 0x07, 0x82, 0xAC, 0x0B, 0x85, 0x91, 0x03, 0x81, 0x95, 0x04, 0x80, 0x96,
+    0x04, 0x81, 0xFF, 0x07, 0x02, 0xA6, 0x08, 0x29, 0x11, 0x29, 0x11, 0x80, 0x93, 0x04, 0x80, 0x9A,
+    0x08, 0x81, 0x01, 0x02, 0x28, 0x11, 0xCB, 0x21, 0x29, 0x11, 0x81, 0xFE, 0x07, 0x03, 0xE6, 0x08,
+    0xE6, 0x08, 0xA5, 0x08, 0xA5, 0x00, 0x80, 0x02, 0x00, 0xA6, 0x08, 0x81, 0x13, 0x81, 0x9B, 0x08,
+    0x85, 0x8A, 0x04, 0x00, 0x86, 0x00, 0x81, 0xE6, 0x0C, 0x81, 0x06, 0x83, 0x0D, 0x81, 0x86, 0x04,
+    0x83, 0x91, 0x08, 0x80, 0x0A, 0x01, 0xC6, 0x08, 0xC6, 0x10, 0x81, 0x95, 0x04, 0x85, 0x9D, 0x08,
+    0x84, 0x01, 0x80, 0xB0, 0x08, 0x00, 0x85, 0x08, 0x85, 0x0A, 0x83, 0x8C, 0x04, 0x81, 0x85, 0x05,
+    0x81, 0x03, 0x00, 0x64, 0x08, 0x82, 0x09, 0x8C, 0x01, 0x00, 0x84, 0x08, 0x80, 0x8D, 0x01, 0x85,
+    0x01, 0x01, 0x42, 0x00, 0x23, 0x00, 0x82, 0x92, 0x04, 0x03, 0xC5, 0x10, 0x63, 0x08, 0x43, 0x00,
+    0x23, 0x00, 0x81, 0x9C, 0x01, 0x80, 0x08, 0x00, 0x84, 0x08, 0x80, 0xA3, 0x01, 0x01, 0xA4, 0x10,
+    0xA4, 0x10, 0x82, 0x8A, 0x04, 0x85, 0xD5, 0x05, 0x82, 0x08, 0x83, 0xB0, 0x08, 0x82, 0x07, 0x80,
+    0xC0, 0x0C, 0x83, 0xA4, 0x04, 0x8C, 0xEA, 0x01, 0x81, 0xDC, 0x0C, 0x83, 0xAF, 0x04, 0x80, 0x88,
+    0x03, 0x84, 0xA8, 0x04, 0x89, 0x1C, 0x88, 0x9C, 0x04, 0x82, 0x8F, 0x03, 0x8A, 0xAC, 0x02, 0x80,
+    0x8A, 0x09, 0x8D, 0xC5, 0x06, 0x88, 0x8D, 0x04, 0x85, 0x93, 0x04, 0x87, 0x2F, 0x89, 0x8D, 0x04,
+    0x88, 0x98, 0x08, 0x86, 0x64, 0x84, 0x97, 0x03, 0x84, 0x96, 0x04, 0xA5, 0xFF, 0x03, 0xCA, 0x97,
+    0x04, 0x85, 0xA1, 0x09, 0x82, 0x9C, 0x06, 0x85, 0x97, 0x05, 0x83, 0x05, 0x81, 0x99, 0x01, 0x80,
+    0x94, 0x02, 0x87, 0xBB, 0x01, 0x8A, 0x89, 0x02, 0x81, 0xC8, 0x02, 0x87, 0xB0, 0x08, 0x82, 0xAE,
+    0x08, 0x80, 0x89, 0x03, 0x80, 0x01, 0x80, 0xFB, 0x02, 0x83, 0xB9, 0x08, 0x82, 0x98, 0x04, 0x83,
+    0xF3, 0x0F, 0x81, 0xF0, 0x0B, 0x81, 0xF8, 0x0B, 0x80, 0xFD, 0x03, 0x02, 0xE7, 0x08, 0x28, 0x11,
+    0xE7, 0x10, 0x80, 0x83, 0x04, 0x00, 0x85, 0x08, 0x82, 0xB7, 0x08, 0x03, 0x28, 0x11, 0xEC, 0x21,
+    0x6A, 0x19, 0xA6, 0x08, 0x81, 0x99, 0x04, 0x80, 0xF3, 0x07, 0x80, 0x16, 0x01, 0xA5, 0x00, 0x85,
+    0x00, 0x80, 0x19, 0x00, 0xA6, 0x00, 0x80, 0x1B, 0x01, 0x08, 0x11, 0xC6, 0x08, 0x81, 0x90, 0x08,
+    0x84, 0xE9, 0x03, 0x00, 0x65, 0x00, 0x80, 0x9D, 0x08, 0x84, 0x08, 0x84, 0x07, 0x82, 0x01, 0x01,
+    0x27, 0x19, 0x48, 0x21, 0x80, 0x1C, 0x86, 0x88, 0x04, 0x00, 0x85, 0x08, 0x80, 0xB3, 0x0C, 0x81,
+    0x06, 0x00, 0x64, 0x08, 0x80, 0xA4, 0x08, 0x86, 0x98, 0x04, 0x83, 0x8D, 0x04, 0x84, 0xAA, 0x0D,
+    0x80, 0x88, 0x08, 0x80, 0x7C, 0x87, 0xA2, 0x08, 0x81, 0x81, 0x01, 0x80, 0x02, 0x01, 0xA4, 0x08,
+    0xC5, 0x10, 0x86, 0x97, 0x04, 0x85, 0xD1, 0x09, 0x00, 0x43, 0x00, 0x85, 0xF1, 0x0D, 0x81, 0x10,
+    0x00, 0x42, 0x08, 0x81, 0xB0, 0x08, 0x89, 0xA4, 0x08, 0x80, 0x05, 0x80, 0x8F, 0x04, 0x81, 0x16,
+    0x84, 0xCD, 0x0C, 0x87, 0x97, 0x04, 0x80, 0x29, 0x88, 0xEA, 0x01, 0x85, 0x14, 0x82, 0x12, 0x80,
+    0x2B, 0x01, 0x42, 0x08, 0x21, 0x08, 0x84, 0x93, 0x04, 0x83, 0x9A, 0x08, 0x8C, 0xF5, 0x03, 0x84,
+    0xB2, 0x08, 0x84, 0x10, 0x8D, 0xE6, 0x08, 0x8A, 0x2A, 0x85, 0x26, 0x84, 0xD0, 0x02, 0x88, 0x38,
+    0x88, 0x3D, 0x8A, 0x2D, 0x88, 0x86, 0x04, 0x8F, 0x9A, 0x04, 0x84, 0x1D, 0x02, 0x21, 0x00, 0x20,
+    0x00, 0x20, 0x00, 0xC9, 0x89, 0x04, 0x90, 0x99, 0x04, 0x84, 0x98, 0x04, 0x00, 0x41, 0x00, 0x85,
+    0x0F, 0x87, 0xC4, 0x0C, 0x01, 0x62, 0x08, 0x42, 0x08, 0x8B, 0xDE, 0x09, 0x83, 0xB4, 0x01, 0x86,
+    0xD5, 0x06, 0x86, 0xC6, 0x0C, 0x86, 0x9D, 0x04, 0x83, 0x95, 0x04, 0x83, 0xC0, 0x0C, 0x83, 0xFE,
+    0x0F, 0x80, 0x96, 0x04, 0x80, 0xDD, 0x07, 0x80, 0xE9, 0x0B, 0x80, 0x03, 0x02, 0xC6, 0x08, 0xE7,
+    0x10, 0xE7, 0x10, 0x80, 0x05, 0x80, 0x01, 0x02, 0xA5, 0x08, 0xE7, 0x10, 0xE6, 0x10, 0x80, 0x92,
+    0x04, 0x82, 0x97, 0x04, 0x81, 0xC7, 0x0C, 0x81, 0x9E, 0x0C, 0x80, 0x01, 0x82, 0x9C, 0x04, 0x00,
+    0x28, 0x11, 0x80, 0x11, 0x8C, 0x91, 0x08, 0x8B, 0x01, 0x80, 0x2B, 0x80, 0x1E, 0x00, 0x85, 0x00,
+    0x81, 0x1F, 0x81, 0x03, 0x80, 0xF7, 0x04, 0x01, 0xE6, 0x10, 0xC6, 0x10, 0x82, 0x13, 0x00, 0x64,
+    0x08, 0x85, 0x95, 0x04, 0x80, 0xA1, 0x04, 0x80, 0xA6, 0x08, 0x82, 0x6C, 0x81, 0x07, 0x83, 0x08,
+    0x85, 0xC4, 0x0D, 0x82, 0x97, 0x04, 0x82, 0x92, 0x01, 0x82, 0x88, 0x01, 0x83, 0x94, 0x04, 0x8B,
+    0xA3, 0x01, 0x85, 0x04, 0x87, 0x01, 0x82, 0xE8, 0x03, 0x82, 0x98, 0x04, 0x80, 0xE5, 0x01, 0x80,
+    0x9A, 0x04, 0x82, 0xC8, 0x0F, 0x84, 0x84, 0x04, 0x84, 0x93, 0x04, 0x82, 0x0F, 0x8D, 0xF3, 0x07,
+    0x81, 0xA5, 0x06, 0x80, 0x29, 0x83, 0xF0, 0x03, 0x83, 0x05, 0x84, 0x9A, 0x04, 0x84, 0xE1, 0x0B,
+    0x87, 0xE3, 0x07, 0x88, 0x36, 0x81, 0x24, 0x02, 0x42, 0x08, 0x62, 0x08, 0x62, 0x08, 0x86, 0xF2,
+    0x03, 0x85, 0xE8, 0x03, 0x84, 0xE3, 0x06, 0x88, 0xFE, 0x0A, 0x81, 0x85, 0x09, 0x00, 0x41, 0x08,
+    0x84, 0xC2, 0x04, 0x81, 0x75, 0x8A, 0xDE, 0x04, 0x87, 0xD8, 0x08, 0x82, 0x8E, 0x04, 0x81, 0x05,
+    0x82, 0x19, 0x01, 0x41, 0x00, 0x41, 0x08, 0x88, 0x9A, 0x04, 0x81, 0x76, 0x8C, 0x99, 0x08, 0xC9,
+    0x9E, 0x04, 0x86, 0xD6, 0x0D, 0x88, 0x10, 0x82, 0x91, 0x0A, 0x8C, 0x9A, 0x04, 0x87, 0xAC, 0x08,
+    0x85, 0xCB, 0x01, 0x89, 0xE8, 0x0A, 0x85, 0xC2, 0x0C, 0x87, 0xEA, 0x02, 0x84, 0x96, 0x04, 0x00,
+    0x43, 0x00, 0x82, 0xBD, 0x03, 0x81, 0xBE, 0x08, 0x80, 0x97, 0x04, 0x82, 0x05, 0x83, 0xEA, 0x07,
+    0x80, 0x9A, 0x08, 0x80, 0x9F, 0x04, 0x80, 0xA0, 0x04, 0x01, 0xA5, 0x08, 0xC5, 0x08, 0x80, 0xA7,
+    0x04, 0x80, 0xAB, 0x04, 0x81, 0x93, 0x04, 0x80, 0x07, 0x82, 0x96, 0x04, 0x81, 0x06, 0x81, 0xEF,
+    0x03, 0x81, 0xAF, 0x04, 0x87, 0x9A, 0x0C, 0x8A, 0x01, 0x84, 0x3A, 0x83, 0xF4, 0x08, 0x80, 0x3C,
+    0x84, 0x8B, 0x04, 0x80, 0x0C, 0x83, 0x9B, 0x08, 0x86, 0xC4, 0x0C, 0x84, 0x86, 0x04, 0x85, 0x92,
+    0x04, 0x81, 0xA0, 0x04, 0x82, 0xAE, 0x0C, 0x81, 0xCA, 0x0D, 0x84, 0x01, 0x88, 0xFB, 0x03, 0x83,
+    0x0C, 0x8A, 0x8D, 0x04, 0x84, 0x1D, 0x84, 0xBD, 0x01, 0x81, 0xBA, 0x03, 0x00, 0x83, 0x08, 0x82,
+    0xBB, 0x0C, 0x80, 0x15, 0x80, 0x9A, 0x04, 0x88, 0xAF, 0x08, 0x80, 0xFB, 0x03, 0x8A, 0xCC, 0x0C,
+    0x84, 0xA9, 0x03, 0x81, 0x98, 0x0C, 0x85, 0xAC, 0x04, 0x82, 0xB1, 0x08, 0x82, 0xC7, 0x04, 0x85,
+    0xBD, 0x03, 0x8B, 0xB6, 0x06, 0x86, 0xE6, 0x07, 0x80, 0xEC, 0x03, 0x82, 0x91, 0x04, 0x80, 0x06,
+    0x02, 0x82, 0x10, 0xC4, 0x18, 0xA3, 0x10, 0x81, 0x81, 0x0B, 0x84, 0x98, 0x04, 0x84, 0x09, 0x84,
+    0x32, 0x86, 0x82, 0x04, 0x80, 0x15, 0x00, 0x83, 0x10, 0x82, 0x28, 0x84, 0x0B, 0x81, 0xA2, 0x0D,
+    0x88, 0x8F, 0x04, 0x82, 0xA5, 0x07, 0x86, 0xDC, 0x08, 0x84, 0x88, 0x04, 0x82, 0xC1, 0x04, 0x81,
+    0x85, 0x01, 0x87, 0xA1, 0x03, 0x81, 0x11, 0xC8, 0x8A, 0x04, 0x8D, 0x98, 0x04, 0x84, 0x5A, 0x88,
+    0x99, 0x04, 0x8C, 0x1E, 0x83, 0x01, 0x86, 0x9F, 0x04, 0x8F, 0x01, 0x88, 0x8D, 0x04, 0x85, 0xEE,
+    0x02, 0x83, 0x95, 0x04, 0x83, 0x98, 0x04, 0x04, 0x63, 0x00, 0x84, 0x08, 0x06, 0x19, 0x06, 0x19,
+    0xA4, 0x10, 0x84, 0xD7, 0x03, 0x85, 0xBC, 0x08, 0x85, 0xE4, 0x03, 0x81, 0x8B, 0x04, 0x83, 0x9A,
+    0x04, 0x80, 0x06, 0x80, 0x91, 0x04, 0x80, 0xA6, 0x04, 0x82, 0xF0, 0x03, 0x80, 0xBD, 0x04, 0x00,
+    0xC6, 0x08, 0x83, 0xA0, 0x0C, 0x89, 0x9D, 0x0C, 0x81, 0xF0, 0x03, 0x80, 0x41, 0x01, 0xC5, 0x10,
+    0xC5, 0x10, 0x86, 0xB0, 0x0C, 0x82, 0xA3, 0x04, 0x84, 0x17, 0x81, 0x07, 0x84, 0xB9, 0x0C, 0x84,
+    0xA1, 0x0C, 0x85, 0x6F, 0x85, 0x01, 0x80, 0x15, 0x81, 0x8A, 0x01, 0x80, 0xA4, 0x05, 0x82, 0x8F,
+    0x01, 0x8A, 0x97, 0x04, 0x8B, 0x01, 0x89, 0xFA, 0x0D, 0x83, 0x95, 0x04, 0x82, 0xAB, 0x08, 0x82,
+    0x85, 0x04, 0x85, 0xAE, 0x04, 0x83, 0xED, 0x03, 0x85, 0xDA, 0x01, 0x84, 0x0B, 0x85, 0xE6, 0x07,
+    0x82, 0x91, 0x04, 0x83, 0xAB, 0x04, 0x82, 0x16, 0x82, 0x9D, 0x03, 0x84, 0x98, 0x04, 0x84, 0xB9,
+    0x03, 0x88, 0x84, 0x0C, 0x89, 0x8D, 0x08, 0x01, 0x62, 0x08, 0xA3, 0x10, 0x81, 0x91, 0x04, 0x80,
+    0x01, 0x04, 0x83, 0x10, 0xE4, 0x18, 0xC4, 0x18, 0x62, 0x08, 0x41, 0x00, 0x85, 0xBD, 0x02, 0x82,
+    0xF9, 0x0A, 0x84, 0xDE, 0x06, 0x83, 0xA2, 0x04, 0x86, 0x16, 0x82, 0x49, 0x84, 0x6E, 0x81, 0x98,
+    0x04, 0x85, 0x80, 0x09, 0x85, 0x91, 0x03, 0x85, 0x25, 0x85, 0x8E, 0x03, 0x81, 0x89, 0x04, 0x81,
+    0x0F, 0x80, 0x25, 0x86, 0xAD, 0x03, 0x85, 0xBD, 0x03, 0x8F, 0x01, 0xC2, 0xB8, 0x08, 0x86, 0x81,
+    0x01, 0x89, 0x06, 0x8A, 0x1E, 0x83, 0x21, 0x82, 0x9D, 0x01, 0x81, 0xC0, 0x02, 0x80, 0xC2, 0x0F,
+    0x87, 0xF1, 0x0E, 0x83, 0xD4, 0x02, 0x84, 0x0A, 0x81, 0xD3, 0x01, 0x82, 0xB9, 0x0F, 0x81, 0xC8,
+    0x02, 0x81, 0x98, 0x03, 0x86, 0xBE, 0x07, 0x80, 0xB9, 0x03, 0x03, 0x84, 0x08, 0x27, 0x21, 0x47,
+    0x21, 0xC5, 0x10, 0x81, 0xE0, 0x0B, 0x83, 0xC3, 0x03, 0x81, 0xE9, 0x07, 0x83, 0xF0, 0x03, 0x82,
+    0x85, 0x04, 0x80, 0xFB, 0x07, 0x81, 0x92, 0x04, 0x81, 0xE1, 0x0C, 0x82, 0x10, 0x80, 0xEF, 0x03,
+    0x80, 0x93, 0x0C, 0x82, 0x15, 0x01, 0x84, 0x08, 0xA5, 0x08, 0x82, 0x1F, 0x83, 0x81, 0x04, 0x00,
+    0x64, 0x00, 0x84, 0xE2, 0x03, 0x82, 0xAC, 0x08, 0x80, 0x04, 0x85, 0x9B, 0x08, 0x82, 0x1D, 0x86,
+    0xA3, 0x0C, 0x86, 0x93, 0x04, 0x85, 0xAE, 0x0C, 0x85, 0xB9, 0x0D, 0x81, 0x78, 0x86, 0xA3, 0x08,
+    0x8B, 0x98, 0x08, 0x00, 0x43, 0x08, 0x8C, 0xB3, 0x0C, 0x85, 0x06, 0x84, 0xB6, 0x01, 0x85, 0xCD,
+    0x01, 0x84, 0xAC, 0x0C, 0x82, 0x17, 0x84, 0x2C, 0x90, 0xFE, 0x05, 0x8C, 0x8B, 0x06, 0x00, 0x63,
+    0x08, 0x82, 0xED, 0x03, 0x87, 0x88, 0x02, 0x82, 0x85, 0x0C, 0x84, 0xEA, 0x03, 0x85, 0x98, 0x04,
+    0x86, 0xA0, 0x04, 0x82, 0xB0, 0x08, 0x00, 0x62, 0x10, 0x82, 0x1C, 0x80, 0x8F, 0x08, 0x00, 0x82,
+    0x10, 0x82, 0x85, 0x04, 0x83, 0x66, 0x80, 0xCC, 0x04, 0x85, 0xF5, 0x03, 0x80, 0x15, 0x85, 0x99,
+    0x04, 0x86, 0xEE, 0x06, 0x82, 0xE0, 0x02, 0x85, 0x26, 0x84, 0xDB, 0x04, 0x80, 0xF8, 0x02, 0x83,
+    0x9E, 0x0D, 0x82, 0xFF, 0x02, 0x81, 0x14, 0x88, 0xAB, 0x03, 0x82, 0xCF, 0x0C, 0x94, 0xC4, 0x07,
+    0xED, 0x01, 0x85, 0xEA, 0x01, 0x01, 0x42, 0x00, 0x83, 0x08, 0x80, 0x96, 0x04, 0x00, 0x84, 0x08,
+    0x88, 0x98, 0x04, 0x80, 0x9A, 0x02, 0x8A, 0xCC, 0x0C, 0x84, 0x9D, 0x03, 0x87, 0xB1, 0x03, 0x83,
+    0xD1, 0x07, 0x80, 0xD1, 0x0B, 0x00, 0xA4, 0x10, 0x82, 0xD8, 0x03, 0x82, 0xEC, 0x0B, 0x83, 0x04,
+    0x85, 0x01, 0x84, 0xE5, 0x03, 0x84, 0xFA, 0x07, 0x83, 0xE4, 0x03, 0x85, 0xED, 0x03, 0x88, 0x26,
+    0x82, 0x0F, 0x00, 0x64, 0x08, 0x80, 0xAC, 0x08, 0x80, 0xD4, 0x04, 0x84, 0xE3, 0x04, 0x84, 0xC1,
+    0x08, 0x86, 0x8B, 0x04, 0x81, 0xAD, 0x0C, 0x81, 0x0C, 0x84, 0xAD, 0x0D, 0x87, 0x97, 0x04, 0x84,
+    0x80, 0x01, 0x8B, 0xA3, 0x08, 0x85, 0x97, 0x08, 0x83, 0xA1, 0x0C, 0x85, 0x12, 0x84, 0xCE, 0x05,
+    0x8A, 0x0D, 0x86, 0xC1, 0x01, 0x83, 0x90, 0x03, 0x83, 0xBC, 0x08, 0x84, 0x14, 0x91, 0x9A, 0x0A,
+    0x81, 0x01, 0x00, 0x41, 0x00, 0x82, 0xC2, 0x0B, 0x81, 0xE8, 0x03, 0x81, 0x0B, 0x80, 0x8B, 0x08,
+    0x83, 0xD3, 0x0C, 0x8F, 0x01, 0x86, 0xE7, 0x03, 0x8C, 0xDF, 0x0A, 0x82, 0xBB, 0x04, 0x85, 0x99,
+    0x04, 0x83, 0xF6, 0x03, 0x83, 0xA2, 0x04, 0x85, 0xB2, 0x0C, 0x8A, 0xEE, 0x08, 0x88, 0xDB, 0x04,
+    0x84, 0xFA, 0x03, 0x86, 0x81, 0x04, 0x8A, 0x98, 0x04, 0x82, 0x0A, 0x81, 0x2A, 0x84, 0x0F, 0xED,
+    0x8A, 0x04, 0x8B, 0x01, 0x86, 0x97, 0x0A, 0x80, 0x85, 0x0F, 0x80, 0x98, 0x04, 0x84, 0xB0, 0x08,
+    0x85, 0xDB, 0x06, 0x88, 0x96, 0x04, 0x82, 0x99, 0x07, 0x81, 0xA6, 0x03, 0x86, 0xEC, 0x0F, 0x00,
+    0x63, 0x08, 0x85, 0xED, 0x03, 0x82, 0x05, 0x83, 0xF3, 0x07, 0x82, 0xDF, 0x0B, 0x86, 0xF3, 0x03,
+    0x83, 0xD0, 0x03, 0x80, 0x09, 0x83, 0x11, 0x83, 0x90, 0x04, 0x82, 0xD0, 0x03, 0x84, 0x92, 0x04,
+    0x84, 0x8C, 0x08, 0x80, 0x32, 0x84, 0xEE, 0x08, 0x02, 0xA4, 0x08, 0x64, 0x08, 0x64, 0x08, 0x80,
+    0x3C, 0x86, 0xFE, 0x08, 0x88, 0xA0, 0x08, 0x84, 0x5F, 0x82, 0x97, 0x04, 0x86, 0x8B, 0x04, 0x8D,
+    0xB2, 0x0C, 0x87, 0xF5, 0x07, 0x84, 0x19, 0x8B, 0x8B, 0x04, 0x82, 0x97, 0x08, 0x80, 0xF5, 0x09,
+    0x84, 0xC0, 0x0C, 0x8F, 0x01, 0x84, 0x3E, 0x83, 0xF9, 0x05, 0x85, 0xD3, 0x03, 0x81, 0x0D, 0x89,
+    0xCC, 0x0C, 0x80, 0xE3, 0x07, 0x81, 0xE4, 0x07, 0x85, 0x01, 0x01, 0x83, 0x10, 0xC4, 0x18, 0x86,
+    0x0B, 0x88, 0xFF, 0x03, 0x80, 0xB7, 0x04, 0x82, 0x14, 0x85, 0xE9, 0x03, 0x85, 0xFA, 0x0E, 0x88,
+    0x8D, 0x04, 0x81, 0x40, 0x00, 0x62, 0x08, 0x88, 0x89, 0x04, 0x87, 0xD5, 0x08, 0x88, 0x07, 0x86,
+    0xF4, 0x08, 0x84, 0x51, 0x83, 0xB2, 0x08, 0x84, 0xB7, 0x08, 0x85, 0xAF, 0x08, 0x82, 0xC1, 0x08,
+    0x8E, 0xA8, 0x04, 0x83, 0x16, 0x9E, 0x01, 0x00, 0x20, 0x00, 0xC2, 0xD5, 0x0C, 0x8B, 0x69, 0x87,
+    0xC4, 0x01, 0x85, 0xC8, 0x0C, 0x83, 0xAA, 0x02, 0x84, 0xC4, 0x02, 0x00, 0x62, 0x08, 0x80, 0xDE,
+    0x02, 0x83, 0x0C, 0x87, 0x8E, 0x03, 0x89, 0x98, 0x04, 0x00, 0x83, 0x08, 0x80, 0xD0, 0x03, 0x83,
+    0xC2, 0x03, 0x82, 0x01, 0x80, 0xE6, 0x03, 0x01, 0x84, 0x08, 0xC5, 0x10, 0x80, 0xE9, 0x03, 0x82,
+    0xFB, 0x03, 0x83, 0x14, 0x85, 0xD0, 0x03, 0x01, 0x84, 0x08, 0xE5, 0x10, 0x80, 0x0E, 0x80, 0xE0,
+    0x03, 0x80, 0x27, 0x00, 0x63, 0x08, 0x80, 0xEC, 0x04, 0x81, 0xE3, 0x03, 0x84, 0xEB, 0x08, 0x86,
+    0xBD, 0x08, 0x87, 0xDE, 0x04, 0x01, 0x64, 0x08, 0xA5, 0x08, 0x81, 0x3A, 0x83, 0x30, 0x83, 0x9F,
+    0x08, 0x87, 0xA6, 0x08, 0x85, 0xB8, 0x08, 0x83, 0xBE, 0x0C, 0x8B, 0xA8, 0x08, 0x81, 0x10, 0x82,
+    0xB9, 0x08, 0x86, 0x8E, 0x08, 0x85, 0x90, 0x08, 0x8B, 0xA3, 0x08, 0x82, 0x0F, 0x81, 0x98, 0x04,
+    0x85, 0xCA, 0x0C, 0x8E, 0x01, 0x82, 0x19, 0x8A, 0x87, 0x0A, 0x00, 0x42, 0x08, 0x80, 0xB3, 0x0C,
+    0x81, 0xC6, 0x04, 0x85, 0x98, 0x04, 0x03, 0x41, 0x00, 0xA3, 0x10, 0x05, 0x21, 0xE4, 0x18, 0x80,
+    0xDA, 0x03, 0x85, 0xB7, 0x03, 0x83, 0x83, 0x04, 0x87, 0x99, 0x04, 0x85, 0x9B, 0x04, 0x81, 0x9C,
+    0x09, 0x85, 0xC5, 0x04, 0x8A, 0xAD, 0x08, 0x87, 0xF9, 0x03, 0x82, 0xCC, 0x04, 0x84, 0x80, 0x04,
+    0x85, 0xB4, 0x08, 0x88, 0x91, 0x04, 0x84, 0xFA, 0x06, 0x82, 0x91, 0x09, 0x83, 0x08, 0x81, 0x5E,
+    0x85, 0xCD, 0x0C, 0x83, 0xCF, 0x0C, 0x81, 0x86, 0x04, 0x86, 0x90, 0x04, 0x83, 0x96, 0x03, 0x82,
+    0x32, 0x88, 0xA3, 0x03, 0x89, 0x1A, 0x8D, 0xC1, 0x03, 0x88, 0x14, 0xC2, 0x98, 0x04, 0x89, 0x73,
+    0x82, 0x01, 0x80, 0xEF, 0x09, 0x84, 0xD6, 0x0D, 0x87, 0xCE, 0x01, 0x83, 0x9A, 0x02, 0x80, 0xBF,
+    0x02, 0x80, 0xB2, 0x02, 0x8B, 0xC9, 0x0F, 0x83, 0x9A, 0x04, 0x82, 0xBA, 0x03, 0x81, 0x9A, 0x03,
+    0x02, 0x63, 0x00, 0xA4, 0x08, 0xC5, 0x08, 0x80, 0xF7, 0x03, 0x83, 0xC5, 0x03, 0x82, 0x04, 0x02,
+    0x84, 0x08, 0xA5, 0x10, 0xA4, 0x08, 0x82, 0xB0, 0x08, 0x85, 0x01, 0x84, 0x23, 0x80, 0xBB, 0x04,
+    0x82, 0x1B, 0x82, 0xEB, 0x0C, 0x80, 0x09, 0x86, 0xB1, 0x04, 0x84, 0xE5, 0x08, 0x81, 0x2B, 0x83,
+    0xBA, 0x04, 0x82, 0x99, 0x04, 0x80, 0x9A, 0x04, 0x85, 0x0D, 0x87, 0xD0, 0x04, 0x82, 0x07, 0x81,
+    0xCC, 0x04, 0x81, 0x09, 0x81, 0xD0, 0x04, 0x80, 0x47, 0x00, 0x43, 0x08, 0x80, 0x0D, 0x81, 0x08,
+    0x82, 0x73, 0x83, 0x9C, 0x08, 0x83, 0x04, 0x84, 0xD3, 0x09, 0x8A, 0x01, 0x87, 0xD9, 0x0C, 0x85,
+    0x92, 0x08, 0x84, 0x05, 0x8B, 0x98, 0x04, 0x87, 0xC7, 0x03, 0x82, 0x99, 0x04, 0x82, 0xE2, 0x03,
+    0x83, 0xC1, 0x03, 0x03, 0x42, 0x00, 0x62, 0x08, 0x83, 0x08, 0x62, 0x08, 0x86, 0x89, 0x06, 0x80,
+    0x01, 0x02, 0x41, 0x08, 0xA3, 0x10, 0xC4, 0x18, 0x82, 0xBD, 0x0C, 0x86, 0xFE, 0x07, 0x85, 0x82,
+    0x04, 0x83, 0xD6, 0x03, 0x86, 0x8E, 0x04, 0x83, 0xE3, 0x0C, 0x86, 0xFA, 0x03, 0x89, 0x58, 0x84,
+    0x0F, 0x83, 0xB0, 0x08, 0x86, 0x0D, 0x01, 0x01, 0x00, 0x41, 0x08, 0x82, 0xFC, 0x03, 0x88, 0xA1,
+    0x04, 0x83, 0x17, 0x00, 0x41, 0x00, 0x80, 0xED, 0x02, 0x84, 0x1E, 0x80, 0xF9, 0x0C, 0x84, 0xA5,
+    0x08, 0x89, 0x95, 0x0D, 0x89, 0xA3, 0x03, 0x89, 0x85, 0x04, 0x91, 0x13, 0x88, 0x0A, 0x81, 0xA8,
+    0x08, 0xC3, 0xAB, 0x08, 0x81, 0x87, 0x01, 0x91, 0x14, 0x86, 0xB6, 0x01, 0x86, 0x09, 0x80, 0xBB,
+    0x02, 0x83, 0x98, 0x04, 0x87, 0xC1, 0x0B, 0x84, 0x9E, 0x04, 0x8A, 0xB7, 0x07, 0x80, 0xBE, 0x03,
+    0x00, 0xA5, 0x08, 0x86, 0x9D, 0x08, 0x83, 0xA5, 0x0C, 0x89, 0x97, 0x04, 0x86, 0xFA, 0x0B, 0x82,
+    0xE1, 0x03, 0x81, 0xA0, 0x08, 0x81, 0xE4, 0x03, 0x85, 0x1E, 0x83, 0x81, 0x08, 0x88, 0xAD, 0x0C,
+    0x85, 0xE5, 0x04, 0x8A, 0x39, 0x84, 0x0C, 0x80, 0x16, 0x00, 0xA4, 0x10, 0x80, 0xC6, 0x08, 0x83,
+    0x0D, 0x83, 0x47, 0x82, 0xDA, 0x0D, 0x88, 0x85, 0x01, 0x85, 0x0A, 0x93, 0x97, 0x04, 0x88, 0x21,
+    0x81, 0x3B, 0x85, 0x84, 0x04, 0x88, 0xE0, 0x03, 0x8A, 0xDF, 0x07, 0x87, 0xCB, 0x03, 0x80, 0xC9,
+    0x03, 0x81, 0x5F, 0x00, 0x62, 0x08, 0x84, 0xEC, 0x03, 0x81, 0xCB, 0x07, 0x80, 0x0F, 0x80, 0x8C,
+    0x06, 0x81, 0xB1, 0x08, 0x89, 0xF7, 0x03, 0x8E, 0x34, 0x8B, 0x40, 0x8C, 0xA0, 0x0C, 0x88, 0xA0,
+    0x04, 0x81, 0x04, 0x00, 0x62, 0x08, 0x83, 0x47, 0x85, 0x15, 0x81, 0x8D, 0x04, 0x86, 0xB0, 0x04,
+    0x84, 0x29, 0x85, 0xBD, 0x08, 0x88, 0xC7, 0x08, 0x84, 0x0B, 0x81, 0x8B, 0x03, 0x8B, 0x97, 0x03,
+    0xC3, 0xF2, 0x03, 0x8A, 0x01, 0x83, 0xDC, 0x04, 0x80, 0x92, 0x05, 0x8F, 0x8A, 0x04, 0x82, 0x81,
+    0x01, 0x8F, 0x96, 0x04, 0x86, 0x9A, 0x04, 0x85, 0xE5, 0x01, 0x82, 0xE7, 0x06, 0x84, 0x84, 0x0B,
+    0x89, 0x89, 0x03, 0x84, 0xD4, 0x0B, 0x87, 0x97, 0x03, 0x87, 0xDC, 0x03, 0x8B, 0xD7, 0x03, 0x85,
+    0xC9, 0x03, 0x81, 0x2E, 0x82, 0xF0, 0x07, 0x83, 0x8A, 0x0C, 0x03, 0x63, 0x08, 0xA4, 0x10, 0xC4,
+    0x10, 0xA4, 0x10, 0x82, 0xFC, 0x07, 0x84, 0xF0, 0x03, 0x82, 0xAA, 0x08, 0x82, 0xC4, 0x0C, 0x86,
+    0x9B, 0x08, 0x8C, 0x01, 0x84, 0xF9, 0x04, 0x82, 0xB1, 0x04, 0x00, 0x84, 0x08, 0x81, 0x34, 0x86,
+    0x6B, 0x82, 0x11, 0x86, 0xEE, 0x03, 0x82, 0x05, 0x82, 0x1A, 0x8D, 0xAD, 0x03, 0x8E, 0x97, 0x04,
+    0x82, 0x27, 0x8F, 0xD2, 0x03, 0x86, 0x80, 0x0C, 0x85, 0x06, 0x86, 0xE1, 0x03, 0x80, 0xD0, 0x0B,
+    0x80, 0xB2, 0x08, 0x00, 0x83, 0x10, 0x84, 0x80, 0x09, 0x80, 0xD4, 0x0C, 0x89, 0x19, 0x89, 0xB1,
+    0x08, 0x80, 0x0A, 0x89, 0x4E, 0x87, 0xB0, 0x04, 0x86, 0x20, 0x86, 0x89, 0x04, 0x85, 0x0C, 0x83,
+    0x09, 0x81, 0x06, 0x01, 0x83, 0x10, 0xA4, 0x10, 0x82, 0x91, 0x0D, 0x82, 0x0D, 0x80, 0xA2, 0x04,
+    0x80, 0x96, 0x04, 0x80, 0xBA, 0x08, 0x88, 0xB7, 0x0C, 0x82, 0x17, 0x88, 0xF0, 0x02, 0x81, 0xFD,
+    0x03, 0x81, 0x12, 0x80, 0x24, 0x00, 0x21, 0x08, 0x83, 0xC9, 0x0F, 0x83, 0xCE, 0x0C, 0x85, 0x8F,
+    0x04, 0x85, 0x53, 0xD1, 0x98, 0x04, 0x00, 0x21, 0x08, 0x90, 0x19, 0x81, 0x93, 0x01, 0x8E, 0x12,
+    0x84, 0x91, 0x01, 0x87, 0x97, 0x04, 0x91, 0x01, 0x81, 0x88, 0x04, 0x81, 0x92, 0x08, 0x84, 0xB2,
+    0x07, 0x82, 0xBF, 0x03, 0x81, 0xA6, 0x04, 0x83, 0xAD, 0x08, 0x82, 0xB1, 0x03, 0x84, 0xC3, 0x08,
+    0x86, 0x91, 0x04, 0x85, 0x0B, 0x00, 0x63, 0x08, 0x80, 0xA7, 0x0F, 0x80, 0x89, 0x0F, 0x82, 0x2A,
+    0x03, 0x43, 0x00, 0x83, 0x08, 0xE4, 0x10, 0x05, 0x19, 0x83, 0x98, 0x04, 0x84, 0xCB, 0x0C, 0x83,
+    0xAD, 0x08, 0x84, 0x94, 0x04, 0x84, 0x98, 0x04, 0x83, 0xF3, 0x04, 0x84, 0x9B, 0x08, 0x85, 0x98,
+    0x04, 0x81, 0x34, 0x87, 0x4B, 0x8D, 0x01, 0x83, 0xAC, 0x04, 0x80, 0xB4, 0x04, 0x00, 0x63, 0x08,
+    0x9B, 0x97, 0x04, 0x85, 0xBE, 0x0C, 0x83, 0xBC, 0x04, 0x82, 0xC2, 0x0B, 0x89, 0xBF, 0x0C, 0x89,
+    0x01, 0x83, 0xA1, 0x07, 0x86, 0x0D, 0x80, 0xB4, 0x03, 0x84, 0xB0, 0x08, 0x87, 0xD1, 0x07, 0x82,
+    0xB7, 0x08, 0x88, 0xA3, 0x04, 0x89, 0x95, 0x02, 0x86, 0x22, 0x01, 0x62, 0x08, 0x83, 0x10, 0x82,
+    0x20, 0x81, 0xA7, 0x0C, 0x8A, 0xB0, 0x04, 0x84, 0x1C, 0x86, 0xF7, 0x0C, 0x00, 0x42, 0x08, 0x82,
+    0x23, 0x82, 0xDC, 0x03, 0x80, 0x4C, 0x81, 0xBB, 0x08, 0x00, 0x41, 0x08, 0x81, 0x04, 0x82, 0xE8,
+    0x02, 0x85, 0xA9, 0x08, 0x84, 0x86, 0x03, 0x85, 0xC3, 0x04, 0x81, 0xAE, 0x03, 0x01, 0x82, 0x10,
+    0xC3, 0x18, 0x81, 0xBF, 0x0D, 0x83, 0x3A, 0x8C, 0xAC, 0x03, 0x01, 0x41, 0x08, 0x82, 0x10, 0x80,
+    0x37, 0x85, 0x0C, 0xC8, 0x9C, 0x04, 0x81, 0x68, 0x87, 0x0C, 0x89, 0x0B, 0x90, 0x28, 0x84, 0xB6,
+    0x05, 0x87, 0x83, 0x02, 0x8F, 0x9C, 0x04, 0x87, 0xAD, 0x07, 0x84, 0xD4, 0x07, 0x87, 0xD0, 0x0C,
+    0x86, 0xBD, 0x03, 0x83, 0x24, 0x80, 0x0D, 0x80, 0xF9, 0x03, 0x88, 0x9D, 0x03, 0x01, 0x83, 0x08,
+    0x83, 0x08, 0x85, 0x2A, 0x87, 0xB0, 0x08, 0x82, 0xAC, 0x08, 0x87, 0x8F, 0x04, 0x89, 0xE0, 0x08,
+    0x84, 0xEE, 0x04, 0x87, 0x8F, 0x08, 0x89, 0x10, 0x88, 0xEA, 0x03, 0x89, 0x01, 0x86, 0xE0, 0x03,
+    0x8B, 0xA5, 0x01, 0x84, 0x23, 0x83, 0xBB, 0x0C, 0x82, 0x23, 0x84, 0x92, 0x01, 0x86, 0xAF, 0x03,
+    0x8B, 0xEF, 0x07, 0x80, 0xAE, 0x05, 0x8C, 0x9C, 0x04, 0x88, 0x0C, 0x87, 0xD8, 0x03, 0x82, 0x09,
+    0x01, 0x82, 0x08, 0x83, 0x10, 0x85, 0xCD, 0x0C, 0x8B, 0x9C, 0x04, 0x86, 0xF3, 0x03, 0x80, 0x01,
+    0x80, 0x8D, 0x08, 0x81, 0x93, 0x04, 0x00, 0x01, 0x00, 0x80, 0xF2, 0x03, 0x87, 0x44, 0x80, 0x9B,
+    0x0B, 0x86, 0x8F, 0x08, 0x87, 0x08, 0x86, 0xA7, 0x04, 0x81, 0x98, 0x04, 0x83, 0xC0, 0x04, 0x83,
+    0xDA, 0x03, 0x82, 0x8E, 0x08, 0x86, 0x1A, 0x85, 0x25, 0x82, 0x9E, 0x03, 0x00, 0x62, 0x08, 0x81,
+    0x80, 0x04, 0x82, 0xC5, 0x04, 0x86, 0xBA, 0x0C, 0x80, 0xC7, 0x04, 0x84, 0xB0, 0x03, 0x01, 0x41,
+    0x08, 0x62, 0x10, 0x86, 0x98, 0x04, 0x87, 0xC9, 0x03, 0xC1, 0x99, 0x04, 0x8A, 0xC0, 0x0C, 0x88,
+    0x84, 0x04, 0x91, 0x98, 0x04, 0x83, 0x9B, 0x04, 0x80, 0x97, 0x03, 0x8A, 0xDE, 0x06, 0x86, 0xBC,
+    0x08, 0x90, 0xA4, 0x03, 0x85, 0xBF, 0x03, 0x81, 0x1A, 0x83, 0x09, 0x82, 0x25, 0x81, 0x92, 0x03,
+    0x81, 0xC9, 0x07, 0x84, 0xEF, 0x0B, 0x83, 0xE8, 0x0B, 0x83, 0x09, 0x81, 0x89, 0x04, 0x82, 0x0F,
+    0x81, 0x01, 0x87, 0x8D, 0x04, 0x8F, 0xBE, 0x0C, 0x92, 0x88, 0x04, 0x87, 0x83, 0x04, 0x83, 0x03,
+    0x80, 0x1F, 0x00, 0x43, 0x08, 0x85, 0x0B, 0x84, 0x8F, 0x01, 0x87, 0xC8, 0x03, 0x8A, 0x97, 0x04,
+    0x81, 0x74, 0x85, 0xAA, 0x01, 0x8A, 0x25, 0x81, 0x99, 0x01, 0x82, 0xD4, 0x01, 0x83, 0xA0, 0x01,
+    0x85, 0x01, 0x80, 0xE0, 0x0D, 0x86, 0x0B, 0x87, 0xD1, 0x0C, 0x85, 0xF8, 0x01, 0x87, 0x81, 0x0C,
+    0x82, 0x14, 0x83, 0xB0, 0x08, 0x88, 0xFE, 0x07, 0x82, 0xBE, 0x03, 0x85, 0xBA, 0x04, 0x84, 0x39,
+    0x00, 0x42, 0x00, 0x83, 0x1F, 0x84, 0xA6, 0x04, 0x84, 0x49, 0x84, 0xFB, 0x03, 0x85, 0x98, 0x04,
+    0x82, 0x09, 0x87, 0x85, 0x0B, 0x87, 0x94, 0x04, 0x81, 0x91, 0x03, 0x85, 0x16, 0x82, 0xF4, 0x02,
+    0x86, 0x75, 0x83, 0x13, 0x84, 0x24, 0x84, 0x1B, 0x86, 0x98, 0x04, 0x83, 0xB1, 0x04, 0x81, 0x01,
+    0x8C, 0xAB, 0x03, 0xCC, 0xD7, 0x0C, 0x89, 0x5A, 0x8F, 0x0F, 0x84, 0xA7, 0x01, 0x84, 0xCE, 0x01,
+    0x89, 0xE9, 0x01, 0x84, 0x13, 0x84, 0xE6, 0x03, 0x84, 0x91, 0x07, 0x83, 0xFC, 0x02, 0x82, 0x99,
+    0x08, 0x88, 0xEF, 0x0F, 0x85, 0x83, 0x03, 0x83, 0xBC, 0x0B, 0x86, 0x16, 0x81, 0xAA, 0x08, 0x84,
+    0x33, 0x84, 0x98, 0x04, 0x82, 0x01, 0x83, 0xF5, 0x0C, 0x8D, 0x8F, 0x04, 0x84, 0xFB, 0x08, 0x84,
+    0x09, 0x85, 0x5F, 0x8C, 0x9E, 0x08, 0x81, 0x53, 0x84, 0xF6, 0x03, 0x85, 0xEE, 0x03, 0x82, 0x0B,
+    0x86, 0xDF, 0x03, 0x8A, 0xEB, 0x07, 0x81, 0x15, 0x80, 0xA7, 0x03, 0x81, 0x82, 0x01, 0x81, 0xAF,
+    0x01, 0x81, 0x3E, 0x89, 0x16, 0x83, 0xB2, 0x04, 0x8D, 0xBE, 0x0C, 0x81, 0xD1, 0x03, 0x8A, 0x49,
+    0x82, 0xF6, 0x07, 0x81, 0x0D, 0x85, 0xF6, 0x01, 0x83, 0x56, 0x80, 0xFA, 0x07, 0x87, 0xA2, 0x04,
+    0x89, 0x96, 0x0C, 0x86, 0x93, 0x02, 0x88, 0xEA, 0x07, 0x86, 0x09, 0x87, 0xCA, 0x06, 0x86, 0x99,
+    0x01, 0x85, 0xC6, 0x04, 0x85, 0xC5, 0x03, 0x83, 0xEC, 0x03, 0x82, 0xAB, 0x0C, 0x85, 0xCB, 0x05,
+    0x83, 0x14, 0x84, 0xE2, 0x03, 0x84, 0x2C, 0x85, 0x89, 0x03, 0x84, 0x0B, 0x89, 0x9E, 0x03, 0xD6,
+    0x81, 0x04, 0x92, 0x01, 0x8C, 0xFD, 0x04, 0x84, 0x7F, 0x85, 0xBC, 0x01, 0x8B, 0xE7, 0x01, 0x86,
+    0x8B, 0x06, 0x81, 0xF2, 0x02, 0x83, 0xF3, 0x03, 0x85, 0x87, 0x04, 0x86, 0xF3, 0x02, 0x83, 0xB6,
+    0x08, 0x85, 0x9A, 0x08, 0x8A, 0x95, 0x02, 0x83, 0xA6, 0x04, 0x84, 0xBF, 0x04, 0x81, 0x06, 0x85,
+    0xF4, 0x0C, 0x87, 0x9F, 0x0C, 0x85, 0xEE, 0x08, 0x93, 0x9B, 0x08, 0x84, 0xD9, 0x08, 0x84, 0x3F,
+    0x86, 0x22, 0x84, 0x4F, 0x85, 0xC6, 0x03, 0x89, 0x10, 0x83, 0x05, 0x84, 0x84, 0x04, 0x82, 0x87,
+    0x04, 0x86, 0xBD, 0x04, 0x84, 0xB2, 0x01, 0x8C, 0x90, 0x01, 0x87, 0x0F, 0x88, 0xBC, 0x03, 0x87,
+    0x92, 0x04, 0x83, 0xA1, 0x04, 0x82, 0x05, 0x81, 0x36, 0x01, 0x62, 0x08, 0x83, 0x10, 0x85, 0xEF,
+    0x01, 0x83, 0x16, 0x85, 0xEA, 0x03, 0x86, 0x8F, 0x02, 0x81, 0x64, 0x86, 0xAA, 0x08, 0x8B, 0x8F,
+    0x04, 0x87, 0x94, 0x08, 0x84, 0xC3, 0x04, 0x8B, 0x9E, 0x04, 0x83, 0x1A, 0x82, 0x8C, 0x04, 0x84,
+    0xAA, 0x0C, 0x84, 0xEF, 0x08, 0x81, 0xE9, 0x02, 0x87, 0x81, 0x03, 0x84, 0xD5, 0x0C, 0x82, 0x1E,
+    0x87, 0x9C, 0x03, 0x8C, 0x89, 0x04, 0x91, 0xAB, 0x03, 0xEB, 0x01, 0x87, 0xE6, 0x05, 0x8C, 0x89,
+    0x06, 0x8C, 0xDF, 0x02, 0x8C, 0xD3, 0x02, 0x82, 0x84, 0x08, 0x83, 0x8B, 0x03, 0x8D, 0x8E, 0x07,
+    0x85, 0x9F, 0x03, 0x87, 0xCD, 0x08, 0x80, 0x01, 0x00, 0xA4, 0x10, 0x80, 0x87, 0x0F, 0x91, 0x85,
+    0x04, 0x84, 0x82, 0x08, 0x84, 0xF8, 0x08, 0x88, 0xA5, 0x08, 0x80, 0xE8, 0x08, 0x85, 0xE3, 0x0B,
+    0x85, 0x83, 0x04, 0x84, 0xA6, 0x08, 0x84, 0xCC, 0x0D, 0x82, 0xAA, 0x0C, 0x84, 0xA9, 0x0B, 0x84,
+    0x11, 0x84, 0xCA, 0x09, 0x00, 0x84, 0x08, 0x83, 0xD3, 0x08, 0x86, 0xD8, 0x08, 0x83, 0x99, 0x04,
+    0x8E, 0x8D, 0x01, 0x81, 0x8B, 0x08, 0x8D, 0xBD, 0x01, 0x00, 0x63, 0x08, 0x80, 0xA2, 0x0B, 0x83,
+    0x01, 0x82, 0xBE, 0x0C, 0x83, 0xB5, 0x03, 0x82, 0x03, 0x00, 0xA3, 0x10, 0x81, 0xDE, 0x0F, 0x83,
+    0xF6, 0x01, 0x80, 0x98, 0x04, 0x80, 0xAF, 0x08, 0x84, 0x60, 0x84, 0xC3, 0x03, 0x83, 0xCC, 0x03,
+    0x81, 0xB4, 0x0C, 0x86, 0xE2, 0x03, 0x84, 0xA1, 0x02, 0x87, 0x85, 0x01, 0x84, 0x34, 0x83, 0xB6,
+    0x0C, 0x85, 0x81, 0x08, 0x85, 0x41, 0x84, 0x2B, 0x82, 0x93, 0x04, 0x84, 0xC0, 0x04, 0x85, 0x01,
+    0x8E, 0xAD, 0x0B, 0x83, 0x29, 0x8C, 0x12, 0xEA, 0xA7, 0x08, 0x96, 0x01, 0x82, 0xD7, 0x05, 0x86,
+    0xE2, 0x01, 0x82, 0x0E, 0x84, 0xF8, 0x0D, 0x88, 0xB8, 0x0A, 0x86, 0x89, 0x03, 0x86, 0xE3, 0x0A,
+    0x84, 0x1B, 0x00, 0x22, 0x00, 0x80, 0xD9, 0x07, 0x87, 0x90, 0x04, 0x8B, 0x98, 0x04, 0x84, 0xA7,
+    0x03, 0x86, 0xD2, 0x03, 0x82, 0x11, 0x01, 0x83, 0x08, 0xA4, 0x10, 0x83, 0xE4, 0x08, 0x89, 0x9A,
+    0x0C, 0x86, 0x06, 0x84, 0xE2, 0x0C, 0x85, 0x0E, 0x84, 0xD8, 0x0C, 0x81, 0x8C, 0x0C, 0x88, 0xB1,
+    0x0C, 0x8A, 0x47, 0x83, 0x59, 0x80, 0xE1, 0x04, 0x87, 0xB0, 0x03, 0x82, 0xD4, 0x03, 0x86, 0x98,
+    0x04, 0x8C, 0x01, 0x86, 0xEA, 0x03, 0x86, 0x45, 0x84, 0x0E, 0x83, 0xC7, 0x05, 0x82, 0xF6, 0x07,
+    0x82, 0x15, 0x00, 0x62, 0x08, 0x84, 0xC9, 0x0C, 0x88, 0x32, 0x87, 0xE6, 0x03, 0x83, 0xF5, 0x07,
+    0x01, 0x41, 0x08, 0x83, 0x10, 0x81, 0xA3, 0x04, 0x85, 0x81, 0x04, 0x84, 0xA3, 0x03, 0x84, 0x86,
+    0x02, 0x87, 0x86, 0x04, 0x82, 0x88, 0x04, 0x87, 0xA5, 0x04, 0x83, 0xB0, 0x02, 0x81, 0x52, 0x85,
+    0xCE, 0x02, 0x00, 0x01, 0x00, 0x80, 0xC4, 0x01, 0x83, 0x99, 0x0D, 0x87, 0x8C, 0x01, 0x86, 0xE5,
+    0x02, 0x83, 0x96, 0x0B, 0x94, 0x81, 0x03, 0x8B, 0x01, 0x80, 0x7F, 0x80, 0xD6, 0x04, 0xD0, 0xE7,
+    0x03, 0xA4, 0x01, 0x86, 0xBC, 0x09, 0x84, 0x93, 0x01, 0x89, 0x81, 0x02, 0x88, 0xC7, 0x0C, 0x87,
+    0xB5, 0x02, 0x86, 0xF6, 0x05, 0x87, 0xDA, 0x06, 0x84, 0xD9, 0x0A, 0x85, 0xD9, 0x07, 0x8F, 0x01,
+    0x82, 0x17, 0x83, 0xEF, 0x0C, 0x86, 0xC1, 0x07, 0x83, 0x8F, 0x08, 0x87, 0xE5, 0x0F, 0x84, 0xAA,
+    0x08, 0x84, 0x0B, 0x85, 0xAB, 0x08, 0x84, 0x14, 0x81, 0xC2, 0x0C, 0x85, 0x1D, 0x86, 0x8B, 0x04,
+    0x01, 0x42, 0x00, 0x62, 0x08, 0x82, 0xEC, 0x07, 0x84, 0x0F, 0x81, 0x08, 0x01, 0x42, 0x08, 0x63,
+    0x08, 0x83, 0x35, 0x83, 0x9A, 0x07, 0x82, 0x8A, 0x03, 0x80, 0x30, 0x82, 0x87, 0x01, 0x89, 0xAE,
+    0x09, 0x89, 0xB6, 0x01, 0x88, 0xFC, 0x0C, 0x85, 0xC0, 0x03, 0x80, 0x29, 0x87, 0x28, 0x80, 0x37,
+    0x8D, 0x2D, 0x86, 0x9D, 0x0A, 0x80, 0x8F, 0x03, 0x86, 0xA1, 0x06, 0x00, 0x62, 0x08, 0x81, 0x0B,
+    0x85, 0xE5, 0x07, 0x88, 0xAA, 0x0C, 0x83, 0xE4, 0x03, 0x86, 0xAD, 0x08, 0x83, 0x86, 0x01, 0x87,
+    0x97, 0x04, 0x85, 0x96, 0x08, 0x82, 0xD8, 0x02, 0x81, 0x1B, 0x84, 0xF8, 0x08, 0x88, 0x5D, 0x85,
+    0xD8, 0x02, 0x83, 0xEE, 0x02, 0xA1, 0x8A, 0x08, 0x83, 0x41, 0xCC, 0xEF, 0x03, 0xA8, 0x01, 0x82,
+    0xC8, 0x01, 0x81, 0x01, 0x86, 0xAC, 0x05, 0x8A, 0x98, 0x04, 0x86, 0x83, 0x04, 0x85, 0xB1, 0x02,
+    0x83, 0x05, 0x02, 0x22, 0x00, 0x62, 0x08, 0x42, 0x00, 0x84, 0xBC, 0x0A, 0x85, 0xF2, 0x01, 0x82,
+    0xB2, 0x08, 0x91, 0x8F, 0x03, 0x87, 0x01, 0x8A, 0xAF, 0x03, 0x83, 0x8D, 0x04, 0x84, 0x90, 0x08,
+    0x87, 0x0E, 0x88, 0x17, 0x84, 0xF5, 0x03, 0x83, 0xB0, 0x08, 0x8C, 0xD4, 0x03, 0x81, 0x09, 0x86,
+    0x12, 0x82, 0xED, 0x07, 0x80, 0x16, 0x85, 0x9B, 0x08, 0x80, 0x0A, 0x85, 0xA5, 0x03, 0x81, 0x9F,
+    0x0C, 0x85, 0xE1, 0x0C, 0x83, 0x84, 0x01, 0x8C, 0xCE, 0x05, 0x84, 0x1C, 0x83, 0x8D, 0x05, 0x84,
+    0xCF, 0x05, 0x82, 0xC5, 0x07, 0x81, 0x07, 0x83, 0x11, 0x87, 0xD7, 0x01, 0x85, 0xAA, 0x08, 0x87,
+    0x8C, 0x06, 0x85, 0x94, 0x0A, 0x82, 0x81, 0x04, 0x82, 0x07, 0x83, 0xE4, 0x07, 0x8B, 0x98, 0x04,
+    0x86, 0x39, 0x85, 0x84, 0x02, 0x83, 0x0C, 0x86, 0xA6, 0x0C, 0x85, 0xA3, 0x04, 0x81, 0x76, 0x81,
+    0x6C, 0x88, 0x53, 0x83, 0x54, 0x85, 0xBE, 0x04, 0x81, 0x06, 0x8A, 0x85, 0x03, 0x86, 0xFE, 0x02,
+    0x88, 0x87, 0x04, 0x82, 0xAD, 0x07, 0x82, 0xBE, 0x01, 0xB5, 0xD6, 0x03, 0x00, 0x20, 0x00, 0xB5,
+    0x38, 0x8A, 0x01, 0x96, 0xD5, 0x09, 0x87, 0xC1, 0x0A, 0x85, 0x07, 0x83, 0x01, 0x80, 0xF8, 0x0F,
+    0x84, 0x98, 0x04, 0x88, 0x8A, 0x06, 0x83, 0x9B, 0x0B, 0x85, 0x96, 0x04, 0x00, 0x41, 0x00, 0x91,
+    0x99, 0x04, 0x8B, 0xAA, 0x0B, 0x83, 0xB0, 0x08, 0x89, 0x98, 0x04, 0x8B, 0x1A, 0x84, 0xBE, 0x03,
+    0x85, 0xC3, 0x08, 0x90, 0x4A, 0x82, 0x62, 0x80, 0xEA, 0x02, 0x82, 0x6B, 0x86, 0x1D, 0x87, 0x89,
+    0x01, 0x84, 0x8C, 0x01, 0x82, 0x58, 0x88, 0x0E, 0x85, 0x32, 0x85, 0xC8, 0x01, 0x82, 0x1B, 0x84,
+    0x32, 0x81, 0xE8, 0x08, 0x84, 0x1C, 0x84, 0x1A, 0x84, 0x0B, 0x88, 0xE8, 0x03, 0x88, 0x14, 0x86,
+    0x81, 0x02, 0x83, 0x98, 0x04, 0x86, 0x97, 0x04, 0x8B, 0xBB, 0x04, 0x88, 0xBB, 0x0A, 0x8B, 0x80,
+    0x04, 0x88, 0xF1, 0x0A, 0x82, 0xE6, 0x0C, 0x84, 0xC0, 0x08, 0x81, 0xF3, 0x03, 0x86, 0x96, 0x01,
+    0x85, 0x20, 0x80, 0x09, 0x93, 0xF6, 0x02, 0x85, 0x09, 0x81, 0x8E, 0x0D, 0xF7, 0xAB, 0x08, 0x81,
+    0x87, 0x01, 0x88, 0x0A, 0x8C, 0xA6, 0x01, 0x89, 0x97, 0x06, 0x87, 0xA5, 0x06, 0x89, 0xF9, 0x01,
+    0x8B, 0x12, 0x80, 0x02, 0x01, 0x63, 0x08, 0x83, 0x08, 0x85, 0xAA, 0x03, 0x85, 0xAF, 0x0F, 0x87,
+    0xDF, 0x07, 0x86, 0xB4, 0x04, 0x9E, 0x01, 0x85, 0xB2, 0x02, 0x84, 0x98, 0x04, 0x8B, 0x93, 0x04,
+    0x8D, 0xF0, 0x08, 0x88, 0x32, 0x84, 0xCB, 0x03, 0x85, 0x3E, 0x86, 0x0B, 0x84, 0x98, 0x04, 0x89,
+    0xB4, 0x05, 0x87, 0xE7, 0x03, 0x84, 0x0C, 0x87, 0xB1, 0x04, 0x8D, 0x42, 0x85, 0x1D, 0x85, 0xF8,
+    0x01, 0x82, 0x8E, 0x02, 0x86, 0xE6, 0x01, 0x86, 0xC1, 0x0A, 0x83, 0x21, 0x82, 0x9E, 0x0C, 0x8A,
+    0x8B, 0x02, 0x85, 0x80, 0x02, 0x87, 0xC8, 0x04, 0x89, 0x0A, 0x85, 0x99, 0x08, 0x83, 0x10, 0x84,
+    0xE7, 0x02, 0x83, 0xD6, 0x04, 0x80, 0x01, 0x83, 0xAF, 0x09, 0x82, 0x1E, 0x80, 0x05, 0x99, 0x92,
+    0x03, 0x00, 0x01, 0x00, 0x80, 0xC0, 0x0D, 0xA9, 0xC7, 0x03, 0x94, 0x4B, 0xC4, 0x01, 0x81, 0xA0,
+    0x05, 0x8A, 0x5E, 0x82, 0xE3, 0x02, 0x83, 0x9F, 0x02, 0x80, 0x0B, 0x89, 0x99, 0x04, 0x8B, 0xA3,
+    0x04, 0x89, 0xA1, 0x02, 0x84, 0xFC, 0x03, 0x86, 0xC6, 0x06, 0x89, 0xAE, 0x03, 0x89, 0xFA, 0x02,
+    0x8C, 0xD8, 0x03, 0x8C, 0xFE, 0x03, 0x98, 0x01, 0x83, 0xAB, 0x04, 0x8A, 0x3D, 0x81, 0x82, 0x0C,
+    0x01, 0x62, 0x08, 0x63, 0x08, 0x82, 0x9F, 0x07, 0x87, 0xE5, 0x03, 0x8D, 0xB6, 0x0C, 0x89, 0xB7,
+    0x03, 0x84, 0xD1, 0x08, 0x88, 0x8E, 0x01, 0x85, 0x22, 0x87, 0x37, 0x87, 0xC9, 0x03, 0x84, 0xC6,
+    0x03, 0x81, 0xF7, 0x01, 0x84, 0x85, 0x04, 0x82, 0xEA, 0x02, 0x81, 0x01, 0x86, 0xA6, 0x08, 0x84,
+    0x18, 0x8A, 0x94, 0x04, 0x85, 0x46, 0x88, 0x9E, 0x04, 0x82, 0xD5, 0x04, 0x83, 0xF3, 0x03, 0x85,
+    0x2E, 0x81, 0x91, 0x02, 0x8A, 0xA2, 0x02, 0x83, 0xE0, 0x02, 0x84, 0x45, 0x01, 0x62, 0x08, 0x83,
+    0x10, 0x85, 0xB0, 0x09, 0x86, 0xEA, 0x02, 0xC1, 0x97, 0x08, 0x88, 0x4D, 0xCB, 0x01, 0x83, 0x97,
+    0x02, 0x82, 0x08, 0x89, 0x13, 0x02, 0x42, 0x00, 0x83, 0x10, 0x62, 0x08, 0x83, 0xBF, 0x0A, 0x81,
+    0x0B, 0x97, 0x90, 0x04, 0x88, 0xAB, 0x02, 0x84, 0x9D, 0x03, 0x86, 0x87, 0x04, 0x80, 0x04, 0x00,
+    0x41, 0x00, 0x82, 0xD1, 0x0C, 0x8C, 0x99, 0x04, 0x86, 0xA1, 0x03, 0x80, 0xE9, 0x03, 0x85, 0xDE,
+    0x03, 0x88, 0xE9, 0x03, 0x82, 0x15, 0x81, 0x0F, 0x81, 0x1A, 0x86, 0x9A, 0x0D, 0x86, 0x37, 0x8C,
+    0xF3, 0x03, 0x81, 0x04, 0x82, 0xFB, 0x02, 0x00, 0x42, 0x00, 0x80, 0x9F, 0x09, 0x81, 0x9C, 0x01,
+    0x84, 0xD6, 0x03, 0x8A, 0xA6, 0x03, 0x86, 0x98, 0x04, 0x8A, 0x91, 0x04, 0x89, 0x90, 0x08, 0x84,
+    0x2F, 0x85, 0x91, 0x04, 0x88, 0x40, 0x83, 0x6E, 0x83, 0xFB, 0x01, 0x85, 0x98, 0x04, 0x85, 0x99,
+    0x04, 0x00, 0x42, 0x08, 0x84, 0x80, 0x02, 0x85, 0xE8, 0x03, 0x85, 0xBE, 0x04, 0x84, 0x2E, 0x80,
+    0x01, 0x82, 0x1D, 0x87, 0xDC, 0x01, 0x83, 0xAE, 0x0C, 0x81, 0x0C, 0x02, 0x41, 0x00, 0xA4, 0x18,
+    0xA4, 0x18, 0x82, 0xFE, 0x0B, 0x83, 0xB3, 0x02, 0x84, 0x73, 0x82, 0x53, 0x87, 0xBA, 0x04, 0x83,
+    0x4D, 0x81, 0x98, 0x04, 0x84, 0xD4, 0x0A, 0x80, 0x90, 0x08, 0x82, 0x23, 0x8D, 0xF6, 0x02, 0xFF,
+    0x07, 0x00, 0x01, 0x86, 0xE8, 0x04, 0x85, 0x8C, 0x02, 0x8B, 0x1B, 0x00, 0x63, 0x08, 0x81, 0xA6,
+    0x03, 0x87, 0x93, 0x04, 0x87, 0xB4, 0x02, 0x95, 0x99, 0x04, 0x85, 0x9E, 0x02, 0x86, 0x84, 0x02,
+    0x87, 0xC5, 0x0B, 0x84, 0x21, 0x85, 0x9F, 0x03, 0x84, 0xD2, 0x0C, 0x01, 0x63, 0x08, 0x63, 0x08,
+    0x84, 0x99, 0x03, 0x82, 0x8E, 0x04, 0x85, 0xCE, 0x04, 0x82, 0xF0, 0x03, 0x80, 0x1D, 0x82, 0x1F,
+    0x83, 0xF9, 0x02, 0x87, 0x54, 0x8B, 0x9D, 0x04, 0x84, 0xEA, 0x03, 0x00, 0x63, 0x08, 0x80, 0x91,
+    0x03, 0x85, 0x5C, 0x85, 0xEE, 0x02, 0x87, 0x89, 0x01, 0x8B, 0x98, 0x04, 0x83, 0x01, 0x01, 0x22,
+    0x00, 0x42, 0x08, 0x81, 0xEB, 0x08, 0x87, 0x1F, 0x86, 0x9A, 0x08, 0x85, 0x52, 0x84, 0xCD, 0x04,
+    0x84, 0x2D, 0x83, 0xDB, 0x01, 0x81, 0x05, 0x82, 0x91, 0x02, 0x83, 0xAC, 0x03, 0x82, 0x1E, 0x00,
+    0x41, 0x08, 0x82, 0x98, 0x04, 0x85, 0x9E, 0x02, 0x82, 0x41, 0x80, 0xC9, 0x03, 0x89, 0x6F, 0x81,
+    0x9F, 0x05, 0x85, 0xD6, 0x04, 0x83, 0x47, 0x85, 0x0F, 0x01, 0x63, 0x10, 0x83, 0x10, 0x86, 0xFB,
+    0x08, 0x86, 0x90, 0x0D, 0x84, 0x3F, 0x84, 0x7D, 0x84, 0xC6, 0x02, 0x89, 0xA7, 0x05, 0x86, 0x0B,
+    0xAF, 0xAF, 0x03, 0xDF, 0x01, 0x00, 0x20, 0x00, 0x98, 0x1B, 0x81, 0xB6, 0x01, 0x82, 0x06, 0x88,
+    0xE0, 0x01, 0x8C, 0x90, 0x04, 0x84, 0x10, 0x88, 0x89, 0x07, 0x86, 0x98, 0x04, 0x88, 0xA6, 0x03,
+    0x83, 0xFD, 0x07, 0x86, 0xBC, 0x02, 0x84, 0xBE, 0x02, 0x00, 0x62, 0x08, 0x82, 0x94, 0x0C, 0x80,
+    0x82, 0x04, 0x85, 0xF0, 0x03, 0x00, 0x42, 0x00, 0x81, 0x0A, 0x8B, 0xA2, 0x02, 0x84, 0xFD, 0x03,
+    0x88, 0x44, 0x8C, 0x1B, 0x89, 0xD5, 0x03, 0x87, 0xD1, 0x03, 0x89, 0x01, 0x89, 0xF0, 0x02, 0x86,
+    0x01, 0x02, 0x22, 0x00, 0x83, 0x08, 0x42, 0x08, 0x8C, 0xB5, 0x01, 0x84, 0xB6, 0x04, 0x81, 0xB0,
+    0x04, 0x85, 0xC4, 0x01, 0x86, 0xBA, 0x01, 0x82, 0xCD, 0x01, 0x83, 0xE3, 0x01, 0x88, 0xB9, 0x0E,
+    0x88, 0xB2, 0x03, 0x86, 0x3C, 0x00, 0x42, 0x08, 0x82, 0xF2, 0x0F, 0x8A, 0x6D, 0x8C, 0xFE, 0x01,
+    0x83, 0x4F, 0x89, 0xCA, 0x06, 0x83, 0x0C, 0x85, 0xCB, 0x02, 0x81, 0x21, 0x83, 0xE1, 0x08, 0x82,
+    0x59, 0x87, 0x92, 0x0D, 0x86, 0x7E, 0x81, 0x01, 0x85, 0x26, 0x9E, 0xAE, 0x03, 0x86, 0x2A, 0xFF,
+    0x05, 0x00, 0x01, 0x86, 0xB0, 0x01, 0x8A, 0xF5, 0x02, 0x87, 0x86, 0x07, 0x8E, 0xF4, 0x02, 0x89,
+    0xAA, 0x02, 0x88, 0xF3, 0x03, 0x85, 0x28, 0x81, 0x0A, 0x82, 0xC4, 0x0C, 0x87, 0x21, 0x00, 0x42,
+    0x08, 0x80, 0xFC, 0x07, 0x81, 0xB1, 0x08, 0x87, 0x4A, 0x8A, 0x98, 0x04, 0x88, 0xE2, 0x03, 0x87,
+    0xB0, 0x04, 0x96, 0x93, 0x04, 0x8A, 0xB1, 0x08, 0x8A, 0x90, 0x01, 0x87, 0x94, 0x01, 0x8A, 0x10,
+    0x84, 0x14, 0x80, 0x98, 0x04, 0x88, 0x19, 0x84, 0xE0, 0x01, 0x83, 0xA7, 0x03, 0x84, 0x88, 0x04,
+    0x87, 0xEE, 0x01, 0x86, 0x0C, 0x89, 0x9F, 0x01, 0x89, 0x0D, 0x8C, 0x5F, 0x88, 0x9B, 0x0A, 0x83,
+    0x4E, 0x85, 0x28, 0x83, 0x0D, 0x82, 0x42, 0x82, 0xB4, 0x06, 0x82, 0xBE, 0x0C, 0x87, 0xD3, 0x02,
+    0x83, 0x60, 0x83, 0x1D, 0x85, 0xDB, 0x01, 0x85, 0x2A, 0x9C, 0x01, 0xFF, 0x0C, 0x00, 0x97, 0x04,
+    0x87, 0x01, 0x80, 0x99, 0x0E, 0x82, 0x93, 0x0E, 0x83, 0x96, 0x06, 0x8E, 0x99, 0x07, 0x89, 0x89,
+    0x03, 0x8B, 0xC2, 0x06, 0x8D, 0xBD, 0x02, 0x83, 0x84, 0x02, 0x84, 0x09, 0x82, 0xAF, 0x08, 0x01,
+    0x62, 0x08, 0xA4, 0x10, 0x80, 0xD0, 0x07, 0x87, 0xBE, 0x04, 0x97, 0x3F, 0x83, 0xF7, 0x08, 0x89,
+    0x9C, 0x07, 0x8C, 0xE6, 0x03, 0x8A, 0xFB, 0x03, 0x86, 0xB1, 0x04, 0x96, 0x9D, 0x01, 0x8A, 0x3A,
+    0x86, 0x8B, 0x01, 0x80, 0xD7, 0x01, 0x83, 0xDD, 0x0B, 0x81, 0x09, 0x82, 0x16, 0x92, 0xEB, 0x0F,
+    0x82, 0x1B, 0x81, 0xDB, 0x09, 0x86, 0xD7, 0x07, 0x85, 0x78, 0x90, 0xB0, 0x09, 0x87, 0xC5, 0x01,
+    0x85, 0x37, 0x83, 0x3A, 0x83, 0x07, 0x81, 0x40, 0x85, 0x80, 0x09, 0x82, 0x86, 0x04, 0x84, 0x18,
+    0x86, 0x5D, 0x85, 0x62, 0x89, 0xB7, 0x08, 0xFF, 0x31, 0x00, 0x01, 0x00, 0x41, 0x00, 0x83, 0x98,
+    0x04, 0x83, 0xFB, 0x01, 0x84, 0xD2, 0x02, 0x99, 0x80, 0x03, 0x8B, 0xB9, 0x08, 0x89, 0x14, 0x86,
+    0xE9, 0x06, 0x80, 0xC0, 0x06, 0x03, 0x83, 0x08, 0x62, 0x08, 0x83, 0x08, 0x83, 0x10, 0x81, 0x98,
+    0x04, 0x8B, 0xAD, 0x03, 0x87, 0xDC, 0x02, 0x8B, 0xF4, 0x02, 0x85, 0xAB, 0x08, 0x92, 0xDF, 0x03,
+    0x8C, 0x6C, 0x84, 0x38, 0x8A, 0x2E, 0x81, 0xA5, 0x01, 0x97, 0x34, 0x83, 0x8A, 0x03, 0x86, 0x6C,
+    0x81, 0x29, 0x84, 0xD5, 0x01, 0x81, 0x01, 0x89, 0x9D, 0x04, 0x85, 0xC1, 0x08, 0x00, 0x42, 0x00,
+    0x80, 0xC2, 0x05, 0x83, 0x38, 0x82, 0x0E, 0x87, 0xC2, 0x09, 0x8A, 0x4F, 0x8A, 0x01, 0x8B, 0x3D,
+    0x83, 0x32, 0x82, 0x09, 0x83, 0xD1, 0x06, 0x8B, 0x5C, 0x8C, 0x01, 0x8A, 0xD2, 0x0C, 0x93, 0x20,
+    0xAB, 0xAB, 0x03, 0xEE, 0x01, 0x87, 0x8A, 0x02, 0x82, 0x0C, 0x83, 0xBD, 0x08, 0x85, 0xDA, 0x0A,
+    0x81, 0xD6, 0x07, 0x8B, 0x9C, 0x02, 0x91, 0xC6, 0x03, 0x8C, 0xBA, 0x08, 0x80, 0xFE, 0x08, 0x00,
+    0x42, 0x08, 0x81, 0x01, 0x88, 0xC8, 0x0C, 0x8E, 0x1F, 0x89, 0xF4, 0x02, 0x93, 0x95, 0x04, 0x88,
+    0x99, 0x08, 0x8F, 0xD5, 0x0C, 0x89, 0x10, 0x84, 0x89, 0x08, 0x85, 0xB2, 0x01, 0x8E, 0x30, 0x84,
+    0xFD, 0x09, 0x80, 0x18, 0x83, 0xC5, 0x07, 0x84, 0xDE, 0x01, 0x89, 0x08, 0x86, 0xC4, 0x0C, 0x82,
+    0x07, 0x02, 0x21, 0x00, 0x83, 0x08, 0x63, 0x08, 0x84, 0x98, 0x04, 0x82, 0xFC, 0x07, 0x8A, 0x87,
+    0x05, 0x86, 0x4F, 0x82, 0x88, 0x0C, 0x84, 0x6F, 0x86, 0x44, 0x83, 0x9A, 0x02, 0x84, 0x09, 0x83,
+    0x80, 0x05, 0x86, 0x64, 0x8D, 0xCF, 0x02, 0x8A, 0x0E, 0x85, 0xF0, 0x04, 0x95, 0xF9, 0x02, 0xAE,
+    0xAB, 0x03, 0xE4, 0x01, 0x89, 0x86, 0x06, 0x87, 0xEB, 0x02, 0x87, 0xD6, 0x0C, 0x81, 0x04, 0x80,
+    0x98, 0x04, 0x83, 0xA4, 0x0E, 0x83, 0xFF, 0x02, 0x86, 0x27, 0x84, 0xCC, 0x01, 0x83, 0x16, 0x83,
+    0x29, 0x8D, 0xF7, 0x03, 0x8B, 0xD9, 0x07, 0x8C, 0xF4, 0x03, 0x8A, 0xE5, 0x08, 0x92, 0x21, 0x8B,
+    0x49, 0x89, 0xC9, 0x0C, 0x8E, 0x9D, 0x05, 0x82, 0x8D, 0x01, 0x87, 0x20, 0x83, 0x87, 0x01, 0x8C,
+    0x3E, 0x85, 0xA4, 0x01, 0x8D, 0xF5, 0x02, 0x88, 0xC4, 0x03, 0x85, 0x37, 0x85, 0xEB, 0x01, 0x84,
+    0xDB, 0x01, 0x87, 0xF2, 0x08, 0x85, 0x1B, 0x89, 0xA6, 0x01, 0x85, 0x9E, 0x02, 0x88, 0x48, 0x82,
+    0x24, 0x82, 0x08, 0x81, 0x05, 0x00, 0x41, 0x08, 0x80, 0xED, 0x0A, 0x8D, 0x67, 0x86, 0x6A, 0x8B,
+    0xE1, 0x08, 0x00, 0x20, 0x00, 0x94, 0xB5, 0x08, 0x01, 0x21, 0x00, 0x41, 0x00, 0xFF, 0x21, 0x00,
+    0xE5, 0x0C, 0x88, 0x90, 0x02, 0x88, 0x98, 0x04, 0x80, 0x01, 0x00, 0x42, 0x00, 0x85, 0xB2, 0x08,
+    0x83, 0x20, 0x82, 0x05, 0x85, 0xA9, 0x02, 0x83, 0x0C, 0x87, 0x83, 0x03, 0x8E, 0xD8, 0x03, 0x8A,
+    0xD7, 0x0B, 0x89, 0x15, 0x80, 0x01, 0x80, 0x88, 0x02, 0x93, 0xEB, 0x03, 0x97, 0x01, 0x90, 0xD7,
+    0x0B, 0x82, 0x79, 0x82, 0x03, 0x87, 0x8F, 0x01, 0x84, 0xB9, 0x01, 0x89, 0xCC, 0x03, 0x84, 0x75,
+    0x82, 0xA2, 0x01, 0x85, 0xCA, 0x0C, 0x84, 0x0D, 0x8B, 0xDB, 0x03, 0x86, 0x48, 0x8C, 0xB5, 0x0E,
+    0x84, 0xAE, 0x01, 0x85, 0xCF, 0x01, 0x87, 0xEC, 0x01, 0x8F, 0x86, 0x0D, 0x8A, 0xFD, 0x07, 0x00,
+    0x21, 0x00, 0x82, 0x98, 0x04, 0x8F, 0x8D, 0x08, 0x83, 0xDB, 0x0E, 0x87, 0x15, 0x85, 0x09, 0x92,
+    0xD1, 0x0C, 0x95, 0xC7, 0x08, 0xD1, 0x01, 0x98, 0xCC, 0x0D, 0x97, 0x1A, 0x85, 0xA6, 0x02, 0x86,
+    0xB3, 0x0A, 0x81, 0x0B, 0x88, 0x84, 0x07, 0x88, 0xF6, 0x0E, 0x84, 0xC3, 0x01, 0x85, 0x9B, 0x03,
+    0x85, 0x39, 0x85, 0xC8, 0x02, 0x84, 0xC3, 0x02, 0x00, 0x42, 0x08, 0x84, 0xAD, 0x0F, 0x8C, 0xF2,
+    0x03, 0x8C, 0x81, 0x04, 0x8B, 0xD4, 0x0C, 0x8C, 0x82, 0x04, 0x98, 0x01, 0x85, 0xFE, 0x03, 0x87,
+    0x7C, 0x86, 0xB9, 0x09, 0x89, 0x87, 0x01, 0x87, 0x9B, 0x01, 0x81, 0x01, 0x01, 0x42, 0x00, 0x42,
+    0x08, 0x85, 0x98, 0x05, 0x81, 0xF2, 0x01, 0x80, 0x04, 0x85, 0xFA, 0x08, 0x83, 0xF4, 0x0B, 0x83,
+    0x25, 0x84, 0x8E, 0x04, 0x85, 0x57, 0x82, 0x3C, 0x83, 0x0E, 0x85, 0xA3, 0x09, 0x00, 0x62, 0x08,
+    0x81, 0x26, 0x87, 0x77, 0x83, 0x28, 0x84, 0xD4, 0x0E, 0x8B, 0x6F, 0x8D, 0xBD, 0x02, 0x81, 0x6D,
+    0x01, 0x42, 0x08, 0x21, 0x08, 0x84, 0x57, 0x89, 0xEC, 0x02, 0x81, 0x85, 0x01, 0x84, 0xF0, 0x02,
+    0x86, 0xA4, 0x05, 0x86, 0xB1, 0x02, 0x96, 0xD2, 0x0C, 0x8F, 0x01, 0x98, 0xC9, 0x03, 0xB3, 0x01,
+    0x80, 0xB2, 0x09, 0x97, 0x69, 0x9D, 0x3A, 0x8A, 0xD6, 0x06, 0x88, 0xCA, 0x03, 0x84, 0xC3, 0x03,
+    0x81, 0xD2, 0x01, 0x81, 0xEA, 0x01, 0x84, 0x18, 0x8A, 0x33, 0x86, 0x82, 0x06, 0x82, 0xE7, 0x02,
+    0x01, 0x63, 0x08, 0x26, 0x19, 0x85, 0xD6, 0x02, 0x8B, 0xF3, 0x03, 0x96, 0x80, 0x04, 0x90, 0xED,
+    0x0C, 0x84, 0x82, 0x01, 0x87, 0xFA, 0x07, 0x87, 0x84, 0x01, 0x84, 0x94, 0x03, 0x83, 0x68, 0x8D,
+    0xD3, 0x02, 0x86, 0xB9, 0x09, 0x86, 0xEC, 0x02, 0x82, 0x2C, 0x02, 0x22, 0x00, 0x63, 0x08, 0x83,
+    0x08, 0x80, 0xAA, 0x01, 0x87, 0xC5, 0x01, 0x83, 0xB7, 0x03, 0x83, 0xAA, 0x09, 0x8A, 0xE7, 0x02,
+    0x84, 0xCF, 0x01, 0x82, 0x39, 0x85, 0x74, 0x85, 0xFD, 0x05, 0x84, 0xE7, 0x07, 0x87, 0x96, 0x04,
+    0x83, 0xB5, 0x02, 0x83, 0xF5, 0x01, 0x9A, 0xC8, 0x02, 0x81, 0xCB, 0x01, 0x80, 0xB4, 0x08, 0x8E,
+    0xCB, 0x02, 0x81, 0x5F, 0x02, 0x41, 0x08, 0x62, 0x08, 0x41, 0x08, 0x83, 0xB8, 0x01, 0x84, 0x1C,
+    0x87, 0xA3, 0x01, 0x8E, 0xB6, 0x08, 0xFF, 0x21, 0x00, 0xC9, 0x0C, 0x86, 0xB7, 0x0E, 0x86, 0xA3,
+    0x0B, 0x8B, 0x90, 0x02, 0x84, 0x82, 0x04, 0x8D, 0x96, 0x04, 0x83, 0x16, 0x87, 0xE7, 0x0A, 0x83,
+    0x0B, 0x86, 0xCD, 0x04, 0x86, 0xD9, 0x03, 0x89, 0xC7, 0x0C, 0x80, 0x01, 0x82, 0xB1, 0x03, 0x8A,
+    0x9B, 0x04, 0x8B, 0x94, 0x04, 0x88, 0xB2, 0x0B, 0x87, 0x12, 0x85, 0x89, 0x01, 0x83, 0x2C, 0x83,
+    0x1E, 0x94, 0x98, 0x04, 0x86, 0xE4, 0x09, 0x81, 0x83, 0x01, 0x81, 0x64, 0x01, 0xA4, 0x10, 0xA4,
+    0x10, 0x83, 0x67, 0x86, 0x18, 0x86, 0xBE, 0x01, 0x88, 0xEA, 0x08, 0x84, 0xAD, 0x01, 0x80, 0x9B,
+    0x08, 0x88, 0xBA, 0x07, 0x81, 0x1F, 0x01, 0x42, 0x00, 0x63, 0x08, 0x82, 0xE7, 0x08, 0x86, 0xA9,
+    0x01, 0x87, 0x2B, 0x85, 0xA5, 0x01, 0x8C, 0x79, 0x8C, 0xA1, 0x0C, 0x83, 0xF5, 0x0E, 0x90, 0xCC,
+    0x02, 0x81, 0x62, 0x00, 0x41, 0x08, 0x8B, 0x11, 0x8B, 0x8D, 0x04, 0x88, 0x0E, 0xFF, 0x25, 0x00,
+    0x98, 0x04, 0x85, 0xEB, 0x03, 0x91, 0xEB, 0x09, 0x85, 0xFD, 0x06, 0x85, 0xD4, 0x07, 0x84, 0x13,
+    0x83, 0x05, 0x84, 0xE3, 0x01, 0x87, 0xE0, 0x03, 0x88, 0x0C, 0x87, 0xFD, 0x03, 0x87, 0xA1, 0x04,
+    0x80, 0xFC, 0x02, 0x86, 0xE6, 0x03, 0x84, 0x82, 0x03, 0x85, 0xBE, 0x0B, 0x8B, 0x8A, 0x03, 0x8A,
+    0x4B, 0x83, 0xF2, 0x02, 0x82, 0x61, 0x86, 0x9A, 0x03, 0x8C, 0x9F, 0x03, 0x85, 0x93, 0x01, 0x85,
+    0x2D, 0x85, 0xFB, 0x03, 0x80, 0x8F, 0x03, 0x01, 0x62, 0x08, 0x42, 0x00, 0x82, 0x61, 0x86, 0xDF,
+    0x04, 0x8A, 0xAC, 0x01, 0x89, 0x01, 0x80, 0xCE, 0x07, 0x89, 0x9C, 0x03, 0x82, 0x8B, 0x01, 0x00,
+    0x42, 0x08, 0x85, 0x98, 0x04, 0x88, 0xC7, 0x01, 0x87, 0xF7, 0x01, 0x87, 0xED, 0x07, 0x8A, 0xAC,
+    0x02, 0x85, 0x3D, 0x83, 0x6B, 0x8D, 0xAA, 0x02, 0x8D, 0x23, 0x97, 0x01, 0x9F, 0xD1, 0x0C, 0x98,
+    0xFC, 0x0B, 0x84, 0x01,
+};
@@ -0,0 +1,58 @@
+#include "sta_reconnect.h"
+
+#include <string.h>
+
+uint32_t sta_ssid_hash(const char *ssid) {
+  uint32_t hash = 2166136261u;
+  for (const char *p = ssid; p && *p; ++p) {
+    hash ^= (uint8_t)*p;
+    hash *= 16777619u;
+  }
+  return hash ? hash : 1u;
+}
+
+bool sta_link_cache_matches(const StaLinkCache &cache, const char *ssid) {
+  if (!ssid || ssid[0] == '\0') return false;
+  if (cache.ssid_hash == 0 || cache.ssid_hash != sta_ssid_hash(ssid)) return false;
+  if (cache.channel < 1 || cache.channel > 14) return false;
+  for (int i = 0; i < 6; ++i) {
+    if (cache.bssid[i] != 0) return true;
+  }
+  return false;
+}
+
+void sta_link_cache_clear(StaLinkCache *cache) {
+  if (!cache) return;
+  memset(cache, 0, sizeof(*cache));
+}
+
+uint32_t sta_backoff_delay_ms(uint8_t failures) {
+  if (failures == 0) return 0;
+  uint32_t delay = STA_BACKOFF_BASE_MS;
+  for (uint8_t i = 1; i < failures && delay < STA_BACKOFF_MAX_MS; ++i) {
+    delay *= 2;
+  }
+  return (delay < STA_BACKOFF_MAX_MS) ? delay : STA_BACKOFF_MAX_MS;
+}
+
+void sta_connect_stats_attempt(StaConnectStats *stats) {
+  if (stats) stats->attempts++;
+}
+
+void sta_connect_stats_success(StaConnectStats *stats, bool fast, uint32_t connect_ms) {
+  if (!stats) return;
+  if (stats->connects == 0 || connect_ms < stats->min_ms) stats->min_ms = connect_ms;
+  if (connect_ms > stats->max_ms) stats->max_ms = connect_ms;
+  stats->connects++;
+  if (fast) stats->fast_connects++;
+  stats->last_ms = connect_ms;
+  stats->total_ms += connect_ms;
+}
+
+void sta_connect_stats_fast_miss(StaConnectStats *stats) {
+  if (stats) stats->fast_misses++;
+}
+
+uint32_t sta_connect_stats_mean_ms(const StaConnectStats &stats) {
+  return stats.connects ? (uint32_t)(stats.total_ms / stats.connects) : 0;
+}
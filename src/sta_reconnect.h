@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+
+// Station (re)connect policy: the cached link used for a directed fast
+// connect, exponential retry back-off and connect-time statistics. No
+// Arduino dependencies; the network manager owns the radio calls.
+
+constexpr uint32_t STA_BACKOFF_BASE_MS = 2000UL;
+constexpr uint32_t STA_BACKOFF_MAX_MS = 60000UL;
+
+// Last good association, persisted so a reboot or a dropout can skip the
+// scan (BSSID + channel). The address always comes from DHCP: without a
+// clock across reboots a cached lease cannot be checked for expiry.
+struct StaLinkCache {
+  uint32_t ssid_hash;  // which network this belongs to; 0 = empty
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint8_t reserved;
+};
+
+uint32_t sta_ssid_hash(const char *ssid);
+
+// True when the cache holds a usable BSSID/channel for this SSID.
+bool sta_link_cache_matches(const StaLinkCache &cache, const char *ssid);
+
+void sta_link_cache_clear(StaLinkCache *cache);
+
+// Wait before the next attempt after `failures` consecutive failed attempts:
+// 0 right after a link drop, then base, 2x base, ... capped at the max.
+uint32_t sta_backoff_delay_ms(uint8_t failures);
+
+struct StaConnectStats {
+  uint32_t attempts;
+  uint32_t connects;
+  uint32_t fast_connects;  // directed attempts that succeeded
+  uint32_t fast_misses;    // directed attempts that fell back to a scan
+  uint32_t last_ms;
+  uint32_t min_ms;
+  uint32_t max_ms;
+  uint64_t total_ms;
+};
+
+void sta_connect_stats_attempt(StaConnectStats *stats);
+void sta_connect_stats_success(StaConnectStats *stats, bool fast, uint32_t connect_ms);
+void sta_connect_stats_fast_miss(StaConnectStats *stats);
+uint32_t sta_connect_stats_mean_ms(const StaConnectStats &stats);
@@ -0,0 +1,194 @@
+#include "telemetry_frame.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr size_t kCrcOffset = TELEMETRY_PAYLOAD_BYTES - 2;
+
+void put_u16(uint8_t *p, uint16_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+void put_u32(uint8_t *p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+uint16_t get_u16(const uint8_t *p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+uint32_t get_u32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint8_t *put_floats(uint8_t *p, const float *v, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    uint32_t bits;
+    memcpy(&bits, &v[i], sizeof(bits));
+    put_u32(p, bits);
+    p += 4;
+  }
+  return p;
+}
+
+const uint8_t *get_floats(const uint8_t *p, float *v, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    const uint32_t bits = get_u32(p);
+    memcpy(&v[i], &bits, sizeof(bits));
+    p += 4;
+  }
+  return p;
+}
+
+}  // namespace
+
+uint16_t telemetry_crc16(const uint8_t *data, size_t len) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < len; ++i) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+void telemetry_pack(const TelemetrySample &s, uint8_t *out) {
+  if (!out) return;
+  out[0] = TELEMETRY_RECORD_SAMPLE;
+  out[1] = TELEMETRY_RECORD_VERSION;
+  out[2] = s.flags;
+  out[3] = 0;
+  put_u32(out + 4, s.seq);
+  put_u32(out + 8, s.t_us);
+  uint8_t *p = out + 12;
+  p = put_floats(p, s.sens_accel, 3);
+  p = put_floats(p, s.sens_gyro, 3);
+  p = put_floats(p, s.map_accel, 3);
+  p = put_floats(p, s.map_gyro, 2);
+  p = put_floats(p, s.corr_accel, 3);
+  p = put_floats(p, s.corr_gyro, 2);
+  const float angles[4] = {s.roll_phys, s.pitch_phys, s.roll, s.pitch};
+  put_floats(p, angles, 4);
+  put_u16(out + kCrcOffset, telemetry_crc16(out, kCrcOffset));
+}
+
+bool telemetry_unpack(const uint8_t *payload, size_t len, TelemetrySample *out) {
+  if (!payload || len != TELEMETRY_PAYLOAD_BYTES) return false;
+  if (payload[0] != TELEMETRY_RECORD_SAMPLE || payload[1] != TELEMETRY_RECORD_VERSION) return false;
+  if (get_u16(payload + kCrcOffset) != telemetry_crc16(payload, kCrcOffset)) return false;
+  if (!out) return true;
+
+  out->flags = payload[2];
+  out->seq = get_u32(payload + 4);
+  out->t_us = get_u32(payload + 8);
+  const uint8_t *p = payload + 12;
+  p = get_floats(p, out->sens_accel, 3);
+  p = get_floats(p, out->sens_gyro, 3);
+  p = get_floats(p, out->map_accel, 3);
+  p = get_floats(p, out->map_gyro, 2);
+  p = get_floats(p, out->corr_accel, 3);
+  p = get_floats(p, out->corr_gyro, 2);
+  float angles[4];
+  get_floats(p, angles, 4);
+  out->roll_phys = angles[0];
+  out->pitch_phys = angles[1];
+  out->roll = angles[2];
+  out->pitch = angles[3];
+  return true;
+}
+
+size_t cobs_encode(const uint8_t *in, size_t len, uint8_t *out, size_t cap) {
+  if (!out || (len && !in)) return 0;
+  size_t code_pos = 0;
+  size_t o = 1;
+  uint8_t code = 1;
+  if (cap < 1) return 0;
+  for (size_t i = 0; i < len; ++i) {
+    if (in[i] == 0) {
+      out[code_pos] = code;
+      code_pos = o++;
+      code = 1;
+      if (code_pos >= cap) return 0;
+      continue;
+    }
+    if (o >= cap) return 0;
+    out[o++] = in[i];
+    if (++code == 0xFF) {
+      out[code_pos] = code;
+      code_pos = o++;
+      code = 1;
+      if (code_pos >= cap) return 0;
+    }
+  }
+  out[code_pos] = code;
+  return o;
+}
+
+size_t cobs_decode(const uint8_t *in, size_t len, uint8_t *out, size_t cap) {
+  if (!in || !out || len == 0) return 0;
+  size_t i = 0;
+  size_t o = 0;
+  while (i < len) {
+    const uint8_t code = in[i++];
+    if (code == 0) return 0;
+    for (uint8_t k = 1; k < code; ++k) {
+      if (i >= len || in[i] == 0 || o >= cap) return 0;
+      out[o++] = in[i++];
+    }
+    if (code != 0xFF && i < len) {
+      if (o >= cap) return 0;
+      out[o++] = 0;
+    }
+  }
+  return o;
+}
+
+size_t telemetry_frame_encode(const TelemetrySample &sample, uint8_t *out, size_t cap) {
+  if (!out || cap < 3) return 0;
+  uint8_t payload[TELEMETRY_PAYLOAD_BYTES];
+  telemetry_pack(sample, payload);
+  out[0] = 0;
+  const size_t n = cobs_encode(payload, sizeof(payload), out + 1, cap - 2);
+  if (n == 0) return 0;
+  out[1 + n] = 0;
+  return n + 2;
+}
+
+void telemetry_decoder_reset(TelemetryStreamDecoder *dec) {
+  if (!dec) return;
+  memset(dec, 0, sizeof(*dec));
+}
+
+bool telemetry_decoder_feed(TelemetryStreamDecoder *dec, uint8_t byte, TelemetrySample *out) {
+  if (!dec) return false;
+  if (byte != 0) {
+    if (dec->len < sizeof(dec->buf)) {
+      dec->buf[dec->len++] = byte;
+    } else {
+      dec->overflow = true;
+    }
+    return false;
+  }
+
+  // Delimiter: decode whatever accumulated since the previous one.
+  const size_t len = dec->len;
+  const bool overflow = dec->overflow;
+  dec->len = 0;
+  dec->overflow = false;
+  if (len == 0 && !overflow) return false;
+
+  uint8_t payload[TELEMETRY_PAYLOAD_BYTES + 1];
+  const size_t n = overflow ? 0 : cobs_decode(dec->buf, len, payload, sizeof(payload));
+  if (n != TELEMETRY_PAYLOAD_BYTES || !telemetry_unpack(payload, n, out)) {
+    dec->frames_bad++;
+    return false;
+  }
+  dec->frames_ok++;
+  return true;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary serial telemetry: one record per fused sample, packed little-endian,
+// CRC-16/CCITT-FALSE appended, COBS-encoded and delimited by 0x00 on both
+// sides. The leading delimiter keeps a frame intact when log text was
+// written just before it; the text then decodes as one bad frame and is
+// dropped. scripts/telemetry_decode.py is the host-side reader.
+//
+// Payload layout (offsets in bytes, all multi-byte fields little-endian):
+//    0 u8  type (TELEMETRY_RECORD_SAMPLE)
+//    1 u8  version (TELEMETRY_RECORD_VERSION)
+//    2 u8  flags (TELEMETRY_FLAG_*)
+//    3 u8  reserved, 0
+//    4 u32 seq
+//    8 u32 t_us (micros() at the IMU read)
+//   12 f32 sens ax ay az gx gy gz  (g, dps; sensor frame as read)
+//   36 f32 map  ax ay az gx gy     (tool frame, before bias removal)
+//   56 f32 corr ax ay az gx gy     (bias removed; fed to the filter)
+//   76 f32 roll_phys pitch_phys    (fused, physical frame)
+//   84 f32 roll pitch              (as displayed: zero/align/freeze applied)
+//   92 u16 crc over bytes 0..91
+
+constexpr uint8_t TELEMETRY_RECORD_SAMPLE = 0x01;
+constexpr uint8_t TELEMETRY_RECORD_VERSION = 1;
+constexpr size_t TELEMETRY_PAYLOAD_BYTES = 94;
+// Delimiter + COBS overhead (1 per 254) + payload + delimiter.
+constexpr size_t TELEMETRY_FRAME_MAX_BYTES = 1 + 1 + TELEMETRY_PAYLOAD_BYTES + TELEMETRY_PAYLOAD_BYTES / 254 + 1;
+
+constexpr uint8_t TELEMETRY_FLAG_FROZEN = 0x01;
+constexpr uint8_t TELEMETRY_FLAG_VERTICAL = 0x02;  // orientation SCREEN VERTICAL
+constexpr uint8_t TELEMETRY_FLAG_WORKFLOW = 0x04;  // ZERO/OFFSET CAL/ALIGN/MODE active
+
+struct TelemetrySample {
+  uint8_t flags;
+  uint32_t seq;
+  uint32_t t_us;
+  float sens_accel[3];
+  float sens_gyro[3];
+  float map_accel[3];
+  float map_gyro[2];
+  float corr_accel[3];
+  float corr_gyro[2];
+  float roll_phys;
+  float pitch_phys;
+  float roll;
+  float pitch;
+};
+
+uint16_t telemetry_crc16(const uint8_t *data, size_t len);
+
+// `out` holds TELEMETRY_PAYLOAD_BYTES.
+void telemetry_pack(const TelemetrySample &sample, uint8_t *out);
+// False on wrong length, type, version or CRC.
+bool telemetry_unpack(const uint8_t *payload, size_t len, TelemetrySample *out);
+
+// Both return the output length, 0 when it does not fit (or, decoding,
+// when the input is not valid COBS).
+size_t cobs_encode(const uint8_t *in, size_t len, uint8_t *out, size_t cap);
+size_t cobs_decode(const uint8_t *in, size_t len, uint8_t *out, size_t cap);
+
+// Complete frame including both delimiters; 0 if `cap` is too small.
+size_t telemetry_frame_encode(const TelemetrySample &sample, uint8_t *out, size_t cap);
+
+// Byte-at-a-time reader that resynchronises on every 0x00.
+struct TelemetryStreamDecoder {
+  uint8_t buf[TELEMETRY_FRAME_MAX_BYTES];
+  size_t len;
+  bool overflow;
+  uint32_t frames_ok;
+  uint32_t frames_bad;  // non-empty runs between delimiters that did not decode
+};
+
+void telemetry_decoder_reset(TelemetryStreamDecoder *dec);
+// True when `byte` completed a valid frame; the record is then in *out.
+bool telemetry_decoder_feed(TelemetryStreamDecoder *dec, uint8_t byte, TelemetrySample *out);
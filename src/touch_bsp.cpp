@@ -1,13 +1,12 @@
 #include "touch_bsp.h"
 #include <Wire.h>
+#include "i2c_bus.h"
+#include "serial_log.h"
 
 // ============================================================
 // TOUCH CONFIG (FT3168)
 // ============================================================
 
-#define EXAMPLE_PIN_NUM_TOUCH_SCL   (GPIO_NUM_39)
-#define EXAMPLE_PIN_NUM_TOUCH_SDA   (GPIO_NUM_40)
-
 #define EXAMPLE_LCD_H_RES  536
 #define EXAMPLE_LCD_V_RES  240
 
@@ -19,6 +18,10 @@ static const uint8_t FT3168_REG_POWER_MODE = 0xA5;
 static const uint8_t FT3168_POWER_ACTIVE = 0x00;
 static const uint8_t FT3168_POWER_HIBERNATE = 0x03;
 static const uint8_t FT3168_POWER_MONITOR = 0x01;
+static const uint8_t FT3168_REG_INT_MODE = 0xA4;
+static const uint8_t FT3168_INT_MODE_LEVEL = 0x00;  // INT held low while touched
+// REG_POINTS .. P1_YL: point count plus first point in one transaction.
+static const uint8_t FT3168_BURST_LEN = 5;
 // Reliability-first default: monitor mode wakes consistently on this board.
 // Hibernate can reduce current further but has shown wake regressions.
 static const bool touchSleepPreferHibernate = false;
@@ -27,21 +30,43 @@ static bool touchReady = false;
 static unsigned long touchLastRecoverMs = 0;
 static const unsigned long touchRecoverIntervalMs = 250;
 
+#if TOUCH_INT_PIN >= 0
+static volatile bool touchIntPending = false;
+#endif
+static bool touchIntActive = false;
+static bool touchWasPressed = false;
+static portMUX_TYPE touchStatsMux = portMUX_INITIALIZER_UNLOCKED;
+static TouchBusStats touchStats = {};
+static int64_t touchSavedBits = 0;
+
 // ============================================================
-// I2C HELPERS (Arduino Wire)
+// I2C HELPERS (Arduino Wire, via the shared bus manager)
 // ============================================================
 
+static const uint8_t I2C_ERR_SHORT_READ = 0xFE;
+static const uint8_t I2C_ERR_UNDERRUN = 0xFD;
+static const uint8_t I2C_ERR_BUS_BUSY = 0xFC;
+
+static I2cBusResult touchBusResult(uint8_t err)
+{
+  if (err == I2C_ERR_SHORT_READ || err == I2C_ERR_UNDERRUN) return I2C_BUS_ERR_SHORT_READ;
+  return i2c_bus_result_from_wire(err);
+}
+
 static uint8_t I2C_write_buff(uint8_t addr, uint8_t reg, uint8_t *buf, uint8_t len)
 {
+  if (!i2c_bus_acquire(I2C_DEV_TOUCH)) return I2C_ERR_BUS_BUSY;
   Wire.beginTransmission(addr);
   Wire.write(reg);
   for (uint8_t i = 0; i < len; i++) {
     Wire.write(buf[i]);
   }
-  return Wire.endTransmission();
+  const uint8_t err = Wire.endTransmission();
+  i2c_bus_release(I2C_DEV_TOUCH, touchBusResult(err));
+  return err;
 }
 
-static uint8_t I2C_read_buff(uint8_t addr, uint8_t reg, uint8_t *buf, uint8_t len)
+static uint8_t I2C_read_locked(uint8_t addr, uint8_t reg, uint8_t *buf, uint8_t len)
 {
   // Use STOP between write/read for better robustness on this board.
   // Repeated-start can trigger intermittent i2cWriteReadNonStop failures.
@@ -57,7 +82,7 @@ static uint8_t I2C_read_buff(uint8_t addr, uint8_t reg, uint8_t *buf, uint8_t le
     while (Wire.available()) {
       (void)Wire.read();
     }
-    return 0xFE;
+    return I2C_ERR_SHORT_READ;
   }
 
   uint8_t i = 0;
@@ -65,11 +90,59 @@ static uint8_t I2C_read_buff(uint8_t addr, uint8_t reg, uint8_t *buf, uint8_t le
     buf[i++] = Wire.read();
   }
   if (i < len) {
-    return 0xFD;
+    return I2C_ERR_UNDERRUN;
   }
   return 0;
 }
 
+static uint8_t I2C_read_buff(uint8_t addr, uint8_t reg, uint8_t *buf, uint8_t len)
+{
+  if (!i2c_bus_acquire(I2C_DEV_TOUCH)) return I2C_ERR_BUS_BUSY;
+  const uint8_t err = I2C_read_locked(addr, reg, buf, len);
+  i2c_bus_release(I2C_DEV_TOUCH, touchBusResult(err));
+  return err;
+}
+
+// Bus bits of one register read as issued by I2C_read_buff(): START, address
+// and register byte, STOP; then START, address, len data bytes, STOP.
+static uint32_t readTransactionBits(uint8_t len)
+{
+  return 20U + 11U + 9U * (uint32_t)len;
+}
+
+static uint8_t timedRead(uint8_t reg, uint8_t *buf, uint8_t len, uint32_t *bits)
+{
+  const uint32_t t0 = micros();
+  const uint8_t err = I2C_read_buff(I2C_ADDR_FT3168, reg, buf, len);
+  const uint32_t dt = micros() - t0;
+  *bits += readTransactionBits(len);
+  portENTER_CRITICAL(&touchStatsMux);
+  touchStats.reads++;
+  touchStats.bus_us += dt;
+  portEXIT_CRITICAL(&touchStatsMux);
+  return err;
+}
+
+// Book one poll against the legacy cost (point-count read every period, plus
+// a coordinate read while touched).
+static void notePoll(bool skipped, bool pressed, uint32_t bits)
+{
+  const uint32_t legacy_bits =
+    readTransactionBits(1) + (pressed ? readTransactionBits(4) : 0U);
+  portENTER_CRITICAL(&touchStatsMux);
+  touchStats.polls++;
+  if (skipped) touchStats.reads_skipped++;
+  touchSavedBits += (int64_t)legacy_bits - (int64_t)bits;
+  portEXIT_CRITICAL(&touchStatsMux);
+}
+
+#if TOUCH_INT_PIN >= 0
+static void IRAM_ATTR touchIntIsr(void)
+{
+  touchIntPending = true;
+}
+#endif
+
 static bool touchWakeAndConfigure(void)
 {
   // Best-effort wake from hibernate for variants that implement power mode.
@@ -83,6 +156,10 @@ static bool touchWakeAndConfigure(void)
   uint8_t data = 0x00;
   const bool cfg_ok = (I2C_write_buff(I2C_ADDR_FT3168, FT3168_REG_DEVICE_MODE, &data, 1) == 0);
   delay(3);
+  // Level-triggered INT, so a held finger keeps the line asserted (best
+  // effort; the line is only trusted after the check in Touch_Init()).
+  uint8_t int_mode = FT3168_INT_MODE_LEVEL;
+  (void)I2C_write_buff(I2C_ADDR_FT3168, FT3168_REG_INT_MODE, &int_mode, 1);
 
   uint8_t points = 0;
   if (I2C_read_buff(I2C_ADDR_FT3168, FT3168_REG_POINTS, &points, 1) == 0 || cfg_ok) {
@@ -106,16 +183,13 @@ static bool touchRecover(void)
 {
   // First try without tearing down the shared bus; this avoids disturbing
   // the IMU path unless recovery really needs a full re-init.
-  Wire.begin(EXAMPLE_PIN_NUM_TOUCH_SDA, EXAMPLE_PIN_NUM_TOUCH_SCL, 300000);
-  delay(2);
   if (touchWakeAndConfigure()) {
     return true;
   }
 
-  Wire.end();
-  delay(2);
-  Wire.begin(EXAMPLE_PIN_NUM_TOUCH_SDA, EXAMPLE_PIN_NUM_TOUCH_SCL, 300000);
-  delay(3);
+  if (!i2c_bus_reset(I2C_DEV_TOUCH)) {
+    return false;
+  }
   return touchWakeAndConfigure();
 }
 
@@ -127,6 +201,28 @@ void Touch_Init(void)
 {
   touchReady = touchRecover();
   touchLastRecoverMs = millis();
+  const uint32_t clock_hz = i2c_bus_clock_hz();
+
+#if TOUCH_INT_PIN >= 0
+  // Only gate reads on INT if the line idles high with nobody touching;
+  // a floating or miswired pin falls back to polling.
+  pinMode(TOUCH_INT_PIN, INPUT_PULLUP);
+  delay(2);
+  uint8_t points = 0;
+  const bool idle_ok = touchReady &&
+    I2C_read_buff(I2C_ADDR_FT3168, FT3168_REG_POINTS, &points, 1) == 0 &&
+    (points != 0 || digitalRead(TOUCH_INT_PIN) == HIGH);
+  if (idle_ok) {
+    attachInterrupt(digitalPinToInterrupt(TOUCH_INT_PIN), touchIntIsr, FALLING);
+    touchIntActive = true;
+  } else {
+    SerialLog.println("Touch: INT line not idle-high, polling instead");
+  }
+#endif
+  portENTER_CRITICAL(&touchStatsMux);
+  touchStats.irq_enabled = touchIntActive;
+  touchStats.bus_clock_hz = clock_hz;
+  portEXIT_CRITICAL(&touchStatsMux);
 }
 
 uint8_t getTouch(uint16_t *x, uint16_t *y)
@@ -142,29 +238,49 @@ uint8_t getTouch(uint16_t *x, uint16_t *y)
     return 0;
   }
 
-  uint8_t points = 0;
-  uint8_t buf[4];
-
-  // Read number of touch points
-  if (I2C_read_buff(I2C_ADDR_FT3168, FT3168_REG_POINTS, &points, 1) != 0) {
-    touchReady = false;
-    touchLastRecoverMs = now;
-    return 0;
+#if TOUCH_INT_PIN >= 0
+  // INT is held low while touched, so an idle line with no pending edge
+  // means "released" without touching the bus.
+  if (touchIntActive) {
+    const bool asserted = digitalRead(TOUCH_INT_PIN) == LOW;
+    if (!asserted && !touchIntPending) {
+      touchWasPressed = false;
+      notePoll(true, false, 0);
+      return 0;
+    }
+    touchIntPending = false;
   }
+#endif
 
-  if (points == 0) {
-    return 0;
+  // One burst for count + first point when a touch is expected; the polling
+  // fallback probes the count alone while idle, since that is cheaper.
+  uint8_t buf[FT3168_BURST_LEN];
+  uint32_t bits = 0;
+  uint8_t points = 0;
+  bool ok;
+  if (touchIntActive || touchWasPressed) {
+    ok = timedRead(FT3168_REG_POINTS, buf, FT3168_BURST_LEN, &bits) == 0;
+    points = buf[0];
+  } else {
+    ok = timedRead(FT3168_REG_POINTS, &points, 1, &bits) == 0;
+    if (ok && points != 0) {
+      ok = timedRead(FT3168_REG_POINT1, buf + 1, 4, &bits) == 0;
+    }
   }
-
-  // Read first touch point coordinates
-  if (I2C_read_buff(I2C_ADDR_FT3168, FT3168_REG_POINT1, buf, 4) != 0) {
+  if (!ok) {
     touchReady = false;
+    touchWasPressed = false;
     touchLastRecoverMs = now;
     return 0;
   }
+  touchWasPressed = points != 0;
+  notePoll(false, touchWasPressed, bits);
+  if (!touchWasPressed) {
+    return 0;
+  }
 
-  uint16_t ty = (((uint16_t)buf[0] & 0x0F) << 8) | buf[1];
-  uint16_t tx = (((uint16_t)buf[2] & 0x0F) << 8) | buf[3];
+  uint16_t ty = (((uint16_t)buf[1] & 0x0F) << 8) | buf[2];
+  uint16_t tx = (((uint16_t)buf[3] & 0x0F) << 8) | buf[4];
 
   // Clamp to screen bounds
   if (tx > EXAMPLE_LCD_H_RES) tx = EXAMPLE_LCD_H_RES;
@@ -191,3 +307,15 @@ bool Touch_Sleep(void)
   }
   return ok;
 }
+
+void Touch_GetBusStats(TouchBusStats *out)
+{
+  if (!out) return;
+  portENTER_CRITICAL(&touchStatsMux);
+  *out = touchStats;
+  const int64_t saved_bits = touchSavedBits;
+  portEXIT_CRITICAL(&touchStatsMux);
+  out->saved_us = (saved_bits > 0 && out->bus_clock_hz > 0)
+    ? (uint64_t)saved_bits * 1000000ULL / out->bus_clock_hz
+    : 0;
+}
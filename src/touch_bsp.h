@@ -3,9 +3,29 @@
 
 #include <Arduino.h>
 
+// FT3168 INT line (active low while a finger is down). Leave at -1 to poll
+// the controller every LVGL input period instead.
+#ifndef TOUCH_INT_PIN
+#define TOUCH_INT_PIN -1
+#endif
+
+// I2C traffic of the touch path since boot. saved_us is the bus time that the
+// INT gating and the single burst read avoided compared with polling two
+// transactions (point count, then coordinates) every input period.
+struct TouchBusStats {
+  bool irq_enabled;
+  uint32_t polls;          // getTouch() calls
+  uint32_t reads;          // I2C read transactions issued
+  uint32_t reads_skipped;  // polls answered from the INT line alone
+  uint32_t bus_clock_hz;
+  uint64_t bus_us;         // measured time spent in touch reads
+  uint64_t saved_us;       // estimated, at bus_clock_hz
+};
+
 // Touch BSP public API
 void Touch_Init(void);
 uint8_t getTouch(uint16_t *x, uint16_t *y);
 bool Touch_Sleep(void);
+void Touch_GetBusStats(TouchBusStats *out);
 
 #endif
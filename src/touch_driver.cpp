@@ -4,19 +4,32 @@
 
 void touch_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data)
 {
-    (void)drv;
     if (!getTouchInputEnabled()) {
         data->state = LV_INDEV_STATE_RELEASED;
         return;
     }
 
+    static bool swallow_wake_touch = false;
     uint16_t x, y;
 
     if (getTouch(&x, &y)) {
+        // A touch on a blanked panel only wakes it; ignore it until release.
+        if (displayNoteActivity() || swallow_wake_touch) {
+            swallow_wake_touch = true;
+            data->state = LV_INDEV_STATE_RELEASED;
+            return;
+        }
+        // In direct mode the panel (not LVGL) does the 180-degree rotation,
+        // so LVGL will not flip the touch point for us.
+        if (displayRotated && drv->disp && drv->disp->driver->direct_mode) {
+            x = lv_disp_get_hor_res(drv->disp) - 1 - x;
+            y = lv_disp_get_ver_res(drv->disp) - 1 - y;
+        }
         data->state = LV_INDEV_STATE_PRESSED;
         data->point.x = x;
         data->point.y = y;
     } else {
+        swallow_wake_touch = false;
         data->state = LV_INDEV_STATE_RELEASED;
     }
 }
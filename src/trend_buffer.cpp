@@ -0,0 +1,56 @@
+#include "trend_buffer.h"
+
+#include <string.h>
+
+void trend_buffer_init(TrendBuffer *buf, uint16_t decimation) {
+  if (!buf) return;
+  memset(buf, 0, sizeof(*buf));
+  buf->decimation = decimation ? decimation : 1;
+}
+
+bool trend_buffer_push(TrendBuffer *buf, float roll, float pitch) {
+  if (!buf) return false;
+  buf->sum_roll += roll;
+  buf->sum_pitch += pitch;
+  if (++buf->pending < buf->decimation) return false;
+
+  TrendSample &s = buf->samples[buf->total % TREND_BUFFER_CAPACITY];
+  s.roll = buf->sum_roll / (float)buf->pending;
+  s.pitch = buf->sum_pitch / (float)buf->pending;
+  buf->total++;
+  buf->pending = 0;
+  buf->sum_roll = 0.0f;
+  buf->sum_pitch = 0.0f;
+  return true;
+}
+
+size_t trend_buffer_count(const TrendBuffer *buf) {
+  if (!buf) return 0;
+  return (buf->total < TREND_BUFFER_CAPACITY) ? (size_t)buf->total : TREND_BUFFER_CAPACITY;
+}
+
+bool trend_buffer_at(const TrendBuffer *buf, uint32_t seq, TrendSample *out) {
+  if (!buf || !out) return false;
+  if (seq >= buf->total || buf->total - seq > trend_buffer_count(buf)) return false;
+  *out = buf->samples[seq % TREND_BUFFER_CAPACITY];
+  return true;
+}
+
+bool trend_buffer_range(const TrendBuffer *buf, size_t last_n, TrendSample *min_out, TrendSample *max_out) {
+  const size_t count = trend_buffer_count(buf);
+  if (count == 0 || !min_out || !max_out) return false;
+  if (last_n == 0 || last_n > count) last_n = count;
+
+  TrendSample lo = buf->samples[(buf->total - 1) % TREND_BUFFER_CAPACITY];
+  TrendSample hi = lo;
+  for (size_t i = 1; i < last_n; ++i) {
+    const TrendSample &s = buf->samples[(buf->total - 1 - i) % TREND_BUFFER_CAPACITY];
+    if (s.roll < lo.roll) lo.roll = s.roll;
+    if (s.roll > hi.roll) hi.roll = s.roll;
+    if (s.pitch < lo.pitch) lo.pitch = s.pitch;
+    if (s.pitch > hi.pitch) hi.pitch = s.pitch;
+  }
+  *min_out = lo;
+  *max_out = hi;
+  return true;
+}
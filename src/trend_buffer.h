@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-size history of decimated roll/pitch samples for the on-device trend
+// view. Every `decimation` pushes are averaged into one stored sample; the
+// oldest sample is overwritten once the buffer is full. No heap.
+
+constexpr size_t TREND_BUFFER_CAPACITY = 512;
+
+struct TrendSample {
+  float roll;
+  float pitch;
+};
+
+struct TrendBuffer {
+  TrendSample samples[TREND_BUFFER_CAPACITY];
+  uint32_t total;        // stored samples since init; next sequence number
+  uint16_t decimation;
+  uint16_t pending;
+  float sum_roll;
+  float sum_pitch;
+};
+
+void trend_buffer_init(TrendBuffer *buf, uint16_t decimation);
+
+// Feed one raw sample. Returns true when a decimated sample was stored.
+bool trend_buffer_push(TrendBuffer *buf, float roll, float pitch);
+
+size_t trend_buffer_count(const TrendBuffer *buf);
+
+// Samples are addressed by sequence number (0 = first stored sample). Only
+// the last trend_buffer_count() sequence numbers are still available.
+bool trend_buffer_at(const TrendBuffer *buf, uint32_t seq, TrendSample *out);
+
+// Min/max of roll and pitch over the newest `last_n` samples.
+// Returns false if the buffer is empty.
+bool trend_buffer_range(const TrendBuffer *buf, size_t last_n, TrendSample *min_out, TrendSample *max_out);
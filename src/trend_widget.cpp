@@ -0,0 +1,310 @@
+// ============================================================
+// trend_widget.cpp — sweep trend chart for roll/pitch history
+// (LVGL v8.x.y)
+// ============================================================
+
+#include "trend_widget.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DEG_SYM "\xC2\xB0"
+
+// ============================================================
+// LAYOUT / SCALE KNOBS
+// ============================================================
+
+constexpr int TREND_LANES = 2;
+constexpr lv_coord_t TREND_SWEEP_GAP = 6;     // blank columns ahead of the cursor
+constexpr lv_coord_t TREND_LANE_PAD = 3;      // px kept free at lane top/bottom
+constexpr float TREND_FIT = 0.9f;             // use at most 90% of a half lane
+
+// Half-lane spans in degrees, smallest first.
+static const float kTrendSpans[] = {0.25f, 0.5f, 1.0f, 2.0f, 5.0f, 10.0f, 20.0f, 45.0f, 90.0f, 180.0f};
+constexpr int TREND_SPAN_COUNT = sizeof(kTrendSpans) / sizeof(kTrendSpans[0]);
+
+static const char *const kLaneNames[TREND_LANES] = {"ROLL", "PITCH"};
+static const uint32_t kLaneColors[TREND_LANES] = {0x6FD3FF, 0xB8E986};
+static const uint32_t kGridColor = 0x303030;
+
+// ============================================================
+// WIDGET STATE
+// ============================================================
+
+struct TrendLane {
+  float center;
+  int span_idx;
+  lv_obj_t *label;
+};
+
+struct TrendWidgetState {
+  const TrendBuffer *src;
+  lv_coord_t w;             // one column per stored sample
+  uint32_t synced_total;
+  TrendLane lanes[TREND_LANES];
+  lv_color_t colors[TREND_LANES];
+  lv_color_t grid;
+};
+
+static TrendWidgetState *state_of(lv_obj_t *obj)
+{
+  return obj ? (TrendWidgetState *)lv_obj_get_user_data(obj) : nullptr;
+}
+
+static float lane_value(const TrendSample &s, int lane)
+{
+  return lane == 0 ? s.roll : s.pitch;
+}
+
+static lv_coord_t visible_columns(lv_coord_t w)
+{
+  return (w > TREND_SWEEP_GAP) ? (w - TREND_SWEEP_GAP) : 0;
+}
+
+// ============================================================
+// SCALING
+// ============================================================
+
+static bool lane_fits(const TrendLane &lane, float lo, float hi)
+{
+  const float limit = kTrendSpans[lane.span_idx] * TREND_FIT;
+  return (hi - lane.center) <= limit && (lane.center - lo) <= limit;
+}
+
+// Smallest span (centered on a quarter-span grid so the window does not
+// creep with every sample) that holds [lo, hi].
+static void fit_lane(TrendLane &lane, float lo, float hi)
+{
+  const float mid = 0.5f * (lo + hi);
+  for (int i = 0; i < TREND_SPAN_COUNT; i++) {
+    const float grid = kTrendSpans[i] * 0.25f;
+    lane.span_idx = i;
+    lane.center = roundf(mid / grid) * grid;
+    if (lane_fits(lane, lo, hi)) return;
+  }
+  lane.center = mid;
+}
+
+static void update_lane_label(const TrendLane &lane, int index)
+{
+  if (!lane.label) return;
+  const float span = kTrendSpans[lane.span_idx];
+  const int decimals = (span < 1.0f) ? 2 : (span < 5.0f) ? 1 : 0;
+  char buf[40];
+  snprintf(buf, sizeof(buf), "%s  %.*f" DEG_SYM " .. %.*f" DEG_SYM,
+           kLaneNames[index],
+           decimals, lane.center - span,
+           decimals, lane.center + span);
+  lv_label_set_text(lane.label, buf);
+}
+
+// Re-fit every lane to the visible history. With `zoom_in` false a lane only
+// changes if the history no longer fits. Returns true if any lane changed.
+static bool refit_lanes(TrendWidgetState *st, bool zoom_in)
+{
+  TrendSample lo;
+  TrendSample hi;
+  const size_t visible = (size_t)visible_columns(st->w);
+  if (!trend_buffer_range(st->src, visible, &lo, &hi)) return false;
+
+  bool changed = false;
+  for (int i = 0; i < TREND_LANES; i++) {
+    TrendLane &lane = st->lanes[i];
+    const float l = lane_value(lo, i);
+    const float h = lane_value(hi, i);
+    if (!zoom_in && lane_fits(lane, l, h)) continue;
+
+    const TrendLane before = lane;
+    fit_lane(lane, l, h);
+    if (lane.span_idx == before.span_idx && lane.center == before.center) continue;
+    update_lane_label(lane, i);
+    changed = true;
+  }
+  return changed;
+}
+
+// ============================================================
+// DRAW (direct blit into the LVGL draw buffer)
+// ============================================================
+
+static void put_vline(lv_draw_ctx_t *draw_ctx, lv_coord_t x, lv_coord_t y1, lv_coord_t y2, lv_color_t color)
+{
+  const lv_area_t *clip = draw_ctx->clip_area;
+  if (x < clip->x1 || x > clip->x2) return;
+  if (y1 > y2) {
+    const lv_coord_t t = y1;
+    y1 = y2;
+    y2 = t;
+  }
+  if (y1 < clip->y1) y1 = clip->y1;
+  if (y2 > clip->y2) y2 = clip->y2;
+  if (y1 > y2) return;
+
+  const lv_area_t *buf_area = draw_ctx->buf_area;
+  const lv_coord_t buf_w = lv_area_get_width(buf_area);
+  lv_color_t *dst = (lv_color_t *)draw_ctx->buf + (int32_t)(y1 - buf_area->y1) * buf_w + (x - buf_area->x1);
+  for (lv_coord_t y = y1; y <= y2; y++, dst += buf_w) {
+    *dst = color;
+  }
+}
+
+static lv_coord_t value_to_y(const TrendLane &lane, float v, lv_coord_t mid_y, lv_coord_t half_h)
+{
+  float n = (v - lane.center) / kTrendSpans[lane.span_idx];
+  if (n > 1.0f) n = 1.0f;
+  if (n < -1.0f) n = -1.0f;
+  return mid_y - (lv_coord_t)lroundf(n * (float)half_h);
+}
+
+static void draw_columns(lv_draw_ctx_t *draw_ctx, const TrendWidgetState *st, const lv_area_t *coords)
+{
+  const lv_coord_t w = st->w;
+  const lv_coord_t lane_h = lv_area_get_height(coords) / TREND_LANES;
+  const lv_coord_t half_h = lane_h / 2 - TREND_LANE_PAD;
+  if (w <= TREND_SWEEP_GAP || half_h <= 0) return;
+
+  lv_coord_t x1 = LV_MAX(draw_ctx->clip_area->x1, coords->x1);
+  lv_coord_t x2 = LV_MIN(draw_ctx->clip_area->x2, coords->x2);
+
+  const uint32_t total = st->src->total;
+  const lv_coord_t visible = visible_columns(w);
+  const lv_coord_t cursor = total ? (lv_coord_t)((total - 1) % (uint32_t)w) : -1;
+
+  for (lv_coord_t x = x1; x <= x2; x++) {
+    const lv_coord_t col = x - coords->x1;
+
+    for (int i = 0; i < TREND_LANES; i++) {
+      const lv_coord_t mid_y = coords->y1 + i * lane_h + lane_h / 2;
+      if ((col & 3) == 0) put_vline(draw_ctx, x, mid_y, mid_y, st->grid);
+    }
+
+    if (cursor < 0) continue;
+    const lv_coord_t back = (cursor - col + w) % w;
+    if (back >= visible || (uint32_t)back >= total) continue;
+
+    const uint32_t seq = total - 1 - (uint32_t)back;
+    TrendSample cur;
+    if (!trend_buffer_at(st->src, seq, &cur)) continue;
+    TrendSample prev;
+    const bool has_prev = (back + 1 < visible) && seq > 0 && trend_buffer_at(st->src, seq - 1, &prev);
+
+    for (int i = 0; i < TREND_LANES; i++) {
+      const TrendLane &lane = st->lanes[i];
+      const lv_coord_t mid_y = coords->y1 + i * lane_h + lane_h / 2;
+      const lv_coord_t y = value_to_y(lane, lane_value(cur, i), mid_y, half_h);
+      // Join to the previous column so steep moves stay a continuous trace.
+      const lv_coord_t y_prev = has_prev ? value_to_y(lane, lane_value(prev, i), mid_y, half_h) : y;
+      const lv_coord_t y_from = (y_prev < y) ? y_prev + 1 : (y_prev > y) ? y_prev - 1 : y;
+      put_vline(draw_ctx, x, y_from, y, st->colors[i]);
+    }
+  }
+}
+
+static void trend_event_cb(lv_event_t *e)
+{
+  const lv_event_code_t code = lv_event_get_code(e);
+  lv_obj_t *obj = lv_event_get_target(e);
+  TrendWidgetState *st = state_of(obj);
+  if (!st) return;
+
+  if (code == LV_EVENT_DRAW_MAIN) {
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    if (!draw_ctx || !draw_ctx->buf || !st->src) return;
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    draw_columns(draw_ctx, st, &coords);
+  } else if (code == LV_EVENT_DELETE) {
+    lv_obj_set_user_data(obj, nullptr);
+    lv_mem_free(st);
+  }
+}
+
+static void invalidate_column(lv_obj_t *obj, lv_coord_t col)
+{
+  lv_area_t area;
+  lv_obj_get_coords(obj, &area);
+  area.x1 += col;
+  area.x2 = area.x1;
+  lv_obj_invalidate_area(obj, &area);
+}
+
+// ============================================================
+// PUBLIC API
+// ============================================================
+
+lv_obj_t *trend_widget_create(lv_obj_t *parent, const TrendBuffer *source, lv_coord_t w, lv_coord_t h)
+{
+  TrendWidgetState *st = (TrendWidgetState *)lv_mem_alloc(sizeof(TrendWidgetState));
+  if (!st) return nullptr;
+  memset(st, 0, sizeof(*st));
+  st->src = source;
+  st->w = LV_MIN(w, (lv_coord_t)TREND_BUFFER_CAPACITY);
+  st->synced_total = source ? source->total : 0;
+  st->grid = lv_color_hex(kGridColor);
+
+  lv_obj_t *obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(obj);
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_size(obj, st->w, h);
+  lv_obj_set_user_data(obj, st);
+  lv_obj_add_event_cb(obj, trend_event_cb, LV_EVENT_ALL, nullptr);
+
+  for (int i = 0; i < TREND_LANES; i++) {
+    TrendLane &lane = st->lanes[i];
+    st->colors[i] = lv_color_hex(kLaneColors[i]);
+    lane.span_idx = 2;
+    lane.center = 0.0f;
+    lane.label = lv_label_create(obj);
+    lv_obj_set_style_text_font(lane.label, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(lane.label, st->colors[i], 0);
+    lv_obj_set_style_text_opa(lane.label, LV_OPA_70, 0);
+    lv_obj_align(lane.label, LV_ALIGN_TOP_LEFT, 2, i * (h / TREND_LANES));
+    update_lane_label(lane, i);
+  }
+  return obj;
+}
+
+void trend_widget_refresh(lv_obj_t *obj)
+{
+  TrendWidgetState *st = state_of(obj);
+  if (!st || !st->src) return;
+  st->synced_total = st->src->total;
+  refit_lanes(st, true);
+  lv_obj_invalidate(obj);
+}
+
+void trend_widget_sync(lv_obj_t *obj)
+{
+  TrendWidgetState *st = state_of(obj);
+  if (!st || !st->src) return;
+  const uint32_t total = st->src->total;
+  if (total == st->synced_total) return;
+
+  const lv_coord_t w = st->w;
+  const uint32_t added = total - st->synced_total;
+  const uint32_t prev_total = st->synced_total;
+  st->synced_total = total;
+
+  if (w <= TREND_SWEEP_GAP || added >= (uint32_t)visible_columns(w)) {
+    refit_lanes(st, true);
+    lv_obj_invalidate(obj);
+    return;
+  }
+
+  // Once per sweep (cursor wrapped to column 0) let settled lanes zoom back in;
+  // otherwise only re-scale if the new samples left the current window.
+  const bool wrapped = (prev_total / (uint32_t)w) != (total / (uint32_t)w);
+  if (refit_lanes(st, wrapped)) {
+    lv_obj_invalidate(obj);
+    return;
+  }
+
+  for (uint32_t seq = prev_total; seq < total; seq++) {
+    const lv_coord_t col = (lv_coord_t)(seq % (uint32_t)w);
+    invalidate_column(obj, col);
+    // The oldest visible column drops out and its neighbour loses its join.
+    invalidate_column(obj, (col + TREND_SWEEP_GAP) % w);
+    invalidate_column(obj, (col + TREND_SWEEP_GAP + 1) % w);
+  }
+}
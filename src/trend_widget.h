@@ -0,0 +1,22 @@
+#pragma once
+
+#include <lvgl.h>
+#include "trend_buffer.h"
+
+// Sweep-style roll/pitch trend chart fed from a TrendBuffer.
+//
+// One stored sample maps to one pixel column (column = sequence % width).
+// New samples are written at a moving cursor with a short blank gap ahead of
+// it, so an append only invalidates two 1 px columns instead of the whole
+// series. Roll is drawn in the upper lane, pitch in the lower one; each lane
+// re-scales (full repaint) only when a value leaves its current range, or
+// zooms back in once per sweep when the signal has settled.
+lv_obj_t *trend_widget_create(lv_obj_t *parent, const TrendBuffer *source, lv_coord_t w, lv_coord_t h);
+
+// Pick up samples appended to the source since the last call and invalidate
+// the columns they touch. Cheap when nothing was appended.
+void trend_widget_sync(lv_obj_t *obj);
+
+// Re-fit both lanes to the visible history and repaint (e.g. when the view
+// is shown after being hidden).
+void trend_widget_refresh(lv_obj_t *obj);
@@ -2,120 +2,26 @@
 // ui_lvgl.ino — CLEAN REWRITE (FINAL, STABLE)
 // LVGL v8.x.y — UI STRUCTURE LOCKED
 // ============================================================
+//
+// Hardware-independent UI layer: widgets, UI state machine and the update
+// path. The panel, draw buffers and the LVGL task live in display_panel.cpp.
+// Time comes from lv_tick_get(), so the file builds against any LVGL display
+// driver.
 
 #include "ui_lvgl.h"
-#include <Arduino_GFX_Library.h>
 #include "inclinometer_shared.h"
-#include "fw_version.h"
-#include "splash_image_536x240_rgb565.h"
-#include <esp_sleep.h>
-#include <esp_system.h>
 #include <math.h>
+#include <stdio.h>
 #include <string.h>
-#include "touch_bsp.h"
+#include "fixed_format.h"
+#include "readout_widget.h"
+#include "trend_buffer.h"
+#include "trend_widget.h"
 
 LV_FONT_DECLARE(lv_font_montserrat_56_num);
 
-// ============================================================
-// DISPLAY CONFIG
-// ============================================================
-
-#define LCD_WIDTH   536
-#define LCD_HEIGHT  240
 #define DEG_SYM "\xC2\xB0"
 
-// ============================================================
-// QSPI PINS
-// ============================================================
-
-#define LCD_CS   6
-#define LCD_RST  17
-#define LCD_CLK  47
-#define LCD_D0   18
-#define LCD_D1   7
-#define LCD_D2   48
-#define LCD_D3   5
-#define LCD_BASE_ROTATION 3
-
-// ============================================================
-// DISPLAY DRIVER
-// ============================================================
-
-Arduino_DataBus *bus = new Arduino_ESP32QSPI(
-  LCD_CS, LCD_CLK, LCD_D0, LCD_D1, LCD_D2, LCD_D3
-);
-
-Arduino_GFX *gfx = new Arduino_RM67162(
-  bus,
-  LCD_RST,
-  LCD_BASE_ROTATION,
-  false
-);
-
-// ============================================================
-// TOUCH SCREEN
-// ============================================================
-extern void touch_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data);
-
-// ============================================================
-// LVGL DRAW BUFFER
-// ============================================================
-
-static lv_disp_draw_buf_t draw_buf;
-static lv_color_t *buf1;
-static lv_color_t *buf2;
-static lv_disp_t *disp_handle = nullptr;
-static bool splash_deferred_until_first_loop = false;
-static uint32_t splash_deferred_due_ms = 0;
-static const uint32_t splashShowDurationMs = 1500;
-static const uint32_t splashDeferredDelayMs = 450;
-static const uint32_t panelDeepSleepResetLowMs = 35;
-static const uint32_t panelDeepSleepResetHighSettleMs = 220;
-static const uint32_t panelWakeSettleMs = 120;
-static const uint32_t panelColdSettleMs = 30;
-static const uint32_t panelWakeSplashPreDelayMs = 20;
-static const uint32_t panelDeepSleepBeginRetryDelayMs = 80;
-static const uint32_t panelDeepSleepBeginRetryCount = 5;
-static uint8_t last_applied_brightness_percent = 0xFF;
-
-static void apply_display_brightness()
-{
-  const uint8_t percent = getDisplayBrightnessPercent();
-  if (percent == last_applied_brightness_percent) return;
-  const uint8_t panel_value = (uint8_t)((percent * 255U + 50U) / 100U);
-  bus->beginWrite();
-  bus->writeC8D8(0x51, panel_value);
-  bus->endWrite();
-  last_applied_brightness_percent = percent;
-}
-
-static void show_startup_splash()
-{
-  apply_display_brightness();
-  const uint8_t splash_rotation =
-    displayRotated ? ((LCD_BASE_ROTATION + 2) % 4) : LCD_BASE_ROTATION;
-  gfx->setRotation(splash_rotation);
-  gfx->draw16bitRGBBitmap(0, 0, (uint16_t *)SPLASH_IMAGE_536x240_RGB565, LCD_WIDTH, LCD_HEIGHT);
-
-  const int text_size = 2;
-  const int char_w = 6 * text_size;
-  const int char_h = 8 * text_size;
-  const int margin_r = 12;
-  const int margin_b = 10;
-  const int text_w = (int)strlen(FW_VERSION) * char_w;
-  const int text_h = char_h;
-  const int text_x = LCD_WIDTH - margin_r - text_w;
-  const int text_y = LCD_HEIGHT - margin_b - text_h;
-
-  gfx->fillRect(text_x - 6, text_y - 4, text_w + 12, text_h + 8, 0x0000);
-  gfx->setTextSize(text_size);
-  gfx->setTextColor(0xFFFF);
-  gfx->setCursor(text_x, text_y);
-  gfx->print(FW_VERSION);
-  gfx->setRotation(LCD_BASE_ROTATION);
-
-  delay(splashShowDurationMs);
-}
 
 // ============================================================
 // UI STATE MACHINE
@@ -147,12 +53,17 @@ AxisDisplayMode getAxisMode(void)
 static lv_obj_t *label_mode;
 static lv_obj_t *label_battery;
 static lv_obj_t *label_battery_charge;
-static lv_obj_t *label_header;
+
+// Objects below are built on first use (see LAZY OBJECT TREES); nullptr
+// until then. The hint strip is kept once built, the ALIGN instruction panel
+// and the trend view are deleted again when their screen is left.
+
+// Hint / feedback strip
 static lv_obj_t *boot_hint_box;
 static lv_obj_t *label_boot_hint;
 static lv_obj_t *boot_hint_progress;
 
-// Instruction group
+// Instruction group (ALIGN only)
 static lv_obj_t *instr_grp;
 static lv_obj_t *label_instruction;
 
@@ -161,8 +72,26 @@ static lv_obj_t *roll_grp;
 static lv_obj_t *pitch_grp;
 static lv_obj_t *label_roll;
 static lv_obj_t *label_pitch;
-static lv_obj_t *label_roll_value;
-static lv_obj_t *label_pitch_value;
+static lv_obj_t *readout_roll_value;
+static lv_obj_t *readout_pitch_value;
+
+// Angle trend (replaces the readouts while shown; history outlives the view)
+static lv_obj_t *trend_view;
+static TrendBuffer angle_trend;
+static bool trend_view_active = false;
+
+// LVGL heap around the on-demand trees: bytes in use before a build against
+// after the matching release. The trend view is deleted asynchronously, so
+// its closing sample is taken on the next ui_refresh(), after
+// lv_timer_handler() has run the delete.
+struct LazyHeapProbe {
+  uint32_t used_before;
+  bool open;
+  bool close_pending;
+  UiLazyHeapStats stats;
+};
+static LazyHeapProbe align_heap_probe;
+static LazyHeapProbe trend_heap_probe;
 
 // Layout knobs (field-tunable)
 constexpr int READOUT_Y = -35;      // whole readout block vertical offset from screen center
@@ -192,6 +121,12 @@ constexpr int BOOT_HINT_BOTTOM_MARGIN = 20;
 constexpr int BOTTOM_CONTROL_H = DIVIDER_H + BOTTOM_ROW_GAP + BTN_BAR_H;
 constexpr int BOOT_HINT_Y_FROM_BOTTOM = -(BOTTOM_CONTROL_H + BOOT_HINT_BOTTOM_MARGIN);
 
+// Trend: one column per stored sample; update_ui runs every 50 ms, so
+// 4:1 decimation gives 200 ms per column (~100 s across the view).
+constexpr int TREND_VIEW_W = (int)TREND_BUFFER_CAPACITY;
+constexpr int TREND_VIEW_H = READOUT_GROUP_H + 8;
+constexpr uint16_t TREND_DECIMATION = 4;
+
 // Buttons
 static lv_obj_t *btn_zero;
 static lv_obj_t *btn_axis;
@@ -207,6 +142,7 @@ static lv_obj_t *label_btn_rotate;
 static uint32_t zero_feedback_until_ms = 0;
 static uint32_t zero_feedback_start_ms = 0;
 static bool zero_long_press_handled = false;
+static bool rotate_long_press_handled = false;
 static TouchUiLayoutMode active_touch_ui_layout = TOUCH_UI_ADVANCED;
 static uint32_t mode_btn_press_start_ms = 0;
 static bool mode_btn_press_active = false;
@@ -215,6 +151,155 @@ constexpr uint32_t SIMPLE_VIEW_MEDIUM_HOLD_MS = 900;
 constexpr uint32_t SIMPLE_VIEW_LONG_HOLD_MS = 2200;
 constexpr int SIMPLE_BTN_W = 228;
 
+// ============================================================
+// LAZY OBJECT TREES
+// ============================================================
+//
+// create_ui() only builds what the NORMAL screen shows. Each tree below is
+// built on first entry. The hint strip and instruction panel are moved to the
+// back so they keep the stacking order they had when everything was created
+// at boot (the readout groups above them stay tappable).
+
+static void on_trend_pressed(lv_event_t *);
+
+// Returns true if the strip was just built.
+static bool ensure_hint_strip()
+{
+  if (boot_hint_box) return false;
+  lv_obj_t *scr = lv_scr_act();
+
+  boot_hint_box = lv_obj_create(scr);
+  lv_obj_move_background(boot_hint_box);
+  lv_obj_set_size(boot_hint_box, lv_pct(96), BOOT_HINT_H);
+  lv_obj_align(boot_hint_box, LV_ALIGN_BOTTOM_MID, 0, BOOT_HINT_Y_FROM_BOTTOM);
+  lv_obj_set_style_bg_color(boot_hint_box, lv_color_black(), 0);
+  lv_obj_set_style_bg_opa(boot_hint_box, LV_OPA_80, 0);
+  lv_obj_set_style_border_width(boot_hint_box, 0, 0);
+  lv_obj_set_style_radius(boot_hint_box, 8, 0);
+  lv_obj_set_style_pad_all(boot_hint_box, 1, 0);
+  lv_obj_clear_flag(boot_hint_box, LV_OBJ_FLAG_SCROLLABLE);
+
+  label_boot_hint = lv_label_create(boot_hint_box);
+  lv_label_set_text(label_boot_hint, "");
+  lv_obj_set_style_text_font(label_boot_hint, &lv_font_montserrat_24, 0);
+  lv_obj_set_style_text_color(label_boot_hint, lv_color_hex(0xE6F5FF), 0);
+  lv_obj_set_style_text_align(label_boot_hint, LV_TEXT_ALIGN_CENTER, 0);
+  lv_label_set_long_mode(label_boot_hint, LV_LABEL_LONG_WRAP);
+  lv_obj_set_width(label_boot_hint, lv_pct(100));
+  lv_obj_align(label_boot_hint, LV_ALIGN_TOP_MID, 0, 0);
+
+  boot_hint_progress = lv_bar_create(boot_hint_box);
+  lv_obj_set_size(boot_hint_progress, lv_pct(72), 5);
+  lv_obj_align(boot_hint_progress, LV_ALIGN_BOTTOM_MID, 0, 0);
+  lv_bar_set_range(boot_hint_progress, 0, 100);
+  lv_bar_set_value(boot_hint_progress, 0, LV_ANIM_OFF);
+  lv_obj_set_style_bg_color(boot_hint_progress, lv_color_hex(0x3A3A3A), LV_PART_MAIN);
+  lv_obj_set_style_bg_opa(boot_hint_progress, LV_OPA_70, LV_PART_MAIN);
+  lv_obj_set_style_bg_color(boot_hint_progress, lv_color_hex(0x6FD3FF), LV_PART_INDICATOR);
+  lv_obj_set_style_bg_opa(boot_hint_progress, LV_OPA_90, LV_PART_INDICATOR);
+  lv_obj_set_style_radius(boot_hint_progress, 3, LV_PART_MAIN);
+  lv_obj_set_style_radius(boot_hint_progress, 3, LV_PART_INDICATOR);
+  lv_obj_add_flag(boot_hint_progress, LV_OBJ_FLAG_HIDDEN);
+  return true;
+}
+
+static void hide_hint_strip()
+{
+  if (!boot_hint_box) return;
+  lv_obj_add_flag(boot_hint_box, LV_OBJ_FLAG_HIDDEN);
+  lv_obj_add_flag(boot_hint_progress, LV_OBJ_FLAG_HIDDEN);
+}
+
+static uint32_t lv_mem_used_now()
+{
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  return mon.total_size - mon.free_size;
+}
+
+static void lazy_heap_open(LazyHeapProbe *probe)
+{
+  // Reopened before the last delete was sampled: that cycle is not counted.
+  probe->close_pending = false;
+  probe->used_before = lv_mem_used_now();
+  probe->open = true;
+}
+
+static void lazy_heap_close(LazyHeapProbe *probe)
+{
+  if (!probe->open) return;
+  probe->open = false;
+  probe->close_pending = false;
+  const int32_t delta = (int32_t)(lv_mem_used_now() - probe->used_before);
+  probe->stats.round_trips++;
+  probe->stats.last_delta = delta;
+  if (probe->stats.round_trips == 1 || delta > probe->stats.max_delta) probe->stats.max_delta = delta;
+}
+
+static void ensure_instruction_panel()
+{
+  if (instr_grp) return;
+  lazy_heap_open(&align_heap_probe);
+  lv_obj_t *scr = lv_scr_act();
+
+  instr_grp = lv_obj_create(scr);
+  lv_obj_move_background(instr_grp);
+  lv_obj_set_width(instr_grp, lv_pct(94));
+  lv_obj_align(instr_grp, LV_ALIGN_CENTER, 0, -34);
+  lv_obj_set_flex_flow(instr_grp, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_flex_align(instr_grp,
+                        LV_FLEX_ALIGN_CENTER,
+                        LV_FLEX_ALIGN_CENTER,
+                        LV_FLEX_ALIGN_CENTER);
+
+  lv_obj_set_style_bg_color(instr_grp, lv_color_black(), 0);
+  lv_obj_set_style_bg_opa(instr_grp, LV_OPA_80, 0);
+  lv_obj_set_style_border_width(instr_grp, 0, 0);
+  lv_obj_set_style_pad_all(instr_grp, 8, 0);
+
+  lv_obj_clear_flag(instr_grp, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_scrollbar_mode(instr_grp, LV_SCROLLBAR_MODE_OFF);
+
+  label_instruction = lv_label_create(instr_grp);
+  lv_obj_set_width(label_instruction, lv_pct(100));
+  lv_label_set_text(label_instruction, "");
+  lv_label_set_long_mode(label_instruction, LV_LABEL_LONG_WRAP);
+  lv_obj_set_style_text_font(label_instruction, &lv_font_montserrat_24, 0);
+  lv_obj_set_style_text_color(label_instruction, lv_color_hex(0xE0E0E0), 0);
+  lv_obj_set_style_text_align(label_instruction, LV_TEXT_ALIGN_CENTER, 0);
+}
+
+static void release_instruction_panel()
+{
+  if (!instr_grp) return;
+  lv_obj_del(instr_grp);
+  instr_grp = nullptr;
+  label_instruction = nullptr;
+  lazy_heap_close(&align_heap_probe);
+}
+
+static void ensure_trend_view()
+{
+  if (trend_view) return;
+  lazy_heap_open(&trend_heap_probe);
+  trend_view = trend_widget_create(lv_scr_act(), &angle_trend, TREND_VIEW_W, TREND_VIEW_H);
+  if (!trend_view) return;
+  lv_obj_add_flag(trend_view, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_align(trend_view, LV_ALIGN_CENTER, 0, READOUT_Y);
+  lv_obj_add_event_cb(trend_view, on_trend_pressed, LV_EVENT_CLICKED, NULL);
+  trend_widget_refresh(trend_view);
+}
+
+static void release_trend_view()
+{
+  if (!trend_view) return;
+  // Usually left from the view's own CLICKED handler: defer the delete.
+  lv_obj_add_flag(trend_view, LV_OBJ_FLAG_HIDDEN);
+  lv_obj_del_async(trend_view);
+  trend_view = nullptr;
+  trend_heap_probe.close_pending = trend_heap_probe.open;
+}
+
 static const char *axis_mode_text()
 {
   switch (ui_axis_mode) {
@@ -242,17 +327,26 @@ static int readout_decimals()
   return decimals;
 }
 
+// " 12.34°" / "-0.50°" into buf (sized for the readout label).
+static void format_angle(char *buf, size_t size, float value, int decimals)
+{
+  const size_t n = fixed_format(buf, size - (sizeof(DEG_SYM) - 1), value,
+                                (uint8_t)decimals, FIXED_FORMAT_SPACE_SIGN);
+  memcpy(buf + n, DEG_SYM, sizeof(DEG_SYM));
+}
+
 static void update_status_label()
 {
   static char last[72] = "";
   char buf[72];
   const char *orientation_text =
     (orientationMode == MODE_SCREEN_VERTICAL) ? "VERT" : "UP";
-  snprintf(buf, sizeof(buf), "%s | %s | R%d | %s%s",
+  snprintf(buf, sizeof(buf), "%s | %s | R%d | %s%s%s",
            orientation_text,
            axis_mode_text(),
            displayRotated ? 180 : 0,
            measurementIsFrozen() ? "HOLD" : "LIVE",
+           (wifiRadioOnDemand() && wifiRadioIsOn()) ? " | WIFI" : "",
            rollConditionIsLow() ? " | !" : "");
 
   if (strcmp(buf, last) != 0) {
@@ -287,13 +381,23 @@ static void update_battery_label()
     lv_obj_align(label_battery, LV_ALIGN_TOP_RIGHT, -4, 6);
   } else if (battery.present_inferred && !battery.present) {
     const int soc = (int)lroundf(battery.soc_percent);
-    snprintf(buf, sizeof(buf), "BAT? %d%% %.1f V", soc, battery.voltage_v);
+    char volts[12];
+    fixed_format(volts, sizeof(volts), battery.voltage_v, 1);
+    snprintf(buf, sizeof(buf), "BAT? %d%% %s V", soc, volts);
     lv_obj_set_style_text_color(label_battery, lv_color_hex(0xE6B86A), 0);
     lv_obj_add_flag(label_battery_charge, LV_OBJ_FLAG_HIDDEN);
     lv_obj_align(label_battery, LV_ALIGN_TOP_RIGHT, -4, 6);
   } else {
     const int soc = (int)lroundf(battery.soc_percent);
-    snprintf(buf, sizeof(buf), "BAT %d%% %.1f V", soc, battery.voltage_v);
+    char volts[12];
+    fixed_format(volts, sizeof(volts), battery.voltage_v, 1);
+    if (!battery.charging && battery.tte_h > 0.0f) {
+      // Time to empty at the present load, whole minutes.
+      const unsigned long tte_min = (unsigned long)lroundf(battery.tte_h * 60.0f);
+      snprintf(buf, sizeof(buf), "BAT %d%% %s V %luh%02lu", soc, volts, tte_min / 60UL, tte_min % 60UL);
+    } else {
+      snprintf(buf, sizeof(buf), "BAT %d%% %s V", soc, volts);
+    }
     lv_obj_set_style_text_color(
       label_battery,
       battery.charging ? lv_color_hex(0x6FD3FF) : lv_color_hex(0x9BD8A7),
@@ -318,6 +422,7 @@ static void update_battery_label()
 
 static void update_alignment_instruction()
 {
+  if (!label_instruction) return;
   char buf[128];
   alignmentGetInstruction(buf, sizeof(buf));
   lv_label_set_text(label_instruction, buf);
@@ -332,13 +437,13 @@ static void set_readout_hint_overlay(bool hint_visible)
   if (hint_visible) {
     lv_obj_add_flag(label_roll, LV_OBJ_FLAG_HIDDEN);
     lv_obj_add_flag(label_pitch, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(label_roll_value, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(label_pitch_value, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(readout_roll_value, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(readout_pitch_value, LV_OBJ_FLAG_HIDDEN);
   } else {
     lv_obj_clear_flag(label_roll, LV_OBJ_FLAG_HIDDEN);
     lv_obj_clear_flag(label_pitch, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(label_roll_value, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(label_pitch_value, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(readout_roll_value, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(readout_pitch_value, LV_OBJ_FLAG_HIDDEN);
   }
 }
 
@@ -357,13 +462,12 @@ static void update_boot_hint_label()
 {
   static char last[96] = "";
   char buf[96] = "";
-  const uint32_t now_ms = millis();
+  const uint32_t now_ms = lv_tick_get();
   int progress_pct = -1;
 
   if (ui_state == UI_STATE_ALIGN) {
     if (!alignmentCaptureInProgress()) {
-      lv_obj_add_flag(boot_hint_box, LV_OBJ_FLAG_HIDDEN);
-      lv_obj_add_flag(boot_hint_progress, LV_OBJ_FLAG_HIDDEN);
+      hide_hint_strip();
       set_readout_hint_overlay(false);
       last[0] = '\0';
       return;
@@ -477,8 +581,7 @@ static void update_boot_hint_label()
       progress_pct = (int)((hold_ms * 100UL) / SIMPLE_VIEW_LONG_HOLD_MS);
     }
   } else if (!bootHoldIsActive()) {
-    lv_obj_add_flag(boot_hint_box, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(boot_hint_progress, LV_OBJ_FLAG_HIDDEN);
+    hide_hint_strip();
     set_readout_hint_overlay(false);
     last[0] = '\0';
     return;
@@ -523,7 +626,8 @@ static void update_boot_hint_label()
     }
   }
 
-  if (strcmp(last, buf) != 0) {
+  const bool created = ensure_hint_strip();
+  if (created || strcmp(last, buf) != 0) {
     lv_label_set_text(label_boot_hint, buf);
     strncpy(last, buf, sizeof(last) - 1);
     last[sizeof(last) - 1] = '\0';
@@ -546,6 +650,8 @@ static void update_boot_hint_label()
 
 static float ui_roll_smooth  = 0.0f;
 static float ui_pitch_smooth = 0.0f;
+// IMU read time of the angles behind the readout (0 while frozen).
+static uint32_t ui_sample_us = 0;
 
 constexpr float EMA_ALPHA = 0.15f;
 constexpr float DEAD_BAND = 0.05f;
@@ -567,31 +673,21 @@ static lv_color_t angle_color(float v)
   if (a >= WARN_LIMIT) return lv_color_hex(0xFFBF00);
   return lv_color_white();
 }
-
-// ============================================================
-// LVGL FLUSH CALLBACK
-// ============================================================
-
-void my_disp_flush(lv_disp_drv_t *disp_drv,
-                   const lv_area_t *area,
-                   lv_color_t *color_p)
-{
-  gfx->draw16bitRGBBitmap(
-    area->x1,
-    area->y1,
-    (uint16_t *)color_p,
-    area->x2 - area->x1 + 1,
-    area->y2 - area->y1 + 1
-  );
-  lv_disp_flush_ready(disp_drv);
-}
-
 // ============================================================
 // UI POLICY LAYER
 // ============================================================
 
 static void apply_axis_layout()
 {
+  if (trend_view_active && ui_state == UI_STATE_NORMAL) {
+    lv_obj_add_flag(roll_grp,  LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(pitch_grp, LV_OBJ_FLAG_HIDDEN);
+    ensure_trend_view();
+    update_status_label();
+    return;
+  }
+  release_trend_view();
+
   switch (ui_axis_mode) {
 
     case AXIS_BOTH:
@@ -647,16 +743,6 @@ static void apply_touch_layout_mode(void)
   }
 }
 
-static void set_touch_layout_mode_local(TouchUiLayoutMode mode, bool persist)
-{
-  if (mode == active_touch_ui_layout) return;
-  active_touch_ui_layout = mode;
-  if (persist) {
-    setTouchUiLayoutMode(mode);
-  }
-  apply_ui_state();
-}
-
 static void apply_ui_state()
 {
   apply_touch_layout_mode();
@@ -665,9 +751,8 @@ static void apply_ui_state()
 
     case UI_STATE_NORMAL:
       lv_obj_clear_flag(label_mode, LV_OBJ_FLAG_HIDDEN);
-      lv_obj_add_flag(boot_hint_box, LV_OBJ_FLAG_HIDDEN);
-      lv_obj_add_flag(label_header, LV_OBJ_FLAG_HIDDEN);
-      lv_obj_add_flag(instr_grp,    LV_OBJ_FLAG_HIDDEN);
+      hide_hint_strip();
+      release_instruction_panel();
 
       lv_label_set_text(label_btn_zero,  "ZERO");
       lv_label_set_text(label_btn_mode,
@@ -684,16 +769,15 @@ static void apply_ui_state()
       break;
 
     case UI_STATE_ALIGN:
-      modeWorkflowCancel();
       lv_obj_add_flag(label_mode, LV_OBJ_FLAG_HIDDEN);
-      lv_obj_add_flag(boot_hint_box, LV_OBJ_FLAG_HIDDEN);
-      lv_obj_add_flag(label_header, LV_OBJ_FLAG_HIDDEN);
+      hide_hint_strip();
 
+      ensure_instruction_panel();
       update_alignment_instruction();
-      lv_obj_clear_flag(instr_grp, LV_OBJ_FLAG_HIDDEN);
 
       lv_obj_add_flag(roll_grp,  LV_OBJ_FLAG_HIDDEN);
       lv_obj_add_flag(pitch_grp, LV_OBJ_FLAG_HIDDEN);
+      release_trend_view();
 
       lv_label_set_text(label_btn_zero,  "CANCEL");
       lv_label_set_text(label_btn_align, "CAPTURE");
@@ -707,8 +791,7 @@ static void apply_ui_state()
 
     case UI_STATE_ZERO:
       lv_obj_clear_flag(label_mode, LV_OBJ_FLAG_HIDDEN);
-      lv_obj_add_flag(label_header, LV_OBJ_FLAG_HIDDEN);
-      lv_obj_add_flag(instr_grp, LV_OBJ_FLAG_HIDDEN);
+      release_instruction_panel();
 
       lv_label_set_text(label_btn_zero, "CANCEL");
       lv_label_set_text(label_btn_mode, "CONFIRM");
@@ -725,8 +808,7 @@ static void apply_ui_state()
 
     case UI_STATE_OFFSET_CAL:
       lv_obj_clear_flag(label_mode, LV_OBJ_FLAG_HIDDEN);
-      lv_obj_add_flag(label_header, LV_OBJ_FLAG_HIDDEN);
-      lv_obj_add_flag(instr_grp, LV_OBJ_FLAG_HIDDEN);
+      release_instruction_panel();
 
       lv_label_set_text(label_btn_zero, "CANCEL");
       lv_label_set_text(label_btn_mode, "CONFIRM");
@@ -767,14 +849,20 @@ void cycleMode(void)
 void cycleAxisMode(void)
 {
   setAxisDisplayMode((AxisDisplayMode)((ui_axis_mode + 1) % 3));
+  display_lock(DISPLAY_LOCK_WAIT_FOREVER);
   if (ui_state == UI_STATE_NORMAL) {
     apply_axis_layout();
   }
+  display_unlock();
 }
 
 // ============================================================
 // BUTTON CALLBACKS
 // ============================================================
+//
+// These run on the LVGL task. Anything that changes workflow, calibration or
+// EEPROM state is posted to the sensor loop (postUiCommand); ui_state then
+// follows the shared workflow state in update_ui().
 
 static void on_zero_pressed(lv_event_t *)
 {
@@ -784,23 +872,13 @@ static void on_zero_pressed(lv_event_t *)
   }
 
   if (ui_state == UI_STATE_ZERO) {
-    zeroWorkflowCancel();
-    ui_set_state(UI_STATE_NORMAL);
-    return;
-  }
-  if (ui_state == UI_STATE_OFFSET_CAL) {
-    offsetCalibrationWorkflowCancel();
-    ui_set_state(UI_STATE_NORMAL);
-    return;
-  }
-
-  if (ui_state == UI_STATE_NORMAL) {
-    zeroWorkflowStart();
-    ui_set_state(UI_STATE_ZERO);
-  }
-  else {
-    alignmentCancel();
-    ui_set_state(UI_STATE_NORMAL);
+    postUiCommand(UI_CMD_ZERO_CANCEL);
+  } else if (ui_state == UI_STATE_OFFSET_CAL) {
+    postUiCommand(UI_CMD_OFFSET_CAL_CANCEL);
+  } else if (ui_state == UI_STATE_NORMAL) {
+    postUiCommand(UI_CMD_ZERO_START);
+  } else {
+    postUiCommand(UI_CMD_ALIGN_CANCEL);
   }
 }
 
@@ -808,47 +886,30 @@ static void on_zero_long_pressed(lv_event_t *)
 {
   if (ui_state != UI_STATE_NORMAL) return;
   zero_long_press_handled = true;
-  modeWorkflowCancel();
-  offsetCalibrationWorkflowStart();
-  ui_set_state(UI_STATE_OFFSET_CAL);
+  postUiCommand(UI_CMD_OFFSET_CAL_START);
 }
 
 static void on_axis_pressed(lv_event_t *)
 {
   if (ui_state != UI_STATE_NORMAL) return;
   if (active_touch_ui_layout == TOUCH_UI_SIMPLE) return;
-  modeWorkflowCancel();
-  zeroWorkflowCancel();
-  offsetCalibrationWorkflowCancel();
-  cycleAxisMode();
+  postUiCommand(UI_CMD_AXIS_CYCLE);
 }
 
 static void handle_mode_tap_action(void)
 {
   if (ui_state == UI_STATE_NORMAL) {
-    modeWorkflowStartToggle();
-    ui_set_state(UI_STATE_NORMAL);
-    return;
-  }
-
-  if (ui_state == UI_STATE_OFFSET_CAL) {
-    if (!offsetCalibrationWorkflowIsConfirmed()) {
-      offsetCalibrationWorkflowConfirm();
-    }
-    return;
-  }
-
-  if (ui_state == UI_STATE_ZERO) {
-    if (!zeroWorkflowIsConfirmed()) {
-      zeroWorkflowConfirm();
-    }
-    return;
+    postUiCommand(UI_CMD_MODE_TOGGLE);
+  } else if (ui_state == UI_STATE_OFFSET_CAL) {
+    postUiCommand(UI_CMD_OFFSET_CAL_CONFIRM);
+  } else if (ui_state == UI_STATE_ZERO) {
+    postUiCommand(UI_CMD_ZERO_CONFIRM);
   }
 }
 
 static void on_mode_pressed(lv_event_t *)
 {
-  mode_btn_press_start_ms = millis();
+  mode_btn_press_start_ms = lv_tick_get();
   mode_btn_press_active = true;
 }
 
@@ -859,28 +920,23 @@ static void on_mode_pressing(lv_event_t *)
 
 static void on_mode_released(lv_event_t *)
 {
-  const uint32_t elapsed = millis() - mode_btn_press_start_ms;
+  const uint32_t elapsed = lv_tick_get() - mode_btn_press_start_ms;
   mode_btn_press_active = false;
 
   if (ui_state == UI_STATE_NORMAL && elapsed >= SIMPLE_VIEW_LONG_HOLD_MS) {
-    const TouchUiLayoutMode next =
-      (active_touch_ui_layout == TOUCH_UI_SIMPLE) ? TOUCH_UI_ADVANCED : TOUCH_UI_SIMPLE;
-    set_touch_layout_mode_local(next, true);
+    postUiCommand((active_touch_ui_layout == TOUCH_UI_SIMPLE) ? UI_CMD_LAYOUT_ADVANCED : UI_CMD_LAYOUT_SIMPLE);
     return;
   }
 
   if (active_touch_ui_layout == TOUCH_UI_SIMPLE &&
       ui_state == UI_STATE_NORMAL &&
       elapsed >= SIMPLE_VIEW_MEDIUM_HOLD_MS) {
-    cycleMode();
+    postUiCommand(UI_CMD_ORIENTATION_CYCLE);
     return;
   }
 
   if (active_touch_ui_layout == TOUCH_UI_SIMPLE && ui_state == UI_STATE_NORMAL) {
-    modeWorkflowCancel();
-    zeroWorkflowCancel();
-    offsetCalibrationWorkflowCancel();
-    cycleAxisMode();
+    postUiCommand(UI_CMD_AXIS_CYCLE);
     return;
   }
 
@@ -890,40 +946,52 @@ static void on_mode_released(lv_event_t *)
 static void on_readout_pressed(lv_event_t *)
 {
   if (ui_state != UI_STATE_NORMAL) return;
-  modeWorkflowCancel();
-  zeroWorkflowCancel();
-  offsetCalibrationWorkflowCancel();
-  toggleMeasurementFreeze();
+  postUiCommand(UI_CMD_FREEZE_TOGGLE);
+}
+
+static void on_readout_long_pressed(lv_event_t *)
+{
+  if (ui_state != UI_STATE_NORMAL) return;
+  // Swallow the rest of this press so its release does not toggle freeze.
+  lv_indev_wait_release(lv_indev_get_act());
+  trend_view_active = true;
+  apply_axis_layout();
+}
+
+static void on_trend_pressed(lv_event_t *)
+{
+  trend_view_active = false;
+  apply_axis_layout();
 }
 
 static void on_align_pressed(lv_event_t *)
 {
   if (ui_state == UI_STATE_NORMAL) {
-    modeWorkflowCancel();
-    zeroWorkflowCancel();
-    offsetCalibrationWorkflowCancel();
-    alignmentStart();
-    if (alignmentIsActive()) ui_set_state(UI_STATE_ALIGN);
+    postUiCommand(UI_CMD_ALIGN_START);
   } else if (ui_state == UI_STATE_ALIGN) {
-    alignmentCapture();
-    if (alignmentIsActive()) {
-      update_alignment_instruction();
-    } else {
-      ui_set_state(UI_STATE_NORMAL);
-    }
+    postUiCommand(UI_CMD_ALIGN_CAPTURE);
   }
 }
 
 static void on_rotate_pressed(lv_event_t *)
 {
+  if (rotate_long_press_handled) {
+    rotate_long_press_handled = false;
+    return;
+  }
   if (ui_state == UI_STATE_NORMAL) {
-    modeWorkflowCancel();
-    zeroWorkflowCancel();
-    offsetCalibrationWorkflowCancel();
-    toggleRotation();
+    postUiCommand(UI_CMD_ROTATE);
   }
 }
 
+// Long press on ROTATE: start Wi-Fi (radio on demand) or restart its idle timer.
+static void on_rotate_long_pressed(lv_event_t *)
+{
+  if (ui_state != UI_STATE_NORMAL) return;
+  rotate_long_press_handled = true;
+  wifiRadioRequest();
+}
+
 // ============================================================
 // UI CREATION
 // ============================================================
@@ -968,78 +1036,6 @@ static void create_ui()
   lv_obj_align(label_battery_charge, LV_ALIGN_TOP_RIGHT, -4, 6);
   lv_obj_add_flag(label_battery_charge, LV_OBJ_FLAG_HIDDEN);
 
-  // Modal header (hidden normally)
-  label_header = lv_label_create(scr);
-  lv_label_set_text(label_header, "");
-  lv_obj_set_style_text_font(label_header, &lv_font_montserrat_24, 0);
-  lv_obj_set_style_text_color(label_header, lv_color_white(), 0);
-  lv_obj_align(label_header, LV_ALIGN_TOP_MID, 0, 6);
-  lv_obj_add_flag(label_header, LV_OBJ_FLAG_HIDDEN);
-
-  boot_hint_box = lv_obj_create(scr);
-  lv_obj_set_size(boot_hint_box, lv_pct(96), BOOT_HINT_H);
-  lv_obj_align(boot_hint_box, LV_ALIGN_BOTTOM_MID, 0, BOOT_HINT_Y_FROM_BOTTOM);
-  lv_obj_set_style_bg_color(boot_hint_box, lv_color_black(), 0);
-  lv_obj_set_style_bg_opa(boot_hint_box, LV_OPA_80, 0);
-  lv_obj_set_style_border_width(boot_hint_box, 0, 0);
-  lv_obj_set_style_radius(boot_hint_box, 8, 0);
-  lv_obj_set_style_pad_all(boot_hint_box, 1, 0);
-  lv_obj_clear_flag(boot_hint_box, LV_OBJ_FLAG_SCROLLABLE);
-
-  label_boot_hint = lv_label_create(boot_hint_box);
-  lv_label_set_text(label_boot_hint, "");
-  lv_obj_set_style_text_font(label_boot_hint, &lv_font_montserrat_24, 0);
-  lv_obj_set_style_text_color(label_boot_hint, lv_color_hex(0xE6F5FF), 0);
-  lv_obj_set_style_text_align(label_boot_hint, LV_TEXT_ALIGN_CENTER, 0);
-  lv_label_set_long_mode(label_boot_hint, LV_LABEL_LONG_WRAP);
-  lv_obj_set_width(label_boot_hint, lv_pct(100));
-  lv_obj_align(label_boot_hint, LV_ALIGN_TOP_MID, 0, 0);
-
-  boot_hint_progress = lv_bar_create(boot_hint_box);
-  lv_obj_set_size(boot_hint_progress, lv_pct(72), 5);
-  lv_obj_align(boot_hint_progress, LV_ALIGN_BOTTOM_MID, 0, 0);
-  lv_bar_set_range(boot_hint_progress, 0, 100);
-  lv_bar_set_value(boot_hint_progress, 0, LV_ANIM_OFF);
-  lv_obj_set_style_bg_color(boot_hint_progress, lv_color_hex(0x3A3A3A), LV_PART_MAIN);
-  lv_obj_set_style_bg_opa(boot_hint_progress, LV_OPA_70, LV_PART_MAIN);
-  lv_obj_set_style_bg_color(boot_hint_progress, lv_color_hex(0x6FD3FF), LV_PART_INDICATOR);
-  lv_obj_set_style_bg_opa(boot_hint_progress, LV_OPA_90, LV_PART_INDICATOR);
-  lv_obj_set_style_radius(boot_hint_progress, 3, LV_PART_MAIN);
-  lv_obj_set_style_radius(boot_hint_progress, 3, LV_PART_INDICATOR);
-  lv_obj_add_flag(boot_hint_progress, LV_OBJ_FLAG_HIDDEN);
-  lv_obj_add_flag(boot_hint_box, LV_OBJ_FLAG_HIDDEN);
-
-  // ==========================================================
-  // INSTRUCTION GROUP (modal, centered)
-  // ==========================================================
-
-  instr_grp = lv_obj_create(scr);
-  lv_obj_set_width(instr_grp, lv_pct(94));
-  lv_obj_align(instr_grp, LV_ALIGN_CENTER, 0, -34);
-  lv_obj_set_flex_flow(instr_grp, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_flex_align(instr_grp,
-                        LV_FLEX_ALIGN_CENTER,
-                        LV_FLEX_ALIGN_CENTER,
-                        LV_FLEX_ALIGN_CENTER);
-
-  lv_obj_set_style_bg_color(instr_grp, lv_color_black(), 0);
-  lv_obj_set_style_bg_opa(instr_grp, LV_OPA_80, 0);
-  lv_obj_set_style_border_width(instr_grp, 0, 0);
-  lv_obj_set_style_pad_all(instr_grp, 8, 0);
-
-  lv_obj_clear_flag(instr_grp, LV_OBJ_FLAG_SCROLLABLE);
-  lv_obj_set_scrollbar_mode(instr_grp, LV_SCROLLBAR_MODE_OFF);
-
-  label_instruction = lv_label_create(instr_grp);
-  lv_obj_set_width(label_instruction, lv_pct(100));
-  lv_label_set_text(label_instruction, "");
-  lv_label_set_long_mode(label_instruction, LV_LABEL_LONG_WRAP);
-  lv_obj_set_style_text_font(label_instruction, &lv_font_montserrat_24, 0);
-  lv_obj_set_style_text_color(label_instruction, lv_color_hex(0xE0E0E0), 0);
-  lv_obj_set_style_text_align(label_instruction, LV_TEXT_ALIGN_CENTER, 0);
-
-  lv_obj_add_flag(instr_grp, LV_OBJ_FLAG_HIDDEN);
-
   // ==========================================================
   // MAIN INSTRUMENT READOUT AREA
   // ==========================================================
@@ -1065,11 +1061,8 @@ static void create_ui()
   lv_obj_set_style_text_color(label_roll, lv_color_hex(0xD0D0D0), 0);
   lv_obj_set_style_text_align(label_roll, LV_TEXT_ALIGN_CENTER, 0);
 
-  label_roll_value = lv_label_create(roll_grp);
-  lv_obj_set_width(label_roll_value, lv_pct(100));
-  lv_label_set_long_mode(label_roll_value, LV_LABEL_LONG_CLIP);
-  lv_obj_set_style_text_font(label_roll_value, &lv_font_montserrat_56_num, 0);
-  lv_obj_set_style_text_align(label_roll_value, LV_TEXT_ALIGN_CENTER, 0);
+  // Value readouts blit changed digit cells only (see readout_widget.cpp).
+  readout_roll_value = readout_widget_create(roll_grp, &lv_font_montserrat_56_num);
 
   // --- Pitch ---
   pitch_grp = lv_obj_create(scr);
@@ -1092,11 +1085,7 @@ static void create_ui()
   lv_obj_set_style_text_color(label_pitch, lv_color_hex(0xD0D0D0), 0);
   lv_obj_set_style_text_align(label_pitch, LV_TEXT_ALIGN_CENTER, 0);
 
-  label_pitch_value = lv_label_create(pitch_grp);
-  lv_obj_set_width(label_pitch_value, lv_pct(100));
-  lv_label_set_long_mode(label_pitch_value, LV_LABEL_LONG_CLIP);
-  lv_obj_set_style_text_font(label_pitch_value, &lv_font_montserrat_56_num, 0);
-  lv_obj_set_style_text_align(label_pitch_value, LV_TEXT_ALIGN_CENTER, 0);
+  readout_pitch_value = readout_widget_create(pitch_grp, &lv_font_montserrat_56_num);
 
   // ==========================================================
   // BOTTOM CONTROL AREA (fixed, no reflow)
@@ -1237,8 +1226,11 @@ static void create_ui()
   lv_obj_add_event_cb(btn_mode,   on_mode_released,  LV_EVENT_RELEASED, NULL);
   lv_obj_add_event_cb(btn_align,  on_align_pressed,  LV_EVENT_CLICKED, NULL);
   lv_obj_add_event_cb(btn_rotate, on_rotate_pressed, LV_EVENT_CLICKED, NULL);
+  lv_obj_add_event_cb(btn_rotate, on_rotate_long_pressed, LV_EVENT_LONG_PRESSED, NULL);
   lv_obj_add_event_cb(roll_grp,   on_readout_pressed, LV_EVENT_CLICKED, NULL);
   lv_obj_add_event_cb(pitch_grp,  on_readout_pressed, LV_EVENT_CLICKED, NULL);
+  lv_obj_add_event_cb(roll_grp,   on_readout_long_pressed, LV_EVENT_LONG_PRESSED, NULL);
+  lv_obj_add_event_cb(pitch_grp,  on_readout_long_pressed, LV_EVENT_LONG_PRESSED, NULL);
 }
 
 // ============================================================
@@ -1295,12 +1287,25 @@ static void update_ui()
   if (frozen) {
     ui_roll_smooth = frozen_display_roll;
     ui_pitch_smooth = frozen_display_pitch;
+    ui_sample_us = 0;
   } else {
-    ui_roll_smooth  = smooth_value(ui_roll_smooth,  ui_roll);
-    ui_pitch_smooth = smooth_value(ui_pitch_smooth, ui_pitch);
+    float roll_in = 0.0f;
+    float pitch_in = 0.0f;
+    getUiAngles(&roll_in, &pitch_in, &ui_sample_us);
+    ui_roll_smooth  = smooth_value(ui_roll_smooth,  roll_in);
+    ui_pitch_smooth = smooth_value(ui_pitch_smooth, pitch_in);
   }
   last_frozen = frozen;
 
+  // History keeps filling while the trend view is closed; drawing only touches
+  // the columns appended since the last pass.
+  trend_buffer_push(&angle_trend, ui_roll_smooth, ui_pitch_smooth);
+  if (trend_view) {
+    trend_widget_sync(trend_view);
+  } else if (trend_heap_probe.close_pending) {
+    lazy_heap_close(&trend_heap_probe);
+  }
+
   update_status_label();
   update_battery_label();
 
@@ -1312,174 +1317,55 @@ static void update_ui()
   char buf[20];
   const int decimals = readout_decimals();
 
-  snprintf(buf, sizeof(buf), "% .*f%s", decimals, ui_roll_smooth, DEG_SYM);
+  format_angle(buf, sizeof(buf), ui_roll_smooth, decimals);
   if (strcmp(buf, last_r)) {
-    lv_label_set_text(label_roll_value, buf);
-    lv_obj_set_style_text_color(label_roll_value,
-      angle_color(ui_roll_smooth), 0);
+    readout_widget_set_text(readout_roll_value, buf, angle_color(ui_roll_smooth));
     strcpy(last_r, buf);
   }
 
-  snprintf(buf, sizeof(buf), "% .*f%s", decimals, ui_pitch_smooth, DEG_SYM);
+  format_angle(buf, sizeof(buf), ui_pitch_smooth, decimals);
   if (strcmp(buf, last_p)) {
-    lv_label_set_text(label_pitch_value, buf);
-    lv_obj_set_style_text_color(label_pitch_value,
-      angle_color(ui_pitch_smooth), 0);
+    readout_widget_set_text(readout_pitch_value, buf, angle_color(ui_pitch_smooth));
     strcpy(last_p, buf);
   }
 }
 
-// ============================================================
-// DISPLAY SETUP / LOOP
-// ============================================================
 
-void setup_display()
+float get_display_roll(void)
 {
-  const esp_reset_reason_t reset_reason = esp_reset_reason();
-  const bool woke_from_deep_sleep = (reset_reason == ESP_RST_DEEPSLEEP);
-  if (woke_from_deep_sleep) {
-    // Deep-sleep wake can leave panel rails/logic in a slow-recovering state.
-    // Hard-reset the panel before begin() to make splash rendering deterministic.
-    pinMode(LCD_RST, OUTPUT);
-    digitalWrite(LCD_RST, LOW);
-    delay(panelDeepSleepResetLowMs);
-    digitalWrite(LCD_RST, HIGH);
-    delay(panelDeepSleepResetHighSettleMs);
-  }
+  return ui_roll_smooth;
+}
 
-  bool ok = false;
-  for (uint32_t i = 0; i < panelDeepSleepBeginRetryCount && !ok; i++) {
-    ok = gfx->begin();
-    if (!ok) {
-      delay(panelDeepSleepBeginRetryDelayMs);
-    }
-  }
-  if (ok) {
-    gfx->displayOn();
-    last_applied_brightness_percent = 0xFF;
-    apply_display_brightness();
-    delay(woke_from_deep_sleep ? panelWakeSettleMs : panelColdSettleMs);
-    // Clear once so first splash frame is not dropped on sleepy panel state.
-    gfx->fillScreen(0x0000);
-    delay(10);
-    if (woke_from_deep_sleep) {
-      // Defer wake splash until loop phase, after panel and LVGL are fully settled.
-      splash_deferred_until_first_loop = true;
-      splash_deferred_due_ms = millis() + splashDeferredDelayMs;
-    } else {
-      show_startup_splash();
-    }
-  }
-  lv_init();
-
-  buf1 = (lv_color_t *)heap_caps_malloc(
-    LCD_WIDTH * 60 * sizeof(lv_color_t),
-    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-
-  buf2 = (lv_color_t *)heap_caps_malloc(
-    LCD_WIDTH * 60 * sizeof(lv_color_t),
-    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-
-  lv_disp_draw_buf_init(&draw_buf, buf1, buf2, LCD_WIDTH * 60);
-
-  static lv_disp_drv_t disp_drv;
-  lv_disp_drv_init(&disp_drv);
-  disp_drv.hor_res = LCD_WIDTH;
-  disp_drv.ver_res = LCD_HEIGHT;
-  disp_drv.flush_cb = my_disp_flush;
-  disp_drv.draw_buf = &draw_buf;
-  disp_drv.sw_rotate = 1;
-  disp_handle = lv_disp_drv_register(&disp_drv);
-  lv_disp_set_rotation(
-    disp_handle,
-    displayRotated ? LV_DISP_ROT_180 : LV_DISP_ROT_NONE
-  );
+float get_display_pitch(void)
+{
+  return ui_pitch_smooth;
+}
 
-  // ==========================================================
-  // TOUCH INPUT DEVICE (LVGL)
-  // ==========================================================
-  static lv_indev_drv_t indev_drv;
-  lv_indev_drv_init(&indev_drv);
-  indev_drv.type = LV_INDEV_TYPE_POINTER;
-  indev_drv.read_cb = touch_read_cb;
-  lv_indev_drv_register(&indev_drv);
+// ============================================================
+// UI LAYER ENTRY POINTS
+// ============================================================
 
+void ui_build(void)
+{
   active_touch_ui_layout = getTouchUiLayoutMode();
+  trend_buffer_init(&angle_trend, TREND_DECIMATION);
   create_ui();
   apply_ui_state();
   update_status_label();
 }
 
-void displayPrepareForDeepSleep(void)
+void ui_refresh(void)
 {
-  if (!gfx) return;
-  // Push black once before panel sleep for a clean visual transition.
-  gfx->fillScreen(0x0000);
-  delay(20);
-  gfx->displayOff();
+  update_ui();
 }
 
-void loop_display()
+uint32_t ui_displayed_sample_us(void)
 {
-  static uint32_t last_tick = 0;
-  static uint32_t last_ui   = 0;
-  static int last_rotation = -1;
-  static bool panel_wake_ensured = false;
-
-  uint32_t now = millis();
-  int desired_rotation = displayRotated ? 1 : 0;
-  apply_display_brightness();
-
-  if (!panel_wake_ensured && gfx) {
-    gfx->displayOn();
-    panel_wake_ensured = true;
-  }
-
-  if (splash_deferred_until_first_loop && gfx && (int32_t)(now - splash_deferred_due_ms) >= 0) {
-    gfx->displayOn();
-    delay(panelWakeSplashPreDelayMs);
-    show_startup_splash();
-    splash_deferred_until_first_loop = false;
-    const uint32_t t = millis();
-    last_tick = t;
-    last_ui = t;
-  }
-
-  if (last_rotation != desired_rotation) {
-    if (disp_handle) {
-      lv_disp_set_rotation(
-        disp_handle,
-        displayRotated ? LV_DISP_ROT_180 : LV_DISP_ROT_NONE
-      );
-    }
-    last_rotation = desired_rotation;
-  }
-
-  if (last_tick == 0) {
-    last_tick = now;
-  }
-  uint32_t tick_elapsed = now - last_tick;
-  if (tick_elapsed > 0) {
-    lv_tick_inc(tick_elapsed);
-    last_tick = now;
-  }
-
-  lv_timer_handler();
-
-  if (now - last_ui >= 50) {
-    update_ui();
-    last_ui = now;
-  }
-
-  delay(5);
-}
-
-float get_display_roll(void)
-{
-  return ui_roll_smooth;
+  return ui_sample_us;
 }
 
-float get_display_pitch(void)
+void ui_lazy_heap_stats(UiLazyHeapStats *align_panel, UiLazyHeapStats *trend)
 {
-  return ui_pitch_smooth;
+  if (align_panel) *align_panel = align_heap_probe.stats;
+  if (trend) *trend = trend_heap_probe.stats;
 }
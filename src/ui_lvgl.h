@@ -1,9 +1,62 @@
 #pragma once
 
 #include <lvgl.h>
+#include "display_power_policy.h"
 
 // Public UI entry points
 void setup_display(void);
-void loop_display(void);
 float get_display_roll(void);
 float get_display_pitch(void);
+
+// UI layer (ui_lvgl.cpp). Hardware-free: called by the display task.
+void ui_build(void);          // create widgets on the active screen
+void ui_refresh(void);        // pull shared state into the widgets
+uint32_t ui_displayed_sample_us(void);  // IMU sample time behind the last ui_refresh(), 0 = none
+
+// LVGL heap left in use by build + release cycles of one on-demand tree
+// (ALIGN panel, trend view). Stays near 0; growth from cycle to cycle is a leak.
+struct UiLazyHeapStats {
+  uint32_t round_trips;
+  int32_t last_delta;   // bytes, last cycle
+  int32_t max_delta;    // bytes, worst cycle since boot
+};
+// Caller holds the display lock (or is the display task).
+void ui_lazy_heap_stats(UiLazyHeapStats *align_panel, UiLazyHeapStats *trend);
+
+// LVGL runs in its own task (started by setup_display). Any code outside that
+// task that touches LVGL objects or the panel must hold the display lock.
+// The lock is recursive.
+#define DISPLAY_LOCK_WAIT_FOREVER 0xFFFFFFFFUL
+bool display_lock(uint32_t timeout_ms);
+void display_unlock(void);
+
+// Render-rate governor telemetry
+struct DisplayRenderStats {
+  float fps;               // refreshes per second over the last window
+  float frame_ms_avg;      // render+flush time per refresh, last window
+  float frame_ms_max;      // worst refresh in the last window
+  uint32_t frames_total;   // refreshes since boot
+  uint8_t target_fps;      // active-rate target
+  uint8_t idle_fps;        // rate used while nothing changes
+  bool active;             // governor currently at the active rate
+  bool direct_mode;        // PSRAM full-frame mode with diff-based pushes
+  uint32_t px_invalidated; // pixels LVGL redrew in the last window
+  uint32_t px_pushed;      // pixels actually sent to the panel
+  DisplayPowerState power_state;                       // idle policy state
+  uint32_t power_state_s[DISPLAY_POWER_STATE_COUNT];   // time per state since boot
+  uint8_t brightness_percent;                         // brightness driven right now (0 = off)
+  // LVGL heap (lv_mem_monitor), sampled once per stats window
+  uint32_t lv_mem_total;             // pool size
+  uint32_t lv_mem_used;
+  uint32_t lv_mem_free;
+  uint32_t lv_mem_largest_free;      // biggest free block right now
+  uint32_t lv_mem_largest_free_min;  // lowest biggest-free-block since boot
+  uint32_t lv_mem_max_used;          // high-water mark since boot
+  uint8_t lv_mem_frag_pct;
+  bool lv_mem_psram;                 // pool allocated from PSRAM
+  UiLazyHeapStats ui_align_heap;     // ALIGN panel build/release cycles
+  UiLazyHeapStats ui_trend_heap;     // trend view open/close cycles
+  uint32_t internal_free;            // internal SRAM left for Wi-Fi/lwIP/DMA
+  uint32_t internal_largest_free;
+};
+void getDisplayRenderStats(DisplayRenderStats *out_stats);
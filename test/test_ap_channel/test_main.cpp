@@ -0,0 +1,65 @@
+#include <unity.h>
+
+#include "ap_channel.h"
+
+namespace {
+
+float load[AP_CHANNEL_MAX + 1];
+
+}  // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_ap_channel_empty_site_prefers_channel_1() {
+  ap_channel_score(nullptr, 0, AP_CHANNEL_AUTO_MAX, load);
+  TEST_ASSERT_EQUAL_UINT8(1, ap_channel_pick(load, AP_CHANNEL_AUTO_MAX));
+}
+
+void test_ap_channel_avoids_busy_channels_and_their_neighbours() {
+  const ApChannelObservation obs[] = {
+    {1, -45}, {1, -60}, {2, -70}, {6, -50}, {7, -65},
+  };
+  ap_channel_score(obs, sizeof(obs) / sizeof(obs[0]), AP_CHANNEL_AUTO_MAX, load);
+  TEST_ASSERT_TRUE(load[1] > load[6]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, load[11]);
+  TEST_ASSERT_EQUAL_UINT8(11, ap_channel_pick(load, AP_CHANNEL_AUTO_MAX));
+}
+
+void test_ap_channel_weak_network_weighs_less_than_strong() {
+  const ApChannelObservation obs[] = {{1, -92}, {11, -40}};
+  ap_channel_score(obs, 2, AP_CHANNEL_AUTO_MAX, load);
+  TEST_ASSERT_TRUE(load[1] < load[11]);
+  TEST_ASSERT_EQUAL_UINT8(6, ap_channel_pick(load, AP_CHANNEL_AUTO_MAX));
+}
+
+void test_ap_channel_ignores_channels_above_limit() {
+  const ApChannelObservation obs[] = {{1, -50}, {6, -50}, {11, -50}};
+  ap_channel_score(obs, 3, AP_CHANNEL_AUTO_MAX, load);
+  const uint8_t pick = ap_channel_pick(load, AP_CHANNEL_AUTO_MAX);
+  TEST_ASSERT_TRUE(pick >= 1 && pick <= AP_CHANNEL_AUTO_MAX);
+  TEST_ASSERT_TRUE(load[pick] < load[6]);
+}
+
+void test_ap_channel_switch_needs_clear_gain() {
+  const ApChannelObservation obs[] = {{1, -50}, {6, -88}};
+  ap_channel_score(obs, 2, AP_CHANNEL_AUTO_MAX, load);
+  TEST_ASSERT_TRUE(ap_channel_should_switch(load, 1, 11));
+  TEST_ASSERT_FALSE(ap_channel_should_switch(load, 11, 11));
+  TEST_ASSERT_FALSE(ap_channel_should_switch(load, 11, 10));
+  TEST_ASSERT_TRUE(ap_channel_should_switch(load, 0, 11));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_ap_channel_empty_site_prefers_channel_1);
+  RUN_TEST(test_ap_channel_avoids_busy_channels_and_their_neighbours);
+  RUN_TEST(test_ap_channel_weak_network_weighs_less_than_strong);
+  RUN_TEST(test_ap_channel_ignores_channels_above_limit);
+  RUN_TEST(test_ap_channel_switch_needs_clear_gain);
+  return UNITY_END();
+}
@@ -0,0 +1,63 @@
+#include <unity.h>
+
+#include "battery_model.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_battery_model_soc_curve_endpoints_and_interpolation() {
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, battery_model_soc_from_ocv(3.0f));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, battery_model_soc_from_ocv(3.30f));
+  TEST_ASSERT_EQUAL_FLOAT(100.0f, battery_model_soc_from_ocv(4.20f));
+  TEST_ASSERT_EQUAL_FLOAT(100.0f, battery_model_soc_from_ocv(4.35f));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 45.0f, battery_model_soc_from_ocv(3.80f));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 53.5f, battery_model_soc_from_ocv(3.85f));
+}
+
+void test_battery_model_soc_is_monotonic() {
+  float prev = -1.0f;
+  for (int mv = 3200; mv <= 4300; mv += 5) {
+    const float soc = battery_model_soc_from_ocv((float)mv / 1000.0f);
+    TEST_ASSERT_TRUE(soc >= prev);
+    prev = soc;
+  }
+}
+
+void test_battery_model_compensates_load_sag() {
+  // 150 mA through 0.2 ohm sags the cell by 30 mV.
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, 3.83f, battery_model_ocv(3.80f, 150.0f));
+  TEST_ASSERT_EQUAL_FLOAT(3.80f, battery_model_ocv(3.80f, 0.0f));
+  TEST_ASSERT_EQUAL_FLOAT(3.80f, battery_model_ocv(3.80f, -200.0f));
+}
+
+void test_battery_model_same_cell_reads_same_soc_at_any_load() {
+  const float rest_v = 3.90f;
+  const float light_ma = 25.0f;
+  const float heavy_ma = 160.0f;
+  const float light_v = rest_v - light_ma / 1000.0f * BATTERY_MODEL_INTERNAL_OHM;
+  const float heavy_v = rest_v - heavy_ma / 1000.0f * BATTERY_MODEL_INTERNAL_OHM;
+  TEST_ASSERT_FLOAT_WITHIN(0.05f,
+                           battery_model_soc_from_ocv(battery_model_ocv(light_v, light_ma)),
+                           battery_model_soc_from_ocv(battery_model_ocv(heavy_v, heavy_ma)));
+}
+
+void test_battery_model_time_to_empty() {
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 5.0f, battery_model_time_to_empty_h(50.0f, 1000.0f, 100.0f));
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 10.0f, battery_model_time_to_empty_h(120.0f, 1000.0f, 100.0f));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, battery_model_time_to_empty_h(50.0f, 1000.0f, 0.0f));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, battery_model_time_to_empty_h(0.0f, 1000.0f, 100.0f));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_battery_model_soc_curve_endpoints_and_interpolation);
+  RUN_TEST(test_battery_model_soc_is_monotonic);
+  RUN_TEST(test_battery_model_compensates_load_sag);
+  RUN_TEST(test_battery_model_same_cell_reads_same_soc_at_any_load);
+  RUN_TEST(test_battery_model_time_to_empty);
+  return UNITY_END();
+}
@@ -0,0 +1,76 @@
+#include <string.h>
+#include <unity.h>
+
+#include "boot_timeline.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_boot_timeline_records_overlapping_stages() {
+  BootTimeline tl;
+  boot_timeline_reset(&tl);
+  boot_timeline_begin(&tl, BOOT_STAGE_SETUP, 100);
+  boot_timeline_begin(&tl, BOOT_STAGE_NETWORK, 2000);
+  boot_timeline_begin(&tl, BOOT_STAGE_IMU, 2100);
+  boot_timeline_end(&tl, BOOT_STAGE_IMU, 2600);
+  boot_timeline_end(&tl, BOOT_STAGE_SETUP, 3000);
+  boot_timeline_end(&tl, BOOT_STAGE_NETWORK, 90000);
+  TEST_ASSERT_EQUAL_UINT32(2900, boot_timeline_duration_us(tl, BOOT_STAGE_SETUP));
+  TEST_ASSERT_EQUAL_UINT32(500, boot_timeline_duration_us(tl, BOOT_STAGE_IMU));
+  TEST_ASSERT_EQUAL_UINT32(88000, boot_timeline_duration_us(tl, BOOT_STAGE_NETWORK));
+}
+
+void test_boot_timeline_first_begin_and_end_win() {
+  BootTimeline tl;
+  boot_timeline_reset(&tl);
+  boot_timeline_begin(&tl, BOOT_STAGE_FIRST_READING, 0);
+  boot_timeline_begin(&tl, BOOT_STAGE_FIRST_READING, 500);
+  boot_timeline_end(&tl, BOOT_STAGE_FIRST_READING, 700000);
+  boot_timeline_end(&tl, BOOT_STAGE_FIRST_READING, 900000);
+  TEST_ASSERT_EQUAL_UINT32(700000, boot_timeline_duration_us(tl, BOOT_STAGE_FIRST_READING));
+}
+
+void test_boot_timeline_end_without_begin_is_ignored() {
+  BootTimeline tl;
+  boot_timeline_reset(&tl);
+  boot_timeline_end(&tl, BOOT_STAGE_TOUCH, 10);
+  TEST_ASSERT_FALSE(boot_timeline_complete(tl, BOOT_STAGE_TOUCH));
+  TEST_ASSERT_EQUAL_UINT32(0, boot_timeline_duration_us(tl, BOOT_STAGE_TOUCH));
+  boot_timeline_begin(&tl, BOOT_STAGE_COUNT, 10);
+  TEST_ASSERT_EQUAL_UINT16(0, tl.begun_mask);
+}
+
+void test_boot_timeline_json() {
+  BootTimeline tl;
+  boot_timeline_reset(&tl);
+  char buf[256];
+  TEST_ASSERT_EQUAL_UINT32(2, boot_timeline_format_json(tl, buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL_STRING("[]", buf);
+
+  boot_timeline_begin(&tl, BOOT_STAGE_SETUP, 10);
+  boot_timeline_end(&tl, BOOT_STAGE_SETUP, 35);
+  boot_timeline_begin(&tl, BOOT_STAGE_NETWORK, 20);
+  const size_t len = boot_timeline_format_json(tl, buf, sizeof(buf));
+  TEST_ASSERT_EQUAL_STRING(
+    "[{\"stage\":\"setup\",\"begin_us\":10,\"end_us\":35,\"us\":25},"
+    "{\"stage\":\"network\",\"begin_us\":20,\"end_us\":null,\"us\":null}]",
+    buf);
+  TEST_ASSERT_EQUAL_UINT32(strlen(buf), len);
+
+  char small[40];
+  TEST_ASSERT_EQUAL_UINT32(0, boot_timeline_format_json(tl, small, sizeof(small)));
+  TEST_ASSERT_EQUAL_STRING("", small);
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_boot_timeline_records_overlapping_stages);
+  RUN_TEST(test_boot_timeline_first_begin_and_end_win);
+  RUN_TEST(test_boot_timeline_end_without_begin_is_ignored);
+  RUN_TEST(test_boot_timeline_json);
+  return UNITY_END();
+}
@@ -0,0 +1,119 @@
+#include <unity.h>
+
+#include "display_power_policy.h"
+
+namespace {
+
+const DisplayPowerConfig kConfig = {60000, 300000, 15};
+
+DisplayPowerPolicy policy;
+
+}  // namespace
+
+void setUp(void) {
+  display_power_init(&policy, 1000);
+}
+
+void tearDown(void) {}
+
+void test_display_power_starts_active() {
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_ACTIVE, policy.state);
+  TEST_ASSERT_FALSE(display_power_update(&policy, kConfig, 1000 + 59999));
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_ACTIVE, policy.state);
+}
+
+void test_display_power_steps_down_through_dim_to_blank() {
+  TEST_ASSERT_TRUE(display_power_update(&policy, kConfig, 1000 + 60000));
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_DIM, policy.state);
+  TEST_ASSERT_FALSE(display_power_update(&policy, kConfig, 1000 + 299999));
+  TEST_ASSERT_TRUE(display_power_update(&policy, kConfig, 1000 + 300000));
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_BLANK, policy.state);
+  TEST_ASSERT_EQUAL_UINT32(2, policy.transitions);
+}
+
+void test_display_power_activity_restores_immediately() {
+  display_power_update(&policy, kConfig, 1000 + 400000);
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_BLANK, policy.state);
+  TEST_ASSERT_TRUE(display_power_note_activity(&policy, 1000 + 400001));
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_ACTIVE, policy.state);
+  TEST_ASSERT_FALSE(display_power_note_activity(&policy, 1000 + 400002));
+  TEST_ASSERT_FALSE(display_power_update(&policy, kConfig, 1000 + 400002 + 59999));
+}
+
+void test_display_power_zero_timeout_disables_step() {
+  const DisplayPowerConfig no_blank = {60000, 0, 15};
+  display_power_update(&policy, no_blank, 1000 + 3600000);
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_DIM, policy.state);
+
+  const DisplayPowerConfig blank_only = {0, 120000, 15};
+  display_power_init(&policy, 0);
+  TEST_ASSERT_FALSE(display_power_update(&policy, blank_only, 119999));
+  TEST_ASSERT_TRUE(display_power_update(&policy, blank_only, 120000));
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_BLANK, policy.state);
+
+  const DisplayPowerConfig never = {0, 0, 15};
+  display_power_init(&policy, 0);
+  TEST_ASSERT_FALSE(display_power_update(&policy, never, 0xF0000000UL));
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_ACTIVE, policy.state);
+}
+
+void test_display_power_brightness_per_state() {
+  TEST_ASSERT_EQUAL_UINT8(80, display_power_brightness(policy.state, kConfig, 80));
+  display_power_update(&policy, kConfig, 1000 + 60000);
+  TEST_ASSERT_EQUAL_UINT8(15, display_power_brightness(policy.state, kConfig, 80));
+  TEST_ASSERT_EQUAL_UINT8(10, display_power_brightness(policy.state, kConfig, 10));
+  display_power_update(&policy, kConfig, 1000 + 300000);
+  TEST_ASSERT_EQUAL_UINT8(0, display_power_brightness(policy.state, kConfig, 80));
+}
+
+void test_display_power_accounts_time_per_state() {
+  display_power_update(&policy, kConfig, 1000 + 60000);   // 60 s active
+  display_power_update(&policy, kConfig, 1000 + 300000);  // 240 s dim
+  display_power_update(&policy, kConfig, 1000 + 310000);  // 10 s blank
+  display_power_note_activity(&policy, 1000 + 315000);    // +5 s blank
+  display_power_update(&policy, kConfig, 1000 + 316000);  // 1 s active
+  TEST_ASSERT_EQUAL_UINT32(61000, policy.time_in_state_ms[DISPLAY_POWER_ACTIVE]);
+  TEST_ASSERT_EQUAL_UINT32(240000, policy.time_in_state_ms[DISPLAY_POWER_DIM]);
+  TEST_ASSERT_EQUAL_UINT32(15000, policy.time_in_state_ms[DISPLAY_POWER_BLANK]);
+}
+
+void test_display_power_handles_millis_wrap() {
+  display_power_init(&policy, 0xFFFFF000UL);
+  TEST_ASSERT_FALSE(display_power_update(&policy, kConfig, 0x00001000UL));
+  TEST_ASSERT_TRUE(display_power_update(&policy, kConfig, (uint32_t)(0xFFFFF000UL + 60000UL)));
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_DIM, policy.state);
+  TEST_ASSERT_EQUAL_UINT32(60000, policy.time_in_state_ms[DISPLAY_POWER_ACTIVE]);
+}
+
+void test_display_power_ignores_stale_timestamp() {
+  // Activity noted by another task after this pass read millis().
+  display_power_note_activity(&policy, 1000 + 500);
+  TEST_ASSERT_FALSE(display_power_update(&policy, kConfig, 1000 + 499));
+  TEST_ASSERT_EQUAL_INT(DISPLAY_POWER_ACTIVE, policy.state);
+  TEST_ASSERT_EQUAL_UINT32(500, policy.time_in_state_ms[DISPLAY_POWER_ACTIVE]);
+  display_power_note_activity(&policy, 1000 + 400);
+  TEST_ASSERT_EQUAL_UINT32(1000 + 500, policy.last_activity_ms);
+}
+
+void test_display_power_state_names() {
+  TEST_ASSERT_EQUAL_STRING("ACTIVE", display_power_state_name(DISPLAY_POWER_ACTIVE));
+  TEST_ASSERT_EQUAL_STRING("DIM", display_power_state_name(DISPLAY_POWER_DIM));
+  TEST_ASSERT_EQUAL_STRING("BLANK", display_power_state_name(DISPLAY_POWER_BLANK));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_display_power_starts_active);
+  RUN_TEST(test_display_power_steps_down_through_dim_to_blank);
+  RUN_TEST(test_display_power_activity_restores_immediately);
+  RUN_TEST(test_display_power_zero_timeout_disables_step);
+  RUN_TEST(test_display_power_brightness_per_state);
+  RUN_TEST(test_display_power_accounts_time_per_state);
+  RUN_TEST(test_display_power_handles_millis_wrap);
+  RUN_TEST(test_display_power_ignores_stale_timestamp);
+  RUN_TEST(test_display_power_state_names);
+  return UNITY_END();
+}
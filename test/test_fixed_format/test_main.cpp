@@ -0,0 +1,243 @@
+#include <unity.h>
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "fixed_format.h"
+
+// Set FIXED_FORMAT_EXHAUSTIVE=1 (build flag) to compare all 2^32 bit
+// patterns at 2 and 3 decimals; takes several minutes on a desktop.
+#ifndef FIXED_FORMAT_EXHAUSTIVE
+#define FIXED_FORMAT_EXHAUSTIVE 0
+#endif
+
+namespace {
+
+float from_bits(uint32_t bits) {
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+bool is_nan_bits(uint32_t bits) {
+  return ((bits >> 23) & 0xFFU) == 0xFFU && (bits & 0x7FFFFFU) != 0;
+}
+
+// Returns the number of mismatches; prints the first few.
+uint32_t compare_bits(uint32_t bits, uint8_t decimals, uint8_t flags, uint32_t reported) {
+  const float v = from_bits(bits);
+  char expected[96];
+  char actual[96];
+  snprintf(expected, sizeof(expected), (flags & FIXED_FORMAT_SPACE_SIGN) ? "% .*f" : "%.*f",
+           (int)decimals, (double)v);
+  fixed_format(actual, sizeof(actual), v, decimals, flags);
+  if (strcmp(expected, actual) == 0) return 0;
+  if (reported < 5) {
+    printf("  mismatch bits=0x%08lX decimals=%u printf='%s' fixed='%s'\n",
+           (unsigned long)bits, (unsigned)decimals, expected, actual);
+  }
+  return 1;
+}
+
+uint32_t sweep(uint32_t first, uint32_t last, uint32_t stride, uint8_t decimals, uint8_t flags) {
+  uint32_t failures = 0;
+  for (uint64_t b = first; b <= last; b += stride) {
+    const uint32_t bits = (uint32_t)b;
+    if (is_nan_bits(bits)) continue;
+    failures += compare_bits(bits, decimals, flags, failures);
+  }
+  return failures;
+}
+
+uint32_t bits_of(float f) {
+  uint32_t b;
+  memcpy(&b, &f, sizeof(b));
+  return b;
+}
+
+}  // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_fixed_format_basic_values() {
+  char buf[FIXED_FORMAT_MAX_LEN];
+  TEST_ASSERT_EQUAL_size_t(4, fixed_format(buf, sizeof(buf), 1.25f, 2));
+  TEST_ASSERT_EQUAL_STRING("1.25", buf);
+  fixed_format(buf, sizeof(buf), -0.5f, 0);
+  TEST_ASSERT_EQUAL_STRING("-0", buf);
+  fixed_format(buf, sizeof(buf), 0.125f, 2);
+  TEST_ASSERT_EQUAL_STRING("0.12", buf);  // exact tie -> even
+  fixed_format(buf, sizeof(buf), 0.375f, 2);
+  TEST_ASSERT_EQUAL_STRING("0.38", buf);
+  fixed_format(buf, sizeof(buf), 2.5f, 0);
+  TEST_ASSERT_EQUAL_STRING("2", buf);
+  fixed_format(buf, sizeof(buf), -0.001f, 2);
+  TEST_ASSERT_EQUAL_STRING("-0.00", buf);
+  fixed_format(buf, sizeof(buf), 12.3f, 1, FIXED_FORMAT_SPACE_SIGN);
+  TEST_ASSERT_EQUAL_STRING(" 12.3", buf);
+  fixed_format(buf, sizeof(buf), -12.3f, 1, FIXED_FORMAT_SPACE_SIGN);
+  TEST_ASSERT_EQUAL_STRING("-12.3", buf);
+  fixed_format(buf, sizeof(buf), INFINITY, 2);
+  TEST_ASSERT_EQUAL_STRING("inf", buf);
+  fixed_format(buf, sizeof(buf), -INFINITY, 2);
+  TEST_ASSERT_EQUAL_STRING("-inf", buf);
+  fixed_format(buf, sizeof(buf), NAN, 2);
+  TEST_ASSERT_EQUAL_STRING("nan", buf);
+}
+
+void test_fixed_format_reports_truncation() {
+  char buf[5];
+  TEST_ASSERT_EQUAL_size_t(4, fixed_format(buf, sizeof(buf), 9.99f, 2));
+  TEST_ASSERT_EQUAL_size_t(0, fixed_format(buf, sizeof(buf), 10.0f, 2));
+  TEST_ASSERT_EQUAL_STRING("", buf);
+}
+
+void test_fixed_format_clamps_decimals() {
+  char a[FIXED_FORMAT_MAX_LEN];
+  char b[FIXED_FORMAT_MAX_LEN];
+  fixed_format(a, sizeof(a), 1.0f / 3.0f, 200);
+  fixed_format(b, sizeof(b), 1.0f / 3.0f, FIXED_FORMAT_MAX_DECIMALS);
+  TEST_ASSERT_EQUAL_STRING(b, a);
+}
+
+void test_fixed_format_extremes_match_printf() {
+  const float values[] = {
+    0.0f, -0.0f, 3.4028235e38f, -3.4028235e38f, 1.17549435e-38f, 1.4e-45f,
+    1.8446744e19f, 9.2233720e18f, 4294967296.0f, 4294967295.0f, 1e9f, 0.5f, 1.5f,
+    0.05f, 0.15f, 0.25f, 0.35f, 0.45f, 999.9995f, 359.99997f, -179.995f
+  };
+  uint32_t failures = 0;
+  for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+    for (uint8_t d = 0; d <= FIXED_FORMAT_MAX_DECIMALS; ++d) {
+      failures += compare_bits(bits_of(values[i]), d, 0, failures);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, failures);
+}
+
+// Every float in [256, 512) and (-512, -256]: one full binade per sign, so
+// every mantissa pattern (and every tie) at the angle-sized exponents.
+void test_fixed_format_full_binade_matches_printf() {
+  const uint32_t lo = bits_of(256.0f);
+  const uint32_t hi = bits_of(512.0f) - 1U;
+  uint32_t failures = sweep(lo, hi, 1, 2, 0);
+  failures += sweep(lo | 0x80000000UL, hi | 0x80000000UL, 1, 3, FIXED_FORMAT_SPACE_SIGN);
+  TEST_ASSERT_EQUAL_UINT32(0, failures);
+}
+
+// Strided walk over the whole 32-bit space for every decimals setting.
+void test_fixed_format_strided_space_matches_printf() {
+  uint32_t failures = 0;
+  for (uint8_t d = 0; d <= FIXED_FORMAT_MAX_DECIMALS; ++d) {
+    failures += sweep(d, 0xFFFFFFFFUL, 65521U, d, (d & 1) ? FIXED_FORMAT_SPACE_SIGN : 0);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, failures);
+}
+
+// Angles as the firmware reports them: every 0.0001 deg step in +-360.
+void test_fixed_format_angle_grid_matches_printf() {
+  uint32_t failures = 0;
+  for (int32_t i = -3600000; i <= 3600000; ++i) {
+    const uint32_t bits = bits_of((float)i / 10000.0f);
+    failures += compare_bits(bits, (uint8_t)(1 + ((uint32_t)i % 4U)), 0, failures);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, failures);
+}
+
+void test_fixed_format_exhaustive_matches_printf() {
+#if FIXED_FORMAT_EXHAUSTIVE
+  uint32_t failures = sweep(0, 0xFFFFFFFFUL, 1, 2, 0);
+  failures += sweep(0, 0xFFFFFFFFUL, 1, 3, 0);
+  TEST_ASSERT_EQUAL_UINT32(0, failures);
+#else
+  TEST_MESSAGE("exhaustive sweep skipped (build with -D FIXED_FORMAT_EXHAUSTIVE=1)");
+#endif
+}
+
+void test_fixed_format_scratch_shares_one_buffer() {
+  char buf[16];
+  FixedFormatScratch scratch;
+  fixed_format_scratch_init(&scratch, buf, sizeof(buf));
+  const char *a = fixed_format_next(&scratch, 1.5f, 1);
+  const char *b = fixed_format_next(&scratch, -2.25f, 2);
+  const char *c = fixed_format_next(&scratch, 123456.0f, 3);  // does not fit
+  TEST_ASSERT_EQUAL_STRING("1.5", a);
+  TEST_ASSERT_EQUAL_STRING("-2.25", b);
+  TEST_ASSERT_EQUAL_STRING("0", c);
+}
+
+// The float fields of one /api/state response (values and decimals as
+// handle_state() emits them), formatted through printf and through
+// fixed_format. Prints the time per response for both.
+void test_fixed_format_state_response_benchmark() {
+  const float values[] = {
+    -1.23f, 4.56f, 98.5f, 3.91f, 76.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.012f, -0.034f, 0.998f, 0.41f, -0.22f, 0.05f,
+    0.012f, -0.034f, 0.998f, 0.41f, -0.22f,
+    0.011f, -0.031f, 0.997f, 0.40f, -0.21f,
+    -1.2345f, 4.5678f,
+    0.0012f, -0.0034f, 0.0098f, 0.0041f, -0.0022f,
+    0.512f, -0.333f, 0.101f, 0.202f,
+    28.7f, 3.14f, 7.92f
+  };
+  const uint8_t decimals[] = {
+    2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1,
+    3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3,
+    2, 2,
+    4, 4, 4, 4, 4,
+    3, 3, 3, 3,
+    1, 2, 2
+  };
+  const size_t count = sizeof(values) / sizeof(values[0]);
+  TEST_ASSERT_EQUAL_size_t(count, sizeof(decimals));
+
+  const int responses = 20000;
+  char buf[32];
+  volatile size_t sink = 0;
+
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < responses; ++r) {
+    for (size_t i = 0; i < count; ++i) {
+      sink += (size_t)snprintf(buf, sizeof(buf), "%.*f", (int)decimals[i], (double)(values[i] + (float)r));
+    }
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  for (int r = 0; r < responses; ++r) {
+    for (size_t i = 0; i < count; ++i) {
+      sink += fixed_format(buf, sizeof(buf), values[i] + (float)r, decimals[i]);
+    }
+  }
+  const auto t2 = std::chrono::steady_clock::now();
+
+  const double printf_us = std::chrono::duration<double, std::micro>(t1 - t0).count() / responses;
+  const double fixed_us = std::chrono::duration<double, std::micro>(t2 - t1).count() / responses;
+  printf("[fixed_format] /api/state floats (%u per response): printf %.2f us, fixed_format %.2f us, %.1fx\n",
+         (unsigned)count, printf_us, fixed_us, fixed_us > 0.0 ? printf_us / fixed_us : 0.0);
+  // Host timings are informational only (a loaded machine would make any
+  // threshold flaky); the device figure is the state_json perf stage.
+  (void)sink;
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_fixed_format_basic_values);
+  RUN_TEST(test_fixed_format_reports_truncation);
+  RUN_TEST(test_fixed_format_clamps_decimals);
+  RUN_TEST(test_fixed_format_extremes_match_printf);
+  RUN_TEST(test_fixed_format_full_binade_matches_printf);
+  RUN_TEST(test_fixed_format_strided_space_matches_printf);
+  RUN_TEST(test_fixed_format_angle_grid_matches_printf);
+  RUN_TEST(test_fixed_format_exhaustive_matches_printf);
+  RUN_TEST(test_fixed_format_scratch_shares_one_buffer);
+  RUN_TEST(test_fixed_format_state_response_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,77 @@
+#include <string.h>
+#include <unity.h>
+
+#include "flight_recorder.h"
+
+namespace {
+
+FlightRecorder fr;
+FlightEvent out[FLIGHT_RECORDER_EVENTS];
+
+}  // namespace
+
+void setUp(void) {
+  flight_recorder_start(&fr, 1, 1);
+}
+
+void tearDown(void) {}
+
+void test_flight_recorder_rejects_garbage() {
+  TEST_ASSERT_TRUE(flight_recorder_valid(fr));
+  FlightRecorder junk;
+  memset(&junk, 0xA5, sizeof(junk));
+  TEST_ASSERT_FALSE(flight_recorder_valid(junk));
+  fr.version++;
+  TEST_ASSERT_FALSE(flight_recorder_valid(fr));
+}
+
+void test_flight_recorder_collects_in_write_order() {
+  TEST_ASSERT_EQUAL_UINT8(0, flight_recorder_collect(fr, out, FLIGHT_RECORDER_EVENTS));
+  flight_recorder_write(&fr, 1, FLIGHT_EVENT_BOOT, 1, 1, 0);
+  flight_recorder_write(&fr, 2, FLIGHT_EVENT_WIFI, FLIGHT_WIFI_RADIO_ON, 0, 150);
+  flight_recorder_write(&fr, 3, FLIGHT_EVENT_LOOP_OVERRUN, FLIGHT_LOOP_SENSOR, 180000, 9000);
+  TEST_ASSERT_EQUAL_UINT8(3, flight_recorder_collect(fr, out, FLIGHT_RECORDER_EVENTS));
+  TEST_ASSERT_EQUAL_UINT8(FLIGHT_EVENT_BOOT, out[0].type);
+  TEST_ASSERT_EQUAL_UINT8(FLIGHT_EVENT_LOOP_OVERRUN, out[2].type);
+  TEST_ASSERT_EQUAL_UINT32(180000, out[2].value);
+  TEST_ASSERT_EQUAL_UINT8(2, flight_recorder_collect(fr, out, 2));
+}
+
+void test_flight_recorder_keeps_last_lap_and_skips_torn_slot() {
+  const uint32_t total = FLIGHT_RECORDER_EVENTS + 10;
+  for (uint32_t seq = 1; seq <= total; ++seq) {
+    flight_recorder_write(&fr, seq, FLIGHT_EVENT_I2C_ERROR, 0, seq, seq * 10);
+  }
+  TEST_ASSERT_EQUAL_UINT8(FLIGHT_RECORDER_EVENTS, flight_recorder_collect(fr, out, FLIGHT_RECORDER_EVENTS));
+  TEST_ASSERT_EQUAL_UINT32(11, out[0].value);
+  TEST_ASSERT_EQUAL_UINT32(total, out[FLIGHT_RECORDER_EVENTS - 1].value);
+
+  // A reset in the middle of a write leaves seq cleared.
+  fr.events[(20 - 1) % FLIGHT_RECORDER_EVENTS].seq = 0;
+  fr.events[(30 - 1) % FLIGHT_RECORDER_EVENTS].type = 0xEE;
+  TEST_ASSERT_EQUAL_UINT8(FLIGHT_RECORDER_EVENTS - 2, flight_recorder_collect(fr, out, FLIGHT_RECORDER_EVENTS));
+}
+
+void test_flight_events_format_json() {
+  flight_recorder_write(&fr, 1, FLIGHT_EVENT_BOOT, 7, 3, 0);
+  flight_recorder_write(&fr, 2, FLIGHT_EVENT_OTA, FLIGHT_OTA_FAILED, 4096, 61234);
+  const uint8_t n = flight_recorder_collect(fr, out, FLIGHT_RECORDER_EVENTS);
+  char json[96];
+  TEST_ASSERT_TRUE(flight_events_format_json(out, n, json, sizeof(json)) > 0);
+  TEST_ASSERT_EQUAL_STRING("[[0,\"boot\",7,3],[61234,\"ota\",2,4096]]", json);
+  TEST_ASSERT_EQUAL_UINT32(2, flight_events_format_json(out, 0, json, sizeof(json)));
+  TEST_ASSERT_EQUAL_STRING("[]", json);
+  TEST_ASSERT_EQUAL_UINT32(0, flight_events_format_json(out, n, json, 20));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_flight_recorder_rejects_garbage);
+  RUN_TEST(test_flight_recorder_collects_in_write_order);
+  RUN_TEST(test_flight_recorder_keeps_last_lap_and_skips_torn_slot);
+  RUN_TEST(test_flight_events_format_json);
+  return UNITY_END();
+}
@@ -0,0 +1,145 @@
+#include <unity.h>
+
+#include <string.h>
+
+#include "frame_diff.h"
+
+namespace {
+
+constexpr int kW = 64;
+constexpr int kH = 32;
+
+uint16_t cur[kW * kH];
+uint16_t prev[kW * kH];
+
+void poke(int x, int y, uint16_t v) {
+  cur[y * kW + x] = v;
+}
+
+const FrameRect kFull = {0, 0, kW - 1, kH - 1};
+
+}  // namespace
+
+void setUp(void) {
+  memset(cur, 0, sizeof(cur));
+  memset(prev, 0, sizeof(prev));
+}
+
+void tearDown(void) {}
+
+void test_frame_diff_identical_frames_yield_no_rects() {
+  FrameRect out[4];
+  TEST_ASSERT_EQUAL_INT(0, frame_diff_rects(cur, prev, kW, kH, kFull, 1, out, 4));
+}
+
+void test_frame_diff_single_pixel_is_tight() {
+  FrameRect out[4];
+  poke(10, 5, 0xFFFF);
+  TEST_ASSERT_EQUAL_INT(1, frame_diff_rects(cur, prev, kW, kH, kFull, 1, out, 4));
+  TEST_ASSERT_EQUAL_INT(10, out[0].x1);
+  TEST_ASSERT_EQUAL_INT(5, out[0].y1);
+  TEST_ASSERT_EQUAL_INT(10, out[0].x2);
+  TEST_ASSERT_EQUAL_INT(5, out[0].y2);
+  TEST_ASSERT_EQUAL_UINT32(1, frame_rect_area(out[0]));
+}
+
+void test_frame_diff_groups_rows_into_bands() {
+  FrameRect out[4];
+  poke(3, 2, 1);
+  poke(8, 3, 1);
+  poke(20, 20, 1);
+  TEST_ASSERT_EQUAL_INT(2, frame_diff_rects(cur, prev, kW, kH, kFull, 1, out, 4));
+  TEST_ASSERT_EQUAL_INT(3, out[0].x1);
+  TEST_ASSERT_EQUAL_INT(2, out[0].y1);
+  TEST_ASSERT_EQUAL_INT(8, out[0].x2);
+  TEST_ASSERT_EQUAL_INT(3, out[0].y2);
+  TEST_ASSERT_EQUAL_INT(20, out[1].x1);
+  TEST_ASSERT_EQUAL_INT(20, out[1].y1);
+}
+
+void test_frame_diff_row_gap_bridges_short_clean_runs() {
+  FrameRect out[4];
+  poke(5, 4, 1);
+  poke(5, 7, 1);
+  TEST_ASSERT_EQUAL_INT(2, frame_diff_rects(cur, prev, kW, kH, kFull, 2, out, 4));
+  TEST_ASSERT_EQUAL_INT(1, frame_diff_rects(cur, prev, kW, kH, kFull, 3, out, 4));
+  TEST_ASSERT_EQUAL_INT(4, out[0].y1);
+  TEST_ASSERT_EQUAL_INT(7, out[0].y2);
+}
+
+void test_frame_diff_only_scans_the_region() {
+  FrameRect out[4];
+  poke(1, 1, 1);
+  poke(40, 10, 1);
+  const FrameRect region = {30, 5, 50, 15};
+  TEST_ASSERT_EQUAL_INT(1, frame_diff_rects(cur, prev, kW, kH, region, 1, out, 4));
+  TEST_ASSERT_EQUAL_INT(40, out[0].x1);
+  TEST_ASSERT_EQUAL_INT(10, out[0].y1);
+}
+
+void test_frame_diff_clips_region_to_frame() {
+  FrameRect out[4];
+  poke(kW - 1, kH - 1, 1);
+  const FrameRect region = {-10, -10, kW + 10, kH + 10};
+  TEST_ASSERT_EQUAL_INT(1, frame_diff_rects(cur, prev, kW, kH, region, 1, out, 4));
+  TEST_ASSERT_EQUAL_INT(kW - 1, out[0].x2);
+  TEST_ASSERT_EQUAL_INT(kH - 1, out[0].y2);
+
+  const FrameRect outside = {kW + 1, 0, kW + 5, 4};
+  TEST_ASSERT_EQUAL_INT(0, frame_diff_rects(cur, prev, kW, kH, outside, 1, out, 4));
+}
+
+void test_frame_diff_overflow_merges_into_last_rect() {
+  FrameRect out[2];
+  poke(1, 0, 1);
+  poke(2, 10, 1);
+  poke(30, 20, 1);
+  poke(4, 30, 1);
+  TEST_ASSERT_EQUAL_INT(2, frame_diff_rects(cur, prev, kW, kH, kFull, 1, out, 2));
+  TEST_ASSERT_EQUAL_INT(0, out[0].y1);
+  TEST_ASSERT_EQUAL_INT(0, out[0].y2);
+  TEST_ASSERT_EQUAL_INT(2, out[1].x1);
+  TEST_ASSERT_EQUAL_INT(10, out[1].y1);
+  TEST_ASSERT_EQUAL_INT(30, out[1].x2);
+  TEST_ASSERT_EQUAL_INT(30, out[1].y2);
+}
+
+void test_frame_diff_commit_syncs_shadow() {
+  FrameRect out[4];
+  for (int y = 8; y < 12; ++y) {
+    for (int x = 16; x < 24; ++x) poke(x, y, (uint16_t)(x * y));
+  }
+  const size_t n = frame_diff_rects(cur, prev, kW, kH, kFull, 1, out, 4);
+  TEST_ASSERT_EQUAL_INT(1, n);
+  TEST_ASSERT_EQUAL_UINT32(32, frame_rect_area(out[0]));
+  frame_diff_commit(cur, prev, kW, out[0]);
+  TEST_ASSERT_EQUAL_INT(0, memcmp(cur, prev, sizeof(cur)));
+  TEST_ASSERT_EQUAL_INT(0, frame_diff_rects(cur, prev, kW, kH, kFull, 1, out, 4));
+}
+
+void test_frame_diff_rejects_bad_arguments() {
+  FrameRect out[1];
+  poke(0, 0, 1);
+  TEST_ASSERT_EQUAL_INT(0, frame_diff_rects(nullptr, prev, kW, kH, kFull, 1, out, 1));
+  TEST_ASSERT_EQUAL_INT(0, frame_diff_rects(cur, prev, kW, kH, kFull, 1, out, 0));
+  TEST_ASSERT_EQUAL_INT(0, frame_diff_rects(cur, prev, 0, kH, kFull, 1, out, 1));
+  const FrameRect empty = {5, 5, 4, 4};
+  TEST_ASSERT_EQUAL_UINT32(0, frame_rect_area(empty));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_frame_diff_identical_frames_yield_no_rects);
+  RUN_TEST(test_frame_diff_single_pixel_is_tight);
+  RUN_TEST(test_frame_diff_groups_rows_into_bands);
+  RUN_TEST(test_frame_diff_row_gap_bridges_short_clean_runs);
+  RUN_TEST(test_frame_diff_only_scans_the_region);
+  RUN_TEST(test_frame_diff_clips_region_to_frame);
+  RUN_TEST(test_frame_diff_overflow_merges_into_last_rect);
+  RUN_TEST(test_frame_diff_commit_syncs_shadow);
+  RUN_TEST(test_frame_diff_rejects_bad_arguments);
+  return UNITY_END();
+}
@@ -0,0 +1,68 @@
+#include <unity.h>
+
+#include "latency_trace.h"
+
+namespace {
+
+LatencyTrace tr;
+
+}  // namespace
+
+void setUp(void) {
+  latency_trace_reset(&tr);
+}
+
+void tearDown(void) {}
+
+void test_latency_trace_sample_to_pixel() {
+  uint32_t to_ui = 0;
+  uint32_t to_px = 0;
+  TEST_ASSERT_FALSE(latency_trace_flush(&tr, 1000, &to_ui, &to_px));
+  TEST_ASSERT_TRUE(latency_trace_ui(&tr, 10000, 22000));
+  TEST_ASSERT_TRUE(latency_trace_flush(&tr, 41000, &to_ui, &to_px));
+  TEST_ASSERT_EQUAL_UINT32(12000, to_ui);
+  TEST_ASSERT_EQUAL_UINT32(31000, to_px);
+  // One sample is reported once, even if later frames are flushed.
+  TEST_ASSERT_FALSE(latency_trace_flush(&tr, 60000, &to_ui, &to_px));
+}
+
+void test_latency_trace_ignores_repeated_and_missing_samples() {
+  TEST_ASSERT_FALSE(latency_trace_ui(&tr, 0, 5000));
+  TEST_ASSERT_TRUE(latency_trace_ui(&tr, 7000, 8000));
+  uint32_t to_px = 0;
+  TEST_ASSERT_TRUE(latency_trace_flush(&tr, 20000, nullptr, &to_px));
+  // Same sample again (UI pass without a new fused sample): not traced.
+  TEST_ASSERT_FALSE(latency_trace_ui(&tr, 7000, 9000));
+  TEST_ASSERT_FALSE(latency_trace_flush(&tr, 30000, nullptr, &to_px));
+  TEST_ASSERT_EQUAL_UINT32(13000, to_px);
+}
+
+void test_latency_trace_newer_sample_supersedes() {
+  TEST_ASSERT_TRUE(latency_trace_ui(&tr, 1000, 2000));
+  TEST_ASSERT_TRUE(latency_trace_ui(&tr, 21000, 22000));
+  TEST_ASSERT_EQUAL_UINT32(1, tr.superseded);
+  uint32_t to_px = 0;
+  TEST_ASSERT_TRUE(latency_trace_flush(&tr, 30000, nullptr, &to_px));
+  TEST_ASSERT_EQUAL_UINT32(9000, to_px);
+}
+
+void test_latency_trace_micros_wrap() {
+  uint32_t to_ui = 0;
+  uint32_t to_px = 0;
+  TEST_ASSERT_TRUE(latency_trace_ui(&tr, 0xFFFFF000UL, 0xFFFFFF00UL));
+  TEST_ASSERT_TRUE(latency_trace_flush(&tr, 0x00001000UL, &to_ui, &to_px));
+  TEST_ASSERT_EQUAL_UINT32(0xF00, to_ui);
+  TEST_ASSERT_EQUAL_UINT32(0x2000, to_px);
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_latency_trace_sample_to_pixel);
+  RUN_TEST(test_latency_trace_ignores_repeated_and_missing_samples);
+  RUN_TEST(test_latency_trace_newer_sample_supersedes);
+  RUN_TEST(test_latency_trace_micros_wrap);
+  return UNITY_END();
+}
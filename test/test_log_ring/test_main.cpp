@@ -0,0 +1,77 @@
+#include <string.h>
+#include <unity.h>
+
+#include "log_ring.h"
+
+namespace {
+
+uint8_t storage[16];
+LogRing ring;
+
+bool write_str(const char *s) {
+  return log_ring_write(&ring, reinterpret_cast<const uint8_t *>(s), strlen(s));
+}
+
+}  // namespace
+
+void setUp(void) {
+  log_ring_init(&ring, storage, sizeof(storage));
+}
+
+void tearDown(void) {}
+
+void test_log_ring_fifo_order() {
+  TEST_ASSERT_TRUE(write_str("abc"));
+  TEST_ASSERT_TRUE(write_str("de"));
+  uint8_t out[8];
+  TEST_ASSERT_EQUAL_UINT32(5, log_ring_peek(ring, out, sizeof(out)));
+  TEST_ASSERT_EQUAL_INT(0, memcmp(out, "abcde", 5));
+  log_ring_consume(&ring, 2);
+  TEST_ASSERT_EQUAL_UINT32(3, log_ring_peek(ring, out, sizeof(out)));
+  TEST_ASSERT_EQUAL_INT(0, memcmp(out, "cde", 3));
+}
+
+void test_log_ring_write_is_all_or_nothing() {
+  TEST_ASSERT_TRUE(write_str("0123456789"));
+  TEST_ASSERT_FALSE(write_str("abcdefg"));
+  TEST_ASSERT_EQUAL_UINT32(7, ring.dropped_bytes);
+  TEST_ASSERT_EQUAL_UINT32(1, ring.dropped_writes);
+  TEST_ASSERT_EQUAL_UINT32(6, log_ring_free(ring));
+  TEST_ASSERT_TRUE(write_str("abcdef"));
+  TEST_ASSERT_EQUAL_UINT32(0, log_ring_free(ring));
+  TEST_ASSERT_EQUAL_UINT32(16, ring.high_water);
+}
+
+void test_log_ring_wraps_around() {
+  uint8_t out[16];
+  TEST_ASSERT_TRUE(write_str("0123456789AB"));
+  log_ring_consume(&ring, 10);
+  TEST_ASSERT_TRUE(write_str("cdefghij"));  // spans the end of storage
+  TEST_ASSERT_EQUAL_UINT32(10, log_ring_peek(ring, out, sizeof(out)));
+  TEST_ASSERT_EQUAL_INT(0, memcmp(out, "ABcdefghij", 10));
+  TEST_ASSERT_EQUAL_UINT32(4, log_ring_peek(ring, out, 4));
+  log_ring_consume(&ring, 4);
+  TEST_ASSERT_EQUAL_UINT32(6, log_ring_peek(ring, out, sizeof(out)));
+  TEST_ASSERT_EQUAL_INT(0, memcmp(out, "efghij", 6));
+  TEST_ASSERT_EQUAL_UINT32(20, ring.written_bytes);
+}
+
+void test_log_ring_consume_clamps() {
+  TEST_ASSERT_TRUE(write_str("xy"));
+  log_ring_consume(&ring, 100);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(storage), log_ring_free(ring));
+  uint8_t out[4];
+  TEST_ASSERT_EQUAL_UINT32(0, log_ring_peek(ring, out, sizeof(out)));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_log_ring_fifo_order);
+  RUN_TEST(test_log_ring_write_is_all_or_nothing);
+  RUN_TEST(test_log_ring_wraps_around);
+  RUN_TEST(test_log_ring_consume_clamps);
+  return UNITY_END();
+}
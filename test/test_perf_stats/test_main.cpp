@@ -0,0 +1,79 @@
+#include <string.h>
+#include <unity.h>
+
+#include "perf_stats.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_perf_hist_buckets_are_contiguous() {
+  // Every bucket starts one past the previous upper edge.
+  uint32_t expected_lower = 0;
+  for (uint8_t b = 0; b < PERF_HIST_BUCKETS - 1; ++b) {
+    TEST_ASSERT_EQUAL_UINT8(b, perf_hist_bucket(expected_lower));
+    const uint32_t upper = perf_hist_bucket_upper_us(b);
+    TEST_ASSERT_EQUAL_UINT8(b, perf_hist_bucket(upper));
+    expected_lower = upper + 1;
+  }
+  TEST_ASSERT_EQUAL_UINT32(262144, expected_lower);
+  TEST_ASSERT_EQUAL_UINT8(PERF_HIST_BUCKETS - 1, perf_hist_bucket(262144));
+  TEST_ASSERT_EQUAL_UINT8(PERF_HIST_BUCKETS - 1, perf_hist_bucket(UINT32_MAX));
+}
+
+void test_perf_hist_tracks_min_mean_max() {
+  PerfHistogram h;
+  perf_hist_reset(&h);
+  TEST_ASSERT_EQUAL_UINT32(0, perf_hist_mean_us(h));
+  TEST_ASSERT_EQUAL_UINT32(0, perf_hist_percentile_us(h, 99));
+  perf_hist_record(&h, 500);
+  perf_hist_record(&h, 300);
+  perf_hist_record(&h, 1000);
+  TEST_ASSERT_EQUAL_UINT32(3, h.count);
+  TEST_ASSERT_EQUAL_UINT32(300, h.min_us);
+  TEST_ASSERT_EQUAL_UINT32(1000, h.max_us);
+  TEST_ASSERT_EQUAL_UINT32(600, perf_hist_mean_us(h));
+}
+
+void test_perf_hist_percentile_within_bucket_error() {
+  PerfHistogram h;
+  perf_hist_reset(&h);
+  // 990 samples at 400 us, 10 at 5000 us: p50 sits at 400, p99 still at 400,
+  // p100 at the maximum.
+  for (int i = 0; i < 990; ++i) perf_hist_record(&h, 400);
+  for (int i = 0; i < 10; ++i) perf_hist_record(&h, 5000);
+  const uint32_t p50 = perf_hist_percentile_us(h, 50);
+  TEST_ASSERT_TRUE(p50 >= 400 && p50 <= 500);
+  const uint32_t p99 = perf_hist_percentile_us(h, 99);
+  TEST_ASSERT_TRUE(p99 >= 400 && p99 <= 500);
+  TEST_ASSERT_EQUAL_UINT32(5000, perf_hist_percentile_us(h, 100));
+
+  // Ten more slow samples push p99 into the slow bucket, capped at max.
+  for (int i = 0; i < 10; ++i) perf_hist_record(&h, 5000);
+  TEST_ASSERT_EQUAL_UINT32(5000, perf_hist_percentile_us(h, 99));
+}
+
+void test_perf_hist_format_json() {
+  PerfHistogram h;
+  perf_hist_reset(&h);
+  perf_hist_record(&h, 2);
+  perf_hist_record(&h, 3);
+  char out[128];
+  const size_t n = perf_hist_format_json(h, out, sizeof(out));
+  TEST_ASSERT_EQUAL_UINT32(strlen(out), n);
+  TEST_ASSERT_EQUAL_STRING("{\"n\":2,\"min_us\":2,\"avg_us\":2,\"p50_us\":2,\"p99_us\":3,\"max_us\":3}", out);
+  TEST_ASSERT_EQUAL_UINT32(0, perf_hist_format_json(h, out, 16));
+  TEST_ASSERT_EQUAL_STRING("", out);
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_perf_hist_buckets_are_contiguous);
+  RUN_TEST(test_perf_hist_tracks_min_mean_max);
+  RUN_TEST(test_perf_hist_percentile_within_bucket_error);
+  RUN_TEST(test_perf_hist_format_json);
+  return UNITY_END();
+}
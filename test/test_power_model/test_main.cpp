@@ -0,0 +1,96 @@
+#include <unity.h>
+
+#include "power_model.h"
+
+namespace {
+
+PowerModelInput base_input() {
+  PowerModelInput in = {};
+  in.cpu = POWER_CPU_FIXED;
+  in.cpu_busy_frac = 0.1f;
+  in.display = DISPLAY_POWER_ACTIVE;
+  in.brightness_percent = 80;
+  in.wifi = POWER_WIFI_STA_MODEM_SLEEP;
+  return in;
+}
+
+}  // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_power_model_cpu_modes_are_ordered() {
+  PowerModelInput in = base_input();
+  const float fixed = power_model_current_ma(in);
+  in.cpu = POWER_CPU_DFS;
+  const float dfs = power_model_current_ma(in);
+  in.cpu = POWER_CPU_LIGHT_SLEEP;
+  const float light = power_model_current_ma(in);
+  TEST_ASSERT_TRUE(dfs < fixed);
+  TEST_ASSERT_TRUE(light < dfs);
+}
+
+void test_power_model_busy_cpu_gains_nothing_from_scaling() {
+  PowerModelInput in = base_input();
+  in.cpu_busy_frac = 1.0f;
+  const float fixed = power_model_current_ma(in);
+  in.cpu = POWER_CPU_LIGHT_SLEEP;
+  TEST_ASSERT_EQUAL_FLOAT(fixed, power_model_current_ma(in));
+  in.cpu_busy_frac = 7.0f;  // clamped
+  TEST_ASSERT_EQUAL_FLOAT(fixed, power_model_current_ma(in));
+}
+
+void test_power_model_radio_blocks_light_sleep() {
+  PowerModelInput in = base_input();
+  in.wifi = POWER_WIFI_AP;
+  in.cpu = POWER_CPU_DFS;
+  const float dfs = power_model_current_ma(in);
+  in.cpu = POWER_CPU_LIGHT_SLEEP;
+  TEST_ASSERT_EQUAL_FLOAT(dfs, power_model_current_ma(in));
+}
+
+void test_power_model_modem_sleep_beats_active_station() {
+  PowerModelInput in = base_input();
+  in.wifi = POWER_WIFI_STA_ACTIVE;
+  const float active = power_model_current_ma(in);
+  in.wifi = POWER_WIFI_STA_MODEM_SLEEP;
+  const float sleep = power_model_current_ma(in);
+  in.wifi = POWER_WIFI_OFF;
+  const float off = power_model_current_ma(in);
+  TEST_ASSERT_TRUE(sleep < active);
+  TEST_ASSERT_TRUE(off < sleep);
+}
+
+void test_power_model_panel_follows_brightness_and_blank() {
+  PowerModelInput in = base_input();
+  const float bright = power_model_current_ma(in);
+  in.display = DISPLAY_POWER_DIM;
+  in.brightness_percent = 15;
+  const float dim = power_model_current_ma(in);
+  in.display = DISPLAY_POWER_BLANK;
+  in.brightness_percent = 80;  // ignored while blank
+  const float blank = power_model_current_ma(in);
+  TEST_ASSERT_TRUE(dim < bright);
+  TEST_ASSERT_TRUE(blank < dim);
+}
+
+void test_power_model_runtime() {
+  TEST_ASSERT_EQUAL_FLOAT(10.0f, power_model_runtime_h(1000.0f, 100.0f));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, power_model_runtime_h(1000.0f, 0.0f));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, power_model_runtime_h(0.0f, 50.0f));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_power_model_cpu_modes_are_ordered);
+  RUN_TEST(test_power_model_busy_cpu_gains_nothing_from_scaling);
+  RUN_TEST(test_power_model_radio_blocks_light_sleep);
+  RUN_TEST(test_power_model_modem_sleep_beats_active_station);
+  RUN_TEST(test_power_model_panel_follows_brightness_and_blank);
+  RUN_TEST(test_power_model_runtime);
+  return UNITY_END();
+}
@@ -0,0 +1,77 @@
+#include <string.h>
+#include <unity.h>
+
+#include "resume_state.h"
+
+namespace {
+
+const uint32_t kFw = 0x12345678UL;
+
+ResumeState sealed_state() {
+  ResumeState s;
+  memset(&s, 0, sizeof(s));
+  s.sleep_count = 3;
+  s.roll_phys = 1.25f;
+  s.pitch_phys = -7.5f;
+  s.gx_off = 0.02f;
+  s.orientation_mode = 1;
+  s.display_brightness_percent = 80;
+  s.display_blank_s = 300;
+  resume_state_seal(&s, kFw);
+  return s;
+}
+
+}  // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_resume_state_sealed_is_valid() {
+  const ResumeState s = sealed_state();
+  TEST_ASSERT_EQUAL_HEX32(RESUME_STATE_MAGIC, s.magic);
+  TEST_ASSERT_TRUE(resume_state_valid(s, kFw));
+}
+
+void test_resume_state_zeroed_memory_is_invalid() {
+  ResumeState s;
+  memset(&s, 0, sizeof(s));
+  TEST_ASSERT_FALSE(resume_state_valid(s, kFw));
+}
+
+void test_resume_state_detects_any_flipped_bit() {
+  const ResumeState good = sealed_state();
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&good);
+  for (size_t i = 0; i < sizeof(ResumeState); ++i) {
+    for (int bit = 0; bit < 8; ++bit) {
+      ResumeState bad = good;
+      reinterpret_cast<uint8_t *>(&bad)[i] = (uint8_t)(bytes[i] ^ (1U << bit));
+      TEST_ASSERT_FALSE(resume_state_valid(bad, kFw));
+    }
+  }
+}
+
+void test_resume_state_rejects_other_firmware() {
+  const ResumeState s = sealed_state();
+  TEST_ASSERT_FALSE(resume_state_valid(s, kFw + 1));
+  TEST_ASSERT_NOT_EQUAL(resume_state_fw_hash("2026.3.1"), resume_state_fw_hash("2026.3.2"));
+}
+
+void test_resume_state_invalidate() {
+  ResumeState s = sealed_state();
+  resume_state_invalidate(&s);
+  TEST_ASSERT_FALSE(resume_state_valid(s, kFw));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_resume_state_sealed_is_valid);
+  RUN_TEST(test_resume_state_zeroed_memory_is_invalid);
+  RUN_TEST(test_resume_state_detects_any_flipped_bit);
+  RUN_TEST(test_resume_state_rejects_other_firmware);
+  RUN_TEST(test_resume_state_invalidate);
+  return UNITY_END();
+}
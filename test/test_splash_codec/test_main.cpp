@@ -0,0 +1,136 @@
+#include <unity.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include "splash_codec.h"
+#include "splash_image_536x240_lz.h"
+#include "splash_image_536x240_rgb565.h"
+
+namespace {
+
+constexpr size_t kSplashPx = SPLASH_IMAGE_LZ_WIDTH * SPLASH_IMAGE_LZ_HEIGHT;
+
+SplashDecoder dec;
+uint16_t out[kSplashPx + 16];
+
+// Decode the whole splash in strips of `strip_px` and compare with the raw image.
+void check_round_trip(size_t strip_px) {
+  splash_decoder_init(&dec, SPLASH_IMAGE_536x240_LZ, sizeof(SPLASH_IMAGE_536x240_LZ));
+  size_t total = 0;
+  while (total < kSplashPx + 16) {
+    size_t want = strip_px;
+    if (want > kSplashPx + 16 - total) want = kSplashPx + 16 - total;
+    const size_t got = splash_decoder_read(&dec, out + total, want);
+    total += got;
+    if (got < want) break;
+  }
+  TEST_ASSERT_FALSE(splash_decoder_failed(&dec));
+  TEST_ASSERT_EQUAL_size_t(kSplashPx, total);
+  TEST_ASSERT_EQUAL_INT(0, memcmp(out, SPLASH_IMAGE_536x240_RGB565, sizeof(SPLASH_IMAGE_536x240_RGB565)));
+}
+
+}  // namespace
+
+void setUp(void) {
+  memset(out, 0, sizeof(out));
+}
+
+void tearDown(void) {}
+
+void test_splash_round_trip_panel_strips() {
+  check_round_trip(SPLASH_IMAGE_LZ_WIDTH * 16);
+}
+
+void test_splash_round_trip_odd_strips() {
+  check_round_trip(537);
+  check_round_trip(7);
+}
+
+void test_splash_round_trip_single_call() {
+  check_round_trip(kSplashPx + 16);
+}
+
+void test_splash_is_actually_compressed() {
+  TEST_ASSERT_LESS_THAN(sizeof(SPLASH_IMAGE_536x240_RGB565) / 2, sizeof(SPLASH_IMAGE_536x240_LZ));
+}
+
+void test_splash_decodes_literals_and_runs() {
+  // 2 literals (0x1234, 0xABCD), then a run of 5 x 0xABCD (len 5, dist 1),
+  // then repeat the last 3 pixels (len 3, dist 3).
+  const uint8_t stream[] = {0x01, 0x34, 0x12, 0xCD, 0xAB, 0x83, 0x01, 0x81, 0x03};
+  const uint16_t expect[] = {0x1234, 0xABCD, 0xABCD, 0xABCD, 0xABCD, 0xABCD, 0xABCD,
+                             0xABCD, 0xABCD, 0xABCD};
+  uint16_t buf[16] = {0};
+  splash_decoder_init(&dec, stream, sizeof(stream));
+  TEST_ASSERT_EQUAL_size_t(10, splash_decoder_read(&dec, buf, 16));
+  TEST_ASSERT_FALSE(splash_decoder_failed(&dec));
+  TEST_ASSERT_EQUAL_INT(0, memcmp(buf, expect, sizeof(expect)));
+}
+
+void test_splash_decodes_extended_length_and_two_byte_distance() {
+  // 200 literals 0..199, then copy 300 px from 200 back (len ext, 2-byte dist).
+  static uint8_t stream[2 + 400 + 2 + 400 + 5];
+  size_t p = 0;
+  uint16_t v = 0;
+  for (int block = 0; block < 2; ++block) {
+    const int count = block == 0 ? 128 : 72;
+    stream[p++] = (uint8_t)(count - 1);
+    for (int i = 0; i < count; ++i, ++v) {
+      stream[p++] = (uint8_t)(v & 0xFF);
+      stream[p++] = (uint8_t)(v >> 8);
+    }
+  }
+  const uint32_t ext = 300 - 2 - 0x7F;
+  stream[p++] = 0xFF;
+  stream[p++] = (uint8_t)(ext & 0xFF);
+  stream[p++] = (uint8_t)(ext >> 8);
+  stream[p++] = (uint8_t)(0x80 | (200 & 0x7F));
+  stream[p++] = (uint8_t)(200 >> 7);
+
+  static uint16_t buf[600];
+  splash_decoder_init(&dec, stream, p);
+  TEST_ASSERT_EQUAL_size_t(500, splash_decoder_read(&dec, buf, 600));
+  TEST_ASSERT_FALSE(splash_decoder_failed(&dec));
+  for (int i = 0; i < 500; ++i) {
+    TEST_ASSERT_EQUAL_UINT16((uint16_t)(i % 200), buf[i]);
+  }
+}
+
+void test_splash_rejects_corrupt_streams() {
+  uint16_t buf[16];
+
+  const uint8_t truncated_literal[] = {0x02, 0x34, 0x12, 0xCD};
+  splash_decoder_init(&dec, truncated_literal, sizeof(truncated_literal));
+  TEST_ASSERT_EQUAL_size_t(1, splash_decoder_read(&dec, buf, 16));
+  TEST_ASSERT_TRUE(splash_decoder_failed(&dec));
+
+  const uint8_t match_before_start[] = {0x00, 0x34, 0x12, 0x80, 0x02};
+  splash_decoder_init(&dec, match_before_start, sizeof(match_before_start));
+  TEST_ASSERT_EQUAL_size_t(1, splash_decoder_read(&dec, buf, 16));
+  TEST_ASSERT_TRUE(splash_decoder_failed(&dec));
+
+  const uint8_t zero_distance[] = {0x00, 0x34, 0x12, 0x80, 0x00};
+  splash_decoder_init(&dec, zero_distance, sizeof(zero_distance));
+  splash_decoder_read(&dec, buf, 16);
+  TEST_ASSERT_TRUE(splash_decoder_failed(&dec));
+
+  splash_decoder_init(&dec, nullptr, 0);
+  TEST_ASSERT_EQUAL_size_t(0, splash_decoder_read(&dec, buf, 16));
+  TEST_ASSERT_FALSE(splash_decoder_failed(&dec));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_splash_round_trip_panel_strips);
+  RUN_TEST(test_splash_round_trip_odd_strips);
+  RUN_TEST(test_splash_round_trip_single_call);
+  RUN_TEST(test_splash_is_actually_compressed);
+  RUN_TEST(test_splash_decodes_literals_and_runs);
+  RUN_TEST(test_splash_decodes_extended_length_and_two_byte_distance);
+  RUN_TEST(test_splash_rejects_corrupt_streams);
+  return UNITY_END();
+}
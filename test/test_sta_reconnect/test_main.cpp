@@ -0,0 +1,83 @@
+#include <unity.h>
+
+#include "sta_reconnect.h"
+
+namespace {
+
+StaLinkCache cache_for(const char *ssid) {
+  StaLinkCache c;
+  sta_link_cache_clear(&c);
+  c.ssid_hash = sta_ssid_hash(ssid);
+  const uint8_t bssid[6] = {0x24, 0x0a, 0xc4, 0x01, 0x02, 0x03};
+  for (int i = 0; i < 6; ++i) c.bssid[i] = bssid[i];
+  c.channel = 6;
+  return c;
+}
+
+}  // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_sta_backoff_doubles_and_caps() {
+  TEST_ASSERT_EQUAL_UINT32(0, sta_backoff_delay_ms(0));
+  TEST_ASSERT_EQUAL_UINT32(2000, sta_backoff_delay_ms(1));
+  TEST_ASSERT_EQUAL_UINT32(4000, sta_backoff_delay_ms(2));
+  TEST_ASSERT_EQUAL_UINT32(8000, sta_backoff_delay_ms(3));
+  TEST_ASSERT_EQUAL_UINT32(32000, sta_backoff_delay_ms(5));
+  TEST_ASSERT_EQUAL_UINT32(STA_BACKOFF_MAX_MS, sta_backoff_delay_ms(6));
+  TEST_ASSERT_EQUAL_UINT32(STA_BACKOFF_MAX_MS, sta_backoff_delay_ms(255));
+}
+
+void test_sta_link_cache_matches_same_ssid_only() {
+  const StaLinkCache c = cache_for("workshop");
+  TEST_ASSERT_TRUE(sta_link_cache_matches(c, "workshop"));
+  TEST_ASSERT_FALSE(sta_link_cache_matches(c, "workshop5g"));
+  TEST_ASSERT_FALSE(sta_link_cache_matches(c, ""));
+}
+
+void test_sta_link_cache_rejects_empty_or_bad_channel() {
+  StaLinkCache c;
+  sta_link_cache_clear(&c);
+  TEST_ASSERT_FALSE(sta_link_cache_matches(c, "workshop"));
+
+  c = cache_for("workshop");
+  c.channel = 0;
+  TEST_ASSERT_FALSE(sta_link_cache_matches(c, "workshop"));
+
+  c = cache_for("workshop");
+  for (int i = 0; i < 6; ++i) c.bssid[i] = 0;
+  TEST_ASSERT_FALSE(sta_link_cache_matches(c, "workshop"));
+}
+
+void test_sta_connect_stats_track_min_max_mean() {
+  StaConnectStats s = {};
+  TEST_ASSERT_EQUAL_UINT32(0, sta_connect_stats_mean_ms(s));
+  sta_connect_stats_attempt(&s);
+  sta_connect_stats_success(&s, false, 3000);
+  sta_connect_stats_attempt(&s);
+  sta_connect_stats_fast_miss(&s);
+  sta_connect_stats_attempt(&s);
+  sta_connect_stats_success(&s, true, 600);
+  TEST_ASSERT_EQUAL_UINT32(3, s.attempts);
+  TEST_ASSERT_EQUAL_UINT32(2, s.connects);
+  TEST_ASSERT_EQUAL_UINT32(1, s.fast_connects);
+  TEST_ASSERT_EQUAL_UINT32(1, s.fast_misses);
+  TEST_ASSERT_EQUAL_UINT32(600, s.last_ms);
+  TEST_ASSERT_EQUAL_UINT32(600, s.min_ms);
+  TEST_ASSERT_EQUAL_UINT32(3000, s.max_ms);
+  TEST_ASSERT_EQUAL_UINT32(1800, sta_connect_stats_mean_ms(s));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_sta_backoff_doubles_and_caps);
+  RUN_TEST(test_sta_link_cache_matches_same_ssid_only);
+  RUN_TEST(test_sta_link_cache_rejects_empty_or_bad_channel);
+  RUN_TEST(test_sta_connect_stats_track_min_max_mean);
+  return UNITY_END();
+}
@@ -0,0 +1,156 @@
+#include <string.h>
+#include <unity.h>
+
+#include "telemetry_frame.h"
+
+namespace {
+
+TelemetrySample sample(uint32_t seq) {
+  TelemetrySample s;
+  memset(&s, 0, sizeof(s));
+  s.flags = TELEMETRY_FLAG_VERTICAL;
+  s.seq = seq;
+  s.t_us = 1000000UL + seq * 20000UL;
+  s.sens_accel[0] = 0.01f;
+  s.sens_accel[1] = -0.02f;
+  s.sens_accel[2] = 1.0f;
+  s.sens_gyro[2] = 0.5f;
+  s.map_accel[2] = 1.0f;
+  s.corr_accel[2] = 0.998f;
+  s.corr_gyro[0] = -0.125f;
+  s.roll_phys = 1.5f;
+  s.pitch_phys = -2.25f;
+  s.roll = 1.5f + (float)seq;
+  s.pitch = -2.25f;
+  return s;
+}
+
+// Byte stream as captured from the port: text before the stream starts,
+// three frames, a log line between two of them, a cut-off frame and a frame
+// with one flipped bit.
+size_t record_stream(uint8_t *out, size_t cap) {
+  size_t n = 0;
+  const char *banner = "Binary telemetry: ON\r\n";
+  memcpy(out + n, banner, strlen(banner));
+  n += strlen(banner);
+  n += telemetry_frame_encode(sample(7), out + n, cap - n);
+  const char *log = "[remote] STA connected\r\n";
+  memcpy(out + n, log, strlen(log));
+  n += strlen(log);
+  n += telemetry_frame_encode(sample(8), out + n, cap - n);
+
+  uint8_t cut[TELEMETRY_FRAME_MAX_BYTES];
+  const size_t cut_len = telemetry_frame_encode(sample(9), cut, sizeof(cut));
+  memcpy(out + n, cut, cut_len / 2);
+  n += cut_len / 2;
+
+  const size_t bad_at = n;
+  n += telemetry_frame_encode(sample(10), out + n, cap - n);
+  out[bad_at + 20] ^= 0x04;
+
+  n += telemetry_frame_encode(sample(11), out + n, cap - n);
+  return n;
+}
+
+}  // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_telemetry_crc16_check_value() {
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  TEST_ASSERT_EQUAL_HEX32(0x29B1, telemetry_crc16(check, sizeof(check)));
+}
+
+void test_telemetry_pack_layout_is_fixed() {
+  uint8_t p[TELEMETRY_PAYLOAD_BYTES];
+  telemetry_pack(sample(0x01020304UL), p);
+  TEST_ASSERT_EQUAL_UINT8(TELEMETRY_RECORD_SAMPLE, p[0]);
+  TEST_ASSERT_EQUAL_UINT8(TELEMETRY_RECORD_VERSION, p[1]);
+  TEST_ASSERT_EQUAL_UINT8(TELEMETRY_FLAG_VERTICAL, p[2]);
+  TEST_ASSERT_EQUAL_UINT8(0x04, p[4]);
+  TEST_ASSERT_EQUAL_UINT8(0x01, p[7]);
+  // sens_accel[2] = 1.0f = 0x3F800000 at offset 12 + 2 * 4
+  TEST_ASSERT_EQUAL_UINT8(0x00, p[20]);
+  TEST_ASSERT_EQUAL_UINT8(0x80, p[22]);
+  TEST_ASSERT_EQUAL_UINT8(0x3F, p[23]);
+  // roll_phys = 1.5f = 0x3FC00000 at offset 76
+  TEST_ASSERT_EQUAL_UINT8(0xC0, p[78]);
+  TEST_ASSERT_EQUAL_UINT8(0x3F, p[79]);
+}
+
+void test_telemetry_pack_unpack_round_trip() {
+  uint8_t p[TELEMETRY_PAYLOAD_BYTES];
+  const TelemetrySample in = sample(42);
+  telemetry_pack(in, p);
+  TelemetrySample out;
+  TEST_ASSERT_TRUE(telemetry_unpack(p, sizeof(p), &out));
+  TEST_ASSERT_EQUAL_UINT32(42, out.seq);
+  TEST_ASSERT_EQUAL_UINT32(in.t_us, out.t_us);
+  TEST_ASSERT_EQUAL_UINT8(in.flags, out.flags);
+  TEST_ASSERT_EQUAL_INT(0, memcmp(in.sens_accel, out.sens_accel, sizeof(in.sens_accel)));
+  TEST_ASSERT_FLOAT_WITHIN(0.0f, -0.125f, out.corr_gyro[0]);
+  TEST_ASSERT_FLOAT_WITHIN(0.0f, 43.5f, out.roll);
+
+  p[30] ^= 0x01;
+  TEST_ASSERT_FALSE(telemetry_unpack(p, sizeof(p), &out));
+}
+
+void test_cobs_round_trip_with_zeros_and_long_runs() {
+  uint8_t in[600];
+  for (size_t i = 0; i < sizeof(in); ++i) in[i] = (uint8_t)((i % 300 == 17) ? 0 : (i % 251) + 1);
+  uint8_t enc[620];
+  uint8_t dec[600];
+  const size_t n = cobs_encode(in, sizeof(in), enc, sizeof(enc));
+  TEST_ASSERT_TRUE(n > sizeof(in));
+  for (size_t i = 0; i < n; ++i) TEST_ASSERT_NOT_EQUAL(0, enc[i]);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(in), cobs_decode(enc, n, dec, sizeof(dec)));
+  TEST_ASSERT_EQUAL_INT(0, memcmp(in, dec, sizeof(in)));
+  TEST_ASSERT_EQUAL_UINT32(0, cobs_encode(in, sizeof(in), enc, 100));
+}
+
+void test_telemetry_frame_fits_max_size() {
+  uint8_t frame[TELEMETRY_FRAME_MAX_BYTES];
+  const size_t n = telemetry_frame_encode(sample(1), frame, sizeof(frame));
+  TEST_ASSERT_TRUE(n > 0 && n <= TELEMETRY_FRAME_MAX_BYTES);
+  TEST_ASSERT_EQUAL_UINT8(0, frame[0]);
+  TEST_ASSERT_EQUAL_UINT8(0, frame[n - 1]);
+  TEST_ASSERT_EQUAL_UINT32(0, telemetry_frame_encode(sample(1), frame, 40));
+}
+
+void test_telemetry_decoder_recovers_from_recorded_stream() {
+  uint8_t stream[1024];
+  const size_t len = record_stream(stream, sizeof(stream));
+
+  TelemetryStreamDecoder dec;
+  telemetry_decoder_reset(&dec);
+  uint32_t seqs[8];
+  size_t got = 0;
+  TelemetrySample s;
+  for (size_t i = 0; i < len; ++i) {
+    if (telemetry_decoder_feed(&dec, stream[i], &s) && got < 8) seqs[got++] = s.seq;
+  }
+  TEST_ASSERT_EQUAL_UINT32(3, got);
+  TEST_ASSERT_EQUAL_UINT32(7, seqs[0]);
+  TEST_ASSERT_EQUAL_UINT32(8, seqs[1]);
+  TEST_ASSERT_EQUAL_UINT32(11, seqs[2]);
+  TEST_ASSERT_EQUAL_UINT32(3, dec.frames_ok);
+  // Banner, log line, cut frame (ends at the next frame's leading delimiter)
+  // and the corrupted frame.
+  TEST_ASSERT_EQUAL_UINT32(4, dec.frames_bad);
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_telemetry_crc16_check_value);
+  RUN_TEST(test_telemetry_pack_layout_is_fixed);
+  RUN_TEST(test_telemetry_pack_unpack_round_trip);
+  RUN_TEST(test_cobs_round_trip_with_zeros_and_long_runs);
+  RUN_TEST(test_telemetry_frame_fits_max_size);
+  RUN_TEST(test_telemetry_decoder_recovers_from_recorded_stream);
+  return UNITY_END();
+}
@@ -0,0 +1,107 @@
+#include <unity.h>
+
+#include "trend_buffer.h"
+
+namespace {
+
+TrendBuffer buf;
+
+}  // namespace
+
+void setUp(void) {
+  trend_buffer_init(&buf, 1);
+}
+
+void tearDown(void) {}
+
+void test_trend_buffer_starts_empty() {
+  TrendSample s;
+  TrendSample hi;
+  TEST_ASSERT_EQUAL_size_t(0, trend_buffer_count(&buf));
+  TEST_ASSERT_FALSE(trend_buffer_at(&buf, 0, &s));
+  TEST_ASSERT_FALSE(trend_buffer_range(&buf, 10, &s, &hi));
+}
+
+void test_trend_buffer_decimates_by_averaging() {
+  trend_buffer_init(&buf, 4);
+  TEST_ASSERT_FALSE(trend_buffer_push(&buf, 1.0f, -1.0f));
+  TEST_ASSERT_FALSE(trend_buffer_push(&buf, 2.0f, -2.0f));
+  TEST_ASSERT_FALSE(trend_buffer_push(&buf, 3.0f, -3.0f));
+  TEST_ASSERT_TRUE(trend_buffer_push(&buf, 6.0f, -6.0f));
+  TEST_ASSERT_EQUAL_size_t(1, trend_buffer_count(&buf));
+
+  TrendSample s;
+  TEST_ASSERT_TRUE(trend_buffer_at(&buf, 0, &s));
+  TEST_ASSERT_EQUAL_FLOAT(3.0f, s.roll);
+  TEST_ASSERT_EQUAL_FLOAT(-3.0f, s.pitch);
+}
+
+void test_trend_buffer_zero_decimation_means_every_sample() {
+  trend_buffer_init(&buf, 0);
+  TEST_ASSERT_TRUE(trend_buffer_push(&buf, 1.0f, 2.0f));
+  TEST_ASSERT_TRUE(trend_buffer_push(&buf, 3.0f, 4.0f));
+  TEST_ASSERT_EQUAL_size_t(2, trend_buffer_count(&buf));
+}
+
+void test_trend_buffer_overwrites_oldest_when_full() {
+  const uint32_t n = TREND_BUFFER_CAPACITY + 37;
+  for (uint32_t i = 0; i < n; ++i) {
+    trend_buffer_push(&buf, (float)i, -(float)i);
+  }
+  TEST_ASSERT_EQUAL_size_t(TREND_BUFFER_CAPACITY, trend_buffer_count(&buf));
+  TEST_ASSERT_EQUAL_UINT32(n, buf.total);
+
+  TrendSample s;
+  TEST_ASSERT_FALSE(trend_buffer_at(&buf, 36, &s));
+  TEST_ASSERT_TRUE(trend_buffer_at(&buf, 37, &s));
+  TEST_ASSERT_EQUAL_FLOAT(37.0f, s.roll);
+  TEST_ASSERT_TRUE(trend_buffer_at(&buf, n - 1, &s));
+  TEST_ASSERT_EQUAL_FLOAT((float)(n - 1), s.roll);
+  TEST_ASSERT_EQUAL_FLOAT(-(float)(n - 1), s.pitch);
+  TEST_ASSERT_FALSE(trend_buffer_at(&buf, n, &s));
+}
+
+void test_trend_buffer_range_covers_newest_samples() {
+  const float roll[] = {0.5f, -2.0f, 4.0f, 1.0f, 1.5f};
+  const float pitch[] = {10.0f, 11.0f, 9.0f, 12.5f, 10.5f};
+  for (int i = 0; i < 5; ++i) trend_buffer_push(&buf, roll[i], pitch[i]);
+
+  TrendSample lo;
+  TrendSample hi;
+  TEST_ASSERT_TRUE(trend_buffer_range(&buf, 0, &lo, &hi));
+  TEST_ASSERT_EQUAL_FLOAT(-2.0f, lo.roll);
+  TEST_ASSERT_EQUAL_FLOAT(4.0f, hi.roll);
+  TEST_ASSERT_EQUAL_FLOAT(9.0f, lo.pitch);
+  TEST_ASSERT_EQUAL_FLOAT(12.5f, hi.pitch);
+
+  TEST_ASSERT_TRUE(trend_buffer_range(&buf, 2, &lo, &hi));
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, lo.roll);
+  TEST_ASSERT_EQUAL_FLOAT(1.5f, hi.roll);
+  TEST_ASSERT_EQUAL_FLOAT(10.5f, lo.pitch);
+  TEST_ASSERT_EQUAL_FLOAT(12.5f, hi.pitch);
+}
+
+void test_trend_buffer_range_after_wrap() {
+  for (uint32_t i = 0; i < TREND_BUFFER_CAPACITY * 2; ++i) {
+    trend_buffer_push(&buf, (i < TREND_BUFFER_CAPACITY) ? 100.0f : (float)(i % 7), 0.0f);
+  }
+  TrendSample lo;
+  TrendSample hi;
+  TEST_ASSERT_TRUE(trend_buffer_range(&buf, TREND_BUFFER_CAPACITY * 4, &lo, &hi));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, lo.roll);
+  TEST_ASSERT_EQUAL_FLOAT(6.0f, hi.roll);
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_trend_buffer_starts_empty);
+  RUN_TEST(test_trend_buffer_decimates_by_averaging);
+  RUN_TEST(test_trend_buffer_zero_decimation_means_every_sample);
+  RUN_TEST(test_trend_buffer_overwrites_oldest_when_full);
+  RUN_TEST(test_trend_buffer_range_covers_newest_samples);
+  RUN_TEST(test_trend_buffer_range_after_wrap);
+  return UNITY_END();
+}